@@ -172,6 +172,41 @@ mli_status mli_hlp_point_to_subtensor(const mli_tensor *in, const mli_point_to_s
  */
 mli_status mli_hlp_create_subtensor(const mli_tensor *in, const mli_sub_tensor_cfg *cfg, mli_tensor *out);
 
+/**
+ * @brief Create a permuted view of a tensor
+ *
+ * @detail This function is a zero-copy alternative of the permute kernel. The output tensor
+ * points to the data of the input tensor and has shape and memory strides of the input permuted
+ * according to cfg: out.shape[k] = in.shape[perm_dim[k]], out.mem_stride[k] = in.mem_stride[perm_dim[k]].
+ * Result can be passed to any kernel which accepts tensors with arbitrary memory strides.
+ *
+ * For more info on primitive see MLI Documentation
+ *
+ * @param in      [I] Input tensor (of any shape)
+ * @param cfg     [I] Permute parameters structure (for more info see @ref mli_permute_cfg)
+ * @param out     [O] Output tensor. Result will be stored here
+ *
+ * @return MLI status code
+ */
+mli_status mli_hlp_permute_view(const mli_tensor *in, const mli_permute_cfg *cfg, mli_tensor *out);
+
+/**
+ * @brief Transform 3x3 convolution weights for Winograd convolution
+ *
+ * @detail Function computes filter transform of Winograd F(2x2, 3x3) or F(4x4, 3x3) algorithm for each
+ * input/output channel pair of weights. The transform is scaled to integers (by 4 and 576 respectively),
+ * so result is exact. Output tensor is int32 (MLI_EL_SA_32) of [4, 4, Cin, Cout] or [6, 6, Cin, Cout] shape.
+ * It's intended to be computed once (offline) and passed to mli_krn_conv2d_hwcn_*_k3x3_winograd kernels.
+ * Only data container of wino_weights must be filled by user.
+ *
+ * @param weights      [I] Convolution weights tensor of [3, 3, Cin, Cout] shape
+ * @param type         [I] Winograd algorithm (for more info see @ref mli_winograd_type)
+ * @param wino_weights [O] Transformed weights tensor. Result will be stored here
+ *
+ * @return MLI status code
+ */
+mli_status mli_hlp_conv2d_winograd_weights(const mli_tensor *weights, mli_winograd_type type, mli_tensor *wino_weights);
+
 int32_t mli_hlp_tensor_scale_shift(const mli_tensor *in, const uint32_t scale_idx);
 
 int32_t mli_hlp_tensor_scale(const mli_tensor *in, const uint32_t scale_idx);
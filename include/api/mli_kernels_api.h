@@ -120,6 +120,50 @@ mli_status mli_krn_conv2d_hwcn_sa8_sa8_sa32_k3x3(
         const mli_conv2d_cfg* cfg,
         mli_tensor* out);
 
+//========================================================
+// Winograd specializations for k3x3 (unit stride)
+//========================================================
+/**
+ * @brief 2D convolution with 3x3 kernel by Winograd F(2x2, 3x3) or F(4x4, 3x3) algorithm
+ *
+ * @detail Same result as mli_krn_conv2d_hwcn_*_k3x3 with 2.25x (F(2x2, 3x3)) or 4x (F(4x4, 3x3)) less
+ * multiplications. Stride must be 1 and dilation is not supported. The algorithm is defined by the shape
+ * of pre-transformed weights (see mli_hlp_conv2d_winograd_weights), so it can be chosen per layer.
+ * MLI_STATUS_NOT_SUPPORTED is returned if accumulation of transformed data might overflow.
+ *
+ * @param in           [I] Input feature map tensor (3-dimensional tensor)
+ * @param weights      [I] Convolution filters weights tensor (used for quantization parameters)
+ * @param wino_weights [I] Winograd transformed weights tensor of [4, 4, Cin, Cout] or [6, 6, Cin, Cout] shape
+ * @param bias         [I] Convolution filters biases tensor (1-dimensional tensor)
+ * @param cfg          [I] Convolution parameters structure (for more info see @ref mli_conv2d_cfg)
+ * @param out          [O] Output feature map tensor. Result is stored here
+ *
+ * @return MLI status code
+ */
+mli_status mli_krn_conv2d_hwcn_fx16_k3x3_winograd(
+        const mli_tensor* in,
+        const mli_tensor* weights,
+        const mli_tensor* wino_weights,
+        const mli_tensor* bias,
+        const mli_conv2d_cfg* cfg,
+        mli_tensor* out);
+
+mli_status mli_krn_conv2d_hwcn_fx16_fx8_fx8_k3x3_winograd(
+        const mli_tensor* in,
+        const mli_tensor* weights,
+        const mli_tensor* wino_weights,
+        const mli_tensor* bias,
+        const mli_conv2d_cfg* cfg,
+        mli_tensor* out);
+
+mli_status mli_krn_conv2d_hwcn_sa8_sa8_sa32_k3x3_winograd(
+        const mli_tensor* in,
+        const mli_tensor* weights,
+        const mli_tensor* wino_weights,
+        const mli_tensor* bias,
+        const mli_conv2d_cfg* cfg,
+        mli_tensor* out);
+
 //========================================================
 // Specializations for k5x5
 //========================================================
@@ -237,6 +281,64 @@ mli_status mli_krn_depthwise_conv2d_hwcn_sa8_sa8_sa32_k5x5(
         const mli_conv2d_cfg* cfg,
         mli_tensor* out);
 
+//========================================================
+// Pre-validated versions
+//========================================================
+/**
+ * @brief Preparation of a pre-validated 2D convolution or depthwise convolution layer
+ *
+ * @detail The function checks the layer parameters once, as the kernel itself does, and fills a compact descriptor
+ * with the derived quantization parameters, ReLU limits and the kernel specialization chosen by the size of weights.
+ * Weights and bias tensors are referenced by the descriptor and must stay unchanged while it is in use.
+ *
+ * @param in       [I] Input feature map tensor (3-dimensional tensor). Only its shape and quantization params are used
+ * @param weights  [I] Convolution filters weights tensor (4-dimensional tensor)
+ * @param bias     [I] Convolution filters biases tensor (1-dimensional tensor)
+ * @param cfg      [I] Convolution parameters structure (for more info see @ref mli_conv2d_cfg)
+ * @param out      [I] Output feature map tensor. Only its shape and quantization params are used
+ * @param prepared [O] Descriptor of the pre-validated layer (for more info see @ref mli_conv2d_prepared)
+ *
+ * @return MLI status code
+ */
+mli_status mli_krn_conv2d_hwcn_sa8_sa8_sa32_prepare(
+        const mli_tensor * in,
+        const mli_tensor * weights,
+        const mli_tensor * bias,
+        const mli_conv2d_cfg * cfg,
+        const mli_tensor * out,
+        mli_conv2d_prepared * prepared);
+
+mli_status mli_krn_depthwise_conv2d_hwcn_sa8_sa8_sa32_prepare(
+        const mli_tensor * in,
+        const mli_tensor * weights,
+        const mli_tensor * bias,
+        const mli_conv2d_cfg * cfg,
+        const mli_tensor * out,
+        mli_conv2d_prepared * prepared);
+
+/**
+ * @brief Execution of a pre-validated 2D convolution or depthwise convolution layer
+ *
+ * @detail The function performs no parameter checks. Input and output tensors must have the same shapes,
+ * memory strides and quantization params as the tensors passed to the corresponding *_prepare() function.
+ * Only data pointers may differ. The descriptor must be filled by the *_prepare() function of the same kernel.
+ *
+ * @param prepared [I] Descriptor of the pre-validated layer
+ * @param in       [I] Input feature map tensor (3-dimensional tensor)
+ * @param out      [O] Output feature map tensor. Result is stored here
+ *
+ * @return MLI status code
+ */
+mli_status mli_krn_conv2d_hwcn_sa8_sa8_sa32_run_prepared(
+        const mli_conv2d_prepared * prepared,
+        const mli_tensor * in,
+        mli_tensor * out);
+
+mli_status mli_krn_depthwise_conv2d_hwcn_sa8_sa8_sa32_run_prepared(
+        const mli_conv2d_prepared * prepared,
+        const mli_tensor * in,
+        mli_tensor * out);
+
 /**
  * @brief 2D Group convolution
  *
@@ -598,6 +700,51 @@ mli_status mli_krn_fully_connected_sa8_sa8_sa32_ext_bias(
         const mli_fully_connected_cfg * cfg,
         mli_tensor * out);
 
+/**
+ * @brief Precalculation of quantization parameters for fully connected layer
+ *
+ * @detail The function checks the layer parameters as mli_krn_fully_connected_sa8_sa8_sa32 does, and fills
+ * per output channel tables of the cache: fused bias including the input zero point additive, output
+ * multipliers and shifts. It is intended to be called once for static weights (for instance, at model load).
+ *
+ * @param in      [I] Input feature tensor. Only its shape and quantization params are used
+ * @param weights [I] Weights tensor (2-dimensional tensor)
+ * @param bias    [I] Biases tensor (1-dimensional tensor)
+ * @param cfg     [I] Fully Connected configuration structure (for more info see @ref mli_fully_connected_cfg)
+ * @param out     [I] Output feature tensor. Only its shape and quantization params are used
+ * @param cache   [O] Cached quantization parameters (for more info see @ref mli_sa8_quant_cache)
+ *
+ * @return MLI status code
+ */
+mli_status mli_krn_fully_connected_sa8_sa8_sa32_cache_quant(
+        const mli_tensor * in,
+        const mli_tensor * weights,
+        const mli_tensor * bias,
+        const mli_fully_connected_cfg * cfg,
+        mli_tensor * out,
+        mli_sa8_quant_cache * cache);
+
+/**
+ * @brief Fully connected layer with cached quantization parameters
+ *
+ * @detail Same result as mli_krn_fully_connected_sa8_sa8_sa32 for the tensors the cache was filled for.
+ * The kernel consumes the cached per channel tables directly instead of deriving them from tensors.
+ *
+ * @param in      [I] Input feature tensor (of any shape, or of (batch, N) shape for batched mode)
+ * @param weights [I] Weights tensor (2-dimensional tensor)
+ * @param cache   [I] Cached quantization parameters filled by mli_krn_fully_connected_sa8_sa8_sa32_cache_quant
+ * @param cfg     [I] Fully Connected configuration structure (for more info see @ref mli_fully_connected_cfg)
+ * @param out     [O] Output feature tensor. Result will be stored here
+ *
+ * @return MLI status code
+ */
+mli_status mli_krn_fully_connected_sa8_sa8_sa32_cached(
+        const mli_tensor * in,
+        const mli_tensor * weights,
+        const mli_sa8_quant_cache * cache,
+        const mli_fully_connected_cfg * cfg,
+        mli_tensor * out);
+
 /**
  * @brief Long Short Term Memory (LSTM) Cell
  *
@@ -920,6 +1067,56 @@ mli_status mli_krn_softmax_fx8(const mli_tensor *in, const mli_lut *lut, const m
 mli_status mli_krn_softmax_create_lut(mli_lut *lut);
 int32_t mli_krn_softmax_get_lut_size();
 
+/**
+ * @brief Log Softmax
+ *
+ * @detail This kernel computes logarithm of softmax: out = x - max(x) - log(sum(exp(x - max(x)))).
+ * Maximum and sum of exponents are computed in a single (online) pass over each slice.
+ * Uses the same LUT as softmax (see mli_krn_softmax_create_lut()).
+ *
+ * For more info on primitive see MLI Documentation
+ *
+ * @param in      [I] Input feature tensor (of any shape)
+ * @param lut     [I] LUT prepared by mli_krn_softmax_create_lut()
+ * @param cfg     [I] Configuration structure (axis)
+ * @param out     [O] Output feature tensor. Result will be stored here
+ *
+ * @return MLI status code
+ */
+mli_status mli_krn_log_softmax_sa8(const mli_tensor *in, const mli_lut *lut, const mli_softmax_cfg *cfg, mli_tensor *out);
+
+/**
+ * @brief Streaming Softmax
+ *
+ * @detail This group of functions computes softmax (or log softmax, or top-k of softmax) of a single slice
+ * which is passed in chunks, so a slice which doesn't fit a fast memory can be processed tile by tile.
+ * Each chunk is a tensor of any shape with all its values belonging to the slice. All chunks are passed
+ * to mli_krn_softmax_stream_update_sa8() in order (single pass with running maximum and sum of exponents).
+ * After that, each chunk can be passed again to mli_krn_softmax_stream_normalize_sa8() or
+ * mli_krn_log_softmax_stream_normalize_sa8() to get output values of this chunk, and
+ * mli_krn_softmax_stream_topk_sa8() returns probabilities and indexes of the topk largest values
+ * without a second pass over the input.
+ *
+ * For more info on primitive see MLI Documentation
+ *
+ * @param topk    [I] Number of the largest values to track (0 to MLI_SOFTMAX_STREAM_MAX_TOPK)
+ * @param in      [I] Input chunk
+ * @param lut     [I] LUT prepared by mli_krn_softmax_create_lut()
+ * @param state   [I/O] Streaming softmax state
+ * @param out     [O] Output tensor. Result will be stored here
+ * @param out_idx [O] Output tensor of MLI_EL_SA_32 type for indexes of the top-k values in the slice
+ *
+ * @return MLI status code
+ */
+mli_status mli_krn_softmax_stream_init(int32_t topk, mli_softmax_stream_state *state);
+mli_status mli_krn_softmax_stream_update_sa8(const mli_tensor *in, const mli_lut *lut, mli_softmax_stream_state *state);
+mli_status mli_krn_softmax_stream_normalize_sa8(const mli_tensor *in, const mli_lut *lut,
+                                                const mli_softmax_stream_state *state, mli_tensor *out);
+mli_status mli_krn_log_softmax_stream_normalize_sa8(const mli_tensor *in, const mli_lut *lut,
+                                                    const mli_softmax_stream_state *state, mli_tensor *out);
+mli_status mli_krn_softmax_stream_topk_sa8(const mli_lut *lut, const mli_softmax_stream_state *state,
+                                           mli_tensor *out, mli_tensor *out_idx);
+
 /**
  * @brief L2 Normalization Activation function
  *
@@ -954,6 +1151,8 @@ int32_t mli_krn_l2_normalize_get_lut_size();
  * saving the shape of inputs. It supports simple broadcasting of single value (scalar tensor) on general tensor.
  * One of the operands can be a scalar (Note, special tensor-scalar form can be used. see mli_tensor description in 
  * MLI Documentation)
+ * Non-scalar operands are broadcasted along dimensions of size 1 (and missing outer dimensions)
+ * to the shape of the output tensor without copying of data.
  *
  * For more info on primitive see MLI Documentation
  *
@@ -973,6 +1172,8 @@ mli_status mli_krn_eltwise_add_sa8(const mli_tensor * in1, const mli_tensor * in
  * @detail This kernel subtracts element-wise, the second input tensor (subtrahend) from the first input tensor (minuend) 
  * and stores results to the output tensor It supports simple broadcasting of single value (scalar tensor) on general tensor.
  * One of the operands can be a scalar (Note, special tensor-scalar form can be used. see mli_tensor description in MLI Documentation)
+ * Non-scalar operands are broadcasted along dimensions of size 1 (and missing outer dimensions)
+ * to the shape of the output tensor without copying of data.
  *
  * For more info on primitive see MLI Documentation
  *
@@ -991,6 +1192,8 @@ mli_status mli_krn_eltwise_sub_sa8(const mli_tensor * in1, const mli_tensor * in
  * @detail This kernel multiplies two tensors of the same shape element-wise and store results to the output tensor 
  * saving the shape of inputs. It supports simple broadcasting of single value (scalar tensor) on general tensor.
  * One of the operands can be a scalar (Note, special tensor-scalar form can be used. see mli_tensor description in MLI Documentation)
+ * Non-scalar operands are broadcasted along dimensions of size 1 (and missing outer dimensions)
+ * to the shape of the output tensor without copying of data.
  *
  * For more info on primitive see MLI Documentation
  *
@@ -1009,6 +1212,8 @@ mli_status mli_krn_eltwise_mul_sa8(const mli_tensor * in1, const mli_tensor * in
  * @detail This kernel finds element-wise maximum / minimum of inputs operands and store results to the output tensor
  * saving the shape of inputs. It supports simple broadcasting of single value (scalar tensor) on general tensor.
  * One of the operands can be a scalar (Note, special tensor-scalar form can be used. see mli_tensor description in MLI Documentation)
+ * Non-scalar operands are broadcasted along dimensions of size 1 (and missing outer dimensions)
+ * to the shape of the output tensor without copying of data.
  *
  * For more info on primitive see MLI Documentation
  *
@@ -203,6 +203,72 @@ mli_mov_acquire_handle(int num_ch, mli_mov_handle_t* h);
 mli_status
 mli_mov_release_handle(mli_mov_handle_t* h);
 
+#if defined(MLI_HOST_DMA_EMU)
+//---------------------------------------------------------------------
+// Host DMA emulator (x86/AArch64 host emulation build only)
+//---------------------------------------------------------------------
+
+/**
+ * @brief Configuration of the host DMA emulator
+ */
+typedef struct _mli_mov_emu_cfg_t {
+    int num_ch;            /**< number of emulated channels. Channels [0; num_ch) are emulated */
+    uint32_t latency_us;   /**< fixed latency of each transfer in microseconds */
+    uint32_t bytes_per_us; /**< bandwidth of each channel in bytes per microsecond. 0 - unlimited */
+} mli_mov_emu_cfg_t;
+
+/**
+ * @brief Utilization statistics of an emulated DMA channel
+ */
+typedef struct _mli_mov_emu_stats_t {
+    uint32_t transfers;  /**< number of completed transfers */
+    uint64_t bytes;      /**< number of bytes written to destination tensors */
+    uint64_t busy_us;    /**< time the channel spent on transfers (including modeled latency) */
+    uint64_t elapsed_us; /**< time since the emulator was enabled or statistics were reset */
+} mli_mov_emu_stats_t;
+
+/**
+ * @brief Enable the host DMA emulator
+ * @detail After this call asynchronous transfers of handles with at least one emulated channel
+ * are executed by a background thread of the channel. The data is copied when the transfer is
+ * started, and the transfer completes after latency_us + size / bytes_per_us microseconds.
+ * Callbacks are called from the channel thread before the transfer is reported as done.
+ * Transfers with handles without channels (i.e. mli_mov_tensor_sync()) stay synchronous.
+ * @param cfg  [I] pointer to emulator configuration
+ * @return MLI status code
+ */
+mli_status
+mli_mov_emu_enable(const mli_mov_emu_cfg_t* cfg);
+
+/**
+ * @brief Disable the host DMA emulator
+ * @detail This function waits for all started transfers and stops the channel threads.
+ * If the emulator is still enabled at program exit, the same is done during destruction
+ * of static objects of the library. Callbacks of transfers which are still in progress at
+ * that point must not use objects which may already be destroyed.
+ * @return MLI status code
+ */
+mli_status
+mli_mov_emu_disable(void);
+
+/**
+ * @brief Get utilization statistics of an emulated channel
+ * @param ch     [I] dma channel
+ * @param stats  [O] pointer to statistics struct
+ * @return MLI status code
+ */
+mli_status
+mli_mov_emu_get_stats(int ch, mli_mov_emu_stats_t* stats);
+
+/**
+ * @brief Reset utilization statistics of all emulated channels
+ * @return MLI status code
+ */
+mli_status
+mli_mov_emu_reset_stats(void);
+
+#endif // MLI_HOST_DMA_EMU
+
 
 //---------------------------------------------------------------------
 // Helper functions to fill mli_mov_cfg_t
@@ -109,6 +109,14 @@ public:
 
     unsigned GetEncodedWeightsSize() override;
 
+    float GetWeightsCompressionRatio() const override;
+
+    /**
+     * In Compressed and Sparse modes the ctrl buffer is used as a scratch memory
+     * for the weights tile expanded at run-time.
+     */
+    unsigned GetCtrlBufferSize() const override;
+
     /**
      * @deprecated
      */
@@ -157,6 +165,21 @@ public:
                                    const OffsetBuffer& wtszeropts,
                                    const OffsetBuffer& ctrl_buffer) override;
 
+    /**
+     * Encoded epilogue parameters layout (for all Co output channels):
+     * in_bias (int32) x Co | scale (int16) x Co | shift (int8) x Co | out_bias (int8) x Co | LUT (int8) x 256
+     * The LUT part is present only if use_lut is set in the epilogue configuration.
+     */
+    mli_status EncodeEpilogueParams(const Tensor<Buffer, kConvEpilogueParamRank> &in_bias,
+                                    const Tensor<Buffer, kConvEpilogueParamRank> &scale,
+                                    const Tensor<Buffer, kConvEpilogueParamRank> &shift,
+                                    const Tensor<Buffer, kConvEpilogueParamRank> &out_bias,
+                                    const Tensor<Buffer, kConvEpilogueParamRank> *lut,
+                                    Buffer &encoded_params) override;
+
+    unsigned GetEncodedEpilogueParamsSize() const override;
+
+    mli_status AttachEpilogueBufferOffsets(const OffsetBuffer &epilogue_params) override;
 
     mli_status GetKernelPrivateData(void* kernel_private_data_buffer) override;
 
@@ -182,6 +205,13 @@ private:
     // Configuration for Conv2d
     Conv2DConfig m_config;
 
+    // Scratch buffer for expanded weights and size of the encoded weights (Compressed and Sparse modes)
+    OffsetBuffer m_decoded_weights_buffer;
+    uint32_t m_encoded_weights_size;
+
+    // Encoded rescale parameters and LUT of the fused epilogue (if enabled)
+    OffsetBuffer m_epilogue_params_buffer;
+
     // The size of input, weights and output buffers used in `GetXX` methods
     uint32_t m_input_buffer_size;
     uint32_t m_weights_buffer_size;
@@ -253,6 +283,14 @@ public:
 
     unsigned GetEncodedWeightsSize() override;
 
+    float GetWeightsCompressionRatio() const override;
+
+    /**
+     * In Compressed and Sparse modes the ctrl buffer is used as a scratch memory
+     * for the weights tile expanded at run-time.
+     */
+    unsigned GetCtrlBufferSize() const override;
+
     /**
       * @deprecated
       */
@@ -315,6 +353,10 @@ private:
     // Configuration for Conv2d
     DwConv2DConfig m_config;
 
+    // Scratch buffer for expanded weights and size of the encoded weights (Compressed and Sparse modes)
+    OffsetBuffer m_decoded_weights_buffer;
+    uint32_t m_encoded_weights_size;
+
     // The size of input, weights and output buffers used in `GetXX` methods
     uint32_t m_input_buffer_size;
     uint32_t m_weights_buffer_size;
@@ -372,6 +414,14 @@ public:
 
     unsigned GetEncodedWeightsSize() const override;
 
+    float GetWeightsCompressionRatio() const override;
+
+    /**
+     * In Compressed and Sparse modes the ctrl buffer is used as a scratch memory
+     * for the weights tile expanded at run-time.
+     */
+    unsigned GetCtrlBufferSize() const override;
+
     /**
      * @deprecated
      */
@@ -422,6 +472,10 @@ private:
     // Configuration for TransposeConv2DConfig
     TransposeConv2DConfig m_config;
 
+    // Scratch buffer for expanded weights and size of the encoded weights (Compressed and Sparse modes)
+    OffsetBuffer m_decoded_weights_buffer;
+    uint32_t m_encoded_weights_size;
+
     // Platform descriptor
     lib_mli::PlatformDescription m_pd;
 };
@@ -602,6 +656,14 @@ public:
 
     unsigned GetEncodedWeightsSize() const override;
 
+    float GetWeightsCompressionRatio() const override;
+
+    /**
+     * In Compressed and Sparse modes the ctrl buffer is used as a scratch memory
+     * for the weights tile expanded at run-time.
+     */
+    unsigned GetCtrlBufferSize() const override;
+
     /**
       * @deprecated
       */
@@ -636,6 +698,11 @@ private:
     Tensor<OffsetBuffer, kFullyConnectedZPRank> m_wtszp;
     Tensor<OffsetBuffer, kFullyConnectedIORank> m_output;
     OffsetBuffer m_weights_zp;
+    FullyConnectedConfig m_config;
+
+    // Scratch buffer for expanded weights and size of the encoded weights (Compressed and Sparse modes)
+    OffsetBuffer m_decoded_weights_buffer;
+    uint32_t m_encoded_weights_size;
 };
 
 class TableBuiltin_CS : public lib_mli::TableBuiltin_CS {
@@ -1287,6 +1354,87 @@ private:
     lib_mli::PlatformDescription m_pd;
 };
 
+class EltwiseChain_CS : public lib_mli::EltwiseChain_CS {
+public:
+
+    /**
+     * @brief Constructor to create an EltwiseChain compiler support object.
+     *
+     * This constructor can be used to create EltwiseChain compiler support
+     * object. This kernel computes each value of the output tensor by the sequence of
+     * pointwise operations of the config applied to the values of the two input tensors.
+     * Dimensions of size 1 of inputs are broadcasted to the output shape.
+     *
+     * @param pd                [I] Platform description
+     * @param in_left           [I] First Input tensorIterator (full shape)
+     * @param in_right          [I] Second Input tensorIterator (full shape)
+     * @param cfg               [I] Steps of the chain
+     * @param output            [I] Output tensorIterator (full shape)
+     */
+    EltwiseChain_CS(const lib_mli::PlatformDescription &pd,
+                    const TensorIterator<NoBuffer, kEltwiseRank, kEltwiseIterRank> &in_left,
+                    const TensorIterator<NoBuffer, kEltwiseRank, kEltwiseIterRank> &in_right,
+                    const EltwiseChainConfig &cfg,
+                    const TensorIterator<NoBuffer, kEltwiseRank, kEltwiseIterRank> &output);
+
+    // From CompilerGenericInterface
+    unsigned GetKernelPrivateDataSize() const override;
+    unsigned GetRuntimeObjectSize() const override;
+    mli_status GetKernelPrivateData(void* kernel_private_data_buffer) override;
+    mli_status AttachBufferOffsets(const OffsetBuffer &input_left,
+                                   const OffsetBuffer &input_right,
+                                   const OffsetBuffer &output,
+                                   const OffsetBuffer &encoded_params,
+                                   const OffsetBuffer &ctrl_buffer) override;
+
+    // From EltwiseChain_CS
+    mli_status EncodeRescaleParams(uint32_t step,
+                                   const Tensor<Buffer, kEltwiseChainParamRank> &in_bias,
+                                   const Tensor<Buffer, kEltwiseChainParamRank> &out_bias,
+                                   const Tensor<Buffer, kEltwiseChainParamRank> &scale,
+                                   const Tensor<Buffer, kEltwiseChainParamRank> &shift,
+                                   Buffer &encoded_params) override;
+    mli_status EncodePreluParams(uint32_t step,
+                                 const Tensor<Buffer, kEltwiseChainParamRank> &in_bias,
+                                 const Tensor<Buffer, kEltwiseChainParamRank> &out_bias,
+                                 const Tensor<Buffer, kEltwiseChainParamRank> &posscale,
+                                 const Tensor<Buffer, kEltwiseChainParamRank> &negscale,
+                                 const Tensor<Buffer, kEltwiseChainParamRank> &posshift,
+                                 const Tensor<Buffer, kEltwiseChainParamRank> &negshift,
+                                 Buffer &encoded_params) override;
+    mli_status EncodeClipParams(uint32_t step,
+                                const Tensor<Buffer, kEltwiseChainParamRank> &min_val,
+                                const Tensor<Buffer, kEltwiseChainParamRank> &max_val,
+                                Buffer &encoded_params) override;
+    mli_status EncodeLutParams(uint32_t step,
+                               const Tensor<Buffer, kEltwiseChainParamRank> &lut,
+                               Buffer &encoded_params) override;
+    unsigned GetEncodedParamsSize() const override;
+    unsigned GetInputLeftBufferSize() override;
+    unsigned GetInputRightBufferSize() override;
+    unsigned GetOutputBufferSize() override;
+
+private:
+    // Number of parameter sets of the step: one per channel or one for the whole tensor
+    uint32_t GetStepParamsNum(uint32_t step) const;
+
+    TensorIterator<OffsetBuffer, kEltwiseRank, kEltwiseIterRank> m_in_left;
+    TensorIterator<OffsetBuffer, kEltwiseRank, kEltwiseIterRank> m_in_right;
+    TensorIterator<OffsetBuffer, kEltwiseRank, kEltwiseIterRank> m_output;
+    EltwiseChainConfig m_config;
+
+    OffsetBuffer m_encoded_params;
+    uint32_t m_param_offsets[kEltwiseChainMaxSteps];
+    uint32_t m_encoded_params_size;
+    uint32_t m_channels;
+
+    uint32_t m_in_left_buffer_size;
+    uint32_t m_in_right_buffer_size;
+    uint32_t m_output_buffer_size;
+
+    lib_mli::PlatformDescription m_pd;
+};
+
 class Clip_CS : public lib_mli::Clip_CS {
 
  public:
@@ -1456,11 +1604,13 @@ public:
      * @param in_left           [I] First Input tensorIterator
      * @param in_right          [I] Second Input tensorIterator
      * @param output            [O] Output tensorIterator
+     * @param io_elem_size      [I] Element size of inputs and their zero points (int8 or int16)
      */
     MatMul_CS(const lib_mli::PlatformDescription &pd,
               const TensorIterator<NoBuffer, kMatMulRank, kMatMulIterRank> &in_left,
               const TensorIterator<NoBuffer, kMatMulRank, kMatMulIterRank> &in_right,
-              const TensorIterator<NoBuffer, kMatMulRank, kMatMulIterRank> &output);
+              const TensorIterator<NoBuffer, kMatMulRank, kMatMulIterRank> &output,
+              uint32_t io_elem_size = sizeof(int8_t));
 
     // From CompilerGenericInterface
     unsigned GetKernelPrivateDataSize() const override;
@@ -75,6 +75,8 @@ public:
                               int32_t weights_offsets[kConvWRank]);
 
 private:
+    friend class KernelPerfEstimatorFactory;
+
     void UpdateTilePaddings();
 
     Conv2dMetadata m_metadata;
@@ -129,6 +131,8 @@ public:
                               int32_t input_offsets[kDepthwiseIORank], int32_t output_offsets[kDepthwiseIORank],
                               int32_t weights_offsets[kDepthwiseWRank]);
 private:
+    friend class KernelPerfEstimatorFactory;
+
     void UpdateTilePaddings();
 
     // object with tensor iterators to update during tiling and get sizes for current tile state 
@@ -188,6 +192,8 @@ public:
                               int32_t weights_offsets[kTransposeConvWRank]);
 
 private:
+    friend class KernelPerfEstimatorFactory;
+
     void UpdateTilePaddings();
 
     TransposeConv2DMetadata m_metadata;
@@ -239,6 +245,8 @@ public:
     mli_status Update() override;
 
 private:
+    friend class KernelPerfEstimatorFactory;
+
     TensorIterator<InternalBuffer, kMoveRank, kMoveIterRank> m_src_it;
     TensorIterator<InternalBuffer, kMoveRank, kMoveIterRank> m_dst_it;
 };
@@ -288,6 +296,8 @@ public:
                               int32_t input_offsets[kPoolRank], int32_t output_offsets[kPoolRank]);
 
 private:
+    friend class KernelPerfEstimatorFactory;
+
     void UpdateTilePaddings();
 
     TensorIterator<OffsetBuffer, kPoolRank, kPoolIterRank> m_input;
@@ -297,6 +307,7 @@ private:
     int32_t m_input_batch_offset;
     int32_t m_output_batch_offset;
     uint32_t m_io_elem_size;
+    Layout m_layout;
 
     // Tile state
     uint32_t m_tile_batch_size;
@@ -339,6 +350,8 @@ public:
     mli_status Update() override;
 
 private:
+    friend class KernelPerfEstimatorFactory;
+
     FullyConnectedMetadata m_metadata;
     // element size of input feature map
     uint32_t m_i_elem_size;
@@ -393,6 +406,8 @@ public:
                               int32_t input_offsets[kPoolRank], int32_t output_offsets[kPoolRank]);
 
 private:
+    friend class KernelPerfEstimatorFactory;
+
     void UpdateTilePaddings();
     
     mli_pool_cfg m_cfg;
@@ -405,6 +420,7 @@ private:
     
     uint32_t m_i_elem_size;
     uint32_t m_o_elem_size;
+    Layout m_layout;
 
     // Tile state
     uint32_t m_tile_batch_size;
@@ -457,6 +473,8 @@ public:
     void GetIOSizesAndOffsets(uint32_t input_left_size[kEltwiseRank],uint32_t input_right_size[kEltwiseRank], uint32_t output_size[kEltwiseRank],
                               int32_t input_left_offsets[kEltwiseRank],int32_t input_right_offsets[kEltwiseRank],int32_t output_offsets[kEltwiseRank]);
 private:
+    friend class KernelPerfEstimatorFactory;
+
     TensorIterator<OffsetBuffer, kEltwiseRank, kEltwiseIterRank> m_input_left;
     TensorIterator<OffsetBuffer, kEltwiseRank, kEltwiseIterRank> m_input_right;
     TensorIterator<OffsetBuffer, kEltwiseRank, kEltwiseIterRank> m_output;
@@ -513,6 +531,8 @@ public:
     void GetIOSizesAndOffsets(uint32_t input_left_size[kEltwiseRank],uint32_t input_right_size[kEltwiseRank], uint32_t output_size[kEltwiseRank],
                               int32_t input_left_offsets[kEltwiseRank],int32_t input_right_offsets[kEltwiseRank],int32_t output_offsets[kEltwiseRank]);
 private:
+    friend class KernelPerfEstimatorFactory;
+
     TensorIterator<OffsetBuffer, kEltwiseRank, kEltwiseIterRank> m_input_left;
     TensorIterator<OffsetBuffer, kEltwiseRank, kEltwiseIterRank> m_input_right;
     TensorIterator<OffsetBuffer, kEltwiseRank, kEltwiseIterRank> m_output;
@@ -569,6 +589,8 @@ public:
     void GetIOSizesAndOffsets(uint32_t input_left_size[kEltwiseRank],uint32_t input_right_size[kEltwiseRank], uint32_t output_size[kEltwiseRank],
                               int32_t input_left_offsets[kEltwiseRank],int32_t input_right_offsets[kEltwiseRank],int32_t output_offsets[kEltwiseRank]);
 private:
+    friend class KernelPerfEstimatorFactory;
+
     TensorIterator<OffsetBuffer, kEltwiseRank, kEltwiseIterRank> m_input_left;
     TensorIterator<OffsetBuffer, kEltwiseRank, kEltwiseIterRank> m_input_right;
     TensorIterator<OffsetBuffer, kEltwiseRank, kEltwiseIterRank> m_output;
@@ -626,6 +648,8 @@ public:
                               int32_t input_left_offsets[kEltwiseRank],int32_t input_right_offsets[kEltwiseRank],int32_t output_offsets[kEltwiseRank]);
 
 private:
+    friend class KernelPerfEstimatorFactory;
+
     TensorIterator<OffsetBuffer, kEltwiseRank, kEltwiseIterRank> m_input_left;
     TensorIterator<OffsetBuffer, kEltwiseRank, kEltwiseIterRank> m_input_right;
     TensorIterator<OffsetBuffer, kEltwiseRank, kEltwiseIterRank> m_output;
@@ -682,6 +706,8 @@ public:
     void GetIOSizesAndOffsets(uint32_t input_left_size[kEltwiseRank],uint32_t input_right_size[kEltwiseRank], uint32_t output_size[kEltwiseRank],
                               int32_t input_left_offsets[kEltwiseRank],int32_t input_right_offsets[kEltwiseRank],int32_t output_offsets[kEltwiseRank]);
 private:
+    friend class KernelPerfEstimatorFactory;
+
     TensorIterator<OffsetBuffer, kEltwiseRank, kEltwiseIterRank> m_input_left;
     TensorIterator<OffsetBuffer, kEltwiseRank, kEltwiseIterRank> m_input_right;
     TensorIterator<OffsetBuffer, kEltwiseRank, kEltwiseIterRank> m_output;
@@ -693,6 +719,68 @@ private:
 
 };
 
+/**
+ * @brief This class implements the EltwiseChain kernel xop interpreter interface
+ *
+ *
+ */
+class EltwiseChain : public ExecutionInterface {
+
+public:
+
+   /**
+     * @brief Construct a new EltwiseChain object
+     *
+     * This method will create and initialize the EltwiseChain object using the information
+     * stored in the kernel_private_data_buffer that has been computed at compile time
+     * by the GetKernelPrivateData() method.
+     *
+     * This kernel computes each value of the output tensor by the steps of EltwiseChainConfig
+     * applied to the corresponding values in the two input tensors in a single pass over the tile.
+     *
+     * @param kernel_private_data_buffer    [I] Pointer to the compilation time computed initialization data.
+     * @param size                          [I] Size of the data is used to check for coding errors.
+     * @param membases[]                    [I] The kernel private data may contain offsets inside a (vector) memory.
+     *                                          At run-time specific locations in memory are allocated for
+     *                                          the graph, the membase array contains the start of
+     *                                          each memory region.
+     *                                          This base will be added to all memory offsets in the constructor
+     *                                          according to the memory ID associated with that offset.
+     *                                          Each platform can have different (number of) memories. For mli
+     *                                          this is completely transparent. Compiler needs to use the same
+     *                                          memory id's when attaching the buffers as are used by the
+     *                                          xop-interpreter to set the membases.
+     * @param num_mems                      [I] Number of memory regions passed with membases array.
+     */
+    EltwiseChain(void* kernel_private_data_buffer, size_t size, uint64_t membases[], int num_mems);
+
+    mli_status Issue() override;
+
+    mli_status Prefetch() override;
+
+    mli_status Update() override;
+
+    void GetIOSizesAndOffsets(uint32_t input_left_size[kEltwiseRank], uint32_t input_right_size[kEltwiseRank],
+                              uint32_t output_size[kEltwiseRank], int32_t input_left_offsets[kEltwiseRank],
+                              int32_t input_right_offsets[kEltwiseRank], int32_t output_offsets[kEltwiseRank]) const;
+private:
+    friend class KernelPerfEstimatorFactory;
+
+    TensorIterator<OffsetBuffer, kEltwiseRank, kEltwiseIterRank> m_input_left;
+    TensorIterator<OffsetBuffer, kEltwiseRank, kEltwiseIterRank> m_input_right;
+    TensorIterator<OffsetBuffer, kEltwiseRank, kEltwiseIterRank> m_output;
+    Tensor<InternalBuffer, kEltwiseRank> m_tile_input_left;
+    Tensor<InternalBuffer, kEltwiseRank> m_tile_input_right;
+    Tensor<InternalBuffer, kEltwiseRank> m_tile_output;
+    InternalBuffer m_encoded_params;
+    EltwiseChainConfig m_config;
+    uint32_t m_param_offsets[kEltwiseChainMaxSteps];
+    uint32_t m_channels;
+    uint32_t m_i_elem_size;
+    uint32_t m_o_elem_size;
+
+};
+
 /**
  * @brief This class implements the Rescale kernel xop interpreter interface
  *
@@ -714,6 +802,8 @@ public:
                               uint32_t& shift_offset, uint32_t& out_bias_offset);
 
 private:
+    friend class KernelPerfEstimatorFactory;
+
     TensorIterator<OffsetBuffer, kRescaleRank, kRescaleIterRank> m_input;
     TensorIterator<OffsetBuffer, kRescaleParamRank, kRescaleIterRank> m_enc_param;
     TensorIterator<OffsetBuffer, kRescaleRank, kRescaleIterRank> m_output;
@@ -739,6 +829,8 @@ class Clip : public ExecutionInterface {
     mli_status Update() override;
 
 private:
+    friend class KernelPerfEstimatorFactory;
+
     TensorIterator<OffsetBuffer, kClipRank, kClipIterRank> m_input;
     TensorIterator<OffsetBuffer, kClipRank, kClipIterRank> m_output;
 
@@ -792,6 +884,8 @@ public:
     void GetIOSizesAndOffsets(uint32_t input_size[kReduceMaxRank], uint32_t output_size[kReduceMaxRank],
                               int32_t input_offsets[kReduceMaxRank], int32_t output_offsets[kReduceMaxRank]);
 private:
+    friend class KernelPerfEstimatorFactory;
+
     TensorIterator<OffsetBuffer, kReduceMaxRank, kReduceMaxIterRank> m_input;
     TensorIterator<OffsetBuffer, kReduceMaxRank, kReduceMaxIterRank> m_output;
     mli_tensor m_tile_input;
@@ -848,6 +942,8 @@ public:
                               int32_t input_offsets[kPermuteRank], int32_t output_offsets[kPermuteRank]);
 
 private:
+    friend class KernelPerfEstimatorFactory;
+
     PermuteMetadata m_metadata;
     uint8_t m_perm_dim[kPermuteRank];
 
@@ -898,6 +994,8 @@ public:
                               int32_t input_right_offsets[kMatMulRank], int32_t output_offsets[kMatMulRank]) const;
 
 private:
+    friend class KernelPerfEstimatorFactory;
+
     TensorIterator<OffsetBuffer, kMatMulRank, kMatMulIterRank> m_input_left;
     TensorIterator<OffsetBuffer, kMatMulRank, kMatMulIterRank> m_input_right;
     TensorIterator<OffsetBuffer, kMatMulRank, kMatMulIterRank> m_output;
@@ -919,6 +1017,30 @@ private:
 class TableBuiltin : public ExecutionInterface {
 
 public:
+    /**
+     * @brief Construct a new TableBuiltin object
+     *
+     * This method will create and initialize the TableBuiltin object using the information
+     * stored in the kernel_private_data_buffer that has been computed at compile time
+     * by the GetKernelPrivateData() method.
+     *
+     * This kernel adds the input bias to each input value and transforms the result
+     * with the builtin lookup table selected by the configuration.
+     *
+     * @param kernel_private_data_buffer [I] Pointer to the compilation time computed initialization data.
+     * @param size        [I] Size of the data is used to check for coding errors.
+     * @param membases[]  [I] The kernel private data may contain offsets inside a (vector) memory.
+     *                        At run-time specific locations in memory are allocated for
+     *                        the graph, the membase array contains the start of
+     *                        each memory region.
+     *                        This base will be added to all memory offsets in the constructor
+     *                        according to the memory ID associated with that offset.
+     *                        Each platform can have different (number of) memories. For mli
+     *                        this is completely transparent. Compiler needs to use the same
+     *                        memory id's when attaching the buffers as are used by the
+     *                        xop-interpreter to set the membases.
+     * @param num_mems    [I] Number of memory regions passed with membases array.
+     */
     TableBuiltin(void* kernel_private_data_buffer, size_t size, uint64_t membases[], int num_mems);
 
     mli_status Issue() override;
@@ -927,8 +1049,18 @@ public:
 
     mli_status Update() override;
 
+    void GetIOSizesAndOffsets(uint32_t input_size[kTableBuiltinIORank], uint32_t output_size[kTableBuiltinIORank],
+                              int32_t input_offsets[kTableBuiltinIORank], int32_t output_offsets[kTableBuiltinIORank]);
+
 private:
+    friend class KernelPerfEstimatorFactory;
+
     TableBuiltinMetadata m_metadata;
+    int32_t m_bias_axis;
+
+    mli_tensor m_tile_input;
+    mli_tensor m_tile_output;
+    const int16_t* m_bias;
 
     uint32_t m_in_elem_size;
     uint32_t m_out_elem_size;
@@ -976,6 +1108,8 @@ class Prelu : public ExecutionInterface {
                               uint32_t &out_bias_offset);
 
 private:
+    friend class KernelPerfEstimatorFactory;
+
 
     TensorIterator<OffsetBuffer, kPreluRank, kPreluIterRank> m_input;
     TensorIterator<OffsetBuffer, kPreluRank, kPreluIterRank> m_output;
@@ -1029,6 +1163,8 @@ public:
                               int32_t input_offsets[kReduceSumRank], int32_t output_offsets[kReduceSumRank]);
 
 private:
+    friend class KernelPerfEstimatorFactory;
+
     TensorIterator<OffsetBuffer, kReduceSumRank, kReduceSumIterRank> m_input;
     TensorIterator<OffsetBuffer, kReduceSumRank, kReduceSumIterRank> m_output;
     int32_t m_reduce_axis;
@@ -1085,9 +1221,19 @@ public:
                               int32_t input_offsets[kResizeBilinearRank], int32_t output_offsets[kResizeBilinearRank]);
 
 private:
+    friend class KernelPerfEstimatorFactory;
+
     TensorIterator<OffsetBuffer, kResizeBilinearRank, kResizeBilinearIterRank> m_input;
     TensorIterator<OffsetBuffer, kResizeBilinearRank, kResizeBilinearIterRank> m_output;
     ResizeOpConfig m_cfg;
+
+    // Offsets of the current output tile in the coordinates of the current input tile
+    int32_t m_tile_offset[ResizeOpConfig::kResizeParamRank];
+
+    mli_tensor m_tile_input;
+    mli_tensor m_tile_output;
+
+    void UpdateTileConfig();
 };
 
 
@@ -1130,11 +1276,19 @@ public:
 
     mli_status Update() override;
 
+    void GetIOSizesAndOffsets(uint32_t input_size[kArgMaxInRank], uint32_t output_size[kArgMaxOutRank],
+                              int32_t input_offsets[kArgMaxInRank], int32_t output_offsets[kArgMaxOutRank]);
+
 private:
+    friend class KernelPerfEstimatorFactory;
+
     TensorIterator<OffsetBuffer, kArgMaxInRank, kArgMaxInIterRank> m_input;
     TensorIterator<OffsetBuffer, kArgMaxOutRank, kArgMaxOutIterRank> m_output;
     int32_t m_axis;
 
+    mli_tensor m_tile_input;
+    mli_tensor m_tile_output;
+
     uint32_t m_in_elem_size;
     uint32_t m_out_elem_size;
 };
@@ -1181,6 +1335,8 @@ public:
 
 
 private:
+    friend class KernelPerfEstimatorFactory;
+
     TensorIterator<OffsetBuffer, kMoveBroadcastRank, kMoveBroadcastIterRank> m_src;
     TensorIterator<OffsetBuffer, kMoveBroadcastRank, kMoveBroadcastIterRank> m_dst;
     Tensor<InternalBuffer, kMoveBroadcastRank> m_tile_src;
@@ -1190,9 +1346,6 @@ private:
     void MoveBroadcastRun(Tensor<buf_T, N> &src, Tensor<buf_T, N> &dst);
 };
 
-// TODO: remove this after standard version of ResizeBilinear with Issue() will be added
-void run_mli_resize_bilinear_standalone(const mli_tensor* in, const ResizeOpConfig& cfg, mli_tensor* out);
-
 } // namespace snps_arc::metaware::mli::ref
 
 #endif // _MLI_REF_RUNTIME_API_HPP_
@@ -0,0 +1,427 @@
+/*
+* Copyright 2022, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+#ifndef _MLI_REF_PERF_ESTIM_HPP_
+#define _MLI_REF_PERF_ESTIM_HPP_
+
+#include "mli_types.h"
+#include "mli_types.hpp"
+#include "mli_iterator.hpp"
+#include "mli_perf_estim.hpp"
+#include "mli_ref_runtime_api.hpp"
+
+namespace snps_arc::metaware::mli::ref {
+
+/**
+ * @brief Cost of a single tile as estimated by the kernel perf model
+ */
+struct TileCost {
+    int64_t cycles;
+    int64_t read_bytes;
+    int64_t write_bytes;
+    int64_t macs;
+};
+
+// Cost model functions shared by the kernel estimators below and the Tiler.
+// See KernelPerfEstimator for the description of the model.
+uint32_t GetPerfVectorLanes(const PlatformDescription& pd, uint32_t elem_size);
+int64_t GetPerfMacCycles(const PlatformDescription& pd, int64_t macs, uint32_t elem_size);
+int64_t GetPerfElemCycles(const PlatformDescription& pd, int64_t elem_ops, uint32_t elem_size);
+int64_t GetPerfMemCycles(const PlatformDescription& pd, int64_t bytes);
+int64_t GetPerfTileOverheadCycles(const PlatformDescription& pd);
+
+/**
+ * @brief Common part of the reference kernel performance estimators
+ *
+ * Each kernel estimator keeps a copy of the tile iterators of the run-time object
+ * it was created for and walks over them without touching the tensor data. Derived
+ * classes only need to describe the cost of the current tile: the number of MAC and
+ * element-wise operations and the amount of bytes moved. This class turns these
+ * numbers into cycles using the PlatformDescription:
+ *
+ *  - MACs and element-wise ops are issued on vectors of GetVectorLength8bit() or
+ *    GetVectorLength16bit() lanes depending on the input element size;
+ *  - MACs are spread over GetMacIssueSlots() slots;
+ *  - when the accumulator headroom (including guard bits) is not enough, partial
+ *    sums are spilled to a wider accumulator which costs an extra vector operation;
+ *  - load/store of operands is done with vectors of GetVectorLength8bit() bytes
+ *    and is assumed to run in parallel with compute;
+ *  - each tile has a fixed setup overhead which depends on the AGU configuration.
+ */
+class KernelPerfEstimator : public PerfEstimator {
+public:
+    KernelPerfEstimator(lib_mli::PlatformDescription& pd, int num_tiles)
+        : PerfEstimator(pd, num_tiles) {}
+
+    int GetTotalCycles() override { return static_cast<int>(GetTotalCost().cycles); }
+    int GetTileCycles(int tile_idx) override { return static_cast<int>(GetTileCost(tile_idx).cycles); }
+    int GetTotalReadBytes() override { return static_cast<int>(GetTotalCost().read_bytes); }
+    int GetTotalWriteBytes() override { return static_cast<int>(GetTotalCost().write_bytes); }
+    int GetTileReadBytes(int tile_idx) override { return static_cast<int>(GetTileCost(tile_idx).read_bytes); }
+    int GetTileWriteBytes(int tile_idx) override { return static_cast<int>(GetTileCost(tile_idx).write_bytes); }
+    int GetTotalMacs() override { return static_cast<int>(GetTotalCost().macs); }
+    int GetTileMacs(int tile_idx) override { return static_cast<int>(GetTileCost(tile_idx).macs); }
+
+protected:
+    /**
+     * @brief Move all the tile iterators to the first tile
+     */
+    virtual void ResetTiles() = 0;
+
+    /**
+     * @brief Move all the tile iterators to the next tile
+     */
+    virtual void NextTile() = 0;
+
+    /**
+     * @brief Compute the cost of the tile the iterators currently point to
+     */
+    virtual TileCost GetCurrentTileCost() = 0;
+
+    // Number of vector lanes available for the elements of elem_size bytes
+    uint32_t GetVectorLanes(uint32_t elem_size) const;
+
+    // Cycles to perform a number of MAC operations on operands of elem_size bytes
+    int64_t GetMacCycles(int64_t macs, uint32_t elem_size) const;
+
+    // Cycles to perform a number of element-wise operations on operands of elem_size bytes
+    int64_t GetElemCycles(int64_t elem_ops, uint32_t elem_size) const;
+
+    // Cycles to load or store a number of bytes
+    int64_t GetMemCycles(int64_t bytes) const;
+
+    // Fixed cost of the tile setup (descriptors, pointers and loop counters)
+    int64_t GetTileOverheadCycles() const;
+
+    // Combine compute and memory parts of the tile into the cost of the tile
+    TileCost MakeTileCost(int64_t compute_cycles, int64_t read_bytes,
+                          int64_t write_bytes, int64_t macs) const;
+
+    template <typename buf_T, unsigned tensorRank, unsigned iterRank>
+    static int64_t GetTileDims(TensorIterator<buf_T, tensorRank, iterRank>& it,
+                               uint32_t dims[tensorRank]) {
+        const auto tile = it.GetSubTensor();
+        tile.get_dims(dims);
+        return tile.get_total_elem_num();
+    }
+
+    template <typename buf_T, unsigned tensorRank, unsigned iterRank>
+    static int64_t GetTileBytes(TensorIterator<buf_T, tensorRank, iterRank>& it) {
+        const auto tile = it.GetSubTensor();
+        return (int64_t)tile.get_total_elem_num() * tile.get_elem_size();
+    }
+
+private:
+    TileCost GetTileCost(int tile_idx);
+    TileCost GetTotalCost();
+
+    // Tile the iterators point to after GetTileCost(), -1 if unknown. Tiles requested in
+    // increasing order (i.e. by the Profiler for each issued tile) are reached without
+    // walking from the first tile again.
+    int m_tile_pos{-1};
+};
+
+class Conv2dPerfEstimator : public KernelPerfEstimator {
+public:
+    Conv2dPerfEstimator(lib_mli::PlatformDescription& pd, const Conv2dMetadata& metadata, int num_tiles);
+
+protected:
+    void ResetTiles() override;
+    void NextTile() override;
+    TileCost GetCurrentTileCost() override;
+
+private:
+    TensorIterator<OffsetBuffer, kConvIORank, kConvIOIterRank> m_input;
+    TensorIterator<OffsetBuffer, kConvWRank, kConvWIterRank> m_weights;
+    TensorIterator<OffsetBuffer, kConvZPRank, kConvZPIterRank> m_weights_zp;
+    TensorIterator<OffsetBuffer, kConvIORank, kConvIOIterRank> m_output;
+};
+
+class DepthwiseConv2dPerfEstimator : public KernelPerfEstimator {
+public:
+    DepthwiseConv2dPerfEstimator(lib_mli::PlatformDescription& pd,
+                                 const DepthwiseConv2dMetadata& metadata, int num_tiles);
+
+protected:
+    void ResetTiles() override;
+    void NextTile() override;
+    TileCost GetCurrentTileCost() override;
+
+private:
+    TensorIterator<OffsetBuffer, kDepthwiseIORank, kDepthwiseIterRank> m_input;
+    TensorIterator<OffsetBuffer, kDepthwiseWRank, kDepthwiseIterRank> m_weights;
+    TensorIterator<OffsetBuffer, kDepthwiseZPRank, kDepthwiseIterRank> m_weights_zp;
+    TensorIterator<OffsetBuffer, kDepthwiseIORank, kDepthwiseIterRank> m_output;
+};
+
+class TransposeConv2DPerfEstimator : public KernelPerfEstimator {
+public:
+    TransposeConv2DPerfEstimator(lib_mli::PlatformDescription& pd,
+                                 const TransposeConv2DMetadata& metadata, int num_tiles);
+
+protected:
+    void ResetTiles() override;
+    void NextTile() override;
+    TileCost GetCurrentTileCost() override;
+
+private:
+    TensorIterator<OffsetBuffer, kTransposeConvIORank, kTransposeConvIOIterRank> m_input;
+    TensorIterator<OffsetBuffer, kTransposeConvWRank, kTransposeConvWIterRank> m_weights;
+    TensorIterator<OffsetBuffer, kTransposeConvZPRank, kTransposeConvZPIterRank> m_weights_zp;
+    TensorIterator<OffsetBuffer, kTransposeConvIORank, kTransposeConvIOIterRank> m_output;
+};
+
+class FullyConnectedPerfEstimator : public KernelPerfEstimator {
+public:
+    FullyConnectedPerfEstimator(lib_mli::PlatformDescription& pd,
+                                const FullyConnectedMetadata& metadata,
+                                uint32_t i_elem_size, uint32_t w_elem_size, uint32_t o_elem_size,
+                                int num_tiles);
+
+protected:
+    void ResetTiles() override {}
+    void NextTile() override {}
+    TileCost GetCurrentTileCost() override;
+
+private:
+    uint32_t m_batch;
+    uint32_t m_in_ch;
+    uint32_t m_out_ch;
+    uint32_t m_i_elem_size;
+    uint32_t m_w_elem_size;
+    uint32_t m_o_elem_size;
+};
+
+class MatMulPerfEstimator : public KernelPerfEstimator {
+public:
+    MatMulPerfEstimator(lib_mli::PlatformDescription& pd,
+                        const TensorIterator<OffsetBuffer, kMatMulRank, kMatMulIterRank>& input_left,
+                        const TensorIterator<OffsetBuffer, kMatMulRank, kMatMulIterRank>& input_right,
+                        const TensorIterator<OffsetBuffer, kMatMulRank, kMatMulIterRank>& output,
+                        int num_tiles);
+
+protected:
+    void ResetTiles() override;
+    void NextTile() override;
+    TileCost GetCurrentTileCost() override;
+
+private:
+    TensorIterator<OffsetBuffer, kMatMulRank, kMatMulIterRank> m_input_left;
+    TensorIterator<OffsetBuffer, kMatMulRank, kMatMulIterRank> m_input_right;
+    TensorIterator<OffsetBuffer, kMatMulRank, kMatMulIterRank> m_output;
+};
+
+class Pool2DPerfEstimator : public KernelPerfEstimator {
+public:
+    Pool2DPerfEstimator(lib_mli::PlatformDescription& pd,
+                        const TensorIterator<OffsetBuffer, kPoolRank, kPoolIterRank>& input,
+                        const TensorIterator<OffsetBuffer, kPoolRank, kPoolIterRank>& output,
+                        const mli_pool_cfg& cfg, bool is_sum, int num_tiles);
+
+protected:
+    void ResetTiles() override;
+    void NextTile() override;
+    TileCost GetCurrentTileCost() override;
+
+private:
+    TensorIterator<OffsetBuffer, kPoolRank, kPoolIterRank> m_input;
+    TensorIterator<OffsetBuffer, kPoolRank, kPoolIterRank> m_output;
+    uint32_t m_kernel_size;
+    // SumPool accumulates and rescales the result, MaxPool only compares elements
+    bool m_is_sum;
+};
+
+/**
+ * @brief Estimator for all the binary element-wise kernels (Add, Sub, Mul, Max, Min, EltwiseChain)
+ *
+ * The number of MACs and element-wise operations per output element describe the kernel
+ * (i.e. a single MAC for Mul, one MAC per requantization step for EltwiseChain).
+ */
+class EltwisePerfEstimator : public KernelPerfEstimator {
+public:
+    EltwisePerfEstimator(lib_mli::PlatformDescription& pd,
+                         const TensorIterator<OffsetBuffer, kEltwiseRank, kEltwiseIterRank>& input_left,
+                         const TensorIterator<OffsetBuffer, kEltwiseRank, kEltwiseIterRank>& input_right,
+                         const TensorIterator<OffsetBuffer, kEltwiseRank, kEltwiseIterRank>& output,
+                         uint32_t macs_per_elem, uint32_t ops_per_elem, int num_tiles);
+
+protected:
+    void ResetTiles() override;
+    void NextTile() override;
+    TileCost GetCurrentTileCost() override;
+
+private:
+    TensorIterator<OffsetBuffer, kEltwiseRank, kEltwiseIterRank> m_input_left;
+    TensorIterator<OffsetBuffer, kEltwiseRank, kEltwiseIterRank> m_input_right;
+    TensorIterator<OffsetBuffer, kEltwiseRank, kEltwiseIterRank> m_output;
+    uint32_t m_macs_per_elem;
+    uint32_t m_ops_per_elem;
+};
+
+/**
+ * @brief Estimator for the unary kernels which process each element independently
+ *
+ * Used for Rescale, Clip, Prelu, TableBuiltin, Permute and ResizeBilinear. The number of
+ * MACs per element and the number of element-wise operations per element describe the
+ * kernel. Elements are counted on the input tile unless is_output_driven is set.
+ */
+template <unsigned tensorRank, unsigned iterRank>
+class UnaryPerfEstimator : public KernelPerfEstimator {
+public:
+    UnaryPerfEstimator(lib_mli::PlatformDescription& pd,
+                       const TensorIterator<OffsetBuffer, tensorRank, iterRank>& input,
+                       const TensorIterator<OffsetBuffer, tensorRank, iterRank>& output,
+                       int num_tiles, uint32_t macs_per_elem, uint32_t ops_per_elem,
+                       bool is_output_driven = false)
+        : KernelPerfEstimator(pd, num_tiles),
+          m_input(input),
+          m_output(output),
+          m_macs_per_elem(macs_per_elem),
+          m_ops_per_elem(ops_per_elem),
+          m_is_output_driven(is_output_driven) {}
+
+protected:
+    void ResetTiles() override {
+        m_input.Reset();
+        m_output.Reset();
+    }
+
+    void NextTile() override {
+        m_input.Next();
+        m_output.Next();
+    }
+
+    TileCost GetCurrentTileCost() override {
+        const auto in_tile = m_input.GetSubTensor();
+        const int64_t elems = m_is_output_driven ? m_output.GetSubTensor().get_total_elem_num()
+                                                 : in_tile.get_total_elem_num();
+        const uint32_t elem_size = in_tile.get_elem_size();
+        const int64_t macs = elems * m_macs_per_elem;
+        const int64_t compute = GetMacCycles(macs, elem_size) +
+                                GetElemCycles(elems * m_ops_per_elem, elem_size);
+        return MakeTileCost(compute, GetTileBytes(m_input), GetTileBytes(m_output), macs);
+    }
+
+private:
+    TensorIterator<OffsetBuffer, tensorRank, iterRank> m_input;
+    TensorIterator<OffsetBuffer, tensorRank, iterRank> m_output;
+    uint32_t m_macs_per_elem;
+    uint32_t m_ops_per_elem;
+    bool m_is_output_driven;
+};
+
+using RescalePerfEstimator = UnaryPerfEstimator<kRescaleRank, kRescaleIterRank>;
+using ClipPerfEstimator = UnaryPerfEstimator<kClipRank, kClipIterRank>;
+using PreluPerfEstimator = UnaryPerfEstimator<kPreluRank, kPreluIterRank>;
+using PermutePerfEstimator = UnaryPerfEstimator<kPermuteRank, kPermuteIterRank>;
+using TableBuiltinPerfEstimator = UnaryPerfEstimator<kTableBuiltinIORank, kTableBuiltinIOIterRank>;
+using ResizeBilinearPerfEstimator = UnaryPerfEstimator<kResizeBilinearRank, kResizeBilinearIterRank>;
+
+/**
+ * @brief Estimator for the reduction kernels (ReduceMax, ReduceSum, ArgMax)
+ *
+ * The cost is driven by the input tile: each input element is visited once.
+ */
+template <unsigned inRank, unsigned inIterRank, unsigned outRank, unsigned outIterRank>
+class ReducePerfEstimator : public KernelPerfEstimator {
+public:
+    ReducePerfEstimator(lib_mli::PlatformDescription& pd,
+                        const TensorIterator<OffsetBuffer, inRank, inIterRank>& input,
+                        const TensorIterator<OffsetBuffer, outRank, outIterRank>& output,
+                        int num_tiles, uint32_t ops_per_elem)
+        : KernelPerfEstimator(pd, num_tiles),
+          m_input(input),
+          m_output(output),
+          m_ops_per_elem(ops_per_elem) {}
+
+protected:
+    void ResetTiles() override {
+        m_input.Reset();
+        m_output.Reset();
+    }
+
+    void NextTile() override {
+        m_input.Next();
+        m_output.Next();
+    }
+
+    TileCost GetCurrentTileCost() override {
+        const auto in_tile = m_input.GetSubTensor();
+        const int64_t elems = in_tile.get_total_elem_num();
+        const int64_t compute = GetElemCycles(elems * m_ops_per_elem, in_tile.get_elem_size());
+        return MakeTileCost(compute, GetTileBytes(m_input), GetTileBytes(m_output), 0);
+    }
+
+private:
+    TensorIterator<OffsetBuffer, inRank, inIterRank> m_input;
+    TensorIterator<OffsetBuffer, outRank, outIterRank> m_output;
+    uint32_t m_ops_per_elem;
+};
+
+using ReduceMaxPerfEstimator = ReducePerfEstimator<kReduceMaxRank, kReduceMaxIterRank,
+                                                   kReduceMaxRank, kReduceMaxIterRank>;
+using ReduceSumPerfEstimator = ReducePerfEstimator<kReduceSumRank, kReduceSumIterRank,
+                                                   kReduceSumRank, kReduceSumIterRank>;
+using ArgMaxPerfEstimator = ReducePerfEstimator<kArgMaxInRank, kArgMaxInIterRank,
+                                                kArgMaxOutRank, kArgMaxOutIterRank>;
+
+/**
+ * @brief Estimator for the data movement kernels (Move, MoveBroadcast)
+ *
+ * No compute is performed, the cost is defined by the amount of bytes moved.
+ */
+template <typename buf_T, unsigned tensorRank, unsigned iterRank>
+class MovePerfEstimator : public KernelPerfEstimator {
+public:
+    MovePerfEstimator(lib_mli::PlatformDescription& pd,
+                      const TensorIterator<buf_T, tensorRank, iterRank>& src,
+                      const TensorIterator<buf_T, tensorRank, iterRank>& dst,
+                      int num_tiles)
+        : KernelPerfEstimator(pd, num_tiles), m_src(src), m_dst(dst) {}
+
+protected:
+    void ResetTiles() override {
+        m_src.Reset();
+        m_dst.Reset();
+    }
+
+    void NextTile() override {
+        m_src.Next();
+        m_dst.Next();
+    }
+
+    TileCost GetCurrentTileCost() override {
+        return MakeTileCost(0, GetTileBytes(m_src), GetTileBytes(m_dst), 0);
+    }
+
+private:
+    TensorIterator<buf_T, tensorRank, iterRank> m_src;
+    TensorIterator<buf_T, tensorRank, iterRank> m_dst;
+};
+
+using MoveBroadcastPerfEstimator = MovePerfEstimator<OffsetBuffer, kMoveBroadcastRank,
+                                                     kMoveBroadcastIterRank>;
+
+/**
+ * @brief Factory of the reference kernel performance estimators
+ *
+ * Creates the estimator that matches the kernel_id of the run-time object. The factory
+ * is a friend of the reference run-time classes to get a copy of their tile iterators.
+ */
+class KernelPerfEstimatorFactory {
+public:
+    static PerfEstimator* Create(void* allocation_memory_buffer, uint32_t alloc_buf_size,
+                                 lib_mli::PlatformDescription& pd,
+                                 lib_mli::ExecutionInterface& rt_kernel, int num_tiles);
+
+    static int GetSize(lib_mli::ExecutionInterface& rt_kernel);
+};
+
+} // namespace snps_arc::metaware::mli::ref
+
+#endif // _MLI_REF_PERF_ESTIM_HPP_
@@ -21,6 +21,15 @@ namespace snps_arc::metaware::mli::ref {
 // the layout of tensor
 using Layout = mli_layout_type;
 
+// The layout of feature map is defined by memory strides: the width is the inner-most
+// dimension of LAYOUT_CHW. Single channel maps are the same for both layouts.
+template <typename tensor_T>
+inline Layout GetFeatureMapLayout(const tensor_T &fmap, unsigned width_dim, unsigned channel_dim) {
+    const bool is_chw = fmap.get_dim(channel_dim) > 1 && fmap.get_mem_stride(channel_dim) != 1 &&
+                        fmap.get_mem_stride(width_dim) == 1;
+    return is_chw ? LAYOUT_CHW : LAYOUT_HWC;
+}
+
 class Conv2DPrivateData : public PrivateData {
 public:
     Conv2DPrivateData() : PrivateData(kConv2dId, sizeof(Conv2DPrivateData)) {}
@@ -37,6 +46,12 @@ public:
     // Encoded input zero point
     OffsetBuffer inpzp_buffer;
 
+    // Scratch buffer for the expanded weights tile (Compressed and Sparse modes)
+    OffsetBuffer decoded_weights_buffer;
+
+    // Encoded rescale parameters and LUT of the fused epilogue (if enabled in config)
+    OffsetBuffer epilogue_params_buffer;
+
     // the index of quantization axis
     int inp_quant_axis;
     int wts_quant_axis;
@@ -52,8 +67,12 @@ struct Conv2dMetadata {
     TensorIterator<OffsetBuffer, kConvIORank, kConvIOIterRank> output;
 
     InternalBuffer inpzp_buffer;
+    InternalBuffer encoded_weights_buffer;
+    InternalBuffer decoded_weights_buffer;
+    InternalBuffer epilogue_params_buffer;
     int inp_quant_axis;
     int wts_quant_axis;
+    Layout layout;
 
     Conv2DConfig cfg;
 };
@@ -76,6 +95,9 @@ public:
     // Encoded input zero pointers
     OffsetBuffer inpzp_buffer;
 
+    // Scratch buffer for the expanded weights tile (Compressed and Sparse modes)
+    OffsetBuffer decoded_weights_buffer;
+
     // the index of quantization axis
     int inp_quant_axis;
     int wts_quant_axis;
@@ -91,8 +113,11 @@ struct DepthwiseConv2dMetadata {
     TensorIterator<OffsetBuffer, kDepthwiseIORank, kDepthwiseIterRank> output;
 
     InternalBuffer inpzp_buffer;
+    InternalBuffer encoded_weights_buffer;
+    InternalBuffer decoded_weights_buffer;
     int inp_quant_axis;
     int wts_quant_axis;
+    Layout layout;
 
     DwConv2DConfig config;
 };
@@ -113,6 +138,9 @@ public:
     // Encoded input zero point
     OffsetBuffer inpzp_buffer;
 
+    // Scratch buffer for the expanded weights tile (Compressed and Sparse modes)
+    OffsetBuffer decoded_weights_buffer;
+
     // the index of quantization axis
     int inp_quant_axis;
     int wts_quant_axis;
@@ -128,6 +156,8 @@ struct TransposeConv2DMetadata {
     TensorIterator<OffsetBuffer, kTransposeConvIORank, kTransposeConvIOIterRank> output;
 
     InternalBuffer inpzp_buffer;
+    InternalBuffer encoded_weights_buffer;
+    InternalBuffer decoded_weights_buffer;
     int inp_quant_axis;
     int wts_quant_axis;
 
@@ -168,12 +198,20 @@ public:
     uint8_t stride_ic;
 
     int32_t qt_wtszp_axis;
+
+    // Weights compression mode and scratch buffer for the expanded weights
+    compression_mode_t weights_mode;
+    OffsetBuffer decoded_weights_buffer;
 };
 
 struct FullyConnectedMetadata {
     mli_tensor input;
     mli_tensor weights;
     mli_tensor output;
+
+    compression_mode_t weights_mode;
+    InternalBuffer encoded_weights_buffer;
+    InternalBuffer decoded_weights_buffer;
 };
 
 class MovePrivateData : public PrivateData {
@@ -193,6 +231,10 @@ public:
 
     TensorIterator<OffsetBuffer, kPoolRank, kPoolIterRank> input;
     TensorIterator<OffsetBuffer, kPoolRank, kPoolIterRank> output;
+
+    // The layout of input
+    Layout layout;
+
     PoolOpConfig config;
 };
 
@@ -211,6 +253,22 @@ public:
     
 };
 
+class EltwiseChainPrivateData : public PrivateData {
+
+public:
+    EltwiseChainPrivateData()
+        : PrivateData(kEltwiseChainId, sizeof(EltwiseChainPrivateData)) {}
+
+    TensorIterator<OffsetBuffer, kEltwiseRank, kEltwiseIterRank> m_in_left_buffer;
+    TensorIterator<OffsetBuffer, kEltwiseRank, kEltwiseIterRank> m_in_right_buffer;
+    TensorIterator<OffsetBuffer, kEltwiseRank, kEltwiseIterRank> m_output_buffer;
+    OffsetBuffer encoded_params;
+
+    EltwiseChainConfig config;
+    uint32_t param_offsets[kEltwiseChainMaxSteps];  // offset of the parameters of each step in encoded_params
+    uint32_t channels;                              // number of per channel parameters of a step
+};
+
 class RescalePrivateData : public PrivateData {
 
 public:
@@ -255,10 +313,13 @@ public:
 class TableBuiltinPrivateData : public PrivateData {
 public:
     TableBuiltinPrivateData() : PrivateData(kTableBuiltinId, sizeof(TableBuiltinPrivateData)) {}
+    // axis of the input bias: innermost dimension for per-slice bias, -1 for per-tensor bias
     int32_t table_axis;
     uint32_t io_rank;
+    LutType lut_mode;
 
     TensorIterator<OffsetBuffer, kTableBuiltinIORank, kTableBuiltinIOIterRank> input;
+    TensorIterator<OffsetBuffer, kBiasRank, kBiasIterRank> in_bias;
     TensorIterator<OffsetBuffer, kTableBuiltinIORank, kTableBuiltinIOIterRank> output;
 };
 
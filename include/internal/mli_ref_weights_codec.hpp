@@ -0,0 +1,284 @@
+/*
+* Copyright 2022, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+#ifndef _MLI_REF_WEIGHTS_CODEC_HPP_
+#define _MLI_REF_WEIGHTS_CODEC_HPP_
+
+#include <cstring>
+
+#include "mli_debug.h"
+#include "mli_types.h"
+#include "mli_types.hpp"
+#include "mli_iterator.hpp"
+
+namespace snps_arc::metaware::mli::ref {
+
+/**
+ * Compressed weights format of the reference kernels
+ *
+ * In Compressed and Sparse modes the encoded weights buffer has the following layout:
+ *
+ *   WeightsCodecHeader | WeightsCodecTile[num_tiles] | tile streams | weights zero points
+ *
+ * Each distinct weights tile of the kernel iterator is encoded separately, so the run-time
+ * object can expand only the tile it needs inside Issue(). A tile is identified by its origin,
+ * the offset (in elements) of its first element inside the full weights tensor. Decoded
+ * tiles are dense: elements go in row-major order of the tile dimensions.
+ *
+ * Sparse (block-sparse bitmap) stream:
+ *   one bit per block of kWeightsSparseBlockSize elements (LSB first), followed by the
+ *   elements of all blocks with a set bit. Blocks with all-zero elements are not stored.
+ *
+ * Compressed (zero run-length) stream:
+ *   sequence of tokens. Token byte t < 0x80 is followed by (t + 1) literal bytes,
+ *   token byte t >= 0x80 stands for ((t & 0x7F) + 1) zero elements.
+ */
+constexpr uint32_t kWeightsSparseBlockSize = 4;
+constexpr uint32_t kWeightsRleMaxRun = 128;
+constexpr uint8_t kWeightsRleZeroFlag = 0x80;
+
+struct WeightsCodecHeader {
+    uint32_t mode;
+    uint32_t num_tiles;
+    uint32_t dense_size;
+    uint32_t encoded_size;
+};
+
+struct WeightsCodecTile {
+    int32_t origin;
+    uint32_t offset;
+    uint32_t size;
+};
+
+/**
+ * @brief Worst case size of the encoded stream of num_elems int8 elements
+ */
+uint32_t GetWeightsStreamBound(compression_mode_t mode, uint32_t num_elems);
+
+/**
+ * @brief Encode num_elems elements into the stream
+ *
+ * @return size of the stream in bytes
+ */
+uint32_t EncodeWeightsStream(compression_mode_t mode, const int8_t* src, uint32_t num_elems, uint8_t* dst);
+
+/**
+ * @brief Expand the stream of src_size bytes into num_elems elements
+ */
+mli_status DecodeWeightsStream(compression_mode_t mode, const uint8_t* src, uint32_t src_size,
+                               int8_t* dst, uint32_t num_elems);
+
+/**
+ * @brief Find the tile with the given origin in the encoded buffer and expand it into dst
+ */
+mli_status DecodeWeightsTile(const int8_t* encoded, int32_t origin, int8_t* dst, uint32_t num_elems);
+
+/**
+ * @brief Position of the current tile of the iterator in the full tensor
+ */
+template <typename buf_T, uint32_t rank, uint32_t iterRank>
+void GetWeightsTilePos(const TensorIterator<buf_T, rank, iterRank>& it, uint32_t pos[rank]) {
+  for (uint32_t d = 0; d < rank; d++) pos[d] = 0;
+  for (uint32_t r = 0; r < iterRank; r++) {
+    const int32_t dim = it.get_config().get_order(r);
+    if (dim < 0) continue;
+    pos[dim] = (uint32_t)it.GetPos(r);
+  }
+}
+
+template <typename buf_T, uint32_t rank, uint32_t iterRank>
+int32_t GetWeightsTileOrigin(const TensorIterator<buf_T, rank, iterRank>& it) {
+  uint32_t pos[rank];
+  GetWeightsTilePos(it, pos);
+  int32_t origin = 0;
+  for (uint32_t d = 0; d < rank; d++) {
+    origin += (int32_t)pos[d] * it.get_tensor().get_mem_stride(d);
+  }
+  return origin;
+}
+
+/**
+ * @brief Call func(origin, pos, dims) for each distinct weights tile of the iterator
+ *
+ * Weights iterators usually repeat the same tile for several input/output tiles
+ * (zero increments), so tiles with an already visited origin are skipped.
+ */
+template <typename buf_T, uint32_t rank, uint32_t iterRank, typename Func>
+void ForEachWeightsTile(TensorIterator<buf_T, rank, iterRank> it, Func func) {
+  const TensorIterator<buf_T, rank, iterRank> first = it;
+  const uint32_t count = it.GetTotalCount();
+  for (uint32_t i = 0; i < count; i++) {
+    const int32_t origin = GetWeightsTileOrigin(it);
+    bool seen = false;
+    TensorIterator<buf_T, rank, iterRank> prev = first;
+    for (uint32_t j = 0; j < i && !seen; j++) {
+      seen = GetWeightsTileOrigin(prev) == origin;
+      prev.Next();
+    }
+    if (!seen) {
+      uint32_t pos[rank];
+      uint32_t dims[rank];
+      GetWeightsTilePos(it, pos);
+      it.GetSubTensor().get_dims(dims);
+      func(origin, pos, dims);
+    }
+    it.Next();
+  }
+}
+
+template <uint32_t rank>
+uint32_t GetWeightsTileElems(const uint32_t dims[rank]) {
+  uint32_t num_elems = 1;
+  for (uint32_t d = 0; d < rank; d++) num_elems *= dims[d];
+  return num_elems;
+}
+
+/**
+ * @brief Size of the encoded weights buffer in the worst case (without zero points)
+ */
+template <typename buf_T, uint32_t rank, uint32_t iterRank>
+uint32_t GetEncodedWeightsBound(compression_mode_t mode, const TensorIterator<buf_T, rank, iterRank>& tiling) {
+  uint32_t size = sizeof(WeightsCodecHeader);
+  ForEachWeightsTile(tiling, [&](int32_t, const uint32_t*, const uint32_t* dims) {
+    size += sizeof(WeightsCodecTile) + GetWeightsStreamBound(mode, GetWeightsTileElems<rank>(dims));
+  });
+  return size;
+}
+
+/**
+ * @brief Size of the largest decoded weights tile in bytes
+ */
+template <typename buf_T, uint32_t rank, uint32_t iterRank>
+uint32_t GetMaxDecodedWeightsTileSize(const TensorIterator<buf_T, rank, iterRank>& tiling) {
+  uint32_t size = 0;
+  ForEachWeightsTile(tiling, [&](int32_t, const uint32_t*, const uint32_t* dims) {
+    size = MAX(size, GetWeightsTileElems<rank>(dims) * (uint32_t)sizeof(int8_t));
+  });
+  return size;
+}
+
+/**
+ * @brief Encode weights tile by tile and append the weights zero points
+ *
+ * @param mode          [I] Compressed or Sparse
+ * @param tiling        [I] weights iterator of the kernel which defines the tiles
+ * @param weights       [I] full weights tensor in a platform independent layout
+ * @param weights_zp    [I] weights zero points
+ * @param encoded       [O] destination buffer
+ * @param encoded_size  [O] size of the encoded weights without zero points
+ */
+template <typename buf_T, uint32_t rank, uint32_t iterRank>
+mli_status EncodeCompressedWeightsAndZeroPts(compression_mode_t mode,
+                                             const TensorIterator<buf_T, rank, iterRank>& tiling,
+                                             const Tensor<Buffer, rank>& weights,
+                                             const Tensor<Buffer, kWZPRank>& weights_zp,
+                                             Buffer& encoded,
+                                             uint32_t& encoded_size) {
+  MLI_ASSERT(mode != compression_mode_t::Uncompressed);
+  if (weights.get_elem_size() != sizeof(int8_t) || weights_zp.get_elem_size() != sizeof(int8_t) ||
+      encoded.get_elem_size() != sizeof(int8_t)) {
+    return MLI_STATUS_NOT_SUPPORTED;
+  }
+  for (uint32_t d = 0; d < rank; d++) {
+    if (weights.get_dim(d) != tiling.get_dim(d)) return MLI_STATUS_SHAPE_MISMATCH;
+  }
+
+  const uint32_t bound = GetEncodedWeightsBound(mode, tiling);
+  const uint32_t wzp_size = weights_zp.get_buf().get_size();
+  if (bound + wzp_size > encoded.get_size()) return MLI_STATUS_NOT_ENGH_MEM;
+
+  uint8_t* dst = reinterpret_cast<uint8_t*>(encoded.get_ptr<int8_t>());
+  Buffer w_buf = weights.get_buf();
+  const int8_t* src = w_buf.get_ptr<int8_t>(weights.get_offs());
+
+  WeightsCodecHeader header;
+  header.mode = (uint32_t)mode;
+  header.num_tiles = 0;
+  header.dense_size = 0;
+  ForEachWeightsTile(tiling, [&](int32_t, const uint32_t*, const uint32_t*) { header.num_tiles++; });
+
+  // The dense copy of each tile is staged at the end of the worst case area of the stream.
+  // Encoders never write ahead of the element they read, so the stream can overlap it.
+  uint32_t stream_offset = sizeof(WeightsCodecHeader) + header.num_tiles * sizeof(WeightsCodecTile);
+  uint32_t tile_idx = 0;
+  ForEachWeightsTile(tiling, [&](int32_t origin, const uint32_t* pos, const uint32_t* dims) {
+    const uint32_t num_elems = GetWeightsTileElems<rank>(dims);
+    int8_t* dense = reinterpret_cast<int8_t*>(dst + stream_offset + GetWeightsStreamBound(mode, num_elems)) - num_elems;
+    uint32_t idx[rank] = {0};
+    for (uint32_t i = 0; i < num_elems; i++) {
+      int32_t src_offset = 0;
+      for (uint32_t d = 0; d < rank; d++) src_offset += (int32_t)(pos[d] + idx[d]) * weights.get_mem_stride(d);
+      dense[i] = src[src_offset];
+      for (int32_t d = rank - 1; d >= 0; d--) {
+        if (++idx[d] < dims[d]) break;
+        idx[d] = 0;
+      }
+    }
+
+    WeightsCodecTile tile;
+    tile.origin = origin;
+    tile.offset = stream_offset;
+    tile.size = EncodeWeightsStream(mode, dense, num_elems, dst + stream_offset);
+    std::memcpy(dst + sizeof(WeightsCodecHeader) + tile_idx * sizeof(WeightsCodecTile), &tile, sizeof(tile));
+
+    header.dense_size += num_elems;
+    stream_offset += tile.size;
+    tile_idx++;
+  });
+
+  header.encoded_size = stream_offset;
+  std::memcpy(dst, &header, sizeof(header));
+
+  Buffer wzp_buf = weights_zp.get_buf();
+  for (uint32_t i = 0; i < wzp_size; ++i) {
+    encoded.write(stream_offset + i, wzp_buf.read<int8_t>(i));
+  }
+  // Clear leftovers of the staged dense tiles behind the zero points
+  for (uint32_t i = stream_offset + wzp_size; i < encoded.get_size(); ++i) {
+    encoded.write(i, (int8_t)0);
+  }
+  encoded_size = stream_offset;
+  return MLI_STATUS_OK;
+}
+
+/**
+ * @brief Expand the current tile of the weights iterator at run-time
+ *
+ * @param weights  [I] weights iterator of the run-time object
+ * @param encoded  [I] buffer with the encoded weights
+ * @param decoded  [I] scratch buffer for the dense tile
+ * @param tile     [O] dense tile tensor on top of the decoded buffer
+ */
+template <uint32_t rank, uint32_t iterRank>
+mli_status DecodeWeightsTile(TensorIterator<OffsetBuffer, rank, iterRank>& weights,
+                             const InternalBuffer& encoded, InternalBuffer decoded,
+                             Tensor<InternalBuffer, rank>& tile) {
+  uint32_t dims[rank];
+  weights.GetSubTensor().get_dims(dims);
+  const uint32_t num_elems = GetWeightsTileElems<rank>(dims);
+  if (num_elems * sizeof(int8_t) > decoded.get_size()) return MLI_STATUS_NOT_ENGH_MEM;
+
+  int8_t* dst = decoded.get_ptr<int8_t>();
+  mli_status status = DecodeWeightsTile(encoded.get_ptr<int8_t>(), GetWeightsTileOrigin(weights), dst, num_elems);
+  if (status != MLI_STATUS_OK) return status;
+
+  tile = Tensor<InternalBuffer, rank>(InternalBuffer(dst, num_elems), dims);
+  return MLI_STATUS_OK;
+}
+
+/**
+ * @brief Compression ratio (dense size / encoded size) of the encoded weights
+ */
+inline float GetWeightsCompressionRatio(uint32_t dense_size, uint32_t encoded_size) {
+  if (encoded_size == 0) return 0.f;
+  return (float)dense_size / (float)encoded_size;
+}
+
+} // namespace snps_arc::metaware::mli::ref
+
+#endif // _MLI_REF_WEIGHTS_CODEC_HPP_
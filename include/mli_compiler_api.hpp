@@ -154,9 +154,20 @@ public:
      *
      * This function returns the size of the full weights buffer in bytes that
      * is needed by the EncodeWeights method EncodeWeights method
+     * For Compressed and Sparse modes this is the worst case size before
+     * EncodeWeightsAndZeroPts() is called and the actual size after it.
      */
     virtual unsigned GetEncodedWeightsSize() = 0;
 
+    /**
+     * @brief Method to query the compression ratio of the encoded weights
+     *
+     * Ratio of the dense weights size to the size of the encoded weights achieved by
+     * EncodeWeightsAndZeroPts() with the compression mode of the kernel configuration.
+     * It is 1 for the Uncompressed mode and 0 if the weights are not encoded yet.
+     */
+    virtual float GetWeightsCompressionRatio() const { return 1.f; }
+
     /**
      * @brief Method to encode input zero-points (padding values)
      * @deprecated
@@ -302,6 +313,56 @@ public:
                                             NOT_IMPLEMENTED_METHOD;
                                             return MLI_STATUS_OK; };
 
+    /**
+     * @brief Method to encode parameters of the fused epilogue
+     *
+     * Used only if epilogue is enabled in the kernel configuration (see ConvEpilogueConfig).
+     * This method will read per output channel rescale parameters and the optional activation
+     * look-up table in a platform independent layout and translate it into a buffer that can be
+     * easily read by the platform specific kernel implementation.
+     * Parameters are encoded for all output channels of the kernel. Runtime picks the
+     * parameters of the current tile by its output channel offset.
+     * The content of the encoded_params buffer is opaque for the user.
+     *
+     * @param in_bias        [I] tensor with the input bias (int32) per output channel
+     * @param scale          [I] tensor with the scale (int16) per output channel
+     * @param shift          [I] tensor with the shift (int8) per output channel
+     * @param out_bias       [I] tensor with the output bias (int8) per output channel
+     * @param lut            [I] tensor with 256 int8 values of activation or nullptr if use_lut is false
+     * @param encoded_params [O] buffer where the encode function writes the encoded parameters
+     *
+     * @return MLI status code
+     */
+    virtual mli_status EncodeEpilogueParams(const Tensor<Buffer, kConvEpilogueParamRank> &in_bias,
+                                            const Tensor<Buffer, kConvEpilogueParamRank> &scale,
+                                            const Tensor<Buffer, kConvEpilogueParamRank> &shift,
+                                            const Tensor<Buffer, kConvEpilogueParamRank> &out_bias,
+                                            const Tensor<Buffer, kConvEpilogueParamRank> *lut,
+                                            Buffer &encoded_params) {
+        return MLI_STATUS_NOT_SUPPORTED;
+    }
+
+    /**
+     * @brief Method to query the size of the encoded epilogue parameters buffer
+     *
+     * This function returns the size of the buffer that is needed by the EncodeEpilogueParams method.
+     * It is 0 if epilogue is disabled.
+     */
+    virtual unsigned GetEncodedEpilogueParamsSize() const { return 0; }
+
+    /**
+     * @brief Method to set memory offset and memory ID of the encoded epilogue parameters
+     *
+     * Must be called in addition to AttachBufferOffsets if epilogue is enabled.
+     *
+     * @param epilogue_params [I] OffsetBuffer containing Memory Identifier and Offset in that memory
+     *
+     * @return MLI status code
+     */
+    virtual mli_status AttachEpilogueBufferOffsets(const OffsetBuffer &epilogue_params) {
+        return MLI_STATUS_NOT_SUPPORTED;
+    }
+
 };
 
 /**
@@ -438,9 +499,20 @@ public:
     /**
      * @brief Method to query the size of the encoded weights buffer
      *
+     * For Compressed and Sparse modes this is the worst case size before
+     * EncodeWeightsAndZeroPts() is called and the actual size after it.
      */
     virtual unsigned GetEncodedWeightsSize() = 0;
 
+    /**
+     * @brief Method to query the compression ratio of the encoded weights
+     *
+     * Ratio of the dense weights size to the size of the encoded weights achieved by
+     * EncodeWeightsAndZeroPts() with the compression mode of the kernel configuration.
+     * It is 1 for the Uncompressed mode and 0 if the weights are not encoded yet.
+     */
+    virtual float GetWeightsCompressionRatio() const { return 1.f; }
+
     /**
      * @brief Method to encode input zero-points (padding values)
      * @deprecated
@@ -597,9 +669,20 @@ public:
     /**
      * @brief Method to query the size of the encoded weights buffer
      *
+     * For Compressed and Sparse modes this is the worst case size before
+     * EncodeWeightsAndZeroPts() is called and the actual size after it.
      */
     virtual unsigned GetEncodedWeightsSize() const = 0;
 
+    /**
+     * @brief Method to query the compression ratio of the encoded weights
+     *
+     * Ratio of the dense weights size to the size of the encoded weights achieved by
+     * EncodeWeightsAndZeroPts() with the compression mode of the kernel configuration.
+     * It is 1 for the Uncompressed mode and 0 if the weights are not encoded yet.
+     */
+    virtual float GetWeightsCompressionRatio() const { return 1.f; }
+
     /**
      * @brief Method to encode weights zero-points
      * @deprecated
@@ -1144,6 +1227,122 @@ public:
 
 };
 
+/**
+ * @brief This class implements the Eltwise Chain Compiler Support kernel interface
+ *
+ * The kernel applies a sequence of pointwise operations (see EltwiseChainConfig) to the left
+ * and the right inputs in a single pass over the tile, i.e. Add->Rescale->Clip of residual
+ * connections. Parameters of each step with parameters are encoded by the Encode*Params method
+ * of its operation into the same encoded_params buffer. Per channel parameters are given for all
+ * channels (innermost dimension) of the output and runtime picks the ones of the current tile.
+ */
+class EltwiseChain_CS : public CompilerGenericInterface {
+public:
+    virtual ~EltwiseChain_CS() = default;
+
+    /**
+     * @brief Method to encode parameters of a kRescale step
+     *
+     * @param step           [I] index of the step in the chain
+     * @param in_bias        [I] tensor with the input bias (int8, int16 or int32)
+     * @param out_bias       [I] tensor with the output bias (int8, int16 or int32)
+     * @param scale          [I] tensor with the scale (int16)
+     * @param shift          [I] tensor with the shift (int8)
+     * @param encoded_params [O] encoded parameters buffer of the whole chain
+     */
+    virtual mli_status EncodeRescaleParams(uint32_t step,
+                                           const Tensor<Buffer, kEltwiseChainParamRank> &in_bias,
+                                           const Tensor<Buffer, kEltwiseChainParamRank> &out_bias,
+                                           const Tensor<Buffer, kEltwiseChainParamRank> &scale,
+                                           const Tensor<Buffer, kEltwiseChainParamRank> &shift,
+                                           Buffer &encoded_params) = 0;
+
+    /**
+     * @brief Method to encode parameters of a kPrelu step
+     *
+     * Positive values (after subtraction of the input bias) are rescaled with posscale and posshift,
+     * negative ones with negscale and negshift.
+     *
+     * @param step           [I] index of the step in the chain
+     * @param in_bias        [I] tensor with the input bias (int8, int16 or int32)
+     * @param out_bias       [I] tensor with the output bias (int8, int16 or int32)
+     * @param posscale       [I] tensor with the scale of positive values (int16)
+     * @param negscale       [I] tensor with the scale of negative values (int16)
+     * @param posshift       [I] tensor with the shift of positive values (int8)
+     * @param negshift       [I] tensor with the shift of negative values (int8)
+     * @param encoded_params [O] encoded parameters buffer of the whole chain
+     */
+    virtual mli_status EncodePreluParams(uint32_t step,
+                                         const Tensor<Buffer, kEltwiseChainParamRank> &in_bias,
+                                         const Tensor<Buffer, kEltwiseChainParamRank> &out_bias,
+                                         const Tensor<Buffer, kEltwiseChainParamRank> &posscale,
+                                         const Tensor<Buffer, kEltwiseChainParamRank> &negscale,
+                                         const Tensor<Buffer, kEltwiseChainParamRank> &posshift,
+                                         const Tensor<Buffer, kEltwiseChainParamRank> &negshift,
+                                         Buffer &encoded_params) = 0;
+
+    /**
+     * @brief Method to encode parameters of a kClip step
+     *
+     * @param step           [I] index of the step in the chain
+     * @param min_val        [I] tensor with a single lower bound (int8, int16 or int32)
+     * @param max_val        [I] tensor with a single upper bound (int8, int16 or int32)
+     * @param encoded_params [O] encoded parameters buffer of the whole chain
+     */
+    virtual mli_status EncodeClipParams(uint32_t step,
+                                        const Tensor<Buffer, kEltwiseChainParamRank> &min_val,
+                                        const Tensor<Buffer, kEltwiseChainParamRank> &max_val,
+                                        Buffer &encoded_params) = 0;
+
+    /**
+     * @brief Method to encode parameters of a kLut step
+     *
+     * @param step           [I] index of the step in the chain
+     * @param lut            [I] tensor with kEltwiseChainLutSize int8 values
+     * @param encoded_params [O] encoded parameters buffer of the whole chain
+     */
+    virtual mli_status EncodeLutParams(uint32_t step,
+                                       const Tensor<Buffer, kEltwiseChainParamRank> &lut,
+                                       Buffer &encoded_params) = 0;
+
+    /**
+     * @brief Method to query the size of the encoded parameters buffer
+     *
+     * This function returns the size of the buffer that is needed by the Encode*Params methods.
+     * It is 0 if no step of the chain has parameters.
+     */
+    virtual unsigned GetEncodedParamsSize() const = 0;
+
+    /**
+     * @brief Methods to get buffer sizes
+     */
+    virtual unsigned GetInputLeftBufferSize() = 0;
+    virtual unsigned GetInputRightBufferSize() = 0;
+    virtual unsigned GetOutputBufferSize() = 0;
+
+    /**
+     * @brief Method to set buffer memory offsets and memory IDs for the kernel
+     *
+     * Compiler computes a memory map and buffer offsets are set using this method.
+     * Compiler also needs to indicate in which memory the buffers reside.
+     * These ID's need to match the array of memory bases that the xop-interpreter passes to
+     * the Create function.
+     *
+     * @param input_left     [I] OffsetBuffer containing Memory Identifier and Offset in that memory
+     * @param input_right    [I] OffsetBuffer containing Memory Identifier and Offset in that memory
+     * @param output         [I] OffsetBuffer containing Memory Identifier and Offset in that memory
+     * @param encoded_params [I] OffsetBuffer containing Memory Identifier and Offset in that memory
+     * @param ctrl_buffer    [I] OffsetBuffer containing Memory Identifier and Offset in that memory
+     *
+     * @return MLI status code
+     */
+    virtual mli_status AttachBufferOffsets(const OffsetBuffer &input_left,
+                                           const OffsetBuffer &input_right,
+                                           const OffsetBuffer &output,
+                                           const OffsetBuffer &encoded_params,
+                                           const OffsetBuffer &ctrl_buffer) = 0;
+};
+
 /**
  * @brief This class implements the Table BuiltIn Compiler Support kernel interface
  *
@@ -1348,11 +1547,22 @@ public:
       *
       * This function returns the size of the full weights buffer that
       * is needed by the EncodeWeights method.
+      * For Compressed and Sparse modes this is the worst case size before
+      * EncodeWeightsAndZeroPts() is called and the actual size after it.
       *
       * @return Size of encoded weights buffer in bytes
       */
      virtual unsigned GetEncodedWeightsSize() const = 0;
 
+    /**
+     * @brief Method to query the compression ratio of the encoded weights
+     *
+     * Ratio of the dense weights size to the size of the encoded weights achieved by
+     * EncodeWeightsAndZeroPts() with the compression mode of the kernel configuration.
+     * It is 1 for the Uncompressed mode and 0 if the weights are not encoded yet.
+     */
+    virtual float GetWeightsCompressionRatio() const { return 1.f; }
+
     /**
      * @brief Method to encode input zero-points (padding values)
      * @deprecated
@@ -1494,6 +1704,11 @@ public:
 /**
  * @brief This class implements the Matrix Multiply Compiler Support kernel interface
  *
+ * Output [B, M, N] is the product of the left [B, M, K] and the right [B, K, N] inputs
+ * for each batch. The right input with a single batch is used for all batches.
+ * Inputs are int8 or int16 with zero points of the same type and the output is int32.
+ * Any memory strides of inputs are supported, so the transposed right input (i.e. K^T
+ * of attention) is a view of the original data with swapped strides.
  */
 class MatMul_CS : public CompilerGenericInterface {
 public:
@@ -1502,6 +1717,9 @@ public:
     /**
      * @brief Method to encode parameters (coefficients)
      *
+     * @param in_bias1       [I] zero point of the left input
+     * @param in_bias2       [I] zero point of the right input
+     * @param encoded_params [O] encoded zero points with the element size of inputs
      */
     virtual mli_status EncodeParams(const Buffer &in_bias1, 
                                     const Buffer &in_bias2,
@@ -1509,7 +1727,8 @@ public:
     /**
      * @brief Method to query the size of the encoded parameters buffer
      *
-     * This function returns the size of the buffer that is needed by the EncodeParams method
+     * This function returns the size in bytes of the buffer that is needed by the EncodeParams
+     * method for the element size of inputs given at construction.
      */
     virtual unsigned GetEncodedParamsSize() const = 0;
 
@@ -0,0 +1,226 @@
+/*
+* Copyright 2022, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+#ifndef _MLI_GRAPH_EXECUTOR_HPP_
+#define _MLI_GRAPH_EXECUTOR_HPP_
+
+#include "mli_platform_desc.hpp"
+#include "mli_profiler.hpp"
+#include "mli_runtime_api.hpp"
+#include "mli_types.h"
+#include "mli_types.hpp"
+
+namespace snps_arc::metaware::mli {
+
+/**
+ * @brief Buffer (tensor) description used by the graph memory planner
+ *
+ * Live range is given in layer indexes in execution order, both ends are inclusive.
+ * The offset field is the result of the planning.
+ */
+struct GraphBuffer {
+    uint32_t size;
+    int32_t first_layer;
+    int32_t last_layer;
+    uint32_t offset;
+};
+
+/**
+ * @brief Liveness based memory planner for a graph of MLI 3.0 kernels
+ *
+ * The planner places all buffers of a graph into a single scratch memory region (arena).
+ * Buffers whose live ranges do not intersect may share the same memory, so the peak
+ * arena size is typically much smaller than the sum of all buffer sizes.
+ *
+ * Buffer sizes are expected to be taken from the compiler side of the kernels
+ * (GetInputBufferSize(), GetOutputBufferSize() and similar methods) and the resulting
+ * offsets are passed to AttachBufferOffsets() of these kernels. The memory for
+ * GraphBuffer descriptors is provided by the user.
+ */
+class GraphMemoryPlanner {
+  public:
+    /**
+     * @brief Constructor of the planner
+     *
+     * @param buffers     [I] array for buffer descriptors
+     * @param max_buffers [I] number of elements in the buffers array
+     * @param alignment   [I] alignment of each planned buffer offset in bytes
+     */
+    GraphMemoryPlanner(GraphBuffer* buffers, uint32_t max_buffers, uint32_t alignment = kMliAlignment);
+
+    /**
+     * @brief Method to register a buffer of the graph
+     *
+     * @param size [I] size of the buffer in bytes
+     *
+     * @return buffer identifier or -1 if there is no space for the descriptor
+     */
+    int32_t AddBuffer(uint32_t size);
+
+    /**
+     * @brief Method to register an access of a layer to a buffer (as input or output)
+     *
+     * Live range of the buffer is extended to cover the layer.
+     *
+     * @param buffer_id [I] identifier returned by AddBuffer()
+     * @param layer_idx [I] index of the layer in execution order
+     */
+    mli_status MarkUse(int32_t buffer_id, int32_t layer_idx);
+
+    /**
+     * @brief Method to mark a buffer as input of the whole graph
+     *
+     * Graph inputs are filled before the first layer, so they are alive from the start
+     * of the graph till their last consumer.
+     */
+    mli_status MarkGraphInput(int32_t buffer_id) { return MarkUse(buffer_id, 0); }
+
+    /**
+     * @brief Method to mark a buffer as output of the whole graph
+     *
+     * Graph outputs are read after the last layer, so they are alive till the end of the graph.
+     */
+    mli_status MarkGraphOutput(int32_t buffer_id) { return MarkUse(buffer_id, kGraphEndLayer); }
+
+    /**
+     * @brief Method to compute offsets of all registered buffers
+     *
+     * Buffers are placed from the largest to the smallest one, each at the lowest
+     * offset which doesn't collide with already placed buffers alive at the same time.
+     * Buffers which are never used by any layer are not allocated.
+     */
+    mli_status Plan();
+
+    /**
+     * @brief Method to get the offset of a buffer inside the arena. Valid after Plan().
+     */
+    uint32_t GetOffset(int32_t buffer_id) const;
+
+    /**
+     * @brief Method to get the arena size (peak scratch memory). Valid after Plan().
+     */
+    uint32_t GetArenaSize() const { return m_arena_size; }
+
+    /**
+     * @brief Method to get the arena size without buffer overlapping (sum of aligned buffer sizes)
+     */
+    uint32_t GetNonOverlappedSize() const;
+
+    static constexpr uint32_t kUnplannedOffset = 0xFFFFFFFF;
+    static constexpr int32_t kGraphEndLayer = 0x7FFFFFFF;
+
+  private:
+    bool IsLive(uint32_t idx) const { return m_buffers[idx].first_layer >= 0; }
+    bool IsLiveTogether(uint32_t a, uint32_t b) const;
+    uint32_t AlignedSize(uint32_t idx) const;
+
+    GraphBuffer* m_buffers;
+    uint32_t m_max_buffers;
+    uint32_t m_num_buffers;
+    uint32_t m_alignment;
+    uint32_t m_arena_size;
+};
+
+/**
+ * @brief Description of one layer (kernel) of the graph for the GraphExecutor
+ *
+ * private_data points to the kernel private data computed at compile time by
+ * GetKernelPrivateData(). runtime_obj_size is the value of GetRuntimeObjectSize() and
+ * num_tiles is the total number of tiles of the kernel iterators.
+ */
+struct GraphLayer {
+    void* private_data;
+    uint32_t private_data_size;
+    uint32_t runtime_obj_size;
+    uint32_t num_tiles;
+};
+
+/**
+ * @brief Executor of a whole graph of MLI 3.0 kernels
+ *
+ * Layers are executed one after another in the order of the layers array. For each
+ * layer the run-time object is created by ExecutionInterface::Create() and then
+ * Prefetch(), Issue() and Update() are called for all its tiles. Run-time objects of
+ * all layers share the same memory buffer, so it has to be only as large as the
+ * largest object (see GetRuntimeBufferSize()).
+ *
+ * All buffer offsets inside private data are relative to the membases passed to the
+ * constructor, e.g. to the arena computed by GraphMemoryPlanner.
+ *
+ * Profiling is turned on by SetProfiler(). Then each run-time object is wrapped by
+ * ProfiledKernel and a kLayer record is added for each layer in addition to the records
+ * of its calls.
+ */
+class GraphExecutor {
+  public:
+    /**
+     * @brief Constructor of the graph executor
+     *
+     * @param layers            [I] array of layer descriptions in execution order
+     * @param num_layers        [I] number of layers
+     * @param runtime_buffer    [I] memory for run-time objects (kMliAlignment aligned)
+     * @param runtime_buf_size  [I] size of the above memory buffer
+     * @param membases[]        [I] start of each memory region (see ExecutionInterface::Create)
+     * @param num_mems          [I] number of elements in the membases array
+     */
+    GraphExecutor(const GraphLayer* layers, uint32_t num_layers,
+                  void* runtime_buffer, uint32_t runtime_buf_size,
+                  uint64_t* membases, int num_mems);
+
+    /**
+     * @brief Method to get the size of the memory required for run-time objects
+     */
+    static uint32_t GetRuntimeBufferSize(const GraphLayer* layers, uint32_t num_layers);
+
+    /**
+     * @brief Method to execute all tiles of a single layer
+     *
+     * @param layer_idx [I] index of the layer in the layers array
+     */
+    mli_status RunLayer(uint32_t layer_idx);
+
+    /**
+     * @brief Method to execute all tiles of all layers of the graph
+     *
+     * Execution stops on the first layer that doesn't return MLI_STATUS_OK.
+     */
+    mli_status Run();
+
+    /**
+     * @brief Method to record calls of all layers into the profiler
+     *
+     * Bytes and MACs are recorded only if the platform description and the memory for
+     * the PerfEstimator of the running layer are provided. The memory has to be as large
+     * as the largest PerfEstimator::KernelPerf_GetSize() of the layers.
+     *
+     * @param profiler           [I] profiler for records, nullptr turns profiling off
+     * @param pd                 [I] platform description for the PerfEstimator, can be nullptr
+     * @param estimator_buffer   [I] memory for the PerfEstimator, can be nullptr
+     * @param estimator_buf_size [I] size of the above memory buffer
+     */
+    void SetProfiler(Profiler* profiler, PlatformDescription* pd = nullptr,
+                     void* estimator_buffer = nullptr, uint32_t estimator_buf_size = 0);
+
+  private:
+    mli_status RunProfiledLayer(uint32_t layer_idx, ExecutionInterface* op);
+
+    const GraphLayer* m_layers;
+    uint32_t m_num_layers;
+    void* m_runtime_buffer;
+    uint32_t m_runtime_buf_size;
+    uint64_t* m_membases;
+    int m_num_mems;
+    Profiler* m_profiler;
+    PlatformDescription* m_pd;
+    void* m_estimator_buffer;
+    uint32_t m_estimator_buf_size;
+};
+
+} // namespace snps_arc::metaware::mli
+
+#endif // _MLI_GRAPH_EXECUTOR_HPP_
@@ -51,6 +51,8 @@ public:
 
     virtual uint32_t Min_CS_GetSize() const { return 0; }
 
+    virtual uint32_t EltwiseChain_CS_GetSize() const { return 0; }
+
     virtual uint32_t ReduceMax_CS_GetSize() const { return 0; }
     
     virtual uint32_t TableBuiltin_CS_GetSize() const { return 0; }
@@ -1120,6 +1122,28 @@ public:
       set_default_align<kEltwiseRank>(output_align);
     }
 
+    /**
+     * @brief EltwiseChain kernel Compiler Support interface factory
+     * method
+     *
+     * @param kernel_buffer [I] Pointer to the pre-allocated memory to store
+     *                          kernel Compiler Support object
+     * @param input_left    [I] TensorIterator object containing input1 Tensor and
+     *                          tile configuration parameters
+     * @param input_right   [I] TensorIterator object containing input2 Tensor and
+     *                          tile configuration parameters
+     * @param cfg           [I] Steps of the chain (see EltwiseChainConfig)
+     * @param output        [I] TensorIterator object containing output Tensor and
+     *                          tile configuration parameters
+     *
+     * @return EltwiseChain kernel Compiler Support interface object
+     */
+    virtual lib_mli::EltwiseChain_CS* EltwiseChain_CS(void *kernel_buffer,
+                                                      const TensorIterator<NoBuffer, kEltwiseRank, kEltwiseIterRank> &input_left,
+                                                      const TensorIterator<NoBuffer, kEltwiseRank, kEltwiseIterRank> &input_right,
+                                                      const EltwiseChainConfig &cfg,
+                                                      const TensorIterator<NoBuffer, kEltwiseRank, kEltwiseIterRank> &output) { return nullptr; }
+
     /**
      * @brief Rescale kernel Compiler Support interface factory
      * method
@@ -1329,7 +1353,8 @@ public:
     virtual lib_mli::MatMul_CS* MatMul_CS(void *kernel_buffer,
                                           const TensorIterator<NoBuffer, kMatMulRank, kMatMulIterRank> &input_left,
                                           const TensorIterator<NoBuffer, kMatMulRank, kMatMulIterRank> &input_right,
-                                          const TensorIterator<NoBuffer, kMatMulRank, kMatMulIterRank> &output) { return nullptr; }
+                                          const TensorIterator<NoBuffer, kMatMulRank, kMatMulIterRank> &output,
+                                          uint32_t io_elem_size = sizeof(int8_t)) { return nullptr; }
 
     /**
      * @brief MatMul kernel Compiler Support interface
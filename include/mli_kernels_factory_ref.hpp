@@ -291,6 +291,21 @@ public:
         return new(kernel_buffer) lib_ref::Min_CS(m_pd, in_left, in_right, output);
     }
 
+    uint32_t EltwiseChain_CS_GetSize() const override { return sizeof(lib_ref::EltwiseChain_CS); }
+
+    lib_mli::EltwiseChain_CS* EltwiseChain_CS(void *kernel_buffer,
+                                              const TensorIterator<NoBuffer, kEltwiseRank, kEltwiseIterRank> &in_left,
+                                              const TensorIterator<NoBuffer, kEltwiseRank, kEltwiseIterRank> &in_right,
+                                              const EltwiseChainConfig &cfg,
+                                              const TensorIterator<NoBuffer, kEltwiseRank, kEltwiseIterRank> &output) override {
+        /**
+         * The MLI classes need to be 32 bit aligned
+         */
+        assert(kernel_buffer != nullptr);
+        assert(((size_t) kernel_buffer % kMliAlignment) == 0);
+        return new(kernel_buffer) lib_ref::EltwiseChain_CS(m_pd, in_left, in_right, cfg, output);
+    }
+
     uint32_t MaxPool2D_CS_GetSize() const override { return sizeof(lib_ref::MaxPool2D_CS); }
 
     /**
@@ -445,7 +460,7 @@ public:
         return new(kernel_buffer) lib_ref::FullyConnected_CS(m_pd, input, weights, weights_zp, cfg, output);
     }
 
-    uint32_t TableBuiltin_CS_GetSize() const override { return 0;/*return sizeof(lib_ref::TableBuiltin_CS);*/ }
+    uint32_t TableBuiltin_CS_GetSize() const override { return sizeof(lib_ref::TableBuiltin_CS); }
 
     lib_mli::TableBuiltin_CS* TableBuiltin_CS(void *kernel_buffer,
                                               const TensorIterator<NoBuffer, kTableBuiltinIORank, kTableBuiltinIOIterRank> &in,
@@ -456,8 +471,7 @@ public:
          */
         assert(kernel_buffer != nullptr);
         assert(((size_t) kernel_buffer % kMliAlignment) == 0);   
-        return nullptr;
-        /*return new(kernel_buffer) lib_ref::TableBuiltin_CS(m_pd, input_shape, cfg,   );*/
+        return new(kernel_buffer) lib_ref::TableBuiltin_CS(m_pd, in, cfg, out);
     }
 
     uint32_t Rescale_CS_GetSize() const override { return sizeof(lib_ref::Rescale_CS); }
@@ -527,7 +541,7 @@ public:
         return new(kernel_buffer) lib_ref::Clip_CS(m_pd, input, output);
     }
     
-    uint32_t ArgMax_CS_GetSize() const override { return 0; /*sizeof(lib_ref::ArgMax_CS);*/ }
+    uint32_t ArgMax_CS_GetSize() const override { return sizeof(lib_ref::ArgMax_CS); }
 
     lib_mli::ArgMax_CS* ArgMax_CS(void *kernel_buffer,
                                   const TensorIterator<NoBuffer, kArgMaxInRank, kArgMaxInIterRank> in,
@@ -538,7 +552,7 @@ public:
          */
         assert(kernel_buffer != nullptr);
         assert(((size_t) kernel_buffer % kMliAlignment) == 0);   
-        return nullptr;/*new(kernel_buffer) lib_ref::ArgMax_CS(m_pd, input_shape, cfg, output_tile_shape);*/
+        return new(kernel_buffer) lib_ref::ArgMax_CS(m_pd, in, cfg, out);
     }
 
     uint32_t TransposeConv2D_CS_GetSize() const override { return sizeof(lib_ref::TransposeConv2D_CS); }
@@ -590,13 +604,14 @@ public:
     lib_mli::MatMul_CS* MatMul_CS(void *kernel_buffer,
                             const TensorIterator<NoBuffer, kMatMulRank, kMatMulIterRank> &in_left,
                             const TensorIterator<NoBuffer, kMatMulRank, kMatMulIterRank> &in_right,
-                            const TensorIterator<NoBuffer, kMatMulRank, kMatMulIterRank> &output) override {
+                            const TensorIterator<NoBuffer, kMatMulRank, kMatMulIterRank> &output,
+                            uint32_t io_elem_size = sizeof(int8_t)) override {
         /**
          * The MLI classes need to be 32 bit aligned
          */
         assert(kernel_buffer != nullptr);
         assert(((size_t) kernel_buffer % kMliAlignment) == 0);  
-        return new(kernel_buffer) lib_ref::MatMul_CS(m_pd, in_left, in_right, output);
+        return new(kernel_buffer) lib_ref::MatMul_CS(m_pd, in_left, in_right, output, io_elem_size);
        
     }
 
@@ -615,7 +630,7 @@ public:
     }
 
 
-    uint32_t ResizeBilinear_CS_GetSize() const override { return 0 /*sizeof(lib_ref::ResizeBilinear_CS) */; }
+    uint32_t ResizeBilinear_CS_GetSize() const override { return sizeof(lib_ref::ResizeBilinear_CS); }
 
     lib_mli::ResizeBilinear_CS* ResizeBilinear_CS(void *kernel_buffer,
                                                   const TensorIterator<NoBuffer, kResizeBilinearRank, kResizeBilinearIterRank> &in,
@@ -626,8 +641,7 @@ public:
          */
         assert(kernel_buffer != nullptr);
         assert(((size_t) kernel_buffer % kMliAlignment) == 0);   
-        /* return new(kernel_buffer) lib_ref::ResizeBilinear_CS(m_pd, in, cfg, out); */
-        return nullptr;
+        return new(kernel_buffer) lib_ref::ResizeBilinear_CS(m_pd, in, cfg, out);
     }
 
 private:
@@ -8,6 +8,9 @@ namespace snps_arc::metaware::mli {
 
 class PlatformDescription {	
 public:
+    // Maximum number of memories (see OffsetBuffer mem_idx) described by the platform
+    static constexpr uint32_t kMaxMemories = 4;
+
     enum AguConfig
     {
         kAguConfigSmall,
@@ -29,7 +32,9 @@ public:
     , m_mac_issue_slots (1)
     , m_rounding_mode(kRoundingModeConvergent)
     , m_processor_id (0)
+    , m_num_processors (1)
     , m_agu_config(kAguConfigNoAgu)
+    , m_memory_size{}
     {}
 	
 	
@@ -44,9 +49,16 @@ public:
 	
     uint32_t GetProcessorId() const { return m_processor_id; }
 	
+    uint32_t GetNumProcessors() const { return m_num_processors; }
+	
     RoundingMode GetRoundingMode() const { return m_rounding_mode; }
 	
     AguConfig GetAguConfig() const { return m_agu_config; }
+
+    uint32_t GetMemorySize(uint32_t mem_idx) const {
+        MLI_ASSERT(mem_idx < kMaxMemories);
+        return m_memory_size[mem_idx];
+    }
 	
 	
 	
@@ -87,12 +99,25 @@ public:
     void SetProcessorId(uint32_t processor_id){ m_processor_id = processor_id; }
 	
 	
+    void SetNumProcessors(uint32_t num_processors){
+        MLI_ASSERT(num_processors > 0);
+        m_num_processors = num_processors;
+    }
+	
+	
     void SetRoundingMode(RoundingMode rounding_mode){
         MLI_ASSERT(rounding_mode == kRoundingModeConvergent || rounding_mode == kRoundingModeUp);
         m_rounding_mode = rounding_mode;
     }
 	
 	
+    // Size in bytes of the memory which can be used for tile buffers (budget of the Tiler)
+    void SetMemorySize(uint32_t mem_idx, uint32_t size){
+        MLI_ASSERT(mem_idx < kMaxMemories);
+        m_memory_size[mem_idx] = size;
+    }
+
+
     void SetAguConfig(AguConfig agu_config){
         MLI_ASSERT(agu_config == kAguConfigSmall || agu_config == kAguConfigMedium || agu_config == kAguConfigLarge || agu_config == kAguConfigNoAgu);
         m_agu_config = agu_config;
@@ -106,7 +131,9 @@ private:
     uint32_t m_mac_issue_slots;
     RoundingMode m_rounding_mode;
     uint32_t m_processor_id;
+    uint32_t m_num_processors;
     AguConfig m_agu_config;
+    uint32_t m_memory_size[kMaxMemories];
 };
 }
 
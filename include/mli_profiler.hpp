@@ -0,0 +1,186 @@
+/*
+* Copyright 2022, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+#ifndef _MLI_PROFILER_HPP_
+#define _MLI_PROFILER_HPP_
+
+#include "mli_perf_estim.hpp"
+#include "mli_runtime_api.hpp"
+#include "mli_types.h"
+#include "mli_types.hpp"
+
+namespace snps_arc::metaware::mli {
+
+/**
+ * @brief Profiled call of a MLI 3.0 run-time object
+ *
+ * kLayer records cover all calls of a layer executed by the GraphExecutor.
+ */
+enum class ProfileCall : uint8_t {
+    kPrefetch = 0,
+    kIssue,
+    kUpdate,
+    kLayer
+};
+
+/**
+ * @brief Single record of the Profiler
+ *
+ * Timestamps are values of the ProfilerClock. Bytes and MACs are taken from the
+ * PerfEstimator of the kernel for kIssue and kLayer records, they are zero otherwise
+ * or if no estimator was provided.
+ */
+struct ProfileRecord {
+    uint64_t start;
+    uint64_t end;
+    kernel_id_t kernel_id;
+    uint32_t layer;
+    uint32_t tile;
+    uint32_t read_bytes;
+    uint32_t write_bytes;
+    uint32_t macs;
+    ProfileCall call;
+    mli_status status;
+};
+
+/**
+ * @brief Timer used by the Profiler, i.e. cycle counter of the core or a host clock
+ */
+typedef uint64_t (*ProfilerClock)();
+
+/**
+ * @brief Fixed size ring buffer of profile records
+ *
+ * The memory for records is provided by the user. When the buffer is full, the oldest
+ * records are overwritten, so the buffer always keeps the latest calls. Without a clock
+ * each timestamp is the index of the time request, which keeps the order of events but
+ * doesn't measure time.
+ */
+class Profiler {
+  public:
+    /**
+     * @brief Constructor of the profiler
+     *
+     * @param records     [I] array for profile records
+     * @param max_records [I] number of elements in the records array
+     * @param clock       [I] timer of the platform, can be nullptr
+     */
+    Profiler(ProfileRecord* records, uint32_t max_records, ProfilerClock clock = nullptr);
+
+    /**
+     * @brief Method to get the current time of the profiler clock
+     */
+    uint64_t GetTime();
+
+    /**
+     * @brief Method to add a record, the oldest one is overwritten if the buffer is full
+     */
+    void Record(const ProfileRecord& record);
+
+    /**
+     * @brief Method to remove all records
+     */
+    void Reset();
+
+    /**
+     * @brief Method to get the number of records kept in the buffer
+     */
+    uint32_t GetNumRecords() const { return m_num_records; }
+
+    /**
+     * @brief Method to get the number of records overwritten since the last Reset()
+     */
+    uint32_t GetNumDropped() const { return m_num_dropped; }
+
+    /**
+     * @brief Method to get a record kept in the buffer
+     *
+     * @param idx [I] index of the record from the oldest one (0) to the newest one
+     */
+    const ProfileRecord& GetRecord(uint32_t idx) const;
+
+    /**
+     * @brief Method to export records in the Chrome trace event format (JSON)
+     *
+     * Each record is exported as a complete event ("ph": "X") with the kernel name and
+     * the call as the event name and other fields of the record as arguments. Layers are
+     * exported as separate threads. The output is truncated if the buffer is too small,
+     * but it is always terminated by zero.
+     *
+     * @param buffer       [O] output text buffer, can be nullptr if size is 0
+     * @param size         [I] size of the output buffer in bytes
+     * @param ticks_per_us [I] number of clock ticks in a microsecond (timestamp units of the trace)
+     *
+     * @return length of the whole trace text without the terminating zero
+     */
+    uint32_t ExportChromeTrace(char* buffer, uint32_t size, uint32_t ticks_per_us = 1) const;
+
+    /**
+     * @brief Method to get the name of a kernel used in the trace
+     */
+    static const char* GetKernelName(kernel_id_t kernel_id);
+
+  private:
+    ProfileRecord* m_records;
+    uint32_t m_max_records;
+    ProfilerClock m_clock;
+    uint32_t m_first;
+    uint32_t m_num_records;
+    uint32_t m_num_dropped;
+    uint64_t m_time;
+};
+
+/**
+ * @brief Run-time object which records each call of a wrapped MLI 3.0 run-time object
+ *
+ * The wrapper can be used instead of the wrapped object, i.e. in the TilePipeline. Tiles
+ * are counted by Update() calls, so the wrapped object is expected to be at its first tile.
+ * The optional estimator provides bytes and MACs of each tile (see PerfEstimator::Create()).
+ *
+ * The wrapper is not created by ExecutionInterface::Create(), so GetKernelId() of the
+ * wrapper returns kInvalidId. Use GetKernel() to access the wrapped object.
+ */
+class ProfiledKernel : public ExecutionInterface {
+  public:
+    /**
+     * @brief Constructor of the wrapper
+     *
+     * @param kernel    [I] wrapped run-time object
+     * @param profiler  [I] profiler for records
+     * @param layer     [I] layer index written to records
+     * @param estimator [I] estimator of the wrapped object, can be nullptr
+     */
+    ProfiledKernel(ExecutionInterface* kernel, Profiler* profiler, uint32_t layer = 0,
+                   PerfEstimator* estimator = nullptr);
+
+    mli_status Issue() override;
+    mli_status Prefetch() override;
+    mli_status Update() override;
+
+    ExecutionInterface* GetKernel() const { return m_kernel; }
+
+    /**
+     * @brief Method to get the number of tiles completed by Update() calls
+     */
+    uint32_t GetTile() const { return m_tile; }
+
+  private:
+    ProfileRecord StartRecord(ProfileCall call);
+    mli_status EndRecord(ProfileRecord& record, mli_status status);
+
+    ExecutionInterface* m_kernel;
+    Profiler* m_profiler;
+    PerfEstimator* m_estimator;
+    kernel_id_t m_kernel_id;
+    uint32_t m_layer;
+    uint32_t m_tile;
+};
+
+} // namespace snps_arc::metaware::mli
+
+#endif // _MLI_PROFILER_HPP_
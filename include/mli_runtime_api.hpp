@@ -57,6 +57,12 @@ class ExecutionInterface {
                                      uint32_t private_data_size,
                                      uint64_t* membases, int num_mems);
 
+    /**
+     * @brief Method to get the kernel_id of the MLI 3.0 run-time object
+     *
+     * The kernel_id is taken from the kernel private data when the object is created
+     * with the Create() method.
+     */
     kernel_id_t GetKernelId();
 
     /**
@@ -88,7 +94,7 @@ class ExecutionInterface {
      */
     virtual mli_status Update() = 0;
 private:
-    kernel_id_t m_kernel_id;
+    kernel_id_t m_kernel_id{kInvalidId};
 };
 
 } // namespace mli
@@ -9,14 +9,46 @@
 #ifndef _MLI_SYNC_INTERFACE_HPP_
 #define _MLI_SYNC_INTERFACE_HPP_
 
+#include <stdint.h>
+
+#include "mli_types.h"
+
 namespace snps_arc::metaware::mli {
 
+/**
+ * @brief Event based synchronization between processors
+ *
+ * Each bit of a 32-bit mask is an event. An event stays signaled until it is cleared.
+ * The default implementation keeps events in a local register and is intended for
+ * single core systems where nobody else can signal an event: WaitEvent() never blocks
+ * and fails for events which aren't signaled yet. Multi-core platforms (or hosts using
+ * threads) derive from this class and map events to the hardware event unit or to OS
+ * synchronization primitives.
+ */
 class SynchronizationInterface {
 
   public:
-    mli_status WaitEvent(int32_t mask);
+    virtual ~SynchronizationInterface() = default;
+
+    /**
+     * @brief Signal all events of the mask
+     */
+    virtual mli_status SignalEvent(int32_t mask);
+
+    /**
+     * @brief Clear all events of the mask
+     */
+    virtual mli_status ClearEvent(int32_t mask);
+
+    /**
+     * @brief Wait until all events of the mask are signaled
+     */
+    virtual mli_status WaitEvent(int32_t mask);
+
+  protected:
+    int32_t m_events = 0;
 };
 
 
 }  //namespace mli
-#endif
\ No newline at end of file
+#endif
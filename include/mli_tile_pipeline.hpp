@@ -0,0 +1,159 @@
+/*
+* Copyright 2022, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+#ifndef _MLI_TILE_PIPELINE_HPP_
+#define _MLI_TILE_PIPELINE_HPP_
+
+#include "mli_runtime_api.hpp"
+#include "mli_sync_interface.hpp"
+#include "mli_types.h"
+#include "mli_types.hpp"
+
+namespace snps_arc::metaware::mli {
+
+/**
+ * @brief Run-time objects of one pipeline stage for each of the buffer slots
+ *
+ * Objects of different slots are compiled with the same IteratorCfg, but their tile
+ * buffers are attached to different offsets (see TilePipeline::PlanBuffers()).
+ * Event masks are the values of GetEventPrefetchMask() and GetEventIssueMask() of the
+ * compile-time objects. Zero mask means that the method is synchronous and the job
+ * is completed when the method returns.
+ */
+struct TilePipelineOp {
+    ExecutionInterface* op[2];
+    int32_t prefetch_event[2];
+    int32_t issue_event[2];
+};
+
+/**
+ * @brief Statistics of the last TilePipeline::Run()
+ *
+ * A transfer is overlapped if at least one compute tile was issued between the start
+ * of the transfer and the wait for its completion. Synchronous transfers (zero issue
+ * event mask) are never overlapped.
+ */
+struct TilePipelineStats {
+    uint32_t tiles;
+    uint32_t transfers;
+    uint32_t overlapped_transfers;
+};
+
+/**
+ * @brief Double buffered pipeline of Move-in, compute and Move-out MLI 3.0 kernels
+ *
+ * The pipeline executes all tiles of a compute kernel with its inputs and outputs moved
+ * between the main memory and two sets (slots) of tile buffers in the fast memory by
+ * Move kernels. Tile t uses slot t % 2, and while the compute of tile t is in progress,
+ * the inputs of tile t + 1 are moved into the other slot and the output of tile t - 1
+ * is moved out of it:
+ *
+ *   wait Move-in(t);  start Move-in(t + 1);
+ *   wait Move-out(t - 2);  Issue compute(t);  start Move-out(t);
+ *
+ * Each object of a slot processes every second tile, so its iterators are moved to the
+ * next own tile by two Update() calls. Objects are expected to be just created, e.g. by
+ * ExecutionInterface::Create(). Waits are done on the SynchronizationInterface events
+ * given in TilePipelineOp, and each event is cleared after the wait, so asynchronous
+ * jobs (DMA, accelerator) have to signal their event on completion.
+ */
+class TilePipeline {
+  public:
+    static constexpr uint32_t kNumSlots = 2;
+    static constexpr uint32_t kMaxInputs = 4;
+    static constexpr uint32_t kMaxOutputs = 2;
+
+    /**
+     * @brief Constructor of the pipeline
+     *
+     * @param sync [I] events used to wait for asynchronous jobs. Can be nullptr if all
+     *                 event masks are zero.
+     */
+    explicit TilePipeline(SynchronizationInterface* sync);
+
+    /**
+     * @brief Method to compute offsets of tile buffers of both slots
+     *
+     * Buffers of the slot 0 are followed by buffers of the slot 1, each at an offset
+     * aligned to the alignment value. Buffer sizes are expected to be taken from the
+     * compiler side of the compute kernel (GetInputBufferSize() and similar methods).
+     *
+     * @param sizes       [I] sizes of tile buffers of a single slot in bytes
+     * @param num_buffers [I] number of elements in the sizes array
+     * @param base        [I] offset of the first buffer in the fast memory
+     * @param offsets     [O] offsets of buffers: offsets[slot * num_buffers + idx]
+     * @param alignment   [I] alignment of each buffer offset in bytes
+     *
+     * @return size of the fast memory used by both slots including alignment gaps
+     */
+    static uint32_t PlanBuffers(const uint32_t* sizes, uint32_t num_buffers, uint32_t base,
+                                uint32_t* offsets, uint32_t alignment = kMliAlignment);
+
+    /**
+     * @brief Method to set the compute kernel of the pipeline
+     */
+    mli_status SetCompute(const TilePipelineOp& compute);
+
+    /**
+     * @brief Method to add a Move kernel which copies a tile input into the fast memory
+     */
+    mli_status AddInput(const TilePipelineOp& move);
+
+    /**
+     * @brief Method to add a Move kernel which copies a tile output from the fast memory
+     */
+    mli_status AddOutput(const TilePipelineOp& move);
+
+    /**
+     * @brief Method to execute tiles of the pipeline
+     *
+     * All started jobs are completed when the method returns, even if one of them failed.
+     *
+     * @param num_tiles [I] number of tiles, e.g. GetTotalCount() of the compute kernel iterator
+     */
+    mli_status Run(uint32_t num_tiles);
+
+    /**
+     * @brief Method to get statistics of the last Run()
+     */
+    const TilePipelineStats& GetStats() const { return m_stats; }
+
+    /**
+     * @brief Method to get the share of overlapped transfers of the last Run() in percents
+     */
+    uint32_t GetOverlapPercent() const;
+
+  private:
+    struct Stage {
+        TilePipelineOp desc;
+        uint32_t position[kNumSlots];
+        uint32_t issue_compute_count[kNumSlots];
+        bool in_flight[kNumSlots];
+    };
+
+    mli_status AddStage(Stage* stages, uint32_t& num_stages, uint32_t max_stages,
+                        const TilePipelineOp& desc);
+    void ResetStage(Stage& stage);
+    mli_status Start(Stage& stage, uint32_t tile, bool is_transfer);
+    mli_status Wait(Stage& stage, uint32_t slot, bool is_transfer);
+    mli_status WaitEvent(int32_t mask);
+
+    SynchronizationInterface* m_sync;
+    Stage m_compute;
+    Stage m_inputs[kMaxInputs];
+    Stage m_outputs[kMaxOutputs];
+    uint32_t m_num_inputs;
+    uint32_t m_num_outputs;
+    bool m_has_compute;
+    uint32_t m_compute_count;
+    TilePipelineStats m_stats;
+};
+
+} // namespace snps_arc::metaware::mli
+
+#endif // _MLI_TILE_PIPELINE_HPP_
@@ -0,0 +1,140 @@
+/*
+* Copyright 2022, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+#ifndef _MLI_TILE_SCHEDULER_HPP_
+#define _MLI_TILE_SCHEDULER_HPP_
+
+#include "mli_platform_desc.hpp"
+#include "mli_runtime_api.hpp"
+#include "mli_sync_interface.hpp"
+#include "mli_types.h"
+
+namespace snps_arc::metaware::mli {
+
+/**
+ * @brief Contiguous range of tiles in the iteration order of a kernel
+ */
+struct TileRange {
+    uint32_t first;
+    uint32_t count;
+};
+
+/**
+ * @brief Scheduler which splits the tiles of MLI 3.0 kernels across processors
+ *
+ * One scheduler object is created on each processor (worker) with the processor ID and
+ * the number of processors taken from the PlatformDescription. The tile space of a kernel
+ * is split into contiguous ranges of almost equal size, and each worker executes only
+ * its own range on its own run-time object: iterators of the object are moved to the
+ * first tile of the range by Update() calls which only advance the positions.
+ *
+ * Tiles of different workers must write disjoint parts of the output, and each worker
+ * needs its own local memory for the tile buffers (its own membases for Create()).
+ *
+ * Workers are synchronized by Barrier() built on top of SynchronizationInterface events.
+ * Events are used in three banks of kMaxWorkers bits, so the barrier can be passed any
+ * number of times without an extra reset: the bit of the previous barrier is cleared
+ * only when nobody can wait for it anymore. All workers must call Barrier() (or Run())
+ * the same number of times.
+ *
+ * Bits of the last barrier stay signaled when a scheduler is done, so the next scheduler
+ * created on the same events (i.e. one per layer) could pass its first barrier at once.
+ * To avoid this, all workers call Finish() before the events are reused by the next
+ * scheduler of the same workers.
+ */
+class TileScheduler {
+  public:
+    static constexpr uint32_t kMaxWorkers = 10;
+
+    /**
+     * @brief Optional per-tile callback (i.e. to move the tile data to the local memory)
+     *
+     * @param op       [I] run-time object of the kernel
+     * @param tile_idx [I] index of the tile in the whole tile space of the kernel
+     * @param ctx      [I] user context passed to Run()
+     */
+    typedef mli_status (*TileCallback)(ExecutionInterface& op, uint32_t tile_idx, void* ctx);
+
+    /**
+     * @brief Constructor of the scheduler
+     *
+     * @param pd   [I] platform description with the processor ID and number of processors
+     * @param sync [I] events shared by all workers. Can be nullptr for a single worker.
+     */
+    TileScheduler(const PlatformDescription& pd, SynchronizationInterface* sync);
+
+    /**
+     * @brief Method to get tiles range of a worker
+     *
+     * The first (total_tiles % num_workers) workers get one tile more than others.
+     */
+    static TileRange GetTileRange(uint32_t total_tiles, uint32_t num_workers, uint32_t worker_id);
+
+    /**
+     * @brief Method to get tiles range of the current worker
+     */
+    TileRange GetTileRange(uint32_t total_tiles) const;
+
+    /**
+     * @brief Method to move iterators of a just created run-time object to the first own tile
+     *
+     * @param op          [I] run-time object of the kernel
+     * @param total_tiles [I] total number of tiles of the kernel
+     */
+    mli_status Seek(ExecutionInterface& op, uint32_t total_tiles) const;
+
+    /**
+     * @brief Method to execute own tiles of a just created run-time object and wait for others
+     *
+     * For each own tile Prefetch(), before_issue(), Issue(), after_issue() and Update()
+     * are called. Callbacks can be nullptr. Barrier() is called even if a tile failed,
+     * so other workers never wait forever.
+     *
+     * @param op           [I] run-time object of the kernel
+     * @param total_tiles  [I] total number of tiles of the kernel
+     * @param before_issue [I] callback called after Prefetch() of each tile
+     * @param after_issue  [I] callback called after Issue() of each tile
+     * @param ctx          [I] user context passed to callbacks
+     */
+    mli_status Run(ExecutionInterface& op, uint32_t total_tiles,
+                   TileCallback before_issue = nullptr, TileCallback after_issue = nullptr,
+                   void* ctx = nullptr);
+
+    /**
+     * @brief Method to wait until all workers reach the same barrier
+     */
+    mli_status Barrier();
+
+    /**
+     * @brief Method to leave the events ready for the next scheduler of the same workers
+     *
+     * Passes up to kNumEventBanks - 1 extra barriers, so the last barrier uses the bank
+     * which a new scheduler treats as the previous one and clears on its first barrier.
+     * Bits of other banks are cleared. All workers must call it.
+     */
+    mli_status Finish();
+
+    uint32_t GetWorkerId() const { return m_worker_id; }
+
+    uint32_t GetNumWorkers() const { return m_num_workers; }
+
+  private:
+    static constexpr uint32_t kNumEventBanks = 3;
+
+    mli_status RunTiles(ExecutionInterface& op, TileRange range,
+                        TileCallback before_issue, TileCallback after_issue, void* ctx);
+
+    SynchronizationInterface* m_sync;
+    uint32_t m_worker_id;
+    uint32_t m_num_workers;
+    uint32_t m_barrier_count;
+};
+
+} // namespace snps_arc::metaware::mli
+
+#endif // _MLI_TILE_SCHEDULER_HPP_
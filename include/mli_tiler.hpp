@@ -0,0 +1,190 @@
+/*
+* Copyright 2022, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+#ifndef _MLI_TILER_HPP_
+#define _MLI_TILER_HPP_
+
+#include "mli_iterator.hpp"
+#include "mli_platform_desc.hpp"
+#include "mli_types.h"
+#include "mli_types.hpp"
+
+namespace snps_arc::metaware::mli {
+
+// Tiler works on tensors in the group tensor layout [B, H, W, G, C] (see kGroupTensor*Dim)
+constexpr uint32_t kTilerRank = kConvIORank;
+
+/**
+ * @brief Description of a kernel for the Tiler
+ *
+ * Input tile along each dimension is derived from the output tile in the same way as
+ * IteratorCfg does it for conv-like kernels:
+ *
+ *   in_tile = (out_tile - 1) * stride + effective_kernel_size (clipped by padding on edges)
+ *
+ * A zero stride means that each output tile needs the whole input dimension (input
+ * channels of Conv2d). Weights tile is defined by the output tile along group and channel
+ * dimensions. Kernels with 4D tensors [B, H, W, C] (pooling, eltwise) use a single group.
+ *
+ * Objects are expected to be created by one of the static methods below and can be
+ * adjusted afterwards, i.e. to place tile buffers into different memories.
+ */
+struct TilerProblem {
+    enum BufferType {
+        kInput = 0,
+        kWeights,
+        kOutput,
+        kNumBuffers
+    };
+
+    uint32_t in_shape[kTilerRank];
+    uint32_t out_shape[kTilerRank];
+    uint32_t effective_kernel_size[kTilerRank];
+    uint32_t stride[kTilerRank];
+    uint32_t pre_padding[kTilerRank];
+    uint32_t num_inputs;                    /**< Number of inputs of in_shape (2 for eltwise) */
+    uint32_t weights_per_channel;           /**< Number of weights per output channel, 0 if no weights */
+    uint32_t ops_per_out_elem;              /**< Operations per output element */
+    bool ops_are_macs;                      /**< Operations are MACs (otherwise element-wise ops) */
+    uint32_t elem_size[kNumBuffers];        /**< Element size of each tile buffer in bytes */
+    uint32_t mem_idx[kNumBuffers];          /**< Memory of each tile buffer (see PlatformDescription) */
+    uint32_t num_slots;                     /**< Number of buffer sets: 2 for TilePipeline, 1 otherwise */
+
+    /**
+     * @param in_shape      [I] input shape [B, H, W, G, Ci]
+     * @param weights_shape [I] weights shape [G, Kh, Kw, Ci, Co]
+     */
+    static TilerProblem Conv2d(const uint32_t in_shape[kConvIORank],
+                               const uint32_t weights_shape[kConvWRank],
+                               const Conv2DConfig& cfg,
+                               uint32_t in_elem_size, uint32_t weights_elem_size,
+                               uint32_t out_elem_size);
+
+    /**
+     * @param in_shape      [I] input shape [B, H, W, G, C]
+     * @param weights_shape [I] weights shape [Kh, Kw, C]
+     */
+    static TilerProblem DepthwiseConv2d(const uint32_t in_shape[kDepthwiseIORank],
+                                        const uint32_t weights_shape[kDepthwiseWRank],
+                                        const DwConv2DConfig& cfg,
+                                        uint32_t in_elem_size, uint32_t weights_elem_size,
+                                        uint32_t out_elem_size);
+
+    /**
+     * @param in_shape [I] input shape [B, H, W, C]
+     */
+    static TilerProblem Pool2D(const uint32_t in_shape[kPoolRank], const PoolOpConfig& cfg,
+                               uint32_t elem_size);
+
+    /**
+     * @param shape [I] shape of both inputs and output [B, H, W, C]
+     */
+    static TilerProblem Eltwise(const uint32_t shape[kEltwiseRank], uint32_t in_elem_size,
+                                uint32_t out_elem_size);
+};
+
+/**
+ * @brief Tiling of a kernel as evaluated by the Tiler
+ *
+ * Traffic counts bytes moved between the main memory and the tile buffers by all tiles,
+ * including overlaps of input tiles (halo) and repeated fetches of inputs and weights.
+ */
+struct TilerCandidate {
+    uint32_t tile_size[kTilerRank];                         /**< Output tile size */
+    uint32_t num_tiles;
+    uint32_t buffer_size[TilerProblem::kNumBuffers];        /**< Size of each tile buffer of one slot */
+    uint32_t mem_usage[PlatformDescription::kMaxMemories];  /**< Used bytes of each memory by all slots */
+    int64_t read_bytes;
+    int64_t write_bytes;
+    int64_t cycles;
+};
+
+/**
+ * @brief Automatic selection of the output tile size from the fast memory budget
+ *
+ * Tiles are iterated in the identity order {0, 1, 2, 3, 4}: the batch dimension is the
+ * innermost and the channel dimension is the outermost one. An operand is fetched
+ * again only when its tile changes between two consecutive tiles, so weights are fetched
+ * once for each channel tile, while input tiles of Conv2d are fetched again for each
+ * output channel tile if the input is tiled too.
+ *
+ * Each tile size that fits the sizes of memories given by PlatformDescription::GetMemorySize()
+ * is ranked by estimated cycles, then by traffic and then by the number of tiles.
+ * Cycles are estimated with the same model as used by the PerfEstimator: compute of all
+ * tiles, memory transfers of the traffic and a fixed overhead per tile. With two buffer
+ * slots compute and transfers are assumed to overlap (see TilePipeline).
+ *
+ * Output tile sizes along each dimension are limited to the sizes which give the minimal
+ * tile for a number of tiles, and to sizes that cover the pre-padding with the first tile,
+ * which is required by IteratorCfg.
+ */
+class Tiler {
+  public:
+    Tiler(const PlatformDescription& pd, const TilerProblem& problem);
+
+    /**
+     * @brief Method to evaluate a single output tile size
+     *
+     * @return MLI_STATUS_BAD_FUNC_CFG if the tile size can't be used with the kernel,
+     *         MLI_STATUS_NOT_ENGH_MEM if tile buffers don't fit the memories. The candidate
+     *         is filled in both cases.
+     */
+    mli_status Evaluate(const uint32_t tile_size[kTilerRank], TilerCandidate& candidate) const;
+
+    /**
+     * @brief Method to get the best tile sizes which fit the memories
+     *
+     * @param candidates     [O] best candidates sorted from the best one
+     * @param max_candidates [I] number of elements in the candidates array
+     *
+     * @return number of candidates written to the array (0 if nothing fits)
+     */
+    uint32_t Search(TilerCandidate* candidates, uint32_t max_candidates) const;
+
+    /**
+     * @brief Method to get the best tile size which fits the memories
+     *
+     * @return MLI_STATUS_NOT_ENGH_MEM if nothing fits
+     */
+    mli_status GetBest(TilerCandidate& candidate) const;
+
+    /**
+     * @brief Methods to get iterator configs of the output and input tensors for a candidate
+     *
+     * For 4D kernels the group dimension has to be dropped, i.e. with GetTileSize().
+     */
+    IteratorCfg<kTilerRank> GetOutputIteratorCfg(const TilerCandidate& candidate) const;
+    IteratorCfg<kTilerRank> GetInputIteratorCfg(const TilerCandidate& candidate) const;
+
+    /**
+     * @brief Method to get the output tile size in the rank of the kernel
+     *
+     * @param candidate [I] candidate of the tiler
+     * @param rank      [I] kTilerRank or 4 for kernels without group dimension
+     * @param tile_size [O] output tile size
+     */
+    static void GetTileSize(const TilerCandidate& candidate, uint32_t rank, uint32_t* tile_size);
+
+    /**
+     * @brief Method to compare two candidates
+     *
+     * @return true if the first candidate is better than the second one
+     */
+    static bool IsBetter(const TilerCandidate& a, const TilerCandidate& b);
+
+  private:
+    void SearchDim(uint32_t dim, uint32_t tile_size[kTilerRank], TilerCandidate* candidates,
+                   uint32_t max_candidates, uint32_t& num_candidates) const;
+
+    PlatformDescription m_pd;
+    TilerProblem m_problem;
+};
+
+} // namespace snps_arc::metaware::mli
+
+#endif // _MLI_TILER_HPP_
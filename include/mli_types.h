@@ -232,6 +232,31 @@ typedef struct {
  */
 typedef mli_prelu_cfg mli_softmax_cfg;
 
+/**
+ * @brief Maximum number of the largest values which streaming softmax can track for top-k output
+ */
+#define MLI_SOFTMAX_STREAM_MAX_TOPK (16)
+
+/**
+ * @brief Streaming softmax state
+ *
+ * State of the online softmax over a single slice which is passed to kernels in several chunks.
+ * It's initialized by mli_krn_softmax_stream_init() and updated by mli_krn_softmax_stream_update_sa8().
+ * Fields must not be modified by user.
+ */
+typedef struct {
+    int32_t max_val;    /**< Maximum of processed input values (quantized) */
+    int32_t sum_exp;    /**< Sum of exponents of processed values relative to max_val in Q15 divided by 2^sum_shift */
+    int32_t sum_shift;  /**< Down-scaling of sum_exp which prevents its overflow on long slices */
+    int32_t num_values; /**< Number of processed values */
+    int32_t in_scale;   /**< Scale of input chunks. All chunks of a slice must have the same quantization */
+    int32_t in_shift;   /**< Scale fractional bits of input chunks */
+    int32_t topk;       /**< Number of the largest values to track for top-k output */
+    int32_t topk_num;   /**< Number of currently tracked values */
+    int32_t topk_idx[MLI_SOFTMAX_STREAM_MAX_TOPK]; /**< Indexes of tracked values in the slice, in descending order of values */
+    int8_t topk_val[MLI_SOFTMAX_STREAM_MAX_TOPK];  /**< Tracked values in descending order */
+} mli_softmax_stream_state;
+
 /**
  * @brief L2 Normalization Layer config
  *
@@ -248,6 +273,22 @@ typedef struct {
     mli_relu_cfg relu; /**< Type of ReLU activation applied to output values.*/
 } mli_fully_connected_cfg;
 
+/**
+ * @brief Cached quantization parameters of sa8 layer
+ *
+ * Data structure to keep per output channel quantization parameters of a layer with static weights.
+ * It is filled once (for instance, at model load) by mli_krn_fully_connected_sa8_sa8_sa32_cache_quant()
+ * and used by mli_krn_fully_connected_sa8_sa8_sa32_cached() without re-derivation from el_params of tensors.
+ * Arrays are allocated by the user and must have at least one element per output channel.
+ */
+typedef struct {
+    int32_t *bias;      /**< Fused bias of each channel: bias + (-in_zero_point * sum(weights)) */
+    int32_t *out_mul;   /**< Output multiplier of each channel */
+    int8_t *out_shift;  /**< Output shift of each channel */
+    uint32_t ch_num;    /**< Number of output channels. Filled by the library */
+    int16_t out_offset; /**< Zero point of output. Filled by the library */
+} mli_sa8_quant_cache;
+
 
 
 /**
@@ -270,6 +311,45 @@ typedef struct {
                                   filter point across height dimension. If set to 0 or 1, no dilation logic is used*/
 } mli_conv2d_cfg;
 
+/**
+ * @brief Pre-validated convolutional layer descriptor
+ *
+ * Data structure to keep a layer which was validated once (for instance, at model load) by
+ * mli_krn_conv2d_hwcn_sa8_sa8_sa32_prepare() or mli_krn_depthwise_conv2d_hwcn_sa8_sa8_sa32_prepare().
+ * It holds the layer configuration, constant weights and bias tensors, quantization parameters and
+ * ReLU limits derived from the tensors, and the kernel specialization chosen by the shape of weights.
+ * Corresponding *_run_prepared() functions use it without parameter checks and re-derivation.
+ * Fields are filled by the library and are not expected to be changed by the user.
+ */
+typedef struct {
+    mli_conv2d_cfg cfg;             /**< Copy of the layer configuration */
+    const mli_tensor *weights;      /**< Weights tensor of the layer */
+    const mli_tensor *bias;         /**< Bias tensor of the layer */
+    const int16_t *weight_scales;   /**< Scale of weights (per tensor) or array of scales (per output channel) */
+    const int8_t *weight_shifts;    /**< Fractional bits of weights scale(s) */
+    int32_t weight_dim;             /**< Quantization axis of weights. Negative value for per tensor quantization */
+    int32_t in_to_out_shift;        /**< Shift of the input to output scales ratio */
+    int16_t in_to_out_scales_ratio; /**< Ratio of input to output scales */
+    int16_t in_offset;              /**< Zero point of input */
+    int16_t out_offset;             /**< Zero point of output */
+    int16_t weights_offset;         /**< Zero point of weights */
+    int16_t relu_min;               /**< Lower limit of output values after ReLU */
+    int16_t relu_max;               /**< Upper limit of output values after ReLU */
+    uint8_t kernel_size;            /**< Size of the specialized square kernel or 0 for the generic kernel */
+} mli_conv2d_prepared;
+
+/**
+ * @brief Winograd transform type definition
+ *
+ * enum used for selection of the Winograd algorithm for 3x3 convolutions with unit stride.
+ * F(m x m, 3x3) produces m x m output points per tile from (m + 2) x (m + 2) input points.
+ */
+typedef enum {
+    MLI_WINOGRAD_F2X2_3X3 = 0,  /**< F(2x2, 3x3). 4x4 tiles, 2.25x less multiplications than direct convolution.*/
+    MLI_WINOGRAD_F4X4_3X3,      /**< F(4x4, 3x3). 6x6 tiles, 4x less multiplications than direct convolution.*/
+    MLI_WINOGRAD_LARGE_ENUM = 0x02000000  /**< Utility field. Prevent size optimization of public enums */
+} mli_winograd_type;
+
 
 
 /**
@@ -75,6 +75,8 @@ constexpr unsigned kConvWIterRank = 5;   // TODO: remove and use kConvIterRank i
 constexpr unsigned kConvZPRank = 1;      // TODO: remove and use kWZPRank instead
 constexpr unsigned kConvZPIterRank = 5;  // TODO: remove and use kConvIterRank instead
 constexpr unsigned kConvIterRank = 5;
+constexpr unsigned kConvEpilogueParamRank = 1;
+constexpr unsigned kConvEpilogueLutSize = 256;
 
 constexpr unsigned kInpZPRank = 1;
 constexpr unsigned kWZPRank = 1;
@@ -119,10 +121,12 @@ constexpr unsigned kPoolIterRank = 4;
 constexpr unsigned kReduceSumRank = 4;
 constexpr unsigned kReduceSumIterRank = 4;
 
-constexpr short int kMatMulRank = 2;
-constexpr short int kMatMulIterRank = 2;
-constexpr short int kMatMulHeightDim = 0;
-constexpr short int kMatMulWidthDim = 1;
+constexpr short int kMatMulRank = 3;
+constexpr short int kMatMulIterRank = 3;
+constexpr short int kMatMulBatchDim = 0;
+constexpr short int kMatMulHeightDim = 1;
+constexpr short int kMatMulWidthDim = 2;
+constexpr short int kMatMulZPSize = 2; // zero points of the left and the right inputs
 
 constexpr short int kArgMaxInRank = 4;
 constexpr short int kArgMaxInIterRank = 4;
@@ -131,11 +135,16 @@ constexpr short int kArgMaxOutIterRank = 3;
 
 constexpr short int kTableBuiltinIORank = 4;
 constexpr short int kTableBuiltinIOIterRank = 4;
+constexpr short int kTableBuiltinInFracBits = 11;
+constexpr short int kTableBuiltinOutFracBits = 15;
 
 constexpr short int kBiasRank = 1;
 constexpr short int kBiasIterRank = 1;
 constexpr unsigned kEltwiseIterRank = 4;
 constexpr unsigned kEltwiseRank = 4;
+constexpr unsigned kEltwiseChainMaxSteps = 8;
+constexpr unsigned kEltwiseChainParamRank = 1;
+constexpr unsigned kEltwiseChainLutSize = 256;
 
 constexpr short int kReduceMaxRank = 4;
 constexpr short int kReduceMaxIterRank = 4;
@@ -178,6 +187,7 @@ typedef enum : uint32_t {
   kMatMulId,
   kMoveBroadcastId,
   kResizeBilinearId,
+  kEltwiseChainId,
 } kernel_id_t;
 
 typedef enum class compression_mode_t : uint8_t {
@@ -861,6 +871,29 @@ struct QTensor {
 //
 //=================================================================
 
+/**
+ * @brief Epilogue of the convolution which is fused into the kernel
+ *
+ * If enabled, 32-bit accumulators are not stored to the output. Instead, they are rescaled per output channel
+ * (see RescaleConfig), clipped to [clip_min, clip_max] range and optionally passed through the 256-entry int8
+ * look-up table (activation function) while they are still in registers. The output tensor is int8 in this case.
+ * Parameters are provided by the EncodeEpilogueParams method of the kernel.
+ */
+struct ConvEpilogueConfig {
+    ConvEpilogueConfig() = default;
+    ConvEpilogueConfig(int8_t clip_min, int8_t clip_max, bool use_lut = false)
+      : enabled{true}
+      , clip_min{clip_min}
+      , clip_max{clip_max}
+      , use_lut{use_lut}
+    {}
+
+    bool enabled{false};        /**< Rescale, clip and activation are fused into the kernel. Output is int8 */
+    int8_t clip_min{INT8_MIN};  /**< Lower bound of the output values */
+    int8_t clip_max{INT8_MAX};  /**< Upper bound of the output values */
+    bool use_lut{false};        /**< Apply int8->int8 look-up table (256 entries, index is value + 128) after clip */
+};
+
 struct Conv2DConfig {
     Conv2DConfig() = default;
     Conv2DConfig(uint32_t stride_ih, uint32_t stride_iw, 
@@ -885,6 +918,7 @@ struct Conv2DConfig {
                                    filter point across appropriate dimension. If set to 1, no dilation logic is used */
     uint32_t groups;           /**< Number of groups input channels and output channels are divided into. */
     compression_mode_t mode;   /**< compression mode used for weights (Uncompressed - Compressed - Sparse) */
+    ConvEpilogueConfig epilogue; /**< Fused rescale/clip/activation of the output (disabled by default) */
 };
 
 struct DwConv2DConfig {
@@ -974,7 +1008,9 @@ struct TableBuiltinConfig {
     , innermost_dim_bias{innermost_dim_bias}
   {}
 
-  LutType type;             /**< Type of the table which should be used by the kernel */
+  LutType type;             /**< Type of the table which should be used by the kernel.
+                                  Input and output are 16-bit fixed point values with kTableBuiltinInFracBits
+                                  and kTableBuiltinOutFracBits fractional bits respectively */
   bool innermost_dim_bias;  /**<  Is bias provided per innermost dimension. if false implies per-tensor bias.
                                   Otherwise implies separate bias value per slice across innermost dimension */
 };
@@ -1035,22 +1071,106 @@ struct PreluOpConfig {
                      If axis < 0 the function will be applied to the whole tensor */
 };
 
+/**
+ * @brief Requantization of the ResizeBilinear output which is fused into the kernel
+ *
+ * If enabled, interpolated 32-bit values (input values scaled by 2^(2 * shift) of ResizeOpConfig) are
+ * rescaled (see RescaleConfig) with scale, shift and out_bias, clipped to [clip_min, clip_max] range
+ * and stored to the int8 output tensor. Otherwise the output tensor is int32.
+ */
+struct ResizeRequantConfig {
+  ResizeRequantConfig() = default;
+  ResizeRequantConfig(int16_t scale, int8_t shift, int8_t out_bias,
+                      int8_t clip_min = INT8_MIN, int8_t clip_max = INT8_MAX)
+    : enabled{true}
+    , scale{scale}
+    , shift{shift}
+    , out_bias{out_bias}
+    , clip_min{clip_min}
+    , clip_max{clip_max}
+  {}
+
+  bool enabled{false};        /**< Output is requantized to int8 */
+  int16_t scale{1};           /**< Scale of the interpolated values */
+  int8_t shift{0};            /**< Right shift applied after scaling */
+  int8_t out_bias{0};         /**< Output bias (zero point) added after shifting */
+  int8_t clip_min{INT8_MIN};  /**< Lower bound of the output values */
+  int8_t clip_max{INT8_MAX};  /**< Upper bound of the output values */
+};
+
 struct ResizeOpConfig {
   static constexpr unsigned kResizeParamRank = 2;
 
   ResizeOpConfig() = default;
-  ResizeOpConfig(int16_t stride[kResizeParamRank], int16_t offset[kResizeParamRank], int8_t shift) {
+  ResizeOpConfig(int16_t stride[kResizeParamRank], int16_t offset[kResizeParamRank], int8_t shift,
+                 const ResizeRequantConfig& requant = ResizeRequantConfig()) {
     for(unsigned i = 0; i < kResizeParamRank; i++) {
       this->stride[i] = stride[i];
       this->offset[i] = offset[i];
     }
     this->shift = shift;
+    this->requant = requant;
   }
 
   int16_t stride[kResizeParamRank];    /**< [stride_H, stride_W] */
   int16_t offset[kResizeParamRank];    /**< [offset_H, offset_W] */
   int8_t shift;         /**< Shift value (for fractional stride and offset) */
+  ResizeRequantConfig requant;  /**< Optional int8 output (see ResizeRequantConfig) */
+
+};
+
+/**
+ * @brief Operations of the EltwiseChain kernel
+ *
+ * kAdd, kSub, kMul, kMax and kMin combine the working value with the element of the right input.
+ * kRescale and kPrelu requantize the working value (see RescaleConfig and PreluOpConfig), kClip limits
+ * it to [min, max] range and kLut replaces it by the entry of an int8->int8 look-up table
+ * (kEltwiseChainLutSize entries, index is the value saturated to int8 + 128).
+ */
+enum class EltwiseChainOp : uint8_t {
+  kAdd = 0,
+  kSub,
+  kMul,
+  kMax,
+  kMin,
+  kRescale,
+  kClip,
+  kLut,
+  kPrelu
+};
+
+struct EltwiseChainStep {
+  EltwiseChainOp op;
+  bool per_channel;   /**< Parameters are given per channel (innermost dimension). kRescale and kPrelu only */
+};
+
+/**
+ * @brief Sequence of pointwise operations fused into the EltwiseChain kernel
+ *
+ * Each output element is computed in a single pass: the 32-bit working value is loaded from the left input
+ * and passed through the steps in the order of the chain. Only the final value is saturated to the output
+ * element type, so Add->Rescale->Clip or Mul->Rescale sequences don't store intermediate tensors.
+ */
+struct EltwiseChainConfig {
+  EltwiseChainConfig() = default;
+
+  /**
+   * @brief Method to append a step to the chain
+   *
+   * @return false if the chain already has kEltwiseChainMaxSteps steps or per_channel is requested
+   *         for an operation without per channel parameters
+   */
+  bool AddStep(EltwiseChainOp op, bool per_channel = false) {
+    if (num_steps >= kEltwiseChainMaxSteps) return false;
+    if (per_channel && op != EltwiseChainOp::kRescale && op != EltwiseChainOp::kPrelu) return false;
+    steps[num_steps].op = op;
+    steps[num_steps].per_channel = per_channel;
+    num_steps++;
+    return true;
+  }
 
+  uint32_t num_steps{0};
+  EltwiseChainStep steps[kEltwiseChainMaxSteps];
 };
 
 } // namespace snps_arc::metaware::mli
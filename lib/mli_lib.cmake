@@ -30,6 +30,7 @@ file(GLOB temp
     ${MLI_LIB_CMAKE_DIR}/src/bricks/*.cc
     ${MLI_LIB_CMAKE_DIR}/src/private/src/mli_check.cc
     ${MLI_LIB_CMAKE_DIR}/src/private/src/mli_prv_activation_lut.cc
+    ${MLI_LIB_CMAKE_DIR}/src/private/src/mli_weights_codec.cc
     ${MLI_LIB_CMAKE_DIR}/src/move/*.cc
     ${MLI_LIB_CMAKE_DIR}/src/kernels/diverse/*.cc
     ${MLI_LIB_CMAKE_DIR}/src/kernels/pooling/*hwc*.cc
@@ -41,6 +42,12 @@ endif()
 if ( ${MLI_INCLUDE_RUNTIME} STREQUAL ON)
 file(GLOB temp_runtime
     ${MLI_LIB_CMAKE_DIR}/src/private/src/mli_runtime.cc
+    ${MLI_LIB_CMAKE_DIR}/src/private/src/mli_perf_estim.cc
+    ${MLI_LIB_CMAKE_DIR}/src/private/src/mli_graph_executor.cc
+    ${MLI_LIB_CMAKE_DIR}/src/private/src/mli_profiler.cc
+    ${MLI_LIB_CMAKE_DIR}/src/private/src/mli_tile_scheduler.cc
+    ${MLI_LIB_CMAKE_DIR}/src/private/src/mli_tile_pipeline.cc
+    ${MLI_LIB_CMAKE_DIR}/src/private/src/mli_tiler.cc
 )
 endif()
 
@@ -86,8 +93,12 @@ set(MLI_LIB_SOURCE_FILES
     ${MLI_LIB_CMAKE_DIR}/src/kernels/clip/mli_krn_clip_runtime.cc
     ${MLI_LIB_CMAKE_DIR}/src/kernels/transform/mli_krn_prelu_compiler.cc
     ${MLI_LIB_CMAKE_DIR}/src/kernels/transform/mli_krn_prelu_runtime.cc
+    ${MLI_LIB_CMAKE_DIR}/src/kernels/transform/mli_krn_table_builtin_compiler.cc
+    ${MLI_LIB_CMAKE_DIR}/src/kernels/transform/mli_krn_table_builtin_runtime.cc
     ${MLI_LIB_CMAKE_DIR}/src/kernels/diverse/mli_krn_permute_compiler.cc
     ${MLI_LIB_CMAKE_DIR}/src/kernels/diverse/mli_krn_permute_runtime.cc
+    ${MLI_LIB_CMAKE_DIR}/src/kernels/diverse/mli_krn_argmax_compiler.cc
+    ${MLI_LIB_CMAKE_DIR}/src/kernels/diverse/mli_krn_argmax_runtime.cc
     ${MLI_LIB_CMAKE_DIR}/src/move/mli_move_broadcast_compiler.cc
     ${MLI_LIB_CMAKE_DIR}/src/move/mli_move_broadcast_runtime.cc
 )
@@ -165,6 +176,48 @@ if (DEFINED MLI_BUILD_REFERENCE)
     endif()
 endif()
 
+if (DEFINED MLI_BUILD_HOST_SIMD)
+    set(choices
+        ON
+        OFF
+    )
+    if (NOT MLI_BUILD_HOST_SIMD IN_LIST choices)
+        message(FATAL_ERROR "invalid MLI_BUILD_HOST_SIMD ${MLI_BUILD_HOST_SIMD}")
+    endif()
+    if (MLI_BUILD_HOST_SIMD STREQUAL "ON" AND NOT ARC)
+        list(APPEND MLI_LIB_PRIVATE_COMPILE_DEFINITIONS
+            MLI_BUILD_HOST_SIMD
+        )
+        # Instruction set extensions for the host SIMD PAL (AVX2/AVX-512BW/NEON).
+        # By default, all extensions of the build machine are enabled.
+        if (NOT DEFINED MLI_HOST_SIMD_FLAGS AND NOT MSVC)
+            set(MLI_HOST_SIMD_FLAGS -march=native)
+        endif()
+        list(APPEND MLI_LIB_PRIVATE_COMPILE_OPTIONS
+            ${MLI_HOST_SIMD_FLAGS}
+        )
+    endif()
+endif()
+
+if (NOT DEFINED MLI_BUILD_HOST_DMA_EMU)
+    set(MLI_BUILD_HOST_DMA_EMU OFF)
+endif()
+set(choices
+    ON
+    OFF
+)
+if (NOT MLI_BUILD_HOST_DMA_EMU IN_LIST choices)
+    message(FATAL_ERROR "invalid MLI_BUILD_HOST_DMA_EMU ${MLI_BUILD_HOST_DMA_EMU}")
+endif()
+# Emulation of asynchronous DMA transfers by host threads (see mli_mov_emu_enable()).
+# Public definition as it enables part of the data movement API.
+if (MLI_BUILD_HOST_DMA_EMU STREQUAL "ON" AND NOT ARC)
+    list(APPEND MLI_LIB_PUBLIC_COMPILE_DEFINITIONS
+        MLI_HOST_DMA_EMU
+    )
+    set(MLI_LIB_HOST_DMA_EMU ON)
+endif()
+
 if (DEFINED MLI_DBG_ENABLE_COMPILE_OPTION_MSG)
     set(choices
         ON
@@ -0,0 +1,152 @@
+/*
+* Copyright 2022, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+
+#ifndef _MLI_KRN_DOTPROD_HOST_SIMD_H_
+#define _MLI_KRN_DOTPROD_HOST_SIMD_H_
+
+#include <type_traits>
+
+#include "mli_config.h"
+#include "mli_debug.h"
+#include "mli_math.h"
+#include "mli_mem_info.h"
+#include "mli_types.h"
+
+namespace mli {
+namespace krn {
+namespace host_simd {
+
+// Strided operands are packed into a local block of this many samples
+// before the vector dot product.
+constexpr int kDotprodPackBlock = 128;
+
+// Vector path covers 8/16-bit operands with 32-bit accumulator (wrap-around
+// like the reference mac) and int16 operands with 64-bit accumulator.
+template <typename l_T, typename r_T, typename acc_T>
+struct dotprod_v_supported {
+    static constexpr bool value =
+        std::is_integral<acc_T>::value && sizeof(l_T) <= 2 && sizeof(r_T) <= 2 &&
+        std::is_signed<l_T>::value && std::is_signed<r_T>::value &&
+        (sizeof(acc_T) == 4 || (sizeof(acc_T) == 8 && sizeof(l_T) == 2 && sizeof(r_T) == 2));
+};
+
+template <typename l_T, typename r_T, typename acc_T>
+static MLI_FORCE_INLINE acc_T dotprod_contiguous(
+        const MLI_PTR(l_T) __restrict l,
+        const MLI_PTR(r_T) __restrict r,
+        acc_T accu,
+        const int vals) {
+    if constexpr (sizeof(acc_T) == 4) {
+        return (acc_T)((uint32_t)accu + (uint32_t)mli_math_dotprod_acc32_v<l_T, r_T>(l, r, vals));
+    } else {
+        return accu + (acc_T)mli_math_dotprod_acc64_v(l, r, vals);
+    }
+}
+
+// Contiguous left operand, arbitrary step for the right one.
+template <typename l_T, typename r_T, typename acc_T>
+static MLI_FORCE_INLINE acc_T dotprod_packed(
+        const MLI_PTR(l_T) __restrict l,
+        const MLI_PTR(r_T) __restrict r,
+        acc_T accu,
+        const int vals,
+        const int r_step) {
+    if (r_step == 1) {
+        return dotprod_contiguous<l_T, r_T, acc_T>(l, r, accu, vals);
+    }
+    r_T block[kDotprodPackBlock];
+    for (int base = 0; base < vals; base += kDotprodPackBlock) {
+        const int len = mli_math_min_fx(kDotprodPackBlock, vals - base);
+        for (int idx = 0; idx < len; idx++) {
+            block[idx] = r[idx * r_step];
+        }
+        accu = dotprod_contiguous<l_T, r_T, acc_T>(l, block, accu, len);
+        l += len;
+        r += len * r_step;
+    }
+    return accu;
+}
+
+template <typename io_T, typename w_T, typename acc_T>
+static MLI_FORCE_INLINE acc_T dotprod1D(
+        const MLI_PTR(io_T) __restrict in,
+        const MLI_PTR(w_T)  __restrict krn,
+        acc_T accu,
+        const int vals,
+        const int in_step,
+        const int krn_step) {
+    if constexpr (dotprod_v_supported<io_T, w_T, acc_T>::value) {
+        if (in_step == 1) {
+            return dotprod_packed<io_T, w_T, acc_T>(in, krn, accu, vals, krn_step);
+        } else if (krn_step == 1) {
+            return dotprod_packed<w_T, io_T, acc_T>(krn, in, accu, vals, in_step);
+        }
+    }
+    return mli::krn::ref::dotprod1D(in, krn, accu, vals, in_step, krn_step);
+}
+
+template < typename in_T, typename w_T, typename acc_T >
+static MLI_FORCE_INLINE acc_T dotprod3D (
+        const MLI_PTR (in_T) __restrict in,
+        const MLI_PTR (w_T) __restrict krn,
+        const int width,
+        const int height,
+        const int channels,
+        int in_col_step,
+        int in_row_step,
+        int in_ch_step,
+        int kern_col_step,
+        int kern_row_step,
+        int kern_ch_step,
+        acc_T accu) {
+    // Channels are innermost in memory for HWC data. Integer accumulation is
+    // order independent, so the loops are swapped to run the vector dot
+    // product along channels.
+    if constexpr (dotprod_v_supported<in_T, w_T, acc_T>::value) {
+        if (in_ch_step == 1 && channels > 1) {
+            for (int row = 0; row < height; row++) {
+                for (int clmn = 0; clmn < width; clmn++) {
+                    accu = dotprod_packed<in_T, w_T, acc_T>(
+                            in + row * in_row_step + clmn * in_col_step,
+                            krn + row * kern_row_step + clmn * kern_col_step,
+                            accu, channels, kern_ch_step);
+                }
+            }
+            return accu;
+        }
+    }
+    return mli::krn::ref::dotprod3D(in, krn, width, height, channels,
+                                    in_col_step, in_row_step, in_ch_step,
+                                    kern_col_step, kern_row_step, kern_ch_step, accu);
+}
+
+template < typename in_T, typename w_T, typename acc_T >
+static MLI_FORCE_INLINE void dotprod3D (
+        const MLI_PTR (in_T) __restrict in,
+        const MLI_PTR (w_T) __restrict krn,
+        const int width,
+        const int height,
+        const int channels,
+        int in_col_step,
+        int in_row_step,
+        int in_ch_step,
+        int kern_col_step,
+        int kern_row_step,
+        int kern_ch_step,
+        acc_T * accu) {
+    *accu = dotprod3D(in, krn, width, height, channels,
+                      in_col_step, in_row_step, in_ch_step,
+                      kern_col_step, kern_row_step, kern_ch_step, *accu);
+}
+
+} // namespace host_simd
+} // namespace krn
+} // namespace mli
+
+#endif // _MLI_KRN_DOTPROD_HOST_SIMD_H_
@@ -0,0 +1,326 @@
+/*
+* Copyright 2022, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+
+#ifndef _MLI_KRN_GEMM_REF_H_
+#define _MLI_KRN_GEMM_REF_H_
+
+#include "mli_debug.h"
+#include "mli_math_macros.h"
+#include "mli_mem_info.h"
+
+namespace mli {
+namespace krn {
+namespace ref {
+
+template <typename T>
+static MLI_FORCE_INLINE void gemm_pack(
+        const gemm_strided_src_t<T> &src,
+        const int row0,
+        const int k0,
+        const int rows,
+        const int depth,
+        const int panel,
+        int16_t* __restrict dst) {
+    for (int r = 0; r < rows; r++) {
+        const MLI_PTR(T) src_ptr = src.ptr + (row0 + r) * src.row_mem_stride + k0 * src.depth_mem_stride;
+        int16_t* __restrict dst_ptr = dst + (r / panel) * depth * panel + r % panel;
+        for (int kk = 0; kk < depth; kk++) {
+            dst_ptr[kk * panel] = static_cast<int16_t>(src_ptr[kk * src.depth_mem_stride] - src.zero_point);
+        }
+    }
+}
+
+template <typename T>
+static MLI_FORCE_INLINE void gemm_pack_raw(
+        const gemm_strided_src_t<T> &src,
+        const int row0,
+        const int k0,
+        const int rows,
+        const int depth,
+        const int panel,
+        int16_t* __restrict dst,
+        int32_t* __restrict sums) {
+    static_assert(sizeof(T) <= sizeof(int16_t), "Source values must fit into packed panels");
+    for (int r = 0; r < rows; r++) {
+        const MLI_PTR(T) src_ptr = src.ptr + (row0 + r) * src.row_mem_stride + k0 * src.depth_mem_stride;
+        int16_t* __restrict dst_ptr = dst + (r / panel) * depth * panel + r % panel;
+        int32_t sum = 0;
+        for (int kk = 0; kk < depth; kk++) {
+            const int16_t val = static_cast<int16_t>(src_ptr[kk * src.depth_mem_stride]);
+            dst_ptr[kk * panel] = val;
+            sum += val;
+        }
+        sums[r] = sum;
+    }
+}
+
+template <typename T>
+static MLI_FORCE_INLINE void gemm_store(
+        const gemm_strided_dst_t<T> &dst,
+        const int m0,
+        const int n0,
+        const int rows,
+        const int cols,
+        const int32_t acc[kGemmMR][kGemmNR],
+        const bool accumulate) {
+    // Partial sums of depth blocks are added with wrap-around, like the sums inside a block
+    for (int r = 0; r < rows; r++) {
+        MLI_CONV_OUT_PTR(T) out_ptr = dst.ptr + (m0 + r) * dst.row_mem_stride + n0 * dst.col_mem_stride;
+        for (int c = 0; c < cols; c++) {
+            const uint32_t prev = accumulate ? static_cast<uint32_t>(out_ptr[c * dst.col_mem_stride]) : 0;
+            out_ptr[c * dst.col_mem_stride] = static_cast<T>(static_cast<int32_t>(prev + static_cast<uint32_t>(acc[r][c])));
+        }
+    }
+}
+
+// Zero filling of the unused rows of the last panel, so the micro-kernel can always
+// process the full register block.
+static MLI_FORCE_INLINE void gemm_pad_panel(
+        int16_t* __restrict dst,
+        const int rows,
+        const int depth,
+        const int panel) {
+    const int used = rows % panel;
+    if (used == 0)
+        return;
+    int16_t* __restrict dst_ptr = dst + (rows / panel) * depth * panel;
+    for (int kk = 0; kk < depth; kk++) {
+        for (int r = used; r < panel; r++) {
+            dst_ptr[kk * panel + r] = 0;
+        }
+    }
+}
+
+template <int rows_num>
+static MLI_FORCE_INLINE void gemm_micro_kernel(
+        const int16_t* __restrict a_panel,
+        const int16_t* __restrict b_panel,
+        const int depth,
+        int32_t acc[kGemmMR][kGemmNR]) {
+    static_assert(rows_num <= kGemmMR, "Micro-kernel block exceeds accumulators");
+    // A product of two int16 values always fits into int32, but their sum may not
+    // (i.e. raw sources of gemm_zp_folded()). Sums are accumulated with 32-bit wrap-around,
+    // so the result is exact whenever the final value fits into int32.
+    uint32_t acc_blk[rows_num][kGemmNR] = {{0}};
+    for (int kk = 0; kk < depth; kk++) {
+        for (int r = 0; r < rows_num; r++) {
+            const int32_t a_val = a_panel[kk * kGemmMR + r];
+            for (int c = 0; c < kGemmNR; c++) {
+                acc_blk[r][c] += static_cast<uint32_t>(a_val * b_panel[kk * kGemmNR + c]);
+            }
+        }
+    }
+    for (int r = 0; r < rows_num; r++) {
+        for (int c = 0; c < kGemmNR; c++) {
+            acc[r][c] = static_cast<int32_t>(acc_blk[r][c]);
+        }
+    }
+}
+
+static MLI_FORCE_INLINE void gemm_micro_kernel_tail(
+        const int16_t* __restrict a_panel,
+        const int16_t* __restrict b_panel,
+        const int depth,
+        const int rows,
+        int32_t acc[kGemmMR][kGemmNR]) {
+    // Only a few rows are left (i.e. FullyConnected with a single input vector),
+    // so the unused rows of the register block are not computed at all.
+    switch (rows) {
+    case 1:
+        gemm_micro_kernel<1>(a_panel, b_panel, depth, acc);
+        break;
+    case 2:
+        gemm_micro_kernel<2>(a_panel, b_panel, depth, acc);
+        break;
+    case 3:
+        gemm_micro_kernel<3>(a_panel, b_panel, depth, acc);
+        break;
+    default:
+        gemm_micro_kernel<kGemmMR>(a_panel, b_panel, depth, acc);
+        break;
+    }
+}
+
+//=========================================================================
+// Blocked GEMM: C[M x N] = (A[M x K] - a_zp) * (B[K x N] - b_zp)
+//=========================================================================
+// A block of MC rows and KC depth is packed once and reused for all B panels,
+// while each B panel of NR columns is reused for all MR slices of the A block.
+// Sources are packed into centered int16 values through gemm_pack() overloads,
+// which allows implicit im2col for convolutions without an intermediate matrix.
+// The result is written through gemm_store() overloads, so any output layout
+// can be used. Values are accumulated in 32 bits.
+template <typename a_src_T, typename b_src_T, typename c_dst_T>
+static MLI_FORCE_INLINE void gemm(
+        const a_src_T &a,
+        const b_src_T &b,
+        const c_dst_T &c,
+        const int m,
+        const int n,
+        const int k) {
+    int16_t a_block[kGemmMC * kGemmKC];
+    int16_t b_panel[kGemmNR * kGemmKC];
+
+    for (int m0 = 0; m0 < m; m0 += kGemmMC) {
+        const int mc = MIN(kGemmMC, m - m0);
+        for (int k0 = 0; k0 < k; k0 += kGemmKC) {
+            const int kc = MIN(kGemmKC, k - k0);
+            gemm_pack(a, m0, k0, mc, kc, kGemmMR, a_block);
+
+            for (int n0 = 0; n0 < n; n0 += kGemmNR) {
+                const int nc = MIN(kGemmNR, n - n0);
+                gemm_pack(b, n0, k0, nc, kc, kGemmNR, b_panel);
+                gemm_pad_panel(b_panel, nc, kc, kGemmNR);
+
+                for (int mr0 = 0; mr0 < mc; mr0 += kGemmMR) {
+                    const int mr = MIN(kGemmMR, mc - mr0);
+                    int32_t acc[kGemmMR][kGemmNR];
+                    if (mr == kGemmMR) {
+                        gemm_micro_kernel<kGemmMR>(&a_block[mr0 * kc], b_panel, kc, acc);
+                    } else {
+                        gemm_micro_kernel_tail(&a_block[mr0 * kc], b_panel, kc, mr, acc);
+                    }
+                    gemm_store(c, m0 + mr0, n0, mr, nc, acc, k0 > 0);
+                }
+            }
+        }
+    }
+}
+
+//=========================================================================
+// Blocked GEMM with the full depth accumulation in registers
+//=========================================================================
+// Same blocking as gemm(), but the depth loop is the innermost one, so each
+// MC x NR block of C is completely accumulated before gemm_store() is called
+// (always with accumulate == false). It allows destinations which can't keep
+// partial sums (i.e. fused requantization of the output to 8 bits). The A block
+// is packed once if the whole depth fits into KC, and for each B panel otherwise.
+template <typename a_src_T, typename b_src_T, typename c_dst_T>
+static MLI_FORCE_INLINE void gemm_full_depth(
+        const a_src_T &a,
+        const b_src_T &b,
+        const c_dst_T &c,
+        const int m,
+        const int n,
+        const int k) {
+    int16_t a_block[kGemmMC * kGemmKC];
+    int16_t b_panel[kGemmNR * kGemmKC];
+    const bool single_depth_block = k <= kGemmKC;
+
+    for (int m0 = 0; m0 < m; m0 += kGemmMC) {
+        const int mc = MIN(kGemmMC, m - m0);
+        if (single_depth_block) {
+            gemm_pack(a, m0, 0, mc, k, kGemmMR, a_block);
+        }
+
+        for (int n0 = 0; n0 < n; n0 += kGemmNR) {
+            const int nc = MIN(kGemmNR, n - n0);
+            int32_t acc_sum[kGemmMC / kGemmMR][kGemmMR][kGemmNR] = {{{0}}};
+
+            for (int k0 = 0; k0 < k; k0 += kGemmKC) {
+                const int kc = MIN(kGemmKC, k - k0);
+                if (!single_depth_block) {
+                    gemm_pack(a, m0, k0, mc, kc, kGemmMR, a_block);
+                }
+                gemm_pack(b, n0, k0, nc, kc, kGemmNR, b_panel);
+                gemm_pad_panel(b_panel, nc, kc, kGemmNR);
+
+                for (int mr0 = 0; mr0 < mc; mr0 += kGemmMR) {
+                    const int mr = MIN(kGemmMR, mc - mr0);
+                    int32_t acc[kGemmMR][kGemmNR];
+                    if (mr == kGemmMR) {
+                        gemm_micro_kernel<kGemmMR>(&a_block[mr0 * kc], b_panel, kc, acc);
+                    } else {
+                        gemm_micro_kernel_tail(&a_block[mr0 * kc], b_panel, kc, mr, acc);
+                    }
+                    int32_t (&sum)[kGemmMR][kGemmNR] = acc_sum[mr0 / kGemmMR];
+                    for (int r = 0; r < mr; r++) {
+                        for (int col = 0; col < kGemmNR; col++) {
+                            sum[r][col] += acc[r][col];
+                        }
+                    }
+                }
+            }
+
+            for (int mr0 = 0; mr0 < mc; mr0 += kGemmMR) {
+                const int mr = MIN(kGemmMR, mc - mr0);
+                gemm_store(c, m0 + mr0, n0, mr, nc, acc_sum[mr0 / kGemmMR], false);
+            }
+        }
+    }
+}
+
+//=========================================================================
+// Blocked GEMM with zero points folded out of the packed panels
+//=========================================================================
+// Same blocking as gemm(), but sources are packed as is, so 16-bit sources
+// with 16-bit zero points can't overflow the packed values. Zero points are
+// applied to each register block by the row sums of A and the column sums of B
+// of the current depth block:
+//
+//   sum((a - a_zp) * (b - b_zp)) = sum(a * b) - b_zp * sum(a) - a_zp * sum(b) + kc * a_zp * b_zp
+//
+// Sums are computed while packing, so no additional pass over the sources is needed.
+// Each term alone may exceed int32 for large sources and zero points (i.e. kc * a_zp * b_zp),
+// so sum(a * b) and all the corrections are computed with 32-bit wrap-around (uint32_t).
+// The result is exact whenever the true value fits into int32.
+template <typename a_T, typename b_T, typename c_dst_T>
+static MLI_FORCE_INLINE void gemm_zp_folded(
+        const gemm_strided_src_t<a_T> &a,
+        const gemm_strided_src_t<b_T> &b,
+        const c_dst_T &c,
+        const int m,
+        const int n,
+        const int k) {
+    int16_t a_block[kGemmMC * kGemmKC];
+    int16_t b_panel[kGemmNR * kGemmKC];
+    int32_t a_sums[kGemmMC];
+    int32_t b_sums[kGemmNR];
+    const uint32_t a_zp = static_cast<uint32_t>(a.zero_point);
+    const uint32_t b_zp = static_cast<uint32_t>(b.zero_point);
+
+    for (int m0 = 0; m0 < m; m0 += kGemmMC) {
+        const int mc = MIN(kGemmMC, m - m0);
+        for (int k0 = 0; k0 < k; k0 += kGemmKC) {
+            const int kc = MIN(kGemmKC, k - k0);
+            const uint32_t zp_term = static_cast<uint32_t>(kc) * a_zp * b_zp;
+            gemm_pack_raw(a, m0, k0, mc, kc, kGemmMR, a_block, a_sums);
+
+            for (int n0 = 0; n0 < n; n0 += kGemmNR) {
+                const int nc = MIN(kGemmNR, n - n0);
+                gemm_pack_raw(b, n0, k0, nc, kc, kGemmNR, b_panel, b_sums);
+                gemm_pad_panel(b_panel, nc, kc, kGemmNR);
+
+                for (int mr0 = 0; mr0 < mc; mr0 += kGemmMR) {
+                    const int mr = MIN(kGemmMR, mc - mr0);
+                    int32_t acc[kGemmMR][kGemmNR];
+                    if (mr == kGemmMR) {
+                        gemm_micro_kernel<kGemmMR>(&a_block[mr0 * kc], b_panel, kc, acc);
+                    } else {
+                        gemm_micro_kernel_tail(&a_block[mr0 * kc], b_panel, kc, mr, acc);
+                    }
+                    for (int r = 0; r < mr; r++) {
+                        const uint32_t row_term = zp_term - b_zp * static_cast<uint32_t>(a_sums[mr0 + r]);
+                        for (int col = 0; col < nc; col++) {
+                            const uint32_t col_term = a_zp * static_cast<uint32_t>(b_sums[col]);
+                            acc[r][col] = static_cast<int32_t>(static_cast<uint32_t>(acc[r][col]) + row_term - col_term);
+                        }
+                    }
+                    gemm_store(c, m0 + mr0, n0, mr, nc, acc, k0 > 0);
+                }
+            }
+        }
+    }
+}
+
+} // namespace ref
+} // namespace krn
+} // namespace mli
+
+#endif // _MLI_KRN_GEMM_REF_H_
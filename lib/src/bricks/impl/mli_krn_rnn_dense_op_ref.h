@@ -121,56 +121,100 @@ static inline void rnn_dense_op_stacked(
 }
 
 
+// Quantization parameters of a particular gate in stacked weights (weight_dim is reset,
+// and per-gate scales are selected in case of per-axis quantization of weights)
+template <typename quant_T>
+static inline void rnn_dense_gate_quant_params(
+        const quant_T * in_to_out_quant_params,
+        const int gate,
+        quant_T * gate_quant_params) {
+    quant_T initial_params = *in_to_out_quant_params;
+    *gate_quant_params = initial_params;
+    adjust_weights_dim_for_rnn_dense(gate_quant_params);
+    for (int idx = 0; idx < gate; ++idx) {
+        adjust_weights_scale_for_rnn_dense(gate_quant_params, &initial_params);
+    }
+}
+
+template <typename io_T, typename acc_T, typename quant_T>
+static inline void rnn_dense_op_other_additives(
+        const MLI_PTR(io_T) __restrict * inputs,
+        const int inputs_num,
+        const int * in_elements,
+        const quant_T * in_to_out_quant_params,
+        acc_T * other_additives) {
+    for (int idx = 0; idx < inputs_num; idx++) {
+        other_additives[idx] = mli_math_mul_fx<io_T, acc_T>(0, 0);
+        other_additives[idx] = mli::krn::in_additive(inputs[idx], other_additives[idx], &in_to_out_quant_params[idx],
+                                in_elements[idx], /* col_step= */ 1, /* row_step= */ 1, /* ch_step= */ 1);
+        other_additives[idx] = mli::krn::zp_additive(&in_to_out_quant_params[idx], other_additives[idx],
+                                in_elements[idx]);
+    }
+}
+
+// Single output value of the dense operation. Weights and bias pointers must point to the gate.
 template <typename io_T, typename w_T, typename b_T, typename acc_T, typename quant_T>
-static inline void rnn_dense_op(
+static MLI_FORCE_INLINE io_T rnn_dense_op_one_out(
         const MLI_PTR(io_T) __restrict * inputs,
         const MLI_PTR(w_T) __restrict * weights,
         const MLI_PTR(b_T) __restrict bias,
-        MLI_CONV_OUT_PTR(io_T) __restrict out,
+        const int o_idx,
         const int inputs_num,
         const int * in_elements,
-        const int out_elements,
         const int * w_ch_out_mem_strides,
         quant_T * in_to_out_quant_params,
+        const acc_T * other_additives,
         const io_T val_min_limit,
         const io_T val_max_limit) {
 
-    acc_T other_additives[MLI_RNN_MAX_INPUT];
+    acc_T accu = mli_math_mul_fx<io_T, acc_T>(0, 0);
+    acc_T acc_ir = mli_math_mul_fx<io_T, acc_T>(0, 0);
+    acc_T acc_res_ir = mli_math_mul_fx<io_T, acc_T>(0, 0);
 
-    for (int idx = 0; idx < inputs_num; idx++) {
-        other_additives[idx] = mli_math_mul_fx<io_T, acc_T>(0, 0);
-        other_additives[idx] = mli::krn::in_additive(inputs[idx], other_additives[idx], &in_to_out_quant_params[idx],
-                                in_elements[idx], /* col_step= */ 1, /* row_step= */ 1, /* ch_step= */ 1);
-        other_additives[idx] = mli::krn::zp_additive(&in_to_out_quant_params[idx], other_additives[idx],
-                                in_elements[idx]);
-    }
+    accu = mli::krn::bias_additive(&bias[o_idx], accu, &in_to_out_quant_params[0]);
 
-    for (int o_idx = 0; o_idx < out_elements; o_idx++) {
+    for(int idx = 0; idx < inputs_num; idx++) {
+        mli::krn::ref::adjust_quant_params(&in_to_out_quant_params[idx], /* krn_idx= */ 0);
 
-        acc_T accu = mli_math_mul_fx<io_T, acc_T>(0, 0);
-        acc_T acc_ir = mli_math_mul_fx<io_T, acc_T>(0, 0);
-        acc_T acc_res_ir = mli_math_mul_fx<io_T, acc_T>(0, 0);
+        accu = dotprod1D(inputs[idx], &weights[idx][o_idx], accu, in_elements[idx],
+                     1, w_ch_out_mem_strides[idx]);
 
-        accu = mli::krn::bias_additive(&bias[o_idx], accu, &in_to_out_quant_params[0]);
+        accu = mli::krn::ref::weights_additive(&weights[idx][o_idx], accu, &in_to_out_quant_params[idx],
+                in_elements[idx], /* height= */ 1, /* ch= */ 1, w_ch_out_mem_strides[idx],
+                /* row_step= */ 1, /* ch_step= */ 1);
+        accu = mli_math_add_fx(accu, other_additives[idx]);
 
-        for(int idx = 0; idx < inputs_num; idx++) {
-            mli::krn::ref::adjust_quant_params(&in_to_out_quant_params[idx], /* krn_idx= */ 0);
+        acc_ir = mli::krn::ir_rnn_result_requantize<acc_T>(accu, &in_to_out_quant_params[idx]);
+        acc_res_ir = mli_math_add_fx(acc_res_ir, acc_ir);
+        accu = mli_math_mul_fx<io_T, acc_T>(0, 0);
+    }
 
-            accu = dotprod1D(inputs[idx], &weights[idx][o_idx], accu, in_elements[idx],
-                         1, w_ch_out_mem_strides[idx]);
+    return mli::krn::ir_result_cast_relu_store<io_T, acc_T, quant_T>(acc_res_ir,
+            &in_to_out_quant_params[inputs_num - 1], val_min_limit, val_max_limit);
+}
 
-            accu = mli::krn::ref::weights_additive(&weights[idx][o_idx], accu, &in_to_out_quant_params[idx],
-                    in_elements[idx], /* height= */ 1, /* ch= */ 1, w_ch_out_mem_strides[idx],
-                    /* row_step= */ 1, /* ch_step= */ 1);
-            accu = mli_math_add_fx(accu, other_additives[idx]);
+template <typename io_T, typename w_T, typename b_T, typename acc_T, typename quant_T>
+static inline void rnn_dense_op(
+        const MLI_PTR(io_T) __restrict * inputs,
+        const MLI_PTR(w_T) __restrict * weights,
+        const MLI_PTR(b_T) __restrict bias,
+        MLI_CONV_OUT_PTR(io_T) __restrict out,
+        const int inputs_num,
+        const int * in_elements,
+        const int out_elements,
+        const int * w_ch_out_mem_strides,
+        quant_T * in_to_out_quant_params,
+        const io_T val_min_limit,
+        const io_T val_max_limit) {
 
-            acc_ir = mli::krn::ir_rnn_result_requantize<acc_T>(accu, &in_to_out_quant_params[idx]);
-            acc_res_ir = mli_math_add_fx(acc_res_ir, acc_ir);
-            accu = mli_math_mul_fx<io_T, acc_T>(0, 0);
-        }
+    acc_T other_additives[MLI_RNN_MAX_INPUT];
+    rnn_dense_op_other_additives<io_T, acc_T, quant_T>(inputs, inputs_num, in_elements,
+                                                       in_to_out_quant_params, other_additives);
 
-        out[o_idx] = mli::krn::ir_result_cast_relu_store<io_T, acc_T, quant_T>(acc_res_ir,
-        		&in_to_out_quant_params[inputs_num - 1], val_min_limit, val_max_limit);
+    for (int o_idx = 0; o_idx < out_elements; o_idx++) {
+        out[o_idx] = rnn_dense_op_one_out<io_T, w_T, b_T, acc_T, quant_T>(
+                inputs, weights, bias, o_idx, inputs_num, in_elements, w_ch_out_mem_strides,
+                in_to_out_quant_params, other_additives, val_min_limit, val_max_limit);
     }
 }
 
@@ -0,0 +1,131 @@
+/*
+* Copyright 2022, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+
+#ifndef _MLI_PRV_LUT_HOST_SIMD_H_
+#define _MLI_PRV_LUT_HOST_SIMD_H_
+
+#include <type_traits>
+
+#include "mli_config.h"
+#include "mli_prv_lut_decl.h"
+#include "mli_math.h"
+#include "mli_mem_info.h"
+#include "mli_prv_load_store.h"
+#include "mli_prv_tensor.h"
+
+namespace mli {
+namespace krn {
+namespace host_simd {
+
+#if defined(MLI_HOST_VEC_AVX2)
+// Vector version of ref::activation_lut_one_elem_interpolate for FX16 data
+// without input conversion. 8 samples are processed in 32-bit lanes.
+template <bool fx_with_in_offset>
+static MLI_FORCE_INLINE __m256i activation_lut_8x_elem_interpolate(
+        __m256i input,
+        const mli_lut *lut,
+        int preshift_in,
+        int shift_in,
+        const struct s8asym_quant_params *in_params) {
+    const int16_t *lut_data = lut->data.mem.pi16;
+    if (fx_with_in_offset) {
+        input = _mm256_sub_epi32(input, _mm256_set1_epi32(in_params->offset));
+    }
+    const __m256i x = _mm256_sra_epi32(input, _mm_cvtsi32_si128(preshift_in));
+    const __m128i shift = _mm_cvtsi32_si128(shift_in);
+    __m256i lut_idx = _mm256_add_epi32(_mm256_sra_epi32(x, shift), _mm256_set1_epi32(lut->input_offset));
+    lut_idx = _mm256_max_epi32(lut_idx, _mm256_setzero_si256());
+    lut_idx = _mm256_min_epi32(lut_idx, _mm256_set1_epi32(lut->length - 2));
+
+    // One 32-bit gather brings both lut[idx] (low half) and lut[idx + 1] (high half)
+    const __m256i pair = _mm256_i32gather_epi32((const int *)lut_data, lut_idx, sizeof(int16_t));
+    const __m256i res = _mm256_srai_epi32(_mm256_slli_epi32(pair, 16), 16);
+    const __m256i next = _mm256_srai_epi32(pair, 16);
+    const __m256i frac = _mm256_and_si256(x, _mm256_set1_epi32((1 << shift_in) - 1));
+    // diff is int16 in the reference, so wrap it before the multiplication
+    __m256i diff = _mm256_sub_epi32(res, next);
+    diff = _mm256_srai_epi32(_mm256_slli_epi32(diff, 16), 16);
+    const __m256i prod = _mm256_mullo_epi32(diff, frac);
+
+    // mli_math_acc_cast_fx<int16_t, mli_acc32_t>(prod, shift_in)
+    const __m256i one = _mm256_set1_epi32(1);
+#if defined(ROUND_MODE_UP)
+    const __m256i round = _mm256_set1_epi32(1 << (shift_in - 1));
+    __m256i corr = _mm256_sra_epi32(_mm256_add_epi32(prod, round), shift);
+#elif defined(ROUND_MODE_CONVERGENT)
+    __m256i corr = _mm256_sra_epi32(prod, shift);
+    const __m256i last_deleted = _mm256_and_si256(_mm256_srl_epi32(prod, _mm_cvtsi32_si128(shift_in - 1)), one);
+    const __m256i rest_deleted = _mm256_and_si256(prod, _mm256_set1_epi32((1 << (shift_in - 1)) - 1));
+    const __m256i rest_nonzero = _mm256_andnot_si256(_mm256_cmpeq_epi32(rest_deleted, _mm256_setzero_si256()), one);
+    const __m256i odd_or_rest = _mm256_or_si256(_mm256_and_si256(corr, one), rest_nonzero);
+    corr = _mm256_add_epi32(corr, _mm256_and_si256(last_deleted, odd_or_rest));
+#else
+#error "rounding mode is not defined"
+#endif
+    corr = _mm256_max_epi32(corr, _mm256_set1_epi32(INT16_MIN));
+    corr = _mm256_min_epi32(corr, _mm256_set1_epi32(INT16_MAX));
+    return _mm256_sub_epi32(res, corr);
+}
+#endif
+
+template <typename io_T, bool convert, bool fx_with_in_offset>
+static MLI_FORCE_INLINE void compute_activation_lut(
+        const struct generic_tensor_private_t<MLI_PTR(io_T)> *in,
+        struct generic_tensor_private_t<MLI_PTR(io_T)> *out,
+        const mli_lut *lut,
+        int8_t in_frac_bits,
+        const struct s8asym_quant_params *in_params,
+        struct s8asym_quant_params *out_params) {
+#if defined(MLI_HOST_VEC_AVX2)
+    if constexpr (std::is_same<io_T, int16_t>::value && !convert) {
+        MLI_ASSERT(lut->in_frac_bits >= 0);
+        MLI_ASSERT(lut->length >= 0);
+        MLI_ASSERT(MLI_MAX_RANK == 4);
+
+        int shift_in = in_frac_bits - lut->in_frac_bits;
+        constexpr int max_shift = 15;
+        const int preshift_in = mli_math_min_fx(mli_math_max_fx(shift_in - (int)kMaxFracBitsFx16, 0), max_shift);
+        shift_in = mli_math_min_fx(shift_in, (int)kMaxFracBitsFx16);
+
+        // Only the interpolation path along a contiguous innermost dimension
+        // is vectorized. Everything else goes to the reference code.
+        if (shift_in > 0 && in->mem_stride[3] == 1 && out->mem_stride[3] == 1) {
+            const int len = in->shape[3];
+            for (int pos0 = 0; pos0 < in->shape[0]; pos0++) {
+                for (int pos1 = 0; pos1 < in->shape[1]; pos1++) {
+                    for (int pos2 = 0; pos2 < in->shape[2]; pos2++) {
+                        const MLI_PTR(int16_t) in_ptr = &in->ptr[POS(in, pos0, pos1, pos2, 0)];
+                        MLI_OUT_PTR(int16_t) out_ptr = &out->ptr[POS(out, pos0, pos1, pos2, 0)];
+                        int pos3 = 0;
+                        for (; pos3 + 8 <= len; pos3 += 8) {
+                            const __m256i res = activation_lut_8x_elem_interpolate<fx_with_in_offset>(
+                                    mli_prv_load_8x32_samples(in_ptr + pos3), lut, preshift_in, shift_in, in_params);
+                            mli_prv_store_8x32_samples(out_ptr + pos3, res);
+                        }
+                        for (; pos3 < len; pos3++) {
+                            out_ptr[pos3] = mli::krn::ref::activation_lut_one_elem_interpolate
+                                    <io_T, io_T, convert, convert, fx_with_in_offset>(
+                                    in_ptr[pos3], lut, in_frac_bits, in_params, out_params);
+                        }
+                    }
+                }
+            }
+            return;
+        }
+    }
+#endif
+    mli::krn::ref::compute_activation_lut<io_T, convert, fx_with_in_offset>(
+            in, out, lut, in_frac_bits, in_params, out_params);
+}
+
+} // namespace host_simd
+} // namespace krn
+} // namespace mli
+
+#endif // _MLI_PRV_LUT_HOST_SIMD_H_
@@ -194,6 +194,31 @@ static MLI_FORCE_INLINE out_T activation_lut_one_elem_no_interpolate(
     return out;
 }
 
+// Activation of a single value with the same choice between interpolation and direct lookup
+// as compute_activation_lut() does for a whole tensor. Used by fused kernels which apply
+// activation right after the value is calculated.
+template <typename in_T, typename out_T, bool convert_input, bool convert_output, bool fx_with_in_offset>
+static MLI_FORCE_INLINE out_T activation_lut_one_elem(
+        const in_T in,
+        const mli_lut *lut,
+        int8_t in_frac_bits,
+        const struct s8asym_quant_params *in_params,
+        struct s8asym_quant_params *out_params) {
+    int frac_bits = in_frac_bits;
+    if (convert_input) {
+        frac_bits = kMaxFracBitsFx16 - (kMaxFracBitsFx8 - lut->in_frac_bits);
+    }
+    const int shift_in = mli_math_min_fx(frac_bits - lut->in_frac_bits, (int)kMaxFracBitsFx16);
+
+    if (shift_in > 0) {
+        return activation_lut_one_elem_interpolate<in_T, out_T, convert_input, convert_output, fx_with_in_offset>(
+                in, lut, in_frac_bits, in_params, out_params);
+    } else {
+        return activation_lut_one_elem_no_interpolate<in_T, out_T, convert_input, convert_output, fx_with_in_offset>(
+                in, lut, in_frac_bits, in_params, out_params);
+    }
+}
+
 template <typename io_T, bool convert, bool fx_with_in_offset>
 static MLI_FORCE_INLINE void activation_lut(
         const struct generic_tensor_private_t<MLI_PTR(io_T)> *in,
@@ -0,0 +1,147 @@
+/*
+* Copyright 2022, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+
+#ifndef _MLI_PRV_QUANT_HOST_SIMD_H_
+#define _MLI_PRV_QUANT_HOST_SIMD_H_
+
+#include "mli_config.h"
+#include "mli_math.h"
+#include "mli_mem_info.h"
+#include "mli_prv_quant_decl.h"
+
+namespace mli {
+namespace krn {
+namespace host_simd {
+
+// The reference additives are chains of mli_math_mac_fx(acc, mul, x) with a
+// constant 16-bit mul. With 32-bit wrap-around accumulation this is equal to
+// acc + mul * sum(x), so only the sum of the samples is vectorized.
+static MLI_FORCE_INLINE mli_acc32_t mac_sum_acc32(mli_acc32_t acc, const int16_t mul, const int32_t sum) {
+    return (mli_acc32_t)((uint32_t)acc + (uint32_t)mul * (uint32_t)sum);
+}
+
+static MLI_FORCE_INLINE int32_t reduce_sum2D(
+        const MLI_PTR(int8_t) __restrict in,
+        const int width,
+        const int height,
+        const int col_step,
+        const int row_step) {
+    int32_t sum = 0;
+    for (int row = 0; row < height; row++) {
+        if (col_step == 1) {
+            sum += mli_math_reduce_sum_v(in + row * row_step, width);
+        } else {
+            for (int clmn = 0; clmn < width; clmn++) {
+                sum += in[row * row_step + clmn * col_step];
+            }
+        }
+    }
+    return sum;
+}
+
+//==========================================================================
+// Calculation of input additive (in_add) in
+// dot_prod_asym = dot_prod_gen + w_add + in_add + zp_add + bias_add
+//==========================================================================
+template <typename in_T, typename acc_T, typename quant_T>
+MLI_FORCE_INLINE acc_T in_additive(const MLI_PTR(in_T) __restrict in, acc_T init_accum, const quant_T* quant_params,
+                              const int width, const int height, int col_step, int row_step) {
+    return mli::krn::ref::in_additive(in, init_accum, quant_params, width, height, col_step, row_step);
+}
+
+template <>
+MLI_FORCE_INLINE mli_acc32_t in_additive(
+        const MLI_PTR(int8_t) __restrict in, mli_acc32_t init_accum,
+        const s8asym_quant_specific_params* quant_params,
+        const int width, const int height, int col_step, int row_step) {
+    // returns -(wights_zero_point * cumsum(input)) For S8ASYM
+    if (quant_params->weights_offset != 0) {
+        return mac_sum_acc32(init_accum, -quant_params->weights_offset,
+                             reduce_sum2D(in, width, height, col_step, row_step));
+    } else {
+        return init_accum;
+    }
+}
+
+template <>
+MLI_FORCE_INLINE mli_acc32_t in_additive(
+        const MLI_PTR(int8_t) __restrict in, mli_acc32_t init_accum,
+        const int_quant_specific_params* quant_params,
+        const int width, const int height, int col_step, int row_step) {
+    // returns -(wights_zero_point * cumsum(input))
+    if (quant_params->weights_offset != 0) {
+        return mac_sum_acc32(init_accum, -quant_params->weights_offset,
+                             reduce_sum2D(in, width, height, col_step, row_step));
+    } else {
+        return init_accum;
+    }
+}
+
+template <typename in_T, typename acc_T, typename quant_T>
+MLI_FORCE_INLINE acc_T in_additive(const MLI_PTR(in_T) __restrict in, acc_T init_accum, const quant_T* quant_params,
+                              const int width, const int height, const int ch, int col_step, int row_step, int ch_step) {
+    return mli::krn::ref::in_additive(in, init_accum, quant_params, width, height, ch, col_step, row_step, ch_step);
+}
+
+template <>
+MLI_FORCE_INLINE mli_acc32_t in_additive(
+        const MLI_PTR(int8_t) __restrict in, mli_acc32_t init_accum,
+        const s8asym_quant_specific_params* quant_params,
+        const int width, const int height, const int ch, int col_step, int row_step, int ch_step) {
+    // returns -(wights_zero_point * cumsum(input)) For S8ASYM
+    if (quant_params->weights_offset != 0) {
+        int32_t sum = 0;
+        if (ch_step == 1) {
+            // HWC layout: channels are contiguous, so sum them first
+            for (int row = 0; row < height; row++) {
+                for (int clmn = 0; clmn < width; clmn++) {
+                    sum += mli_math_reduce_sum_v(in + row * row_step + clmn * col_step, ch);
+                }
+            }
+        } else {
+            for (int c = 0; c < ch; c++) {
+                sum += reduce_sum2D(in + c * ch_step, width, height, col_step, row_step);
+            }
+        }
+        return mac_sum_acc32(init_accum, -quant_params->weights_offset, sum);
+    } else {
+        return init_accum;
+    }
+}
+
+//==========================================================================
+// Calculation of zero points additive (zp_add) in
+// dot_prod_asym = dot_prod_gen + w_add + in_add + zp_add + bias_add
+//==========================================================================
+template <typename acc_T, typename quant_T>
+MLI_FORCE_INLINE acc_T zp_additive(const quant_T* quant_params, acc_T init_accum,
+                        const int mac_serias_len) {
+    return mli::krn::ref::zp_additive(quant_params, init_accum, mac_serias_len);
+}
+
+template <>
+MLI_FORCE_INLINE mli_acc32_t zp_additive(const s8asym_quant_specific_params* quant_params, mli_acc32_t init_accum,
+                               const int mac_serias_len) {
+    // w_zp * in_zp * mac_serias_len in closed form instead of the reduce sum
+    const int32_t zp_mul = (int32_t)quant_params->weights_offset * (int32_t)quant_params->in_offset;
+    return (mli_acc32_t)((uint32_t)init_accum + (uint32_t)zp_mul * (uint32_t)mac_serias_len);
+}
+
+template <>
+MLI_FORCE_INLINE mli_acc32_t zp_additive(const int_quant_specific_params* quant_params, mli_acc32_t init_accum,
+                               const int mac_serias_len) {
+    const int32_t zp_mul = (int32_t)quant_params->weights_offset * (int32_t)quant_params->in_offset;
+    return (mli_acc32_t)((uint32_t)init_accum + (uint32_t)zp_mul * (uint32_t)mac_serias_len);
+}
+
+} // namespace host_simd
+} // namespace krn
+} // namespace mli
+
+#endif // _MLI_PRV_QUANT_HOST_SIMD_H_
@@ -51,6 +51,11 @@ using mli::krn::dsp::dotprod3D_v_simple;
 using mli::krn::dsp::dotprod2D_inp_width_v;
 using mli::krn::ref::dotprod3D;
 
+#elif !defined(MLI_BUILD_REFERENCE) && defined(MLI_BUILD_HOST_SIMD)
+using mli::krn::host_simd::dotprod1D;
+using mli::krn::ref::dotprod2D;
+using mli::krn::host_simd::dotprod3D;
+
 #else
 using mli::krn::ref::dotprod1D;
 using mli::krn::ref::dotprod2D;
@@ -76,4 +81,8 @@ using mli::krn::ref::dotprod3D;
 #include "impl/mli_krn_dotprod_dsp.h"
 #endif
 
+#if !defined(MLI_BUILD_REFERENCE) && defined(MLI_BUILD_HOST_SIMD)
+#include "impl/mli_krn_dotprod_host_simd.h"
+#endif
+
 #endif // _MLI_KRN_DOTPROD_H_
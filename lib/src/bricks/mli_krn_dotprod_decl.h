@@ -350,6 +350,52 @@ static MLI_FORCE_INLINE accgrp_T dotprod3D_v_nopad_unroll (
 
 } // namespace vdsp
 
+////////////////////////////////////////////////////////////////////////////////
+// HOST_SIMD
+////////////////////////////////////////////////////////////////////////////////
+namespace host_simd {
+
+template <typename io_T, typename w_T, typename acc_T>
+static MLI_FORCE_INLINE acc_T dotprod1D(
+        const MLI_PTR(io_T) __restrict in,
+        const MLI_PTR(w_T)  __restrict krn,
+        acc_T accu,
+        const int vals,
+        const int in_step = 1,
+        const int krn_step = 1);
+
+template < typename in_T, typename w_T, typename acc_T >
+static MLI_FORCE_INLINE void dotprod3D (
+        const MLI_PTR (in_T) __restrict in,
+        const MLI_PTR (w_T) __restrict krn,
+        const int width,
+        const int height,
+        const int channels,
+        int in_col_step,
+        int in_row_step,
+        int in_ch_step,
+        int kern_col_step,
+        int kern_row_step,
+        int kern_ch_step,
+        acc_T * accu);
+
+template < typename in_T, typename w_T, typename acc_T >
+static MLI_FORCE_INLINE acc_T dotprod3D (
+        const MLI_PTR (in_T) __restrict in,
+        const MLI_PTR (w_T) __restrict krn,
+        const int width,
+        const int height,
+        const int channels,
+        int in_col_step,
+        int in_row_step,
+        int in_ch_step,
+        int kern_col_step,
+        int kern_row_step,
+        int kern_ch_step,
+        acc_T accu);
+
+} // namespace host_simd
+
 } // namespace krn
 } // namespace mli
 
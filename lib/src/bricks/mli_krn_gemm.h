@@ -0,0 +1,52 @@
+/*
+* Copyright 2022, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+
+#ifndef _MLI_KRN_GEMM_H_
+#define _MLI_KRN_GEMM_H_
+
+#include "mli_krn_gemm_decl.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Setting up namespace
+////////////////////////////////////////////////////////////////////////////////
+// Selecting between different variants (depending on hardware features) is
+// done with 'using'. A completely different implementation can be used/'using'.
+// However, also only a part of the reference together with optimized functions
+// (from example *_dsp) can be used/'using'.
+
+namespace mli {
+namespace krn {
+#if !defined(MLI_BUILD_REFERENCE) && defined(__Xvec_width)
+using mli::krn::ref::gemm;
+using mli::krn::ref::gemm_full_depth;
+using mli::krn::ref::gemm_zp_folded;
+
+#elif !defined(MLI_BUILD_REFERENCE) && defined(__FXAPI__)
+using mli::krn::ref::gemm;
+using mli::krn::ref::gemm_full_depth;
+using mli::krn::ref::gemm_zp_folded;
+
+#else
+using mli::krn::ref::gemm;
+using mli::krn::ref::gemm_full_depth;
+using mli::krn::ref::gemm_zp_folded;
+
+#endif
+} // namespace krn
+} // namespace mli
+
+////////////////////////////////////////////////////////////////////////////////
+// Include implementation
+////////////////////////////////////////////////////////////////////////////////
+// The reference (*_ref.h) implementation can run on all platforms and is always
+// included. Other variants are included based on capabilities. Implementations
+// below can depend on each other through declarations in *_decl.h.
+#include "impl/mli_krn_gemm_ref.h"
+
+#endif // _MLI_KRN_GEMM_H_
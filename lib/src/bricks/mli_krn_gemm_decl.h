@@ -0,0 +1,144 @@
+/*
+* Copyright 2022, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+
+#ifndef _MLI_KRN_GEMM_DECL_H_
+#define _MLI_KRN_GEMM_DECL_H_
+
+#include "mli_config.h"
+#include "mli_mem_info.h"
+#include "mli_types.h"
+
+namespace mli {
+namespace krn {
+////////////////////////////////////////////////////////////////////////////////
+// Functions (in *_ref/*_dsp/*vdsp) that can be called from outside their own
+// file must be declared here. This includes all overloads. For example, if we
+// have: io_T f(io_T a) and int8_t f(int8_t a), then both must be declared.
+// Not doing so, can cause the compiler to use the wrong overload.
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// REF
+////////////////////////////////////////////////////////////////////////////////
+namespace ref {
+
+// Blocking of the GEMM engine: C[M x N] = (A[M x K] - a_zp) * (B[K x N] - b_zp)
+//   MR x NR - register block (accumulators) of the micro-kernel
+//   KC      - depth of the packed panels (inner dimension block)
+//   MC      - number of A rows packed at once and reused for all B panels
+// Packed panels and the accumulators are on the stack: (MC + NR) * KC * 2 bytes.
+constexpr int kGemmMR = 4;
+constexpr int kGemmNR = 8;
+constexpr int kGemmKC = 64;
+constexpr int kGemmMC = 16;
+
+// Source matrix with arbitrary memory strides. Element (row, k) is located at
+// ptr[row * row_mem_stride + k * depth_mem_stride]. For the B operand row is the
+// column of the matrix (output channel) and k is the row.
+template <typename T>
+struct gemm_strided_src_t {
+    const MLI_PTR(T) ptr;
+    int row_mem_stride;
+    int depth_mem_stride;
+    int16_t zero_point;
+};
+
+// Destination matrix with arbitrary memory strides.
+template <typename T>
+struct gemm_strided_dst_t {
+    MLI_CONV_OUT_PTR(T) ptr;
+    int row_mem_stride;
+    int col_mem_stride;
+};
+
+// Packing of [rows x depth] block starting from (row0, k0) into panels of 'panel' rows.
+// Element (r, kk) of the block is stored to dst[(r / panel) * depth * panel + kk * panel + r % panel]
+// with zero point already subtracted. Other sources (i.e. implicit im2col) provide their own overload.
+template <typename T>
+static MLI_FORCE_INLINE void gemm_pack(
+        const gemm_strided_src_t<T> &src,
+        const int row0,
+        const int k0,
+        const int rows,
+        const int depth,
+        const int panel,
+        int16_t* __restrict dst);
+
+// Packing of [rows x depth] block in the same way as gemm_pack(), but without zero point
+// subtraction. Sum of each packed row is stored to sums[r].
+template <typename T>
+static MLI_FORCE_INLINE void gemm_pack_raw(
+        const gemm_strided_src_t<T> &src,
+        const int row0,
+        const int k0,
+        const int rows,
+        const int depth,
+        const int panel,
+        int16_t* __restrict dst,
+        int32_t* __restrict sums);
+
+// Storing of [rows x cols] accumulators block to (m0, n0). Partial results of the
+// previous depth blocks are accumulated if requested.
+template <typename T>
+static MLI_FORCE_INLINE void gemm_store(
+        const gemm_strided_dst_t<T> &dst,
+        const int m0,
+        const int n0,
+        const int rows,
+        const int cols,
+        const int32_t acc[kGemmMR][kGemmNR],
+        const bool accumulate);
+
+template <int rows_num>
+static MLI_FORCE_INLINE void gemm_micro_kernel(
+        const int16_t* __restrict a_panel,
+        const int16_t* __restrict b_panel,
+        const int depth,
+        int32_t acc[kGemmMR][kGemmNR]);
+
+static MLI_FORCE_INLINE void gemm_micro_kernel_tail(
+        const int16_t* __restrict a_panel,
+        const int16_t* __restrict b_panel,
+        const int depth,
+        const int rows,
+        int32_t acc[kGemmMR][kGemmNR]);
+
+template <typename a_src_T, typename b_src_T, typename c_dst_T>
+static MLI_FORCE_INLINE void gemm(
+        const a_src_T &a,
+        const b_src_T &b,
+        const c_dst_T &c,
+        const int m,
+        const int n,
+        const int k);
+
+template <typename a_src_T, typename b_src_T, typename c_dst_T>
+static MLI_FORCE_INLINE void gemm_full_depth(
+        const a_src_T &a,
+        const b_src_T &b,
+        const c_dst_T &c,
+        const int m,
+        const int n,
+        const int k);
+
+template <typename a_T, typename b_T, typename c_dst_T>
+static MLI_FORCE_INLINE void gemm_zp_folded(
+        const gemm_strided_src_t<a_T> &a,
+        const gemm_strided_src_t<b_T> &b,
+        const c_dst_T &c,
+        const int m,
+        const int n,
+        const int k);
+
+} // namespace ref
+
+} // namespace krn
+} // namespace mli
+
+#endif // _MLI_KRN_GEMM_DECL_H_
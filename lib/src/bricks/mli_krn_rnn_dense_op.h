@@ -25,14 +25,23 @@ namespace krn {
 #if !defined(MLI_BUILD_REFERENCE) && defined(__Xvec_width)
 using mli::krn::vdsp::rnn_dense_op;
 using mli::krn::vdsp::rnn_dense_op_stacked;
+using mli::krn::ref::rnn_dense_gate_quant_params;
+using mli::krn::ref::rnn_dense_op_other_additives;
+using mli::krn::ref::rnn_dense_op_one_out;
 
 #elif !defined(MLI_BUILD_REFERENCE) && defined(__FXAPI__)
 using mli::krn::ref::rnn_dense_op;
 using mli::krn::ref::rnn_dense_op_stacked;
+using mli::krn::ref::rnn_dense_gate_quant_params;
+using mli::krn::ref::rnn_dense_op_other_additives;
+using mli::krn::ref::rnn_dense_op_one_out;
 
 #else
 using mli::krn::ref::rnn_dense_op;
 using mli::krn::ref::rnn_dense_op_stacked;
+using mli::krn::ref::rnn_dense_gate_quant_params;
+using mli::krn::ref::rnn_dense_op_other_additives;
+using mli::krn::ref::rnn_dense_op_one_out;
 
 #endif
 } // namespace krn
@@ -57,6 +57,34 @@ static MLI_FORCE_INLINE void rnn_dense_op_stacked(
         const int * w_gate_mem_strides,
         mli_tensor * out);
 
+template <typename quant_T>
+static MLI_FORCE_INLINE void rnn_dense_gate_quant_params(
+        const quant_T * in_to_out_quant_params,
+        const int gate,
+        quant_T * gate_quant_params);
+
+template <typename io_T, typename acc_T, typename quant_T>
+static MLI_FORCE_INLINE void rnn_dense_op_other_additives(
+        const MLI_PTR(io_T) __restrict * inputs,
+        const int inputs_num,
+        const int * in_elements,
+        const quant_T * in_to_out_quant_params,
+        acc_T * other_additives);
+
+template <typename io_T, typename w_T, typename b_T, typename acc_T, typename quant_T>
+static MLI_FORCE_INLINE io_T rnn_dense_op_one_out(
+        const MLI_PTR(io_T) __restrict * inputs,
+        const MLI_PTR(w_T) __restrict * weights,
+        const MLI_PTR(b_T) __restrict bias,
+        const int o_idx,
+        const int inputs_num,
+        const int * in_elements,
+        const int * w_ch_out_mem_strides,
+        quant_T * in_to_out_quant_params,
+        const acc_T * other_additives,
+        const io_T val_min_limit,
+        const io_T val_max_limit);
+
 } // namespace ref
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -30,6 +30,7 @@ using mli::krn::vdsp::activation_lut_vec_elem_no_interpolate;
 using mli::krn::ref::activation_lut;
 using mli::krn::ref::activation_lut_one_elem_interpolate;
 using mli::krn::ref::activation_lut_one_elem_no_interpolate;
+using mli::krn::ref::activation_lut_one_elem;
 
 #elif !defined(MLI_BUILD_REFERENCE) && defined(__FXAPI__)
 using mli::krn::dsp::compute_activation_lut;
@@ -38,12 +39,21 @@ using mli::krn::dsp::activation_lut_two_elem_no_interpolate;
 using mli::krn::ref::activation_lut;
 using mli::krn::ref::activation_lut_one_elem_interpolate;
 using mli::krn::ref::activation_lut_one_elem_no_interpolate;
+using mli::krn::ref::activation_lut_one_elem;
+
+#elif !defined(MLI_BUILD_REFERENCE) && defined(MLI_BUILD_HOST_SIMD)
+using mli::krn::ref::activation_lut;
+using mli::krn::host_simd::compute_activation_lut;
+using mli::krn::ref::activation_lut_one_elem_interpolate;
+using mli::krn::ref::activation_lut_one_elem_no_interpolate;
+using mli::krn::ref::activation_lut_one_elem;
 
 #else
 using mli::krn::ref::activation_lut;
 using mli::krn::ref::compute_activation_lut;
 using mli::krn::ref::activation_lut_one_elem_interpolate;
 using mli::krn::ref::activation_lut_one_elem_no_interpolate;
+using mli::krn::ref::activation_lut_one_elem;
 
 #endif
 } // krn
@@ -66,4 +76,8 @@ using mli::krn::ref::activation_lut_one_elem_no_interpolate;
 #include "impl/mli_prv_lut_dsp.h"
 #endif
 
+#if !defined(MLI_BUILD_REFERENCE) && defined(MLI_BUILD_HOST_SIMD)
+#include "impl/mli_prv_lut_host_simd.h"
+#endif
+
 #endif  //_MLI_PRIVATE_LUT_H_
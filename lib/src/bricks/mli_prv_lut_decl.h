@@ -79,6 +79,14 @@ static MLI_FORCE_INLINE out_T activation_lut_one_elem_no_interpolate(
         const struct s8asym_quant_params *in_params = nullptr,
         struct s8asym_quant_params *out_params = nullptr);
 
+template <typename in_T, typename out_T, bool convert_input, bool convert_output, bool fx_with_in_offset = false>
+static MLI_FORCE_INLINE out_T activation_lut_one_elem(
+        const in_T in,
+        const mli_lut *lut,
+        int8_t in_frac_bits,
+        const struct s8asym_quant_params *in_params = nullptr,
+        struct s8asym_quant_params *out_params = nullptr);
+
 } // namespace ref
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -146,6 +154,22 @@ static MLI_FORCE_INLINE vNx4short_t activation_lut_vec_elem_no_interpolate(
 #endif
 
 } // namespace vdsp
+
+////////////////////////////////////////////////////////////////////////////////
+// HOST_SIMD
+////////////////////////////////////////////////////////////////////////////////
+namespace host_simd {
+
+template <typename io_T, bool convert, bool fx_with_in_offset = false>
+static MLI_FORCE_INLINE void compute_activation_lut(
+        const struct generic_tensor_private_t<MLI_PTR(io_T)> *in,
+        struct generic_tensor_private_t<MLI_PTR(io_T)> *out,
+        const mli_lut *lut,
+        int8_t in_frac_bits,
+        const struct s8asym_quant_params *in_params,
+        struct s8asym_quant_params *out_params);
+
+} // namespace host_simd
 } // namespace krn
 } // namespace mli
 
@@ -59,6 +59,23 @@ using mli::krn::dsp::result_cast_relu_store_inp_width_v;
 using mli::krn::dsp::mli_prv_convert_sa8_fx16;
 using mli::krn::dsp::mli_prv_convert_fx16_sa8;
 
+#elif !defined(MLI_BUILD_REFERENCE) && defined(MLI_BUILD_HOST_SIMD)
+using mli::krn::ref::define_requant_params;
+using mli::krn::ref::define_quant_params;
+using mli::krn::ref::adjust_quant_params;
+using mli::krn::ref::quant_params_get_weigths_zeropoint;
+using mli::krn::ref::quant_params_set_in_zeropoint;
+using mli::krn::ref::weights_additive;
+using mli::krn::host_simd::in_additive;
+using mli::krn::host_simd::zp_additive;
+using mli::krn::ref::bias_additive;
+using mli::krn::ref::result_cast;
+using mli::krn::ref::ir_result_cast_relu_store;
+using mli::krn::ref::ir_rnn_result_requantize;
+using mli::krn::ref::result_cast_relu_store;
+using mli::krn::ref::mli_prv_convert_sa8_fx16;
+using mli::krn::ref::mli_prv_convert_fx16_sa8;
+
 #else
 using mli::krn::ref::define_requant_params;
 using mli::krn::ref::define_quant_params;
@@ -94,4 +111,8 @@ using mli::krn::ref::mli_prv_convert_fx16_sa8;
 #include "impl/mli_prv_quant_dsp.h"
 #endif
 
+#if !defined(MLI_BUILD_REFERENCE) && defined(MLI_BUILD_HOST_SIMD)
+#include "impl/mli_prv_quant_host_simd.h"
+#endif
+
 #endif /* _MLI_PRV_QUANT_H_ */
@@ -508,6 +508,46 @@ MLI_FORCE_INLINE vNx4short_t mli_prv_convert_fx16_sa8(
 #endif
 
 } // namespace vdsp
+
+////////////////////////////////////////////////////////////////////////////////
+// HOST_SIMD
+////////////////////////////////////////////////////////////////////////////////
+namespace host_simd {
+
+template <typename in_T, typename acc_T, typename quant_T>
+MLI_FORCE_INLINE acc_T in_additive(const MLI_PTR(in_T) __restrict in,
+        acc_T init_accum, const quant_T* quant_params,
+        const int width, const int height, int col_step, int row_step);
+template <>
+MLI_FORCE_INLINE mli_acc32_t in_additive(const MLI_PTR(int8_t) __restrict in,
+        mli_acc32_t init_accum, const s8asym_quant_specific_params* quant_params,
+        const int width, const int height, int col_step, int row_step);
+
+template <>
+MLI_FORCE_INLINE mli_acc32_t in_additive(const MLI_PTR(int8_t) __restrict in,
+        mli_acc32_t init_accum, const int_quant_specific_params* quant_params,
+        const int width, const int height, int col_step, int row_step);
+
+template <typename in_T, typename acc_T, typename quant_T>
+MLI_FORCE_INLINE acc_T in_additive(const MLI_PTR(in_T) __restrict in,
+        acc_T init_accum, const quant_T* quant_params,
+        const int width, const int height, const int ch, int col_step, int row_step, int ch_step);
+template <>
+MLI_FORCE_INLINE mli_acc32_t in_additive(const MLI_PTR(int8_t) __restrict in,
+        mli_acc32_t init_accum, const s8asym_quant_specific_params* quant_params,
+        const int width, const int height, const int ch, int col_step, int row_step, int ch_step);
+
+template <typename acc_T, typename quant_T>
+MLI_FORCE_INLINE acc_T zp_additive(const quant_T* quant_params,
+        acc_T init_accum, const int mac_serias_len);
+template <>
+MLI_FORCE_INLINE mli_acc32_t zp_additive(const s8asym_quant_specific_params* quant_params,
+        mli_acc32_t init_accum, const int mac_serias_len);
+template <>
+MLI_FORCE_INLINE mli_acc32_t zp_additive(const int_quant_specific_params* quant_params,
+        mli_acc32_t init_accum, const int mac_serias_len);
+
+} // namespace host_simd
 } // namespace krn
 } // namespace mli
 
@@ -17,6 +17,7 @@
 #include "mli_debug.h"
 #include "mli_math.h"
 #include "mli_helpers_api.h"
+#include "mli_krn_convolution.h"
 #include "mli_prv_tensor.h"
 
 #pragma MLI_CODE_SECTION_START(".mli_lib")
@@ -247,6 +248,77 @@ mli_status mli_hlp_create_subtensor(const mli_tensor *in, const mli_sub_tensor_c
     return MLI_STATUS_OK;
 }
 
+mli_status mli_hlp_permute_view(const mli_tensor *in, const mli_permute_cfg *cfg, mli_tensor *out) {
+    mli_status ret = MLI_CHECK_STATUS(mli_chk_permute_view(in, cfg, out), __func__);
+    if (ret != MLI_STATUS_OK)
+        return ret;
+
+    const int rank = in->rank;
+    int mem_strides[MLI_MAX_RANK];
+
+    // compute memory strides for the input tensor if not yet provided by the input tensor.
+    mem_strides[rank - 1] = in->mem_stride[rank - 1] != 0 ? in->mem_stride[rank - 1] : 1;
+    for (int i = rank - 2; i >= 0; i--) {
+        mem_strides[i] = in->mem_stride[i] != 0 ? in->mem_stride[i] : mem_strides[i+1] * in->shape[i+1];
+    }
+
+    // Only shape and strides are permuted. Data and quantization parameters are shared with the input.
+    out->data = in->data;
+    out->el_type = in->el_type;
+    out->el_params = in->el_params;
+    out->rank = rank;
+    for (int k = 0; k < rank; k++) {
+        out->shape[k] = in->shape[cfg->perm_dim[k]];
+        out->mem_stride[k] = mem_strides[cfg->perm_dim[k]];
+    }
+
+    const bool isAsym = (in->el_type == MLI_EL_SA_8) || (in->el_type == MLI_EL_SA_32);
+    if (isAsym && in->el_params.sa.dim >= 0) {
+        for (int k = 0; k < rank; k++) {
+            if (cfg->perm_dim[k] == in->el_params.sa.dim) {
+                out->el_params.sa.dim = k;
+                break;
+            }
+        }
+    }
+    return MLI_STATUS_OK;
+}
+
+mli_status mli_hlp_conv2d_winograd_weights(const mli_tensor *weights, mli_winograd_type type, mli_tensor *wino_weights) {
+    mli_status ret = MLI_CHECK_STATUS(mli_chk_conv2d_winograd_weights(weights, type, wino_weights), __func__);
+    if (ret != MLI_STATUS_OK)
+        return ret;
+
+    const uint32_t tile = (type == MLI_WINOGRAD_F2X2_3X3) ? 4 : 6;
+    wino_weights->rank = 4;
+    wino_weights->shape[KRNL_H_DIM_HWCN] = tile;
+    wino_weights->shape[KRNL_W_DIM_HWCN] = tile;
+    wino_weights->shape[KRNL_D_DIM_HWCN] = weights->shape[KRNL_D_DIM_HWCN];
+    wino_weights->shape[KRNL_C_DIM_HWCN] = weights->shape[KRNL_C_DIM_HWCN];
+    mli_hlp_set_tensor_mem_strides(wino_weights);
+
+    // Transformed values are integers scaled by the transform, so no quantization params apply
+    wino_weights->el_type = MLI_EL_SA_32;
+    wino_weights->el_params.sa.dim = -1;
+    wino_weights->el_params.sa.zero_point.mem.i16 = 0;
+    wino_weights->el_params.sa.scale.mem.i16 = 1;
+    wino_weights->el_params.sa.scale_frac_bits.mem.i8 = 0;
+
+    switch (weights->el_type) {
+    case MLI_EL_FX_8:
+    case MLI_EL_SA_8:
+        mli::krn::conv2d_winograd_weights<int8_t>(weights, wino_weights);
+        break;
+    case MLI_EL_FX_16:
+        mli::krn::conv2d_winograd_weights<int16_t>(weights, wino_weights);
+        break;
+    default:
+        MLI_ASSERT(0);
+        return MLI_STATUS_NOT_SUPPORTED;
+    }
+    return MLI_STATUS_OK;
+}
+
 mli_status mli_hlp_convert_tensor_safx(const mli_tensor * src, mli_tensor * dst) {
     mli_status ret = MLI_CHECK_STATUS(mli_chk_convert_tensor(src, dst), __func__);
     if (ret != MLI_STATUS_OK)
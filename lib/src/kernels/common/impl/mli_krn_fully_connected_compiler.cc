@@ -11,6 +11,7 @@
 #include "mli_ref_compiler_api.hpp"
 #include "mli_ref_runtime_api.hpp"
 #include "mli_ref_private_types.hpp"
+#include "mli_ref_weights_codec.hpp"
 
 
 namespace snps_arc::metaware::mli::ref {
@@ -27,7 +28,8 @@ FullyConnected_CS::FullyConnected_CS(const lib_mli::PlatformDescription pd,
       m_in{Tensor<OffsetBuffer, kFullyConnectedIORank>(OffsetBuffer(), in)},
       m_weights{Tensor<OffsetBuffer, kFullyConnectedWRank>(OffsetBuffer(), weights)},
       m_wtszp{Tensor<OffsetBuffer, kFullyConnectedZPRank>(OffsetBuffer(), wtszp)},
-      m_output{Tensor<OffsetBuffer, kFullyConnectedIORank>(OffsetBuffer(), output_tile_shape)} {
+      m_output{Tensor<OffsetBuffer, kFullyConnectedIORank>(OffsetBuffer(), output_tile_shape)},
+      m_encoded_weights_size{0} {
   DEPRECATED_METHOD
 }
 
@@ -52,7 +54,9 @@ FullyConnected_CS::FullyConnected_CS(const PlatformDescription pd,
     m_in(OffsetBuffer(), input.get_tensor()),
     m_weights(OffsetBuffer(), weights.get_tensor()),
     m_wtszp(OffsetBuffer(), weights_zp.get_tensor()),
-    m_output(OffsetBuffer(), output.get_tensor()) {
+    m_output(OffsetBuffer(), output.get_tensor()),
+    m_config(cfg),
+    m_encoded_weights_size(0) {
 }
 
 
@@ -71,6 +75,15 @@ mli_status FullyConnected_CS::GetKernelPrivateData(void* kernel_private_data_buf
   fc_opaque_obj.weights_buffer = m_weights.get_buf();
   fc_opaque_obj.output_buffer = m_output.get_buf();
   fc_opaque_obj.wtszp_buffer = m_weights_zp;
+  fc_opaque_obj.weights_mode = m_config.mode;
+  fc_opaque_obj.decoded_weights_buffer = m_decoded_weights_buffer;
+  if (m_config.mode != compression_mode_t::Uncompressed) {
+    // Zero points follow the encoded weights which size is known only after encoding
+    MLI_ASSERT(m_encoded_weights_size > 0);
+    MLI_ASSERT(m_decoded_weights_buffer.get_size() >= GetCtrlBufferSize());
+    fc_opaque_obj.wtszp_buffer = OffsetBuffer(m_weights.get_buf(), m_encoded_weights_size);
+    fc_opaque_obj.wtszp_buffer.set_size(GetEncodedWtsZeroPtsSize() * sizeof(int16_t));
+  }
   // Only two types of weights zero point quantization are supported, per-tensor or per-channel.
   // -1 indicates per-tensor, 1 indicates per-channel.
   // Potential bug if m_weights.shape[1] equals 1
@@ -79,8 +92,7 @@ mli_status FullyConnected_CS::GetKernelPrivateData(void* kernel_private_data_buf
   MLI_ASSERT(m_in.get_dim(1) == m_weights.get_dim(mli::kKernelFCChannelInDim));
   MLI_ASSERT(m_weights.get_dim(mli::kKernelFCChannelOutDim) == m_output.get_dim(mli::kKernelFCChannelOutDim));
 
-  // TODO: support batch processing. Here we ignor batch dim for now.
-  MLI_ASSERT(m_in.get_dim(mli::kTensorBatchDim) == 1);
+  // Batch of input vectors is processed as a single GEMM with weights shared across samples.
   fc_opaque_obj.input_n = m_in.get_dim(mli::kTensorBatchDim);
   fc_opaque_obj.input_ic = m_in.get_dim(mli::kKernelFCChannelOutDim);
 
@@ -118,6 +130,7 @@ mli_status FullyConnected_CS::AttachBufferOffsets(const Tensor<OffsetBuffer, kFu
   m_output.set_buf(output.get_buf());
   m_weights.set_buf(weights);
   m_weights_zp = wtszeropts;
+  m_decoded_weights_buffer = ctrl_buffer;
 
   return MLI_STATUS_OK;
 }
@@ -130,6 +143,7 @@ mli_status FullyConnected_CS::AttachBufferOffsets(const OffsetBuffer& input,
   m_output.set_buf(output);
   m_weights.set_buf(weights_and_zeropts);
   m_weights_zp = OffsetBuffer(weights_and_zeropts, GetWeightsBufferSize() * weights_and_zeropts.get_elem_size());
+  m_decoded_weights_buffer = ctrl_buffer;
   return MLI_STATUS_OK;
 };
 
@@ -160,6 +174,11 @@ mli_status FullyConnected_CS::EncodeWeights(const Tensor<Buffer, kFullyConnected
 mli_status FullyConnected_CS::EncodeWeightsAndZeroPts(TensorIterator<Buffer, kFullyConnectedWRank, kFullyConnectedIterRank>& weights,
                                                       TensorIterator<Buffer, kFullyConnectedZPRank, kFullyConnectedIterRank>& weights_zp,
                                                       Buffer& encoded_weights) {
+  if (m_config.mode != compression_mode_t::Uncompressed) {
+    const TensorIterator<OffsetBuffer, kFullyConnectedWRank, kFullyConnectedIterRank> tiling(m_weights);
+    return EncodeCompressedWeightsAndZeroPts(m_config.mode, tiling, weights.get_tensor(), weights_zp.get_tensor(),
+                                             encoded_weights, m_encoded_weights_size);
+  }
   MLI_ASSERT(weights.get_buf().get_size() + weights_zp.get_buf().get_size() == encoded_weights.get_size());
   MLI_ASSERT(weights.get_elem_size() == sizeof(int8_t));
   MLI_ASSERT(weights_zp.get_elem_size() == sizeof(int8_t));
@@ -167,7 +186,29 @@ mli_status FullyConnected_CS::EncodeWeightsAndZeroPts(TensorIterator<Buffer, kFu
 }
 
 unsigned FullyConnected_CS::GetEncodedWeightsSize() const {
-  return GetWeightsBufferSize();
+  if (m_config.mode == compression_mode_t::Uncompressed) {
+    return GetWeightsBufferSize();
+  }
+  if (m_encoded_weights_size == 0) {
+    const TensorIterator<OffsetBuffer, kFullyConnectedWRank, kFullyConnectedIterRank> tiling(m_weights);
+    return GetEncodedWeightsBound(m_config.mode, tiling);
+  }
+  return m_encoded_weights_size;
+}
+
+float FullyConnected_CS::GetWeightsCompressionRatio() const {
+  if (m_config.mode == compression_mode_t::Uncompressed) {
+    return 1.f;
+  }
+  return ref::GetWeightsCompressionRatio(GetWeightsBufferSize(), m_encoded_weights_size);
+}
+
+unsigned FullyConnected_CS::GetCtrlBufferSize() const {
+  if (m_config.mode == compression_mode_t::Uncompressed) {
+    return 0;
+  }
+  const TensorIterator<OffsetBuffer, kFullyConnectedWRank, kFullyConnectedIterRank> tiling(m_weights);
+  return GetMaxDecodedWeightsTileSize(tiling);
 }
 
 /**
@@ -17,6 +17,7 @@
 #include "mli_private_types.h"
 #include "mli_types.h"
 #include "mli_krn_dotprod.h"
+#include "mli_krn_gemm.h"
 
 namespace mli {
 namespace krn {
@@ -81,6 +82,16 @@ MLI_FORCE_INLINE void inner_product(
             out_val = MAX(out_val, val_min_limit);
             out[o_idx] = out_val;
         }
+    } else if constexpr (std::is_same<quant_T, int_quant_specific_params>::value &&
+                         sizeof(i_T) == sizeof(int8_t) && sizeof(w_T) == sizeof(int8_t)) {
+        // out_val = sum_i(x * (w - w_zp)) is a single row GEMM, which is calculated by the
+        // blocked GEMM engine shared with convolutions and MatMul.
+        const gemm_strided_src_t<i_T> in_src = {in, /* row_mem_stride = */ 0, /* depth_mem_stride = */ 1,
+                                                /* zero_point = */ 0};
+        const gemm_strided_src_t<w_T> w_src = {weights, /* row_mem_stride = */ 1, w_ch_out_mem_stride,
+                                               quant_params.weights_offset};
+        const gemm_strided_dst_t<o_T> out_dst = {out, /* row_mem_stride = */ 0, /* col_mem_stride = */ 1};
+        mli::krn::gemm(in_src, w_src, out_dst, /* m = */ 1, out_elements, in_elements);
     } else {
         acc_T in_additives = mli_math_mul_fx<i_T, acc_T>(0, 0);
         in_additives  = mli::krn::in_additive(in, in_additives, &quant_params, in_elements, 1, 1, 1);
@@ -97,6 +108,94 @@ MLI_FORCE_INLINE void inner_product(
     }
 }
 
+//========================================================
+// Batched IP template: out[b] = IP(in[b]) for each sample
+//========================================================
+// Each weight loaded from memory is applied to a block of kFullyConnectedBatchBlock samples
+// (independent accumulators), so the whole weights matrix is streamed once per block instead
+// of once per sample. Additives which depend only on the output channel (weights and bias
+// additives) are calculated once per block as well.
+template <typename i_T, typename w_T, typename o_T, typename b_T, typename acc_T, typename quant_T, bool no_zp>
+MLI_FORCE_INLINE void inner_product_batch(
+        const MLI_PTR(i_T) __restrict in,
+        const MLI_PTR(w_T)  __restrict weights,
+        const MLI_PTR(b_T)  __restrict biases,
+        MLI_CONV_OUT_PTR(o_T) __restrict out,
+        const int batch,
+        const int in_elements,
+        const int out_elements,
+        const int in_batch_mem_stride,
+        const int out_batch_mem_stride,
+        const int w_ch_out_mem_stride,
+        quant_T quant_params,
+        const o_T val_min_limit,
+        const o_T val_max_limit) {
+    const bool has_bias = biases != nullptr;
+    if constexpr (std::is_same<quant_T, int_quant_specific_params>::value &&
+                  sizeof(i_T) == sizeof(int8_t) && sizeof(w_T) == sizeof(int8_t)) {
+        if (!has_bias) {
+            // Samples are rows of A, so each packed weights panel is reused by the whole batch
+            const gemm_strided_src_t<i_T> in_src = {in, in_batch_mem_stride, /* depth_mem_stride = */ 1,
+                                                    /* zero_point = */ 0};
+            const gemm_strided_src_t<w_T> w_src = {weights, /* row_mem_stride = */ 1, w_ch_out_mem_stride,
+                                                   quant_params.weights_offset};
+            const gemm_strided_dst_t<o_T> out_dst = {out, out_batch_mem_stride, /* col_mem_stride = */ 1};
+            mli::krn::gemm(in_src, w_src, out_dst, batch, out_elements, in_elements);
+            return;
+        }
+    }
+
+    for (int b0 = 0; b0 < batch; b0 += kFullyConnectedBatchBlock) {
+        const int samples = MIN(kFullyConnectedBatchBlock, batch - b0);
+        const MLI_PTR(i_T) in_blk = in + b0 * in_batch_mem_stride;
+        MLI_CONV_OUT_PTR(o_T) out_blk = out + b0 * out_batch_mem_stride;
+
+        // Additives which depend only on the input sample
+        acc_T other_additives[kFullyConnectedBatchBlock];
+        for (int s = 0; s < samples; s++) {
+            other_additives[s] = mli_math_mul_fx<i_T, acc_T>(0, 0);
+            other_additives[s] = mli::krn::in_additive(in_blk + s * in_batch_mem_stride, other_additives[s],
+                                                       &quant_params, in_elements, 1, 1, 1);
+            if (has_bias) {
+                other_additives[s] = mli::krn::zp_additive(&quant_params, other_additives[s], in_elements);
+            }
+        }
+
+        for (int o_idx = 0; o_idx < out_elements; o_idx++) {
+            mli::krn::adjust_quant_params(&quant_params, o_idx);
+            const MLI_PTR(w_T) w_ptr = &weights[o_idx];
+            acc_T accu[kFullyConnectedBatchBlock];
+            for (int s = 0; s < samples; s++) {
+                accu[s] = mli_math_mul_fx<i_T, acc_T>(0, 0);
+            }
+            for (int i = 0; i < in_elements; i++) {
+                const w_T w_val = w_ptr[i * w_ch_out_mem_stride];
+                for (int s = 0; s < samples; s++) {
+                    accu[s] = mli_math_mac_fx(accu[s], in_blk[s * in_batch_mem_stride + i], w_val);
+                }
+            }
+
+            acc_T ch_additives = mli_math_mul_fx<i_T, acc_T>(0, 0);
+            if (has_bias) {
+                ch_additives = mli::krn::weights_additive(w_ptr, ch_additives, &quant_params,
+                                                          in_elements, 1, 1, w_ch_out_mem_stride, 1, 1);
+                ch_additives = mli::krn::bias_additive(&biases[o_idx], ch_additives, &quant_params);
+            }
+            for (int s = 0; s < samples; s++) {
+                acc_T acc = mli_math_add_fx(accu[s], other_additives[s]);
+                acc = mli_math_add_fx(acc, ch_additives);
+                // Cast result to output type with scaling
+                o_T out_val = mli::krn::result_cast<o_T, acc_T, quant_T>(acc, &quant_params);
+                if (has_bias) {
+                    out_val = MIN(out_val, val_max_limit);
+                    out_val = MAX(out_val, val_min_limit);
+                }
+                out_blk[s * out_batch_mem_stride + o_idx] = out_val;
+            }
+        }
+    }
+}
+
 //========================================================================================
 // Common routin for pre-calculation of various fully connected parameters and running it.
 //========================================================================================
@@ -114,7 +213,10 @@ MLI_FORCE_INLINE void fully_connected_prepare_and_run(
     MLI_CONV_OUT_PTR(o_T) out_ptr = mli_prv_tensor_data_ptr<MLI_CONV_OUT_PTR(o_T)>(out);
 
     const int ch_out = weights->shape[1];
-    const int in_sz = mli_prv_count_elem_num(in);
+    // Output of rank 2 means batched mode: [batch, in] * [in, out] = [batch, out]
+    const bool is_batched = out->rank == 2;
+    const int batch = is_batched ? out->shape[0] : 1;
+    const int in_sz = is_batched ? in->shape[1] : mli_prv_count_elem_num(in);
 
     constexpr bool asym = std::is_same<quant_T, s8asym_quant_specific_params>::value;
     mli_minmax_t val_limit = mli_prv_get_relu_limits<o_T, asym>(&cfg->relu, out);
@@ -140,8 +242,96 @@ MLI_FORCE_INLINE void fully_connected_prepare_and_run(
 
     // Run basic calculation
     //=======================================================================
-    mli::krn::inner_product<i_T, w_T, o_T, b_T, acc_T, quant_T, is_bias_ext>(
-            in_ptr, w_ptr, b_ptr, out_ptr, in_sz, ch_out, w_ch_out_mem_stride, /* cent_area, */ params, (o_T)val_limit.min, (o_T)val_limit.max);
+    if (batch > 1) {
+        mli::krn::inner_product_batch<i_T, w_T, o_T, b_T, acc_T, quant_T, is_bias_ext>(
+                in_ptr, w_ptr, b_ptr, out_ptr, batch, in_sz, ch_out, in->mem_stride[0], out->mem_stride[0],
+                w_ch_out_mem_stride, params, (o_T)val_limit.min, (o_T)val_limit.max);
+    } else {
+        mli::krn::inner_product<i_T, w_T, o_T, b_T, acc_T, quant_T, is_bias_ext>(
+                in_ptr, w_ptr, b_ptr, out_ptr, in_sz, ch_out, w_ch_out_mem_stride, /* cent_area, */ params, (o_T)val_limit.min, (o_T)val_limit.max);
+    }
+}
+
+//========================================================================================
+// Pre-calculation of sa8 quantization params which depend only on output channel
+//========================================================================================
+MLI_FORCE_INLINE void fully_connected_sa8_cache_quant(
+        const mli_tensor *in,
+        const mli_tensor *weights,
+        const mli_tensor *bias,
+        const mli_tensor *out,
+        mli_sa8_quant_cache *cache) {
+    const MLI_PTR(int8_t) w_ptr = mli_prv_tensor_data_ptr<MLI_PTR(int8_t)>(weights);
+    const MLI_PTR(int32_t) b_ptr = mli_prv_tensor_data_ptr<MLI_PTR(int32_t)>(bias);
+    const int in_sz = weights->shape[0];
+    const int ch_out = weights->shape[1];
+    const int w_ch_out_mem_stride = weights->mem_stride[0];
+
+    s8asym_quant_specific_params params;
+    define_quant_params(in, weights, bias, out, &params);
+
+    // The same additives as in inner_product (in_additive is zero for symmetric weights),
+    // but summed once per output channel
+    mli_acc32_t zp_add = mli_math_mul_fx<int8_t, mli_acc32_t>(0, 0);
+    zp_add = mli::krn::ref::zp_additive(&params, zp_add, in_sz);
+    for (int o_idx = 0; o_idx < ch_out; o_idx++) {
+        mli::krn::ref::adjust_quant_params(&params, o_idx);
+        mli_acc32_t accu = mli::krn::ref::weights_additive(&w_ptr[o_idx], zp_add, &params,
+                                                           in_sz, 1, 1, w_ch_out_mem_stride, 1, 1);
+        accu = mli::krn::ref::bias_additive(&b_ptr[o_idx], accu, &params);
+        cache->bias[o_idx] = mli_math_cast_fx<mli_acc32_t, int32_t>(accu, 0);
+        cache->out_mul[o_idx] = params.out_mul;
+        cache->out_shift[o_idx] = (int8_t)params.out_shift;
+    }
+    cache->ch_num = (uint32_t)ch_out;
+    cache->out_offset = params.out_offset;
+}
+
+//========================================================================================
+// Fully connected with sa8 quantization params taken from the cache
+//========================================================================================
+MLI_FORCE_INLINE void fully_connected_sa8_cached_run(
+        const mli_tensor *in,
+        const mli_tensor *weights,
+        const mli_sa8_quant_cache *cache,
+        const mli_fully_connected_cfg *cfg,
+        mli_tensor *out) {
+    mli_prv_fx_init_dsp_ctrl();
+
+    const MLI_PTR(int8_t) in_ptr = mli_prv_tensor_data_ptr<MLI_PTR(int8_t)>(in);
+    const MLI_PTR(int8_t) w_ptr = mli_prv_tensor_data_ptr<MLI_PTR(int8_t)>(weights);
+    MLI_CONV_OUT_PTR(int8_t) out_ptr = mli_prv_tensor_data_ptr<MLI_CONV_OUT_PTR(int8_t)>(out);
+
+    const int ch_out = weights->shape[1];
+    const bool is_batched = out->rank == 2;
+    const int batch = is_batched ? out->shape[0] : 1;
+    const int in_sz = weights->shape[0];
+    const int in_batch_mem_stride = is_batched ? in->mem_stride[0] : 0;
+    const int out_batch_mem_stride = is_batched ? out->mem_stride[0] : 0;
+    const int w_ch_out_mem_stride = weights->mem_stride[0];
+
+    const mli_minmax_t val_limit = mli_prv_get_relu_limits<int8_t, /* asym = */ true>(&cfg->relu, out);
+    const int8_t val_min_limit = (int8_t)val_limit.min;
+    const int8_t val_max_limit = (int8_t)val_limit.max;
+
+    s8asym_quant_specific_params params;
+    params.out_offset = cache->out_offset;
+    for (int b = 0; b < batch; b++) {
+        const MLI_PTR(int8_t) in_smpl = in_ptr + b * in_batch_mem_stride;
+        MLI_CONV_OUT_PTR(int8_t) out_smpl = out_ptr + b * out_batch_mem_stride;
+        for (int o_idx = 0; o_idx < ch_out; o_idx++) {
+            params.out_mul = cache->out_mul[o_idx];
+            params.out_shift = cache->out_shift[o_idx];
+            mli_acc32_t accu = mli_math_mul_fx<int8_t, mli_acc32_t>(0, 0);
+            accu = mli::krn::dotprod1D(in_smpl, &w_ptr[o_idx], accu, in_sz, 1, w_ch_out_mem_stride);
+            accu = mli_math_add_fx(accu, mli_math_cast_fx<mli_acc32_t, int32_t>(cache->bias[o_idx], 0));
+            int8_t out_val = mli::krn::ref::result_cast<int8_t, mli_acc32_t, s8asym_quant_specific_params>(
+                    accu, &params);
+            out_val = MIN(out_val, val_max_limit);
+            out_val = MAX(out_val, val_min_limit);
+            out_smpl[o_idx] = out_val;
+        }
+    }
 }
 #pragma MLI_CODE_SECTION_END()
 } // namespace ref
@@ -12,6 +12,7 @@
 #include "mli_debug.h"
 #include "common/mli_krn_fully_connected.h"
 #include "mli_ref_runtime_api.hpp"
+#include "mli_ref_weights_codec.hpp"
 
 #if !defined(MLI_BUILD_REFERENCE) && defined(__Xvec_width)
 typedef vNx4accshort_t mli_8x8_accu_t;
@@ -95,6 +96,16 @@ FullyConnected::FullyConnected(void* kernel_private_data_buffer,
     tsr.mem_stride[0] = private_data.weights_ic_stride;
     tsr.mem_stride[1] = private_data.weights_oc_stride;
 
+    m_metadata.weights_mode = private_data.weights_mode;
+    if (m_metadata.weights_mode != compression_mode_t::Uncompressed) {
+      // Weights are expanded into the dense [IC,OC] scratch buffer inside Issue()
+      m_metadata.encoded_weights_buffer = InternalBuffer(private_data.weights_buffer, membases, num_mems);
+      m_metadata.decoded_weights_buffer = InternalBuffer(private_data.decoded_weights_buffer, membases, num_mems);
+      tsr.data.mem.pi8 = m_metadata.decoded_weights_buffer.get_ptr<int8_t>();
+      tsr.mem_stride[0] = private_data.weights_oc;
+      tsr.mem_stride[1] = 1;
+    }
+
     // weights zero point should have the same size as the tensor they belong to.
     uint32_t wtszp_elem_size = sizeof(int16_t);
     uint32_t wtszp_size = private_data.wtszp_buffer.get_size();
@@ -127,6 +138,12 @@ mli_status FullyConnected::Issue() {
   if (m_i_elem_size == sizeof(int8_t) &&
       m_w_elem_size == sizeof(int8_t) &&
       m_o_elem_size == sizeof(int32_t)) {
+        if (m_metadata.weights_mode != compression_mode_t::Uncompressed) {
+          mli_status status = DecodeWeightsTile(m_metadata.encoded_weights_buffer.get_ptr<int8_t>(), 0,
+                                                m_metadata.weights.data.mem.pi8,
+                                                m_metadata.weights.shape[0] * m_metadata.weights.shape[1]);
+          if (status != MLI_STATUS_OK) return status;
+        }
         mli_fully_connected_cfg cfg = { MLI_RELU_NONE };
         MLI_ASSERT(cfg.relu.type == MLI_RELU_NONE);
         ::mli::krn::fully_connected_prepare_and_run<
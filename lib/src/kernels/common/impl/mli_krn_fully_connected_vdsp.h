@@ -82,6 +82,33 @@ MLI_FORCE_INLINE void inner_product(
     }
 }
 
+//========================================================
+// Batched IP template: out[b] = IP(in[b]) for each sample
+//========================================================
+// Vector lanes already process several output channels for each loaded input value,
+// so samples are processed one by one with the inner product above.
+template <typename i_T, typename w_T, typename o_T, typename b_T, typename acc_T, typename quant_T, bool no_zp>
+MLI_FORCE_INLINE void inner_product_batch(
+        const MLI_PTR(i_T) __restrict in,
+        const MLI_PTR(w_T)  __restrict weights,
+        const MLI_PTR(b_T)  __restrict biases,
+        MLI_CONV_OUT_PTR(o_T) __restrict out,
+        const int batch,
+        const int in_elements,
+        const int out_elements,
+        const int in_batch_mem_stride,
+        const int out_batch_mem_stride,
+        const int w_ch_out_mem_stride,
+        quant_T quant_params,
+        const o_T val_min_limit,
+        const o_T val_max_limit) {
+    for (int b = 0; b < batch; b++) {
+        inner_product<i_T, w_T, o_T, b_T, acc_T, quant_T, no_zp>(
+                in + b * in_batch_mem_stride, weights, biases, out + b * out_batch_mem_stride,
+                in_elements, out_elements, w_ch_out_mem_stride, quant_params, val_min_limit, val_max_limit);
+    }
+}
+
 #pragma MLI_CODE_SECTION_END()
 } // namespace vdsp
 } // namespace krn
@@ -19,6 +19,8 @@
 #include "mli_prv_tensor.h"
 #include "mli_types.h"
 #include "mli_krn_eltwise.h"
+#include "mli_prv_activation_lut.h"
+#include "mli_prv_lut.h"
 
 #include "mli_krn_rnn_dense_op.h"
 
@@ -42,6 +44,14 @@ static inline void dec_scales_for_new_gate(mli_element_params* params, int prev_
     params->sa.scale_frac_bits.mem.pi8 -= prev_gates;
 }
 
+// Fused cell engine: gates of each output neuron are calculated by dense operation, activated
+// through LUT and used by pointwise operations right away, so gates never leave registers.
+// The new gate depends on the reset gate of all neurons, that's why each timestep is done in
+// two passes over neurons:
+//   1: update and reset gates -> (reset * h), (1 - update) and (h * update) kept in scratch
+//   2: new gate -> output value
+// The whole sequence is processed in one call and the recurrent state stays in the output.
+// Quantization of each step is the same as in separate dense, activation and eltwise kernels.
 template <typename io_T, typename w_T, typename b_T, typename acc_T, typename quant_T>
 MLI_FORCE_INLINE void gru_cell_prepare_and_run(
         const mli_tensor * in,
@@ -56,19 +66,18 @@ MLI_FORCE_INLINE void gru_cell_prepare_and_run(
 
     constexpr bool asym = std::is_same<quant_T, s8asym_quant_specific_params>::value;
 
-    const int8_t num_inputs = 2;
-    const int8_t num_gates = 2;
+    constexpr int num_inputs = 2;
+    constexpr int num_gates = 2;
+    enum { kUpdateGate = 0, kResetGate };
     const int seq_len = in->shape[0];
 
     MLI_ASSERT(in->rank==2);
     MLI_ASSERT(prev_out->rank==1);
     __builtin_assume(prev_out->rank==1);
     __builtin_assume(in->rank==2);
-    const uint32_t gru_out_elements = mli_prv_count_elem_num(prev_out);
-    const int inputs_elements[] = {(int)mli_prv_count_elem_num_part(in, 1), (int)gru_out_elements};
+    const int gru_out_elements = (int)mli_prv_count_elem_num(prev_out);
+    const int inputs_elements[] = {(int)mli_prv_count_elem_num_part(in, 1), gru_out_elements};
 
-
-    const mli_tensor * weights[] = {weights_in, weights_out};
     const MLI_PTR (io_T) inputs_ptr[] = {mli_prv_tensor_data_ptr<MLI_PTR (io_T)>(in),
                                          mli_prv_tensor_data_ptr<MLI_PTR (io_T)>(prev_out)};
 
@@ -97,19 +106,13 @@ MLI_FORCE_INLINE void gru_cell_prepare_and_run(
         ir_asym_params.fx.frac_bits = MIN(ir_asym_params.fx.frac_bits, in->el_params.fx.frac_bits + weights_in->el_params.fx.frac_bits);
     }
 
-    mli_tensor one;
     // to match transform kernels one value
-    io_T one_data[] = {std::numeric_limits<io_T>::max()};
-    one.data.capacity = 1;
-    one.mem_stride[0] = 1;
-    one.shape[0] = 1;
-    one.rank = 1;
+    const io_T one_val = std::numeric_limits<io_T>::max();
+    mli_tensor one;
     one.el_type = in->el_type;
     one.el_params = one_el_params;
-    mli_prv_tensor_set_data_ptr<io_T>(&one, one_data);
-
-
 
+    // Descriptor of intermediate dense result (gates before activation)
     mli_tensor ir_tensor;
     ir_tensor.data = cfg->scratch_data;
     ir_tensor.shape[0] = bias->shape[0];
@@ -120,9 +123,51 @@ MLI_FORCE_INLINE void gru_cell_prepare_and_run(
     ir_tensor.el_type = in->el_type;
     ir_tensor.el_params = ir_asym_params;
 
-    quant_T in_to_out_params[2];
+    // Descriptors of gates after sigmoid and tanh
+    mli_tensor sigm_tsr = ir_tensor;
+    mli_tensor tanh_tsr = ir_tensor;
+    s8asym_quant_params ir_lut_params;
+    s8asym_quant_params sigm_out_params;
+    s8asym_quant_params tanh_out_params;
+    if (asym) {
+        ir_lut_params.offset = ir_tensor.el_params.sa.zero_point.mem.i16;
+        ir_lut_params.scale = ir_tensor.el_params.sa.scale.mem.i16;
+        ir_lut_params.shift = ir_tensor.el_params.sa.scale_frac_bits.mem.i8;
+        sigm_out_params.offset = K_SIGM_ASYM_ZERO_POINT;
+        sigm_out_params.scale = 1;
+        sigm_out_params.shift = K_SIGM_OUTPUT_SHIFT;
+        tanh_out_params.offset = K_TANH_ASYM_ZERO_POINT;
+        tanh_out_params.scale = 1;
+        tanh_out_params.shift = K_TANH_OUTPUT_SHIFT;
+
+        sigm_tsr.el_params.sa.zero_point.mem.i16 = sigm_out_params.offset;
+        sigm_tsr.el_params.sa.scale.mem.i16 = sigm_out_params.scale;
+        sigm_tsr.el_params.sa.scale_frac_bits.mem.i8 = (int8_t)sigm_out_params.shift;
+        tanh_tsr.el_params.sa.zero_point.mem.i16 = tanh_out_params.offset;
+        tanh_tsr.el_params.sa.scale.mem.i16 = tanh_out_params.scale;
+        tanh_tsr.el_params.sa.scale_frac_bits.mem.i8 = (int8_t)tanh_out_params.shift;
+    } else {
+        sigm_tsr.el_params.fx.frac_bits = tanh_tsr.el_params.fx.frac_bits = sizeof(io_T) * 8 - 1;
+    }
+    const int8_t ir_frac_bits = asym ? 0 : ir_tensor.el_params.fx.frac_bits;
+
+    mli_relu_cfg relu_none = {MLI_RELU_NONE};
+    mli_minmax_t val_limit = mli_prv_get_relu_limits<io_T, asym>(&relu_none, &ir_tensor);
+
+    // Descriptor of the recurrent state (previous output)
+    mli_tensor hidden;
+    hidden.el_type = in->el_type;
+    hidden.el_params = prev_out->el_params;
+
+    quant_T in_to_out_params[num_inputs];
+    quant_T gate_params[num_gates][num_inputs];
     define_quant_params(in, weights_in, bias, &ir_tensor, &in_to_out_params[0]);
     define_quant_params(prev_out, weights_out, bias, &ir_tensor, &in_to_out_params[1]);
+    for (int gate = 0; gate < num_gates; ++gate) {
+        for (int idx = 0; idx < num_inputs; ++idx) {
+            rnn_dense_gate_quant_params(&in_to_out_params[idx], gate, &gate_params[gate][idx]);
+        }
+    }
 
     const int w_ch_out_mem_strides[] = {(int)weights_in->mem_stride[KRNL_RNN_W_IN_ELEMS_DIM],
                                         (int)weights_out->mem_stride[KRNL_RNN_W_IN_ELEMS_DIM]};
@@ -130,16 +175,17 @@ MLI_FORCE_INLINE void gru_cell_prepare_and_run(
     const int w_gate_mem_strides[] = {(int)weights_in->mem_stride[0],
                                       (int)weights_out->mem_stride[0]};
 
-    // Paricular subtensors of intermediate tensor
-    mli_tensor reset_gate, update_gate, new_gate; // Various gates to control info flow
-    mli_tensor w_in_new_g, w_out_new_g, b_new_g;
+    const MLI_PTR (w_T) weights_ptr[num_gates][num_inputs];
+    const MLI_PTR (b_T) bias_ptr[num_gates];
+    for (int gate = 0; gate < num_gates; ++gate) {
+        weights_ptr[gate][0] = mli_prv_tensor_data_ptr<MLI_PTR (w_T)>(weights_in) + gate * w_gate_mem_strides[0];
+        weights_ptr[gate][1] = mli_prv_tensor_data_ptr<MLI_PTR (w_T)>(weights_out) + gate * w_gate_mem_strides[1];
+        bias_ptr[gate] = mli_prv_tensor_data_ptr<MLI_PTR (b_T)>(bias) + gate * bias->mem_stride[0];
+    }
 
-    // Init subtensors
-    mli_sub_tensor_cfg iterator = {/*.offset =*/ {0}, /*.size = */{1, ir_tensor.shape[1]}, /*.sub_tensor_rank =*/2};
+    // Weights and bias of the new gate
+    mli_tensor w_in_new_g, w_out_new_g, b_new_g;
     mli_sub_tensor_cfg weight_iterator = {/*.offset =*/ {2,0}, /*.size = */{1, bias->shape[1]}, /*.sub_tensor_rank =*/2};
-    mli_hlp_create_subtensor(&ir_tensor, &iterator, &update_gate); iterator.offset[0]++;
-    mli_hlp_create_subtensor(&ir_tensor, &iterator, &reset_gate); iterator.offset[0]++;
-    mli_hlp_create_subtensor(&ir_tensor, &iterator, &new_gate); iterator.offset[0]++;
     mli_hlp_create_subtensor(bias, &weight_iterator, &b_new_g);
 
     w_in_new_g.data = weights_in->data;
@@ -169,105 +215,81 @@ MLI_FORCE_INLINE void gru_cell_prepare_and_run(
 
     const MLI_PTR (b_T) b_new_g_ptr = mli_prv_tensor_data_ptr<MLI_PTR (b_T)>(&b_new_g);
 
-    mli_tensor rnn_out;
-    rnn_out.data = out->data;
-    rnn_out.rank = 2;
-    rnn_out.shape[0] = 1;
-    rnn_out.shape[1] = gru_out_elements;
-    rnn_out.mem_stride[0] = rnn_out.shape[1];
-    rnn_out.mem_stride[1] = 1;
-    rnn_out.el_type = in->el_type;
-
-    mli_tensor current_hidden;
-    current_hidden.data = prev_out->data;
-    current_hidden.rank = 2;
-    current_hidden.shape[0] = 1;
-    current_hidden.shape[1] = prev_out->shape[0];
-    current_hidden.mem_stride[0] = current_hidden.shape[1];
-    current_hidden.mem_stride[1] = 1;
-
-    current_hidden.el_type = in->el_type;
-    current_hidden.el_params = prev_out->el_params;
-    mli_tensor current_out = current_hidden;
-    current_out.data = out->data;
-    current_out.el_params = current_hidden.el_params;
-
-    mli_tensor prev_out_reset;
-    prev_out_reset.data = reset_gate.data;
-    prev_out_reset.rank = reset_gate.rank;
-    prev_out_reset.shape[0] = reset_gate.shape[0];
-    prev_out_reset.shape[1] = reset_gate.shape[1];
-    prev_out_reset.mem_stride[0] = reset_gate.mem_stride[0];
-    prev_out_reset.mem_stride[1] = reset_gate.mem_stride[1];
-    prev_out_reset.el_type = in->el_type;
-    prev_out_reset.el_params = current_hidden.el_params;
-
-    const MLI_PTR (io_T) inputs_new_ptr[] = {inputs_ptr[0],
-                                             mli_prv_tensor_data_ptr<MLI_PTR (io_T)>(&prev_out_reset)};
-
-    for (int timestep = 0; timestep < seq_len; timestep++) {
+    // Scratch data: (reset * h), (1 - update) and (h * update) for all neurons
+    io_T * prev_out_reset = mli_prv_tensor_data_ptr<io_T *>(&ir_tensor);
+    io_T * update_compl = prev_out_reset + gru_out_elements;
+    io_T * hidden_update = update_compl + gru_out_elements;
+    io_T * out_ptr = mli_prv_tensor_data_ptr<io_T *>(out);
 
-        // Step 1: Applying Dense
-        //=======================================
-        mli::krn::rnn_dense_op_stacked<io_T, w_T, b_T, acc_T, quant_T>(
-            inputs_ptr, weights, bias, num_gates, num_inputs, inputs_elements,
-            in_to_out_params, w_ch_out_mem_strides, w_gate_mem_strides, &ir_tensor);
+    const MLI_PTR (io_T) inputs_new_ptr[] = {inputs_ptr[0], prev_out_reset};
+    acc_T other_additives[num_gates][MLI_RNN_MAX_INPUT];
+    acc_T new_gate_additives[MLI_RNN_MAX_INPUT];
+    quant_T new_gate_params[num_inputs];
 
-        // Step 2: Applying non-linearity
+    for (int timestep = 0; timestep < seq_len; timestep++) {
+        io_T * h_prev = (io_T *)inputs_ptr[1];
+        io_T * h_next = (cfg->results == RNN_OUT_ALL) ? out_ptr + timestep * gru_out_elements : out_ptr;
+
+        // initial values as in eltwise_prepare_and_run (not all of them are set by calc_convert_params)
+        convert_params reset_params = {0, 0, 0, 0, 0, 1, 1, 0, 0, 0};
+        convert_params hidden_update_params = reset_params;
+        convert_params update_compl_params = reset_params;
+        convert_params new_update_params = reset_params;
+        convert_params out_params = reset_params;
+        calc_convert_params<io_T, ELTWISE_MUL, asym>(&sigm_tsr, &hidden, &hidden, reset_params);
+        calc_convert_params<io_T, ELTWISE_MUL, asym>(&hidden, &sigm_tsr, &hidden, hidden_update_params);
+        calc_convert_params<io_T, ELTWISE_SUB, asym>(&one, &sigm_tsr, &sigm_tsr, update_compl_params);
+        calc_convert_params<io_T, ELTWISE_MUL, asym>(&tanh_tsr, &sigm_tsr, out, new_update_params);
+        calc_convert_params<io_T, ELTWISE_ADD, asym>(out, &hidden, out, out_params);
+
+        // Step 1: Update and reset gates: Dense + non-linearity + pointwise operations
         //=======================================
-        update_gate.el_params = reset_gate.el_params = new_gate.el_params = ir_tensor.el_params;
+        for (int gate = 0; gate < num_gates; ++gate) {
+            rnn_dense_op_other_additives<io_T, acc_T, quant_T>(inputs_ptr, num_inputs, inputs_elements,
+                                                               gate_params[gate], other_additives[gate]);
+        }
 
-        if (asym) {
-            mli_krn_sigm_sa8(&update_gate, sigm_lut, &update_gate);
-            mli_krn_sigm_sa8(&reset_gate, sigm_lut, &reset_gate);
-        } else {
-            if (sizeof(io_T)==sizeof(int8_t)) {
-                mli_krn_sigm_fx8(&update_gate, sigm_lut, &update_gate);
-                mli_krn_sigm_fx8(&reset_gate, sigm_lut, &reset_gate);
-            } else if (sizeof(io_T)==sizeof(int16_t)) {
-                mli_krn_sigm_fx16(&update_gate, sigm_lut, &update_gate);
-                mli_krn_sigm_fx16(&reset_gate, sigm_lut, &reset_gate);
-            } else {
-                MLI_ASSERT(0);
+        for (int o_idx = 0; o_idx < gru_out_elements; o_idx++) {
+            io_T gates[num_gates];
+            for (int gate = 0; gate < num_gates; ++gate) {
+                gates[gate] = rnn_dense_op_one_out<io_T, w_T, b_T, acc_T, quant_T>(
+                        inputs_ptr, weights_ptr[gate], bias_ptr[gate], o_idx, num_inputs, inputs_elements,
+                        w_ch_out_mem_strides, gate_params[gate], other_additives[gate],
+                        (io_T)val_limit.min, (io_T)val_limit.max);
             }
+            const io_T update_gate = activation_lut_one_elem<io_T, io_T, asym, asym>(
+                    gates[kUpdateGate], sigm_lut, ir_frac_bits, &ir_lut_params, &sigm_out_params);
+            const io_T reset_gate = activation_lut_one_elem<io_T, io_T, asym, asym>(
+                    gates[kResetGate], sigm_lut, ir_frac_bits, &ir_lut_params, &sigm_out_params);
+
+            prev_out_reset[o_idx] = eltwise_one_elem<io_T, ELTWISE_MUL, asym>(reset_gate, h_prev[o_idx], reset_params);
+            hidden_update[o_idx] = eltwise_one_elem<io_T, ELTWISE_MUL, asym>(h_prev[o_idx], update_gate, hidden_update_params);
+            update_compl[o_idx] = eltwise_one_elem<io_T, ELTWISE_SUB, asym>(one_val, update_gate, update_compl_params);
         }
 
-        // Step 3: Pointwise operations
+        // Step 2: New gate: Dense + non-linearity + pointwise operations
         //=======================================
-        mli::krn::eltwise_prepare_and_run<io_T, io_T, ELTWISE_MUL, /*convert*/ asym, /*no_scalar*/ true, /*no_out_update*/ true, /*shape_1d*/ true>(&reset_gate, &current_hidden, &prev_out_reset);
-        mli::krn::eltwise_prepare_and_run<io_T, io_T, ELTWISE_MUL, /*convert*/ asym, /*no_scalar*/ true, /*no_out_update*/ true, /*shape_1d*/ true>(&current_hidden, &update_gate, &current_out);
-        mli::krn::eltwise_prepare_and_run<io_T, io_T, ELTWISE_SUB, /*convert*/ asym, /*no_scalar*/ false, /*no_out_update*/ true, /*shape_1d*/ true>(&one, &update_gate, &update_gate);
-
-
-        // Step 4: New gate
-        //=======================================
-        mli_relu_cfg relu_none = {MLI_RELU_NONE};
-        mli_minmax_t val_limit = mli_prv_get_relu_limits<io_T, asym>(&relu_none, &new_gate);
-
         if (asym) {
             inc_scales_for_new_gate(&w_in_new_g.el_params, num_gates);
             inc_scales_for_new_gate(&w_out_new_g.el_params, num_gates);
             inc_scales_for_new_gate(&b_new_g.el_params, num_gates);
         }
 
-        define_quant_params(in, &w_in_new_g, &b_new_g, &new_gate, &in_to_out_params[0]);
-        define_quant_params(&prev_out_reset, &w_out_new_g, &b_new_g, &new_gate, &in_to_out_params[1]);
-
-        MLI_PTR (io_T) new_gate_ptr = mli_prv_tensor_data_ptr<MLI_PTR (io_T)>(&new_gate);
-        mli::krn::rnn_dense_op<io_T, w_T, b_T, acc_T, quant_T>(
-            inputs_new_ptr, w_new_g_ptr, b_new_g_ptr, new_gate_ptr, num_inputs, inputs_elements, (int)gru_out_elements,
-            w_ch_out_mem_strides, in_to_out_params, (io_T)val_limit.min, (io_T)val_limit.max);
-
-        if (asym) {
-            mli_krn_tanh_sa8(&new_gate, tanh_lut, &new_gate);
-        } else {
-            if (sizeof(io_T)==sizeof(int8_t)) {
-                mli_krn_tanh_fx8(&new_gate, tanh_lut, &new_gate);
-            } else if (sizeof(io_T)==sizeof(int16_t)) {
-                mli_krn_tanh_fx16(&new_gate, tanh_lut, &new_gate);
-            } else {
-                MLI_ASSERT(0);
-            }
+        define_quant_params(in, &w_in_new_g, &b_new_g, &ir_tensor, &new_gate_params[0]);
+        define_quant_params(&hidden, &w_out_new_g, &b_new_g, &ir_tensor, &new_gate_params[1]);
+        rnn_dense_op_other_additives<io_T, acc_T, quant_T>(inputs_new_ptr, num_inputs, inputs_elements,
+                                                           new_gate_params, new_gate_additives);
+
+        for (int o_idx = 0; o_idx < gru_out_elements; o_idx++) {
+            io_T new_gate = rnn_dense_op_one_out<io_T, w_T, b_T, acc_T, quant_T>(
+                    inputs_new_ptr, w_new_g_ptr, b_new_g_ptr, o_idx, num_inputs, inputs_elements,
+                    w_ch_out_mem_strides, new_gate_params, new_gate_additives,
+                    (io_T)val_limit.min, (io_T)val_limit.max);
+            new_gate = activation_lut_one_elem<io_T, io_T, asym, asym>(
+                    new_gate, tanh_lut, ir_frac_bits, &ir_lut_params, &tanh_out_params);
+
+            const io_T new_update = eltwise_one_elem<io_T, ELTWISE_MUL, asym>(new_gate, update_compl[o_idx], new_update_params);
+            h_next[o_idx] = eltwise_one_elem<io_T, ELTWISE_ADD, asym>(new_update, hidden_update[o_idx], out_params);
         }
 
         if (asym) {
@@ -276,46 +298,19 @@ MLI_FORCE_INLINE void gru_cell_prepare_and_run(
             dec_scales_for_new_gate(&b_new_g.el_params, num_gates);
         }
 
-        // Step 5: Calculate output: Activation + pointwise operation
-        //===========================================================
-        mli_tensor temp;
-        temp.data = new_gate.data;
-        temp.rank = new_gate.rank;
-        temp.shape[0] = new_gate.shape[0];
-        temp.shape[1] = new_gate.shape[1];
-        temp.mem_stride[0] = new_gate.mem_stride[0];
-        temp.mem_stride[1] = new_gate.mem_stride[1];
-        temp.el_type = new_gate.el_type;
-        temp.el_params = out->el_params;
-
-        rnn_out.el_params = out->el_params;
-        mli::krn::eltwise_prepare_and_run<io_T, io_T, ELTWISE_MUL, /*convert*/ asym, /*no_scalar*/ true, /*no_out_update*/ true, /*shape_1d*/ true>(&new_gate, &update_gate, &temp);
-        mli::krn::eltwise_prepare_and_run<io_T, io_T, ELTWISE_ADD, /*convert*/ asym, /*no_scalar*/ true, /*no_out_update*/ true, /*shape_1d*/ true>(&temp, &current_out, &rnn_out);
-
-        current_hidden.data = rnn_out.data;
-        current_hidden.el_params = rnn_out.el_params;
-        current_out.el_params = current_hidden.el_params;
-        prev_out_reset.el_params = current_hidden.el_params;
-
-        // Step 6: Update pointers and tensors for next timestep
+        // Step 3: Update pointers and quantization params for next timestep
         //=======================================
         inputs_ptr[0] += cfg->direction == RNN_DIR_FORWARD ? in->mem_stride[0] : -in->mem_stride[0];
-        inputs_new_ptr[0] += cfg->direction == RNN_DIR_FORWARD ? in->mem_stride[0] : -in->mem_stride[0];
-        inputs_ptr[1] = mli_prv_tensor_data_ptr<MLI_PTR (io_T)>(&current_hidden);
-
-        if (asym) {
-            define_quant_params(in, weights_in, bias, &ir_tensor, &in_to_out_params[0]);
-            define_quant_params(&current_hidden, weights_out, bias, &ir_tensor, &in_to_out_params[1]);
-        } else {
-            define_quant_params(&current_hidden, weights_out, bias, &ir_tensor, &in_to_out_params[1]);
-        }
-
-        if (cfg->results == RNN_OUT_ALL) {
-            mli_prv_tensor_set_data_ptr<io_T>(&rnn_out,
-                                              mli_prv_tensor_data_ptr<io_T *>(&rnn_out) + gru_out_elements);
+        inputs_new_ptr[0] = inputs_ptr[0];
+        inputs_ptr[1] = h_next;
+
+        if (timestep == 0) {
+            hidden.el_params = out->el_params;
+            define_quant_params(&hidden, weights_out, bias, &ir_tensor, &in_to_out_params[1]);
+            for (int gate = 0; gate < num_gates; ++gate) {
+                rnn_dense_gate_quant_params(&in_to_out_params[1], gate, &gate_params[gate][1]);
+            }
         }
-
-        current_out = rnn_out;
     }
 
     // Fill output tensor params
@@ -19,6 +19,8 @@
 #include "mli_prv_tensor.h"
 #include "mli_types.h"
 #include "mli_krn_eltwise.h"
+#include "mli_prv_activation_lut.h"
+#include "mli_prv_lut.h"
 
 #include "mli_krn_rnn_dense_op.h"
 
@@ -30,6 +32,12 @@ namespace ref {
 //========================================================================================
 // Common routine for pre-calculation of various basic rnn cell parameters and running it.
 //========================================================================================
+// Fused cell engine: for each output neuron the four gate values are calculated by dense
+// operation, activated through LUT and used for update of the cell and output right away.
+// Gates never leave registers, so nothing but the recurrent state is written per timestep.
+// The whole sequence is processed in one call. The recurrent state of intermediate timesteps
+// is kept in two halves of scratch data (ping-pong) if only the last result is requested.
+// Quantization of each step is the same as in separate dense, activation and eltwise kernels.
 
 template <typename io_T, typename w_T, typename b_T, typename acc_T, typename quant_T>
 MLI_FORCE_INLINE void lstm_cell_prepare_and_run(
@@ -50,21 +58,21 @@ MLI_FORCE_INLINE void lstm_cell_prepare_and_run(
     MLI_ASSERT(prev_out->rank==1);
     __builtin_assume(prev_out->rank==1);
     __builtin_assume(in->rank==2);
-    const uint32_t lstm_out_elements = mli_prv_count_elem_num(prev_out);
-    const int inputs_elements[] = {(int)mli_prv_count_elem_num_part(in, 1), (int)lstm_out_elements};
+    const int lstm_out_elements = (int)mli_prv_count_elem_num(prev_out);
+    const int inputs_elements[] = {(int)mli_prv_count_elem_num_part(in, 1), lstm_out_elements};
 
     const int seq_len = in->shape[0];
-    const int8_t num_gates = 4;
-    const int8_t num_inputs = 2;
+    constexpr int num_gates = 4;
+    constexpr int num_inputs = 2;
+    enum { kInGate = 0, kNewInfo, kForgetGate, kOutGate };
 
-    const mli_tensor * weights[2] = {weights_in, weights_out};
     const MLI_PTR (io_T) inputs_ptr[] = {mli_prv_tensor_data_ptr<MLI_PTR (io_T)>(in),
                                          mli_prv_tensor_data_ptr<MLI_PTR (io_T)>(prev_out)};
 
     if (cfg->direction == RNN_DIR_BACKWARD)
         inputs_ptr[0] += (seq_len - 1) * in->mem_stride[0];
 
-    // Fill intermediate tensor of dense output
+    // Descriptor of intermediate dense result (gates before activation)
     mli_tensor ir_tensor;
     ir_tensor.data = cfg->scratch_data;
     ir_tensor.rank = bias->rank;
@@ -74,6 +82,14 @@ MLI_FORCE_INLINE void lstm_cell_prepare_and_run(
     ir_tensor.mem_stride[1] = 1;
     ir_tensor.el_type = in->el_type;
 
+    // Descriptors of gates after sigmoid and tanh
+    mli_tensor sigm_tsr = ir_tensor;
+    mli_tensor tanh_tsr = ir_tensor;
+    s8asym_quant_params ir_lut_params;
+    s8asym_quant_params sigm_out_params;
+    s8asym_quant_params tanh_out_params;
+    s8asym_quant_params cell_lut_params;
+
     if (asym) {
         mli_element_params ir_asym_params;
         ir_asym_params.sa.dim = -1;
@@ -83,142 +99,153 @@ MLI_FORCE_INLINE void lstm_cell_prepare_and_run(
         ir_asym_params.sa.scale.capacity = ir_asym_params.sa.zero_point.capacity = 0;
         ir_asym_params.sa.scale_frac_bits.capacity = 0;
         ir_tensor.el_params = ir_asym_params;
+
+        ir_lut_params.offset = ir_tensor.el_params.sa.zero_point.mem.i16;
+        ir_lut_params.scale = ir_tensor.el_params.sa.scale.mem.i16;
+        ir_lut_params.shift = ir_tensor.el_params.sa.scale_frac_bits.mem.i8;
+        cell_lut_params.offset = cell->el_params.sa.zero_point.mem.i16;
+        cell_lut_params.scale = cell->el_params.sa.scale.mem.i16;
+        cell_lut_params.shift = cell->el_params.sa.scale_frac_bits.mem.i8;
+        sigm_out_params.offset = K_SIGM_ASYM_ZERO_POINT;
+        sigm_out_params.scale = 1;
+        sigm_out_params.shift = K_SIGM_OUTPUT_SHIFT;
+        tanh_out_params.offset = K_TANH_ASYM_ZERO_POINT;
+        tanh_out_params.scale = 1;
+        tanh_out_params.shift = K_TANH_OUTPUT_SHIFT;
+
+        sigm_tsr.el_params = ir_asym_params;
+        sigm_tsr.el_params.sa.zero_point.mem.i16 = sigm_out_params.offset;
+        sigm_tsr.el_params.sa.scale.mem.i16 = sigm_out_params.scale;
+        sigm_tsr.el_params.sa.scale_frac_bits.mem.i8 = (int8_t)sigm_out_params.shift;
+        tanh_tsr.el_params = ir_asym_params;
+        tanh_tsr.el_params.sa.zero_point.mem.i16 = tanh_out_params.offset;
+        tanh_tsr.el_params.sa.scale.mem.i16 = tanh_out_params.scale;
+        tanh_tsr.el_params.sa.scale_frac_bits.mem.i8 = (int8_t)tanh_out_params.shift;
     } else {
         // [-32, 32] is enough for TANH/SIGM input
         ir_tensor.el_params.fx.frac_bits = 10;
         ir_tensor.el_params.fx.frac_bits = MIN(ir_tensor.el_params.fx.frac_bits, in->el_params.fx.frac_bits + weights_in->el_params.fx.frac_bits);
+        sigm_tsr.el_params.fx.frac_bits = tanh_tsr.el_params.fx.frac_bits = sizeof(io_T) * 8 - 1;
     }
+    const int8_t ir_frac_bits = asym ? 0 : ir_tensor.el_params.fx.frac_bits;
+    const int8_t cell_frac_bits = asym ? 0 : cell->el_params.fx.frac_bits;
+
+    mli_relu_cfg relu_none = {MLI_RELU_NONE};
+    mli_minmax_t val_limit = mli_prv_get_relu_limits<io_T, asym>(&relu_none, &ir_tensor);
 
-    quant_T in_to_out_params[2];
+    quant_T in_to_out_params[num_inputs];
+    quant_T gate_params[num_gates][num_inputs];
     define_quant_params(in, weights_in, bias, &ir_tensor, &in_to_out_params[0]);
     define_quant_params(prev_out, weights_out, bias, &ir_tensor, &in_to_out_params[1]);
-
+    for (int gate = 0; gate < num_gates; ++gate) {
+        for (int idx = 0; idx < num_inputs; ++idx) {
+            rnn_dense_gate_quant_params(&in_to_out_params[idx], gate, &gate_params[gate][idx]);
+        }
+    }
 
     const int w_ch_out_mem_strides[] = {(int)weights_in->mem_stride[KRNL_RNN_W_IN_ELEMS_DIM],
-                                                    (int)weights_out->mem_stride[KRNL_RNN_W_IN_ELEMS_DIM]};
-
-    const int w_gate_mem_strides[] = {(int)weights_in->mem_stride[0],
-                                                  (int)weights_out->mem_stride[0]};
-
-    // Paricular subtensors of intermediate tensor
-    mli_tensor in_gate, forget_gate, out_gate; // Various gates to controll info flow
-    mli_tensor g_tsr; // Information tensors
+                                        (int)weights_out->mem_stride[KRNL_RNN_W_IN_ELEMS_DIM]};
+
+    const MLI_PTR (w_T) weights_ptr[num_gates][num_inputs];
+    const MLI_PTR (b_T) bias_ptr[num_gates];
+    for (int gate = 0; gate < num_gates; ++gate) {
+        weights_ptr[gate][0] = mli_prv_tensor_data_ptr<MLI_PTR (w_T)>(weights_in) + gate * weights_in->mem_stride[0];
+        weights_ptr[gate][1] = mli_prv_tensor_data_ptr<MLI_PTR (w_T)>(weights_out) + gate * weights_out->mem_stride[0];
+        bias_ptr[gate] = mli_prv_tensor_data_ptr<MLI_PTR (b_T)>(bias) + gate * bias->mem_stride[0];
+    }
 
-    // Init subtensors
-    mli_sub_tensor_cfg iterator = {/*.offset =*/ {0}, /*.size = */{1, ir_tensor.shape[1]}, /*.sub_tensor_rank =*/2};
-    mli_hlp_create_subtensor(&ir_tensor, &iterator, &in_gate); iterator.offset[0]++;
-    mli_hlp_create_subtensor(&ir_tensor, &iterator, &g_tsr); iterator.offset[0]++;
-    mli_hlp_create_subtensor(&ir_tensor, &iterator, &forget_gate); iterator.offset[0]++;
-    mli_hlp_create_subtensor(&ir_tensor, &iterator, &out_gate);
+    // Parameters of pointwise operations
+    const mli_tensor * act_tsr = (cfg->act == RNN_ACT_SIGM) ? &sigm_tsr : &tanh_tsr;
+    const mli_lut * out_lut = (cfg->act == RNN_ACT_SIGM) ? sigm_lut : tanh_lut;
+    s8asym_quant_params * out_lut_params = (cfg->act == RNN_ACT_SIGM) ? &sigm_out_params : &tanh_out_params;
+    MLI_ASSERT(cfg->act == RNN_ACT_NONE || cfg->act == RNN_ACT_TANH || cfg->act == RNN_ACT_SIGM);
+    // initial values as in eltwise_prepare_and_run (not all of them are set by calc_convert_params)
+    convert_params cell_forget_params = {0, 0, 0, 0, 0, 1, 1, 0, 0, 0};
+    convert_params new_in_params = cell_forget_params;
+    convert_params cell_add_params = cell_forget_params;
+    convert_params out_params = cell_forget_params;
+    calc_convert_params<io_T, ELTWISE_MUL, asym>(cell, &sigm_tsr, cell, cell_forget_params);
+    calc_convert_params<io_T, ELTWISE_MUL, asym>(&tanh_tsr, &sigm_tsr, &tanh_tsr, new_in_params);
+    calc_convert_params<io_T, ELTWISE_ADD, asym>(cell, &tanh_tsr, cell, cell_add_params);
+    if (cfg->act == RNN_ACT_NONE) {
+        calc_convert_params<io_T, ELTWISE_MUL, asym>(cell, &sigm_tsr, out, out_params);
+    } else {
+        calc_convert_params<io_T, ELTWISE_MUL, asym>(act_tsr, &sigm_tsr, out, out_params);
+    }
 
-    mli_tensor rnn_out;
-    rnn_out.data = out->data;
-    rnn_out.rank = 1;
-    rnn_out.shape[0] = lstm_out_elements;
-    rnn_out.mem_stride[0] = 1;
-    rnn_out.el_type = in->el_type;
+    io_T * cell_ptr = mli_prv_tensor_data_ptr<io_T *>(cell);
+    io_T * out_ptr = mli_prv_tensor_data_ptr<io_T *>(out);
+    io_T * state_ptr = mli_prv_tensor_data_ptr<io_T *>(&ir_tensor);
+    acc_T other_additives[num_gates][MLI_RNN_MAX_INPUT];
 
     for (int timestep = 0; timestep < seq_len; timestep++) {
+        // Destination of the new recurrent state. It must not overlap the previous one
+        // which is read by the dense part for all neurons.
+        io_T * h_next = state_ptr + (timestep % 2) * lstm_out_elements;
+        if (cfg->results == RNN_OUT_ALL) {
+            h_next = out_ptr + timestep * lstm_out_elements;
+        } else if (timestep == seq_len - 1) {
+            h_next = out_ptr;
+        }
+        const bool is_overlapped = h_next < inputs_ptr[1] + lstm_out_elements && inputs_ptr[1] < h_next + lstm_out_elements;
+        io_T * h_dst = is_overlapped ? state_ptr + (timestep % 2) * lstm_out_elements : h_next;
 
-        // Step 1: Applying Dense
-        //=======================================
-        rnn_dense_op_stacked<io_T, w_T, b_T, acc_T, quant_T>(
-            inputs_ptr, weights, bias, num_gates, num_inputs, inputs_elements,
-            in_to_out_params, w_ch_out_mem_strides, w_gate_mem_strides, &ir_tensor);
-
+        for (int gate = 0; gate < num_gates; ++gate) {
+            rnn_dense_op_other_additives<io_T, acc_T, quant_T>(inputs_ptr, num_inputs, inputs_elements,
+                                                               gate_params[gate], other_additives[gate]);
+        }
 
-        // Step 2: Applying non-linearity
-        //=======================================
-        in_gate.el_params = out_gate.el_params = ir_tensor.el_params;
-        g_tsr.el_params = forget_gate.el_params = ir_tensor.el_params;
-
-        if (asym) {
-            mli_krn_sigm_sa8(&in_gate, sigm_lut, &in_gate);
-            mli_krn_tanh_sa8(&g_tsr, tanh_lut, &g_tsr);
-            mli_krn_sigm_sa8(&forget_gate, sigm_lut, &forget_gate);
-            mli_krn_sigm_sa8(&out_gate, sigm_lut, &out_gate);
-        } else {
-            if (sizeof(io_T)==sizeof(int8_t)) {
-                mli_krn_sigm_fx8(&in_gate, sigm_lut, &in_gate);
-                mli_krn_tanh_fx8(&g_tsr, tanh_lut, &g_tsr);
-                mli_krn_sigm_fx8(&forget_gate, sigm_lut, &forget_gate);
-                mli_krn_sigm_fx8(&out_gate, sigm_lut, &out_gate);
-            } else if (sizeof(io_T)==sizeof(int16_t)) {
-                mli_krn_sigm_fx16(&in_gate, sigm_lut, &in_gate);
-                mli_krn_tanh_fx16(&g_tsr, tanh_lut, &g_tsr);
-                mli_krn_sigm_fx16(&forget_gate, sigm_lut, &forget_gate);
-                mli_krn_sigm_fx16(&out_gate, sigm_lut, &out_gate);
-            } else {
-                MLI_ASSERT(0);
+        for (int o_idx = 0; o_idx < lstm_out_elements; o_idx++) {
+            // Step 1: Dense and non-linearity for all gates of the neuron
+            //=======================================
+            io_T gates[num_gates];
+            for (int gate = 0; gate < num_gates; ++gate) {
+                gates[gate] = rnn_dense_op_one_out<io_T, w_T, b_T, acc_T, quant_T>(
+                        inputs_ptr, weights_ptr[gate], bias_ptr[gate], o_idx, num_inputs, inputs_elements,
+                        w_ch_out_mem_strides, gate_params[gate], other_additives[gate],
+                        (io_T)val_limit.min, (io_T)val_limit.max);
+            }
+            const io_T in_gate = activation_lut_one_elem<io_T, io_T, asym, asym>(
+                    gates[kInGate], sigm_lut, ir_frac_bits, &ir_lut_params, &sigm_out_params);
+            const io_T new_info = activation_lut_one_elem<io_T, io_T, asym, asym>(
+                    gates[kNewInfo], tanh_lut, ir_frac_bits, &ir_lut_params, &tanh_out_params);
+            const io_T forget_gate = activation_lut_one_elem<io_T, io_T, asym, asym>(
+                    gates[kForgetGate], sigm_lut, ir_frac_bits, &ir_lut_params, &sigm_out_params);
+            const io_T out_gate = activation_lut_one_elem<io_T, io_T, asym, asym>(
+                    gates[kOutGate], sigm_lut, ir_frac_bits, &ir_lut_params, &sigm_out_params);
+
+            // Step 2: Pointwise operations
+            //=======================================
+            io_T cell_val = eltwise_one_elem<io_T, ELTWISE_MUL, asym>(cell_ptr[o_idx], forget_gate, cell_forget_params);
+            const io_T new_cell_info = eltwise_one_elem<io_T, ELTWISE_MUL, asym>(new_info, in_gate, new_in_params);
+            cell_val = eltwise_one_elem<io_T, ELTWISE_ADD, asym>(cell_val, new_cell_info, cell_add_params);
+            cell_ptr[o_idx] = cell_val;
+
+            // Step 3: Calculate output: Activation + pointwise operation
+            //===========================================================
+            if (cfg->act != RNN_ACT_NONE) {
+                cell_val = activation_lut_one_elem<io_T, io_T, asym, asym>(
+                        cell_val, out_lut, cell_frac_bits, &cell_lut_params, out_lut_params);
             }
+            h_dst[o_idx] = eltwise_one_elem<io_T, ELTWISE_MUL, asym>(cell_val, out_gate, out_params);
         }
 
-        // Step 3: Pointwise operations
-        //=======================================
-        mli::krn::eltwise_prepare_and_run<io_T, io_T, ELTWISE_MUL, /*convert*/ asym, /*no_scalar*/ true, /*no_out_update*/ true, /*shape_1d*/ true>(cell, &forget_gate, cell);
-        mli::krn::eltwise_prepare_and_run<io_T, io_T, ELTWISE_MUL, /*convert*/ asym, /*no_scalar*/ true, /*no_out_update*/ true, /*shape_1d*/ true>(&g_tsr, &in_gate, &g_tsr);
-        mli::krn::eltwise_prepare_and_run<io_T, io_T, ELTWISE_ADD, /*convert*/ asym, /*no_scalar*/ true, /*no_out_update*/ true, /*shape_1d*/ true>(cell, &g_tsr, cell);
-
-        // Step 4: Calculate output: Activation + pointwise operation
-        //===========================================================
-        mli_tensor temp;
-        temp.data = rnn_out.data;
-        temp.rank = rnn_out.rank;
-        temp.shape[0] = rnn_out.shape[0];
-        temp.mem_stride[0] = rnn_out.mem_stride[0];
-        temp.el_type = rnn_out.el_type;
-        temp.el_params = out->el_params;
-
-        if (cfg->act == RNN_ACT_NONE) {
-            mli::krn::eltwise_prepare_and_run<io_T, io_T, ELTWISE_MUL, /*convert*/ asym, /*no_scalar*/ true, /*no_out_update*/ true, /*shape_1d*/ true>(cell, &out_gate, &temp);
-        } else {
-            if (asym) {
-                if (cfg->act == RNN_ACT_TANH)
-                    mli_krn_tanh_sa8(cell, tanh_lut, &rnn_out);
-                else if (cfg->act == RNN_ACT_SIGM)
-                    mli_krn_sigm_sa8(cell, sigm_lut, &rnn_out);
-                else
-                    MLI_ASSERT(0);
-            } else {
-                if (sizeof(io_T)==sizeof(int8_t)) {
-                    if (cfg->act == RNN_ACT_TANH)
-                        mli_krn_tanh_fx8(cell, tanh_lut, &rnn_out);
-                    else if (cfg->act == RNN_ACT_SIGM)
-                        mli_krn_sigm_fx8(cell, sigm_lut, &rnn_out);
-                    else
-                        MLI_ASSERT(0);
-                } else if (sizeof(io_T)==sizeof(int16_t)) {
-                    if (cfg->act == RNN_ACT_TANH)
-                        mli_krn_tanh_fx16(cell, tanh_lut, &rnn_out);
-                    else if (cfg->act == RNN_ACT_SIGM)
-                        mli_krn_sigm_fx16(cell, sigm_lut, &rnn_out);
-                    else
-                        MLI_ASSERT(0);
-                } else {
-                    MLI_ASSERT(0);
-                }
+        if (is_overlapped) {
+            for (int o_idx = 0; o_idx < lstm_out_elements; o_idx++) {
+                h_next[o_idx] = h_dst[o_idx];
             }
-
-            mli::krn::eltwise_prepare_and_run<io_T, io_T, ELTWISE_MUL, /*convert*/ asym, /*no_scalar*/ true, /*no_out_update*/ true, /*shape_1d*/ true>(&rnn_out, &out_gate, &temp);
         }
-        rnn_out.el_params = out->el_params;
 
-        // Step 5: Update pointers and tensors for next timestep
+        // Step 4: Update pointers and quantization params for next timestep
         //=======================================
         inputs_ptr[0] += cfg->direction == RNN_DIR_FORWARD ? in->mem_stride[0] : -in->mem_stride[0];
-        inputs_ptr[1] = mli_prv_tensor_data_ptr<MLI_PTR (io_T)>(&rnn_out);
+        inputs_ptr[1] = h_next;
 
-        if (asym) {
-            rnn_out.el_params = out->el_params;
-            define_quant_params(in, weights_in, bias, &ir_tensor, &in_to_out_params[0]);
+        if (timestep == 0) {
             define_quant_params(out, weights_out, bias, &ir_tensor, &in_to_out_params[1]);
-        } else {
-            define_quant_params(&rnn_out, weights_out, bias, &ir_tensor, &in_to_out_params[1]);
-        }
-
-        if (cfg->results == RNN_OUT_ALL) {
-            mli_prv_tensor_set_data_ptr<io_T>(&rnn_out,
-                                              mli_prv_tensor_data_ptr<io_T *>(&rnn_out) + lstm_out_elements);
+            for (int gate = 0; gate < num_gates; ++gate) {
+                rnn_dense_gate_quant_params(&in_to_out_params[1], gate, &gate_params[gate][1]);
+            }
         }
     }
 
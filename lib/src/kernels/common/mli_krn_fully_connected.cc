@@ -118,6 +118,38 @@ mli_status mli_krn_fully_connected_sa8_sa8_sa32_ext_bias(
 
     return ret;
 }
+
+mli_status mli_krn_fully_connected_sa8_sa8_sa32_cache_quant(
+        const mli_tensor* in,
+        const mli_tensor* weights,
+        const mli_tensor* bias,
+        const mli_fully_connected_cfg* cfg,
+        mli_tensor* out,
+        mli_sa8_quant_cache* cache) {
+    mli_status ret = MLI_CHECK_STATUS(mli_chk_fully_connected_sa8_sa8_sa32(in, weights, bias, cfg, out), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+    ret = MLI_CHECK_STATUS(mli_chk_sa8_quant_cache(cache), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+
+    mli::krn::fully_connected_sa8_cache_quant(in, weights, bias, out, cache);
+
+    return ret;
+}
+
+mli_status mli_krn_fully_connected_sa8_sa8_sa32_cached(
+        const mli_tensor* in,
+        const mli_tensor* weights,
+        const mli_sa8_quant_cache* cache,
+        const mli_fully_connected_cfg* cfg,
+        mli_tensor* out) {
+    mli_status ret = MLI_CHECK_STATUS(mli_chk_fully_connected_sa8_sa8_sa32_cached(in, weights, cache, cfg, out), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+    MLI_PRINT_COMPILE_OPTIONS();
+
+    mli::krn::fully_connected_sa8_cached_run(in, weights, cache, cfg, out);
+
+    return ret;
+}
 #pragma MLI_CODE_SECTION_END()
 
 #ifdef __cplusplus
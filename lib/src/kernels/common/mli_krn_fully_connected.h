@@ -29,15 +29,24 @@ namespace mli {
 namespace krn {
 #if !defined(MLI_BUILD_REFERENCE) && defined(__Xvec_width)
 using mli::krn::vdsp::inner_product;
+using mli::krn::vdsp::inner_product_batch;
 using mli::krn::ref::fully_connected_prepare_and_run;
+using mli::krn::ref::fully_connected_sa8_cache_quant;
+using mli::krn::ref::fully_connected_sa8_cached_run;
 
 #elif !defined(MLI_BUILD_REFERENCE) && defined(__FXAPI__)
 using mli::krn::ref::inner_product;
+using mli::krn::ref::inner_product_batch;
 using mli::krn::ref::fully_connected_prepare_and_run;
+using mli::krn::ref::fully_connected_sa8_cache_quant;
+using mli::krn::ref::fully_connected_sa8_cached_run;
 
 #else
 using mli::krn::ref::inner_product;
+using mli::krn::ref::inner_product_batch;
 using mli::krn::ref::fully_connected_prepare_and_run;
+using mli::krn::ref::fully_connected_sa8_cache_quant;
+using mli::krn::ref::fully_connected_sa8_cached_run;
 
 #endif
 } // namespace krn
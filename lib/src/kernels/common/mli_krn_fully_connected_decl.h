@@ -18,6 +18,9 @@
 
 namespace mli {
 namespace krn {
+// Number of samples processed together by the batched inner product
+constexpr int kFullyConnectedBatchBlock = 4;
+
 ////////////////////////////////////////////////////////////////////////////////
 // Functions (in *_ref/*_dsp/*vdsp) that can be called from outside their own
 // file must be declared here. This includes all overloads. For example, if we
@@ -42,6 +45,22 @@ MLI_FORCE_INLINE void inner_product(
         const o_T val_min_limit,
         const o_T val_max_limit);
 
+template <typename i_T, typename w_T, typename o_T, typename b_T, typename acc_T, typename quant_T, bool no_zp>
+MLI_FORCE_INLINE void inner_product_batch(
+        const MLI_PTR(i_T) __restrict in,
+        const MLI_PTR(w_T)  __restrict weights,
+        const MLI_PTR(b_T)  __restrict biases,
+        MLI_CONV_OUT_PTR(o_T) __restrict out,
+        const int batch,
+        const int in_elements,
+        const int out_elements,
+        const int in_batch_mem_stride,
+        const int out_batch_mem_stride,
+        const int w_ch_out_mem_stride,
+        quant_T quant_params,
+        const o_T val_min_limit,
+        const o_T val_max_limit);
+
 template <typename i_T, typename w_T, typename o_T, typename b_T, typename acc_T, typename quant_T, bool is_bias_ext>
 MLI_FORCE_INLINE void fully_connected_prepare_and_run(
         const mli_tensor *in,
@@ -49,6 +68,20 @@ MLI_FORCE_INLINE void fully_connected_prepare_and_run(
         const mli_tensor *bias,
         const mli_fully_connected_cfg *cfg,
         mli_tensor *out);
+
+MLI_FORCE_INLINE void fully_connected_sa8_cache_quant(
+        const mli_tensor *in,
+        const mli_tensor *weights,
+        const mli_tensor *bias,
+        const mli_tensor *out,
+        mli_sa8_quant_cache *cache);
+
+MLI_FORCE_INLINE void fully_connected_sa8_cached_run(
+        const mli_tensor *in,
+        const mli_tensor *weights,
+        const mli_sa8_quant_cache *cache,
+        const mli_fully_connected_cfg *cfg,
+        mli_tensor *out);
 } // namespace ref
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -75,6 +108,22 @@ MLI_FORCE_INLINE void inner_product(
         const o_T val_min_limit,
         const o_T val_max_limit);
 
+template <typename i_T, typename w_T, typename o_T, typename b_T, typename acc_T, typename quant_T, bool no_zp>
+MLI_FORCE_INLINE void inner_product_batch(
+        const MLI_PTR(i_T) __restrict in,
+        const MLI_PTR(w_T)  __restrict weights,
+        const MLI_PTR(b_T)  __restrict biases,
+        MLI_CONV_OUT_PTR(o_T) __restrict out,
+        const int batch,
+        const int in_elements,
+        const int out_elements,
+        const int in_batch_mem_stride,
+        const int out_batch_mem_stride,
+        const int w_ch_out_mem_stride,
+        quant_T quant_params,
+        const o_T val_min_limit,
+        const o_T val_max_limit);
+
 } // namespace vdsp
 
 } // namespace krn
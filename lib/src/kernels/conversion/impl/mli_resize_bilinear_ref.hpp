@@ -14,61 +14,255 @@
 #include "mli_prv_dsp.h"
 #include "mli_prv_tensor.h"
 #include "mli_mem_info.h"
+#include "mli_krn_rescale.hpp"
 
 namespace snps_arc::metaware::mli {
 namespace krn {
 namespace ref {
 
-// TODO: change mli_tensor to Tensor
-// TODO: change BHWC to BHWGC
-mli_status mli_resize_bilinear(const mli_tensor* in, const ResizeOpConfig& cfg, mli_tensor* out) {
+// Output columns are processed in chunks, so coordinate tables and cached rows stay on the stack
+constexpr int kResizeMaxChunkCols = 256;
+constexpr int kResizeRowCacheSize = 512;
+constexpr int kResizeMaxIntFactor = 4;
 
-    mli_prv_fx_init_dsp_ctrl();
+// Position of an output row (column) in the input: two neighbour input indexes clamped
+// to the input and the weight of the second one (fractional part with cfg.shift bits)
+struct resize_coord_t {
+    int32_t idx0;
+    int32_t idx1;
+    int32_t frac;
+};
+
+// Coordinates of output columns for integer upscale factors, where the fractional part
+// depends only on the phase (column % factor). Groups [q_begin, q_end) of factor columns
+// don't need clamping of input indexes.
+struct resize_phase_t {
+    int32_t base[kResizeMaxIntFactor];
+    int32_t frac[kResizeMaxIntFactor];
+    int32_t q_begin;
+    int32_t q_end;
+};
+
+static MLI_FORCE_INLINE resize_coord_t resize_bilinear_coord(const int pos, const int stride, const int offset,
+                                                             const int shift, const int in_size) {
+    const int pos_fx = pos * stride + offset;
+    const int pos_int = pos_fx >> shift;
+    resize_coord_t coord;
+    coord.idx0 = MIN(MAX(pos_int, 0), in_size - 1);
+    coord.idx1 = MIN(MAX(pos_int + 1, 0), in_size - 1);
+    coord.frac = pos_fx - (pos_int << shift);
+    return coord;
+}
+
+static MLI_FORCE_INLINE resize_phase_t resize_bilinear_phase(const int factor, const int stride, const int offset,
+                                                             const int shift, const int in_size) {
+    resize_phase_t phase;
+    phase.q_begin = 0;
+    phase.q_end = INT32_MAX;
+    for (int p = 0; p < factor; p++) {
+        const int pos_fx = p * stride + offset;
+        phase.base[p] = pos_fx >> shift;
+        phase.frac[p] = pos_fx - (phase.base[p] << shift);
+        phase.q_begin = MAX(phase.q_begin, -phase.base[p]);
+        phase.q_end = MIN(phase.q_end, in_size - 1 - phase.base[p]);
+    }
+    return phase;
+}
+
+// Upscale factor (2 or 4) if stride is exactly 1/factor, 0 otherwise
+static MLI_FORCE_INLINE int resize_bilinear_int_factor(const int stride, const int shift) {
+    const int one_fx = 1 << shift;
+    if (stride * 2 == one_fx) return 2;
+    if (stride * 4 == one_fx) return 4;
+    return 0;
+}
 
-    auto in_prv = mli_prv_get_generic_tensor<MLI_PTR(int8_t)>(in);
-    auto out_prv = mli_prv_get_generic_tensor<MLI_OUT_PTR(int32_t)>(out);
-
-    int one_fx = (1 << cfg.shift);
-    int row_fx, row_int, delta_row_fx, input_row0_int, input_row1_int;
-    int col_fx, col_int, delta_col_fx, input_col0_int, input_col1_int;
-    int8_t v00, v01, v10, v11;
-    int32_t out_val;
-    int b, h, w, c;
-    for (b = 0; b < out_prv.shape[kTensorBatchDim]; b++) {
-        for (h = 0; h < out_prv.shape[kTensorHeightDim]; h++) {
-            row_fx = h * cfg.stride[0] + cfg.offset[0];
-            row_int = row_fx >> cfg.shift;
-            delta_row_fx = row_fx - (row_int << cfg.shift);
-            input_row0_int = MIN(MAX(row_int, 0), in_prv.shape[kTensorHeightDim] - 1);
-            input_row1_int = MIN(row_int + 1, in_prv.shape[kTensorHeightDim] - 1);
-            for (w = 0; w < out_prv.shape[kTensorWidthDim]; w++) {
-                col_fx = w * cfg.stride[1] + cfg.offset[1];
-                col_int = col_fx >> cfg.shift;
-                delta_col_fx = col_fx - (col_int << cfg.shift);
-                input_col0_int = MIN(MAX(col_int, 0), in_prv.shape[kTensorWidthDim] - 1);
-                input_col1_int = MIN(col_int + 1, in_prv.shape[kTensorWidthDim] - 1);
-                for (c = 0; c < out_prv.shape[kTensorChannelDim]; c++) {
-                    // read the nearest 4 input values around the output point
-                    v00 = mli_prv_tensor_read(in_prv, b, input_row0_int, input_col0_int, c);
-                    v01 = mli_prv_tensor_read(in_prv, b, input_row0_int, input_col1_int, c);
-                    v10 = mli_prv_tensor_read(in_prv, b, input_row1_int, input_col0_int, c);
-                    v11 = mli_prv_tensor_read(in_prv, b, input_row1_int, input_col1_int, c);
-
-                    // compute and write output point
-                    out_val = v00 * (one_fx - delta_row_fx) * (one_fx - delta_col_fx) +
-                              v01 * (one_fx - delta_row_fx) * delta_col_fx            +
-                              v10 * delta_row_fx            * (one_fx - delta_col_fx) +
-                              v11 * delta_row_fx            * delta_col_fx;
-                    mli_prv_tensor_write(out_val, out_prv, b, h, w, c);
+// Horizontal pass for a single output column: dst[c] = in[idx0][c] * (1 - frac) + in[idx1][c] * frac
+static MLI_FORCE_INLINE void resize_bilinear_hpass_col(const MLI_PTR(int8_t) row, const resize_coord_t &col,
+                                                       const int num_ch, const int col_stride, const int ch_stride,
+                                                       const int one_fx, int32_t *dst) {
+    const MLI_PTR(int8_t) src0 = row + col.idx0 * col_stride;
+    const MLI_PTR(int8_t) src1 = row + col.idx1 * col_stride;
+    const int32_t w0 = one_fx - col.frac;
+    const int32_t w1 = col.frac;
+    for (int c = 0; c < num_ch; c++) {
+        dst[c] = src0[c * ch_stride] * w0 + src1[c * ch_stride] * w1;
+    }
+}
+
+// Horizontal pass of one input row into the row cache ([column][channel] layout)
+static MLI_FORCE_INLINE void resize_bilinear_hpass(const MLI_PTR(int8_t) row, const resize_coord_t *cols,
+                                                   const int num_cols, const int num_ch, const int col_stride,
+                                                   const int ch_stride, const int one_fx, int32_t *dst) {
+    for (int j = 0; j < num_cols; j++) {
+        resize_bilinear_hpass_col(row, cols[j], num_ch, col_stride, ch_stride, one_fx, &dst[j * num_ch]);
+    }
+}
 
+// Horizontal pass for integer upscale factor: groups of kFactor output columns share the input
+// column pair offsets and weights of each phase, so the coordinate table is used only at the borders.
+// first_col must be a multiple of kFactor.
+template <int kFactor>
+static MLI_FORCE_INLINE void resize_bilinear_hpass_int_factor(const MLI_PTR(int8_t) row, const resize_coord_t *cols,
+                                                              const resize_phase_t &phase, const int first_col,
+                                                              const int num_cols, const int num_ch,
+                                                              const int col_stride, const int ch_stride,
+                                                              const int one_fx, int32_t *dst) {
+    int j = 0;
+    while (j < num_cols) {
+        const int q = (first_col + j) / kFactor;
+        if ((first_col + j) % kFactor == 0 && j + kFactor <= num_cols && q >= phase.q_begin && q < phase.q_end) {
+            for (int p = 0; p < kFactor; p++) {
+                const MLI_PTR(int8_t) src = row + (q + phase.base[p]) * col_stride;
+                const int32_t w0 = one_fx - phase.frac[p];
+                const int32_t w1 = phase.frac[p];
+                int32_t *out = &dst[(j + p) * num_ch];
+                for (int c = 0; c < num_ch; c++) {
+                    out[c] = src[c * ch_stride] * w0 + src[c * ch_stride + col_stride] * w1;
                 }
             }
+            j += kFactor;
+        } else {
+            resize_bilinear_hpass_col(row, cols[j], num_ch, col_stride, ch_stride, one_fx, &dst[j * num_ch]);
+            j++;
         }
     }
+}
+
+static MLI_FORCE_INLINE void resize_bilinear_hpass_row(const MLI_PTR(int8_t) row, const resize_coord_t *cols,
+                                                       const resize_phase_t &phase, const int factor,
+                                                       const int first_col, const int num_cols, const int num_ch,
+                                                       const int col_stride, const int ch_stride,
+                                                       const int one_fx, int32_t *dst) {
+    if (factor == 2) {
+        resize_bilinear_hpass_int_factor<2>(row, cols, phase, first_col, num_cols, num_ch, col_stride, ch_stride,
+                                            one_fx, dst);
+    } else if (factor == 4) {
+        resize_bilinear_hpass_int_factor<4>(row, cols, phase, first_col, num_cols, num_ch, col_stride, ch_stride,
+                                            one_fx, dst);
+    } else {
+        resize_bilinear_hpass(row, cols, num_cols, num_ch, col_stride, ch_stride, one_fx, dst);
+    }
+}
+
+static MLI_FORCE_INLINE void resize_bilinear_store(const int32_t acc, const ResizeRequantConfig &requant,
+                                                   MLI_OUT_PTR(int32_t) dst) {
+    *dst = acc;
+}
+
+static MLI_FORCE_INLINE void resize_bilinear_store(const int32_t acc, const ResizeRequantConfig &requant,
+                                                   MLI_OUT_PTR(int8_t) dst) {
+    int8_t val = rescale_value<int32_t, int8_t>(acc, 0, requant.out_bias, requant.scale, requant.shift);
+    *dst = MIN(MAX(val, requant.clip_min), requant.clip_max);
+}
+
+// Separable bilinear interpolation: each input row is interpolated horizontally once into the
+// row cache and reused by all output rows between it and its neighbour (2 or 4 rows for integer
+// upscales), then the vertical pass blends two cached rows into the output row.
+template <typename o_T>
+static void resize_bilinear_separable(const generic_tensor_private_t<MLI_PTR(int8_t)> &in,
+                                      const ResizeOpConfig &cfg,
+                                      const int32_t offset[ResizeOpConfig::kResizeParamRank],
+                                      const generic_tensor_private_t<MLI_OUT_PTR(o_T)> &out) {
+    const int one_fx = 1 << cfg.shift;
+    const int in_h = in.shape[kTensorHeightDim];
+    const int in_w = in.shape[kTensorWidthDim];
+    const int out_h = out.shape[kTensorHeightDim];
+    const int out_w = out.shape[kTensorWidthDim];
+    const int num_ch = out.shape[kTensorChannelDim];
+    const int in_col_stride = in.mem_stride[kTensorWidthDim];
+    const int in_ch_stride = in.mem_stride[kTensorChannelDim];
+    const int out_col_stride = out.mem_stride[kTensorWidthDim];
+    const int out_ch_stride = out.mem_stride[kTensorChannelDim];
+    if (num_ch <= 0 || out_w <= 0 || out_h <= 0) return;
+
+    const int factor = resize_bilinear_int_factor(cfg.stride[1], cfg.shift);
+    const resize_phase_t phase = resize_bilinear_phase(MAX(factor, 1), cfg.stride[1], offset[1], cfg.shift, in_w);
+    // chunks of columns start at a group boundary of the integer upscale
+    const int chunk_ch = MIN(num_ch, kResizeRowCacheSize / kResizeMaxIntFactor);
+    const int chunk_cols = MIN(kResizeMaxChunkCols, kResizeRowCacheSize / chunk_ch)
+                           / kResizeMaxIntFactor * kResizeMaxIntFactor;
+    resize_coord_t cols[kResizeMaxChunkCols];
+    int32_t row_cache[2][kResizeRowCacheSize];
+
+    for (int c0 = 0; c0 < num_ch; c0 += chunk_ch) {
+        const int nc = MIN(chunk_ch, num_ch - c0);
+        for (int w0 = 0; w0 < out_w; w0 += chunk_cols) {
+            const int nw = MIN(chunk_cols, out_w - w0);
+            for (int j = 0; j < nw; j++) {
+                cols[j] = resize_bilinear_coord(w0 + j, cfg.stride[1], offset[1], cfg.shift, in_w);
+            }
+
+            for (int b = 0; b < out.shape[kTensorBatchDim]; b++) {
+                const MLI_PTR(int8_t) in_ptr = in.ptr + b * in.mem_stride[kTensorBatchDim] + c0 * in_ch_stride;
+                const int in_row_stride = in.mem_stride[kTensorHeightDim];
+                int cached_row[2] = {-1, -1};
+
+                for (int h = 0; h < out_h; h++) {
+                    const resize_coord_t r = resize_bilinear_coord(h, cfg.stride[0], offset[0], cfg.shift, in_h);
+                    // keep the cached row which is still needed, horizontal pass only for new rows
+                    int slot0 = (cached_row[0] == r.idx0) ? 0 : (cached_row[1] == r.idx0) ? 1 : -1;
+                    if (slot0 < 0) {
+                        slot0 = (cached_row[0] == r.idx1) ? 1 : 0;
+                        resize_bilinear_hpass_row(in_ptr + r.idx0 * in_row_stride, cols, phase, factor, w0, nw, nc,
+                                                  in_col_stride, in_ch_stride, one_fx, row_cache[slot0]);
+                        cached_row[slot0] = r.idx0;
+                    }
+                    const int slot1 = (r.idx1 == r.idx0) ? slot0 : slot0 ^ 1;
+                    if (cached_row[slot1] != r.idx1) {
+                        resize_bilinear_hpass_row(in_ptr + r.idx1 * in_row_stride, cols, phase, factor, w0, nw, nc,
+                                                  in_col_stride, in_ch_stride, one_fx, row_cache[slot1]);
+                        cached_row[slot1] = r.idx1;
+                    }
+
+                    const int32_t w_top = one_fx - r.frac;
+                    const int32_t w_bottom = r.frac;
+                    const int32_t *top = row_cache[slot0];
+                    const int32_t *bottom = row_cache[slot1];
+                    MLI_OUT_PTR(o_T) out_row = out.ptr + b * out.mem_stride[kTensorBatchDim]
+                            + h * out.mem_stride[kTensorHeightDim] + w0 * out_col_stride + c0 * out_ch_stride;
+                    for (int j = 0; j < nw; j++) {
+                        for (int c = 0; c < nc; c++) {
+                            const int32_t acc = top[j * nc + c] * w_top + bottom[j * nc + c] * w_bottom;
+                            resize_bilinear_store(acc, cfg.requant, &out_row[j * out_col_stride + c * out_ch_stride]);
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+// TODO: change mli_tensor to Tensor
+// TODO: change BHWC to BHWGC
+// offset is the position of the first output sample in the coordinates of the given input
+// (fixed point with cfg.shift fractional bits). It replaces cfg.offset for tiled processing,
+// where the tile origin may exceed the int16 range of the configuration.
+// Output is int32 or int8 if requantization is enabled in cfg.
+mli_status mli_resize_bilinear(const mli_tensor* in, const ResizeOpConfig& cfg,
+                               const int32_t offset[ResizeOpConfig::kResizeParamRank], mli_tensor* out) {
+
+    mli_prv_fx_init_dsp_ctrl();
+
+    const auto in_prv = mli_prv_get_generic_tensor<MLI_PTR(int8_t)>(in);
+    if (cfg.requant.enabled) {
+        MLI_ASSERT(out->el_type == MLI_EL_SA_8);
+        const auto out_prv = mli_prv_get_generic_tensor<MLI_OUT_PTR(int8_t)>(out);
+        resize_bilinear_separable<int8_t>(in_prv, cfg, offset, out_prv);
+    } else {
+        MLI_ASSERT(out->el_type == MLI_EL_SA_32);
+        const auto out_prv = mli_prv_get_generic_tensor<MLI_OUT_PTR(int32_t)>(out);
+        resize_bilinear_separable<int32_t>(in_prv, cfg, offset, out_prv);
+    }
 
     return MLI_STATUS_OK;
 }
 
+mli_status mli_resize_bilinear(const mli_tensor* in, const ResizeOpConfig& cfg, mli_tensor* out) {
+    const int32_t offset[ResizeOpConfig::kResizeParamRank] = {cfg.offset[0], cfg.offset[1]};
+    return mli_resize_bilinear(in, cfg, offset, out);
+}
+
 
 } // namespace ref
 } // namespace krn
@@ -51,7 +51,8 @@ mli_status ResizeBilinear_CS::AttachBufferOffsets(const OffsetBuffer &input,
 
 mli_status ResizeBilinear_CS::GetKernelPrivateData(void *kernel_private_data_buffer) {
 
-    MLI_ASSERT(m_in.get_elem_size() == sizeof(int8_t) && m_out.get_elem_size() == sizeof(int32_t));
+    MLI_ASSERT(m_in.get_elem_size() == sizeof(int8_t));
+    MLI_ASSERT(m_out.get_elem_size() == (m_cfg.requant.enabled ? sizeof(int8_t) : sizeof(int32_t)));
     MLI_ASSERT(m_in.get_tensor().get_rank() == m_out.get_tensor().get_rank());
 
     ResizeBilinearPrivateData opaque_obj;
@@ -27,6 +27,9 @@ namespace krn {
 ////////////////////////////////////////////////////////////////////////////////
 namespace ref {
 
+mli_status mli_resize_bilinear(const mli_tensor* in, const ResizeOpConfig& cfg,
+                               const int32_t offset[ResizeOpConfig::kResizeParamRank], mli_tensor* out);
+
 mli_status mli_resize_bilinear(const mli_tensor* in, const ResizeOpConfig& cfg, mli_tensor* out) ;
 
 } // namespace ref
@@ -18,29 +18,107 @@ namespace snps_arc::metaware::mli::ref {
 
 namespace mli_krn = ::snps_arc::metaware::mli::krn;
 
-// TODO: remove this after standart version of ResizeBilinear with Issue() will be added
-void run_mli_resize_bilinear_standalone(const mli_tensor* in, const ResizeOpConfig& cfg, mli_tensor* out){
+ResizeBilinear::ResizeBilinear(void* kernel_private_data_buffer, size_t size, uint64_t membases[], int num_mems) {
 
+    MLI_ASSERT(size == sizeof(ResizeBilinearPrivateData));
+    ResizeBilinearPrivateData private_buffer;
+    memcpy(&private_buffer, kernel_private_data_buffer, sizeof(ResizeBilinearPrivateData));
+    MLI_ASSERT(private_buffer.size == sizeof(ResizeBilinearPrivateData));
+    MLI_ASSERT(private_buffer.input.get_tensor().get_elem_size() == sizeof(int8_t));
+    MLI_ASSERT(private_buffer.output.get_tensor().get_elem_size() ==
+               (private_buffer.config.requant.enabled ? sizeof(int8_t) : sizeof(int32_t)));
 
-  MLI_ASSERT((cfg.stride[0] > 0) && (cfg.stride[1] > 0));
-  MLI_ASSERT((cfg.shift >= 1) && (cfg.shift <= 11));
+    // construct configurations
+    m_cfg = private_buffer.config;
 
-  // resizing factor is limited to 1/16 downscaling
-  if (cfg.shift >= 4) {
-    MLI_ASSERT(cfg.stride[0] > (1 << (cfg.shift - 4)));
-    MLI_ASSERT(cfg.stride[1] > (1 << (cfg.shift - 4)));
-  }
-  // resizing factor is limited to x16 upscaling
-  const int16_t val_16_fx = 16 << cfg.shift;
-  MLI_ASSERT(cfg.stride[0] < val_16_fx);
-  MLI_ASSERT(cfg.stride[1] < val_16_fx);
+    // construct Input tensor
+    m_input = private_buffer.input;
+    const auto input_tile_tensor = m_input.GetSubTensor();
+    InternalBuffer input_internal(private_buffer.input.get_buf(), membases, num_mems);
+    m_tile_input.rank = kResizeBilinearRank;
+    m_tile_input.el_type = MLI_EL_SA_8;
+    mli_prv_tensor_set_data_ptr(&m_tile_input, input_internal.get_ptr<int8_t>());
+    for(unsigned int i = 0; i < m_tile_input.rank ; i++){
+        m_tile_input.shape[i] = input_tile_tensor.get_dim(i);
+        m_tile_input.mem_stride[i] = private_buffer.input.get_mem_stride(i);
+    }
 
-  // offset range is limited to maximum 16 pixels 
-  MLI_ASSERT(cfg.offset[0] > -val_16_fx && cfg.offset[0] < val_16_fx);
-  MLI_ASSERT(cfg.offset[1] > -val_16_fx && cfg.offset[1] < val_16_fx);
+    // construct Output tensor
+    m_output = private_buffer.output;
+    const auto output_tile_tensor = m_output.GetSubTensor();
+    InternalBuffer output_internal(private_buffer.output.get_buf(), membases, num_mems);
+    m_tile_output.rank = kResizeBilinearRank;
+    if (m_cfg.requant.enabled) {
+        m_tile_output.el_type = MLI_EL_SA_8;
+        mli_prv_tensor_set_data_ptr(&m_tile_output, output_internal.get_ptr<int8_t>());
+    } else {
+        m_tile_output.el_type = MLI_EL_SA_32;
+        mli_prv_tensor_set_data_ptr(&m_tile_output, output_internal.get_ptr<int32_t>());
+    }
+    for(unsigned int i = 0; i < m_tile_output.rank ; i++){
+        m_tile_output.shape[i] = output_tile_tensor.get_dim(i);
+        m_tile_output.mem_stride[i] = private_buffer.output.get_mem_stride(i);
+    }
 
-  mli_krn::mli_resize_bilinear(in, cfg, out);
+    UpdateTileConfig();
 }
 
-}  // namespace snps_arc::metaware::mli::ref
+void ResizeBilinear::UpdateTileConfig() {
+    // Position of the first output sample of the tile in the full input is
+    // out_pos * stride + offset. Moving it to the origin of the input tile
+    // gives the offset to be used for the tile.
+    const int32_t spatial_dims[ResizeOpConfig::kResizeParamRank] = {kTensorHeightDim, kTensorWidthDim};
+
+    int32_t in_iter_pos[kResizeBilinearIterRank];
+    int32_t out_iter_pos[kResizeBilinearIterRank];
+    m_input.get_pos(in_iter_pos);
+    m_output.get_pos(out_iter_pos);
+
+    int32_t in_pos[kResizeBilinearRank] = {0};
+    int32_t out_pos[kResizeBilinearRank] = {0};
+    for (uint32_t r = 0; r < kResizeBilinearIterRank; r++) {
+        const int32_t in_dim = m_input.get_config().get_order(r);
+        const int32_t out_dim = m_output.get_config().get_order(r);
+        if (in_dim >= 0) in_pos[in_dim] = in_iter_pos[r];
+        if (out_dim >= 0) out_pos[out_dim] = out_iter_pos[r];
+    }
+
+    for (uint32_t i = 0; i < ResizeOpConfig::kResizeParamRank; i++) {
+        const int32_t dim = spatial_dims[i];
+        m_tile_offset[i] = out_pos[dim] * m_cfg.stride[i] + m_cfg.offset[i] - (in_pos[dim] << m_cfg.shift);
+    }
+}
+
+mli_status ResizeBilinear::Issue() {
+    mli_krn::mli_resize_bilinear(&m_tile_input, m_cfg, m_tile_offset, &m_tile_output);
+    return MLI_STATUS_OK;
+}
+
+mli_status ResizeBilinear::Prefetch() { return MLI_STATUS_OK; }
+
+mli_status ResizeBilinear::Update() {
+    m_input.Next();
+    m_output.Next();
+
+    m_input.GetSubTensor().get_dims(m_tile_input.shape);
+    m_output.GetSubTensor().get_dims(m_tile_output.shape);
 
+    UpdateTileConfig();
+
+    return MLI_STATUS_OK;
+}
+
+void ResizeBilinear::GetIOSizesAndOffsets(uint32_t input_size[kResizeBilinearRank], uint32_t output_size[kResizeBilinearRank],
+                                          int32_t input_offsets[kResizeBilinearRank], int32_t output_offsets[kResizeBilinearRank]) {
+    m_input.get_pos(input_offsets);
+
+    m_output.get_pos(output_offsets);
+
+    const auto input_tile_tensor = m_input.GetSubTensor();
+    input_tile_tensor.get_dims(input_size);
+
+    const auto output_tile_tensor = m_output.GetSubTensor();
+    output_tile_tensor.get_dims(output_size);
+}
+
+}  // namespace snps_arc::metaware::mli::ref
@@ -0,0 +1,325 @@
+/*
+* Copyright 2022, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+#ifndef _MLI_KRN_CONV2D_WINOGRAD_REF_H_
+#define _MLI_KRN_CONV2D_WINOGRAD_REF_H_
+
+#include <cstdint>
+#include <type_traits>
+
+#include "mli_api.h"
+#include "mli_math.h"
+#include "mli_math_macros.h"
+#include "mli_mem_info.h"
+#include "mli_private_types.h"
+#include "mli_prv_quant.h"
+#include "mli_prv_tensor.h"
+#include "mli_types.h"
+
+namespace mli {
+namespace krn {
+namespace ref {
+
+#pragma MLI_CODE_SECTION_START(".mli_lib")
+
+//========================================================
+// Winograd F(m x m, 3x3) transforms
+//========================================================
+// Integer form of the transforms from "Fast Algorithms for Convolutional Neural Networks"
+// (A. Lavin, S. Gray). Input (B^T) and output (A^T) transforms are integer already. Filter
+// transform G is scaled to integers, so the transformed filter is kFilterScale times larger
+// than the original one. With integer data the whole computation is exact, and the final
+// division by kFilterScale has no remainder: results are equal to the direct convolution.
+//
+// kGain is the product of the maximum L1 norms of the rows of G, B^T and A^T (each squared).
+// It bounds |A^T[U * V]A| / (max|x| * max|w| * in_ch) and is used to guard int64 accumulation.
+template <int tile_size>
+struct winograd_transform;
+
+template <>
+struct winograd_transform<4> {
+    static constexpr int kOutSize = 2;
+    static constexpr int32_t kFilterScale = 4;
+    static constexpr int64_t kGain = 9 * 4 * 9;
+    static constexpr int8_t kBt[4][4] = {
+        { 1,  0, -1,  0 },
+        { 0,  1,  1,  0 },
+        { 0, -1,  1,  0 },
+        { 0,  1,  0, -1 } };
+    static constexpr int8_t kG[4][3] = {
+        { 2,  0,  0 },
+        { 1,  1,  1 },
+        { 1, -1,  1 },
+        { 0,  0,  2 } };
+    static constexpr int8_t kAt[2][4] = {
+        { 1,  1,  1,  0 },
+        { 0,  1, -1, -1 } };
+};
+
+template <>
+struct winograd_transform<6> {
+    static constexpr int kOutSize = 4;
+    static constexpr int32_t kFilterScale = 576;
+    static constexpr int64_t kGain = 576 * 100 * 361;
+    static constexpr int8_t kBt[6][6] = {
+        { 4,  0, -5,  0,  1,  0 },
+        { 0, -4, -4,  1,  1,  0 },
+        { 0,  4, -4, -1,  1,  0 },
+        { 0, -2, -1,  2,  1,  0 },
+        { 0,  2, -1, -2,  1,  0 },
+        { 0,  4,  0, -5,  0,  1 } };
+    static constexpr int8_t kG[6][3] = {
+        {  6,  0,  0 },
+        { -4, -4, -4 },
+        { -4,  4, -4 },
+        {  1,  2,  4 },
+        {  1, -2,  4 },
+        {  0,  0, 24 } };
+    static constexpr int8_t kAt[4][6] = {
+        { 1,  1,  1,  1,  1,  0 },
+        { 0,  1, -1,  2, -2,  0 },
+        { 0,  1,  1,  4,  4,  0 },
+        { 0,  1, -1,  8, -8,  1 } };
+};
+
+// Number of output channels processed together for the same transformed input tile.
+// Partial sums of the block are kept on the stack (kWinogradOutChBlock * 36 * 8 bytes at most).
+constexpr int kWinogradOutChBlock = 8;
+
+//========================================================
+// Filter transform: U' = G' g G'^T
+//========================================================
+template <typename w_T, int tile_size>
+MLI_FORCE_INLINE void conv2d_winograd_weights(
+        const conv2d_weights_tensor_private_t<MLI_PTR(w_T)> &weights,
+        const conv2d_weights_tensor_private_t<MLI_PTR(int32_t)> &wino_weights) {
+    using transform = winograd_transform<tile_size>;
+    constexpr int kKrnSize = 3;
+
+    for (int in_ch_idx = 0; in_ch_idx < weights.in_ch; in_ch_idx++) {
+        for (int out_ch_idx = 0; out_ch_idx < weights.out_ch; out_ch_idx++) {
+            const MLI_PTR(w_T) w_ptr = weights.ptr
+                    + weights.in_ch_mem_stride * in_ch_idx
+                    + weights.out_ch_mem_stride * out_ch_idx;
+            MLI_PTR(int32_t) u_ptr = wino_weights.ptr
+                    + wino_weights.in_ch_mem_stride * in_ch_idx
+                    + wino_weights.out_ch_mem_stride * out_ch_idx;
+
+            int32_t gg[tile_size][kKrnSize];
+            for (int i = 0; i < tile_size; i++) {
+                for (int j = 0; j < kKrnSize; j++) {
+                    int32_t acc = 0;
+                    for (int k = 0; k < kKrnSize; k++) {
+                        acc += transform::kG[i][k] * (int32_t)w_ptr[weights.row_mem_stride * k + weights.col_mem_stride * j];
+                    }
+                    gg[i][j] = acc;
+                }
+            }
+            for (int i = 0; i < tile_size; i++) {
+                for (int j = 0; j < tile_size; j++) {
+                    int32_t acc = 0;
+                    for (int k = 0; k < kKrnSize; k++) {
+                        acc += gg[i][k] * transform::kG[j][k];
+                    }
+                    u_ptr[wino_weights.row_mem_stride * i + wino_weights.col_mem_stride * j] = acc;
+                }
+            }
+        }
+    }
+}
+
+template <typename w_T>
+MLI_FORCE_INLINE void conv2d_winograd_weights(
+        const mli_tensor *weights,
+        mli_tensor *wino_weights) {
+    const auto weights_prv = mli_prv_get_conv2d_weights_tensor_hwcn<MLI_PTR(w_T)>(weights);
+    const auto wino_prv = mli_prv_get_conv2d_weights_tensor_hwcn<MLI_PTR(int32_t)>(wino_weights);
+
+    if (wino_prv.kernel_height == 4) {
+        conv2d_winograd_weights<w_T, 4>(weights_prv, wino_prv);
+    } else {
+        MLI_ASSERT(wino_prv.kernel_height == 6);
+        conv2d_winograd_weights<w_T, 6>(weights_prv, wino_prv);
+    }
+}
+
+//========================================================
+// Winograd Convolution 2D (unit stride, 3x3 kernel)
+//========================================================
+template <typename i_T, typename o_T, typename b_T, typename acc_T, typename quant_T, int tile_size>
+MLI_FORCE_INLINE void conv2d_winograd(
+        const tensor_private_t<MLI_PTR(i_T)> &in,
+        const conv2d_weights_tensor_private_t<MLI_PTR(int32_t)> &wino_weights,
+        const MLI_PTR(b_T)  __restrict biases,
+        const tensor_private_t<MLI_CONV_OUT_PTR(o_T)> &out,
+        quant_T quant_params,
+        const int16_t in_offset,
+        const o_T val_min_limit,
+        const o_T val_max_limit,
+        const int padding_top, const int padding_left) {
+    // For each tile of m x m output points and each block of output channels:
+    //      M = sum_ci(U'[ci] * (B^T d[ci] B))   - elementwise product of transformed tiles
+    //      Y = (A^T M A) / kFilterScale         - exact, see winograd_transform
+    // Input is centered (d = x - in_offset) and padded points are zero, which is equal to
+    // the valid area logic of the direct convolution with weights_additive applied.
+    // Y is then processed the same way as the accumulator of the direct convolution.
+    using transform = winograd_transform<tile_size>;
+    constexpr int kOutSize = transform::kOutSize;
+
+    for (int H_idx = 0; H_idx < out.height; H_idx += kOutSize) {
+        for (int W_idx = 0; W_idx < out.width; W_idx += kOutSize) {
+            const int h_idx_in = H_idx - padding_top;
+            const int w_idx_in = W_idx - padding_left;
+            const int rows = MIN(kOutSize, out.height - H_idx);
+            const int clmns = MIN(kOutSize, out.width - W_idx);
+
+            for (int out_ch_beg = 0; out_ch_beg < out.ch; out_ch_beg += kWinogradOutChBlock) {
+                const int out_ch_num = MIN(kWinogradOutChBlock, out.ch - out_ch_beg);
+                int64_t m[kWinogradOutChBlock][tile_size][tile_size] = {};
+
+                for (int in_ch_idx = 0; in_ch_idx < in.ch; in_ch_idx++) {
+                    // Input transform: V = B^T d B
+                    int32_t d[tile_size][tile_size];
+                    for (int i = 0; i < tile_size; i++) {
+                        const int h = h_idx_in + i;
+                        for (int j = 0; j < tile_size; j++) {
+                            const int w = w_idx_in + j;
+                            const bool valid = h >= 0 && h < in.height && w >= 0 && w < in.width;
+                            d[i][j] = valid ? (int32_t)in.ptr[in.row_mem_stride * h + in.col_mem_stride * w
+                                                             + in.ch_mem_stride * in_ch_idx] - in_offset
+                                            : 0;
+                        }
+                    }
+                    int64_t bd[tile_size][tile_size];
+                    for (int i = 0; i < tile_size; i++) {
+                        for (int j = 0; j < tile_size; j++) {
+                            int64_t acc = 0;
+                            for (int k = 0; k < tile_size; k++) acc += transform::kBt[i][k] * (int64_t)d[k][j];
+                            bd[i][j] = acc;
+                        }
+                    }
+                    int64_t v[tile_size][tile_size];
+                    for (int i = 0; i < tile_size; i++) {
+                        for (int j = 0; j < tile_size; j++) {
+                            int64_t acc = 0;
+                            for (int k = 0; k < tile_size; k++) acc += bd[i][k] * transform::kBt[j][k];
+                            v[i][j] = acc;
+                        }
+                    }
+
+                    // Elementwise product with transformed filters
+                    const MLI_PTR(int32_t) u_ptr = wino_weights.ptr
+                            + wino_weights.in_ch_mem_stride * in_ch_idx
+                            + wino_weights.out_ch_mem_stride * out_ch_beg;
+                    for (int i = 0; i < tile_size; i++) {
+                        for (int j = 0; j < tile_size; j++) {
+                            const MLI_PTR(int32_t) u = u_ptr
+                                    + wino_weights.row_mem_stride * i
+                                    + wino_weights.col_mem_stride * j;
+                            for (int oc = 0; oc < out_ch_num; oc++) {
+                                m[oc][i][j] += (int64_t)u[wino_weights.out_ch_mem_stride * oc] * v[i][j];
+                            }
+                        }
+                    }
+                }
+
+                for (int oc = 0; oc < out_ch_num; oc++) {
+                    const int out_ch_idx = out_ch_beg + oc;
+
+                    // Output transform: Y = A^T M A
+                    int64_t am[kOutSize][tile_size];
+                    for (int i = 0; i < kOutSize; i++) {
+                        for (int j = 0; j < tile_size; j++) {
+                            int64_t acc = 0;
+                            for (int k = 0; k < tile_size; k++) acc += transform::kAt[i][k] * m[oc][k][j];
+                            am[i][j] = acc;
+                        }
+                    }
+
+                    quant_T ch_params = quant_params;
+                    mli::krn::ref::adjust_quant_params(&ch_params, out_ch_idx);
+                    for (int r = 0; r < rows; r++) {
+                        for (int c = 0; c < clmns; c++) {
+                            int64_t y = 0;
+                            for (int k = 0; k < tile_size; k++) y += am[r][k] * transform::kAt[c][k];
+
+                            acc_T accu = (acc_T)(y / transform::kFilterScale);
+                            accu = mli::krn::ref::bias_additive(&biases[out_ch_idx], accu, &ch_params);
+
+                            // Cast result to output type, apply built-in ReLU Applying and write result
+                            o_T out_val = mli::krn::ref::result_cast<o_T, acc_T, quant_T>(accu, &ch_params);
+                            out_val = MIN(out_val, val_max_limit);
+                            out_val = MAX(out_val, val_min_limit);
+
+                            MLI_CONV_OUT_PTR(o_T) out_ptr = out.ptr
+                                    + out.row_mem_stride * (H_idx + r)
+                                    + out.col_mem_stride * (W_idx + c)
+                                    + out.ch_mem_stride * out_ch_idx;
+                            *out_ptr = out_val;
+                        }
+                    }
+                }
+            } // for out_ch_beg
+        } // for W_idx
+    } // for H_idx
+}
+
+template <typename i_T, typename w_T, typename o_T, typename b_T, typename acc_T, typename quant_T>
+MLI_FORCE_INLINE mli_status conv2d_winograd_prepare_and_run(
+        const mli_tensor *in,
+        const mli_tensor *weights,
+        const mli_tensor *wino_weights,
+        const mli_tensor *bias,
+        const mli_conv2d_cfg *cfg,
+        mli_tensor *out) {
+    mli_prv_fx_init_dsp_ctrl();
+
+    constexpr bool asym = std::is_same<quant_T, s8asym_quant_specific_params>::value;
+    mli_minmax_t val_limit = mli_prv_get_relu_limits<o_T, asym>(&cfg->relu, out);
+
+    const MLI_PTR(b_T) bs = mli_prv_tensor_data_ptr<MLI_PTR(b_T)>(bias);
+    const auto in_prv = mli_prv_get_tensor_hwc<MLI_PTR(i_T)>(in);
+    const auto wino_prv = mli_prv_get_conv2d_weights_tensor_hwcn<MLI_PTR(int32_t)>(wino_weights);
+    const auto out_prv = mli_prv_get_tensor_hwc<MLI_CONV_OUT_PTR(o_T)>(out);
+
+    quant_T params;
+    define_quant_params(in, weights, bias, out, &params);
+    int16_t in_offset = 0;
+    if constexpr (asym) {
+        in_offset = params.in_offset;
+    }
+
+    // Accuracy guard: transformed tiles are accumulated in int64 and must not overflow.
+    // Otherwise the result would differ from the direct convolution.
+    const int64_t in_max = ((int64_t)1 << (sizeof(i_T) * 8 - 1)) + (in_offset < 0 ? -in_offset : in_offset);
+    const int64_t w_max = (int64_t)1 << (sizeof(w_T) * 8 - 1);
+    const int64_t gain = (wino_prv.kernel_height == 4) ? winograd_transform<4>::kGain : winograd_transform<6>::kGain;
+    if ((int64_t)in_prv.ch > INT64_MAX / gain / in_max / w_max) {
+        return MLI_STATUS_NOT_SUPPORTED;
+    }
+
+    if (wino_prv.kernel_height == 4) {
+        conv2d_winograd<i_T, o_T, b_T, acc_T, quant_T, 4>(
+                in_prv, wino_prv, bs, out_prv, params, in_offset,
+                (o_T)val_limit.min, (o_T)val_limit.max,
+                cfg->padding_top, cfg->padding_left);
+    } else {
+        conv2d_winograd<i_T, o_T, b_T, acc_T, quant_T, 6>(
+                in_prv, wino_prv, bs, out_prv, params, in_offset,
+                (o_T)val_limit.min, (o_T)val_limit.max,
+                cfg->padding_top, cfg->padding_left);
+    }
+    return MLI_STATUS_OK;
+}
+
+#pragma MLI_CODE_SECTION_END()
+} // namespace ref
+} // namespace krn
+} // namespace mli
+
+#endif // _MLI_KRN_CONV2D_WINOGRAD_REF_H_
@@ -17,6 +17,8 @@
 #include "mli_private_types.h"
 #include "mli_types.h"
 #include "mli_krn_dotprod.h"
+#include "mli_krn_gemm.h"
+#include "mli_krn_rescale.hpp"
 #include "mli_prv_layout.h"
 
 namespace mli {
@@ -371,6 +373,210 @@ MLI_FORCE_INLINE void depthwise_convolution2D_wrapper(
             padding_bot, padding_right);
 }
 
+//========================================================
+// Convolution 2D lowered to GEMM with implicit im2col
+//========================================================
+// Output point (H_idx, W_idx) is a row of GEMM result and output channel is a column.
+// Depth index k of both operands enumerates kernel window in (kernel row, kernel column,
+// input channel) order. Input window is gathered directly into packed panels, so no
+// intermediate im2col matrix is needed. Values out of input are replaced by padding value.
+template <typename i_T>
+struct conv2d_im2col_src_t {
+    tensor_private_t<MLI_PTR(i_T)> in;
+    int out_width;
+    int kernel_width;
+    int stride_height;
+    int stride_width;
+    int dilation_height;
+    int dilation_width;
+    int padding_top;
+    int padding_left;
+    int16_t pad_val;
+};
+
+template <typename w_T>
+struct conv2d_weights_src_t {
+    conv2d_weights_tensor_private_t<MLI_PTR(w_T)> weights;
+    int in_ch;
+    int16_t zero_point;
+};
+
+template <typename o_T>
+struct conv2d_out_dst_t {
+    tensor_private_t<MLI_CONV_OUT_PTR(o_T)> out;
+};
+
+template <typename i_T>
+static MLI_FORCE_INLINE void gemm_pack(
+        const conv2d_im2col_src_t<i_T> &src,
+        const int row0,
+        const int k0,
+        const int rows,
+        const int depth,
+        const int panel,
+        int16_t* __restrict dst) {
+    const auto &in = src.in;
+    for (int r = 0; r < rows; r++) {
+        const int H_idx = (row0 + r) / src.out_width;
+        const int W_idx = (row0 + r) % src.out_width;
+        const int h_idx_in = H_idx * src.stride_height - src.padding_top;
+        const int w_idx_in = W_idx * src.stride_width - src.padding_left;
+        int16_t* __restrict dst_ptr = dst + (r / panel) * depth * panel + r % panel;
+
+        // Walk through the kernel window in chunks of input channels,
+        // as a whole chunk is either inside of the input or in the padding area
+        int in_ch_idx = k0 % in.ch;
+        int krn_w_idx = (k0 / in.ch) % src.kernel_width;
+        int krn_h_idx = (k0 / in.ch) / src.kernel_width;
+        for (int kk = 0; kk < depth;) {
+            const int len = MIN(in.ch - in_ch_idx, depth - kk);
+            const int h = h_idx_in + krn_h_idx * src.dilation_height;
+            const int w = w_idx_in + krn_w_idx * src.dilation_width;
+            if (h >= 0 && h < in.height && w >= 0 && w < in.width) {
+                const MLI_PTR(i_T) in_ptr = in.ptr + h * in.row_mem_stride + w * in.col_mem_stride
+                        + in_ch_idx * in.ch_mem_stride;
+                for (int i = 0; i < len; i++) {
+                    dst_ptr[(kk + i) * panel] = static_cast<int16_t>(in_ptr[i * in.ch_mem_stride]);
+                }
+            } else {
+                for (int i = 0; i < len; i++) {
+                    dst_ptr[(kk + i) * panel] = src.pad_val;
+                }
+            }
+            kk += len;
+            in_ch_idx = 0;
+            if (++krn_w_idx == src.kernel_width) {
+                krn_w_idx = 0;
+                krn_h_idx++;
+            }
+        }
+    }
+}
+
+template <typename w_T>
+static MLI_FORCE_INLINE void gemm_pack(
+        const conv2d_weights_src_t<w_T> &src,
+        const int row0,
+        const int k0,
+        const int rows,
+        const int depth,
+        const int panel,
+        int16_t* __restrict dst) {
+    const auto &weights = src.weights;
+    for (int r = 0; r < rows; r++) {
+        const MLI_PTR(w_T) w_ptr_ch = weights.ptr + (row0 + r) * weights.out_ch_mem_stride;
+        int16_t* __restrict dst_ptr = dst + (r / panel) * depth * panel + r % panel;
+
+        int in_ch_idx = k0 % src.in_ch;
+        int krn_w_idx = (k0 / src.in_ch) % weights.kernel_width;
+        int krn_h_idx = (k0 / src.in_ch) / weights.kernel_width;
+        for (int kk = 0; kk < depth;) {
+            const int len = MIN(src.in_ch - in_ch_idx, depth - kk);
+            const MLI_PTR(w_T) w_ptr = w_ptr_ch + krn_h_idx * weights.row_mem_stride
+                    + krn_w_idx * weights.col_mem_stride + in_ch_idx * weights.in_ch_mem_stride;
+            for (int i = 0; i < len; i++) {
+                dst_ptr[(kk + i) * panel] = static_cast<int16_t>(w_ptr[i * weights.in_ch_mem_stride] - src.zero_point);
+            }
+            kk += len;
+            in_ch_idx = 0;
+            if (++krn_w_idx == weights.kernel_width) {
+                krn_w_idx = 0;
+                krn_h_idx++;
+            }
+        }
+    }
+}
+
+template <typename o_T>
+static MLI_FORCE_INLINE void gemm_store(
+        const conv2d_out_dst_t<o_T> &dst,
+        const int m0,
+        const int n0,
+        const int rows,
+        const int cols,
+        const int32_t acc[kGemmMR][kGemmNR],
+        const bool accumulate) {
+    const auto &out = dst.out;
+    for (int r = 0; r < rows; r++) {
+        const int H_idx = (m0 + r) / out.width;
+        const int W_idx = (m0 + r) % out.width;
+        MLI_CONV_OUT_PTR(o_T) out_ptr = out.ptr + H_idx * out.row_mem_stride + W_idx * out.col_mem_stride
+                + n0 * out.ch_mem_stride;
+        for (int c = 0; c < cols; c++) {
+            const int32_t prev = accumulate ? static_cast<int32_t>(out_ptr[c * out.ch_mem_stride]) : 0;
+            out_ptr[c * out.ch_mem_stride] = static_cast<o_T>(prev + acc[r][c]);
+        }
+    }
+}
+
+template <typename i_T, typename w_T, typename o_T>
+MLI_FORCE_INLINE void convolution2D_gemm(
+        const tensor_private_t<MLI_PTR(i_T)> &in,
+        const conv2d_weights_tensor_private_t<MLI_PTR(w_T)> &weights_full,
+        const conv2d_weights_tensor_private_t<MLI_PTR(w_T)> &weights,
+        const tensor_private_t<MLI_CONV_OUT_PTR(o_T)> &out,
+        const int_quant_specific_params &quant_params,
+        const int stride_height, const int stride_width,
+        const int dilation_height, const int dilation_width,
+        const int padding_top, const int padding_left) {
+    // MLI3.0 convolution without bias (see convolution2D):
+    //      out_val = sum_full((x_pad) * (w - w_zp))
+    // where x_pad is equal to x_zp for all padded values. It's a plain GEMM of centered weights
+    // and input window padded with x_zp, which is calculated by the blocked GEMM engine.
+    // In case of transpose convolution, weights is a subtensor of weights_full and
+    // x_zp * sum(w - w_zp) for the rest of full kernel is added afterward.
+    static_assert(sizeof(i_T) == sizeof(int8_t) && sizeof(w_T) == sizeof(int8_t),
+                  "GEMM lowering requires 8-bit operands");
+    const int m = out.height * out.width;
+    const int n = out.ch;
+    const int k = weights.kernel_height * weights.kernel_width * in.ch;
+    if (m <= 0 || n <= 0)
+        return;
+
+    conv2d_im2col_src_t<i_T> a_src = {
+        in, out.width, weights.kernel_width,
+        stride_height, stride_width, dilation_height, dilation_width,
+        padding_top, padding_left, quant_params.in_offset};
+    conv2d_weights_src_t<w_T> b_src = {weights, in.ch, quant_params.weights_offset};
+    conv2d_out_dst_t<o_T> c_dst = {out};
+    mli::krn::gemm(a_src, b_src, c_dst, m, n, k);
+
+    const bool is_subtensor = weights.kernel_height != weights_full.kernel_height ||
+                              weights.kernel_width != weights_full.kernel_width;
+    if (!is_subtensor || quant_params.in_offset == 0)
+        return;
+
+    const int32_t w_zp = quant_params.weights_offset;
+    for (int out_ch_idx = 0; out_ch_idx < n; out_ch_idx++) {
+        int32_t w_sum_full = 0;
+        int32_t w_sum = 0;
+        for (int c = 0; c < in.ch; c++) {
+            for (int h = 0; h < weights_full.kernel_height; h++) {
+                for (int w = 0; w < weights_full.kernel_width; w++) {
+                    w_sum_full += weights_full.ptr[out_ch_idx * weights_full.out_ch_mem_stride
+                            + h * weights_full.row_mem_stride + w * weights_full.col_mem_stride
+                            + c * weights_full.in_ch_mem_stride] - w_zp;
+                }
+            }
+            for (int h = 0; h < weights.kernel_height; h++) {
+                for (int w = 0; w < weights.kernel_width; w++) {
+                    w_sum += weights.ptr[out_ch_idx * weights.out_ch_mem_stride
+                            + h * weights.row_mem_stride + w * weights.col_mem_stride
+                            + c * weights.in_ch_mem_stride] - w_zp;
+                }
+            }
+        }
+        const int32_t additive = quant_params.in_offset * (w_sum_full - w_sum);
+        for (int H_idx = 0; H_idx < out.height; H_idx++) {
+            for (int W_idx = 0; W_idx < out.width; W_idx++) {
+                MLI_CONV_OUT_PTR(o_T) out_ptr = out.ptr + H_idx * out.row_mem_stride
+                        + W_idx * out.col_mem_stride + out_ch_idx * out.ch_mem_stride;
+                *out_ptr = static_cast<o_T>(*out_ptr + additive);
+            }
+        }
+    }
+}
+
 //====================================================================================
 // Common routin for pre-calculation of various convolution parameters and running it.
 //====================================================================================
@@ -417,6 +623,16 @@ MLI_FORCE_INLINE void conv2d_run(
     // Applying main convolution core (depends on layout)
     //=======================================================================
     if (conv_type == CONV_GENERAL) {
+        if constexpr (std::is_same<quant_T, int_quant_specific_params>::value) {
+            // MLI3.0 convolution (no bias) is lowered to the blocked GEMM
+            if (bs == nullptr) {
+                mli::krn::convolution2D_gemm<i_T, w_T, o_T>(
+                        in_prv, weights_prv, weights_prv, out_prv, params,
+                        stride_height, stride_width, dilation_height, dilation_width,
+                        padding_top, padding_left);
+                return;
+            }
+        }
         mli::krn::convolution2D<i_T, w_T, o_T, b_T, acc_T, quant_T, fix_kernel_width, fix_kernel_height>(
                 in_prv, weights_prv, weights_prv, bs, out_prv, cent_area, params,
                 (o_T)val_limit.min, (o_T)val_limit.max,
@@ -436,17 +652,14 @@ MLI_FORCE_INLINE void conv2d_run(
 
 template <typename i_T, typename w_T, typename o_T, typename b_T, typename acc_T, typename quant_T,
           mli_layout_type data_layout, mli_conv_type conv_type, int fix_kernel_width, int fix_kernel_height>
-MLI_FORCE_INLINE void conv2d_prepare_and_run(
+MLI_FORCE_INLINE void conv2d_run_prepared(
         const mli_tensor *in,
         const mli_tensor *weights,
         const mli_tensor *bias,
         const mli_conv2d_cfg *cfg,
+        const mli_minmax_t val_limit,
+        const quant_T &params,
         mli_tensor *out) {
-    mli_prv_fx_init_dsp_ctrl();
-
-    constexpr bool asym = std::is_same<quant_T, s8asym_quant_specific_params>::value;
-    mli_minmax_t val_limit = mli_prv_get_relu_limits<o_T, asym>(&cfg->relu, out);
-
     // For MLI3.0, bias will be added in the subsequent operation
     const bool has_bias = bias != nullptr;
     const MLI_PTR(b_T) bs = nullptr;
@@ -474,11 +687,121 @@ MLI_FORCE_INLINE void conv2d_prepare_and_run(
             mli_prv_get_tensor_hwc<MLI_CONV_OUT_PTR(o_T)>(out)
             : mli_prv_get_tensor_chw<MLI_CONV_OUT_PTR(o_T)>(out);
 
+    conv2d_run<i_T, w_T, o_T, b_T, acc_T, quant_T, conv_type, fix_kernel_width, fix_kernel_height>(
+            in_prv, weights_prv, bs, out_prv, val_limit, cfg, params);
+}
+
+template <typename i_T, typename w_T, typename o_T, typename b_T, typename acc_T, typename quant_T,
+          mli_layout_type data_layout, mli_conv_type conv_type, int fix_kernel_width, int fix_kernel_height>
+MLI_FORCE_INLINE void conv2d_prepare_and_run(
+        const mli_tensor *in,
+        const mli_tensor *weights,
+        const mli_tensor *bias,
+        const mli_conv2d_cfg *cfg,
+        mli_tensor *out) {
+    mli_prv_fx_init_dsp_ctrl();
+
+    constexpr bool asym = std::is_same<quant_T, s8asym_quant_specific_params>::value;
+    mli_minmax_t val_limit = mli_prv_get_relu_limits<o_T, asym>(&cfg->relu, out);
+
     quant_T params;
     define_quant_params(in, weights, bias, out, &params);
 
-    conv2d_run<i_T, w_T, o_T, b_T, acc_T, quant_T, conv_type, fix_kernel_width, fix_kernel_height>(
-            in_prv, weights_prv, bs, out_prv, val_limit, cfg, params);
+    conv2d_run_prepared<i_T, w_T, o_T, b_T, acc_T, quant_T, data_layout, conv_type, fix_kernel_width, fix_kernel_height>(
+            in, weights, bias, cfg, val_limit, params, out);
+}
+
+template <mli_conv_type conv_type>
+MLI_FORCE_INLINE void conv2d_sa8_prepare(
+        const mli_tensor *in,
+        const mli_tensor *weights,
+        const mli_tensor *bias,
+        const mli_conv2d_cfg *cfg,
+        const mli_tensor *out,
+        mli_conv2d_prepared *prepared) {
+    s8asym_quant_specific_params params;
+    define_quant_params(in, weights, bias, out, &params);
+    const mli_minmax_t val_limit = mli_prv_get_relu_limits<int8_t, true>(&cfg->relu, out);
+
+    prepared->cfg = *cfg;
+    prepared->weights = weights;
+    prepared->bias = bias;
+    prepared->weight_scales = params.weight_scales;
+    prepared->weight_shifts = params.weight_shifts;
+    prepared->weight_dim = params.weight_dim;
+    prepared->in_to_out_shift = params.in_to_out_shift;
+    prepared->in_to_out_scales_ratio = params.in_to_out_scales_ratio;
+    prepared->in_offset = params.in_offset;
+    prepared->out_offset = params.out_offset;
+    prepared->weights_offset = params.weights_offset;
+    prepared->relu_min = (int16_t)val_limit.min;
+    prepared->relu_max = (int16_t)val_limit.max;
+
+    // Choose the same specialization as the user would by the kernel size.
+    // The 1x1 specialization ignores padding, so it's only used for unpadded layers.
+    const int kernel_width = weights->shape[KRNL_W_DIM_HWCN];
+    const int kernel_height = weights->shape[KRNL_H_DIM_HWCN];
+    const bool no_pad = cfg->padding_top == 0 && cfg->padding_bottom == 0 &&
+                        cfg->padding_left == 0 && cfg->padding_right == 0;
+    prepared->kernel_size = KRN_SZ_VAR;
+    if (kernel_width == kernel_height) {
+        if ((kernel_width == KRN_SZ_1 && conv_type == CONV_GENERAL && no_pad) ||
+                kernel_width == KRN_SZ_3 || kernel_width == KRN_SZ_5) {
+            prepared->kernel_size = (uint8_t)kernel_width;
+        }
+    }
+}
+
+template <typename acc_T, mli_layout_type data_layout, mli_conv_type conv_type>
+MLI_FORCE_INLINE void conv2d_sa8_run_prepared(
+        const mli_conv2d_prepared *prepared,
+        const mli_tensor *in,
+        mli_tensor *out) {
+    mli_prv_fx_init_dsp_ctrl();
+
+    s8asym_quant_specific_params params;
+    params.in_offset = prepared->in_offset;
+    params.out_offset = prepared->out_offset;
+    params.weights_offset = prepared->weights_offset;
+    params.weight_scales = prepared->weight_scales;
+    params.weight_shifts = prepared->weight_shifts;
+    params.weight_dim = prepared->weight_dim;
+    params.in_to_out_scales_ratio = prepared->in_to_out_scales_ratio;
+    params.in_to_out_shift = prepared->in_to_out_shift;
+
+    mli_minmax_t val_limit;
+    val_limit.min = prepared->relu_min;
+    val_limit.max = prepared->relu_max;
+
+    const mli_tensor *weights = prepared->weights;
+    const mli_tensor *bias = prepared->bias;
+    const mli_conv2d_cfg *cfg = &prepared->cfg;
+    switch (prepared->kernel_size) {
+    case KRN_SZ_1:
+        if constexpr (conv_type == CONV_GENERAL) {
+            conv2d_run_prepared<int8_t, int8_t, int8_t, int32_t, acc_T, s8asym_quant_specific_params,
+                                data_layout, conv_type, KRN_SZ_1, KRN_SZ_1>(
+                    in, weights, bias, cfg, val_limit, params, out);
+            break;
+        }
+        MLI_ASSERT(0);
+        break;
+    case KRN_SZ_3:
+        conv2d_run_prepared<int8_t, int8_t, int8_t, int32_t, acc_T, s8asym_quant_specific_params,
+                            data_layout, conv_type, KRN_SZ_3, KRN_SZ_3>(
+                in, weights, bias, cfg, val_limit, params, out);
+        break;
+    case KRN_SZ_5:
+        conv2d_run_prepared<int8_t, int8_t, int8_t, int32_t, acc_T, s8asym_quant_specific_params,
+                            data_layout, conv_type, KRN_SZ_5, KRN_SZ_5>(
+                in, weights, bias, cfg, val_limit, params, out);
+        break;
+    default:
+        conv2d_run_prepared<int8_t, int8_t, int8_t, int32_t, acc_T, s8asym_quant_specific_params,
+                            data_layout, conv_type, KRN_SZ_VAR, KRN_SZ_VAR>(
+                in, weights, bias, cfg, val_limit, params, out);
+        break;
+    }
 }
 #pragma MLI_CODE_SECTION_END()
 } // namespace ref
@@ -488,6 +811,141 @@ MLI_FORCE_INLINE void conv2d_prepare_and_run(
 namespace snps_arc::metaware::mli::ref {
 #pragma MLI_CODE_SECTION_START(".mli_lib")
 
+//========================================================
+// Convolution 2D for CHW feature maps
+//========================================================
+// Range [beg, end) of output indexes which read input at (idx * stride + offset) inside of input.
+static MLI_FORCE_INLINE void conv2d_chw_valid_range(const int out_size, const int in_size,
+                                                    const int stride, const int offset,
+                                                    int &beg, int &end) {
+    beg = offset < 0 ? CEIL_DIV(-offset, stride) : 0;
+    end = in_size > offset ? MIN(out_size, CEIL_DIV(in_size - offset, stride)) : 0;
+}
+
+// Accumulate (x - x_zp) * w_val for a single kernel point over the whole output plane.
+template <typename i_T, typename o_T>
+static MLI_FORCE_INLINE void conv2d_chw_accumulate(
+        const MLI_PTR(i_T) in_plane,
+        MLI_CONV_OUT_PTR(o_T) out_plane,
+        const tensor_private_t<MLI_PTR(i_T)> &in,
+        const tensor_private_t<MLI_CONV_OUT_PTR(o_T)> &out,
+        const int32_t w_val, const int32_t x_zp,
+        const int h_offset, const int w_offset,
+        const int stride_height, const int stride_width) {
+    int h_beg, h_end, w_beg, w_end;
+    conv2d_chw_valid_range(out.height, in.height, stride_height, h_offset, h_beg, h_end);
+    conv2d_chw_valid_range(out.width, in.width, stride_width, w_offset, w_beg, w_end);
+    const int in_col_inc = in.col_mem_stride * stride_width;
+    for (int H_idx = h_beg; H_idx < h_end; H_idx++) {
+        const MLI_PTR(i_T) in_ptr = in_plane + (H_idx * stride_height + h_offset) * in.row_mem_stride
+                + (w_beg * stride_width + w_offset) * in.col_mem_stride;
+        MLI_CONV_OUT_PTR(o_T) out_ptr = out_plane + H_idx * out.row_mem_stride + w_beg * out.col_mem_stride;
+        for (int W_idx = w_beg; W_idx < w_end; W_idx++) {
+            *out_ptr = static_cast<o_T>(*out_ptr + (static_cast<int32_t>(*in_ptr) - x_zp) * w_val);
+            in_ptr += in_col_inc;
+            out_ptr += out.col_mem_stride;
+        }
+    }
+}
+
+template <typename w_T, typename o_T>
+static MLI_FORCE_INLINE void conv2d_chw_init_plane(
+        const MLI_PTR(w_T) w_ptr,
+        MLI_CONV_OUT_PTR(o_T) out_plane,
+        const conv2d_weights_tensor_private_t<MLI_PTR(w_T)> &weights,
+        const tensor_private_t<MLI_CONV_OUT_PTR(o_T)> &out,
+        const int in_ch, const int32_t x_zp, const int32_t w_zp) {
+    int32_t w_sum = 0;
+    for (int c = 0; c < in_ch; c++) {
+        for (int h = 0; h < weights.kernel_height; h++) {
+            for (int w = 0; w < weights.kernel_width; w++) {
+                w_sum += w_ptr[c * weights.in_ch_mem_stride + h * weights.row_mem_stride
+                        + w * weights.col_mem_stride] - w_zp;
+            }
+        }
+    }
+    const o_T init_val = static_cast<o_T>(x_zp * w_sum);
+    for (int H_idx = 0; H_idx < out.height; H_idx++) {
+        for (int W_idx = 0; W_idx < out.width; W_idx++) {
+            out_plane[H_idx * out.row_mem_stride + W_idx * out.col_mem_stride] = init_val;
+        }
+    }
+}
+
+template <typename i_T, typename w_T, typename o_T>
+MLI_FORCE_INLINE void convolution2D_chw(
+        const tensor_private_t<MLI_PTR(i_T)> &in,
+        const conv2d_weights_tensor_private_t<MLI_PTR(w_T)> &weights,
+        const tensor_private_t<MLI_CONV_OUT_PTR(o_T)> &out,
+        const ::mli::krn::int_quant_specific_params &quant_params,
+        const int stride_height, const int stride_width,
+        const int dilation_height, const int dilation_width,
+        const int padding_top, const int padding_left) {
+    // MLI3.0 convolution without bias (see convolution2D) where the width is the inner-most dimension:
+    //      out_val = sum_full(x_pad * (w - w_zp))
+    //              = x_zp * sum_full(w - w_zp) + sum_valid((x - x_zp) * (w - w_zp))
+    // Output channel plane is initialized by the first term and the second one is accumulated
+    // kernel point by kernel point. Each point is applied to whole rows of input plane, so the
+    // inner loop walks along the width of both input and output.
+    const int32_t x_zp = quant_params.in_offset;
+    const int32_t w_zp = quant_params.weights_offset;
+    for (int out_ch_idx = 0; out_ch_idx < out.ch; out_ch_idx++) {
+        const MLI_PTR(w_T) w_ptr = weights.ptr + out_ch_idx * weights.out_ch_mem_stride;
+        MLI_CONV_OUT_PTR(o_T) out_plane = out.ptr + out_ch_idx * out.ch_mem_stride;
+        conv2d_chw_init_plane<w_T, o_T>(w_ptr, out_plane, weights, out, in.ch, x_zp, w_zp);
+
+        for (int in_ch_idx = 0; in_ch_idx < in.ch; in_ch_idx++) {
+            const MLI_PTR(i_T) in_plane = in.ptr + in_ch_idx * in.ch_mem_stride;
+            for (int h = 0; h < weights.kernel_height; h++) {
+                for (int w = 0; w < weights.kernel_width; w++) {
+                    const int32_t w_val = w_ptr[in_ch_idx * weights.in_ch_mem_stride
+                            + h * weights.row_mem_stride + w * weights.col_mem_stride] - w_zp;
+                    if (w_val == 0)
+                        continue;
+                    conv2d_chw_accumulate<i_T, o_T>(in_plane, out_plane, in, out, w_val, x_zp,
+                                                    h * dilation_height - padding_top,
+                                                    w * dilation_width - padding_left,
+                                                    stride_height, stride_width);
+                }
+            }
+        }
+    }
+}
+
+template <typename i_T, typename w_T, typename o_T>
+MLI_FORCE_INLINE void depthwise_convolution2D_chw(
+        const tensor_private_t<MLI_PTR(i_T)> &in,
+        const conv2d_weights_tensor_private_t<MLI_PTR(w_T)> &weights,
+        const tensor_private_t<MLI_CONV_OUT_PTR(o_T)> &out,
+        const ::mli::krn::int_quant_specific_params &quant_params,
+        const int stride_height, const int stride_width,
+        const int dilation_height, const int dilation_width,
+        const int padding_top, const int padding_left) {
+    // The same as convolution2D_chw, but each output channel plane depends only on the
+    // input channel plane with the same index.
+    MLI_ASSERT(in.ch == out.ch);
+    const int32_t x_zp = quant_params.in_offset;
+    const int32_t w_zp = quant_params.weights_offset;
+    for (int ch_idx = 0; ch_idx < out.ch; ch_idx++) {
+        const MLI_PTR(i_T) in_plane = in.ptr + ch_idx * in.ch_mem_stride;
+        const MLI_PTR(w_T) w_ptr = weights.ptr + ch_idx * weights.out_ch_mem_stride;
+        MLI_CONV_OUT_PTR(o_T) out_plane = out.ptr + ch_idx * out.ch_mem_stride;
+        conv2d_chw_init_plane<w_T, o_T>(w_ptr, out_plane, weights, out, /*in_ch*/ 1, x_zp, w_zp);
+
+        for (int h = 0; h < weights.kernel_height; h++) {
+            for (int w = 0; w < weights.kernel_width; w++) {
+                const int32_t w_val = w_ptr[h * weights.row_mem_stride + w * weights.col_mem_stride] - w_zp;
+                if (w_val == 0)
+                    continue;
+                conv2d_chw_accumulate<i_T, o_T>(in_plane, out_plane, in, out, w_val, x_zp,
+                                                h * dilation_height - padding_top,
+                                                w * dilation_width - padding_left,
+                                                stride_height, stride_width);
+            }
+        }
+    }
+}
+
 template <typename i_T, typename w_T, typename o_T, typename acc_T,
           mli_layout_type data_layout, ::mli::mli_conv_type conv_type,
           unsigned io_rank, unsigned w_rank, typename cfg_T>
@@ -504,10 +962,8 @@ MLI_FORCE_INLINE void conv2d_prepare_and_run(
     // The data type of ZP should be same as the tensor they belong to
     define_quant_params<i_T, w_T>(in, weights, &params);
 
-    MLI_ASSERT(data_layout == LAYOUT_HWC);
-
-    // I/O Tensor -> tensor_private_t
-    auto in_prv = mli_prv_get_tensor_hwc<MLI_PTR(i_T)>(in.t);
+    static_assert(data_layout == LAYOUT_HWC || data_layout == LAYOUT_CHW,
+                  "Only HWC and CHW feature maps are supported");
 
     conv2d_weights_tensor_private_t<MLI_PTR(w_T)> weights_prv;
     if constexpr (w_rank == 5) {
@@ -520,15 +976,35 @@ MLI_FORCE_INLINE void conv2d_prepare_and_run(
         MLI_ASSERT(false);
     }
 
+    if constexpr (std::is_same_v<cfg_T, Conv2DConfig>) {
+        MLI_ASSERT(cfg.groups == 1);
+    }
+
+    if constexpr (data_layout == LAYOUT_CHW) {
+        const auto in_prv = mli_prv_get_tensor_chw<MLI_PTR(i_T)>(in.t);
+        const auto out_prv = mli_prv_get_tensor_chw<MLI_CONV_OUT_PTR(o_T)>(out);
+        if constexpr (conv_type == ::mli::CONV_GENERAL) {
+            convolution2D_chw<i_T, w_T, o_T>(
+                    in_prv, weights_prv, out_prv, params,
+                    cfg.stride[0], cfg.stride[1], cfg.dilation[0], cfg.dilation[1],
+                    cfg.padding_begin[0], cfg.padding_begin[1]);
+        } else {
+            depthwise_convolution2D_chw<i_T, w_T, o_T>(
+                    in_prv, weights_prv, out_prv, params,
+                    cfg.stride[0], cfg.stride[1], cfg.dilation[0], cfg.dilation[1],
+                    cfg.padding_begin[0], cfg.padding_begin[1]);
+        }
+        return;
+    }
+
+    // I/O Tensor -> tensor_private_t
+    auto in_prv = mli_prv_get_tensor_hwc<MLI_PTR(i_T)>(in.t);
     auto out_prv = mli_prv_get_tensor_hwc<MLI_CONV_OUT_PTR(o_T)>(out);
 
     // no bias and relu in MLI3.0
     const MLI_PTR(b_T) bs = nullptr;
     mli_minmax_t val_limit = {std::numeric_limits<o_T>::min(), std::numeric_limits<o_T>::max()};
 
-    if constexpr (std::is_same_v<cfg_T, Conv2DConfig>) {
-        MLI_ASSERT(cfg.groups == 1);
-    }
     mli_conv2d_cfg krn_cfg;
     krn_cfg.stride_height = cfg.stride[0];
     krn_cfg.stride_width = cfg.stride[1];
@@ -546,6 +1022,99 @@ MLI_FORCE_INLINE void conv2d_prepare_and_run(
             in_prv, weights_prv, bs, out_prv, val_limit, &krn_cfg, params);
 }
 
+//====================================================================================
+// Convolution with fused epilogue (see ConvEpilogueConfig)
+//====================================================================================
+// Per output channel parameters of the epilogue. Pointers are already shifted to the
+// first output channel of the current tile.
+struct conv2d_epilogue_params_t {
+    const int32_t *in_bias;
+    const int16_t *scale;
+    const int8_t *shift;
+    const int8_t *out_bias;
+    const int8_t *lut;       // 256 entries or nullptr
+    int8_t clip_min;
+    int8_t clip_max;
+};
+
+// GEMM destination which requantizes completely accumulated values to int8
+template <typename o_T>
+struct conv2d_epilogue_dst_t {
+    tensor_private_t<MLI_CONV_OUT_PTR(o_T)> out;
+    conv2d_epilogue_params_t params;
+};
+
+template <typename o_T>
+static MLI_FORCE_INLINE void gemm_store(
+        const conv2d_epilogue_dst_t<o_T> &dst,
+        const int m0,
+        const int n0,
+        const int rows,
+        const int cols,
+        const int32_t acc[::mli::krn::ref::kGemmMR][::mli::krn::ref::kGemmNR],
+        const bool accumulate) {
+    static_assert(sizeof(o_T) == sizeof(int8_t), "Epilogue produces 8-bit output");
+    // Partial sums can't be kept in 8-bit output (see gemm_full_depth)
+    MLI_ASSERT(!accumulate);
+    const auto &out = dst.out;
+    const auto &p = dst.params;
+    for (int r = 0; r < rows; r++) {
+        const int H_idx = (m0 + r) / out.width;
+        const int W_idx = (m0 + r) % out.width;
+        MLI_CONV_OUT_PTR(o_T) out_ptr = out.ptr + H_idx * out.row_mem_stride + W_idx * out.col_mem_stride
+                + n0 * out.ch_mem_stride;
+        for (int c = 0; c < cols; c++) {
+            const int ch = n0 + c;
+            o_T val = krn::ref::rescale_value<int32_t, o_T>(acc[r][c], p.in_bias[ch], p.out_bias[ch],
+                                                            p.scale[ch], p.shift[ch]);
+            val = MIN(MAX(val, p.clip_min), p.clip_max);
+            if (p.lut != nullptr) {
+                val = p.lut[val - INT8_MIN];
+            }
+            out_ptr[c * out.ch_mem_stride] = val;
+        }
+    }
+}
+
+template <typename i_T, typename w_T, typename o_T, mli_layout_type data_layout,
+          unsigned io_rank, unsigned w_rank>
+MLI_FORCE_INLINE void conv2d_epilogue_prepare_and_run(
+    const QTensor<InternalBuffer, io_rank> &in,
+    const QTensor<InternalBuffer, w_rank> &weights,
+    Tensor<InternalBuffer, io_rank> &out, const Conv2DConfig &cfg,
+    const conv2d_epilogue_params_t &epilogue) {
+    // Accumulators of the whole kernel depth are rescaled, clipped and passed through LUT
+    // right after the micro-kernel, so the 32-bit intermediate result never goes to memory.
+    static_assert(w_rank == 5, "Only Conv2d weights layout is supported");
+    ::mli::krn::int_quant_specific_params params;
+    define_quant_params<i_T, w_T>(in, weights, &params);
+
+    MLI_ASSERT(cfg.groups == 1);
+    MLI_ASSERT(weights.t.get_dim(kKernelGroupDim) == 1);
+    // The GEMM gathers and stores values by strides, so CHW feature maps are only described differently
+    static_assert(data_layout == LAYOUT_HWC || data_layout == LAYOUT_CHW,
+                  "Only HWC and CHW feature maps are supported");
+    const auto in_prv = data_layout == LAYOUT_CHW ? mli_prv_get_tensor_chw<MLI_PTR(i_T)>(in.t)
+                                                  : mli_prv_get_tensor_hwc<MLI_PTR(i_T)>(in.t);
+    const auto weights_prv = mli_prv_get_conv2d_weights_tensor_hwcn<MLI_PTR(w_T)>(weights.t);
+    const auto out_prv = data_layout == LAYOUT_CHW ? mli_prv_get_tensor_chw<MLI_CONV_OUT_PTR(o_T)>(out)
+                                                   : mli_prv_get_tensor_hwc<MLI_CONV_OUT_PTR(o_T)>(out);
+
+    const int m = out_prv.height * out_prv.width;
+    const int n = out_prv.ch;
+    const int k = weights_prv.kernel_height * weights_prv.kernel_width * in_prv.ch;
+    if (m <= 0 || n <= 0)
+        return;
+
+    ::mli::krn::ref::conv2d_im2col_src_t<i_T> a_src = {
+        in_prv, out_prv.width, weights_prv.kernel_width,
+        (int)cfg.stride[0], (int)cfg.stride[1], (int)cfg.dilation[0], (int)cfg.dilation[1],
+        (int)cfg.padding_begin[0], (int)cfg.padding_begin[1], params.in_offset};
+    ::mli::krn::ref::conv2d_weights_src_t<w_T> b_src = {weights_prv, in_prv.ch, params.weights_offset};
+    conv2d_epilogue_dst_t<o_T> c_dst = {out_prv, epilogue};
+    ::mli::krn::gemm_full_depth(a_src, b_src, c_dst, m, n, k);
+}
+
 #pragma MLI_CODE_SECTION_END()
 } // namespace snps_arc::metaware::mli::ref
 
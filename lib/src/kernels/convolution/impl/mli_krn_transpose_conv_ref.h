@@ -200,10 +200,18 @@ MLI_FORCE_INLINE void transpose_conv2d_run(
                 // by weights_subtensor should be passed, but also area with all
                 // paddings including padding values between valid values, which
                 // is represented by weights_mirrored.
-                transpose_convolution2D<i_T, w_T, o_T, b_T, acc_T, quant_T, fix_kernel_width, fix_kernel_height>(
-                    cur_in, weights_mirrored, weights_subtensor, bs, cur_out,
-                    params, (o_T)val_limit.min, (o_T)val_limit.max, cur_pad_top,
-                    cur_pad_left, cur_pad_bot, cur_pad_right);
+                if constexpr (std::is_same<quant_T, int_quant_specific_params>::value) {
+                    mli::krn::convolution2D_gemm<i_T, w_T, o_T>(
+                        cur_in, weights_mirrored, weights_subtensor, cur_out, params,
+                        /*stride_height = */1, /*stride_width = */1,
+                        /*dilation_height=  */1, /*dilation_width =  */1,
+                        cur_pad_top, cur_pad_left);
+                } else {
+                    transpose_convolution2D<i_T, w_T, o_T, b_T, acc_T, quant_T, fix_kernel_width, fix_kernel_height>(
+                        cur_in, weights_mirrored, weights_subtensor, bs, cur_out,
+                        params, (o_T)val_limit.min, (o_T)val_limit.max, cur_pad_top,
+                        cur_pad_left, cur_pad_bot, cur_pad_right);
+                }
             }
         }
     }
@@ -10,6 +10,7 @@
 
 #include "mli_ref_compiler_api.hpp"
 #include "mli_ref_runtime_api.hpp"
+#include "mli_ref_weights_codec.hpp"
 #include "mli_service_functions.hpp"
 
 
@@ -58,6 +59,7 @@ Conv2d_CS::Conv2d_CS(const PlatformDescription pd,
       service::GetBufferSize(kConvIORank, input_shape, input_stride);
   m_weights_buffer_size
       = service::GetBufferSize(weights.get_rank(), weights_shape, weights_stride);
+  m_encoded_weights_size = 0;
   m_output_buffer_size
       = service::GetBufferSize(kConvIORank, output_shape, output_stride);
 
@@ -103,6 +105,7 @@ Conv2d_CS::Conv2d_CS(const PlatformDescription pd,
 
   m_input_buffer_size = service::GetBufferSize(input.get_tensor());
   m_weights_buffer_size = service::GetBufferSize(weights.get_tensor());
+  m_encoded_weights_size = 0;
   m_output_buffer_size = service::GetBufferSize(output.get_tensor());
 
   m_inp_quant_axis = kPerTensorQuantDim;
@@ -125,6 +128,7 @@ Conv2d_CS::Conv2d_CS(const PlatformDescription pd,
 
   m_input_buffer_size = service::GetBufferSize(input.get_tensor());
   m_weights_buffer_size = service::GetBufferSize(weights.get_tensor());
+  m_encoded_weights_size = 0;
   m_output_buffer_size = service::GetBufferSize(output.get_tensor());
 
   m_inp_quant_axis = kPerTensorQuantDim;
@@ -156,16 +160,28 @@ mli_status Conv2d_CS::GetKernelPrivateData(void* kernel_private_data_buffer) {
   MLI_ASSERT(m_weights.get_dim(kKernelGroupDim) ==
       m_output.get_dim(kGroupTensorGroupDim));
 
+  if (m_config.mode != compression_mode_t::Uncompressed) {
+    // Weights have to be encoded before, the ctrl buffer keeps the expanded tile
+    MLI_ASSERT(m_encoded_weights_size > 0);
+    MLI_ASSERT(m_decoded_weights_buffer.get_size() >= GetCtrlBufferSize());
+  }
+
+  if (m_config.epilogue.enabled) {
+    MLI_ASSERT(m_epilogue_params_buffer.get_size() >= GetEncodedEpilogueParamsSize());
+  }
+
   Conv2DPrivateData prv_data;
   prv_data.input = m_input;
   prv_data.weights = m_weights;
   prv_data.output = m_output;
   prv_data.weights_zp = m_weights_zp;
   prv_data.inpzp_buffer = m_inpzp_buffer;
+  prv_data.decoded_weights_buffer = m_decoded_weights_buffer;
+  prv_data.epilogue_params_buffer = m_epilogue_params_buffer;
   prv_data.inp_quant_axis = m_inp_quant_axis;
   prv_data.wts_quant_axis = m_wts_quant_axis;
   prv_data.config = m_config;
-  prv_data.layout = LAYOUT_HWC;
+  prv_data.layout = GetFeatureMapLayout(m_input.get_tensor(), kGroupTensorWidthDim, kGroupTensorChannelDim);
 
   std::memcpy(kernel_private_data_buffer, (void *)&prv_data, prv_data.size);
 
@@ -194,6 +210,7 @@ mli_status Conv2d_CS::AttachBufferOffsets(Tensor<OffsetBuffer, 4> &input,
 
   // Zero Points maybe empty
   m_inpzp_buffer = inpzeropts;
+  m_decoded_weights_buffer = ctrl_buffer;
 
   return MLI_STATUS_OK;
 }
@@ -210,6 +227,7 @@ mli_status Conv2d_CS::AttachBufferOffsets(const OffsetBuffer& input,
   m_weights.set_buf(weights);
   m_weights_zp.set_buf(wtszeropts);
   m_inpzp_buffer = inpzeropts;
+  m_decoded_weights_buffer = ctrl_buffer;
   return MLI_STATUS_OK;
 }
 
@@ -220,6 +238,10 @@ mli_status Conv2d_CS::EncodeWeights(Tensor<Buffer, kConvWRank> &weights,
                                     Buffer &encoded_weights,
                                     compression_mode_t mode){
   DEPRECATED_METHOD
+  // Compressed weights are supported only by EncodeWeightsAndZeroPts()
+  if (mode != compression_mode_t::Uncompressed) {
+    return MLI_STATUS_NOT_SUPPORTED;
+  }
   return service::EncodeWeights(weights, encoded_weights);
 }
 
@@ -227,11 +249,100 @@ mli_status Conv2d_CS::EncodeWeights(Tensor<Buffer, kConvWRank> &weights,
 mli_status Conv2d_CS::EncodeWeightsAndZeroPts(TensorIterator<Buffer, kConvWRank, kConvIterRank>& weights,
                                               TensorIterator<Buffer, kConvZPRank, kConvIterRank>& weights_zp,
                                               Buffer& encoded_weights) {
-  return service::EncodeWeightsAndZeroPts(weights.get_tensor(), weights_zp.get_tensor(), encoded_weights);
+  if (m_config.mode == compression_mode_t::Uncompressed) {
+    return service::EncodeWeightsAndZeroPts(weights.get_tensor(), weights_zp.get_tensor(), encoded_weights);
+  }
+  return EncodeCompressedWeightsAndZeroPts(m_config.mode, m_weights, weights.get_tensor(), weights_zp.get_tensor(),
+                                           encoded_weights, m_encoded_weights_size);
 }
 
 unsigned Conv2d_CS::GetEncodedWeightsSize() {
-  return m_weights_buffer_size;
+  if (m_config.mode == compression_mode_t::Uncompressed) {
+    return m_weights_buffer_size;
+  }
+  if (m_encoded_weights_size == 0) {
+    return GetEncodedWeightsBound(m_config.mode, m_weights);
+  }
+  return m_encoded_weights_size;
+}
+
+float Conv2d_CS::GetWeightsCompressionRatio() const {
+  if (m_config.mode == compression_mode_t::Uncompressed) {
+    return 1.f;
+  }
+  return ref::GetWeightsCompressionRatio(m_weights_buffer_size, m_encoded_weights_size);
+}
+
+unsigned Conv2d_CS::GetCtrlBufferSize() const {
+  if (m_config.mode == compression_mode_t::Uncompressed) {
+    return 0;
+  }
+  return GetMaxDecodedWeightsTileSize(m_weights);
+}
+
+mli_status Conv2d_CS::EncodeEpilogueParams(const Tensor<Buffer, kConvEpilogueParamRank> &in_bias,
+                                           const Tensor<Buffer, kConvEpilogueParamRank> &scale,
+                                           const Tensor<Buffer, kConvEpilogueParamRank> &shift,
+                                           const Tensor<Buffer, kConvEpilogueParamRank> &out_bias,
+                                           const Tensor<Buffer, kConvEpilogueParamRank> *lut,
+                                           Buffer &encoded_params) {
+  if (!m_config.epilogue.enabled) {
+    return MLI_STATUS_NOT_SUPPORTED;
+  }
+
+  const uint32_t channels = m_output.get_dim(kGroupTensorChannelDim);
+  MLI_ASSERT(in_bias.get_dim(0) == channels && in_bias.get_elem_size() == sizeof(int32_t));
+  MLI_ASSERT(scale.get_dim(0) == channels && scale.get_elem_size() == sizeof(int16_t));
+  MLI_ASSERT(shift.get_dim(0) == channels && shift.get_elem_size() == sizeof(int8_t));
+  MLI_ASSERT(out_bias.get_dim(0) == channels && out_bias.get_elem_size() == sizeof(int8_t));
+  MLI_ASSERT(encoded_params.get_size() >= GetEncodedEpilogueParamsSize());
+
+  uint32_t offset = 0;
+  for (uint32_t i = 0; i < channels; i++) {
+    encoded_params.write_obj(offset, in_bias.read<int32_t>(i));
+    offset += sizeof(int32_t);
+  }
+  for (uint32_t i = 0; i < channels; i++) {
+    encoded_params.write_obj(offset, scale.read<int16_t>(i));
+    offset += sizeof(int16_t);
+  }
+  for (uint32_t i = 0; i < channels; i++) {
+    encoded_params.write_obj(offset, shift.read<int8_t>(i));
+    offset += sizeof(int8_t);
+  }
+  for (uint32_t i = 0; i < channels; i++) {
+    encoded_params.write_obj(offset, out_bias.read<int8_t>(i));
+    offset += sizeof(int8_t);
+  }
+
+  if (m_config.epilogue.use_lut) {
+    MLI_ASSERT(lut != nullptr);
+    MLI_ASSERT(lut->get_dim(0) == kConvEpilogueLutSize && lut->get_elem_size() == sizeof(int8_t));
+    for (uint32_t i = 0; i < kConvEpilogueLutSize; i++) {
+      encoded_params.write_obj(offset, lut->read<int8_t>(i));
+      offset += sizeof(int8_t);
+    }
+  }
+
+  return MLI_STATUS_OK;
+}
+
+unsigned Conv2d_CS::GetEncodedEpilogueParamsSize() const {
+  if (!m_config.epilogue.enabled) {
+    return 0;
+  }
+  const uint32_t channels = m_output.get_dim(kGroupTensorChannelDim);
+  const uint32_t lut_size = m_config.epilogue.use_lut ? kConvEpilogueLutSize : 0;
+  return channels * (sizeof(int32_t) + sizeof(int16_t) + sizeof(int8_t) + sizeof(int8_t)) + lut_size;
+}
+
+mli_status Conv2d_CS::AttachEpilogueBufferOffsets(const OffsetBuffer &epilogue_params) {
+  if (!m_config.epilogue.enabled) {
+    return MLI_STATUS_NOT_SUPPORTED;
+  }
+  MLI_ASSERT(epilogue_params.get_size() >= GetEncodedEpilogueParamsSize());
+  m_epilogue_params_buffer = epilogue_params;
+  return MLI_STATUS_OK;
 }
 
 /**
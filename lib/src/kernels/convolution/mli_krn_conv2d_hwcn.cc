@@ -184,6 +184,63 @@ mli_status mli_krn_conv2d_hwcn_sa8_sa8_sa32_k3x3(
     return ret;
 }
 
+//========================================================
+// Winograd specializations for k3x3 (unit stride)
+//========================================================
+mli_status mli_krn_conv2d_hwcn_fx16_k3x3_winograd(
+        const mli_tensor* in,
+        const mli_tensor* weights,
+        const mli_tensor* wino_weights,
+        const mli_tensor* bias,
+        const mli_conv2d_cfg* cfg,
+        mli_tensor* out) {
+    mli_status ret = MLI_CHECK_STATUS(mli_chk_conv2d_hwcn_fx16(in, weights, bias, cfg, out, KRN_SZ_3), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+    ret = MLI_CHECK_STATUS(mli_chk_conv2d_hwcn_winograd(in, weights, wino_weights, cfg, out), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+    MLI_PRINT_COMPILE_OPTIONS();
+
+    return mli::krn::conv2d_winograd_prepare_and_run
+            <int16_t, int16_t, int16_t, int16_t, mli_acc40_t, mli::krn::fx_quant_specific_params>
+            (in, weights, wino_weights, bias, cfg, out);
+}
+
+mli_status mli_krn_conv2d_hwcn_fx16_fx8_fx8_k3x3_winograd(
+        const mli_tensor* in,
+        const mli_tensor* weights,
+        const mli_tensor* wino_weights,
+        const mli_tensor* bias,
+        const mli_conv2d_cfg* cfg,
+        mli_tensor* out) {
+    mli_status ret = MLI_CHECK_STATUS(mli_chk_conv2d_hwcn_fx16_fx8_fx8(in, weights, bias, cfg, out, KRN_SZ_3), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+    ret = MLI_CHECK_STATUS(mli_chk_conv2d_hwcn_winograd(in, weights, wino_weights, cfg, out), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+    MLI_PRINT_COMPILE_OPTIONS();
+
+    return mli::krn::conv2d_winograd_prepare_and_run
+            <int16_t, int8_t, int16_t, int8_t, mli_acc32_t, mli::krn::fx_quant_specific_params>
+            (in, weights, wino_weights, bias, cfg, out);
+}
+
+mli_status mli_krn_conv2d_hwcn_sa8_sa8_sa32_k3x3_winograd(
+        const mli_tensor* in,
+        const mli_tensor* weights,
+        const mli_tensor* wino_weights,
+        const mli_tensor* bias,
+        const mli_conv2d_cfg* cfg,
+        mli_tensor* out) {
+    mli_status ret = MLI_CHECK_STATUS(mli_chk_conv2d_hwcn_sa8_sa8_sa32(in, weights, bias, cfg, out, KRN_SZ_3), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+    ret = MLI_CHECK_STATUS(mli_chk_conv2d_hwcn_winograd(in, weights, wino_weights, cfg, out), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+    MLI_PRINT_COMPILE_OPTIONS();
+
+    return mli::krn::conv2d_winograd_prepare_and_run
+            <int8_t, int8_t, int8_t, int32_t, mli_acc32_t, mli::krn::s8asym_quant_specific_params>
+            (in, weights, wino_weights, bias, cfg, out);
+}
+
 //========================================================
 // Specializations for k5x5
 //========================================================
@@ -236,6 +293,34 @@ mli_status mli_krn_conv2d_hwcn_sa8_sa8_sa32_k5x5(
 }
 
 
+//========================================================
+// Pre-validated version
+//========================================================
+mli_status mli_krn_conv2d_hwcn_sa8_sa8_sa32_prepare(
+        const mli_tensor* in,
+        const mli_tensor* weights,
+        const mli_tensor* bias,
+        const mli_conv2d_cfg* cfg,
+        const mli_tensor* out,
+        mli_conv2d_prepared* prepared) {
+    mli_status ret = MLI_CHECK_STATUS(mli_chk_conv2d_hwcn_sa8_sa8_sa32(in, weights, bias, cfg, out), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+    ret = MLI_CHECK_STATUS(mli_chk_conv2d_prepared(prepared), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+    MLI_PRINT_COMPILE_OPTIONS();
+
+    mli::krn::conv2d_sa8_prepare<mli::CONV_GENERAL>(in, weights, bias, cfg, out, prepared);
+    return ret;
+}
+
+mli_status mli_krn_conv2d_hwcn_sa8_sa8_sa32_run_prepared(
+        const mli_conv2d_prepared* prepared,
+        const mli_tensor* in,
+        mli_tensor* out) {
+    mli::krn::conv2d_sa8_run_prepared<mli_sa8_sa8_sa32_accu_t, LAYOUT_HWCN, mli::CONV_GENERAL>(prepared, in, out);
+    return MLI_STATUS_OK;
+}
+
 #pragma MLI_CODE_SECTION_END()
 
 #ifdef __cplusplus
@@ -12,6 +12,7 @@
 #include "mli_debug.h"
 #include "mli_krn_convolution.h"
 #include "mli_ref_runtime_api.hpp"
+#include "mli_ref_weights_codec.hpp"
 
 #if !defined(MLI_BUILD_REFERENCE) && defined(__Xvec_width)
 typedef vNx4accshort_t mli_8x8_accu_t;
@@ -21,6 +22,31 @@ typedef mli_acc32_t mli_8x8_accu_t;
 
 namespace snps_arc::metaware::mli::ref {
 
+static conv2d_epilogue_params_t GetTileEpilogueParams(const Conv2dMetadata& metadata) {
+  // Parameters are encoded for all output channels (see Conv2d_CS::EncodeEpilogueParams)
+  const auto& epilogue = metadata.cfg.epilogue;
+  const uint32_t channels = metadata.output.get_dim(kGroupTensorChannelDim);
+  int32_t out_pos[kConvIORank];
+  metadata.output.get_pos(out_pos);
+  const int32_t ch_offset = out_pos[kGroupTensorChannelDim];
+
+  const int8_t* in_bias = metadata.epilogue_params_buffer.get_ptr<int8_t>();
+  const int8_t* scale = in_bias + channels * sizeof(int32_t);
+  const int8_t* shift = scale + channels * sizeof(int16_t);
+  const int8_t* out_bias = shift + channels * sizeof(int8_t);
+  const int8_t* lut = out_bias + channels * sizeof(int8_t);
+
+  conv2d_epilogue_params_t tile_params;
+  tile_params.in_bias = reinterpret_cast<const int32_t*>(in_bias) + ch_offset;
+  tile_params.scale = reinterpret_cast<const int16_t*>(scale) + ch_offset;
+  tile_params.shift = shift + ch_offset;
+  tile_params.out_bias = out_bias + ch_offset;
+  tile_params.lut = epilogue.use_lut ? lut : nullptr;
+  tile_params.clip_min = epilogue.clip_min;
+  tile_params.clip_max = epilogue.clip_max;
+  return tile_params;
+}
+
 Conv2d::Conv2d(void* kernel_private_data_buffer,
                size_t size,
                uint64_t membases[], int num_mems) {
@@ -30,16 +56,20 @@ Conv2d::Conv2d(void* kernel_private_data_buffer,
   MLI_ASSERT(private_data.kernel_id == kConv2dId);
   MLI_ASSERT(private_data.size == sizeof(Conv2DPrivateData));
 
-  MLI_ASSERT(private_data.layout == LAYOUT_HWC);
+  MLI_ASSERT(private_data.layout == LAYOUT_HWC || private_data.layout == LAYOUT_CHW);
 
   m_metadata.input = private_data.input;
   m_metadata.weights = private_data.weights;
   m_metadata.weights_zp = private_data.weights_zp;
   m_metadata.output = private_data.output;
   m_metadata.inpzp_buffer = InternalBuffer(private_data.inpzp_buffer, membases, num_mems);
+  m_metadata.encoded_weights_buffer = InternalBuffer(private_data.weights.get_buf(), membases, num_mems);
+  m_metadata.decoded_weights_buffer = InternalBuffer(private_data.decoded_weights_buffer, membases, num_mems);
+  m_metadata.epilogue_params_buffer = InternalBuffer(private_data.epilogue_params_buffer, membases, num_mems);
   
   m_metadata.inp_quant_axis = private_data.inp_quant_axis;
   m_metadata.wts_quant_axis = private_data.wts_quant_axis;
+  m_metadata.layout = private_data.layout;
   m_metadata.cfg = private_data.config;
 
   m_tile_input = Tensor<InternalBuffer, kConvIORank>(m_metadata.input.GetSubTensor(), membases, num_mems);
@@ -56,21 +86,40 @@ mli_status Conv2d::Issue() {
   uint32_t o_elem_size = m_tile_output.get_buf().get_elem_size();
   uint32_t w_elem_size = m_tile_weights.get_buf().get_elem_size();
 
-  if (i_elem_size == sizeof(int8_t) &&
-      w_elem_size == sizeof(int8_t) &&
-      o_elem_size == sizeof(int32_t)) {
-
-    QTensor<InternalBuffer, kConvIORank> qinput{m_tile_input, m_metadata.inpzp_buffer,
-                                                m_metadata.inp_quant_axis};
-    QTensor<InternalBuffer, kConvWRank> qweights{m_tile_weights, m_tile_wzp.get_buf(),
-                                                 m_metadata.wts_quant_axis};
+  const bool is_epilogue = m_metadata.cfg.epilogue.enabled;
+  if (i_elem_size != sizeof(int8_t) || w_elem_size != sizeof(int8_t) ||
+      o_elem_size != (is_epilogue ? sizeof(int8_t) : sizeof(int32_t))) {
+    // datatype is not supported yet
+    return MLI_STATUS_NOT_SUPPORTED;
+  }
 
-    conv2d_prepare_and_run<int8_t, int8_t, int32_t, mli_8x8_accu_t, LAYOUT_HWC,
+  QTensor<InternalBuffer, kConvIORank> qinput{m_tile_input, m_metadata.inpzp_buffer,
+                                              m_metadata.inp_quant_axis};
+  // Compressed weights are expanded into the scratch buffer tile by tile
+  Tensor<InternalBuffer, kConvWRank> tile_weights = m_tile_weights;
+  if (m_metadata.cfg.mode != compression_mode_t::Uncompressed) {
+    mli_status status = DecodeWeightsTile(m_metadata.weights, m_metadata.encoded_weights_buffer,
+                                          m_metadata.decoded_weights_buffer, tile_weights);
+    if (status != MLI_STATUS_OK) return status;
+  }
+  QTensor<InternalBuffer, kConvWRank> qweights{tile_weights, m_tile_wzp.get_buf(),
+                                               m_metadata.wts_quant_axis};
+
+  const bool is_chw = m_metadata.layout == LAYOUT_CHW;
+  if (is_epilogue && is_chw) {
+    conv2d_epilogue_prepare_and_run<int8_t, int8_t, int8_t, LAYOUT_CHW, kConvIORank, kConvWRank>(
+        qinput, qweights, m_tile_output, m_tile_cfg, GetTileEpilogueParams(m_metadata));
+  } else if (is_epilogue) {
+    conv2d_epilogue_prepare_and_run<int8_t, int8_t, int8_t, LAYOUT_HWC, kConvIORank, kConvWRank>(
+        qinput, qweights, m_tile_output, m_tile_cfg, GetTileEpilogueParams(m_metadata));
+  } else if (is_chw) {
+    conv2d_prepare_and_run<int8_t, int8_t, int32_t, mli_8x8_accu_t, LAYOUT_CHW,
                            ::mli::CONV_GENERAL, kConvIORank, kConvWRank,
                            Conv2DConfig>(qinput, qweights, m_tile_output, m_tile_cfg);
   } else {
-    // datatype is not supported yet
-    return MLI_STATUS_NOT_SUPPORTED;
+    conv2d_prepare_and_run<int8_t, int8_t, int32_t, mli_8x8_accu_t, LAYOUT_HWC,
+                           ::mli::CONV_GENERAL, kConvIORank, kConvWRank,
+                           Conv2DConfig>(qinput, qweights, m_tile_output, m_tile_cfg);
   }
 
   return MLI_STATUS_OK;
@@ -30,19 +30,37 @@ namespace krn {
 #if !defined(MLI_BUILD_REFERENCE) && defined(__Xvec_width)
 using mli::krn::vdsp::convolution2D;
 using mli::krn::vdsp::depthwise_convolution2D;
+using mli::krn::ref::convolution2D_gemm;
+using mli::krn::ref::conv2d_run_prepared;
 using mli::krn::ref::conv2d_prepare_and_run;
+using mli::krn::ref::conv2d_sa8_prepare;
+using mli::krn::ref::conv2d_sa8_run_prepared;
+using mli::krn::ref::conv2d_winograd_prepare_and_run;
+using mli::krn::ref::conv2d_winograd_weights;
 using snps_arc::metaware::mli::ref::conv2d_prepare_and_run;
 
 #elif !defined(MLI_BUILD_REFERENCE) && defined(__FXAPI__)
 using mli::krn::ref::convolution2D;
 using mli::krn::dsp::depthwise_convolution2D;
+using mli::krn::ref::convolution2D_gemm;
+using mli::krn::ref::conv2d_run_prepared;
 using mli::krn::ref::conv2d_prepare_and_run;
+using mli::krn::ref::conv2d_sa8_prepare;
+using mli::krn::ref::conv2d_sa8_run_prepared;
+using mli::krn::ref::conv2d_winograd_prepare_and_run;
+using mli::krn::ref::conv2d_winograd_weights;
 using snps_arc::metaware::mli::ref::conv2d_prepare_and_run;
 
 #else
 using mli::krn::ref::convolution2D;
 using mli::krn::ref::depthwise_convolution2D;
+using mli::krn::ref::convolution2D_gemm;
+using mli::krn::ref::conv2d_run_prepared;
 using mli::krn::ref::conv2d_prepare_and_run;
+using mli::krn::ref::conv2d_sa8_prepare;
+using mli::krn::ref::conv2d_sa8_run_prepared;
+using mli::krn::ref::conv2d_winograd_prepare_and_run;
+using mli::krn::ref::conv2d_winograd_weights;
 using snps_arc::metaware::mli::ref::conv2d_prepare_and_run;
 
 #endif
@@ -56,6 +74,7 @@ using snps_arc::metaware::mli::ref::conv2d_prepare_and_run;
 // included. Other variants are included based on capabilities. Implementations
 // below can depend on each other through declarations in *_decl.h.
 #include "impl/mli_krn_convolution_ref.h"
+#include "impl/mli_krn_conv2d_winograd_ref.h"
 
 #if !defined(MLI_BUILD_REFERENCE) && defined(__Xvec_width)
 #include "impl/mli_krn_convolution_vdsp.h"
@@ -59,6 +59,17 @@ MLI_FORCE_INLINE void convolution2D(
         const int padding_top, const int padding_left,
         const int padding_bot, const int padding_right);
 
+template <typename i_T, typename w_T, typename o_T>
+MLI_FORCE_INLINE void convolution2D_gemm(
+        const tensor_private_t<MLI_PTR(i_T)> &in,
+        const conv2d_weights_tensor_private_t<MLI_PTR(w_T)> &weights_full,
+        const conv2d_weights_tensor_private_t<MLI_PTR(w_T)> &weights,
+        const tensor_private_t<MLI_CONV_OUT_PTR(o_T)> &out,
+        const int_quant_specific_params &quant_params,
+        const int stride_height, const int stride_width,
+        const int dilation_height, const int dilation_width,
+        const int padding_top, const int padding_left);
+
 template <typename i_T, typename w_T, typename o_T, typename b_T, typename acc_T, typename quant_T, int fix_kernel_width, int fix_kernel_height>
 MLI_FORCE_INLINE void depthwise_convolution2D(
         const tensor_private_t<MLI_PTR(i_T)> &in,
@@ -74,6 +85,17 @@ MLI_FORCE_INLINE void depthwise_convolution2D(
         const int padding_top, const int padding_left,
         const int padding_bot, const int padding_right);
 
+template <typename i_T, typename w_T, typename o_T, typename b_T, typename acc_T, typename quant_T,
+          mli_layout_type data_layout, mli_conv_type conv_type, int fix_kernel_width, int fix_kernel_height>
+MLI_FORCE_INLINE void conv2d_run_prepared(
+        const mli_tensor *in,
+        const mli_tensor *weights,
+        const mli_tensor *bias,
+        const mli_conv2d_cfg *cfg,
+        const mli_minmax_t val_limit,
+        const quant_T &params,
+        mli_tensor *out);
+
 template <typename i_T, typename w_T, typename o_T, typename b_T, typename acc_T, typename quant_T,
           mli_layout_type data_layout, mli_conv_type conv_type, int fix_kernel_width, int fix_kernel_height>
 MLI_FORCE_INLINE void conv2d_prepare_and_run(
@@ -82,6 +104,35 @@ MLI_FORCE_INLINE void conv2d_prepare_and_run(
         const mli_tensor *bias,
         const mli_conv2d_cfg *cfg,
         mli_tensor *out);
+
+template <mli_conv_type conv_type>
+MLI_FORCE_INLINE void conv2d_sa8_prepare(
+        const mli_tensor *in,
+        const mli_tensor *weights,
+        const mli_tensor *bias,
+        const mli_conv2d_cfg *cfg,
+        const mli_tensor *out,
+        mli_conv2d_prepared *prepared);
+
+template <typename acc_T, mli_layout_type data_layout, mli_conv_type conv_type>
+MLI_FORCE_INLINE void conv2d_sa8_run_prepared(
+        const mli_conv2d_prepared *prepared,
+        const mli_tensor *in,
+        mli_tensor *out);
+
+template <typename w_T>
+MLI_FORCE_INLINE void conv2d_winograd_weights(
+        const mli_tensor *weights,
+        mli_tensor *wino_weights);
+
+template <typename i_T, typename w_T, typename o_T, typename b_T, typename acc_T, typename quant_T>
+MLI_FORCE_INLINE mli_status conv2d_winograd_prepare_and_run(
+        const mli_tensor *in,
+        const mli_tensor *weights,
+        const mli_tensor *wino_weights,
+        const mli_tensor *bias,
+        const mli_conv2d_cfg *cfg,
+        mli_tensor *out);
 } // namespace ref
 
 ////////////////////////////////////////////////////////////////////////////////
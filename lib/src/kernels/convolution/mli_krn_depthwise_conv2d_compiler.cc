@@ -10,6 +10,7 @@
 
 #include "mli_ref_compiler_api.hpp"
 #include "mli_ref_runtime_api.hpp"
+#include "mli_ref_weights_codec.hpp"
 #include "mli_ref_private_types.hpp"
 
 
@@ -59,6 +60,7 @@ DepthwiseConv2d_CS::DepthwiseConv2d_CS(const lib_mli::PlatformDescription pd,
       service::GetBufferSize(kDepthwiseIORank, input_shape, input_stride);
   m_weights_buffer_size
       = service::GetBufferSize(kDepthwiseWRank, weights_shape, weights_stride);
+  m_encoded_weights_size = 0;
   m_output_buffer_size
       = service::GetBufferSize(kDepthwiseIORank, output_shape, output_stride);
 
@@ -107,6 +109,7 @@ DepthwiseConv2d_CS::DepthwiseConv2d_CS(const lib_mli::PlatformDescription pd,
 
   m_input_buffer_size = service::GetBufferSize(input.get_tensor());
   m_weights_buffer_size = service::GetBufferSize(weights.get_tensor());
+  m_encoded_weights_size = 0;
   m_output_buffer_size = service::GetBufferSize(output.get_tensor());
 
   m_inp_quant_axis = kPerTensorQuantDim;
@@ -132,6 +135,7 @@ DepthwiseConv2d_CS::DepthwiseConv2d_CS(const lib_mli::PlatformDescription pd,
 
   m_input_buffer_size = service::GetBufferSize(input.get_tensor());
   m_weights_buffer_size = service::GetBufferSize(weights.get_tensor());
+  m_encoded_weights_size = 0;
   m_output_buffer_size = service::GetBufferSize(output.get_tensor());
 
   m_inp_quant_axis = kPerTensorQuantDim;
@@ -153,16 +157,23 @@ mli_status DepthwiseConv2d_CS::GetKernelPrivateData(void* kernel_private_data_bu
   MLI_ASSERT(m_input.get_dim(kGroupTensorChannelDim) == m_output.get_dim(kGroupTensorChannelDim));
   MLI_ASSERT(m_weights.get_dim(kKernelDWChannelInDim) == m_output.get_dim(kGroupTensorChannelDim));
 
+  if (m_config.mode != compression_mode_t::Uncompressed) {
+    // Weights have to be encoded before, the ctrl buffer keeps the expanded tile
+    MLI_ASSERT(m_encoded_weights_size > 0);
+    MLI_ASSERT(m_decoded_weights_buffer.get_size() >= GetCtrlBufferSize());
+  }
+
   DepthwiseConv2DPrivateData prv_data;
   prv_data.input = m_input;
   prv_data.weights = m_weights;
   prv_data.weights_zp = m_weights_zp;
   prv_data.output = m_output;
   prv_data.inpzp_buffer = m_inpzp_buffer;
+  prv_data.decoded_weights_buffer = m_decoded_weights_buffer;
   prv_data.inp_quant_axis = m_inp_quant_axis;
   prv_data.wts_quant_axis = m_wts_quant_axis;
   prv_data.config = m_config;
-  prv_data.layout = LAYOUT_HWC;
+  prv_data.layout = GetFeatureMapLayout(m_input.get_tensor(), kGroupTensorWidthDim, kGroupTensorChannelDim);
 
   std::memcpy(kernel_private_data_buffer, (void *)&prv_data, prv_data.size);
 
@@ -193,6 +204,7 @@ mli_status DepthwiseConv2d_CS::AttachBufferOffsets(Tensor<OffsetBuffer, 4> &inpu
   m_weights_zp.set_buf(wtszeropts);
   // Zero Points maybe empty
   m_inpzp_buffer = inpzeropts;
+  m_decoded_weights_buffer = ctrl_buffer;
 
   return MLI_STATUS_OK;
 }
@@ -208,6 +220,7 @@ mli_status DepthwiseConv2d_CS::AttachBufferOffsets(const OffsetBuffer& input,
   m_weights.set_buf(weights);
   m_weights_zp.set_buf(wtszeropts);
   m_inpzp_buffer = inpzeropts;
+  m_decoded_weights_buffer = ctrl_buffer;
   return MLI_STATUS_OK;
 }
 
@@ -219,6 +232,10 @@ mli_status DepthwiseConv2d_CS::EncodeWeights(Tensor<Buffer, kDepthwiseWRank> &we
                                              compression_mode_t mode){
   DEPRECATED_METHOD
 
+  // Compressed weights are supported only by EncodeWeightsAndZeroPts()
+  if (mode != compression_mode_t::Uncompressed) {
+    return MLI_STATUS_NOT_SUPPORTED;
+  }
   return service::EncodeWeights(weights, encoded_weights);
 }
 
@@ -226,13 +243,37 @@ mli_status DepthwiseConv2d_CS::EncodeWeights(Tensor<Buffer, kDepthwiseWRank> &we
 mli_status DepthwiseConv2d_CS::EncodeWeightsAndZeroPts(TensorIterator<Buffer, kDepthwiseWRank, kDepthwiseIterRank>& weights,
                                                        TensorIterator<Buffer, kDepthwiseZPRank, kDepthwiseIterRank>& weights_zp,
                                                        Buffer& encoded_weights) {
-  return service::EncodeWeightsAndZeroPts(weights.get_tensor(), weights_zp.get_tensor(), encoded_weights);
+  if (m_config.mode == compression_mode_t::Uncompressed) {
+    return service::EncodeWeightsAndZeroPts(weights.get_tensor(), weights_zp.get_tensor(), encoded_weights);
+  }
+  return EncodeCompressedWeightsAndZeroPts(m_config.mode, m_weights, weights.get_tensor(), weights_zp.get_tensor(),
+                                           encoded_weights, m_encoded_weights_size);
 };
 
 
 
 unsigned DepthwiseConv2d_CS::GetEncodedWeightsSize() {
-  return m_weights_buffer_size;
+  if (m_config.mode == compression_mode_t::Uncompressed) {
+    return m_weights_buffer_size;
+  }
+  if (m_encoded_weights_size == 0) {
+    return GetEncodedWeightsBound(m_config.mode, m_weights);
+  }
+  return m_encoded_weights_size;
+}
+
+float DepthwiseConv2d_CS::GetWeightsCompressionRatio() const {
+  if (m_config.mode == compression_mode_t::Uncompressed) {
+    return 1.f;
+  }
+  return ref::GetWeightsCompressionRatio(m_weights_buffer_size, m_encoded_weights_size);
+}
+
+unsigned DepthwiseConv2d_CS::GetCtrlBufferSize() const {
+  if (m_config.mode == compression_mode_t::Uncompressed) {
+    return 0;
+  }
+  return GetMaxDecodedWeightsTileSize(m_weights);
 }
 
 /**
@@ -184,6 +184,34 @@ mli_status mli_krn_depthwise_conv2d_hwcn_sa8_sa8_sa32_k5x5(
     return ret;
 }
 
+//========================================================
+// Pre-validated version
+//========================================================
+mli_status mli_krn_depthwise_conv2d_hwcn_sa8_sa8_sa32_prepare(
+        const mli_tensor* in,
+        const mli_tensor* weights,
+        const mli_tensor* bias,
+        const mli_conv2d_cfg* cfg,
+        const mli_tensor* out,
+        mli_conv2d_prepared* prepared) {
+    mli_status ret = MLI_CHECK_STATUS(mli_chk_depthwise_conv2d_hwcn_sa8_sa8_sa32(in, weights, bias, cfg, out), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+    ret = MLI_CHECK_STATUS(mli_chk_conv2d_prepared(prepared), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+    MLI_PRINT_COMPILE_OPTIONS();
+
+    mli::krn::conv2d_sa8_prepare<mli::CONV_DEPTHWISE>(in, weights, bias, cfg, out, prepared);
+    return ret;
+}
+
+mli_status mli_krn_depthwise_conv2d_hwcn_sa8_sa8_sa32_run_prepared(
+        const mli_conv2d_prepared* prepared,
+        const mli_tensor* in,
+        mli_tensor* out) {
+    mli::krn::conv2d_sa8_run_prepared<mli_sa8_sa8_sa32_accu_t, LAYOUT_HW1N, mli::CONV_DEPTHWISE>(prepared, in, out);
+    return MLI_STATUS_OK;
+}
+
 #pragma MLI_CODE_SECTION_END()
 
 #ifdef __cplusplus
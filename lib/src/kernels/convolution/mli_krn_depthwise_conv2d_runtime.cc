@@ -13,6 +13,7 @@
 #include "mli_debug.h"
 #include "mli_krn_convolution.h"
 #include "mli_ref_runtime_api.hpp"
+#include "mli_ref_weights_codec.hpp"
 
 #if !defined(MLI_BUILD_REFERENCE) && defined(__Xvec_width)
 typedef vNx4accshort_t mli_8x8_accu_t;
@@ -31,7 +32,7 @@ DepthwiseConv2d::DepthwiseConv2d(void* kernel_private_data_buffer,
   MLI_ASSERT(private_data.kernel_id == kDWConv2dId);
   MLI_ASSERT(private_data.size == sizeof(DepthwiseConv2DPrivateData));
 
-  MLI_ASSERT(private_data.layout == LAYOUT_HWC);
+  MLI_ASSERT(private_data.layout == LAYOUT_HWC || private_data.layout == LAYOUT_CHW);
 
   m_metadata.input = private_data.input;
   m_metadata.weights = private_data.weights;
@@ -39,9 +40,12 @@ DepthwiseConv2d::DepthwiseConv2d(void* kernel_private_data_buffer,
   m_metadata.output = private_data.output;
 
   m_metadata.inpzp_buffer = InternalBuffer(private_data.inpzp_buffer, membases, num_mems);
+  m_metadata.encoded_weights_buffer = InternalBuffer(private_data.weights.get_buf(), membases, num_mems);
+  m_metadata.decoded_weights_buffer = InternalBuffer(private_data.decoded_weights_buffer, membases, num_mems);
 
   m_metadata.inp_quant_axis = private_data.inp_quant_axis;
   m_metadata.wts_quant_axis = private_data.wts_quant_axis;
+  m_metadata.layout = private_data.layout;
   m_metadata.config = private_data.config;
 
   auto input_tile_tensor = m_metadata.input.GetSubTensor();
@@ -87,15 +91,29 @@ mli_status DepthwiseConv2d::Issue() {
 
     QTensor<InternalBuffer, kDepthwiseIORank> qinput{
       m_tile_input, m_metadata.inpzp_buffer, m_metadata.inp_quant_axis};
+    // Compressed weights are expanded into the scratch buffer tile by tile
+    Tensor<InternalBuffer, kDepthwiseWRank> tile_weights = m_tile_weights;
+    if (m_metadata.config.mode != compression_mode_t::Uncompressed) {
+      mli_status status = DecodeWeightsTile(m_metadata.weights, m_metadata.encoded_weights_buffer,
+                                            m_metadata.decoded_weights_buffer, tile_weights);
+      if (status != MLI_STATUS_OK) return status;
+    }
     QTensor<InternalBuffer, kDepthwiseWRank> qweights{
-      m_tile_weights, m_tile_wzp.get_buf(), m_metadata.wts_quant_axis};
+      tile_weights, m_tile_wzp.get_buf(), m_metadata.wts_quant_axis};
 
 
     for (uint32_t i = 0; i < m_tile_batch_size; i++) {
-      conv2d_prepare_and_run<int8_t, int8_t, int32_t, mli_8x8_accu_t, LAYOUT_HWC,
-                            ::mli::CONV_DEPTHWISE, kDepthwiseIORank,
-                            kDepthwiseWRank, DwConv2DConfig>(
-                              qinput, qweights, m_tile_output, m_tile_cfg);
+      if (m_metadata.layout == LAYOUT_CHW) {
+        conv2d_prepare_and_run<int8_t, int8_t, int32_t, mli_8x8_accu_t, LAYOUT_CHW,
+                              ::mli::CONV_DEPTHWISE, kDepthwiseIORank,
+                              kDepthwiseWRank, DwConv2DConfig>(
+                                qinput, qweights, m_tile_output, m_tile_cfg);
+      } else {
+        conv2d_prepare_and_run<int8_t, int8_t, int32_t, mli_8x8_accu_t, LAYOUT_HWC,
+                              ::mli::CONV_DEPTHWISE, kDepthwiseIORank,
+                              kDepthwiseWRank, DwConv2DConfig>(
+                                qinput, qweights, m_tile_output, m_tile_cfg);
+      }
         
       curr_inp_buf.inc(m_metadata.input.get_mem_stride(kGroupTensorBatchDim));
       curr_out_buf.inc(m_metadata.output.get_mem_stride(kGroupTensorBatchDim));
@@ -18,12 +18,14 @@ namespace snps_arc::metaware::mli::ref {
 MatMul_CS::MatMul_CS(const lib_mli::PlatformDescription &pd,
                      const TensorIterator<NoBuffer, kMatMulRank, kMatMulIterRank> &in_left,
                      const TensorIterator<NoBuffer, kMatMulRank, kMatMulIterRank> &in_right,
-                     const TensorIterator<NoBuffer, kMatMulRank, kMatMulIterRank> &output)
+                     const TensorIterator<NoBuffer, kMatMulRank, kMatMulIterRank> &output,
+                     uint32_t io_elem_size)
   : m_in_left(in_left),
     m_in_right(in_right),
     m_output(output),
     m_pd(pd) {
-      m_encoded_params_buffer_size = sizeof(int8_t) * kMatMulRank;
+      MLI_ASSERT(io_elem_size == sizeof(int8_t) || io_elem_size == sizeof(int16_t));
+      m_encoded_params_buffer_size = io_elem_size * kMatMulZPSize;
 }
 
 unsigned MatMul_CS::GetKernelPrivateDataSize() const {
@@ -74,10 +76,17 @@ mli_status MatMul_CS::EncodeParams(const Buffer &in_bias1,
   assert(in_bias1.get_size() == in_bias2.get_size() == 1);
 
 
-  // in_zp type must be int8_t
-  assert(in_bias1.get_elem_size() == sizeof(int8_t));
-  encoded_params.write<int8_t>(kMatMulHeightDim, in_bias1.read<int8_t>(0));
-  encoded_params.write<int8_t>(kMatMulWidthDim, in_bias2.read<int8_t>(0));
+  // in_zp type must be the type of inputs: int8_t or int16_t
+  assert(in_bias1.get_elem_size() == in_bias2.get_elem_size());
+  assert(in_bias1.get_elem_size() == encoded_params.get_elem_size());
+  if (in_bias1.get_elem_size() == sizeof(int8_t)) {
+    encoded_params.write<int8_t>(0, in_bias1.read<int8_t>(0));
+    encoded_params.write<int8_t>(1, in_bias2.read<int8_t>(0));
+  } else {
+    assert(in_bias1.get_elem_size() == sizeof(int16_t));
+    encoded_params.write<int16_t>(0, in_bias1.read<int16_t>(0));
+    encoded_params.write<int16_t>(1, in_bias2.read<int16_t>(0));
+  }
 
   return MLI_STATUS_OK;
 }
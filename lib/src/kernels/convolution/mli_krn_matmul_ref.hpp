@@ -13,13 +13,16 @@
 #include "mli_debug.h"
 #include "mli_ref_runtime_api.hpp"
 #include "mli_types.hpp"
+#include "mli_krn_gemm.h"
 
 using snps_arc::metaware::mli::InternalBuffer;
 using snps_arc::metaware::mli::Tensor;
 using snps_arc::metaware::mli::OffsetBuffer;
+using snps_arc::metaware::mli::kMatMulBatchDim;
 using snps_arc::metaware::mli::kMatMulHeightDim;
 using snps_arc::metaware::mli::kMatMulWidthDim;
 using snps_arc::metaware::mli::kMatMulRank;
+using snps_arc::metaware::mli::kMatMulZPSize;
 
 namespace mli {
 namespace krn {
@@ -34,44 +37,72 @@ void MatMul_prepare_and_run(Tensor<InternalBuffer, kMatMulRank> &in_left,
                             Tensor<InternalBuffer, kMatMulRank> &output,
                             InternalBuffer &encoded_params) {
   /**
-  * layout = HW
-  * H of left = W of right
-  * output shape must be of shape Hr * Wl
-  * rank = 2
+  * layout = BHW
+  * W of left = H of right
+  * output shape must be of shape B * Hl * Wr
+  * batch of right may be 1 to use the same right matrix for all batches
+  * rank = 3
   */
   MLI_ASSERT(in_left.get_dim(kMatMulWidthDim) == in_right.get_dim(kMatMulHeightDim));
   MLI_ASSERT(output.get_dim(kMatMulHeightDim) == in_left.get_dim(kMatMulHeightDim));
   MLI_ASSERT(output.get_dim(kMatMulWidthDim) == in_right.get_dim(kMatMulWidthDim));
-  MLI_ASSERT(encoded_params.get_elem_size() == sizeof(int8_t));
-  MLI_ASSERT(encoded_params.get_size() == kMatMulRank);
-
-  in1_t val1;
-  in2_t val2;
-  out_t acc;
+  MLI_ASSERT(output.get_dim(kMatMulBatchDim) == in_left.get_dim(kMatMulBatchDim));
+  MLI_ASSERT(in_right.get_dim(kMatMulBatchDim) == in_left.get_dim(kMatMulBatchDim) ||
+             in_right.get_dim(kMatMulBatchDim) == 1);
+  MLI_ASSERT(encoded_params.get_elem_size() == sizeof(int8_t) || encoded_params.get_elem_size() == sizeof(int16_t));
+  MLI_ASSERT(encoded_params.get_size() == kMatMulZPSize * encoded_params.get_elem_size());
 
   /**
   * leftzp is the first element of the encoded buffer.
   * rightzp is the second element of the encoded buffer.
+  * zero points have the same type as inputs.
   */
-  int8_t in_left_zp = encoded_params.read<int8_t>(kMatMulHeightDim);
-  int8_t in_right_zp = encoded_params.read<int8_t>(kMatMulWidthDim);
+  int16_t in_left_zp;
+  int16_t in_right_zp;
+  if (encoded_params.get_elem_size() == sizeof(int8_t)) {
+    in_left_zp = encoded_params.read<int8_t>(0);
+    in_right_zp = encoded_params.read<int8_t>(1);
+  } else {
+    in_left_zp = encoded_params.read<int16_t>(0);
+    in_right_zp = encoded_params.read<int16_t>(1);
+  }
+  uint32_t batch = in_left.get_dim(kMatMulBatchDim);
   uint32_t left_h = in_left.get_dim(kMatMulHeightDim);
   uint32_t right_w = in_right.get_dim(kMatMulWidthDim);
   uint32_t left_w = in_left.get_dim(kMatMulWidthDim);
   int32_t left_mem_strides[kMatMulRank];
   int32_t right_mem_strides[kMatMulRank];
+  int32_t out_mem_strides[kMatMulRank];
   in_left.get_mem_strides(left_mem_strides);
   in_right.get_mem_strides(right_mem_strides);
-  for(uint32_t left_height_index = 0; left_height_index < left_h; ++left_height_index) {
-    for (uint32_t right_width_index = 0; right_width_index < right_w; ++right_width_index) {
-      acc = 0;
-      for (uint32_t left_width_index = 0, right_height_index = 0; left_width_index < left_w; ++left_width_index, ++right_height_index) {
-          val1 = in_left.template read<in1_t>(left_height_index * left_mem_strides[0] + left_width_index) - in_left_zp;
-          val2 = in_right.template read<in2_t>(right_height_index * right_mem_strides[0] + right_width_index) - in_right_zp;
-          acc += val1 * val2;
-      }
-        output.template write<out_t>( left_height_index * right_w + right_width_index, static_cast<out_t>(acc) );
-    }
+  output.get_mem_strides(out_mem_strides);
+  if (in_right.get_dim(kMatMulBatchDim) == 1) {
+    right_mem_strides[kMatMulBatchDim] = 0;
+  }
+
+  /**
+  * output = (left - leftzp) * (right - rightzp) is calculated by the blocked GEMM engine
+  * for each batch with zero points folded out of the packed panels.
+  * Right matrix is packed column by column, so a column of it is a row of the GEMM source.
+  * Any memory strides are supported, i.e. the transposed right matrix of Q * K^T is
+  * a [d, seq] tensor with strides {1, d} over the [seq, d] data of K.
+  */
+  gemm_strided_src_t<in1_t> left_src = {in_left.get_buf().template get_ptr<in1_t>() + in_left.get_offs(),
+                                        left_mem_strides[kMatMulHeightDim],
+                                        left_mem_strides[kMatMulWidthDim],
+                                        in_left_zp};
+  gemm_strided_src_t<in2_t> right_src = {in_right.get_buf().template get_ptr<in2_t>() + in_right.get_offs(),
+                                         right_mem_strides[kMatMulWidthDim],
+                                         right_mem_strides[kMatMulHeightDim],
+                                         in_right_zp};
+  gemm_strided_dst_t<out_t> out_dst = {output.get_buf().template get_ptr<out_t>() + output.get_offs(),
+                                       out_mem_strides[kMatMulHeightDim],
+                                       out_mem_strides[kMatMulWidthDim]};
+  for (uint32_t b = 0; b < batch; b++) {
+    mli::krn::gemm_zp_folded(left_src, right_src, out_dst, left_h, right_w, left_w);
+    left_src.ptr += left_mem_strides[kMatMulBatchDim];
+    right_src.ptr += right_mem_strides[kMatMulBatchDim];
+    out_dst.ptr += out_mem_strides[kMatMulBatchDim];
   }
 }
 
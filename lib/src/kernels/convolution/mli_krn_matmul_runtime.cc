@@ -24,7 +24,7 @@ MatMul::MatMul(void* kernel_private_data_buffer,
   m_i_elem_size = private_data.m_in_left.get_elem_size();
   m_o_elem_size = private_data.m_output.get_elem_size();
 
-  MLI_ASSERT(sizeof(int8_t) == m_i_elem_size);
+  MLI_ASSERT(sizeof(int8_t) == m_i_elem_size || sizeof(int16_t) == m_i_elem_size);
   MLI_ASSERT(sizeof(int32_t) == m_o_elem_size);
 
   // left and right input have the same type
@@ -50,6 +50,11 @@ mli_status MatMul::Issue() {
 
     MatMul_prepare_and_run<int8_t, int8_t, int32_t>
                           (m_tile_input_left, m_tile_input_right, m_tile_output, m_encoded_params);
+  } else if (m_i_elem_size == sizeof(int16_t) &&
+             m_o_elem_size == sizeof(int32_t)) {
+
+    MatMul_prepare_and_run<int16_t, int16_t, int32_t>
+                          (m_tile_input_left, m_tile_input_right, m_tile_output, m_encoded_params);
   } else {
     // not supported yet
     return MLI_STATUS_NOT_SUPPORTED;
@@ -92,7 +97,7 @@ void MatMul::GetIOSizesAndOffsets(uint32_t input_left_size[kMatMulRank], uint32_
                                   int32_t output_offsets[kMatMulRank]) const{
   
   m_input_left.get_pos(input_left_offsets);
-  m_input_left.get_pos(input_right_offsets);
+  m_input_right.get_pos(input_right_offsets);
   m_output.get_pos(output_offsets);
   
   m_tile_input_left.get_dims(input_left_size);
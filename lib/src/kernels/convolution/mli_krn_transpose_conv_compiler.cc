@@ -10,6 +10,7 @@
 
 #include "mli_ref_compiler_api.hpp"
 #include "mli_ref_runtime_api.hpp"
+#include "mli_ref_weights_codec.hpp"
 #include "mli_service_functions.hpp"
 #include "mli_helpers_api.hpp"
 
@@ -36,6 +37,7 @@ TransposeConv2D_CS::TransposeConv2D_CS(
   m_inp_quant_axis = kPerTensorQuantDim;
   m_wts_quant_axis = kKernelChannelOutDim;
   m_weights_buffer_size = service::GetBufferSize(weights.get_tensor());
+  m_encoded_weights_size = 0;
 }
 
 TransposeConv2D_CS::TransposeConv2D_CS(const PlatformDescription pd,
@@ -54,6 +56,7 @@ TransposeConv2D_CS::TransposeConv2D_CS(const PlatformDescription pd,
   m_inp_quant_axis = kPerTensorQuantDim;
   m_wts_quant_axis = kKernelChannelOutDim;
   m_weights_buffer_size = service::GetBufferSize(weights.get_tensor());
+  m_encoded_weights_size = 0;
 }
 
 unsigned TransposeConv2D_CS::GetKernelPrivateDataSize() const {
@@ -75,12 +78,19 @@ mli_status TransposeConv2D_CS::GetKernelPrivateData(
       m_input.get_dim(kGroupTensorChannelDim));
   MLI_ASSERT(m_weights.get_dim(kKernelGroupDim) == 1);
 
+  if (m_config.mode != compression_mode_t::Uncompressed) {
+    // Weights have to be encoded before, the ctrl buffer keeps the expanded tile
+    MLI_ASSERT(m_encoded_weights_size > 0);
+    MLI_ASSERT(m_decoded_weights_buffer.get_size() >= GetCtrlBufferSize());
+  }
+
   TransposeConv2DPrivateData prv_data;
   prv_data.input = m_input;
   prv_data.weights = m_weights;
   prv_data.output = m_output;
   prv_data.weights_zp = m_weights_zp;
   prv_data.inpzp_buffer = m_inpzp_buffer;
+  prv_data.decoded_weights_buffer = m_decoded_weights_buffer;
   prv_data.inp_quant_axis = m_inp_quant_axis;
   prv_data.wts_quant_axis = m_wts_quant_axis;
   prv_data.config = m_config;
@@ -100,6 +110,7 @@ mli_status TransposeConv2D_CS::AttachBufferOffsets(
   m_weights.set_buf(weights);
   m_weights_zp.set_buf(wtszeropts);
   m_inpzp_buffer = inpzeropts;
+  m_decoded_weights_buffer = ctrl_buffer;
   return MLI_STATUS_OK;
 }
 
@@ -110,18 +121,46 @@ mli_status TransposeConv2D_CS::EncodeWeights(Tensor<Buffer, kTransposeConvWRank>
                                              Buffer &encoded_weights,
                                              compression_mode_t mode) {
   DEPRECATED_METHOD
+  // Compressed weights are supported only by EncodeWeightsAndZeroPts()
+  if (mode != compression_mode_t::Uncompressed) {
+    return MLI_STATUS_NOT_SUPPORTED;
+  }
   return service::EncodeWeights(weights, encoded_weights);
 }
 
 mli_status TransposeConv2D_CS::EncodeWeightsAndZeroPts(TensorIterator<Buffer, kTransposeConvWRank, kTransposeConvIterRank>& weights,
                                                        TensorIterator<Buffer, kTransposeConvZPRank, kTransposeConvIterRank>& weights_zp,
                                                        Buffer& encoded_weights) {
-  return service::EncodeWeightsAndZeroPts(weights.get_tensor(), weights_zp.get_tensor(), encoded_weights);
+  if (m_config.mode == compression_mode_t::Uncompressed) {
+    return service::EncodeWeightsAndZeroPts(weights.get_tensor(), weights_zp.get_tensor(), encoded_weights);
+  }
+  return EncodeCompressedWeightsAndZeroPts(m_config.mode, m_weights, weights.get_tensor(), weights_zp.get_tensor(),
+                                           encoded_weights, m_encoded_weights_size);
 };
 
 unsigned TransposeConv2D_CS::GetEncodedWeightsSize() const {
-  return m_weights_buffer_size;
-};
+  if (m_config.mode == compression_mode_t::Uncompressed) {
+    return m_weights_buffer_size;
+  }
+  if (m_encoded_weights_size == 0) {
+    return GetEncodedWeightsBound(m_config.mode, m_weights);
+  }
+  return m_encoded_weights_size;
+}
+
+float TransposeConv2D_CS::GetWeightsCompressionRatio() const {
+  if (m_config.mode == compression_mode_t::Uncompressed) {
+    return 1.f;
+  }
+  return ref::GetWeightsCompressionRatio(m_weights_buffer_size, m_encoded_weights_size);
+}
+
+unsigned TransposeConv2D_CS::GetCtrlBufferSize() const {
+  if (m_config.mode == compression_mode_t::Uncompressed) {
+    return 0;
+  }
+  return GetMaxDecodedWeightsTileSize(m_weights);
+}
 
 /**
  * @deprecated
@@ -12,6 +12,7 @@
 #include "mli_debug.h"
 #include "mli_krn_transpose_conv.h"
 #include "mli_ref_runtime_api.hpp"
+#include "mli_ref_weights_codec.hpp"
 
 #if !defined(MLI_BUILD_REFERENCE) && defined(__Xvec_width)
 typedef vNx4accshort_t mli_8x8_accu_t;
@@ -37,6 +38,8 @@ TransposeConv2D::TransposeConv2D(void* kernel_private_data_buffer, size_t size,
     m_metadata.weights_zp = private_data.weights_zp;
     m_metadata.output = private_data.output;
     m_metadata.inpzp_buffer = InternalBuffer(private_data.inpzp_buffer, membases, num_mems);
+    m_metadata.encoded_weights_buffer = InternalBuffer(private_data.weights.get_buf(), membases, num_mems);
+    m_metadata.decoded_weights_buffer = InternalBuffer(private_data.decoded_weights_buffer, membases, num_mems);
 
     m_metadata.inp_quant_axis = private_data.inp_quant_axis;
     m_metadata.wts_quant_axis = private_data.wts_quant_axis;
@@ -61,7 +64,14 @@ mli_status TransposeConv2D::Issue() {
       QTensor<InternalBuffer, kTransposeConvIORank> qinput{ m_tile_input,
                                                             m_metadata.inpzp_buffer,
                                                             m_metadata.inp_quant_axis};
-      QTensor<InternalBuffer, kTransposeConvWRank> qweights{ m_tile_weights,
+      // Compressed weights are expanded into the scratch buffer tile by tile
+      Tensor<InternalBuffer, kTransposeConvWRank> tile_weights = m_tile_weights;
+      if (m_metadata.cfg.mode != compression_mode_t::Uncompressed) {
+        mli_status status = DecodeWeightsTile(m_metadata.weights, m_metadata.encoded_weights_buffer,
+                                              m_metadata.decoded_weights_buffer, tile_weights);
+        if (status != MLI_STATUS_OK) return status;
+      }
+      QTensor<InternalBuffer, kTransposeConvWRank> qweights{ tile_weights,
                                                              m_tile_wzp.get_buf(),
                                                              m_metadata.wts_quant_axis};
 
@@ -0,0 +1,111 @@
+/*
+ * Copyright 2022, Synopsys, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-3-Clause license found in
+ * the LICENSE file in the root directory of this source tree.
+ *
+ */
+
+#ifndef _MLI_ARGMAX_REF_HPP_
+#define _MLI_ARGMAX_REF_HPP_
+
+#include "mli_math.h"
+#include "mli_types.h"
+#include "mli_prv_dsp.h"
+#include "mli_prv_tensor.h"
+
+namespace snps_arc::metaware::mli {
+namespace krn {
+namespace ref {
+
+using lib_mli::kArgMaxInRank;
+using lib_mli::kArgMaxOutRank;
+
+// Output tensor has the shape of the input tensor with the axis dimension removed.
+// Each output value is the index of the first maximum along the axis.
+// If axis < 0, the single output value is the index of the first maximum
+// in the whole tensor, counting elements in row-major order.
+template <typename in_T, typename out_T>
+mli_status MLI_FORCE_INLINE mli_argmax(const mli_tensor *in,
+                                       const int32_t axis,
+                                       mli_tensor *out) {
+
+    mli_prv_fx_init_dsp_ctrl();
+
+    auto in_prv = mli_prv_get_generic_tensor<MLI_PTR(in_T)>(in);
+    MLI_OUT_PTR(out_T) out_ptr = mli_prv_tensor_data_ptr<MLI_OUT_PTR(out_T)>(out);
+
+    MLI_ASSERT(static_cast<int>(kArgMaxInRank) == in_prv.rank);
+    MLI_ASSERT(static_cast<int>(kArgMaxOutRank) == static_cast<int>(out->rank));
+    MLI_ASSERT(axis < static_cast<int32_t>(kArgMaxInRank));
+
+    if (axis < 0) {
+        in_T max_val = mli_prv_tensor_read(in_prv, 0, 0, 0, 0);
+        int32_t max_idx = 0;
+        int32_t idx = 0;
+        for (int pos0 = 0; pos0 < in_prv.shape[0]; pos0++) {
+            for (int pos1 = 0; pos1 < in_prv.shape[1]; pos1++) {
+                for (int pos2 = 0; pos2 < in_prv.shape[2]; pos2++) {
+                    for (int pos3 = 0; pos3 < in_prv.shape[3]; pos3++, idx++) {
+                        const in_T in_val = mli_prv_tensor_read(in_prv, pos0, pos1, pos2, pos3);
+                        if (in_val > max_val) {
+                            max_val = in_val;
+                            max_idx = idx;
+                        }
+                    }
+                }
+            }
+        }
+        out_ptr[0] = static_cast<out_T>(max_idx);
+        return MLI_STATUS_OK;
+    }
+
+    // swap the dimension order to make the axis the most inner loop (last dim)
+    int reorder_dim[kArgMaxInRank] = {0, 1, 2, 3};
+    reorder_dim[axis] = reorder_dim[kArgMaxInRank - 1];
+    reorder_dim[kArgMaxInRank - 1] = axis;
+
+    // output dimension for each of the input dimensions except the axis
+    int out_dim[kArgMaxInRank] = {0};
+    for (int i = 0, o = 0; i < static_cast<int>(kArgMaxInRank); i++) {
+        if (i != axis) {
+            out_dim[i] = o++;
+        }
+    }
+
+    int pos_in[kArgMaxInRank] = {0};
+    for (pos_in[reorder_dim[0]] = 0; pos_in[reorder_dim[0]] < in_prv.shape[reorder_dim[0]]; pos_in[reorder_dim[0]]++) {
+        for (pos_in[reorder_dim[1]] = 0; pos_in[reorder_dim[1]] < in_prv.shape[reorder_dim[1]]; pos_in[reorder_dim[1]]++) {
+            for (pos_in[reorder_dim[2]] = 0; pos_in[reorder_dim[2]] < in_prv.shape[reorder_dim[2]]; pos_in[reorder_dim[2]]++) {
+
+                pos_in[axis] = 0;
+                in_T max_val = mli_prv_tensor_read(in_prv, pos_in[0], pos_in[1], pos_in[2], pos_in[3]);
+                int32_t max_idx = 0;
+                for (pos_in[axis] = 1; pos_in[axis] < in_prv.shape[axis]; pos_in[axis]++) {
+                    const in_T in_val = mli_prv_tensor_read(in_prv, pos_in[0], pos_in[1], pos_in[2], pos_in[3]);
+                    if (in_val > max_val) {
+                        max_val = in_val;
+                        max_idx = pos_in[axis];
+                    }
+                }
+
+                int32_t out_offset = 0;
+                for (int i = 0; i < static_cast<int>(kArgMaxInRank); i++) {
+                    if (i != axis) {
+                        out_offset += pos_in[i] * out->mem_stride[out_dim[i]];
+                    }
+                }
+                out_ptr[out_offset] = static_cast<out_T>(max_idx);
+            }
+        }
+    }
+
+    return MLI_STATUS_OK;
+}
+
+} // namespace ref
+} // namespace krn
+} // namespace snps_arc::metaware::mli
+
+#endif // _MLI_ARGMAX_REF_HPP_
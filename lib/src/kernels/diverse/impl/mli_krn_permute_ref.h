@@ -12,6 +12,7 @@
 
 #include <stdint.h>
 
+#include "mli_math_macros.h"
 #include "mli_mem_info.h"
 #include "mli_prv_tensor.h"
 #include "mli_types.h"
@@ -23,37 +24,186 @@ namespace ref {
 
 #pragma MLI_CODE_SECTION_START(".mli_lib")
 
+// Size of square tiles of the blocked transpose. Tile is small enough to be kept in registers
+// (or at least in the closest memory), while rows of kPermuteTile elements are read and written.
+constexpr int kPermuteTile = 8;
+
+// Permutation reduced to the minimal number of dimensions. Dimensions are in output order,
+// unit dimensions are dropped and neighbour dimensions which are contiguous in both input
+// and output are merged. Unused leading dimensions have shape 1 and zero strides.
+struct permute_plan_t {
+    int shape[MLI_MAX_RANK];
+    int in_stride[MLI_MAX_RANK];
+    int out_stride[MLI_MAX_RANK];
+};
+
+static MLI_FORCE_INLINE permute_plan_t mli_krn_permute_plan(const uint32_t *out_shape, const int *in_stride,
+                                                            const int *out_stride) {
+    permute_plan_t plan;
+    int rank = 0;
+    for (int k = 0; k < MLI_MAX_RANK; k++) {
+        if (out_shape[k] == 1) continue;
+        if (rank > 0 && plan.in_stride[rank - 1] == in_stride[k] * (int)out_shape[k]
+                     && plan.out_stride[rank - 1] == out_stride[k] * (int)out_shape[k]) {
+            plan.shape[rank - 1] *= out_shape[k];
+            plan.in_stride[rank - 1] = in_stride[k];
+            plan.out_stride[rank - 1] = out_stride[k];
+            continue;
+        }
+        plan.shape[rank] = out_shape[k];
+        plan.in_stride[rank] = in_stride[k];
+        plan.out_stride[rank] = out_stride[k];
+        rank++;
+    }
+
+    // align dimensions to the end
+    const int pad = MLI_MAX_RANK - rank;
+    for (int k = MLI_MAX_RANK - 1; k >= 0; k--) {
+        if (k >= pad) {
+            plan.shape[k] = plan.shape[k - pad];
+            plan.in_stride[k] = plan.in_stride[k - pad];
+            plan.out_stride[k] = plan.out_stride[k - pad];
+        } else {
+            plan.shape[k] = 1;
+            plan.in_stride[k] = 0;
+            plan.out_stride[k] = 0;
+        }
+    }
+    return plan;
+}
+
+// Permutation which keeps the innermost dimension: rows are copied as is.
+template <typename io_T>
+static MLI_FORCE_INLINE void mli_krn_permute_copy_rows(const permute_plan_t &plan,
+                                                       const MLI_PTR(io_T) input, MLI_PTR(io_T) output) {
+    const int row_len = plan.shape[3];
+    for (int d0_cnt = 0; d0_cnt < plan.shape[0]; d0_cnt++) {
+        for (int d1_cnt = 0; d1_cnt < plan.shape[1]; d1_cnt++) {
+            for (int d2_cnt = 0; d2_cnt < plan.shape[2]; d2_cnt++) {
+                const MLI_PTR(io_T) src = input + d0_cnt * plan.in_stride[0] + d1_cnt * plan.in_stride[1]
+                                        + d2_cnt * plan.in_stride[2];
+                MLI_PTR(io_T) dst = output + d0_cnt * plan.out_stride[0] + d1_cnt * plan.out_stride[1]
+                                  + d2_cnt * plan.out_stride[2];
+                for (int idx = 0; idx < row_len; idx++) {
+                    dst[idx] = src[idx];
+                }
+            }
+        }
+    }
+}
+
+// Blocked transpose of a plane of rows x cols elements: element (r, c) is read from
+// input[c * in_col_stride + r] and written to output[r * out_row_stride + c].
+// Both reads and writes go along contiguous runs of kPermuteTile elements.
+template <typename io_T>
+static MLI_FORCE_INLINE void mli_krn_permute_transpose_plane(const MLI_PTR(io_T) input, MLI_PTR(io_T) output,
+                                                             const int rows, const int cols,
+                                                             const int in_col_stride, const int out_row_stride) {
+    io_T tile[kPermuteTile][kPermuteTile];
+    for (int r0 = 0; r0 < rows; r0 += kPermuteTile) {
+        const int tile_rows = MIN(kPermuteTile, rows - r0);
+        for (int c0 = 0; c0 < cols; c0 += kPermuteTile) {
+            const int tile_cols = MIN(kPermuteTile, cols - c0);
+            const MLI_PTR(io_T) src = input + c0 * in_col_stride + r0;
+            MLI_PTR(io_T) dst = output + r0 * out_row_stride + c0;
+            if (tile_rows == kPermuteTile && tile_cols == kPermuteTile) {
+                for (int c = 0; c < kPermuteTile; c++) {
+                    for (int r = 0; r < kPermuteTile; r++) {
+                        tile[r][c] = src[c * in_col_stride + r];
+                    }
+                }
+                for (int r = 0; r < kPermuteTile; r++) {
+                    for (int c = 0; c < kPermuteTile; c++) {
+                        dst[r * out_row_stride + c] = tile[r][c];
+                    }
+                }
+            } else {
+                for (int r = 0; r < tile_rows; r++) {
+                    for (int c = 0; c < tile_cols; c++) {
+                        dst[r * out_row_stride + c] = src[c * in_col_stride + r];
+                    }
+                }
+            }
+        }
+    }
+}
+
+// Permutation which moves the innermost input dimension (dimension t of the plan) to another
+// position: each (t, 3) plane is transposed by tiles.
+template <typename io_T>
+static MLI_FORCE_INLINE void mli_krn_permute_transpose(const permute_plan_t &plan, const int t,
+                                                       const MLI_PTR(io_T) input, MLI_PTR(io_T) output) {
+    // the other two dimensions of the plan
+    int outer[2];
+    for (int k = 0, n = 0; k < MLI_MAX_RANK - 1; k++) {
+        if (k != t) outer[n++] = k;
+    }
+    const int a = outer[0];
+    const int b = outer[1];
+    for (int a_cnt = 0; a_cnt < plan.shape[a]; a_cnt++) {
+        for (int b_cnt = 0; b_cnt < plan.shape[b]; b_cnt++) {
+            mli_krn_permute_transpose_plane<io_T>(
+                    input + a_cnt * plan.in_stride[a] + b_cnt * plan.in_stride[b],
+                    output + a_cnt * plan.out_stride[a] + b_cnt * plan.out_stride[b],
+                    plan.shape[t], plan.shape[3], plan.in_stride[3], plan.out_stride[t]);
+        }
+    }
+}
+
+// Generic permutation: element by element in output order.
+template <typename io_T>
+static MLI_FORCE_INLINE void mli_krn_permute_generic(const permute_plan_t &plan,
+                                                     const MLI_PTR(io_T) input, MLI_PTR(io_T) output) {
+    for (int d0_cnt = 0; d0_cnt < plan.shape[0]; d0_cnt++) {
+        for (int d1_cnt = 0; d1_cnt < plan.shape[1]; d1_cnt++) {
+            for (int d2_cnt = 0; d2_cnt < plan.shape[2]; d2_cnt++) {
+                const MLI_PTR(io_T) src = input + d0_cnt * plan.in_stride[0] + d1_cnt * plan.in_stride[1]
+                                        + d2_cnt * plan.in_stride[2];
+                MLI_PTR(io_T) dst = output + d0_cnt * plan.out_stride[0] + d1_cnt * plan.out_stride[1]
+                                  + d2_cnt * plan.out_stride[2];
+                for (int d3_cnt = 0; d3_cnt < plan.shape[3]; d3_cnt++) {
+                    dst[d3_cnt * plan.out_stride[3]] = src[d3_cnt * plan.in_stride[3]];
+                }
+            }
+        }
+    }
+}
+
 template <typename io_T>
 static void mli_krn_permute_calc(const mli_tensor *in, uint32_t *out_shape, int *out_increments,
                                  int *perm_dim, const MLI_PTR(io_T) input, MLI_PTR(io_T) output) {
 
     auto in_prv =  mli_prv_get_generic_tensor<MLI_PTR(io_T)>(in);
-    // Main transpose operation.
-    const int inp_stride_3 = in_prv.mem_stride[perm_dim[3]];
-    const int inp_stride_2 = in_prv.mem_stride[perm_dim[2]];
-    const int inp_stride_1 = in_prv.mem_stride[perm_dim[1]];
-    const int inp_stride_0 = in_prv.mem_stride[perm_dim[0]];
-
-    // Increment calculation for each dimention.
-    for (int dim_ctr = 0; dim_ctr < MLI_MAX_RANK - 1; dim_ctr++) {
-        out_increments[dim_ctr] -= out_increments[dim_ctr + 1] * out_shape[dim_ctr + 1];
+    // Input strides in order of output dimensions.
+    int in_stride[MLI_MAX_RANK];
+    for (int k = 0; k < MLI_MAX_RANK; k++) {
+        in_stride[k] = in_prv.mem_stride[perm_dim[k]];
     }
+    const permute_plan_t plan = mli_krn_permute_plan(out_shape, in_stride, out_increments);
 
-    // Re-order the output tensor.
-    for (int d0_cnt = 0; d0_cnt < (int)out_shape[0]; d0_cnt++) {
-        for (int d1_cnt = 0; d1_cnt < (int)out_shape[1]; d1_cnt++) {
-            for (int d2_cnt = 0; d2_cnt < (int)out_shape[2]; d2_cnt++) {
-                for (int d3_cnt = 0; d3_cnt < (int)out_shape[3]; d3_cnt++) {
-                    *output = input[d0_cnt * inp_stride_0 + d1_cnt * inp_stride_1 \
-                              + d2_cnt * inp_stride_2 + d3_cnt * inp_stride_3];
-                    output += out_increments[3];
-                }
-                output += out_increments[2];
+    if (plan.in_stride[3] == 1 && plan.out_stride[3] == 1) {
+        // Permutation changes only the order of rows. If it is a view of the input
+        // with the same layout, there is nothing to do.
+        bool same_layout = (const void *)input == (const void *)output;
+        for (int k = 0; k < MLI_MAX_RANK - 1; k++) {
+            same_layout &= plan.in_stride[k] == plan.out_stride[k];
+        }
+        if (!same_layout) {
+            mli_krn_permute_copy_rows<io_T>(plan, input, output);
+        }
+        return;
+    }
+
+    if (plan.out_stride[3] == 1) {
+        for (int t = 0; t < MLI_MAX_RANK - 1; t++) {
+            if (plan.shape[t] > 1 && plan.in_stride[t] == 1) {
+                mli_krn_permute_transpose<io_T>(plan, t, input, output);
+                return;
             }
-            output += out_increments[1];
         }
-        output += out_increments[0];
     }
+
+    mli_krn_permute_generic<io_T>(plan, input, output);
 }
 
 template <typename io_T, bool asym>
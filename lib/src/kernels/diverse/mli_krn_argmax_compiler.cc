@@ -0,0 +1,97 @@
+/*
+ * Copyright 2022, Synopsys, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-3-Clause license found in
+ * the LICENSE file in the root directory of this source tree.
+ *
+ */
+#include <cstring>
+
+#include "mli_ref_runtime_api.hpp"
+#include "mli_ref_compiler_api.hpp"
+#include "mli_ref_private_types.hpp"
+
+namespace snps_arc::metaware::mli::ref {
+
+ArgMax_CS::ArgMax_CS(const lib_mli::PlatformDescription pd,
+                     const TensorIterator<NoBuffer, kArgMaxInRank, kArgMaxInIterRank> in,
+                     const ArgMaxConfig &cfg,
+                     const TensorIterator<NoBuffer, kArgMaxOutRank, kArgMaxOutIterRank> out)
+                     : m_cfg(cfg),
+                       m_in(in),
+                       m_out(out),
+                       m_pd(pd) {
+    uint32_t in_shape[kArgMaxInRank];
+    uint32_t out_shape[kArgMaxOutRank];
+    int32_t in_stride[kArgMaxInRank];
+    int32_t out_stride[kArgMaxOutRank];
+
+    in.get_full_shape(in_shape);
+    in.get_mem_strides(in_stride);
+    out.get_full_shape(out_shape);
+    out.get_mem_strides(out_stride);
+
+    m_input_buffer_size = service::GetBufferSize(kArgMaxInRank, in_shape, in_stride);
+    m_output_buffer_size = service::GetBufferSize(kArgMaxOutRank, out_shape, out_stride);
+}
+
+mli_status ArgMax_CS::AttachBufferOffsets(const OffsetBuffer &input,
+                                          const OffsetBuffer &output,
+                                          const OffsetBuffer &ctrl_buffer) {
+
+    m_in.set_buf(input);
+    m_out.set_buf(output);
+
+    return MLI_STATUS_OK;
+}
+
+mli_status ArgMax_CS::GetKernelPrivateData(void *kernel_private_data_buffer) {
+    ArgMaxPrivateData opaque_obj;
+
+    MLI_ASSERT(m_in.get_tensor().get_rank() == kArgMaxInRank);
+    MLI_ASSERT(m_out.get_tensor().get_rank() == kArgMaxOutRank);
+    MLI_ASSERT(m_out.get_elem_size() == sizeof(int16_t) || m_out.get_elem_size() == sizeof(int32_t));
+    MLI_ASSERT(m_cfg.axis < (int32_t)kArgMaxInRank);
+
+    opaque_obj.io_rank = m_in.get_tensor().get_rank();
+    opaque_obj.argmax_axis = (int8_t)(m_cfg.axis < 0 ? -1 : m_cfg.axis);
+    opaque_obj.input = m_in;
+    opaque_obj.output = m_out;
+
+    if (opaque_obj.argmax_axis < 0) {
+        // global indexes are computed inside a single tile
+        MLI_ASSERT(m_in.GetTotalCount() == 1);
+        for (uint32_t i = 0; i < kArgMaxOutRank; i++) {
+            MLI_ASSERT(m_out.get_tensor().get_dim(i) == 1);
+        }
+    } else {
+        // no tiling along the axis, the other dimensions are shared with the output
+        const auto &in_cfg = m_in.get_config();
+        for (uint32_t r = 0; r < kArgMaxInIterRank; r++) {
+            if (in_cfg.get_order(r) == opaque_obj.argmax_axis) {
+                MLI_ASSERT(in_cfg.get_count(r) == 1);
+            }
+        }
+        for (int32_t i = 0, o = 0; i < (int32_t)kArgMaxInRank; i++) {
+            if (i != opaque_obj.argmax_axis) {
+                MLI_ASSERT(m_in.get_tensor().get_dim(i) == m_out.get_tensor().get_dim(o));
+                o++;
+            }
+        }
+    }
+
+    std::memcpy(kernel_private_data_buffer, (void *)&opaque_obj, sizeof(opaque_obj));
+
+    return MLI_STATUS_OK;
+}
+
+unsigned ArgMax_CS::GetKernelPrivateDataSize() const {
+    return sizeof(ArgMaxPrivateData);
+}
+
+unsigned ArgMax_CS::GetRuntimeObjectSize() const {
+    return sizeof(ArgMax);
+}
+
+}  // namespace snps_arc::metaware::mli::ref
@@ -0,0 +1,185 @@
+/*
+* Copyright 2022, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+
+#ifndef _MLI_KRN_ELTWISE_CHAIN_REF_HPP_
+#define _MLI_KRN_ELTWISE_CHAIN_REF_HPP_
+
+#include <limits>
+
+#include "mli_debug.h"
+#include "mli_krn_eltwise.h"
+#include "mli_krn_rescale.hpp"
+
+namespace snps_arc::metaware::mli {
+namespace krn {
+namespace ref {
+
+// Values of the innermost dimension are processed in chunks kept on the stack. Each step is
+// a simple loop over the chunk and only the final values are stored to the output tile.
+constexpr int kEltwiseChainChunkSize = 64;
+
+// Parameters of a kRescale or kPrelu step: int32 in_bias[n], int32 out_bias[n], int16 scale[n]
+// (posscale[n], negscale[n] for kPrelu), int8 shift[n] (posshift[n], negshift[n] for kPrelu)
+struct eltwise_chain_rescale_t {
+    const int32_t *in_bias;
+    const int32_t *out_bias;
+    const int16_t *scale[2];   // [positive, negative]
+    const int8_t *shift[2];
+};
+
+static MLI_FORCE_INLINE eltwise_chain_rescale_t eltwise_chain_get_rescale(const int8_t *step_params,
+                                                                         const uint32_t n, const bool is_prelu) {
+    const int num_scales = is_prelu ? 2 : 1;
+    eltwise_chain_rescale_t p;
+    p.in_bias = reinterpret_cast<const int32_t *>(step_params);
+    p.out_bias = p.in_bias + n;
+    p.scale[0] = reinterpret_cast<const int16_t *>(p.out_bias + n);
+    p.scale[1] = p.scale[0] + (num_scales - 1) * n;
+    p.shift[0] = reinterpret_cast<const int8_t *>(p.scale[0] + num_scales * n);
+    p.shift[1] = p.shift[0] + (num_scales - 1) * n;
+    return p;
+}
+
+template <::mli::mli_eltwise_type func_type>
+static MLI_FORCE_INLINE void eltwise_chain_binary(int32_t *acc, const int32_t *rhs, const int count) {
+    for (int i = 0; i < count; i++) {
+        acc[i] = ::mli::krn::eltwise_perform_operation<int32_t, int32_t, func_type, false>(
+                acc[i], rhs[i], 0, 0, 0, 0, 0, 0, 0, 0);
+    }
+}
+
+// idx is the parameter of the first element of the chunk, idx_step is 1 for per channel parameters
+static MLI_FORCE_INLINE void eltwise_chain_rescale(int32_t *acc, const eltwise_chain_rescale_t &p,
+                                                   const bool is_prelu, int idx, const int idx_step,
+                                                   const int count) {
+    for (int i = 0; i < count; i++, idx += idx_step) {
+        const int sign = (is_prelu && acc[i] < p.in_bias[idx]) ? 1 : 0;
+        acc[i] = rescale_value<int32_t, int32_t>(acc[i], p.in_bias[idx], p.out_bias[idx],
+                                                 p.scale[sign][idx], p.shift[sign][idx]);
+    }
+}
+
+template <typename T>
+static MLI_FORCE_INLINE void eltwise_chain_load(const T *ptr, const int32_t stride, const int count,
+                                                int32_t *dst) {
+    for (int i = 0; i < count; i++) {
+        dst[i] = ptr[i * stride];
+    }
+}
+
+template <typename i_T, typename o_T>
+void eltwise_chain_run(const Tensor<InternalBuffer, kEltwiseRank> &in_left,
+                       const Tensor<InternalBuffer, kEltwiseRank> &in_right,
+                       const EltwiseChainConfig &cfg,
+                       const eltwise_chain_params_t &params,
+                       Tensor<InternalBuffer, kEltwiseRank> &out) {
+    constexpr int kInnerDim = kEltwiseRank - 1;
+    uint32_t shape[kEltwiseRank];
+    int32_t left_stride[kEltwiseRank];
+    int32_t right_stride[kEltwiseRank];
+    int32_t out_stride[kEltwiseRank];
+    out.get_dims(shape);
+    out.get_mem_strides(out_stride);
+    for (unsigned d = 0; d < kEltwiseRank; d++) {
+        // dimensions of size 1 are broadcasted
+        MLI_ASSERT(in_left.get_dim(d) == shape[d] || in_left.get_dim(d) == 1);
+        MLI_ASSERT(in_right.get_dim(d) == shape[d] || in_right.get_dim(d) == 1);
+        left_stride[d] = in_left.get_dim(d) == 1 ? 0 : in_left.get_mem_stride(d);
+        right_stride[d] = in_right.get_dim(d) == 1 ? 0 : in_right.get_mem_stride(d);
+    }
+
+    const i_T *left = in_left.get_buf().template get_ptr<i_T>() + in_left.get_offs();
+    const i_T *right = in_right.get_buf().template get_ptr<i_T>() + in_right.get_offs();
+    o_T *output = out.get_buf().template get_ptr<o_T>() + out.get_offs();
+
+    int32_t acc[kEltwiseChainChunkSize];
+    int32_t rhs[kEltwiseChainChunkSize];
+    for (uint32_t pos0 = 0; pos0 < shape[0]; pos0++) {
+        for (uint32_t pos1 = 0; pos1 < shape[1]; pos1++) {
+            for (uint32_t pos2 = 0; pos2 < shape[2]; pos2++) {
+                const i_T *left_row = left + pos0 * left_stride[0] + pos1 * left_stride[1] + pos2 * left_stride[2];
+                const i_T *right_row = right + pos0 * right_stride[0] + pos1 * right_stride[1] + pos2 * right_stride[2];
+                o_T *out_row = output + pos0 * out_stride[0] + pos1 * out_stride[1] + pos2 * out_stride[2];
+
+                for (uint32_t c0 = 0; c0 < shape[kInnerDim]; c0 += kEltwiseChainChunkSize) {
+                    const int count = MIN(kEltwiseChainChunkSize, (int)(shape[kInnerDim] - c0));
+                    eltwise_chain_load(left_row + c0 * left_stride[kInnerDim], left_stride[kInnerDim], count, acc);
+                    bool is_rhs_loaded = false;
+
+                    for (uint32_t s = 0; s < cfg.num_steps; s++) {
+                        const EltwiseChainStep &step = cfg.steps[s];
+                        const bool is_binary = step.op <= EltwiseChainOp::kMin;
+                        if (is_binary && !is_rhs_loaded) {
+                            eltwise_chain_load(right_row + c0 * right_stride[kInnerDim], right_stride[kInnerDim],
+                                               count, rhs);
+                            is_rhs_loaded = true;
+                        }
+
+                        switch (step.op) {
+                        case EltwiseChainOp::kAdd:
+                            eltwise_chain_binary<::mli::ELTWISE_ADD>(acc, rhs, count);
+                            break;
+                        case EltwiseChainOp::kSub:
+                            eltwise_chain_binary<::mli::ELTWISE_SUB>(acc, rhs, count);
+                            break;
+                        case EltwiseChainOp::kMul:
+                            eltwise_chain_binary<::mli::ELTWISE_MUL>(acc, rhs, count);
+                            break;
+                        case EltwiseChainOp::kMax:
+                            eltwise_chain_binary<::mli::ELTWISE_MAX>(acc, rhs, count);
+                            break;
+                        case EltwiseChainOp::kMin:
+                            eltwise_chain_binary<::mli::ELTWISE_MIN>(acc, rhs, count);
+                            break;
+                        case EltwiseChainOp::kRescale:
+                        case EltwiseChainOp::kPrelu: {
+                            const bool is_prelu = step.op == EltwiseChainOp::kPrelu;
+                            const uint32_t n = step.per_channel ? params.channels : 1;
+                            const int idx = step.per_channel ? params.ch_offset + (int)c0 : 0;
+                            eltwise_chain_rescale(acc, eltwise_chain_get_rescale(params.step_params[s], n, is_prelu),
+                                                  is_prelu, idx, step.per_channel ? 1 : 0, count);
+                            break;
+                        }
+                        case EltwiseChainOp::kClip: {
+                            const int32_t *limits = reinterpret_cast<const int32_t *>(params.step_params[s]);
+                            for (int i = 0; i < count; i++) {
+                                acc[i] = mli_math_min_fx(mli_math_max_fx(acc[i], limits[0]), limits[1]);
+                            }
+                            break;
+                        }
+                        case EltwiseChainOp::kLut: {
+                            const int8_t *lut = params.step_params[s];
+                            for (int i = 0; i < count; i++) {
+                                acc[i] = lut[MIN(MAX(acc[i], INT8_MIN), INT8_MAX) - INT8_MIN];
+                            }
+                            break;
+                        }
+                        default:
+                            MLI_ASSERT(0);
+                            break;
+                        }
+                    }
+
+                    o_T *out_ptr = out_row + c0 * out_stride[kInnerDim];
+                    for (int i = 0; i < count; i++) {
+                        const int32_t val = MIN(MAX(acc[i], (int32_t)std::numeric_limits<o_T>::min()),
+                                                (int32_t)std::numeric_limits<o_T>::max());
+                        out_ptr[i * out_stride[kInnerDim]] = static_cast<o_T>(val);
+                    }
+                }
+            }
+        }
+    }
+}
+
+} // namespace ref
+} // namespace krn
+} // namespace snps_arc::metaware::mli
+
+#endif // _MLI_KRN_ELTWISE_CHAIN_REF_HPP_
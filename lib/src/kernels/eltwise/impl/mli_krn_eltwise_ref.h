@@ -347,6 +347,137 @@ void calc_convert_params(const mli_tensor* in1, const mli_tensor* in2, const mli
     }
 }
 
+// Operation on a single pair of values with parameters prepared by calc_convert_params().
+// Used by fused kernels which apply eltwise operation right after the operands are calculated.
+template <typename io_T, mli_eltwise_type func_type, bool convert>
+MLI_FORCE_INLINE io_T eltwise_one_elem(const io_T op1, const io_T op2, const convert_params& params) {
+    return mli::krn::ref::eltwise_perform_operation<io_T, io_T, func_type, convert>(
+            op1, op2, params.in_offset1, params.in_offset2, params.out_offset,
+            params.scale16_1, params.scale16_2, params.pre_op_shift1, params.pre_op_shift2, params.post_op_shift);
+}
+
+// Input is broadcasted if it has less dimensions than output, or if one of its dimensions
+// has size 1 (or zero memory stride) where the output dimension is bigger.
+static MLI_FORCE_INLINE bool eltwise_is_broadcast(const mli_tensor *in, const mli_tensor *out) {
+    if (in->rank != out->rank) return true;
+    for (int i = 0; i < (int)out->rank; i++) {
+        if (out->shape[i] > 1 && (in->shape[i] != out->shape[i] || in->mem_stride[i] == 0))
+            return true;
+    }
+    return false;
+}
+
+// View of an input in the output shape. Dimensions are aligned starting from the inner-most one.
+// Missing dimensions and dimensions of size 1 get zero memory stride, so the same element is
+// reused along them instead of being copied.
+template <typename T>
+static MLI_FORCE_INLINE generic_tensor_private_t<T> eltwise_get_broadcast_tensor(
+        const mli_tensor *in, const mli_tensor *out) {
+    generic_tensor_private_t<T> tensor;
+    const int lead_dims = (int)out->rank - (int)in->rank;
+    MLI_ASSERT(lead_dims >= 0);
+
+    tensor.ptr = mli_prv_tensor_data_ptr<T>(in);
+    tensor.rank = out->rank;
+    for (int i = 0; i < (int)out->rank; i++) {
+        const int in_dim = i - lead_dims;
+        tensor.shape[i] = out->shape[i];
+        if (in_dim < 0 || in->shape[in_dim] == 1) {
+            tensor.mem_stride[i] = 0;
+        } else {
+            MLI_ASSERT(in->shape[in_dim] == out->shape[i]);
+            tensor.mem_stride[i] = in->mem_stride[in_dim];
+        }
+    }
+    return tensor;
+}
+
+// Merge neighbour dimensions which are adjacent in memory for all tensors (broadcasted dimensions
+// with zero stride are merged too) and drop dimensions of size 1. Result is aligned to MLI_MAX_RANK
+// dimensions, so the inner-most dimension is as long as possible.
+template <typename i_T, typename o_T>
+static MLI_FORCE_INLINE void eltwise_squash_broadcast_tensors(
+        generic_tensor_private_t<i_T> *in1_prv,
+        generic_tensor_private_t<i_T> *in2_prv,
+        generic_tensor_private_t<o_T> *out_prv) {
+    int shape[MLI_MAX_RANK];
+    int in1_stride[MLI_MAX_RANK];
+    int in2_stride[MLI_MAX_RANK];
+    int out_stride[MLI_MAX_RANK];
+    int num_dims = 0;
+
+    // dimensions are collected starting from the inner-most one
+    for (int i = out_prv->rank - 1; i >= 0; i--) {
+        if (out_prv->shape[i] == 1) continue;
+        const int prev = num_dims - 1;
+        if (num_dims > 0 &&
+                in1_prv->mem_stride[i] == in1_stride[prev] * shape[prev] &&
+                in2_prv->mem_stride[i] == in2_stride[prev] * shape[prev] &&
+                out_prv->mem_stride[i] == out_stride[prev] * shape[prev]) {
+            shape[prev] *= out_prv->shape[i];
+        } else {
+            shape[num_dims] = out_prv->shape[i];
+            in1_stride[num_dims] = in1_prv->mem_stride[i];
+            in2_stride[num_dims] = in2_prv->mem_stride[i];
+            out_stride[num_dims] = out_prv->mem_stride[i];
+            num_dims++;
+        }
+    }
+
+    for (int i = 0; i < MLI_MAX_RANK; i++) {
+        const int dim = MLI_MAX_RANK - 1 - i;
+        const bool used = i < num_dims;
+        in1_prv->shape[dim] = in2_prv->shape[dim] = out_prv->shape[dim] = used ? shape[i] : 1;
+        in1_prv->mem_stride[dim] = used ? in1_stride[i] : 0;
+        in2_prv->mem_stride[dim] = used ? in2_stride[i] : 0;
+        out_prv->mem_stride[dim] = used ? out_stride[i] : 0;
+    }
+    in1_prv->rank = in2_prv->rank = out_prv->rank = MLI_MAX_RANK;
+}
+
+// Operation on two non-scalar inputs where one or both of them are broadcasted.
+// After squashing, the inner loop runs along the inner-most dimension in one of the modes:
+//  - both inputs are vectors: per-channel broadcast, the same vector of the input is reused for each row
+//  - one input has zero stride: per-row broadcast, a single value of the input is used for the whole row
+//  - both inputs have zero stride: both values are the same for the whole row
+template <typename i_T, typename o_T, mli_eltwise_type func_type, bool convert>
+static void eltwise_op_broadcast(
+        const mli_tensor * in1,
+        const mli_tensor * in2,
+        mli_tensor * out,
+        const convert_params& params) {
+
+    MLI_PRINTF_FUNC();
+    auto in1_prv = eltwise_get_broadcast_tensor<MLI_PTR(i_T)>(in1, out);
+    auto in2_prv = eltwise_get_broadcast_tensor<MLI_PTR(i_T)>(in2, out);
+    auto out_prv = mli_prv_get_generic_tensor<MLI_OUT_PTR(o_T)>(out);
+    eltwise_squash_broadcast_tensors<MLI_PTR(i_T), MLI_OUT_PTR(o_T)>(&in1_prv, &in2_prv, &out_prv);
+
+    // inner loop moves by one element along the inner-most dimension
+    MLI_ASSERT(in1_prv.mem_stride[3] == 0 || in1_prv.mem_stride[3] == 1);
+    MLI_ASSERT(in2_prv.mem_stride[3] == 0 || in2_prv.mem_stride[3] == 1);
+    MLI_ASSERT(out_prv.mem_stride[3] == 1 || out_prv.shape[3] == 1);
+    const bool row_op1 = (in1_prv.mem_stride[3] == 0);
+    const bool row_op2 = (in2_prv.mem_stride[3] == 0);
+
+    for (int pos0 = 0; pos0 < out_prv.shape[0]; pos0++) {
+        for (int pos1 = 0; pos1 < out_prv.shape[1]; pos1++) {
+            for (int pos2 = 0; pos2 < out_prv.shape[2]; pos2++) {
+                const int idx1 = POS(&in1_prv, pos0, pos1, pos2, 0);
+                const int idx2 = POS(&in2_prv, pos0, pos1, pos2, 0);
+                const int idx = POS(&out_prv, pos0, pos1, pos2, 0);
+                const i_T op1_s = (row_op1) ? in1_prv.ptr[idx1] : 0;
+                const i_T op2_s = (row_op2) ? in2_prv.ptr[idx2] : 0;
+                mli::krn::eltwise_innerloop<i_T, o_T, func_type, convert>(
+                        in1_prv.ptr, in2_prv.ptr, out_prv.ptr, idx1, idx2, idx, out_prv.shape[3],
+                        op1_s, op2_s, row_op1, row_op2, params.in_offset1, params.in_offset2,
+                        params.out_offset, params.scale16_1, params.scale16_2,
+                        params.pre_op_shift1, params.pre_op_shift2, params.post_op_shift);
+            }
+        }
+    }
+}
+
 template <typename i_T, typename o_T, mli_eltwise_type func_type, bool convert, bool no_scalar , bool no_out_update,  bool shape_1d >
 void eltwise_prepare_and_run(
         const mli_tensor * in1,
@@ -429,6 +560,12 @@ void eltwise_prepare_and_run(
 
         return;
     } else {
+        if (!params.scalar_op1 && !params.scalar_op2 &&
+                (eltwise_is_broadcast(in1, out) || eltwise_is_broadcast(in2, out))) {
+            eltwise_op_broadcast<i_T, o_T, func_type, convert>(in1, in2, out, params);
+            return;
+        }
+
         flatten_count = 0;
         if (params.scalar_op1 && !params.scalar_op2) {
             flatten_count = mli_prv_squash_tensor_to_one_dim(in2, out);
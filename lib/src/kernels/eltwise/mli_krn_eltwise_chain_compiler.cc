@@ -0,0 +1,244 @@
+/*
+* Copyright 2022, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+#include <cstring>
+
+#include "mli_debug.h"
+#include "mli_ref_compiler_api.hpp"
+#include "mli_ref_runtime_api.hpp"
+#include "mli_ref_private_types.hpp"
+
+namespace snps_arc::metaware::mli::ref {
+
+// Parameters of int8, int16 and int32 tensors are encoded as int32
+static int32_t ReadParam(const Tensor<Buffer, kEltwiseChainParamRank> &param, uint32_t idx) {
+  switch (param.get_elem_size()) {
+    case sizeof(int8_t):
+      return param.read<int8_t>(idx);
+    case sizeof(int16_t):
+      return param.read<int16_t>(idx);
+    default:
+      MLI_ASSERT(param.get_elem_size() == sizeof(int32_t));
+      return param.read<int32_t>(idx);
+  }
+}
+
+template <typename T>
+static uint32_t WriteParams(const Tensor<Buffer, kEltwiseChainParamRank> &param, uint32_t num,
+                            Buffer &encoded_params, uint32_t offset) {
+  MLI_ASSERT(param.get_dim(0) == num);
+  for (uint32_t i = 0; i < num; i++) {
+    if constexpr (sizeof(T) == sizeof(int32_t)) {
+      encoded_params.write_obj(offset, ReadParam(param, i));
+    } else {
+      MLI_ASSERT(param.get_elem_size() == sizeof(T));
+      encoded_params.write_obj(offset, param.read<T>(i));
+    }
+    offset += sizeof(T);
+  }
+  return offset;
+}
+
+EltwiseChain_CS::EltwiseChain_CS(const lib_mli::PlatformDescription &pd,
+                                 const TensorIterator<NoBuffer, kEltwiseRank, kEltwiseIterRank> &in_left,
+                                 const TensorIterator<NoBuffer, kEltwiseRank, kEltwiseIterRank> &in_right,
+                                 const EltwiseChainConfig &cfg,
+                                 const TensorIterator<NoBuffer, kEltwiseRank, kEltwiseIterRank> &output)
+    : m_in_left(in_left),
+      m_in_right(in_right),
+      m_output(output),
+      m_config(cfg),
+      m_pd(pd) {
+  uint32_t in_left_shape[kEltwiseRank];
+  uint32_t in_right_shape[kEltwiseRank];
+  uint32_t output_shape[kEltwiseRank];
+  int32_t in_left_stride[kEltwiseRank];
+  int32_t in_right_stride[kEltwiseRank];
+  int32_t output_stride[kEltwiseRank];
+
+  in_left.get_full_shape(in_left_shape);
+  in_left.get_mem_strides(in_left_stride);
+  in_right.get_full_shape(in_right_shape);
+  in_right.get_mem_strides(in_right_stride);
+  output.get_full_shape(output_shape);
+  output.get_mem_strides(output_stride);
+
+  for (uint32_t i = 0; i < kEltwiseRank; ++i) {
+    // verify broadcasting
+    MLI_ASSERT(in_left_shape[i] == output_shape[i] || in_left_shape[i] == 1);
+    MLI_ASSERT(in_right_shape[i] == output_shape[i] || in_right_shape[i] == 1);
+  }
+  m_in_left_buffer_size  = service::GetBufferSize(in_left.get_rank(), in_left_shape, in_left_stride);
+  m_in_right_buffer_size = service::GetBufferSize(in_right.get_rank(), in_right_shape, in_right_stride);
+  m_output_buffer_size   = service::GetBufferSize(output.get_rank(), output_shape, output_stride);
+
+  // parameters of each step start at an aligned offset, so int32 values can be read directly
+  MLI_ASSERT(m_config.num_steps <= kEltwiseChainMaxSteps);
+  m_channels = output_shape[kEltwiseRank - 1];
+  uint32_t offset = 0;
+  for (uint32_t step = 0; step < m_config.num_steps; step++) {
+    const uint32_t num = GetStepParamsNum(step);
+    uint32_t size = 0;
+    switch (m_config.steps[step].op) {
+      case EltwiseChainOp::kRescale:
+        size = num * (2 * sizeof(int32_t) + sizeof(int16_t) + sizeof(int8_t));
+        break;
+      case EltwiseChainOp::kPrelu:
+        size = num * 2 * (sizeof(int32_t) + sizeof(int16_t) + sizeof(int8_t));
+        break;
+      case EltwiseChainOp::kClip:
+        size = 2 * sizeof(int32_t);
+        break;
+      case EltwiseChainOp::kLut:
+        size = kEltwiseChainLutSize * sizeof(int8_t);
+        break;
+      default:
+        break;
+    }
+    m_param_offsets[step] = offset;
+    offset += CEIL_RND(size, kMliAlignment);
+  }
+  m_encoded_params_size = offset;
+}
+
+uint32_t EltwiseChain_CS::GetStepParamsNum(uint32_t step) const {
+  return m_config.steps[step].per_channel ? m_channels : 1;
+}
+
+unsigned EltwiseChain_CS::GetKernelPrivateDataSize() const {
+  return sizeof(EltwiseChainPrivateData);
+}
+
+unsigned EltwiseChain_CS::GetRuntimeObjectSize() const {
+  return sizeof(EltwiseChain);
+}
+
+mli_status EltwiseChain_CS::GetKernelPrivateData(void* kernel_private_data_buffer) {
+  MLI_ASSERT(m_encoded_params_size == 0 || m_encoded_params.get_size() >= m_encoded_params_size);
+
+  EltwiseChainPrivateData obj;
+  obj.m_in_left_buffer = m_in_left;
+  obj.m_in_right_buffer = m_in_right;
+  obj.m_output_buffer = m_output;
+  obj.encoded_params = m_encoded_params;
+  obj.config = m_config;
+  obj.channels = m_channels;
+  for (uint32_t step = 0; step < kEltwiseChainMaxSteps; step++) {
+    obj.param_offsets[step] = step < m_config.num_steps ? m_param_offsets[step] : 0;
+  }
+
+  std::memcpy(kernel_private_data_buffer, (void *)&obj, sizeof(obj));
+
+  return MLI_STATUS_OK;
+}
+
+mli_status EltwiseChain_CS::AttachBufferOffsets(const OffsetBuffer &input_left,
+                                                const OffsetBuffer &input_right,
+                                                const OffsetBuffer &output,
+                                                const OffsetBuffer &encoded_params,
+                                                const OffsetBuffer &ctrl_buffer) {
+  m_in_left.set_buf(input_left);
+  m_in_right.set_buf(input_right);
+  m_output.set_buf(output);
+  m_encoded_params = encoded_params;
+
+  return MLI_STATUS_OK;
+}
+
+mli_status EltwiseChain_CS::EncodeRescaleParams(uint32_t step,
+                                                const Tensor<Buffer, kEltwiseChainParamRank> &in_bias,
+                                                const Tensor<Buffer, kEltwiseChainParamRank> &out_bias,
+                                                const Tensor<Buffer, kEltwiseChainParamRank> &scale,
+                                                const Tensor<Buffer, kEltwiseChainParamRank> &shift,
+                                                Buffer &encoded_params) {
+  if (step >= m_config.num_steps || m_config.steps[step].op != EltwiseChainOp::kRescale) {
+    return MLI_STATUS_BAD_FUNC_CFG;
+  }
+  MLI_ASSERT(encoded_params.get_size() >= m_encoded_params_size);
+
+  const uint32_t num = GetStepParamsNum(step);
+  uint32_t offset = m_param_offsets[step];
+  offset = WriteParams<int32_t>(in_bias, num, encoded_params, offset);
+  offset = WriteParams<int32_t>(out_bias, num, encoded_params, offset);
+  offset = WriteParams<int16_t>(scale, num, encoded_params, offset);
+  WriteParams<int8_t>(shift, num, encoded_params, offset);
+
+  return MLI_STATUS_OK;
+}
+
+mli_status EltwiseChain_CS::EncodePreluParams(uint32_t step,
+                                              const Tensor<Buffer, kEltwiseChainParamRank> &in_bias,
+                                              const Tensor<Buffer, kEltwiseChainParamRank> &out_bias,
+                                              const Tensor<Buffer, kEltwiseChainParamRank> &posscale,
+                                              const Tensor<Buffer, kEltwiseChainParamRank> &negscale,
+                                              const Tensor<Buffer, kEltwiseChainParamRank> &posshift,
+                                              const Tensor<Buffer, kEltwiseChainParamRank> &negshift,
+                                              Buffer &encoded_params) {
+  if (step >= m_config.num_steps || m_config.steps[step].op != EltwiseChainOp::kPrelu) {
+    return MLI_STATUS_BAD_FUNC_CFG;
+  }
+  MLI_ASSERT(encoded_params.get_size() >= m_encoded_params_size);
+
+  const uint32_t num = GetStepParamsNum(step);
+  uint32_t offset = m_param_offsets[step];
+  offset = WriteParams<int32_t>(in_bias, num, encoded_params, offset);
+  offset = WriteParams<int32_t>(out_bias, num, encoded_params, offset);
+  offset = WriteParams<int16_t>(posscale, num, encoded_params, offset);
+  offset = WriteParams<int16_t>(negscale, num, encoded_params, offset);
+  offset = WriteParams<int8_t>(posshift, num, encoded_params, offset);
+  WriteParams<int8_t>(negshift, num, encoded_params, offset);
+
+  return MLI_STATUS_OK;
+}
+
+mli_status EltwiseChain_CS::EncodeClipParams(uint32_t step,
+                                             const Tensor<Buffer, kEltwiseChainParamRank> &min_val,
+                                             const Tensor<Buffer, kEltwiseChainParamRank> &max_val,
+                                             Buffer &encoded_params) {
+  if (step >= m_config.num_steps || m_config.steps[step].op != EltwiseChainOp::kClip) {
+    return MLI_STATUS_BAD_FUNC_CFG;
+  }
+  MLI_ASSERT(encoded_params.get_size() >= m_encoded_params_size);
+
+  uint32_t offset = m_param_offsets[step];
+  offset = WriteParams<int32_t>(min_val, 1, encoded_params, offset);
+  WriteParams<int32_t>(max_val, 1, encoded_params, offset);
+
+  return MLI_STATUS_OK;
+}
+
+mli_status EltwiseChain_CS::EncodeLutParams(uint32_t step,
+                                            const Tensor<Buffer, kEltwiseChainParamRank> &lut,
+                                            Buffer &encoded_params) {
+  if (step >= m_config.num_steps || m_config.steps[step].op != EltwiseChainOp::kLut) {
+    return MLI_STATUS_BAD_FUNC_CFG;
+  }
+  MLI_ASSERT(encoded_params.get_size() >= m_encoded_params_size);
+
+  WriteParams<int8_t>(lut, kEltwiseChainLutSize, encoded_params, m_param_offsets[step]);
+
+  return MLI_STATUS_OK;
+}
+
+unsigned EltwiseChain_CS::GetEncodedParamsSize() const {
+  return m_encoded_params_size;
+}
+
+unsigned EltwiseChain_CS::GetInputLeftBufferSize() {
+  return m_in_left_buffer_size;
+}
+
+unsigned EltwiseChain_CS::GetInputRightBufferSize() {
+  return m_in_right_buffer_size;
+}
+
+unsigned EltwiseChain_CS::GetOutputBufferSize() {
+  return m_output_buffer_size;
+}
+
+}  // namespace snps_arc::metaware::mli::ref
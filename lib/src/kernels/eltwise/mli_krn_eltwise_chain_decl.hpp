@@ -0,0 +1,49 @@
+/*
+* Copyright 2022, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+
+#ifndef _MLI_KRN_ELTWISE_CHAIN_DECL_HPP_
+#define _MLI_KRN_ELTWISE_CHAIN_DECL_HPP_
+
+#include "mli_config.h"
+#include "mli_types.h"
+#include "mli_types.hpp"
+
+namespace snps_arc::metaware::mli {
+namespace krn {
+////////////////////////////////////////////////////////////////////////////////
+// Functions (in *_ref/*_dsp/*vdsp) that can be called from outside their own
+// file must be declared here. This includes all overloads. For example, if we
+// have: io_T f(io_T a) and int8_t f(int8_t a), then both must be declared.
+// Not doing so, can cause the compiler to use the wrong overload.
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// REF
+////////////////////////////////////////////////////////////////////////////////
+namespace ref {
+
+// Encoded parameters of the chain (see EltwiseChain_CS) prepared for the current tile
+struct eltwise_chain_params_t {
+    const int8_t *step_params[kEltwiseChainMaxSteps];  // parameters of each step or nullptr
+    uint32_t channels;                                  // number of encoded per channel parameters
+    int32_t ch_offset;                                  // channel of the first element of the tile
+};
+
+template <typename i_T, typename o_T>
+void eltwise_chain_run(const Tensor<InternalBuffer, kEltwiseRank> &in_left,
+                       const Tensor<InternalBuffer, kEltwiseRank> &in_right,
+                       const EltwiseChainConfig &cfg,
+                       const eltwise_chain_params_t &params,
+                       Tensor<InternalBuffer, kEltwiseRank> &out);
+
+} // namespace ref
+} // namespace krn
+} // namespace snps_arc::metaware::mli
+
+#endif // _MLI_KRN_ELTWISE_CHAIN_DECL_HPP_
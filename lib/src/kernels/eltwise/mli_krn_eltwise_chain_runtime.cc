@@ -0,0 +1,130 @@
+/*
+* Copyright 2022, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+#include <cstring>
+
+#include "mli_debug.h"
+#include "mli_krn_eltwise_chain.hpp"
+#include "mli_ref_runtime_api.hpp"
+#include "mli_iterator.hpp"
+
+namespace snps_arc::metaware::mli::ref {
+
+namespace mli_krn = ::snps_arc::metaware::mli::krn;
+
+template <typename i_T>
+static mli_status RunChain(uint32_t o_elem_size,
+                           const Tensor<InternalBuffer, kEltwiseRank> &in_left,
+                           const Tensor<InternalBuffer, kEltwiseRank> &in_right,
+                           const EltwiseChainConfig &cfg,
+                           const mli_krn::eltwise_chain_params_t &params,
+                           Tensor<InternalBuffer, kEltwiseRank> &out) {
+  switch (o_elem_size) {
+    case sizeof(int8_t):
+      mli_krn::eltwise_chain_run<i_T, int8_t>(in_left, in_right, cfg, params, out);
+      break;
+    case sizeof(int16_t):
+      mli_krn::eltwise_chain_run<i_T, int16_t>(in_left, in_right, cfg, params, out);
+      break;
+    case sizeof(int32_t):
+      mli_krn::eltwise_chain_run<i_T, int32_t>(in_left, in_right, cfg, params, out);
+      break;
+    default:
+      return MLI_STATUS_NOT_SUPPORTED;
+  }
+  return MLI_STATUS_OK;
+}
+
+EltwiseChain::EltwiseChain(void* kernel_private_data_buffer, size_t size, uint64_t membases[], int num_mems) {
+  MLI_ASSERT(size == sizeof(EltwiseChainPrivateData));
+  EltwiseChainPrivateData private_buffer;
+  memcpy(&private_buffer, kernel_private_data_buffer, sizeof(EltwiseChainPrivateData));
+  MLI_ASSERT(private_buffer.kernel_id == kEltwiseChainId);
+  MLI_ASSERT(private_buffer.size == sizeof(EltwiseChainPrivateData));
+
+  m_i_elem_size = private_buffer.m_in_left_buffer.get_elem_size();
+  m_o_elem_size = private_buffer.m_output_buffer.get_elem_size();
+  // left and right input have the same type
+  MLI_ASSERT(private_buffer.m_in_right_buffer.get_elem_size() == m_i_elem_size);
+
+  m_input_left = private_buffer.m_in_left_buffer;
+  m_input_right = private_buffer.m_in_right_buffer;
+  m_output = private_buffer.m_output_buffer;
+
+  m_config = private_buffer.config;
+  m_channels = private_buffer.channels;
+  for (uint32_t step = 0; step < kEltwiseChainMaxSteps; step++) {
+    m_param_offsets[step] = private_buffer.param_offsets[step];
+  }
+  if (private_buffer.encoded_params.get_size() > 0) {
+    m_encoded_params = InternalBuffer(private_buffer.encoded_params, membases, num_mems);
+  }
+
+  m_tile_input_left = Tensor<InternalBuffer, kEltwiseRank>(m_input_left.GetSubTensor(), membases, num_mems);
+  m_tile_input_right = Tensor<InternalBuffer, kEltwiseRank>(m_input_right.GetSubTensor(), membases, num_mems);
+  m_tile_output = Tensor<InternalBuffer, kEltwiseRank>(m_output.GetSubTensor(), membases, num_mems);
+}
+
+mli_status EltwiseChain::Issue() {
+  // per channel parameters are encoded for all channels of the output
+  int32_t out_pos[kEltwiseRank];
+  m_output.get_pos(out_pos);
+
+  mli_krn::eltwise_chain_params_t params;
+  params.channels = m_channels;
+  params.ch_offset = out_pos[kEltwiseRank - 1];
+  for (uint32_t step = 0; step < kEltwiseChainMaxSteps; step++) {
+    const bool has_params = step < m_config.num_steps && m_config.steps[step].op > EltwiseChainOp::kMin;
+    params.step_params[step] = has_params ? m_encoded_params.get_ptr<int8_t>() + m_param_offsets[step] : nullptr;
+  }
+
+  switch (m_i_elem_size) {
+    case sizeof(int8_t):
+      return RunChain<int8_t>(m_o_elem_size, m_tile_input_left, m_tile_input_right, m_config, params, m_tile_output);
+    case sizeof(int16_t):
+      return RunChain<int16_t>(m_o_elem_size, m_tile_input_left, m_tile_input_right, m_config, params, m_tile_output);
+    case sizeof(int32_t):
+      return RunChain<int32_t>(m_o_elem_size, m_tile_input_left, m_tile_input_right, m_config, params, m_tile_output);
+    default:
+      return MLI_STATUS_NOT_SUPPORTED;
+  }
+}
+
+mli_status EltwiseChain::Prefetch() {
+  return MLI_STATUS_OK;
+}
+
+mli_status EltwiseChain::Update() {
+  m_input_left.Next();
+  m_input_right.Next();
+  m_output.Next();
+
+  uint32_t tile_shape[kEltwiseRank];
+  m_input_left.GetSubTensor().get_dims(tile_shape);
+  m_tile_input_left = Tensor<InternalBuffer, kEltwiseRank>(m_tile_input_left, tile_shape);
+  m_input_right.GetSubTensor().get_dims(tile_shape);
+  m_tile_input_right = Tensor<InternalBuffer, kEltwiseRank>(m_tile_input_right, tile_shape);
+  m_output.GetSubTensor().get_dims(tile_shape);
+  m_tile_output = Tensor<InternalBuffer, kEltwiseRank>(m_tile_output, tile_shape);
+
+  return MLI_STATUS_OK;
+}
+
+void EltwiseChain::GetIOSizesAndOffsets(uint32_t input_left_size[kEltwiseRank], uint32_t input_right_size[kEltwiseRank],
+                                        uint32_t output_size[kEltwiseRank], int32_t input_left_offsets[kEltwiseRank],
+                                        int32_t input_right_offsets[kEltwiseRank], int32_t output_offsets[kEltwiseRank]) const {
+  m_input_left.get_pos(input_left_offsets);
+  m_input_right.get_pos(input_right_offsets);
+  m_output.get_pos(output_offsets);
+
+  m_tile_input_left.get_dims(input_left_size);
+  m_tile_input_right.get_dims(input_right_size);
+  m_tile_output.get_dims(output_size);
+}
+
+}  // namespace snps_arc::metaware::mli::ref
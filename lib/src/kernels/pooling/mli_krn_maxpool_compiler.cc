@@ -57,6 +57,7 @@ mli_status MaxPool2D_CS::GetKernelPrivateData(
   Pool2DPrivateData obj(kMaxPool2DId);
   obj.input = m_input;
   obj.output = m_output;
+  obj.layout = GetFeatureMapLayout(m_input.get_tensor(), kTensorWidthDim, kTensorChannelDim);
   obj.config = m_config;
   std::memcpy(kernel_private_data_buffer, (void *)&obj, sizeof(obj));
 
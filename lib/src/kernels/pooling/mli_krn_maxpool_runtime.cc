@@ -14,6 +14,7 @@
 #include "mli_ref_private_types.hpp"
 #include "mli_ref_runtime_api.hpp"
 #include "mli_compiler_api.hpp"
+#include "mli_krn_pool_chw.h"
 #include "mli_krn_pool_hwc.h"
 #include "mli_prv_tensor.h"
 #include "mli_iterator.hpp"
@@ -32,6 +33,8 @@ MaxPool2D::MaxPool2D(void* kernel_private_data_buffer, size_t size,
 
   m_io_elem_size = maxpool2d_private_buffer.input.get_buf().get_elem_size();
   MLI_ASSERT(m_io_elem_size == maxpool2d_private_buffer.output.get_buf().get_elem_size());
+  m_layout = maxpool2d_private_buffer.layout;
+  MLI_ASSERT(m_layout == LAYOUT_HWC || m_layout == LAYOUT_CHW);
 
   // MaxPool2D configuration construction
   m_cfg.kernel_width = maxpool2d_private_buffer.config.kernel_size[1];
@@ -102,7 +105,11 @@ mli_status MaxPool2D::Issue() {
     int16_t* in_ptr = m_tile_input.data.mem.pi16;
     int16_t* out_ptr = m_tile_output.data.mem.pi16;
     for (uint32_t i = 0; i < m_tile_batch_size; i++) {
-      mli_krn::mli_krn_pool_hwc<mli_krn::MAXPOOL, int16_t, int16_t, POOL_NO_FIXED_KRN_SIZE>(&m_tile_input, &m_tile_cfg, &m_tile_output);
+      if (m_layout == LAYOUT_CHW) {
+        mli_krn::mli_krn_pool_chw<mli_krn::MAXPOOL, int16_t, int16_t, POOL_NO_FIXED_KRN_SIZE>(&m_tile_input, &m_tile_cfg, &m_tile_output);
+      } else {
+        mli_krn::mli_krn_pool_hwc<mli_krn::MAXPOOL, int16_t, int16_t, POOL_NO_FIXED_KRN_SIZE>(&m_tile_input, &m_tile_cfg, &m_tile_output);
+      }
       m_tile_input.data.mem.pi16 += m_input_batch_offset;
       m_tile_output.data.mem.pi16 += m_output_batch_offset;
     }
@@ -112,7 +119,11 @@ mli_status MaxPool2D::Issue() {
     int8_t* in_ptr = m_tile_input.data.mem.pi8;
     int8_t* out_ptr = m_tile_output.data.mem.pi8;
     for (uint32_t i = 0; i < m_tile_batch_size; i++) {
-      mli_krn::mli_krn_pool_hwc<mli_krn::MAXPOOL, int8_t, int8_t, POOL_NO_FIXED_KRN_SIZE>(&m_tile_input, &m_tile_cfg, &m_tile_output);
+      if (m_layout == LAYOUT_CHW) {
+        mli_krn::mli_krn_pool_chw<mli_krn::MAXPOOL, int8_t, int8_t, POOL_NO_FIXED_KRN_SIZE>(&m_tile_input, &m_tile_cfg, &m_tile_output);
+      } else {
+        mli_krn::mli_krn_pool_hwc<mli_krn::MAXPOOL, int8_t, int8_t, POOL_NO_FIXED_KRN_SIZE>(&m_tile_input, &m_tile_cfg, &m_tile_output);
+      }
       m_tile_input.data.mem.pi8 += m_input_batch_offset;
       m_tile_output.data.mem.pi8 += m_output_batch_offset;
     }
@@ -0,0 +1,48 @@
+/*
+* Copyright 2022, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+
+#ifndef _MLI_KRN_POOL_CHW_H_
+#define _MLI_KRN_POOL_CHW_H_
+
+#include "mli_krn_pool_hwc.h"
+#include "mli_prv_tensor.h"
+
+namespace mli {
+namespace krn {
+
+// Pooling of a CHW feature map described as HWC tensor with the width as inner-most dimension.
+// Channels are independent, so each channel plane is pooled as a single channel HWC tensor:
+// the kernel walks along contiguous rows and no permutation of the map is needed.
+template <pool_type type, typename i_T, typename o_T, int fixed_kernel_size, bool convert = false>
+static void mli_krn_pool_chw(const mli_tensor * in, const mli_pool_cfg * cfg, mli_tensor * out) {
+    MLI_ASSERT(in->rank == 3 && out->rank == 3);
+    MLI_ASSERT(in->shape[FMAP_C_DIM_HWC] == out->shape[FMAP_C_DIM_HWC]);
+    const int channels = (int)in->shape[FMAP_C_DIM_HWC];
+
+    mli_tensor in_plane = *in;
+    mli_tensor out_plane = *out;
+    in_plane.shape[FMAP_C_DIM_HWC] = 1;
+    out_plane.shape[FMAP_C_DIM_HWC] = 1;
+    for (int ch_idx = 0; ch_idx < channels; ch_idx++) {
+        mli_prv_tensor_set_data_ptr(&in_plane, mli_prv_tensor_data_ptr<MLI_PTR(i_T)>(in)
+                                    + ch_idx * in->mem_stride[FMAP_C_DIM_HWC]);
+        mli_prv_tensor_set_data_ptr(&out_plane, mli_prv_tensor_data_ptr<MLI_OUT_PTR(o_T)>(out)
+                                    + ch_idx * out->mem_stride[FMAP_C_DIM_HWC]);
+        mli_krn_pool_hwc<type, i_T, o_T, fixed_kernel_size, convert>(&in_plane, cfg, &out_plane);
+    }
+    // Single channel tensor gets element parameters of the input (see mli_krn_pool_hwc)
+    if (type == MAXPOOL) {
+        out->el_params = in->el_params;
+    }
+}
+
+} // krn
+} // mli
+
+#endif // _MLI_KRN_POOL_CHW_H_
@@ -14,6 +14,7 @@
 #include "mli_ref_private_types.hpp"
 #include "mli_ref_runtime_api.hpp"
 #include "mli_compiler_api.hpp"
+#include "mli_krn_pool_chw.h"
 #include "mli_krn_pool_hwc.h"
 #include "mli_prv_tensor.h"
 #include "mli_iterator.hpp"
@@ -32,6 +33,8 @@ SumPool2D::SumPool2D(void* kernel_private_data_buffer, size_t size,
 
   m_i_elem_size = private_data.input.get_buf().get_elem_size();
   m_o_elem_size = private_data.output.get_buf().get_elem_size();
+  m_layout = private_data.layout;
+  MLI_ASSERT(m_layout == LAYOUT_HWC || m_layout == LAYOUT_CHW);
 
   m_input_batch_offset = private_data.input.get_mem_stride(kTensorBatchDim);
   m_output_batch_offset = private_data.output.get_mem_stride(kTensorBatchDim);
@@ -98,9 +101,15 @@ mli_status SumPool2D::Issue() {
     int8_t* in_ptr = m_tile_input.data.mem.pi8;
     int32_t* out_ptr = m_tile_output.data.mem.pi32;
     for (uint32_t i = 0; i < m_tile_batch_size; i++) {
-      mli_krn::mli_krn_pool_hwc
-        <mli_krn::SUMPOOL, int8_t, int32_t, POOL_NO_FIXED_KRN_SIZE>(
-          &m_tile_input, &m_tile_cfg, &m_tile_output);
+      if (m_layout == LAYOUT_CHW) {
+        mli_krn::mli_krn_pool_chw
+          <mli_krn::SUMPOOL, int8_t, int32_t, POOL_NO_FIXED_KRN_SIZE>(
+            &m_tile_input, &m_tile_cfg, &m_tile_output);
+      } else {
+        mli_krn::mli_krn_pool_hwc
+          <mli_krn::SUMPOOL, int8_t, int32_t, POOL_NO_FIXED_KRN_SIZE>(
+            &m_tile_input, &m_tile_cfg, &m_tile_output);
+      }
       m_tile_input.data.mem.pi8 += m_input_batch_offset;
       m_tile_output.data.mem.pi32 += m_output_batch_offset;
     }
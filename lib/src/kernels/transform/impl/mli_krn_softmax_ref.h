@@ -205,6 +205,261 @@ MLI_FORCE_INLINE void mli_krn_softmax_sa8_run(
     return;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// Streaming (online) softmax
+////////////////////////////////////////////////////////////////////////////////
+// Maximum and sum of exponents are updated in a single pass: if a new value is bigger than the
+// current maximum, the sum is rescaled by exp(old_max - new_max) computed with the same LUT.
+
+// Log softmax output range is [-255/16, 0]
+const int kLogSoftmaxAsymZeroPoint = 127;
+const int kLogSoftmaxOutputShift = 4;
+// ln(2) in Q16
+const int32_t kLn2Q16 = 45426;
+// Running sum of exponents is halved (and sum_shift is incremented) when reaching this value
+const int32_t kSoftmaxStreamSumLimit = 1 << 30;
+
+static MLI_FORCE_INLINE void mli_krn_softmax_stream_reset(int32_t topk, mli_softmax_stream_state *state) {
+    state->max_val = INT8_MIN;
+    state->sum_exp = 0;
+    state->sum_shift = 0;
+    state->num_values = 0;
+    state->in_scale = 1;
+    state->in_shift = 0;
+    state->topk = topk;
+    state->topk_num = 0;
+}
+
+// exp(in - max_val) in Q15 (in real values of the input)
+static MLI_FORCE_INLINE int16_t mli_krn_softmax_stream_exp(
+        int8_t in,
+        int32_t max_val,
+        const mli_softmax_stream_state *state,
+        const mli_lut *lut) {
+    s8asym_quant_params in_params;
+    in_params.offset = (int16_t)max_val;
+    in_params.scale = (int16_t)state->in_scale;
+    in_params.shift = (int16_t)state->in_shift;
+    return mli::krn::activation_lut_one_elem_interpolate<int8_t, int16_t,
+            /* convert_input */ true,  /* convert_output */ false>(in, lut, /*in_frac_bits*/ 0, &in_params);
+}
+
+static MLI_FORCE_INLINE void mli_krn_softmax_stream_add(
+        int8_t val,
+        mli_softmax_stream_state *state,
+        const mli_lut *lut) {
+    if (val > state->max_val) {
+        if (state->sum_exp > 0) {
+            const int16_t rescale = mli_krn_softmax_stream_exp((int8_t)state->max_val, val, state, lut);
+            state->sum_exp = (int32_t)mli_math_asr_rnd_fx<int64_t>(
+                    mli_math_mul_fx<int32_t, int64_t>(state->sum_exp, rescale), kMaxFracBitsFx16);
+        }
+        state->max_val = val;
+    }
+
+    int32_t exp_res = mli_krn_softmax_stream_exp(val, state->max_val, state, lut);
+    state->sum_exp += mli_math_asr_rnd_fx<int32_t>(exp_res, state->sum_shift);
+    if (state->sum_exp >= kSoftmaxStreamSumLimit) {
+        state->sum_exp = mli_math_asr_rnd_fx<int32_t>(state->sum_exp, 1);
+        state->sum_shift++;
+    }
+
+    // Keep the largest values in descending order. Equal values are ordered by index.
+    if (state->topk > 0 && (state->topk_num < state->topk || val > state->topk_val[state->topk_num - 1])) {
+        int pos = mli_math_min_fx(state->topk_num, state->topk - 1);
+        if (state->topk_num < state->topk) state->topk_num++;
+        for (; pos > 0 && state->topk_val[pos - 1] < val; pos--) {
+            state->topk_val[pos] = state->topk_val[pos - 1];
+            state->topk_idx[pos] = state->topk_idx[pos - 1];
+        }
+        state->topk_val[pos] = val;
+        state->topk_idx[pos] = state->num_values;
+    }
+    state->num_values++;
+}
+
+static MLI_FORCE_INLINE void mli_krn_softmax_stream_update(
+        const generic_tensor_private_t<MLI_PTR(int8_t)> *in_prv,
+        const mli_lut *lut,
+        mli_softmax_stream_state *state) {
+    const MLI_PTR(int8_t) vec_in = in_prv->ptr;
+    for (int pos0 = 0; pos0 < in_prv->shape[0]; pos0++) {
+        for (int pos1 = 0; pos1 < in_prv->shape[1]; pos1++) {
+            for (int pos2 = 0; pos2 < in_prv->shape[2]; pos2++) {
+                for (int pos3 = 0; pos3 < in_prv->shape[3]; pos3++) {
+                    mli_krn_softmax_stream_add(vec_in[POS(in_prv, pos0, pos1, pos2, pos3)], state, lut);
+                }
+            }
+        }
+    }
+}
+
+// log2 of a positive integer in Q16
+static MLI_FORCE_INLINE int32_t mli_krn_softmax_log2_q16(int32_t val) {
+    MLI_ASSERT(val > 0);
+    const int norm = mli_math_norm_fx<int32_t, int>(val);
+    int32_t res = (30 - norm) << 16;
+    // mantissa in Q30 inside [1, 2): each squaring gives the next bit of the fractional part
+    int64_t mnt = (int64_t)val << norm;
+    for (int bit = 15; bit >= 0; bit--) {
+        mnt = (mnt * mnt) >> 30;
+        if (mnt >= (1LL << 31)) {
+            mnt >>= 1;
+            res |= 1 << bit;
+        }
+    }
+    return res;
+}
+
+// Normalization of a chunk with the final state. The same computations as in mli_krn_softmax_sa8_run(),
+// so result is identical if the maximum is the first value of the slice.
+template <bool is_log>
+static MLI_FORCE_INLINE void mli_krn_softmax_stream_normalize(
+        const generic_tensor_private_t<MLI_PTR(int8_t)> *in_prv,
+        const generic_tensor_private_t<MLI_PTR(int8_t)> *out_prv,
+        const mli_lut *lut,
+        const mli_softmax_stream_state *state) {
+    const MLI_PTR(int8_t) vec_in = in_prv->ptr;
+    MLI_PTR(int8_t) vec_out = out_prv->ptr;
+
+    int sum_exp = mli_math_norm_fx<mli_acc32_t, int>(state->sum_exp);
+    int16_t sum_mnt = mli_math_acc_cast_fx<int16_t, mli_acc32_t>(state->sum_exp, 16 - sum_exp);
+    int16_t sum_recip = (int16_t)MIN((1L << 29) / sum_mnt, 32767L);
+    int lut_frac_bits = lut->out_frac_bits * 2;
+    int sum_exp_overhead = kMaxFracBitsFx16 - sum_exp + state->sum_shift;
+    constexpr int max_shift = 31;
+    int shift = mli_math_min_fx(lut_frac_bits + sum_exp_overhead - kSoftmaxOutputShift, max_shift);
+
+    // ln(sum of exponents) in Q16
+    int32_t log2_sum = mli_krn_softmax_log2_q16(state->sum_exp) + ((state->sum_shift - kMaxFracBitsFx16) << 16);
+    int32_t log_sum = (int32_t)mli_math_asr_rnd_fx<int64_t>(
+            mli_math_mul_fx<int32_t, int64_t>(log2_sum, kLn2Q16), 16);
+
+    for (int pos0 = 0; pos0 < in_prv->shape[0]; pos0++) {
+        for (int pos1 = 0; pos1 < in_prv->shape[1]; pos1++) {
+            for (int pos2 = 0; pos2 < in_prv->shape[2]; pos2++) {
+                for (int pos3 = 0; pos3 < in_prv->shape[3]; pos3++) {
+                    const int8_t val = vec_in[POS(in_prv, pos0, pos1, pos2, pos3)];
+                    int8_t res;
+                    if (is_log) {
+                        // (val - max) * in_scale in Q16
+                        int64_t diff = mli_math_mul_fx<int32_t, int64_t>(val - state->max_val, state->in_scale);
+                        diff = mli_math_asr_rnd_fx<int64_t>(diff, state->in_shift - 16);
+                        int32_t out_val = (int32_t)mli_math_asr_rnd_fx<int64_t>(diff - log_sum,
+                                                                                 16 - kLogSoftmaxOutputShift);
+                        res = (int8_t)mli_math_bound_range_fx(out_val + kLogSoftmaxAsymZeroPoint, INT8_MIN, INT8_MAX);
+                    } else {
+                        int16_t exp_res = mli_krn_softmax_stream_exp(val, state->max_val, state, lut);
+                        mli_acc32_t fx_output32 = mli_math_mul_fx<int16_t, mli_acc32_t>(sum_recip, exp_res);
+                        res = mli_prv_convert_fx16_sa8<mli_acc32_t, int8_t>(fx_output32, kSoftmaxAsymZeroPoint, shift);
+                    }
+                    vec_out[POS(out_prv, pos0, pos1, pos2, pos3)] = res;
+                }
+            }
+        }
+    }
+}
+
+static MLI_FORCE_INLINE void mli_krn_softmax_stream_set_out_params(mli_tensor *out, bool is_log) {
+    out->el_params.sa.zero_point.mem.i16 = is_log ? kLogSoftmaxAsymZeroPoint : kSoftmaxAsymZeroPoint;
+    out->el_params.sa.scale.mem.i16 = 1;
+    out->el_params.sa.scale_frac_bits.mem.i8 = (int8_t)(is_log ? kLogSoftmaxOutputShift : kSoftmaxOutputShift);
+    out->el_params.sa.type = MLI_EL_PARAM_SC16_ZP16;
+    out->el_params.sa.dim = -1;
+}
+
+template <bool is_log>
+static MLI_FORCE_INLINE mli_status mli_krn_softmax_stream_normalize_run(
+        const mli_tensor *in,
+        const mli_lut *lut,
+        const mli_softmax_stream_state *state,
+        mli_tensor *out) {
+    auto in_prv = mli_prv_get_generic_tensor<MLI_PTR(int8_t)>(in);
+    auto out_prv = mli_prv_get_generic_tensor<MLI_PTR(int8_t)>(out);
+    mli_krn_softmax_stream_normalize<is_log>(&in_prv, &out_prv, lut, state);
+    mli_krn_softmax_stream_set_out_params(out, is_log);
+    return MLI_STATUS_OK;
+}
+
+static MLI_FORCE_INLINE mli_status mli_krn_softmax_stream_topk_run(
+        const mli_lut *lut,
+        const mli_softmax_stream_state *state,
+        mli_tensor *out,
+        mli_tensor *out_idx) {
+    MLI_ASSERT(state->topk_num <= MLI_SOFTMAX_STREAM_MAX_TOPK);
+
+    // Tracked values as an input chunk
+    int8_t topk_val[MLI_SOFTMAX_STREAM_MAX_TOPK];
+    for (int idx = 0; idx < state->topk_num; idx++) {
+        topk_val[idx] = state->topk_val[idx];
+    }
+    generic_tensor_private_t<MLI_PTR(int8_t)> in_prv;
+    generic_tensor_private_t<MLI_PTR(int8_t)> out_prv;
+    for (int k = 0; k < MLI_MAX_RANK; k++) {
+        in_prv.shape[k] = out_prv.shape[k] = 1;
+        in_prv.mem_stride[k] = out_prv.mem_stride[k] = 0;
+    }
+    in_prv.shape[MLI_MAX_RANK - 1] = out_prv.shape[MLI_MAX_RANK - 1] = state->topk_num;
+    in_prv.mem_stride[MLI_MAX_RANK - 1] = out_prv.mem_stride[MLI_MAX_RANK - 1] = 1;
+    in_prv.ptr = topk_val;
+    out_prv.ptr = mli_prv_tensor_data_ptr<MLI_PTR(int8_t)>(out);
+    mli_krn_softmax_stream_normalize</* is_log */ false>(&in_prv, &out_prv, lut, state);
+
+    MLI_PTR(int32_t) idx_ptr = mli_prv_tensor_data_ptr<MLI_PTR(int32_t)>(out_idx);
+    for (int idx = 0; idx < state->topk_num; idx++) {
+        idx_ptr[idx] = state->topk_idx[idx];
+    }
+
+    out->rank = out_idx->rank = 1;
+    out->shape[0] = out_idx->shape[0] = state->topk_num;
+    out->mem_stride[0] = out_idx->mem_stride[0] = 1;
+    mli_krn_softmax_stream_set_out_params(out, /* is_log */ false);
+    return MLI_STATUS_OK;
+}
+
+// Log softmax of a whole tensor: each slice is processed as a single chunk of streaming softmax
+static MLI_FORCE_INLINE mli_status mli_krn_log_softmax_run(
+        const mli_tensor *in,
+        const mli_lut *lut,
+        const mli_softmax_cfg *cfg,
+        mli_tensor *out) {
+
+    MLI_PTR(int8_t) in_ptr = mli_prv_tensor_data_ptr<MLI_PTR(int8_t)>(in);
+    MLI_PTR(int8_t) out_ptr = mli_prv_tensor_data_ptr<MLI_PTR(int8_t)>(out);
+
+    auto in_prv =  mli_prv_get_generic_tensor<MLI_PTR(int8_t)>(in);
+    auto out_prv = mli_prv_get_generic_tensor<MLI_PTR(int8_t)>(out);
+    auto in_non_axis_prv  = mli_prv_get_non_axis_tensor<MLI_PTR(int8_t)>(&in_prv,  cfg->axis);
+    auto out_non_axis_prv = mli_prv_get_non_axis_tensor<MLI_PTR(int8_t)>(&out_prv, cfg->axis);
+    in_prv  = mli_prv_get_axis_tensor<MLI_PTR(int8_t)>(&in_prv,  cfg->axis);
+    out_prv = mli_prv_get_axis_tensor<MLI_PTR(int8_t)>(&out_prv, cfg->axis);
+    mli_prv_squash_generic_tensor<MLI_PTR(int8_t), MLI_PTR(int8_t)>(&in_prv, &out_prv);
+
+    mli_softmax_stream_state state;
+    for (int dim0 = 0; dim0 < in_non_axis_prv.shape[0]; dim0++) {
+        for (int dim1 = 0; dim1 < in_non_axis_prv.shape[1]; dim1++) {
+            for (int dim2 = 0; dim2 < in_non_axis_prv.shape[2]; dim2++) {
+
+                in_prv.ptr = &in_ptr[dim0 * in_non_axis_prv.mem_stride[0] + 
+                                     dim1 * in_non_axis_prv.mem_stride[1] + 
+                                     dim2 * in_non_axis_prv.mem_stride[2]];
+                out_prv.ptr = &out_ptr[dim0 * out_non_axis_prv.mem_stride[0] + 
+                                       dim1 * out_non_axis_prv.mem_stride[1] + 
+                                       dim2 * out_non_axis_prv.mem_stride[2]];
+
+                mli_krn_softmax_stream_reset(/* topk */ 0, &state);
+                state.in_scale = in->el_params.sa.scale.mem.i16;
+                state.in_shift = in->el_params.sa.scale_frac_bits.mem.i8;
+                mli_krn_softmax_stream_update(&in_prv, lut, &state);
+                mli_krn_softmax_stream_normalize</* is_log */ true>(&in_prv, &out_prv, lut, &state);
+            }
+        }
+    }
+    mli_krn_softmax_stream_set_out_params(out, /* is_log */ true);
+
+    return MLI_STATUS_OK;
+}
+
 template <typename io_T, bool is_asym>
 static MLI_FORCE_INLINE mli_status mli_krn_softmax_run(
         const mli_tensor *in, 
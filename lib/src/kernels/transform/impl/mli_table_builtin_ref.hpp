@@ -0,0 +1,86 @@
+/*
+ * Copyright 2022, Synopsys, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-3-Clause license found in
+ * the LICENSE file in the root directory of this source tree.
+ *
+ */
+
+#ifndef _MLI_TABLE_BUILTIN_REF_HPP_
+#define _MLI_TABLE_BUILTIN_REF_HPP_
+
+#include "mli_math.h"
+#include "mli_types.h"
+#include "mli_prv_dsp.h"
+#include "mli_prv_tensor.h"
+#include "mli_prv_activation_lut.h"
+
+namespace snps_arc::metaware::mli {
+namespace krn {
+namespace ref {
+
+using lib_mli::kTableBuiltinIORank;
+using lib_mli::kTableBuiltinInFracBits;
+
+// Returns the builtin table for the given type or nullptr if there is no such table.
+static MLI_FORCE_INLINE const mli_lut *mli_table_builtin_get_lut(const LutType lut_type) {
+    switch (lut_type) {
+        case LutType::kSigmoid:
+            return &sigmoid_lut_fx16;
+        case LutType::kTanH:
+            return &tanh_lut_fx16;
+        case LutType::kNegExp:
+            return &expneg_lut_fx16;
+        default:
+            return nullptr;
+    }
+}
+
+// out = LUT(in + in_bias). The bias is either a single value (bias_axis < 0)
+// or a value per slice across the bias_axis dimension.
+template <typename io_T>
+mli_status MLI_FORCE_INLINE mli_table_builtin(const mli_tensor *in,
+                                              const io_T *in_bias,
+                                              const int32_t bias_axis,
+                                              const LutType lut_type,
+                                              mli_tensor *out) {
+
+    mli_prv_fx_init_dsp_ctrl();
+
+    const mli_lut *lut = mli_table_builtin_get_lut(lut_type);
+    if (lut == nullptr) {
+        return MLI_STATUS_NOT_SUPPORTED;
+    }
+
+    auto in_prv = mli_prv_get_generic_tensor<MLI_PTR(io_T)>(in);
+    auto out_prv = mli_prv_get_generic_tensor<MLI_OUT_PTR(io_T)>(out);
+
+    MLI_ASSERT(static_cast<int>(kTableBuiltinIORank) == in_prv.rank);
+    MLI_ASSERT(bias_axis < static_cast<int32_t>(kTableBuiltinIORank));
+
+    // Biased input goes to the output tensor and the table is applied in-place
+    int pos[kTableBuiltinIORank];
+    for (pos[0] = 0; pos[0] < in_prv.shape[0]; pos[0]++) {
+        for (pos[1] = 0; pos[1] < in_prv.shape[1]; pos[1]++) {
+            for (pos[2] = 0; pos[2] < in_prv.shape[2]; pos[2]++) {
+                for (pos[3] = 0; pos[3] < in_prv.shape[3]; pos[3]++) {
+                    const io_T bias = in_bias[bias_axis < 0 ? 0 : pos[bias_axis]];
+                    const io_T in_val = mli_prv_tensor_read(in_prv, pos[0], pos[1], pos[2], pos[3]);
+                    mli_prv_tensor_write(mli_math_add_fx<io_T>(in_val, bias), out_prv,
+                                         pos[0], pos[1], pos[2], pos[3]);
+                }
+            }
+        }
+    }
+
+    mli_prv_activation_lut_fx16(out, out, lut, kTableBuiltinInFracBits);
+
+    return MLI_STATUS_OK;
+}
+
+} // namespace ref
+} // namespace krn
+} // namespace snps_arc::metaware::mli
+
+#endif // _MLI_TABLE_BUILTIN_REF_HPP_
@@ -52,6 +52,72 @@ mli_status mli_krn_softmax_sa8(const mli_tensor *in, const mli_lut *lut, const m
     return ret;
 }
 
+mli_status mli_krn_log_softmax_sa8(const mli_tensor *in, const mli_lut *lut, const mli_softmax_cfg *cfg, mli_tensor *out) {
+    mli_status ret = MLI_CHECK_STATUS(mli_chk_softmax_sa8(in, cfg, out), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+    MLI_PRINT_COMPILE_OPTIONS();
+    mli_prv_fx_init_dsp_ctrl();
+
+    ret = mli::krn::ref::mli_krn_log_softmax_run(in, lut, cfg, out);
+    return ret;
+}
+
+mli_status mli_krn_softmax_stream_init(int32_t topk, mli_softmax_stream_state *state) {
+    mli_status ret = MLI_CHECK_STATUS(mli_chk_softmax_stream_init(topk, state), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+
+    mli::krn::ref::mli_krn_softmax_stream_reset(topk, state);
+    return MLI_STATUS_OK;
+}
+
+mli_status mli_krn_softmax_stream_update_sa8(const mli_tensor *in, const mli_lut *lut, mli_softmax_stream_state *state) {
+    mli_status ret = MLI_CHECK_STATUS(mli_chk_softmax_stream_update_sa8(in, state), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+    MLI_PRINT_COMPILE_OPTIONS();
+    mli_prv_fx_init_dsp_ctrl();
+
+    if (state->num_values == 0) {
+        state->in_scale = in->el_params.sa.scale.mem.i16;
+        state->in_shift = in->el_params.sa.scale_frac_bits.mem.i8;
+    }
+    auto in_prv = mli_prv_get_generic_tensor<MLI_PTR(int8_t)>(in);
+    mli::krn::ref::mli_krn_softmax_stream_update(&in_prv, lut, state);
+    return MLI_STATUS_OK;
+}
+
+mli_status mli_krn_softmax_stream_normalize_sa8(const mli_tensor *in, const mli_lut *lut,
+                                                const mli_softmax_stream_state *state, mli_tensor *out) {
+    mli_status ret = MLI_CHECK_STATUS(mli_chk_softmax_stream_normalize_sa8(in, state, out), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+    MLI_PRINT_COMPILE_OPTIONS();
+    mli_prv_fx_init_dsp_ctrl();
+
+    ret = mli::krn::ref::mli_krn_softmax_stream_normalize_run</* is_log */ false>(in, lut, state, out);
+    return ret;
+}
+
+mli_status mli_krn_log_softmax_stream_normalize_sa8(const mli_tensor *in, const mli_lut *lut,
+                                                    const mli_softmax_stream_state *state, mli_tensor *out) {
+    mli_status ret = MLI_CHECK_STATUS(mli_chk_softmax_stream_normalize_sa8(in, state, out), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+    MLI_PRINT_COMPILE_OPTIONS();
+    mli_prv_fx_init_dsp_ctrl();
+
+    ret = mli::krn::ref::mli_krn_softmax_stream_normalize_run</* is_log */ true>(in, lut, state, out);
+    return ret;
+}
+
+mli_status mli_krn_softmax_stream_topk_sa8(const mli_lut *lut, const mli_softmax_stream_state *state,
+                                           mli_tensor *out, mli_tensor *out_idx) {
+    mli_status ret = MLI_CHECK_STATUS(mli_chk_softmax_stream_topk_sa8(state, out, out_idx), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+    MLI_PRINT_COMPILE_OPTIONS();
+    mli_prv_fx_init_dsp_ctrl();
+
+    ret = mli::krn::ref::mli_krn_softmax_stream_topk_run(lut, state, out, out_idx);
+    return ret;
+}
+
 int32_t mli_krn_softmax_get_lut_size() {
     return (expneg_lut_fx16.length * sizeof(int16_t));
 }
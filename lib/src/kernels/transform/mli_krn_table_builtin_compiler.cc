@@ -0,0 +1,112 @@
+/*
+ * Copyright 2022, Synopsys, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-3-Clause license found in
+ * the LICENSE file in the root directory of this source tree.
+ *
+ */
+#include <cstring>
+
+#include "mli_ref_runtime_api.hpp"
+#include "mli_ref_compiler_api.hpp"
+#include "mli_ref_private_types.hpp"
+
+namespace snps_arc::metaware::mli::ref {
+
+TableBuiltin_CS::TableBuiltin_CS(const lib_mli::PlatformDescription pd,
+                                 const TensorIterator<NoBuffer, kTableBuiltinIORank, kTableBuiltinIOIterRank> &in,
+                                 const TableBuiltinConfig &cfg,
+                                 const TensorIterator<NoBuffer, kTableBuiltinIORank, kTableBuiltinIOIterRank> &out)
+                                 : m_config(cfg),
+                                   m_input(in),
+                                   m_output(out) {
+    uint32_t in_shape[kTableBuiltinIORank];
+    uint32_t out_shape[kTableBuiltinIORank];
+    int32_t in_stride[kTableBuiltinIORank];
+    int32_t out_stride[kTableBuiltinIORank];
+
+    in.get_full_shape(in_shape);
+    in.get_mem_strides(in_stride);
+    out.get_full_shape(out_shape);
+    out.get_mem_strides(out_stride);
+
+    for (uint32_t i = 0; i < kTableBuiltinIORank; i++) {
+        MLI_ASSERT(in_shape[i] == out_shape[i]);
+    }
+
+    m_input_buffer_size = service::GetBufferSize(kTableBuiltinIORank, in_shape, in_stride);
+    m_output_buffer_size = service::GetBufferSize(kTableBuiltinIORank, out_shape, out_stride);
+}
+
+unsigned TableBuiltin_CS::GetEncodedParamsSize() {
+    // 16-bit input bias per tensor or per slice across the innermost dimension
+    const uint32_t bias_len = m_config.innermost_dim_bias ? m_output.get_dim(kTableBuiltinIORank - 1) : 1;
+    return bias_len * sizeof(int16_t);
+}
+
+unsigned TableBuiltin_CS::GetParamsBufferSize() {
+    return GetEncodedParamsSize();
+}
+
+mli_status TableBuiltin_CS::EncodeParams(const TensorIterator<Buffer, kBiasRank, kBiasIterRank> &in_bias,
+                                         Buffer &encoded_params) {
+    const auto bias_tensor = in_bias.get_tensor();
+    const uint32_t bias_len = bias_tensor.get_dim(0);
+
+    MLI_ASSERT(bias_tensor.get_elem_size() == sizeof(int16_t));
+    MLI_ASSERT(bias_len * sizeof(int16_t) == GetEncodedParamsSize());
+    MLI_ASSERT(encoded_params.get_size() >= GetEncodedParamsSize());
+
+    for (uint32_t i = 0; i < bias_len; i++) {
+        encoded_params.write<int16_t>(i, bias_tensor.read<int16_t>(i * bias_tensor.get_mem_stride(0)));
+    }
+
+    return MLI_STATUS_OK;
+}
+
+mli_status TableBuiltin_CS::AttachBufferOffsets(const OffsetBuffer &input,
+                                                const OffsetBuffer &output,
+                                                const OffsetBuffer &params,
+                                                const OffsetBuffer &ctrl_buffer) {
+    MLI_ASSERT(params.get_size() >= GetEncodedParamsSize());
+
+    m_input.set_buf(input);
+    m_output.set_buf(output);
+    m_encoded_params = params;
+
+    return MLI_STATUS_OK;
+}
+
+mli_status TableBuiltin_CS::GetKernelPrivateData(void *kernel_private_data_buffer) {
+    TableBuiltinPrivateData opaque_obj;
+
+    MLI_ASSERT(m_input.get_tensor().get_rank() == m_output.get_tensor().get_rank());
+    MLI_ASSERT(m_input.get_elem_size() == sizeof(int16_t) && m_output.get_elem_size() == sizeof(int16_t));
+    MLI_ASSERT(m_config.type == LutType::kSigmoid || m_config.type == LutType::kTanH ||
+               m_config.type == LutType::kNegExp);
+
+    opaque_obj.io_rank = m_input.get_tensor().get_rank();
+    opaque_obj.table_axis = m_config.innermost_dim_bias ? kTableBuiltinIORank - 1 : -1;
+    opaque_obj.lut_mode = m_config.type;
+    opaque_obj.input = m_input;
+    opaque_obj.output = m_output;
+
+    uint32_t bias_shape[kBiasRank] = {GetEncodedParamsSize() / (uint32_t)sizeof(int16_t)};
+    Tensor<OffsetBuffer, kBiasRank> bias_tensor(m_encoded_params, bias_shape);
+    opaque_obj.in_bias = TensorIterator<OffsetBuffer, kBiasRank, kBiasIterRank>(bias_tensor);
+
+    std::memcpy(kernel_private_data_buffer, (void *)&opaque_obj, sizeof(opaque_obj));
+
+    return MLI_STATUS_OK;
+}
+
+unsigned TableBuiltin_CS::GetKernelPrivateDataSize() const {
+    return sizeof(TableBuiltinPrivateData);
+}
+
+unsigned TableBuiltin_CS::GetRuntimeObjectSize() const {
+    return sizeof(TableBuiltin);
+}
+
+}  // namespace snps_arc::metaware::mli::ref
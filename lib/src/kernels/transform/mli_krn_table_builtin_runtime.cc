@@ -0,0 +1,105 @@
+/*
+ * Copyright 2022, Synopsys, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-3-Clause license found in
+ * the LICENSE file in the root directory of this source tree.
+ *
+ */
+
+#include <cstring>
+
+#include "mli_debug.h"
+#include "mli_ref_runtime_api.hpp"
+#include "mli_table_builtin.hpp"
+#include "mli_ref_private_types.hpp"
+
+namespace snps_arc::metaware::mli::ref {
+
+namespace mli_krn = ::snps_arc::metaware::mli::krn;
+
+TableBuiltin::TableBuiltin(void* kernel_private_data_buffer, size_t size, uint64_t membases[], int num_mems) {
+
+    MLI_ASSERT(size == sizeof(TableBuiltinPrivateData));
+    TableBuiltinPrivateData private_buffer;
+    memcpy(&private_buffer, kernel_private_data_buffer, sizeof(TableBuiltinPrivateData));
+    MLI_ASSERT(private_buffer.size == sizeof(TableBuiltinPrivateData));
+
+    m_in_elem_size = private_buffer.input.get_tensor().get_elem_size();
+    m_out_elem_size = private_buffer.output.get_tensor().get_elem_size();
+    MLI_ASSERT(m_in_elem_size == sizeof(int16_t) && m_out_elem_size == sizeof(int16_t));
+
+    // construct configurations
+    m_metadata.lut_mode = private_buffer.lut_mode;
+    m_bias_axis = private_buffer.table_axis;
+
+    // construct Bias
+    m_metadata.in_bias = private_buffer.in_bias;
+    InternalBuffer bias_internal(private_buffer.in_bias.get_buf(), membases, num_mems);
+    m_bias = bias_internal.get_ptr<int16_t>();
+
+    // construct Input tensor
+    m_metadata.input = private_buffer.input;
+    const auto input_tile_tensor = m_metadata.input.GetSubTensor();
+    InternalBuffer input_internal(private_buffer.input.get_buf(), membases, num_mems);
+    m_tile_input.rank = private_buffer.io_rank;
+    m_tile_input.el_type = MLI_EL_FX_16;
+    m_tile_input.el_params.fx.frac_bits = kTableBuiltinInFracBits;
+    mli_prv_tensor_set_data_ptr(&m_tile_input, input_internal.get_ptr<int16_t>());
+    for(unsigned int i = 0; i < m_tile_input.rank ; i++){
+        m_tile_input.shape[i] = input_tile_tensor.get_dim(i);
+        m_tile_input.mem_stride[i] = private_buffer.input.get_mem_stride(i);
+    }
+
+    // construct Output tensor
+    m_metadata.output = private_buffer.output;
+    const auto output_tile_tensor = m_metadata.output.GetSubTensor();
+    InternalBuffer output_internal(private_buffer.output.get_buf(), membases, num_mems);
+    m_tile_output.rank = private_buffer.io_rank;
+    m_tile_output.el_type = MLI_EL_FX_16;
+    m_tile_output.el_params.fx.frac_bits = kTableBuiltinOutFracBits;
+    mli_prv_tensor_set_data_ptr(&m_tile_output, output_internal.get_ptr<int16_t>());
+    for(unsigned int i = 0; i < m_tile_output.rank ; i++){
+        m_tile_output.shape[i] = output_tile_tensor.get_dim(i);
+        m_tile_output.mem_stride[i] = private_buffer.output.get_mem_stride(i);
+    }
+}
+
+mli_status TableBuiltin::Issue() {
+    // bias values of the current tile start at its position along the bias axis
+    const int16_t* tile_bias = m_bias;
+    if (m_bias_axis >= 0) {
+        int32_t tile_pos[kTableBuiltinIOIterRank];
+        m_metadata.input.get_pos(tile_pos);
+        tile_bias += tile_pos[m_bias_axis];
+    }
+    return mli_krn::mli_table_builtin<int16_t>(&m_tile_input, tile_bias, m_bias_axis,
+                                               m_metadata.lut_mode, &m_tile_output);
+}
+
+mli_status TableBuiltin::Prefetch() { return MLI_STATUS_OK; }
+
+mli_status TableBuiltin::Update() {
+    m_metadata.input.Next();
+    m_metadata.output.Next();
+
+    m_metadata.input.GetSubTensor().get_dims(m_tile_input.shape);
+    m_metadata.output.GetSubTensor().get_dims(m_tile_output.shape);
+
+    return MLI_STATUS_OK;
+}
+
+void TableBuiltin::GetIOSizesAndOffsets(uint32_t input_size[kTableBuiltinIORank], uint32_t output_size[kTableBuiltinIORank],
+                                        int32_t input_offsets[kTableBuiltinIORank], int32_t output_offsets[kTableBuiltinIORank]) {
+    m_metadata.input.get_pos(input_offsets);
+
+    m_metadata.output.get_pos(output_offsets);
+
+    const auto input_tile_tensor = m_metadata.input.GetSubTensor();
+    input_tile_tensor.get_dims(input_size);
+
+    const auto output_tile_tensor = m_metadata.output.GetSubTensor();
+    output_tile_tensor.get_dims(output_size);
+}
+
+}  // namespace snps_arc::metaware::mli::ref
@@ -15,6 +15,7 @@
 #include "mli_mem_info.h"
 #include "mli_mov_api.h"
 #include "mli_mov.h"
+#include "mli_mov_emu.h"
 #include "mli_types.h"
 #include "mli_check.h"
 #include "mli_prv_load_store.h"
@@ -31,6 +32,86 @@ static mli_mov_dma_pool_t dma_pool = MLI_MOV_DMA_POOL_INIT;
 // singleton for callback functions
 static mli_mov_cb_t callbacktable[MAX_DMA_CHAN] = {{0}};
 
+#if defined(MLI_HOST_DMA_EMU)
+// singleton for transfers prepared for the host DMA emulator
+static mli_mov_job_t jobtable[MAX_DMA_CHAN];
+#endif
+
+//=====================================================================
+// Private functions
+//=====================================================================
+
+/**
+ * @brief Copy of the tensor data prepared by mli_mov_prepare
+ *
+ * @detail Sizes and strides are computed by mli_mov_prepare. Destination tensor
+ * parameters are already filled.
+ */
+static void mov_tensor_data(mli_mov_handle_t* h, const mli_tensor* src, const mli_mov_cfg_t* cfg, mli_tensor* dst,
+                            int32_t* src_mem_stride, uint32_t* src_cpy_size, uint32_t* dst_write_size,
+                            const bool src_in_vccm, const bool dst_in_vccm) {
+    const int rank = src->rank;
+
+    // copy tensor data, first check if it can be done in a single transfer.
+    bool is_possible_in_single1d_transfer = true;
+    bool no_padding = true;
+    int32_t stride = 1;
+    for (int i = rank - 1; i >=0; i--) {
+        // for a single 1d copy all data needs to be continuous in memory
+        // this means that the mem_stride of both source and destination
+        // needs to match the product of the shape.
+        // this also means that the shape of src and dst needs to be the same.
+        is_possible_in_single1d_transfer &= (src_mem_stride[i] == stride) && (dst->mem_stride[i] == stride);
+        is_possible_in_single1d_transfer &= (src->shape[i] == dst->shape[i]);
+        no_padding &= !(cfg->padding_pre[i] || cfg->padding_post[i]);
+        is_possible_in_single1d_transfer &= no_padding;
+        is_possible_in_single1d_transfer &= (cfg->perm_dim[i] == i);
+        is_possible_in_single1d_transfer &= (cfg->sub_sample_step[i] == 1);
+        stride *= src->shape[i];
+    }
+
+    if (is_possible_in_single1d_transfer) {
+        int copy_size = mli_hlp_count_elem_num(src, 0);
+        copy_size *= mli_hlp_tensor_element_size(src);
+        mli::mov::mli_mov_memcpy<int8_t>(h, src->data.mem.pi8, dst->data.mem.pi8, copy_size, 1, 1, src_in_vccm, dst_in_vccm, true, true, false);
+
+    } else {
+        bool no_inner_src_stride = ((src_mem_stride[cfg->perm_dim[rank-1]] * cfg->sub_sample_step[cfg->perm_dim[rank-1]]) == 1);
+        bool no_inner_dst_stride = (dst->mem_stride[rank-1] == 1);
+        uint32_t elem_size = mli_hlp_tensor_element_size(src);
+
+        if (no_inner_src_stride && no_inner_dst_stride) {
+            if (src_in_vccm && dst_in_vccm) {
+                mli::mov::mli_mov_prepare_run<true, true, true, true>(h, src, cfg, dst, dst_write_size, src_mem_stride, src_cpy_size,
+                        no_padding, elem_size);
+            } else {
+                mli::mov::mli_mov_prepare_run<false, false, true, true>(h, src, cfg, dst, dst_write_size, src_mem_stride, src_cpy_size,
+                        no_padding, elem_size);
+            }
+        } else {
+            if (src_in_vccm && dst_in_vccm) {
+                mli::mov::mli_mov_prepare_run<true, true, false, false>(h, src, cfg, dst, dst_write_size, src_mem_stride, src_cpy_size,
+                        no_padding, elem_size);
+            } else {
+                mli::mov::mli_mov_prepare_run<false, false, false, false>(h, src, cfg, dst, dst_write_size, src_mem_stride, src_cpy_size,
+                        no_padding, elem_size);
+            }
+        }
+    }
+}
+
+#if defined(MLI_HOST_DMA_EMU)
+/**
+ * @brief Transfer on the emulated DMA channel (called from the channel thread)
+ */
+static void mov_emu_run(int ch) {
+    mli_mov_job_t* job = &jobtable[ch];
+    mli_mov_handle_t h = {ch, 1, MLI_MOV_STATE_DMA_RUNNING};
+    mov_tensor_data(&h, &job->src, &job->cfg, &job->dst, job->src_mem_stride, job->src_cpy_size,
+                    job->dst_write_size, job->src_in_vccm, job->dst_in_vccm);
+}
+#endif
+
 //=====================================================================
 // Public functions
 //=====================================================================
@@ -225,52 +306,28 @@ mli_status mli_mov_prepare(mli_mov_handle_t* h, const mli_tensor* src, const mli
     // update state in the handle
     h->state = MLI_MOV_STATE_PREPARED;
 
-    // copy tensor data, first check if it can be done in a single transfer.
-    bool is_possible_in_single1d_transfer = true;
-    bool no_padding = true;
-    int32_t stride = 1;
-    for (int i = rank - 1; i >=0; i--) {
-        // for a single 1d copy all data needs to be continuous in memory
-        // this means that the mem_stride of both source and destination
-        // needs to match the product of the shape.
-        // this also means that the shape of src and dst needs to be the same.
-        is_possible_in_single1d_transfer &= (src_mem_stride[i] == stride) && (dst->mem_stride[i] == stride);
-        is_possible_in_single1d_transfer &= (src->shape[i] == dst->shape[i]);
-        no_padding &= !(cfg->padding_pre[i] || cfg->padding_post[i]);
-        is_possible_in_single1d_transfer &= no_padding;
-        is_possible_in_single1d_transfer &= (cfg->perm_dim[i] == i);
-        is_possible_in_single1d_transfer &= (cfg->sub_sample_step[i] == 1);
-        stride *= src->shape[i];
-    }
-
-    if (is_possible_in_single1d_transfer) {
-        int copy_size = mli_hlp_count_elem_num(src, 0);
-        copy_size *= mli_hlp_tensor_element_size(src);
-        mli::mov::mli_mov_memcpy<int8_t>(h, src->data.mem.pi8, dst->data.mem.pi8, copy_size, 1, 1, src_in_vccm, dst_in_vccm, true, true, false);
-
-    } else {
-        bool no_inner_src_stride = ((src_mem_stride[cfg->perm_dim[rank-1]] * cfg->sub_sample_step[cfg->perm_dim[rank-1]]) == 1);
-        bool no_inner_dst_stride = (dst->mem_stride[rank-1] == 1);
-        uint32_t elem_size = mli_hlp_tensor_element_size(src);
-
-        if (no_inner_src_stride && no_inner_dst_stride) {
-            if (src_in_vccm && dst_in_vccm) {
-                mli::mov::mli_mov_prepare_run<true, true, true, true>(h, src, cfg, dst, dst_write_size, src_mem_stride, src_cpy_size,
-                        no_padding, elem_size);
-            } else {
-                mli::mov::mli_mov_prepare_run<false, false, true, true>(h, src, cfg, dst, dst_write_size, src_mem_stride, src_cpy_size,
-                        no_padding, elem_size);
-            }
-        } else {
-            if (src_in_vccm && dst_in_vccm) {
-                mli::mov::mli_mov_prepare_run<true, true, false, false>(h, src, cfg, dst, dst_write_size, src_mem_stride, src_cpy_size,
-                        no_padding, elem_size);
-            } else {
-                mli::mov::mli_mov_prepare_run<false, false, false, false>(h, src, cfg, dst, dst_write_size, src_mem_stride, src_cpy_size,
-                        no_padding, elem_size);
-            }
+#if defined(MLI_HOST_DMA_EMU)
+    if (h->num_ch > 0 && mli_mov_emu_has_channel(h->dma_ch)) {
+        // data is copied by the emulated DMA channel after the transfer is started
+        mli_mov_job_t* job = &jobtable[h->dma_ch];
+        job->src = *src;
+        job->cfg = *cfg;
+        job->dst = *dst;
+        job->bytes = mli_hlp_tensor_element_size(src);
+        for (int i = 0; i < MLI_MAX_RANK; i++) {
+            job->src_mem_stride[i] = src_mem_stride[i];
+            job->src_cpy_size[i] = src_cpy_size[i];
+            job->dst_write_size[i] = dst_write_size[i];
+            job->bytes *= dst_write_size[i];
         }
+        job->src_in_vccm = src_in_vccm;
+        job->dst_in_vccm = dst_in_vccm;
+        h->state = MLI_MOV_STATE_DMA_CONFIGURED;
+        return retval;
     }
+#endif
+
+    mov_tensor_data(h, src, cfg, dst, src_mem_stride, src_cpy_size, dst_write_size, src_in_vccm, dst_in_vccm);
     return retval;
 }
 
@@ -309,6 +366,13 @@ mli_status mli_mov_start(mli_mov_handle_t* h, const mli_tensor* src, const mli_m
         // TODO
         h->state = MLI_MOV_STATE_DMA_RUNNING;
     } else
+#elif defined(MLI_HOST_DMA_EMU)
+    if (h->state == MLI_MOV_STATE_DMA_CONFIGURED) {
+        // the transfer is executed by the thread of the emulated dma channel
+        h->state = MLI_MOV_STATE_DMA_RUNNING;
+        return mli_mov_emu_start(h->dma_ch, mov_emu_run, jobtable[h->dma_ch].bytes,
+                                 callbacktable[h->dma_ch].cb, callbacktable[h->dma_ch].cookie);
+    } else
 #endif
     {
     // in case DMA is not used, but direct copy was done, set state to DONE, and call callback.
@@ -334,6 +398,12 @@ bool mli_mov_isdone(mli_mov_handle_t* h) {
         done = true;
     } else if (h->state == MLI_MOV_STATE_DMA_RUNNING) {
         // TODO: poll dma status
+#if defined(MLI_HOST_DMA_EMU)
+        if (mli_mov_emu_isdone(h->dma_ch)) {
+            h->state = MLI_MOV_STATE_DONE;
+            done = true;
+        }
+#endif
     } else {
         done = false;
     }
@@ -348,6 +418,12 @@ bool mli_mov_isdone(mli_mov_handle_t* h) {
 mli_status mli_mov_wait(mli_mov_handle_t* h) {
     MLI_ASSERT(h != NULL);
 
+#if defined(MLI_HOST_DMA_EMU)
+    // block on the emulated channel instead of active polling
+    if (h->state == MLI_MOV_STATE_DMA_RUNNING) {
+        mli_mov_emu_wait(h->dma_ch);
+    }
+#endif
     while(!mli_mov_isdone(h)){
         //active wait
     }
@@ -411,6 +487,13 @@ mli_status mli_mov_acquire_handle(int num_ch, mli_mov_handle_t* h) {
 mli_status mli_mov_release_handle(mli_mov_handle_t* h) {
     MLI_ASSERT(h != NULL);
 
+#if defined(MLI_HOST_DMA_EMU)
+    // the emulated channel can't be reused before its transfer is completed
+    if (h->state == MLI_MOV_STATE_DMA_RUNNING) {
+        mli_mov_wait(h);
+    }
+#endif
+
     for (int ch_cnt = 0; ch_cnt < h->num_ch; ch_cnt++) {
         dma_pool.channel_status[h->dma_ch + ch_cnt] = MLI_MOV_DMA_CH_AVAILABLE;
     }
@@ -35,6 +35,19 @@ typedef struct {
     int32_t cookie;
 } mli_mov_cb_t;
 
+// Transfer prepared for the host DMA emulator. The data is copied by the channel thread.
+typedef struct {
+    mli_tensor src;
+    mli_mov_cfg_t cfg;
+    mli_tensor dst;
+    int32_t src_mem_stride[MLI_MAX_RANK];
+    uint32_t src_cpy_size[MLI_MAX_RANK];
+    uint32_t dst_write_size[MLI_MAX_RANK];
+    bool src_in_vccm;
+    bool dst_in_vccm;
+    uint32_t bytes;
+} mli_mov_job_t;
+
 namespace mli {
 namespace mov {
 namespace ref {
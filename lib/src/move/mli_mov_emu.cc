@@ -0,0 +1,210 @@
+/*
+* Copyright 2022, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+
+#include "mli_mov_emu.h"
+
+#if defined(MLI_HOST_DMA_EMU)
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "mli_debug.h"
+#include "mli_mov_api.h"
+#include "mli_mov_decl.h"
+
+namespace mli {
+namespace mov {
+namespace emu {
+
+typedef std::chrono::steady_clock emu_clock;
+
+struct channel_t {
+    std::thread thread;
+    std::mutex lock;
+    std::condition_variable cond;
+    bool stop = false;
+    bool pending = false;
+    bool done = true;
+
+    // transfer
+    void (*run)(int) = nullptr;
+    uint32_t bytes = 0;
+    void (*cb)(int32_t) = nullptr;
+    int32_t cookie = 0;
+
+    // statistics
+    uint32_t transfers = 0;
+    uint64_t total_bytes = 0;
+    emu_clock::duration busy = emu_clock::duration::zero();
+};
+
+static channel_t channels[MAX_DMA_CHAN];
+static int num_channels = 0;
+static uint32_t latency_us = 0;
+static uint32_t bytes_per_us = 0;
+static emu_clock::time_point stats_start;
+
+static void channel_thread(int ch) {
+    channel_t& chan = channels[ch];
+    std::unique_lock<std::mutex> guard(chan.lock);
+    while (true) {
+        chan.cond.wait(guard, [&chan] { return chan.pending || chan.stop; });
+        if (!chan.pending) break;
+
+        void (*run)(int) = chan.run;
+        void (*cb)(int32_t) = chan.cb;
+        const int32_t cookie = chan.cookie;
+        const uint32_t bytes = chan.bytes;
+        guard.unlock();
+
+        const emu_clock::time_point start = emu_clock::now();
+        run(ch);
+        emu_clock::time_point end = start + std::chrono::microseconds(latency_us);
+        if (bytes_per_us > 0) {
+            end += std::chrono::nanoseconds(((uint64_t)bytes * 1000) / bytes_per_us);
+        }
+        std::this_thread::sleep_until(end);
+        end = emu_clock::now();
+
+        // Callback is called as from the DMA interrupt handler, before the transfer is reported as done
+        if (cb != nullptr) {
+            cb(cookie);
+        }
+
+        guard.lock();
+        chan.transfers++;
+        chan.total_bytes += bytes;
+        chan.busy += end - start;
+        chan.pending = false;
+        chan.done = true;
+        chan.cond.notify_all();
+    }
+}
+
+static void stop_channels() {
+    for (int ch = 0; ch < num_channels; ch++) {
+        {
+            std::lock_guard<std::mutex> guard(channels[ch].lock);
+            channels[ch].stop = true;
+        }
+        channels[ch].cond.notify_all();
+        channels[ch].thread.join();
+    }
+    num_channels = 0;
+}
+
+// Channel threads are stopped at program exit if the emulator wasn't disabled by the user:
+// destruction of a joinable std::thread terminates the program. The guard is defined after
+// the channels, so it's destroyed before them.
+struct channels_guard_t {
+    ~channels_guard_t() { stop_channels(); }
+};
+static channels_guard_t channels_guard;
+
+static void reset_stats() {
+    for (int ch = 0; ch < MAX_DMA_CHAN; ch++) {
+        std::lock_guard<std::mutex> guard(channels[ch].lock);
+        channels[ch].transfers = 0;
+        channels[ch].total_bytes = 0;
+        channels[ch].busy = emu_clock::duration::zero();
+    }
+    stats_start = emu_clock::now();
+}
+
+} // namespace emu
+} // namespace mov
+} // namespace mli
+
+using namespace mli::mov::emu;
+
+bool mli_mov_emu_has_channel(int ch) {
+    return ch >= 0 && ch < num_channels;
+}
+
+mli_status mli_mov_emu_start(int ch, void (*run)(int), uint32_t bytes, void (*cb)(int32_t), int32_t cookie) {
+    MLI_ASSERT(mli_mov_emu_has_channel(ch));
+    MLI_ASSERT(run != nullptr);
+    channel_t& chan = channels[ch];
+    std::unique_lock<std::mutex> guard(chan.lock);
+    // transfers of a channel are executed in order
+    chan.cond.wait(guard, [&chan] { return !chan.pending; });
+    chan.run = run;
+    chan.bytes = bytes;
+    chan.cb = cb;
+    chan.cookie = cookie;
+    chan.pending = true;
+    chan.done = false;
+    chan.cond.notify_all();
+    return MLI_STATUS_OK;
+}
+
+bool mli_mov_emu_isdone(int ch) {
+    MLI_ASSERT(mli_mov_emu_has_channel(ch));
+    std::lock_guard<std::mutex> guard(channels[ch].lock);
+    return channels[ch].done;
+}
+
+void mli_mov_emu_wait(int ch) {
+    MLI_ASSERT(mli_mov_emu_has_channel(ch));
+    channel_t& chan = channels[ch];
+    std::unique_lock<std::mutex> guard(chan.lock);
+    chan.cond.wait(guard, [&chan] { return chan.done; });
+}
+
+//=====================================================================
+// Public functions
+//=====================================================================
+
+mli_status mli_mov_emu_enable(const mli_mov_emu_cfg_t* cfg) {
+    MLI_ASSERT(cfg != nullptr);
+    if (cfg->num_ch <= 0 || cfg->num_ch > MAX_DMA_CHAN) {
+        return MLI_STATUS_BAD_FUNC_CFG;
+    }
+    stop_channels();
+
+    latency_us = cfg->latency_us;
+    bytes_per_us = cfg->bytes_per_us;
+    reset_stats();
+    for (int ch = 0; ch < cfg->num_ch; ch++) {
+        channels[ch].stop = false;
+        channels[ch].pending = false;
+        channels[ch].done = true;
+        channels[ch].thread = std::thread(channel_thread, ch);
+    }
+    num_channels = cfg->num_ch;
+    return MLI_STATUS_OK;
+}
+
+mli_status mli_mov_emu_disable(void) {
+    stop_channels();
+    return MLI_STATUS_OK;
+}
+
+mli_status mli_mov_emu_get_stats(int ch, mli_mov_emu_stats_t* stats) {
+    MLI_ASSERT(stats != nullptr);
+    if (ch < 0 || ch >= MAX_DMA_CHAN) {
+        return MLI_STATUS_BAD_FUNC_CFG;
+    }
+    std::lock_guard<std::mutex> guard(channels[ch].lock);
+    stats->transfers = channels[ch].transfers;
+    stats->bytes = channels[ch].total_bytes;
+    stats->busy_us = (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(channels[ch].busy).count();
+    stats->elapsed_us = (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(
+            emu_clock::now() - stats_start).count();
+    return MLI_STATUS_OK;
+}
+
+mli_status mli_mov_emu_reset_stats(void) {
+    reset_stats();
+    return MLI_STATUS_OK;
+}
+
+#endif // MLI_HOST_DMA_EMU
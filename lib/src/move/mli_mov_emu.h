@@ -0,0 +1,34 @@
+/*
+* Copyright 2022, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+
+#ifndef _MLI_MOV_EMU_H_
+#define _MLI_MOV_EMU_H_
+
+#include <stdint.h>
+
+#include "mli_types.h"
+
+#if defined(MLI_HOST_DMA_EMU)
+
+// Interface between asynchronous data movement functions and the host DMA emulator.
+// A channel executes one transfer at a time: run(ch) is called on the channel thread,
+// then the thread sleeps until the modeled end of the transfer, calls cb(cookie)
+// and marks the transfer as done.
+
+bool mli_mov_emu_has_channel(int ch);
+
+mli_status mli_mov_emu_start(int ch, void (*run)(int), uint32_t bytes, void (*cb)(int32_t), int32_t cookie);
+
+bool mli_mov_emu_isdone(int ch);
+
+void mli_mov_emu_wait(int ch);
+
+#endif // MLI_HOST_DMA_EMU
+
+#endif // _MLI_MOV_EMU_H_
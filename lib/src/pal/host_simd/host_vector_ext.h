@@ -0,0 +1,87 @@
+/*
+* Copyright 2022, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+
+#ifndef HOST_VECTOR_EXT_H_
+#define HOST_VECTOR_EXT_H_
+
+// Host SIMD instruction set selection. The widest extension enabled on the
+// compiler command line is used (-mavx512bw, -mavx2, NEON on AArch64).
+// If none is available, MLI_HOST_VEC_NONE is defined and host_simd helpers
+// fall back to the scalar reference loops.
+
+#if defined(__AVX512BW__)
+#include <immintrin.h>
+#define MLI_HOST_VEC_AVX512 (1)
+#define MLI_HOST_VEC_AVX2 (1)
+#elif defined(__AVX2__)
+#include <immintrin.h>
+#define MLI_HOST_VEC_AVX2 (1)
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define MLI_HOST_VEC_NEON (1)
+#else
+#define MLI_HOST_VEC_NONE (1)
+#endif
+
+//////////////////////////////////////////////////
+// Types
+//////////////////////////////////////////////////
+// vec16_t holds MLI_HOST_VEC16_LANES signed 16-bit lanes. Both int8 and int16
+// operands are widened into it, which keeps every product exact in 32 bits.
+#if defined(MLI_HOST_VEC_AVX512)
+typedef __m512i vec16_t;
+typedef __m512i vec32_t;
+#define MLI_HOST_VEC16_LANES (32)
+#elif defined(MLI_HOST_VEC_AVX2)
+typedef __m256i vec16_t;
+typedef __m256i vec32_t;
+#define MLI_HOST_VEC16_LANES (16)
+#elif defined(MLI_HOST_VEC_NEON)
+typedef int16x8_t vec16_t;
+typedef int32x4_t vec32_t;
+#define MLI_HOST_VEC16_LANES (8)
+#else
+#define MLI_HOST_VEC16_LANES (1)
+#endif
+
+//////////////////////////////////////////////////
+// Horizontal reductions
+//////////////////////////////////////////////////
+#if defined(MLI_HOST_VEC_AVX2)
+static inline int32_t host_vec_reduce_add_i32(__m256i v) {
+    __m128i r = _mm_add_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+    r = _mm_add_epi32(r, _mm_shuffle_epi32(r, _MM_SHUFFLE(1, 0, 3, 2)));
+    r = _mm_add_epi32(r, _mm_shuffle_epi32(r, _MM_SHUFFLE(2, 3, 0, 1)));
+    return _mm_cvtsi128_si32(r);
+}
+
+static inline int64_t host_vec_reduce_add_i64(__m256i v) {
+    __m128i r = _mm_add_epi64(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+    r = _mm_add_epi64(r, _mm_unpackhi_epi64(r, r));
+    return _mm_cvtsi128_si64(r);
+}
+#endif
+
+#if defined(MLI_HOST_VEC_AVX512)
+static inline int32_t host_vec_reduce_add_i32(__m512i v) {
+    return _mm512_reduce_add_epi32(v);
+}
+#endif
+
+#if defined(MLI_HOST_VEC_NEON)
+static inline int32_t host_vec_reduce_add_i32(int32x4_t v) {
+    return vaddvq_s32(v);
+}
+
+static inline int64_t host_vec_reduce_add_i64(int64x2_t v) {
+    return vaddvq_s64(v);
+}
+#endif
+
+#endif // HOST_VECTOR_EXT_H_
@@ -0,0 +1,125 @@
+/*
+* Copyright 2022, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+
+#ifndef _HOST_SIMD_MLI_MATH_H_
+#define _HOST_SIMD_MLI_MATH_H_
+
+// Scalar math is taken from the reference PAL, which must be included before
+// this file. The vector helpers below compute the same integer results as
+// the reference mli_math_mac_fx loops: products of 8/16-bit operands are exact
+// in 32 bits, and integer accumulation doesn't depend on the summation order.
+
+#include <stdint.h>
+
+#include "mli_mem_info.h"
+#include "host_simd/host_vector_ext.h"
+#include "mli_prv_load_store.h"
+
+// Dot product of two contiguous vectors with 32-bit wrap-around accumulation.
+// The result equals a chain of mli_math_mac_fx on mli_acc32_t starting from 0.
+template <typename l_T, typename r_T>
+MLI_FORCE_INLINE int32_t mli_math_dotprod_acc32_v(const MLI_PTR(l_T) __restrict l,
+                                                  const MLI_PTR(r_T) __restrict r, const int vals) {
+    uint32_t acc = 0;
+    int idx = 0;
+#if defined(MLI_HOST_VEC_AVX512)
+    __m512i vacc = _mm512_setzero_si512();
+    for (; idx + MLI_HOST_VEC16_LANES <= vals; idx += MLI_HOST_VEC16_LANES) {
+        vacc = _mm512_add_epi32(vacc, _mm512_madd_epi16(mli_prv_load_nx16_samples(l + idx),
+                                                        mli_prv_load_nx16_samples(r + idx)));
+    }
+    acc = (uint32_t)host_vec_reduce_add_i32(vacc);
+#elif defined(MLI_HOST_VEC_AVX2)
+    __m256i vacc = _mm256_setzero_si256();
+    for (; idx + MLI_HOST_VEC16_LANES <= vals; idx += MLI_HOST_VEC16_LANES) {
+        vacc = _mm256_add_epi32(vacc, _mm256_madd_epi16(mli_prv_load_nx16_samples(l + idx),
+                                                        mli_prv_load_nx16_samples(r + idx)));
+    }
+    acc = (uint32_t)host_vec_reduce_add_i32(vacc);
+#elif defined(MLI_HOST_VEC_NEON)
+    int32x4_t vacc = vdupq_n_s32(0);
+    for (; idx + MLI_HOST_VEC16_LANES <= vals; idx += MLI_HOST_VEC16_LANES) {
+        const int16x8_t vl = mli_prv_load_nx16_samples(l + idx);
+        const int16x8_t vr = mli_prv_load_nx16_samples(r + idx);
+        vacc = vmlal_s16(vacc, vget_low_s16(vl), vget_low_s16(vr));
+        vacc = vmlal_high_s16(vacc, vl, vr);
+    }
+    acc = (uint32_t)host_vec_reduce_add_i32(vacc);
+#endif
+    for (; idx < vals; idx++) {
+        acc += (uint32_t)((int32_t)l[idx] * (int32_t)r[idx]);
+    }
+    return (int32_t)acc;
+}
+
+// Dot product of two contiguous int16 vectors with exact 64-bit accumulation.
+// The result equals a chain of mli_math_mac_fx on mli_acc40_t starting from 0.
+MLI_FORCE_INLINE int64_t mli_math_dotprod_acc64_v(const MLI_PTR(int16_t) __restrict l,
+                                                  const MLI_PTR(int16_t) __restrict r, const int vals) {
+    int64_t acc = 0;
+    int idx = 0;
+#if defined(MLI_HOST_VEC_AVX2)
+    // madd_epi16 may wrap on (-32768 * -32768) * 2, so products are summed
+    // into 64-bit lanes one by one.
+    __m256i vacc = _mm256_setzero_si256();
+    for (; idx + 8 <= vals; idx += 8) {
+        const __m256i prod = _mm256_mullo_epi32(mli_prv_load_8x32_samples(l + idx),
+                                                mli_prv_load_8x32_samples(r + idx));
+        vacc = _mm256_add_epi64(vacc, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(prod)));
+        vacc = _mm256_add_epi64(vacc, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(prod, 1)));
+    }
+    acc = host_vec_reduce_add_i64(vacc);
+#elif defined(MLI_HOST_VEC_NEON)
+    int64x2_t vacc = vdupq_n_s64(0);
+    for (; idx + 8 <= vals; idx += 8) {
+        const int16x8_t vl = vld1q_s16(l + idx);
+        const int16x8_t vr = vld1q_s16(r + idx);
+        vacc = vpadalq_s32(vacc, vmull_s16(vget_low_s16(vl), vget_low_s16(vr)));
+        vacc = vpadalq_s32(vacc, vmull_high_s16(vl, vr));
+    }
+    acc = host_vec_reduce_add_i64(vacc);
+#endif
+    for (; idx < vals; idx++) {
+        acc += (int32_t)l[idx] * (int32_t)r[idx];
+    }
+    return acc;
+}
+
+// Sum of a contiguous int8 vector. Exact for any vals below 2^24.
+MLI_FORCE_INLINE int32_t mli_math_reduce_sum_v(const MLI_PTR(int8_t) __restrict in, const int vals) {
+    int32_t acc = 0;
+    int idx = 0;
+#if defined(MLI_HOST_VEC_AVX512)
+    const __m512i ones = _mm512_set1_epi16(1);
+    __m512i vacc = _mm512_setzero_si512();
+    for (; idx + MLI_HOST_VEC16_LANES <= vals; idx += MLI_HOST_VEC16_LANES) {
+        vacc = _mm512_add_epi32(vacc, _mm512_madd_epi16(mli_prv_load_nx16_samples(in + idx), ones));
+    }
+    acc = host_vec_reduce_add_i32(vacc);
+#elif defined(MLI_HOST_VEC_AVX2)
+    const __m256i ones = _mm256_set1_epi16(1);
+    __m256i vacc = _mm256_setzero_si256();
+    for (; idx + MLI_HOST_VEC16_LANES <= vals; idx += MLI_HOST_VEC16_LANES) {
+        vacc = _mm256_add_epi32(vacc, _mm256_madd_epi16(mli_prv_load_nx16_samples(in + idx), ones));
+    }
+    acc = host_vec_reduce_add_i32(vacc);
+#elif defined(MLI_HOST_VEC_NEON)
+    int32x4_t vacc = vdupq_n_s32(0);
+    for (; idx + 16 <= vals; idx += 16) {
+        vacc = vpadalq_s16(vacc, vpaddlq_s8(vld1q_s8(in + idx)));
+    }
+    acc = host_vec_reduce_add_i32(vacc);
+#endif
+    for (; idx < vals; idx++) {
+        acc += in[idx];
+    }
+    return acc;
+}
+
+#endif // _HOST_SIMD_MLI_MATH_H_
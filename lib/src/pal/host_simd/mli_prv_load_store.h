@@ -0,0 +1,62 @@
+/*
+* Copyright 2022, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+
+#ifndef _HOST_SIMD_MLI_PRV_LOAD_STORE_H_
+#define _HOST_SIMD_MLI_PRV_LOAD_STORE_H_
+
+// Scalar loads and stores are taken from the reference PAL, which must be
+// included before this file. Only the widening vector loads are added here.
+
+#include "mli_mem_info.h"
+#include "host_simd/host_vector_ext.h"
+
+#if !defined(MLI_HOST_VEC_NONE)
+
+// Load MLI_HOST_VEC16_LANES samples and sign extend them to 16-bit lanes.
+static MLI_FORCE_INLINE vec16_t mli_prv_load_nx16_samples(const MLI_PTR (int8_t) __restrict in) {
+#if defined(MLI_HOST_VEC_AVX512)
+    return _mm512_cvtepi8_epi16(_mm256_loadu_si256((const __m256i *)in));
+#elif defined(MLI_HOST_VEC_AVX2)
+    return _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)in));
+#else
+    return vmovl_s8(vld1_s8(in));
+#endif
+}
+
+static MLI_FORCE_INLINE vec16_t mli_prv_load_nx16_samples(const MLI_PTR (int16_t) __restrict in) {
+#if defined(MLI_HOST_VEC_AVX512)
+    return _mm512_loadu_si512((const void *)in);
+#elif defined(MLI_HOST_VEC_AVX2)
+    return _mm256_loadu_si256((const __m256i *)in);
+#else
+    return vld1q_s16(in);
+#endif
+}
+
+#endif // !MLI_HOST_VEC_NONE
+
+#if defined(MLI_HOST_VEC_AVX2)
+// Load 8 samples and sign extend them to 32-bit lanes.
+static MLI_FORCE_INLINE __m256i mli_prv_load_8x32_samples(const MLI_PTR (int16_t) __restrict in) {
+    return _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *)in));
+}
+
+static MLI_FORCE_INLINE __m256i mli_prv_load_8x32_samples(const MLI_PTR (int8_t) __restrict in) {
+    return _mm256_cvtepi8_epi32(_mm_loadl_epi64((const __m128i *)in));
+}
+
+// Store the low 16 bits of 8 x 32-bit lanes (wrap-around, no saturation).
+static MLI_FORCE_INLINE void mli_prv_store_8x32_samples(MLI_OUT_PTR (int16_t) __restrict out, __m256i data) {
+    const __m256i low_half = _mm256_and_si256(data, _mm256_set1_epi32(0xFFFF));
+    const __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi32(low_half, low_half), _MM_SHUFFLE(3, 1, 2, 0));
+    _mm_storeu_si128((__m128i *)out, _mm256_castsi256_si128(packed));
+}
+#endif
+
+#endif // _HOST_SIMD_MLI_PRV_LOAD_STORE_H_
@@ -41,6 +41,10 @@ template <typename in_T, typename out_T> MLI_FORCE_INLINE out_T mli_math_cast_fx
 #elif defined(__FXAPI__) //&& !defined(MLI_BUILD_REFERENCE)
 // not ported kernels running EM/HS; always require dsp/* version of PAL.
 #include "dsp/mli_math.h"
+#elif defined(MLI_BUILD_HOST_SIMD) && !defined(MLI_BUILD_REFERENCE)
+// host build with SIMD helpers on top of the reference scalar math.
+#include "ref/mli_math.h"
+#include "host_simd/mli_math.h"
 #else
 #include "ref/mli_math.h"
 #endif
@@ -14,6 +14,9 @@
 #include "vdsp/mli_prv_load_store.h"
 #elif defined(__FXAPI__) && !defined(MLI_BUILD_REFERENCE)
 #include "dsp/mli_prv_load_store.h"
+#elif defined(MLI_BUILD_HOST_SIMD) && !defined(MLI_BUILD_REFERENCE)
+#include "ref/mli_prv_load_store.h"
+#include "host_simd/mli_prv_load_store.h"
 #else
 #include "ref/mli_prv_load_store.h"
 #endif
@@ -93,6 +93,8 @@ mli_status mli_chk_depthwise_conv2d_hwcn_sa8_sa8_sa32(
         const mli_tensor * out,
         const uint32_t kernel_size = 0);
 
+mli_status mli_chk_conv2d_prepared(const mli_conv2d_prepared * prepared);
+
 mli_status mli_chk_group_conv2d_hwcn_fx16(
         const mli_tensor * in,
         const mli_tensor * weights,
@@ -155,6 +157,18 @@ mli_status mli_chk_transpose_conv2d_hwcn_k4x4_str2(
         const mli_conv2d_cfg * cfg,
         const mli_tensor * out);
 
+mli_status mli_chk_conv2d_hwcn_winograd(
+        const mli_tensor * in,
+        const mli_tensor * weights,
+        const mli_tensor * wino_weights,
+        const mli_conv2d_cfg * cfg,
+        const mli_tensor * out);
+
+mli_status mli_chk_conv2d_winograd_weights(
+        const mli_tensor * weights,
+        mli_winograd_type type,
+        const mli_tensor * wino_weights);
+
 mli_status mli_chk_maxpool_hwc_fx8(
         const mli_tensor *in,
         const mli_pool_cfg *cfg,
@@ -215,6 +229,15 @@ mli_status mli_chk_fully_connected_sa8_sa8_sa32(
         const mli_fully_connected_cfg * cfg,
         mli_tensor * out);
 
+mli_status mli_chk_sa8_quant_cache(const mli_sa8_quant_cache * cache);
+
+mli_status mli_chk_fully_connected_sa8_sa8_sa32_cached(
+        const mli_tensor * in,
+        const mli_tensor * weights,
+        const mli_sa8_quant_cache * cache,
+        const mli_fully_connected_cfg * cfg,
+        mli_tensor * out);
+
 mli_status mli_chk_relu_fx8(const mli_tensor * in, const mli_relu_cfg * cfg, mli_tensor * out);
 mli_status mli_chk_relu_fx16(const mli_tensor * in, const mli_relu_cfg * cfg, mli_tensor * out);
 mli_status mli_chk_relu_sa8(const mli_tensor * in, const mli_relu_cfg * cfg, mli_tensor * out);
@@ -225,6 +248,12 @@ mli_status mli_chk_basic_activation_sa8(const mli_tensor * in, mli_tensor * out)
 mli_status mli_chk_softmax_fx8(const mli_tensor * in, const mli_softmax_cfg* cfg, mli_tensor * out);
 mli_status mli_chk_softmax_fx16(const mli_tensor * in, const mli_softmax_cfg* cfg, mli_tensor * out);
 mli_status mli_chk_softmax_sa8(const mli_tensor * in, const mli_softmax_cfg* cfg, mli_tensor * out);
+mli_status mli_chk_softmax_stream_init(int32_t topk, const mli_softmax_stream_state *state);
+mli_status mli_chk_softmax_stream_update_sa8(const mli_tensor * in, const mli_softmax_stream_state *state);
+mli_status mli_chk_softmax_stream_normalize_sa8(const mli_tensor * in, const mli_softmax_stream_state *state,
+                                                const mli_tensor * out);
+mli_status mli_chk_softmax_stream_topk_sa8(const mli_softmax_stream_state *state, const mli_tensor * out,
+                                           const mli_tensor * out_idx);
 mli_status mli_chk_l2_normalize_fx16(const mli_tensor * in, const mli_l2_normalize_cfg* cfg, mli_tensor * out);
 mli_status mli_chk_l2_normalize_sa8(const mli_tensor * in, const mli_l2_normalize_cfg* cfg, mli_tensor * out);
 mli_status mli_chk_leaky_relu(const mli_tensor * in, const mli_tensor * slope_coeff, mli_tensor * out);
@@ -355,6 +384,7 @@ mli_status mli_chk_count_elem_num(const mli_tensor *in, uint32_t start_dim);
 mli_status mli_chk_convert_tensor(const mli_tensor *in, mli_tensor *out);
 mli_status mli_chk_point_to_subtensor(const mli_tensor *in, const mli_point_to_subtsr_cfg *cfg, mli_tensor *out);
 mli_status mli_chk_create_subtensor(const mli_tensor *in, const mli_sub_tensor_cfg *cfg, mli_tensor *out);
+mli_status mli_chk_permute_view(const mli_tensor *in, const mli_permute_cfg *cfg, mli_tensor *out);
 mli_status mli_chk_data_movement(const mli_tensor *in, const mli_mov_cfg_t *cfg, mli_tensor *out);
 mli_status mli_chk_data_movement_dst_tensor(const mli_tensor *t);
 
@@ -1045,6 +1045,39 @@ static MLI_FORCE_INLINE tensor_private_t<T> mli_prv_get_tensor_hwc(
             width, height, ch, col_mem_stride, row_mem_stride, ch_mem_stride };
 }
 
+template <typename T, unsigned rank>
+static MLI_FORCE_INLINE tensor_private_t<T> mli_prv_get_tensor_chw(
+    const Tensor<InternalBuffer, rank> &in) {
+    // Dimensions are named as for HWC, but the width is expected to be the inner-most one
+    // in memory. Strides are kept as is, as CHW kernels don't rely on it.
+    // The batch is ingored when running convolution
+    int height = 0, width = 0, ch = 0;
+    int row_mem_stride = 0, col_mem_stride = 0, ch_mem_stride = 0;
+    if (rank == 5) {
+      height = (int)in.get_dim(kGroupTensorHeightDim);
+      width = (int)in.get_dim(kGroupTensorWidthDim);
+      ch = (int)in.get_dim(kGroupTensorChannelDim);
+      row_mem_stride = in.get_mem_stride(kGroupTensorHeightDim);
+      col_mem_stride = in.get_mem_stride(kGroupTensorWidthDim);
+      ch_mem_stride = in.get_mem_stride(kGroupTensorChannelDim);
+    }
+    else if (rank == 4) {
+      height = (int)in.get_dim(kTensorHeightDim);
+      width = (int)in.get_dim(kTensorWidthDim);
+      ch = (int)in.get_dim(kTensorChannelDim);
+      row_mem_stride = in.get_mem_stride(kTensorHeightDim);
+      col_mem_stride = in.get_mem_stride(kTensorWidthDim);
+      ch_mem_stride = in.get_mem_stride(kTensorChannelDim);
+    }
+    else {
+      MLI_ASSERT(0);
+    }
+
+    return tensor_private_t<T> {
+            in.get_buf().template get_ptr<std::remove_pointer_t<T>>(),
+            width, height, ch, col_mem_stride, row_mem_stride, ch_mem_stride };
+}
+
 template <typename T>
 static MLI_FORCE_INLINE conv2d_weights_tensor_private_t<T>
 mli_prv_get_conv2d_weights_tensor_hwcn(
@@ -384,6 +384,25 @@ static MLI_FORCE_INLINE bool check_same_shape(const mli_tensor* t1, const mli_te
     return !fail;
 }
 
+// Shapes are aligned starting from the inner-most dimension (missing outer dimensions are 1).
+// Each dimension of the inputs must be equal to the output one or 1, and at least one of them
+// must be equal to the output dimension.
+static MLI_FORCE_INLINE bool check_broadcast_shape(const mli_tensor* in1, const mli_tensor* in2,
+                                                   const mli_tensor* out) {
+    if (in1->rank > out->rank || in2->rank > out->rank) return false /* failed */;
+    bool fail = false;
+    for (int i = 0; i < (int)out->rank; i++) {
+        const int in1_dim = i - (int)(out->rank - in1->rank);
+        const int in2_dim = i - (int)(out->rank - in2->rank);
+        const uint32_t shape1 = (in1_dim >= 0) ? in1->shape[in1_dim] : 1;
+        const uint32_t shape2 = (in2_dim >= 0) ? in2->shape[in2_dim] : 1;
+        fail |= (shape1 != out->shape[i] && shape1 != 1);
+        fail |= (shape2 != out->shape[i] && shape2 != 1);
+        fail |= (shape1 != out->shape[i] && shape2 != out->shape[i]);
+    }
+    return !fail;
+}
+
 
 /******************************************************
  *  mli_krn_conv2d_hwc parameters checking function
@@ -510,6 +529,11 @@ mli_status mli_chk_conv2d_hwcn_sa8_sa8_sa32(
     return MLI_STATUS_OK;
 }
 
+mli_status mli_chk_conv2d_prepared(const mli_conv2d_prepared * prepared) {
+    if (MLI_CHECK(prepared != NULL, "Bad prepared descriptor pointer")) return MLI_STATUS_BAD_FUNC_CFG;
+    return MLI_STATUS_OK;
+}
+
 mli_status mli_chk_conv2d_hwcn_fx16(
         const mli_tensor * in,
         const mli_tensor * weights,
@@ -1111,6 +1135,89 @@ mli_status mli_chk_transpose_conv2d_hwcn_k4x4_str2(
     return MLI_STATUS_OK;
 }
 
+static uint32_t mli_chk_winograd_tile_size(mli_winograd_type type) {
+    switch (type) {
+    case MLI_WINOGRAD_F2X2_3X3: return 4;
+    case MLI_WINOGRAD_F4X4_3X3: return 6;
+    default: return 0;
+    }
+}
+
+static mli_status mli_chk_winograd_weights_shape(
+        const mli_tensor * weights,
+        const mli_tensor * wino_weights) {
+    bool fail = false;
+
+    fail |= MLI_CHECK(wino_weights->el_type == MLI_EL_SA_32, "Wrong winograd weights tensor type");
+    if (fail) return MLI_STATUS_TYPE_MISMATCH;
+
+    fail |= MLI_CHECK(wino_weights->rank == 4, "Wrong winograd weights tensor rank");
+    if (fail) return MLI_STATUS_RANK_MISMATCH;
+
+    const uint32_t tile = wino_weights->shape[KRNL_H_DIM_HWCN];
+    fail |= MLI_CHECK(tile == 4 || tile == 6, "Winograd weights: only 4x4 and 6x6 tiles are supported");
+    fail |= MLI_CHECK(wino_weights->shape[KRNL_W_DIM_HWCN] == tile, "Winograd weights: tile must be square");
+    fail |= MLI_CHECK(wino_weights->shape[KRNL_D_DIM_HWCN] == weights->shape[KRNL_D_DIM_HWCN],
+                      "Winograd weights: input channels mismatch with weights");
+    fail |= MLI_CHECK(wino_weights->shape[KRNL_C_DIM_HWCN] == weights->shape[KRNL_C_DIM_HWCN],
+                      "Winograd weights: output channels mismatch with weights");
+    if (fail) return MLI_STATUS_SHAPE_MISMATCH;
+
+    return MLI_STATUS_OK;
+}
+
+mli_status mli_chk_conv2d_hwcn_winograd(
+        const mli_tensor * /*in*/,
+        const mli_tensor * weights,
+        const mli_tensor * wino_weights,
+        const mli_conv2d_cfg * cfg,
+        const mli_tensor * /*out*/) {
+    bool fail = false;
+
+    fail |= MLI_CHECK(cfg->stride_width == 1, "Stride width should be 1 for winograd specialization");
+    fail |= MLI_CHECK(cfg->stride_height == 1, "Stride height should be 1 for winograd specialization");
+    fail |= MLI_CHECK(cfg->dilation_width <= 1, "Dilation is not supported by winograd specialization");
+    fail |= MLI_CHECK(cfg->dilation_height <= 1, "Dilation is not supported by winograd specialization");
+    if (fail) return MLI_STATUS_BAD_FUNC_CFG;
+
+    mli_status ret = MLI_CHECK_STATUS(mli_chk_tensor(wino_weights, false), "Bad winograd weights tensor");
+    if (ret != MLI_STATUS_OK) return ret;
+    if (MLI_CHECK(wino_weights->mem_stride[KRNL_C_DIM_HWCN] == 1, "Winograd weights: memory stride of output channels should be 1"))
+        return MLI_STATUS_INCOMPATEBLE_TENSORS;
+
+    return MLI_CHECK_STATUS(mli_chk_winograd_weights_shape(weights, wino_weights), __func__);
+}
+
+mli_status mli_chk_conv2d_winograd_weights(
+        const mli_tensor * weights,
+        mli_winograd_type type,
+        const mli_tensor * wino_weights) {
+    mli_status ret = MLI_CHECK_STATUS(mli_chk_tensor(weights, false), "Bad weights tensor");
+    if (ret != MLI_STATUS_OK) return ret;
+    if (MLI_CHECK(wino_weights != NULL, "Bad tensor null pointer") ||
+        MLI_CHECK(check_ptr_not_null(wino_weights->data, MLI_EL_SA_32), "Bad data pointer of tensor"))
+        return MLI_STATUS_BAD_TENSOR;
+
+    if (MLI_CHECK(weights->el_type == MLI_EL_SA_8 || weights->el_type == MLI_EL_FX_8 ||
+                  weights->el_type == MLI_EL_FX_16, "Wrong weights tensor type"))
+        return MLI_STATUS_TYPE_MISMATCH;
+    if (MLI_CHECK(weights->rank == 4, "Wrong weights tensor rank"))
+        return MLI_STATUS_RANK_MISMATCH;
+    if (MLI_CHECK(weights->shape[KRNL_H_DIM_HWCN] == 3 && weights->shape[KRNL_W_DIM_HWCN] == 3,
+                  "Winograd transform is defined for 3x3 kernels only"))
+        return MLI_STATUS_SHAPE_MISMATCH;
+
+    const uint32_t tile = mli_chk_winograd_tile_size(type);
+    if (MLI_CHECK(tile != 0, "Unknown winograd transform type"))
+        return MLI_STATUS_BAD_FUNC_CFG;
+
+    const uint32_t size = tile * tile * weights->shape[KRNL_D_DIM_HWCN] * weights->shape[KRNL_C_DIM_HWCN] * sizeof(int32_t);
+    if (MLI_CHECK(wino_weights->data.capacity >= size, "Insufficient capacity of winograd weights tensor"))
+        return MLI_STATUS_NOT_ENGH_MEM;
+
+    return MLI_STATUS_OK;
+}
+
 mli_status mli_chk_maxpool_hwc (
         const mli_tensor * in,
         const mli_pool_cfg * cfg,
@@ -1338,18 +1445,31 @@ mli_status mli_chk_fully_connected (
 
     if (MLI_CHECK(cfg != NULL , "Bad cfg pointer")) return MLI_STATUS_BAD_FUNC_CFG;
 
+    // Output of rank 2 means batched mode: [batch, in] input and [batch, out] output
+    const bool is_batched = out->rank == 2;
     fail |= MLI_CHECK(weights->rank == 2, "Wrong weights rank");
     fail |= MLI_CHECK(bias->rank == 1, "Wrong bias rank");
-    fail |= MLI_CHECK(out->rank == 1, "Wrong out rank");
-    fail |= MLI_CHECK(mli_prv_count_elem_num (in) == weights->shape[0], "weights shape doesn't match number of input elements");
+    fail |= MLI_CHECK(out->rank == 1 || is_batched, "Wrong out rank");
+    if (is_batched) {
+        fail |= MLI_CHECK(in->rank == 2, "Wrong input rank for batched mode");
+        fail |= MLI_CHECK(in->shape[0] == out->shape[0], "Shape mismatch in and out batch size");
+        fail |= MLI_CHECK(in->shape[1] == weights->shape[0], "weights shape doesn't match number of input elements");
+    } else {
+        fail |= MLI_CHECK(mli_prv_count_elem_num (in) == weights->shape[0], "weights shape doesn't match number of input elements");
+    }
     fail |= MLI_CHECK(bias->shape[0] == weights->shape[1], "Shape mismatch bias and weights");
-    fail |= MLI_CHECK(out->shape[0] == weights->shape[1], "Shape mismatch out and weights");
+    fail |= MLI_CHECK(out->shape[out->rank - 1] == weights->shape[1], "Shape mismatch out and weights");
     if (fail) return MLI_STATUS_SHAPE_MISMATCH;
 
-    fail |= MLI_CHECK(check_layout_is_contiguous(in), "Memory Layout of input tensor must be contiguous");
+    if (is_batched) {
+        fail |= MLI_CHECK(check_inner_most_dimension_is_one(in), "Memory stride for inner most dimension of input must be 1");
+        fail |= MLI_CHECK(check_inner_most_dimension_is_one(out), "Memory stride for inner most dimension of output must be 1");
+    } else {
+        fail |= MLI_CHECK(check_layout_is_contiguous(in), "Memory Layout of input tensor must be contiguous");
+        fail |= MLI_CHECK(check_layout_is_contiguous(out->mem_stride, 1), "Memory Layout of output tensor must be contiguous");
+    }
     fail |= MLI_CHECK(check_inner_most_dimension_is_one(weights), "Memory stride for inner most dimension of weights must be 1");
     fail |= MLI_CHECK(check_layout_is_contiguous(bias), "Memory Layout of bias tensor must be contiguous");
-    fail |= MLI_CHECK(check_layout_is_contiguous(out->mem_stride, 1), "Memory Layout of output tensor must be contiguous");
     if (fail) return MLI_STATUS_INCOMPATEBLE_TENSORS;
 
     //check that input and output are not overlapped
@@ -1469,6 +1589,67 @@ mli_status mli_chk_fully_connected_sa8_sa8_sa32(
     return MLI_STATUS_OK;
 }
 
+mli_status mli_chk_sa8_quant_cache(const mli_sa8_quant_cache * cache) {
+    if (MLI_CHECK(cache != NULL, "Bad cache pointer")) return MLI_STATUS_BAD_FUNC_CFG;
+    if (MLI_CHECK(cache->bias != NULL, "Bad cache bias pointer") ||
+            MLI_CHECK(cache->out_mul != NULL, "Bad cache out_mul pointer") ||
+            MLI_CHECK(cache->out_shift != NULL, "Bad cache out_shift pointer"))
+        return MLI_STATUS_BAD_FUNC_CFG;
+    return MLI_STATUS_OK;
+}
+
+mli_status mli_chk_fully_connected_sa8_sa8_sa32_cached(
+        const mli_tensor * in,
+        const mli_tensor * weights,
+        const mli_sa8_quant_cache * cache,
+        const mli_fully_connected_cfg * cfg,
+        mli_tensor * out) {
+    mli_status stat = MLI_CHECK_STATUS(mli_chk_tensor (in), "Bad input tensor");
+    if (stat != MLI_STATUS_OK) return stat;
+    stat = MLI_CHECK_STATUS(mli_chk_tensor (weights), "Bad weights tensor");
+    if (stat != MLI_STATUS_OK) return stat;
+    stat = MLI_CHECK_STATUS(mli_chk_tensor (out, MLI_CONV_OUT_PTR_INSIDE_CCM), "Bad output tensor");
+    if (stat != MLI_STATUS_OK) return stat;
+    if (MLI_CHECK(in->el_type          == MLI_EL_SA_8, "Wrong input tensor type") ||
+            MLI_CHECK(weights->el_type == MLI_EL_SA_8, "Wrong weights tensor type") ||
+            MLI_CHECK(out->el_type     == MLI_EL_SA_8, "Wrong output tensor type"))
+        return MLI_STATUS_TYPE_MISMATCH;
+    if (MLI_CHECK(cfg != NULL , "Bad cfg pointer")) return MLI_STATUS_BAD_FUNC_CFG;
+    stat = MLI_CHECK_STATUS(mli_chk_sa8_quant_cache(cache), __func__);
+    if (stat != MLI_STATUS_OK) return stat;
+
+    bool fail = false;
+    const bool is_batched = out->rank == 2;
+    fail |= MLI_CHECK(weights->rank == 2, "Wrong weights rank");
+    fail |= MLI_CHECK(out->rank == 1 || is_batched, "Wrong out rank");
+    if (is_batched) {
+        fail |= MLI_CHECK(in->rank == 2, "Wrong input rank for batched mode");
+        fail |= MLI_CHECK(in->shape[0] == out->shape[0], "Shape mismatch in and out batch size");
+        fail |= MLI_CHECK(in->shape[1] == weights->shape[0], "weights shape doesn't match number of input elements");
+    } else {
+        fail |= MLI_CHECK(mli_prv_count_elem_num (in) == weights->shape[0], "weights shape doesn't match number of input elements");
+    }
+    fail |= MLI_CHECK(out->shape[out->rank - 1] == weights->shape[1], "Shape mismatch out and weights");
+    fail |= MLI_CHECK(cache->ch_num == weights->shape[1], "Shape mismatch cache and weights");
+    if (fail) return MLI_STATUS_SHAPE_MISMATCH;
+
+    if (is_batched) {
+        fail |= MLI_CHECK(check_inner_most_dimension_is_one(in), "Memory stride for inner most dimension of input must be 1");
+        fail |= MLI_CHECK(check_inner_most_dimension_is_one(out), "Memory stride for inner most dimension of output must be 1");
+    } else {
+        fail |= MLI_CHECK(check_layout_is_contiguous(in), "Memory Layout of input tensor must be contiguous");
+        fail |= MLI_CHECK(check_layout_is_contiguous(out->mem_stride, 1), "Memory Layout of output tensor must be contiguous");
+    }
+    fail |= MLI_CHECK(check_inner_most_dimension_is_one(weights), "Memory stride for inner most dimension of weights must be 1");
+    if (fail) return MLI_STATUS_INCOMPATEBLE_TENSORS;
+
+    //check that input and output are not overlapped
+    if (MLI_CHECK(mli_chk_tensors_not_overlapped(in, out),"in and out buffer must not be overlapped")) {
+        return MLI_STATUS_INCOMPATEBLE_TENSORS;
+    }
+    return MLI_STATUS_OK;
+}
+
 mli_status mli_chk_relu(const mli_tensor * in, const mli_relu_cfg * cfg, mli_tensor * out) {
     mli_status stat = MLI_STATUS_OK;
     bool fail = false;
@@ -1578,9 +1759,9 @@ mli_status mli_chk_eltwise (
 
     // Check tensor shapes
     if (!mli_tensor_is_scalar(in1) && !mli_tensor_is_scalar(in2)) {
-        fail |= MLI_CHECK(check_same_shape(in1, in2), "If both tensors are not scalar, their shapes must be the same");
-    }
-    if (!mli_tensor_is_scalar(in1)) {
+        fail |= MLI_CHECK(check_broadcast_shape(in1, in2, out),
+                          "If both tensors are not scalar, their shapes must be broadcastable to the output shape");
+    } else if (!mli_tensor_is_scalar(in1)) {
         fail |= MLI_CHECK(check_same_shape(in1, out), "Output shape must match non-scalar input tensor");
     } else {
         fail |= MLI_CHECK(check_same_shape(in2, out), "Output shape must match non-scalar input tensor");
@@ -1807,6 +1988,68 @@ mli_status mli_chk_softmax_sa8(const mli_tensor * in, const mli_softmax_cfg* cfg
     return MLI_STATUS_OK;
 }
 
+mli_status mli_chk_softmax_stream_init(int32_t topk, const mli_softmax_stream_state *state) {
+    if (MLI_CHECK(state != NULL , "Bad state pointer")) return MLI_STATUS_BAD_FUNC_CFG;
+    if (MLI_CHECK(topk >= 0 && topk <= MLI_SOFTMAX_STREAM_MAX_TOPK, "Wrong topk parameter"))
+        return MLI_STATUS_BAD_FUNC_CFG;
+    return MLI_STATUS_OK;
+}
+
+mli_status mli_chk_softmax_stream_update_sa8(const mli_tensor * in, const mli_softmax_stream_state *state) {
+    mli_status ret = MLI_CHECK_STATUS(mli_chk_tensor(in), "Bad input tensor");
+    if (ret != MLI_STATUS_OK) return ret;
+    if (MLI_CHECK(in->el_type == MLI_EL_SA_8, "Wrong input tensor type"))
+        return MLI_STATUS_TYPE_MISMATCH;
+    if (MLI_CHECK(state != NULL , "Bad state pointer")) return MLI_STATUS_BAD_FUNC_CFG;
+
+    ret = MLI_CHECK_STATUS(mli_chk_tensor_quant_params(in, kZeroPointBitsByteRange), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+    if (MLI_CHECK(in->el_params.sa.dim < 0, "Input tensor: Per-tensor quantization is expected"))
+         return MLI_STATUS_INCOMPATEBLE_TENSORS;
+    if (state->num_values > 0) {
+        if (MLI_CHECK(in->el_params.sa.scale.mem.i16 == state->in_scale &&
+                      in->el_params.sa.scale_frac_bits.mem.i8 == state->in_shift,
+                      "All chunks of a slice must have the same scale"))
+            return MLI_STATUS_INCOMPATEBLE_TENSORS;
+    }
+    return MLI_STATUS_OK;
+}
+
+mli_status mli_chk_softmax_stream_normalize_sa8(const mli_tensor * in, const mli_softmax_stream_state *state,
+                                                const mli_tensor * out) {
+    mli_status ret = MLI_CHECK_STATUS(mli_chk_basic_activation(in, out), __func__);
+    if (ret != MLI_STATUS_OK)
+        return ret;
+    if (MLI_CHECK(in->el_type == MLI_EL_SA_8, "Wrong input tensor type"))
+        return MLI_STATUS_TYPE_MISMATCH;
+    if (MLI_CHECK(state != NULL , "Bad state pointer")) return MLI_STATUS_BAD_FUNC_CFG;
+    if (MLI_CHECK(state->num_values > 0, "State must be updated with all chunks of the slice"))
+        return MLI_STATUS_BAD_FUNC_CFG;
+    if (MLI_CHECK(in->el_params.sa.scale.mem.i16 == state->in_scale &&
+                  in->el_params.sa.scale_frac_bits.mem.i8 == state->in_shift,
+                  "All chunks of a slice must have the same scale"))
+        return MLI_STATUS_INCOMPATEBLE_TENSORS;
+    return MLI_STATUS_OK;
+}
+
+mli_status mli_chk_softmax_stream_topk_sa8(const mli_softmax_stream_state *state, const mli_tensor * out,
+                                           const mli_tensor * out_idx) {
+    if (MLI_CHECK(state != NULL , "Bad state pointer")) return MLI_STATUS_BAD_FUNC_CFG;
+    if (MLI_CHECK(state->num_values > 0, "State must be updated with all chunks of the slice"))
+        return MLI_STATUS_BAD_FUNC_CFG;
+    if (MLI_CHECK(out != NULL && out_idx != NULL, "Bad output tensor pointer"))
+        return MLI_STATUS_BAD_TENSOR;
+    if (MLI_CHECK(out->el_type == MLI_EL_SA_8, "Wrong output tensor type"))
+        return MLI_STATUS_TYPE_MISMATCH;
+    if (MLI_CHECK(out_idx->el_type == MLI_EL_SA_32, "Output indexes type must be MLI_EL_SA_32"))
+        return MLI_STATUS_TYPE_MISMATCH;
+    if (MLI_CHECK(out->data.capacity >= state->topk_num * sizeof(int8_t) &&
+                  out_idx->data.capacity >= state->topk_num * sizeof(int32_t),
+                  "Capacity of output tensors is not enough for topk values"))
+        return MLI_STATUS_NOT_ENGH_MEM;
+    return MLI_STATUS_OK;
+}
+
 mli_status mli_chk_l2_normalize_fx16(const mli_tensor * in, const mli_l2_normalize_cfg* cfg, mli_tensor * out) {
     mli_status ret = MLI_CHECK_STATUS(mli_chk_basic_activation(in, out), __func__);
     if (ret != MLI_STATUS_OK)
@@ -2821,6 +3064,28 @@ mli_status mli_chk_create_subtensor(const mli_tensor *in, const mli_sub_tensor_c
     return MLI_STATUS_OK;
 }
 
+mli_status mli_chk_permute_view(const mli_tensor *in, const mli_permute_cfg *cfg, mli_tensor *out) {
+    mli_status stat = MLI_STATUS_OK;
+
+    // Check that in tensor is valid and out provides valid pointers
+    stat = MLI_CHECK_STATUS(mli_chk_tensor (in, /*check_bank=*/false), "Bad input tensor");
+    if (stat != MLI_STATUS_OK) return stat;
+    if (MLI_CHECK(out != NULL , "Bad Output tensor  pointer")) return MLI_STATUS_BAD_TENSOR;
+
+    if (MLI_CHECK(cfg != NULL , "Bad cfg pointer")) return MLI_STATUS_BAD_FUNC_CFG;
+    for (int idx = 0; idx < (int)in->rank; idx++) {
+        if (MLI_CHECK(cfg->perm_dim[idx] < in->rank, "Rank mismatch"))
+            return MLI_STATUS_BAD_FUNC_CFG;
+
+        // Each permute dimension must be unique
+        for (int jdx = idx + 1; jdx < (int)in->rank; jdx++)
+            if (MLI_CHECK(cfg->perm_dim[idx] != cfg->perm_dim[jdx], "Each permute dimension must be unique"))
+                return MLI_STATUS_BAD_FUNC_CFG;
+    }
+
+    return MLI_STATUS_OK;
+}
+
 mli_status mli_chk_data_movement(const mli_tensor *in, const mli_mov_cfg_t *cfg, mli_tensor *out) {
     mli_status stat = MLI_STATUS_OK;
     // For data movement the tensor data can be allocated in external memory.
@@ -0,0 +1,204 @@
+/*
+* Copyright 2022, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+
+#include <cstddef>
+
+#include "mli_debug.h"
+#include "mli_graph_executor.hpp"
+#include "mli_math_macros.h"
+
+namespace snps_arc::metaware::mli {
+
+//======================================================
+// GraphMemoryPlanner
+//======================================================
+GraphMemoryPlanner::GraphMemoryPlanner(GraphBuffer* buffers, uint32_t max_buffers, uint32_t alignment)
+    : m_buffers(buffers), m_max_buffers(max_buffers), m_num_buffers(0),
+      m_alignment(alignment), m_arena_size(0) {
+    MLI_ASSERT(buffers != nullptr || max_buffers == 0);
+    MLI_ASSERT(alignment > 0);
+}
+
+int32_t GraphMemoryPlanner::AddBuffer(uint32_t size) {
+    if (m_num_buffers >= m_max_buffers) return -1;
+    GraphBuffer& buf = m_buffers[m_num_buffers];
+    buf.size = size;
+    buf.first_layer = -1;
+    buf.last_layer = -1;
+    buf.offset = kUnplannedOffset;
+    return (int32_t)m_num_buffers++;
+}
+
+mli_status GraphMemoryPlanner::MarkUse(int32_t buffer_id, int32_t layer_idx) {
+    if (buffer_id < 0 || (uint32_t)buffer_id >= m_num_buffers || layer_idx < 0) {
+        return MLI_STATUS_ARGUMENT_ERROR;
+    }
+    GraphBuffer& buf = m_buffers[buffer_id];
+    if (buf.first_layer < 0 || layer_idx < buf.first_layer) buf.first_layer = layer_idx;
+    if (layer_idx > buf.last_layer) buf.last_layer = layer_idx;
+    return MLI_STATUS_OK;
+}
+
+bool GraphMemoryPlanner::IsLiveTogether(uint32_t a, uint32_t b) const {
+    return m_buffers[a].first_layer <= m_buffers[b].last_layer &&
+           m_buffers[b].first_layer <= m_buffers[a].last_layer;
+}
+
+uint32_t GraphMemoryPlanner::AlignedSize(uint32_t idx) const {
+    return CEIL_RND(m_buffers[idx].size, m_alignment);
+}
+
+uint32_t GraphMemoryPlanner::GetNonOverlappedSize() const {
+    uint32_t size = 0;
+    for (uint32_t i = 0; i < m_num_buffers; i++) {
+        if (IsLive(i)) size += AlignedSize(i);
+    }
+    return size;
+}
+
+mli_status GraphMemoryPlanner::Plan() {
+    m_arena_size = 0;
+    for (uint32_t i = 0; i < m_num_buffers; i++) {
+        m_buffers[i].offset = kUnplannedOffset;
+    }
+
+    for (uint32_t placed = 0; placed < m_num_buffers; placed++) {
+        // Pick the largest buffer which is not placed yet (earlier one on ties)
+        int32_t cur = -1;
+        for (uint32_t i = 0; i < m_num_buffers; i++) {
+            if (!IsLive(i) || m_buffers[i].offset != kUnplannedOffset) continue;
+            if (cur < 0 || AlignedSize(i) > AlignedSize(cur)) cur = (int32_t)i;
+        }
+        if (cur < 0) break;
+
+        // Candidate offsets are the arena start and the ends of conflicting buffers.
+        // The lowest candidate without any collision wins.
+        const uint32_t size = AlignedSize(cur);
+        uint32_t best = kUnplannedOffset;
+        for (int32_t cand_idx = -1; cand_idx < (int32_t)m_num_buffers; cand_idx++) {
+            uint32_t cand = 0;
+            if (cand_idx >= 0) {
+                if (m_buffers[cand_idx].offset == kUnplannedOffset || !IsLiveTogether(cur, cand_idx)) continue;
+                cand = m_buffers[cand_idx].offset + AlignedSize(cand_idx);
+            }
+            if (cand >= best) continue;
+
+            bool collision = false;
+            for (uint32_t j = 0; j < m_num_buffers && !collision; j++) {
+                if (m_buffers[j].offset == kUnplannedOffset || !IsLiveTogether(cur, j)) continue;
+                collision = cand < m_buffers[j].offset + AlignedSize(j) && m_buffers[j].offset < cand + size;
+            }
+            if (!collision) best = cand;
+        }
+        MLI_ASSERT(best != kUnplannedOffset);
+        m_buffers[cur].offset = best;
+        m_arena_size = MAX(m_arena_size, best + size);
+    }
+    return MLI_STATUS_OK;
+}
+
+uint32_t GraphMemoryPlanner::GetOffset(int32_t buffer_id) const {
+    MLI_ASSERT(buffer_id >= 0 && (uint32_t)buffer_id < m_num_buffers);
+    return m_buffers[buffer_id].offset;
+}
+
+//======================================================
+// GraphExecutor
+//======================================================
+GraphExecutor::GraphExecutor(const GraphLayer* layers, uint32_t num_layers,
+                             void* runtime_buffer, uint32_t runtime_buf_size,
+                             uint64_t* membases, int num_mems)
+    : m_layers(layers), m_num_layers(num_layers),
+      m_runtime_buffer(runtime_buffer), m_runtime_buf_size(runtime_buf_size),
+      m_membases(membases), m_num_mems(num_mems), m_profiler(nullptr), m_pd(nullptr),
+      m_estimator_buffer(nullptr), m_estimator_buf_size(0) {
+    MLI_ASSERT(layers != nullptr || num_layers == 0);
+    MLI_ASSERT(runtime_buffer != nullptr);
+    MLI_ASSERT(((size_t) runtime_buffer % kMliAlignment) == 0);
+}
+
+uint32_t GraphExecutor::GetRuntimeBufferSize(const GraphLayer* layers, uint32_t num_layers) {
+    uint32_t size = 0;
+    for (uint32_t i = 0; i < num_layers; i++) {
+        size = MAX(size, layers[i].runtime_obj_size);
+    }
+    return CEIL_RND(size, kMliAlignment);
+}
+
+static mli_status RunTiles(ExecutionInterface* op, uint32_t num_tiles) {
+    for (uint32_t tile = 0; tile < num_tiles; tile++) {
+        mli_status status = op->Prefetch();
+        if (status != MLI_STATUS_OK) return status;
+        status = op->Issue();
+        if (status != MLI_STATUS_OK) return status;
+        status = op->Update();
+        if (status != MLI_STATUS_OK) return status;
+    }
+    return MLI_STATUS_OK;
+}
+
+mli_status GraphExecutor::RunLayer(uint32_t layer_idx) {
+    if (layer_idx >= m_num_layers) return MLI_STATUS_ARGUMENT_ERROR;
+    const GraphLayer& layer = m_layers[layer_idx];
+    if (layer.runtime_obj_size > m_runtime_buf_size) return MLI_STATUS_NOT_ENGH_MEM;
+
+    // The object is re-created on each run, so all iterators start from the first tile
+    ExecutionInterface* op = ExecutionInterface::Create(m_runtime_buffer, m_runtime_buf_size,
+                                                        layer.private_data, layer.private_data_size,
+                                                        m_membases, m_num_mems);
+    if (op == nullptr) return MLI_STATUS_NOT_SUPPORTED;
+
+    if (m_profiler != nullptr) return RunProfiledLayer(layer_idx, op);
+    return RunTiles(op, layer.num_tiles);
+}
+
+mli_status GraphExecutor::RunProfiledLayer(uint32_t layer_idx, ExecutionInterface* op) {
+    const GraphLayer& layer = m_layers[layer_idx];
+    PerfEstimator* estimator = nullptr;
+    if (m_pd != nullptr && m_estimator_buffer != nullptr) {
+        // the estimator copies iterators of the just created object, so it starts from the first tile too
+        estimator = PerfEstimator::Create(m_estimator_buffer, m_estimator_buf_size, *m_pd, *op,
+                                          (int)layer.num_tiles);
+    }
+    ProfiledKernel profiled_op(op, m_profiler, layer_idx, estimator);
+
+    ProfileRecord record{};
+    record.kernel_id = op->GetKernelId();
+    record.layer = layer_idx;
+    record.call = ProfileCall::kLayer;
+    record.start = m_profiler->GetTime();
+    record.status = RunTiles(&profiled_op, layer.num_tiles);
+    record.end = m_profiler->GetTime();
+    record.tile = profiled_op.GetTile();
+    if (estimator != nullptr) {
+        record.read_bytes = (uint32_t)estimator->GetTotalReadBytes();
+        record.write_bytes = (uint32_t)estimator->GetTotalWriteBytes();
+        record.macs = (uint32_t)estimator->GetTotalMacs();
+    }
+    m_profiler->Record(record);
+    return record.status;
+}
+
+mli_status GraphExecutor::Run() {
+    for (uint32_t i = 0; i < m_num_layers; i++) {
+        mli_status status = RunLayer(i);
+        if (status != MLI_STATUS_OK) return status;
+    }
+    return MLI_STATUS_OK;
+}
+
+void GraphExecutor::SetProfiler(Profiler* profiler, PlatformDescription* pd,
+                                void* estimator_buffer, uint32_t estimator_buf_size) {
+    m_profiler = profiler;
+    m_pd = pd;
+    m_estimator_buffer = estimator_buffer;
+    m_estimator_buf_size = estimator_buf_size;
+}
+
+} // namespace snps_arc::metaware::mli
@@ -7,45 +7,717 @@
 *
 */
 
+#include <new>
+#include <utility>
+
+#include "mli_debug.h"
+#include "mli_math_macros.h"
 #include "mli_perf_estim.hpp"
+#include "mli_ref_perf_estim.hpp"
+#include "mli_ref_runtime_api.hpp"
 
 namespace snps_arc::metaware::mli {
-    
+
 PerfEstimator* PerfEstimator::Create(void* allocation_memory_buffer,
-        lib_mli::PlatformDescription& desc, 
-        lib_mli::ExecutionInterface& rt_kernel, 
-        int num_tiles){
-       kernel_id_t kernel_id = rt_kernel.GetKernelId();
-    PerfEstimator *obj = nullptr;
-    switch (kernel_id) {
-      /*case kConv2dId:
-          obj = new(allocation_memory_buffer) Conv2dPerfEstimator(desc, rt_kernel, num_tiles);
-          break;
-      case kMoveId:
-          obj = new(allocation_memory_buffer) MovePerfEstimator(desc, rt_kernel, num_tiles);
-          break;
-      case kPreluId:
-          obj = new(allocation_memory_buffer) PreluPerfEstimator(desc, rt_kernel, num_tiles);
-          break;*/
+                                     uint32_t alloc_buf_size,
+                                     lib_mli::PlatformDescription& pd,
+                                     lib_mli::ExecutionInterface& rt_kernel,
+                                     int num_tiles) {
+    return ref::KernelPerfEstimatorFactory::Create(allocation_memory_buffer, alloc_buf_size,
+                                                   pd, rt_kernel, num_tiles);
+}
+
+int PerfEstimator::KernelPerf_GetSize(lib_mli::ExecutionInterface& rt_kernel) {
+    return ref::KernelPerfEstimatorFactory::GetSize(rt_kernel);
+}
+
+namespace ref {
+
+// Accumulator width in bits used by MAC operations (without guard bits)
+constexpr uint32_t kPerfAccuBits = 32;
+
+// Fixed per-tile setup cost for each AGU configuration (see PlatformDescription::AguConfig)
+constexpr int64_t kPerfTileOverheadCycles[] = {
+    32,  // kAguConfigSmall
+    24,  // kAguConfigMedium
+    16,  // kAguConfigLarge
+    64   // kAguConfigNoAgu
+};
+
+// Element-wise operations per element for the kernels estimated with the generic models
+constexpr uint32_t kPerfRescaleMacsPerElem = 1;
+constexpr uint32_t kPerfRescaleOpsPerElem = 3;    // in/out bias, shift with rounding
+constexpr uint32_t kPerfPreluMacsPerElem = 1;
+constexpr uint32_t kPerfPreluOpsPerElem = 4;      // select, bias, shift, saturation
+constexpr uint32_t kPerfClipOpsPerElem = 2;       // min and max
+constexpr uint32_t kPerfPermuteOpsPerElem = 1;
+constexpr uint32_t kPerfTableMacsPerElem = 1;     // linear interpolation between two LUT values
+constexpr uint32_t kPerfTableOpsPerElem = 3;      // index computation and two lookups
+constexpr uint32_t kPerfResizeMacsPerElem = 4;    // four weighted neighbours per output element
+constexpr uint32_t kPerfResizeOpsPerElem = 2;
+constexpr uint32_t kPerfReduceOpsPerElem = 1;
+constexpr uint32_t kPerfArgMaxOpsPerElem = 2;     // compare and index select
+
+//======================================================
+//
+// Cost model functions
+//
+//======================================================
+uint32_t GetPerfVectorLanes(const PlatformDescription& pd, uint32_t elem_size) {
+    uint32_t lanes = 1;
+    if (elem_size == sizeof(int8_t)) {
+        lanes = pd.GetVectorLength8bit();
+    } else if (elem_size == sizeof(int16_t)) {
+        lanes = pd.GetVectorLength16bit();
+    } else {
+        // 32-bit elements are processed as pairs of 16-bit lanes
+        lanes = pd.GetVectorLength16bit() / 2;
+    }
+    return MAX(lanes, 1u);
+}
+
+int64_t GetPerfMacCycles(const PlatformDescription& pd, int64_t macs, uint32_t elem_size) {
+    if (macs <= 0) return 0;
+    const int64_t lanes = GetPerfVectorLanes(pd, elem_size);
+    const int64_t slots = MAX(pd.GetMacIssueSlots(), 1u);
+    int64_t cycles = CEIL_DIV(macs, lanes * slots);
+
+    // Each product of two elem_size operands takes 2 * 8 * elem_size bits of the accumulator.
+    // The rest of it with the guard bits defines how many products can be summed up
+    // before partial sums have to be spilled into a wider accumulator.
+    const int32_t product_bits = 2 * 8 * elem_size;
+    const int32_t headroom_bits = (int32_t)kPerfAccuBits + (int32_t)pd.GetGuardBits() - product_bits;
+    if (headroom_bits < 31) {
+        const int64_t spill_interval = (int64_t)1 << MAX(headroom_bits, 0);
+        cycles += CEIL_DIV(macs, lanes * spill_interval);
+    }
+    return cycles;
+}
+
+int64_t GetPerfElemCycles(const PlatformDescription& pd, int64_t elem_ops, uint32_t elem_size) {
+    if (elem_ops <= 0) return 0;
+    return CEIL_DIV(elem_ops, (int64_t)GetPerfVectorLanes(pd, elem_size));
+}
+
+int64_t GetPerfMemCycles(const PlatformDescription& pd, int64_t bytes) {
+    if (bytes <= 0) return 0;
+    return CEIL_DIV(bytes, (int64_t)MAX(pd.GetVectorLength8bit(), 1u));
+}
+
+int64_t GetPerfTileOverheadCycles(const PlatformDescription& pd) {
+    return kPerfTileOverheadCycles[pd.GetAguConfig()];
+}
+
+//======================================================
+//
+// KernelPerfEstimator
+//
+//======================================================
+uint32_t KernelPerfEstimator::GetVectorLanes(uint32_t elem_size) const {
+    return GetPerfVectorLanes(m_pd, elem_size);
+}
+
+int64_t KernelPerfEstimator::GetMacCycles(int64_t macs, uint32_t elem_size) const {
+    return GetPerfMacCycles(m_pd, macs, elem_size);
+}
+
+int64_t KernelPerfEstimator::GetElemCycles(int64_t elem_ops, uint32_t elem_size) const {
+    return GetPerfElemCycles(m_pd, elem_ops, elem_size);
+}
+
+int64_t KernelPerfEstimator::GetMemCycles(int64_t bytes) const {
+    return GetPerfMemCycles(m_pd, bytes);
+}
+
+int64_t KernelPerfEstimator::GetTileOverheadCycles() const {
+    return GetPerfTileOverheadCycles(m_pd);
+}
+
+TileCost KernelPerfEstimator::MakeTileCost(int64_t compute_cycles, int64_t read_bytes,
+                                           int64_t write_bytes, int64_t macs) const {
+    TileCost cost;
+    const int64_t mem_cycles = GetMemCycles(read_bytes) + GetMemCycles(write_bytes);
+    cost.cycles = MAX(compute_cycles, mem_cycles) + GetTileOverheadCycles();
+    cost.read_bytes = read_bytes;
+    cost.write_bytes = write_bytes;
+    cost.macs = macs;
+    return cost;
+}
+
+TileCost KernelPerfEstimator::GetTileCost(int tile_idx) {
+    MLI_ASSERT(tile_idx >= 0 && tile_idx < m_num_tiles);
+    if (m_tile_pos < 0 || m_tile_pos > tile_idx) {
+        ResetTiles();
+        m_tile_pos = 0;
+    }
+    for (; m_tile_pos < tile_idx; m_tile_pos++) {
+        NextTile();
+    }
+    return GetCurrentTileCost();
+}
+
+TileCost KernelPerfEstimator::GetTotalCost() {
+    TileCost total = {0, 0, 0, 0};
+    ResetTiles();
+    for (int i = 0; i < m_num_tiles; i++) {
+        const TileCost tile = GetCurrentTileCost();
+        total.cycles += tile.cycles;
+        total.read_bytes += tile.read_bytes;
+        total.write_bytes += tile.write_bytes;
+        total.macs += tile.macs;
+        NextTile();
+    }
+    m_tile_pos = -1;
+    return total;
+}
+
+//======================================================
+//
+// Convolutions
+//
+//======================================================
+Conv2dPerfEstimator::Conv2dPerfEstimator(lib_mli::PlatformDescription& pd,
+                                         const Conv2dMetadata& metadata, int num_tiles)
+    : KernelPerfEstimator(pd, num_tiles),
+      m_input(metadata.input),
+      m_weights(metadata.weights),
+      m_weights_zp(metadata.weights_zp),
+      m_output(metadata.output) {}
+
+void Conv2dPerfEstimator::ResetTiles() {
+    m_input.Reset();
+    m_weights.Reset();
+    m_weights_zp.Reset();
+    m_output.Reset();
+}
+
+void Conv2dPerfEstimator::NextTile() {
+    m_input.Next();
+    m_weights.Next();
+    m_weights_zp.Next();
+    m_output.Next();
+}
+
+TileCost Conv2dPerfEstimator::GetCurrentTileCost() {
+    uint32_t weights_dims[kConvWRank];
+    uint32_t output_dims[kConvIORank];
+    GetTileDims(m_weights, weights_dims);
+    const int64_t out_elems = GetTileDims(m_output, output_dims);
+
+    // [G, Kh, Kw, Ci, Co]: each output value needs Kh * Kw * Ci MACs of its group
+    const int64_t macs = out_elems * weights_dims[kKernelHeightDim] *
+                         weights_dims[kKernelWidthDim] * weights_dims[kKernelChannelInDim];
+    const int64_t read_bytes = GetTileBytes(m_input) + GetTileBytes(m_weights) +
+                               GetTileBytes(m_weights_zp);
+    const uint32_t elem_size = m_input.GetSubTensor().get_elem_size();
+    return MakeTileCost(GetMacCycles(macs, elem_size), read_bytes, GetTileBytes(m_output), macs);
+}
+
+DepthwiseConv2dPerfEstimator::DepthwiseConv2dPerfEstimator(lib_mli::PlatformDescription& pd,
+                                                           const DepthwiseConv2dMetadata& metadata,
+                                                           int num_tiles)
+    : KernelPerfEstimator(pd, num_tiles),
+      m_input(metadata.input),
+      m_weights(metadata.weights),
+      m_weights_zp(metadata.weights_zp),
+      m_output(metadata.output) {}
+
+void DepthwiseConv2dPerfEstimator::ResetTiles() {
+    m_input.Reset();
+    m_weights.Reset();
+    m_weights_zp.Reset();
+    m_output.Reset();
+}
+
+void DepthwiseConv2dPerfEstimator::NextTile() {
+    m_input.Next();
+    m_weights.Next();
+    m_weights_zp.Next();
+    m_output.Next();
+}
+
+TileCost DepthwiseConv2dPerfEstimator::GetCurrentTileCost() {
+    uint32_t weights_dims[kDepthwiseWRank];
+    uint32_t output_dims[kDepthwiseIORank];
+    GetTileDims(m_weights, weights_dims);
+    const int64_t out_elems = GetTileDims(m_output, output_dims);
+
+    // [Kh, Kw, C]: each output value needs Kh * Kw MACs of its own channel
+    const int64_t macs = out_elems * weights_dims[kKernelDWHeightDim] *
+                         weights_dims[kKernelDWWidthDim];
+    const int64_t read_bytes = GetTileBytes(m_input) + GetTileBytes(m_weights) +
+                               GetTileBytes(m_weights_zp);
+    const uint32_t elem_size = m_input.GetSubTensor().get_elem_size();
+    return MakeTileCost(GetMacCycles(macs, elem_size), read_bytes, GetTileBytes(m_output), macs);
+}
+
+TransposeConv2DPerfEstimator::TransposeConv2DPerfEstimator(lib_mli::PlatformDescription& pd,
+                                                           const TransposeConv2DMetadata& metadata,
+                                                           int num_tiles)
+    : KernelPerfEstimator(pd, num_tiles),
+      m_input(metadata.input),
+      m_weights(metadata.weights),
+      m_weights_zp(metadata.weights_zp),
+      m_output(metadata.output) {}
+
+void TransposeConv2DPerfEstimator::ResetTiles() {
+    m_input.Reset();
+    m_weights.Reset();
+    m_weights_zp.Reset();
+    m_output.Reset();
+}
+
+void TransposeConv2DPerfEstimator::NextTile() {
+    m_input.Next();
+    m_weights.Next();
+    m_weights_zp.Next();
+    m_output.Next();
+}
+
+TileCost TransposeConv2DPerfEstimator::GetCurrentTileCost() {
+    uint32_t weights_dims[kTransposeConvWRank];
+    uint32_t input_dims[kTransposeConvIORank];
+    GetTileDims(m_weights, weights_dims);
+    const int64_t in_elems = GetTileDims(m_input, input_dims);
+
+    // [G, Kh, Kw, Ci, Co]: each input value is scattered into Kh * Kw * Co outputs of its group
+    const int64_t macs = in_elems * weights_dims[kKernelHeightDim] *
+                         weights_dims[kKernelWidthDim] * weights_dims[kKernelChannelOutDim];
+    const int64_t read_bytes = GetTileBytes(m_input) + GetTileBytes(m_weights) +
+                               GetTileBytes(m_weights_zp);
+    const uint32_t elem_size = m_input.GetSubTensor().get_elem_size();
+    return MakeTileCost(GetMacCycles(macs, elem_size), read_bytes, GetTileBytes(m_output), macs);
+}
+
+//======================================================
+//
+// FullyConnected and MatMul
+//
+//======================================================
+FullyConnectedPerfEstimator::FullyConnectedPerfEstimator(lib_mli::PlatformDescription& pd,
+                                                         const FullyConnectedMetadata& metadata,
+                                                         uint32_t i_elem_size,
+                                                         uint32_t w_elem_size,
+                                                         uint32_t o_elem_size,
+                                                         int num_tiles)
+    : KernelPerfEstimator(pd, num_tiles),
+      m_batch(metadata.input.shape[0]),
+      m_in_ch(metadata.input.shape[1]),
+      m_out_ch(metadata.output.shape[1]),
+      m_i_elem_size(i_elem_size),
+      m_w_elem_size(w_elem_size),
+      m_o_elem_size(o_elem_size) {}
+
+TileCost FullyConnectedPerfEstimator::GetCurrentTileCost() {
+    // [N, OC] = [N, IC] * [IC, OC]
+    const int64_t macs = (int64_t)m_batch * m_in_ch * m_out_ch;
+    const int64_t read_bytes = (int64_t)m_batch * m_in_ch * m_i_elem_size +
+                               (int64_t)m_in_ch * m_out_ch * m_w_elem_size;
+    const int64_t write_bytes = (int64_t)m_batch * m_out_ch * m_o_elem_size;
+    return MakeTileCost(GetMacCycles(macs, m_i_elem_size), read_bytes, write_bytes, macs);
+}
+
+MatMulPerfEstimator::MatMulPerfEstimator(
+        lib_mli::PlatformDescription& pd,
+        const TensorIterator<OffsetBuffer, kMatMulRank, kMatMulIterRank>& input_left,
+        const TensorIterator<OffsetBuffer, kMatMulRank, kMatMulIterRank>& input_right,
+        const TensorIterator<OffsetBuffer, kMatMulRank, kMatMulIterRank>& output,
+        int num_tiles)
+    : KernelPerfEstimator(pd, num_tiles),
+      m_input_left(input_left),
+      m_input_right(input_right),
+      m_output(output) {}
+
+void MatMulPerfEstimator::ResetTiles() {
+    m_input_left.Reset();
+    m_input_right.Reset();
+    m_output.Reset();
+}
+
+void MatMulPerfEstimator::NextTile() {
+    m_input_left.Next();
+    m_input_right.Next();
+    m_output.Next();
+}
+
+TileCost MatMulPerfEstimator::GetCurrentTileCost() {
+    uint32_t left_dims[kMatMulRank];
+    uint32_t output_dims[kMatMulRank];
+    GetTileDims(m_input_left, left_dims);
+    const int64_t out_elems = GetTileDims(m_output, output_dims);
+
+    // [B, M, N] = [B, M, K] * [B, K, N]
+    const int64_t macs = out_elems * left_dims[kMatMulWidthDim];
+    const int64_t read_bytes = GetTileBytes(m_input_left) + GetTileBytes(m_input_right);
+    const uint32_t elem_size = m_input_left.GetSubTensor().get_elem_size();
+    return MakeTileCost(GetMacCycles(macs, elem_size), read_bytes, GetTileBytes(m_output), macs);
+}
+
+//======================================================
+//
+// Pooling
+//
+//======================================================
+Pool2DPerfEstimator::Pool2DPerfEstimator(
+        lib_mli::PlatformDescription& pd,
+        const TensorIterator<OffsetBuffer, kPoolRank, kPoolIterRank>& input,
+        const TensorIterator<OffsetBuffer, kPoolRank, kPoolIterRank>& output,
+        const mli_pool_cfg& cfg, bool is_sum, int num_tiles)
+    : KernelPerfEstimator(pd, num_tiles),
+      m_input(input),
+      m_output(output),
+      m_kernel_size(cfg.kernel_height * cfg.kernel_width),
+      m_is_sum(is_sum) {}
+
+void Pool2DPerfEstimator::ResetTiles() {
+    m_input.Reset();
+    m_output.Reset();
+}
+
+void Pool2DPerfEstimator::NextTile() {
+    m_input.Next();
+    m_output.Next();
+}
+
+TileCost Pool2DPerfEstimator::GetCurrentTileCost() {
+    uint32_t output_dims[kPoolRank];
+    const int64_t out_elems = GetTileDims(m_output, output_dims);
+    const uint32_t elem_size = m_input.GetSubTensor().get_elem_size();
+
+    int64_t compute = GetElemCycles(out_elems * m_kernel_size, elem_size);
+    if (m_is_sum) {
+        // Scaling of the accumulated sum into the output
+        compute += GetMacCycles(out_elems, elem_size);
+    }
+    const int64_t macs = m_is_sum ? out_elems : 0;
+    return MakeTileCost(compute, GetTileBytes(m_input), GetTileBytes(m_output), macs);
+}
+
+//======================================================
+//
+// Eltwise
+//
+//======================================================
+EltwisePerfEstimator::EltwisePerfEstimator(
+        lib_mli::PlatformDescription& pd,
+        const TensorIterator<OffsetBuffer, kEltwiseRank, kEltwiseIterRank>& input_left,
+        const TensorIterator<OffsetBuffer, kEltwiseRank, kEltwiseIterRank>& input_right,
+        const TensorIterator<OffsetBuffer, kEltwiseRank, kEltwiseIterRank>& output,
+        uint32_t macs_per_elem, uint32_t ops_per_elem, int num_tiles)
+    : KernelPerfEstimator(pd, num_tiles),
+      m_input_left(input_left),
+      m_input_right(input_right),
+      m_output(output),
+      m_macs_per_elem(macs_per_elem),
+      m_ops_per_elem(ops_per_elem) {}
+
+void EltwisePerfEstimator::ResetTiles() {
+    m_input_left.Reset();
+    m_input_right.Reset();
+    m_output.Reset();
+}
+
+void EltwisePerfEstimator::NextTile() {
+    m_input_left.Next();
+    m_input_right.Next();
+    m_output.Next();
+}
+
+TileCost EltwisePerfEstimator::GetCurrentTileCost() {
+    uint32_t output_dims[kEltwiseRank];
+    const int64_t out_elems = GetTileDims(m_output, output_dims);
+    const uint32_t elem_size = m_input_left.GetSubTensor().get_elem_size();
+
+    const int64_t macs = out_elems * m_macs_per_elem;
+    const int64_t compute = GetMacCycles(macs, elem_size) +
+                            GetElemCycles(out_elems * m_ops_per_elem, elem_size);
+    const int64_t read_bytes = GetTileBytes(m_input_left) + GetTileBytes(m_input_right);
+    return MakeTileCost(compute, read_bytes, GetTileBytes(m_output), macs);
+}
+
+//======================================================
+//
+// Factory
+//
+//======================================================
+template <typename estimator_T, typename... args_T>
+static PerfEstimator* CreateEstimator(void* allocation_memory_buffer, uint32_t alloc_buf_size,
+                                      const char* name, args_T&&... args) {
+    if (alloc_buf_size >= sizeof(estimator_T)) {
+        return new (allocation_memory_buffer) estimator_T(std::forward<args_T>(args)...);
+    }
+    MLI_PRINTF("\nMLI_ERROR: Insufficient space for [%s] perf estimator object\n", name);
+    return nullptr;
+}
+
+PerfEstimator* KernelPerfEstimatorFactory::Create(void* allocation_memory_buffer,
+                                                  uint32_t alloc_buf_size,
+                                                  lib_mli::PlatformDescription& pd,
+                                                  lib_mli::ExecutionInterface& rt_kernel,
+                                                  int num_tiles) {
+    void* buf = allocation_memory_buffer;
+    PerfEstimator* obj = nullptr;
+
+    switch (rt_kernel.GetKernelId()) {
+    case kConv2dId: {
+        auto& kernel = static_cast<Conv2d&>(rt_kernel);
+        obj = CreateEstimator<Conv2dPerfEstimator>(buf, alloc_buf_size, "Conv2d",
+                                                   pd, kernel.m_metadata, num_tiles);
+        break;
+    }
+    case kDWConv2dId: {
+        auto& kernel = static_cast<DepthwiseConv2d&>(rt_kernel);
+        obj = CreateEstimator<DepthwiseConv2dPerfEstimator>(buf, alloc_buf_size, "DepthwiseConv2d",
+                                                            pd, kernel.m_metadata, num_tiles);
+        break;
+    }
+    case kTransConv2DId: {
+        auto& kernel = static_cast<TransposeConv2D&>(rt_kernel);
+        obj = CreateEstimator<TransposeConv2DPerfEstimator>(buf, alloc_buf_size, "TransposeConv2D",
+                                                            pd, kernel.m_metadata, num_tiles);
+        break;
+    }
+    case kFullyConnectedId: {
+        auto& kernel = static_cast<FullyConnected&>(rt_kernel);
+        obj = CreateEstimator<FullyConnectedPerfEstimator>(buf, alloc_buf_size, "FullyConnected",
+                                                           pd, kernel.m_metadata, kernel.m_i_elem_size,
+                                                           kernel.m_w_elem_size, kernel.m_o_elem_size,
+                                                           num_tiles);
+        break;
+    }
+    case kMatMulId: {
+        auto& kernel = static_cast<MatMul&>(rt_kernel);
+        obj = CreateEstimator<MatMulPerfEstimator>(buf, alloc_buf_size, "MatMul", pd,
+                                                   kernel.m_input_left, kernel.m_input_right,
+                                                   kernel.m_output, num_tiles);
+        break;
+    }
+    case kMaxPool2DId: {
+        auto& kernel = static_cast<MaxPool2D&>(rt_kernel);
+        obj = CreateEstimator<Pool2DPerfEstimator>(buf, alloc_buf_size, "MaxPool2D", pd,
+                                                   kernel.m_input, kernel.m_output,
+                                                   kernel.m_cfg, false, num_tiles);
+        break;
+    }
+    case kSumPool2DId: {
+        auto& kernel = static_cast<SumPool2D&>(rt_kernel);
+        obj = CreateEstimator<Pool2DPerfEstimator>(buf, alloc_buf_size, "SumPool2D", pd,
+                                                   kernel.m_input, kernel.m_output,
+                                                   kernel.m_cfg, true, num_tiles);
+        break;
+    }
+    case kAddId: {
+        auto& kernel = static_cast<Add&>(rt_kernel);
+        obj = CreateEstimator<EltwisePerfEstimator>(buf, alloc_buf_size, "Add", pd,
+                                                    kernel.m_input_left, kernel.m_input_right,
+                                                    kernel.m_output, 0, 1, num_tiles);
+        break;
+    }
+    case kSubId: {
+        auto& kernel = static_cast<Sub&>(rt_kernel);
+        obj = CreateEstimator<EltwisePerfEstimator>(buf, alloc_buf_size, "Sub", pd,
+                                                    kernel.m_input_left, kernel.m_input_right,
+                                                    kernel.m_output, 0, 1, num_tiles);
+        break;
+    }
+    case kMulId: {
+        auto& kernel = static_cast<Mul&>(rt_kernel);
+        obj = CreateEstimator<EltwisePerfEstimator>(buf, alloc_buf_size, "Mul", pd,
+                                                    kernel.m_input_left, kernel.m_input_right,
+                                                    kernel.m_output, 1, 0, num_tiles);
+        break;
+    }
+    case kMaxId: {
+        auto& kernel = static_cast<Max&>(rt_kernel);
+        obj = CreateEstimator<EltwisePerfEstimator>(buf, alloc_buf_size, "Max", pd,
+                                                    kernel.m_input_left, kernel.m_input_right,
+                                                    kernel.m_output, 0, 1, num_tiles);
+        break;
+    }
+    case kMinId: {
+        auto& kernel = static_cast<Min&>(rt_kernel);
+        obj = CreateEstimator<EltwisePerfEstimator>(buf, alloc_buf_size, "Min", pd,
+                                                    kernel.m_input_left, kernel.m_input_right,
+                                                    kernel.m_output, 0, 1, num_tiles);
+        break;
+    }
+    case kEltwiseChainId: {
+        auto& kernel = static_cast<EltwiseChain&>(rt_kernel);
+        // multiplications and requantization steps use the MAC, the others are element-wise
+        uint32_t macs_per_elem = 0;
+        uint32_t ops_per_elem = 0;
+        for (uint32_t i = 0; i < kernel.m_config.num_steps; i++) {
+            const EltwiseChainOp op = kernel.m_config.steps[i].op;
+            if (op == EltwiseChainOp::kMul || op == EltwiseChainOp::kRescale || op == EltwiseChainOp::kPrelu) {
+                macs_per_elem++;
+            } else {
+                ops_per_elem++;
+            }
+        }
+        obj = CreateEstimator<EltwisePerfEstimator>(buf, alloc_buf_size, "EltwiseChain", pd,
+                                                    kernel.m_input_left, kernel.m_input_right,
+                                                    kernel.m_output, macs_per_elem, ops_per_elem, num_tiles);
+        break;
+    }
+    case kRescaleId: {
+        auto& kernel = static_cast<Rescale&>(rt_kernel);
+        obj = CreateEstimator<RescalePerfEstimator>(buf, alloc_buf_size, "Rescale", pd,
+                                                    kernel.m_input, kernel.m_output, num_tiles,
+                                                    kPerfRescaleMacsPerElem, kPerfRescaleOpsPerElem);
+        break;
+    }
+    case kClipId: {
+        auto& kernel = static_cast<Clip&>(rt_kernel);
+        obj = CreateEstimator<ClipPerfEstimator>(buf, alloc_buf_size, "Clip", pd,
+                                                 kernel.m_input, kernel.m_output, num_tiles,
+                                                 0u, kPerfClipOpsPerElem);
+        break;
+    }
+    case kPreluId: {
+        auto& kernel = static_cast<Prelu&>(rt_kernel);
+        obj = CreateEstimator<PreluPerfEstimator>(buf, alloc_buf_size, "Prelu", pd,
+                                                  kernel.m_input, kernel.m_output, num_tiles,
+                                                  kPerfPreluMacsPerElem, kPerfPreluOpsPerElem);
+        break;
+    }
+    case kPermuteId: {
+        auto& kernel = static_cast<Permute&>(rt_kernel);
+        obj = CreateEstimator<PermutePerfEstimator>(buf, alloc_buf_size, "Permute", pd,
+                                                    kernel.m_metadata.m_input,
+                                                    kernel.m_metadata.m_output, num_tiles,
+                                                    0u, kPerfPermuteOpsPerElem);
+        break;
+    }
+    case kTableBuiltinId: {
+        auto& kernel = static_cast<TableBuiltin&>(rt_kernel);
+        obj = CreateEstimator<TableBuiltinPerfEstimator>(buf, alloc_buf_size, "TableBuiltin", pd,
+                                                         kernel.m_metadata.input,
+                                                         kernel.m_metadata.output, num_tiles,
+                                                         kPerfTableMacsPerElem, kPerfTableOpsPerElem);
+        break;
+    }
+    case kResizeBilinearId: {
+        // The cost is driven by the output: each output element blends four input elements
+        auto& kernel = static_cast<ResizeBilinear&>(rt_kernel);
+        obj = CreateEstimator<ResizeBilinearPerfEstimator>(buf, alloc_buf_size, "ResizeBilinear", pd,
+                                                           kernel.m_input, kernel.m_output, num_tiles,
+                                                           kPerfResizeMacsPerElem, kPerfResizeOpsPerElem,
+                                                           true);
+        break;
+    }
+    case kReduceMaxId: {
+        auto& kernel = static_cast<ReduceMax&>(rt_kernel);
+        obj = CreateEstimator<ReduceMaxPerfEstimator>(buf, alloc_buf_size, "ReduceMax", pd,
+                                                      kernel.m_input, kernel.m_output, num_tiles,
+                                                      kPerfReduceOpsPerElem);
+        break;
+    }
+    case kReduceSumId: {
+        auto& kernel = static_cast<ReduceSum&>(rt_kernel);
+        obj = CreateEstimator<ReduceSumPerfEstimator>(buf, alloc_buf_size, "ReduceSum", pd,
+                                                      kernel.m_input, kernel.m_output, num_tiles,
+                                                      kPerfReduceOpsPerElem);
+        break;
+    }
+    case kArgMaxId: {
+        auto& kernel = static_cast<ArgMax&>(rt_kernel);
+        obj = CreateEstimator<ArgMaxPerfEstimator>(buf, alloc_buf_size, "ArgMax", pd,
+                                                   kernel.m_input, kernel.m_output, num_tiles,
+                                                   kPerfArgMaxOpsPerElem);
+        break;
+    }
+    case kMoveId: {
+        auto& kernel = static_cast<Move&>(rt_kernel);
+        using MoveEstimator = MovePerfEstimator<InternalBuffer, kMoveRank, kMoveIterRank>;
+        obj = CreateEstimator<MoveEstimator>(buf, alloc_buf_size, "Move", pd,
+                                             kernel.m_src_it, kernel.m_dst_it, num_tiles);
+        break;
+    }
+    case kMoveBroadcastId: {
+        auto& kernel = static_cast<MoveBroadcast&>(rt_kernel);
+        obj = CreateEstimator<MoveBroadcastPerfEstimator>(buf, alloc_buf_size, "MoveBroadcast", pd,
+                                                          kernel.m_src, kernel.m_dst, num_tiles);
+        break;
+    }
+    default:
+        MLI_PRINTF("\nMLI_ERROR: No perf estimator for kernel id %d\n", rt_kernel.GetKernelId());
+        break;
     }
 
     return obj;
 }
-int PerfEstimator::KernelPerf_GetSize(lib_mli::ExecutionInterface& rt_kernel){
+
+int KernelPerfEstimatorFactory::GetSize(lib_mli::ExecutionInterface& rt_kernel) {
     uint32_t perf_kernel_size = 0;
-    kernel_id_t kernel_id = rt_kernel.GetKernelId();
-    switch (kernel_id) {
-      /*case kConv2dId:
-          perf_kernel_size = sizeof(Conv2dPerfEstimator);
-          break;
-      case kMoveId:
-          perf_kernel_size = sizeof(MovePerfEstimator);
-          break;
-      case kPreluId:
-          perf_kernel_size = sizeof(PreluPerfEstimator);
-          break;
-    }*/
+
+    switch (rt_kernel.GetKernelId()) {
+    case kConv2dId:
+        perf_kernel_size = sizeof(Conv2dPerfEstimator);
+        break;
+    case kDWConv2dId:
+        perf_kernel_size = sizeof(DepthwiseConv2dPerfEstimator);
+        break;
+    case kTransConv2DId:
+        perf_kernel_size = sizeof(TransposeConv2DPerfEstimator);
+        break;
+    case kFullyConnectedId:
+        perf_kernel_size = sizeof(FullyConnectedPerfEstimator);
+        break;
+    case kMatMulId:
+        perf_kernel_size = sizeof(MatMulPerfEstimator);
+        break;
+    case kMaxPool2DId:
+    case kSumPool2DId:
+        perf_kernel_size = sizeof(Pool2DPerfEstimator);
+        break;
+    case kAddId:
+    case kSubId:
+    case kMulId:
+    case kMaxId:
+    case kMinId:
+    case kEltwiseChainId:
+        perf_kernel_size = sizeof(EltwisePerfEstimator);
+        break;
+    case kRescaleId:
+        perf_kernel_size = sizeof(RescalePerfEstimator);
+        break;
+    case kClipId:
+        perf_kernel_size = sizeof(ClipPerfEstimator);
+        break;
+    case kPreluId:
+        perf_kernel_size = sizeof(PreluPerfEstimator);
+        break;
+    case kPermuteId:
+        perf_kernel_size = sizeof(PermutePerfEstimator);
+        break;
+    case kTableBuiltinId:
+        perf_kernel_size = sizeof(TableBuiltinPerfEstimator);
+        break;
+    case kResizeBilinearId:
+        perf_kernel_size = sizeof(ResizeBilinearPerfEstimator);
+        break;
+    case kReduceMaxId:
+        perf_kernel_size = sizeof(ReduceMaxPerfEstimator);
+        break;
+    case kReduceSumId:
+        perf_kernel_size = sizeof(ReduceSumPerfEstimator);
+        break;
+    case kArgMaxId:
+        perf_kernel_size = sizeof(ArgMaxPerfEstimator);
+        break;
+    case kMoveId:
+        perf_kernel_size = sizeof(MovePerfEstimator<InternalBuffer, kMoveRank, kMoveIterRank>);
+        break;
+    case kMoveBroadcastId:
+        perf_kernel_size = sizeof(MoveBroadcastPerfEstimator);
+        break;
+    default:
+        break;
+    }
+
     return perf_kernel_size;
 }
 
-}
\ No newline at end of file
+} // namespace ref
+
+} // namespace snps_arc::metaware::mli
@@ -0,0 +1,170 @@
+/*
+* Copyright 2022, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+
+#include <cstdarg>
+#include <cstdio>
+
+#include "mli_debug.h"
+#include "mli_profiler.hpp"
+
+namespace snps_arc::metaware::mli {
+
+//======================================================
+// Profiler
+//======================================================
+Profiler::Profiler(ProfileRecord* records, uint32_t max_records, ProfilerClock clock)
+    : m_records(records), m_max_records(max_records), m_clock(clock),
+      m_first(0), m_num_records(0), m_num_dropped(0), m_time(0) {
+    MLI_ASSERT(records != nullptr || max_records == 0);
+}
+
+uint64_t Profiler::GetTime() {
+    return m_clock != nullptr ? m_clock() : m_time++;
+}
+
+void Profiler::Record(const ProfileRecord& record) {
+    if (m_max_records == 0) {
+        m_num_dropped++;
+        return;
+    }
+    if (m_num_records < m_max_records) {
+        m_records[(m_first + m_num_records) % m_max_records] = record;
+        m_num_records++;
+    } else {
+        m_records[m_first] = record;
+        m_first = (m_first + 1) % m_max_records;
+        m_num_dropped++;
+    }
+}
+
+void Profiler::Reset() {
+    m_first = 0;
+    m_num_records = 0;
+    m_num_dropped = 0;
+}
+
+const ProfileRecord& Profiler::GetRecord(uint32_t idx) const {
+    MLI_ASSERT(idx < m_num_records);
+    return m_records[(m_first + idx) % m_max_records];
+}
+
+const char* Profiler::GetKernelName(kernel_id_t kernel_id) {
+    static const char* const kNames[] = {
+        "Invalid", "Nop", "Conv2d", "Prelu", "Move", "DepthwiseConv2d", "MaxPool2D",
+        "FullyConnected", "SumPool2D", "Add", "Sub", "Mul", "Max", "Min", "Rescale", "Clip",
+        "ReduceMax", "TransposeConv2D", "Permute", "ReduceSum", "ArgMax", "TableBuiltin",
+        "MatMul", "MoveBroadcast", "ResizeBilinear", "EltwiseChain"
+    };
+    static_assert(sizeof(kNames) / sizeof(kNames[0]) == kEltwiseChainId + 1,
+                  "Name is required for each kernel");
+    return kernel_id <= kEltwiseChainId ? kNames[kernel_id] : "Unknown";
+}
+
+// Append formatted text like snprintf does, pos is the length of the whole text so far
+static void TraceAppend(char* buffer, uint32_t size, uint32_t& pos, const char* fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    char* dst = pos < size ? buffer + pos : nullptr;
+    const int len = vsnprintf(dst, dst != nullptr ? size - pos : 0, fmt, args);
+    va_end(args);
+    if (len > 0) pos += (uint32_t)len;
+}
+
+// Timestamps of the trace are in microseconds with a fractional part
+static void TraceAppendTime(char* buffer, uint32_t size, uint32_t& pos, const char* name,
+                            uint64_t ticks, uint32_t ticks_per_us) {
+    const unsigned long long us = ticks / ticks_per_us;
+    const unsigned frac = (unsigned)((ticks % ticks_per_us) * 1000 / ticks_per_us);
+    TraceAppend(buffer, size, pos, "\"%s\":%llu.%03u", name, us, frac);
+}
+
+uint32_t Profiler::ExportChromeTrace(char* buffer, uint32_t size, uint32_t ticks_per_us) const {
+    static const char* const kCallNames[] = {"Prefetch", "Issue", "Update", "Layer"};
+    MLI_ASSERT(buffer != nullptr || size == 0);
+    MLI_ASSERT(ticks_per_us > 0);
+
+    uint32_t pos = 0;
+    TraceAppend(buffer, size, pos, "{\"traceEvents\":[");
+    for (uint32_t i = 0; i < m_num_records; i++) {
+        const ProfileRecord& rec = GetRecord(i);
+        TraceAppend(buffer, size, pos, "%s\n{\"name\":\"%s.%s\",\"cat\":\"mli\",\"ph\":\"X\",",
+                    i == 0 ? "" : ",", GetKernelName(rec.kernel_id), kCallNames[(int)rec.call]);
+        TraceAppendTime(buffer, size, pos, "ts", rec.start, ticks_per_us);
+        TraceAppend(buffer, size, pos, ",");
+        TraceAppendTime(buffer, size, pos, "dur", rec.end >= rec.start ? rec.end - rec.start : 0, ticks_per_us);
+        TraceAppend(buffer, size, pos, ",\"pid\":0,\"tid\":%u,\"args\":{\"layer\":%u,\"tile\":%u,"
+                    "\"read_bytes\":%u,\"write_bytes\":%u,\"macs\":%u,\"status\":%d}}",
+                    rec.layer, rec.layer, rec.tile, rec.read_bytes, rec.write_bytes, rec.macs,
+                    (int)rec.status);
+    }
+    TraceAppend(buffer, size, pos, "\n],\"otherData\":{\"dropped_records\":%u}}\n", m_num_dropped);
+
+    // truncated text is terminated by zero as well
+    if (size > 0 && pos >= size) buffer[size - 1] = '\0';
+    return pos;
+}
+
+//======================================================
+// ProfiledKernel
+//======================================================
+ProfiledKernel::ProfiledKernel(ExecutionInterface* kernel, Profiler* profiler, uint32_t layer,
+                               PerfEstimator* estimator)
+    : m_kernel(kernel), m_profiler(profiler), m_estimator(estimator),
+      m_kernel_id(kernel != nullptr ? kernel->GetKernelId() : kInvalidId),
+      m_layer(layer), m_tile(0) {
+    MLI_ASSERT(kernel != nullptr);
+    MLI_ASSERT(profiler != nullptr);
+}
+
+ProfileRecord ProfiledKernel::StartRecord(ProfileCall call) {
+    ProfileRecord record{};
+    record.kernel_id = m_kernel_id;
+    record.layer = m_layer;
+    record.tile = m_tile;
+    record.call = call;
+    record.start = m_profiler->GetTime();
+    return record;
+}
+
+mli_status ProfiledKernel::EndRecord(ProfileRecord& record, mli_status status) {
+    record.end = m_profiler->GetTime();
+    record.status = status;
+    m_profiler->Record(record);
+    return status;
+}
+
+mli_status ProfiledKernel::Prefetch() {
+    ProfileRecord record = StartRecord(ProfileCall::kPrefetch);
+    return EndRecord(record, m_kernel->Prefetch());
+}
+
+mli_status ProfiledKernel::Issue() {
+    ProfileRecord record = StartRecord(ProfileCall::kIssue);
+    const mli_status status = m_kernel->Issue();
+    record.end = m_profiler->GetTime();
+
+    // the estimator walks over tiles, so it's queried out of the measured interval
+    if (m_estimator != nullptr) {
+        record.read_bytes = (uint32_t)m_estimator->GetTileReadBytes((int)m_tile);
+        record.write_bytes = (uint32_t)m_estimator->GetTileWriteBytes((int)m_tile);
+        record.macs = (uint32_t)m_estimator->GetTileMacs((int)m_tile);
+    }
+    record.status = status;
+    m_profiler->Record(record);
+    return status;
+}
+
+mli_status ProfiledKernel::Update() {
+    ProfileRecord record = StartRecord(ProfileCall::kUpdate);
+    const mli_status status = EndRecord(record, m_kernel->Update());
+    m_tile++;
+    return status;
+}
+
+} // namespace snps_arc::metaware::mli
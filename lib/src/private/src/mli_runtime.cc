@@ -24,6 +24,7 @@ using ref::Sub;
 using ref::Mul;
 using ref::Max;
 using ref::Min;
+using ref::EltwiseChain;
 using ref::Move;
 using ref::Conv2d;
 using ref::DepthwiseConv2d;
@@ -38,6 +39,7 @@ using ref::MatMul;
 using ref::ReduceSum;
 using ref::Prelu;
 using ref::MoveBroadcast;
+using ref::ResizeBilinear;
 
 ExecutionInterface* ExecutionInterface::Create(
         void* allocation_memory_buffer,
@@ -127,6 +129,13 @@ ExecutionInterface* ExecutionInterface::Create(
                 MLI_PRINTF("\nMLI_ERROR: Insufficient space for [Min] runtime object\n");
             }
             break;
+        case kEltwiseChainId:
+            if(alloc_buf_size >= sizeof(EltwiseChain)) {
+                obj = new (allocation_memory_buffer) EltwiseChain(kernel_private_data_buffer, private_data_size, membases, num_mems);
+            } else {
+                MLI_PRINTF("\nMLI_ERROR: Insufficient space for [EltwiseChain] runtime object\n");
+            }
+            break;
         case kMoveId:
             if(alloc_buf_size >= sizeof(Move)) {
                 obj = new (allocation_memory_buffer) Move(kernel_private_data_buffer, private_data_size, membases, num_mems);
@@ -190,6 +199,13 @@ ExecutionInterface* ExecutionInterface::Create(
                 MLI_PRINTF("\nMLI_ERROR: Insufficient space for [ReduceSum] runtime object\n");
             }
             break;
+        case kResizeBilinearId:
+            if(alloc_buf_size >= sizeof(ResizeBilinear)) {
+                obj = new (allocation_memory_buffer) ResizeBilinear(kernel_private_data_buffer, private_data_size, membases, num_mems);
+            } else {
+                MLI_PRINTF("\nMLI_ERROR: Insufficient space for [ResizeBilinear] runtime object\n");
+            }
+            break;
         case kPermuteId:
             if(alloc_buf_size >= sizeof(Permute)) {
                 obj = new (allocation_memory_buffer) Permute(kernel_private_data_buffer, private_data_size, membases, num_mems);
@@ -197,6 +213,20 @@ ExecutionInterface* ExecutionInterface::Create(
                 MLI_PRINTF("\nMLI_ERROR: Insufficient space for [Permute] runtime object\n");
             }
             break;
+        case kArgMaxId:
+            if(alloc_buf_size >= sizeof(ArgMax)) {
+                obj = new (allocation_memory_buffer) ArgMax(kernel_private_data_buffer, private_data_size, membases, num_mems);
+            } else {
+                MLI_PRINTF("\nMLI_ERROR: Insufficient space for [ArgMax] runtime object\n");
+            }
+            break;
+        case kTableBuiltinId:
+            if(alloc_buf_size >= sizeof(TableBuiltin)) {
+                obj = new (allocation_memory_buffer) TableBuiltin(kernel_private_data_buffer, private_data_size, membases, num_mems);
+            } else {
+                MLI_PRINTF("\nMLI_ERROR: Insufficient space for [TableBuiltin] runtime object\n");
+            }
+            break;
         case kMatMulId:
             if(alloc_buf_size >= sizeof(MatMul)) {
               obj = new (allocation_memory_buffer) MatMul(kernel_private_data_buffer, private_data_size, membases, num_mems);
@@ -216,10 +246,30 @@ ExecutionInterface* ExecutionInterface::Create(
             break;
     }
 
+    if (obj != nullptr) {
+        obj->m_kernel_id = kernel_id;
+    }
+
     return obj;
 }
 
+kernel_id_t ExecutionInterface::GetKernelId() {
+    return m_kernel_id;
+}
+
+mli_status SynchronizationInterface::SignalEvent(int32_t mask) {
+    m_events |= mask;
+    return MLI_STATUS_OK;
+}
+
+mli_status SynchronizationInterface::ClearEvent(int32_t mask) {
+    m_events &= ~mask;
+    return MLI_STATUS_OK;
+}
+
 mli_status SynchronizationInterface::WaitEvent(int32_t mask) {
+    // Single core: nobody can signal the missing events while waiting
+    if ((m_events & mask) != mask) return MLI_STATUS_ARGUMENT_ERROR;
     return MLI_STATUS_OK;
 }
 
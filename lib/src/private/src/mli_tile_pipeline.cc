@@ -0,0 +1,177 @@
+/*
+* Copyright 2022, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+
+#include "mli_debug.h"
+#include "mli_math_macros.h"
+#include "mli_tile_pipeline.hpp"
+
+namespace snps_arc::metaware::mli {
+
+TilePipeline::TilePipeline(SynchronizationInterface* sync)
+    : m_sync(sync), m_num_inputs(0), m_num_outputs(0), m_has_compute(false),
+      m_compute_count(0), m_stats{0, 0, 0} {
+}
+
+uint32_t TilePipeline::PlanBuffers(const uint32_t* sizes, uint32_t num_buffers, uint32_t base,
+                                   uint32_t* offsets, uint32_t alignment) {
+    MLI_ASSERT(alignment > 0);
+    uint32_t offset = CEIL_RND(base, alignment);
+    for (uint32_t slot = 0; slot < kNumSlots; slot++) {
+        for (uint32_t i = 0; i < num_buffers; i++) {
+            offsets[slot * num_buffers + i] = offset;
+            offset += CEIL_RND(sizes[i], alignment);
+        }
+    }
+    return offset - base;
+}
+
+mli_status TilePipeline::AddStage(Stage* stages, uint32_t& num_stages, uint32_t max_stages,
+                                  const TilePipelineOp& desc) {
+    if (num_stages >= max_stages) return MLI_STATUS_NOT_ENGH_MEM;
+    // each slot needs its own object with its own tile buffers
+    if (desc.op[0] == nullptr || desc.op[1] == nullptr || desc.op[0] == desc.op[1]) {
+        return MLI_STATUS_BAD_FUNC_CFG;
+    }
+    for (uint32_t slot = 0; slot < kNumSlots; slot++) {
+        if ((desc.prefetch_event[slot] != 0 || desc.issue_event[slot] != 0) && m_sync == nullptr) {
+            return MLI_STATUS_BAD_FUNC_CFG;
+        }
+    }
+    stages[num_stages].desc = desc;
+    ResetStage(stages[num_stages]);
+    num_stages++;
+    return MLI_STATUS_OK;
+}
+
+mli_status TilePipeline::SetCompute(const TilePipelineOp& compute) {
+    uint32_t num_stages = 0;
+    const mli_status status = AddStage(&m_compute, num_stages, 1, compute);
+    m_has_compute = status == MLI_STATUS_OK;
+    return status;
+}
+
+mli_status TilePipeline::AddInput(const TilePipelineOp& move) {
+    return AddStage(m_inputs, m_num_inputs, kMaxInputs, move);
+}
+
+mli_status TilePipeline::AddOutput(const TilePipelineOp& move) {
+    return AddStage(m_outputs, m_num_outputs, kMaxOutputs, move);
+}
+
+void TilePipeline::ResetStage(Stage& stage) {
+    for (uint32_t slot = 0; slot < kNumSlots; slot++) {
+        stage.position[slot] = 0;
+        stage.issue_compute_count[slot] = 0;
+        stage.in_flight[slot] = false;
+    }
+}
+
+mli_status TilePipeline::WaitEvent(int32_t mask) {
+    if (mask == 0) return MLI_STATUS_OK;
+    const mli_status status = m_sync->WaitEvent(mask);
+    if (status != MLI_STATUS_OK) return status;
+    return m_sync->ClearEvent(mask);
+}
+
+mli_status TilePipeline::Start(Stage& stage, uint32_t tile, bool is_transfer) {
+    const uint32_t slot = tile % kNumSlots;
+    ExecutionInterface* op = stage.desc.op[slot];
+    MLI_ASSERT(!stage.in_flight[slot]);
+
+    // move iterators of the slot object over the tiles of the other slot
+    mli_status status = MLI_STATUS_OK;
+    for (; stage.position[slot] < tile && status == MLI_STATUS_OK; stage.position[slot]++) {
+        status = op->Update();
+    }
+    if (status == MLI_STATUS_OK) status = op->Prefetch();
+    if (status == MLI_STATUS_OK) status = WaitEvent(stage.desc.prefetch_event[slot]);
+    if (status == MLI_STATUS_OK) status = op->Issue();
+    if (status != MLI_STATUS_OK) return status;
+
+    stage.in_flight[slot] = true;
+    stage.issue_compute_count[slot] = m_compute_count;
+    if (is_transfer) {
+        m_stats.transfers++;
+    } else {
+        m_compute_count++;
+    }
+    return MLI_STATUS_OK;
+}
+
+mli_status TilePipeline::Wait(Stage& stage, uint32_t slot, bool is_transfer) {
+    if (!stage.in_flight[slot]) return MLI_STATUS_OK;
+    stage.in_flight[slot] = false;
+    const int32_t mask = stage.desc.issue_event[slot];
+    const mli_status status = WaitEvent(mask);
+    if (is_transfer && mask != 0 && m_compute_count > stage.issue_compute_count[slot]) {
+        m_stats.overlapped_transfers++;
+    }
+    return status;
+}
+
+mli_status TilePipeline::Run(uint32_t num_tiles) {
+    if (!m_has_compute) return MLI_STATUS_BAD_FUNC_CFG;
+
+    m_stats = {0, 0, 0};
+    m_compute_count = 0;
+    ResetStage(m_compute);
+    for (uint32_t i = 0; i < m_num_inputs; i++) ResetStage(m_inputs[i]);
+    for (uint32_t i = 0; i < m_num_outputs; i++) ResetStage(m_outputs[i]);
+
+    mli_status status = MLI_STATUS_OK;
+    for (uint32_t i = 0; i < m_num_inputs && num_tiles > 0 && status == MLI_STATUS_OK; i++) {
+        status = Start(m_inputs[i], 0, true);
+    }
+
+    for (uint32_t tile = 0; tile < num_tiles && status == MLI_STATUS_OK; tile++) {
+        const uint32_t slot = tile % kNumSlots;
+
+        // inputs of the current tile are ready, so the other slot can be filled
+        for (uint32_t i = 0; i < m_num_inputs && status == MLI_STATUS_OK; i++) {
+            status = Wait(m_inputs[i], slot, true);
+        }
+        for (uint32_t i = 0; i < m_num_inputs && tile + 1 < num_tiles && status == MLI_STATUS_OK; i++) {
+            status = Start(m_inputs[i], tile + 1, true);
+        }
+
+        // output buffers of the slot are free when the tile two steps back is moved out
+        for (uint32_t i = 0; i < m_num_outputs && status == MLI_STATUS_OK; i++) {
+            status = Wait(m_outputs[i], slot, true);
+        }
+        if (status == MLI_STATUS_OK) status = Start(m_compute, tile, false);
+        if (status == MLI_STATUS_OK) status = Wait(m_compute, slot, false);
+        if (status == MLI_STATUS_OK) m_stats.tiles++;
+
+        for (uint32_t i = 0; i < m_num_outputs && status == MLI_STATUS_OK; i++) {
+            status = Start(m_outputs[i], tile, true);
+        }
+    }
+
+    // drain all started jobs, so buffers can be reused by the caller
+    for (uint32_t slot = 0; slot < kNumSlots; slot++) {
+        mli_status wait_status = Wait(m_compute, slot, false);
+        for (uint32_t i = 0; i < m_num_inputs; i++) {
+            const mli_status in_status = Wait(m_inputs[i], slot, true);
+            if (wait_status == MLI_STATUS_OK) wait_status = in_status;
+        }
+        for (uint32_t i = 0; i < m_num_outputs; i++) {
+            const mli_status out_status = Wait(m_outputs[i], slot, true);
+            if (wait_status == MLI_STATUS_OK) wait_status = out_status;
+        }
+        if (status == MLI_STATUS_OK) status = wait_status;
+    }
+    return status;
+}
+
+uint32_t TilePipeline::GetOverlapPercent() const {
+    if (m_stats.transfers == 0) return 0;
+    return (uint32_t)(((uint64_t)m_stats.overlapped_transfers * 100) / m_stats.transfers);
+}
+
+} // namespace snps_arc::metaware::mli
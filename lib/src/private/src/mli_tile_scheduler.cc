@@ -0,0 +1,106 @@
+/*
+* Copyright 2022, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+
+#include "mli_debug.h"
+#include "mli_math_macros.h"
+#include "mli_tile_scheduler.hpp"
+
+namespace snps_arc::metaware::mli {
+
+TileScheduler::TileScheduler(const PlatformDescription& pd, SynchronizationInterface* sync)
+    : m_sync(sync), m_worker_id(pd.GetProcessorId()),
+      m_num_workers(pd.GetNumProcessors()), m_barrier_count(0) {
+    MLI_ASSERT(m_num_workers > 0 && m_num_workers <= kMaxWorkers);
+    MLI_ASSERT(m_worker_id < m_num_workers);
+    MLI_ASSERT(sync != nullptr || m_num_workers == 1);
+}
+
+TileRange TileScheduler::GetTileRange(uint32_t total_tiles, uint32_t num_workers, uint32_t worker_id) {
+    MLI_ASSERT(num_workers > 0 && worker_id < num_workers);
+    const uint32_t base = total_tiles / num_workers;
+    const uint32_t rest = total_tiles % num_workers;
+    TileRange range;
+    range.first = worker_id * base + MIN(worker_id, rest);
+    range.count = base + (worker_id < rest ? 1 : 0);
+    return range;
+}
+
+TileRange TileScheduler::GetTileRange(uint32_t total_tiles) const {
+    return GetTileRange(total_tiles, m_num_workers, m_worker_id);
+}
+
+mli_status TileScheduler::Seek(ExecutionInterface& op, uint32_t total_tiles) const {
+    const TileRange range = GetTileRange(total_tiles);
+    for (uint32_t tile = 0; tile < range.first; tile++) {
+        mli_status status = op.Update();
+        if (status != MLI_STATUS_OK) return status;
+    }
+    return MLI_STATUS_OK;
+}
+
+mli_status TileScheduler::RunTiles(ExecutionInterface& op, TileRange range,
+                                   TileCallback before_issue, TileCallback after_issue, void* ctx) {
+    for (uint32_t tile = range.first; tile < range.first + range.count; tile++) {
+        mli_status status = op.Prefetch();
+        if (status != MLI_STATUS_OK) return status;
+        if (before_issue != nullptr) {
+            status = before_issue(op, tile, ctx);
+            if (status != MLI_STATUS_OK) return status;
+        }
+        status = op.Issue();
+        if (status != MLI_STATUS_OK) return status;
+        if (after_issue != nullptr) {
+            status = after_issue(op, tile, ctx);
+            if (status != MLI_STATUS_OK) return status;
+        }
+        status = op.Update();
+        if (status != MLI_STATUS_OK) return status;
+    }
+    return MLI_STATUS_OK;
+}
+
+mli_status TileScheduler::Run(ExecutionInterface& op, uint32_t total_tiles,
+                              TileCallback before_issue, TileCallback after_issue, void* ctx) {
+    mli_status status = Seek(op, total_tiles);
+    if (status == MLI_STATUS_OK) {
+        status = RunTiles(op, GetTileRange(total_tiles), before_issue, after_issue, ctx);
+    }
+    const mli_status barrier_status = Barrier();
+    return (status != MLI_STATUS_OK) ? status : barrier_status;
+}
+
+mli_status TileScheduler::Barrier() {
+    if (m_num_workers == 1) return MLI_STATUS_OK;
+
+    const uint32_t bank = m_barrier_count % kNumEventBanks;
+    const uint32_t prev_bank = (m_barrier_count + kNumEventBanks - 1) % kNumEventBanks;
+    const int32_t own_event = (int32_t)(1u << (bank * kMaxWorkers + m_worker_id));
+    const int32_t all_events = (int32_t)(((1u << m_num_workers) - 1) << (bank * kMaxWorkers));
+    m_barrier_count++;
+
+    mli_status status = m_sync->SignalEvent(own_event);
+    if (status != MLI_STATUS_OK) return status;
+    status = m_sync->WaitEvent(all_events);
+    if (status != MLI_STATUS_OK) return status;
+    // All workers have passed the previous barrier, so its bank can be reused
+    return m_sync->ClearEvent((int32_t)(1u << (prev_bank * kMaxWorkers + m_worker_id)));
+}
+
+mli_status TileScheduler::Finish() {
+    // Own bit of the last barrier can't be cleared here: other workers may still wait for it.
+    // Instead the last barrier is moved to the bank preceding bank 0, where a scheduler
+    // starting with m_barrier_count == 0 expects it.
+    while (m_barrier_count % kNumEventBanks != 0) {
+        const mli_status status = Barrier();
+        if (status != MLI_STATUS_OK) return status;
+    }
+    return MLI_STATUS_OK;
+}
+
+} // namespace snps_arc::metaware::mli
@@ -0,0 +1,403 @@
+/*
+* Copyright 2022, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+
+#include "mli_debug.h"
+#include "mli_math_macros.h"
+#include "mli_ref_perf_estim.hpp"
+#include "mli_service_functions.hpp"
+#include "mli_tiler.hpp"
+
+namespace snps_arc::metaware::mli {
+
+namespace {
+
+constexpr int32_t kTilerIterOrder[kTilerRank] = {0, 1, 2, 3, 4};
+
+// Number of tile sizes along one dimension: first, middle and last tiles
+constexpr uint32_t kTileClasses = 3;
+
+struct DimTiles {
+    uint32_t size[kTileClasses];
+    uint32_t num[kTileClasses];
+};
+
+DimTiles GetDimTiles(const IteratorCfg<kTilerRank>& cfg, uint32_t dim) {
+    const uint32_t count = (uint32_t)cfg.get_count(dim);
+    DimTiles tiles;
+    tiles.size[0] = cfg.get_first_size(dim);
+    tiles.size[1] = cfg.get_size(dim);
+    tiles.size[2] = cfg.get_last_size(dim);
+    tiles.num[0] = 1;
+    tiles.num[1] = count > 2 ? count - 2 : 0;
+    tiles.num[2] = count > 1 ? 1 : 0;
+    return tiles;
+}
+
+// Size of the tile buffer along one dimension. It's enough for any tile of the dimension
+// like buffers sized with IteratorCfg sizes of the first and middle tiles.
+uint32_t GetMaxSize(const DimTiles& tiles) {
+    if (tiles.num[2] == 0) return tiles.size[0];
+    return MAX(MAX(tiles.size[0], tiles.size[1]), tiles.size[2]);
+}
+
+int64_t GetSumSize(const DimTiles& tiles) {
+    int64_t size = 0;
+    for (uint32_t i = 0; i < kTileClasses; i++) {
+        size += (int64_t)tiles.size[i] * tiles.num[i];
+    }
+    return size;
+}
+
+// Number of elements of an operand fetched by all tiles. The operand depends on some of
+// the dimensions and its tile is fetched again only if it differs from the tile of the
+// previous iteration: dimensions below the innermost changing one don't cause re-fetch.
+// Along other dimensions the operand tile has the same (first) size in all tiles.
+int64_t GetFetchedElems(const DimTiles tiles[kTilerRank], const uint32_t count[kTilerRank],
+                        const bool depends[kTilerRank]) {
+    uint32_t first_changing = kTilerRank;
+    for (uint32_t dim = 0; dim < kTilerRank; dim++) {
+        if (depends[dim] && count[dim] > 1) {
+            first_changing = dim;
+            break;
+        }
+    }
+    int64_t elems = 1;
+    for (uint32_t dim = 0; dim < kTilerRank; dim++) {
+        if (depends[dim]) {
+            elems *= GetSumSize(tiles[dim]);
+        } else {
+            elems *= tiles[dim].size[0];
+            if (dim > first_changing) elems *= count[dim];
+        }
+    }
+    return elems;
+}
+
+void InitProblem(TilerProblem& problem) {
+    for (uint32_t dim = 0; dim < kTilerRank; dim++) {
+        problem.in_shape[dim] = 1;
+        problem.out_shape[dim] = 1;
+        problem.effective_kernel_size[dim] = 1;
+        problem.stride[dim] = 1;
+        problem.pre_padding[dim] = 0;
+    }
+    for (uint32_t i = 0; i < TilerProblem::kNumBuffers; i++) {
+        problem.elem_size[i] = 0;
+        problem.mem_idx[i] = 0;
+    }
+    problem.num_inputs = 1;
+    problem.weights_per_channel = 0;
+    problem.ops_per_out_elem = 1;
+    problem.ops_are_macs = false;
+    problem.num_slots = 1;
+}
+
+uint32_t GetOutSize(uint32_t in_size, uint32_t effective_kernel_size, uint32_t stride,
+                    uint32_t pad_begin, uint32_t pad_end) {
+    MLI_ASSERT(stride > 0 && in_size + pad_begin + pad_end >= effective_kernel_size);
+    return (in_size + pad_begin + pad_end - effective_kernel_size) / stride + 1;
+}
+
+// Spatial part of conv-like kernels: H and W of both tensors, window, stride and padding
+void SetSpatialParams(TilerProblem& problem, const uint32_t in_hw[2], const uint32_t kernel_hw[2],
+                      const uint32_t dilation[2], const uint32_t stride[2],
+                      const uint32_t padding_begin[2], const uint32_t padding_end[2]) {
+    const uint32_t dims[2] = {kGroupTensorHeightDim, kGroupTensorWidthDim};
+    for (uint32_t i = 0; i < 2; i++) {
+        const uint32_t dim = dims[i];
+        problem.in_shape[dim] = in_hw[i];
+        problem.effective_kernel_size[dim] = service::get_effective_kernel_size(kernel_hw[i], dilation[i]);
+        problem.stride[dim] = stride[i];
+        problem.pre_padding[dim] = padding_begin[i];
+        problem.out_shape[dim] = GetOutSize(in_hw[i], problem.effective_kernel_size[dim], stride[i],
+                                            padding_begin[i], padding_end[i]);
+    }
+}
+
+} // namespace
+
+//======================================================
+//
+// TilerProblem
+//
+//======================================================
+TilerProblem TilerProblem::Conv2d(const uint32_t in_shape[kConvIORank],
+                                  const uint32_t weights_shape[kConvWRank],
+                                  const Conv2DConfig& cfg,
+                                  uint32_t in_elem_size, uint32_t weights_elem_size,
+                                  uint32_t out_elem_size) {
+    MLI_ASSERT(in_shape[kGroupTensorGroupDim] == weights_shape[kKernelGroupDim]);
+    MLI_ASSERT(in_shape[kGroupTensorChannelDim] == weights_shape[kKernelChannelInDim]);
+    TilerProblem problem;
+    InitProblem(problem);
+    const uint32_t in_hw[2] = {in_shape[kGroupTensorHeightDim], in_shape[kGroupTensorWidthDim]};
+    const uint32_t kernel_hw[2] = {weights_shape[kKernelHeightDim], weights_shape[kKernelWidthDim]};
+    SetSpatialParams(problem, in_hw, kernel_hw, cfg.dilation, cfg.stride, cfg.padding_begin, cfg.padding_end);
+
+    problem.in_shape[kGroupTensorBatchDim] = problem.out_shape[kGroupTensorBatchDim] = in_shape[kGroupTensorBatchDim];
+    problem.in_shape[kGroupTensorGroupDim] = problem.out_shape[kGroupTensorGroupDim] = in_shape[kGroupTensorGroupDim];
+    problem.in_shape[kGroupTensorChannelDim] = in_shape[kGroupTensorChannelDim];
+    problem.out_shape[kGroupTensorChannelDim] = weights_shape[kKernelChannelOutDim];
+    // each output channel needs all input channels of its group
+    problem.effective_kernel_size[kGroupTensorChannelDim] = in_shape[kGroupTensorChannelDim];
+    problem.stride[kGroupTensorChannelDim] = 0;
+
+    problem.weights_per_channel = weights_shape[kKernelHeightDim] * weights_shape[kKernelWidthDim] *
+                                  weights_shape[kKernelChannelInDim];
+    problem.ops_per_out_elem = problem.weights_per_channel;
+    problem.ops_are_macs = true;
+    problem.elem_size[kInput] = in_elem_size;
+    problem.elem_size[kWeights] = weights_elem_size;
+    problem.elem_size[kOutput] = out_elem_size;
+    return problem;
+}
+
+TilerProblem TilerProblem::DepthwiseConv2d(const uint32_t in_shape[kDepthwiseIORank],
+                                           const uint32_t weights_shape[kDepthwiseWRank],
+                                           const DwConv2DConfig& cfg,
+                                           uint32_t in_elem_size, uint32_t weights_elem_size,
+                                           uint32_t out_elem_size) {
+    MLI_ASSERT(in_shape[kGroupTensorChannelDim] == weights_shape[kKernelDWChannelInDim]);
+    TilerProblem problem;
+    InitProblem(problem);
+    const uint32_t in_hw[2] = {in_shape[kGroupTensorHeightDim], in_shape[kGroupTensorWidthDim]};
+    const uint32_t kernel_hw[2] = {weights_shape[kKernelDWHeightDim], weights_shape[kKernelDWWidthDim]};
+    SetSpatialParams(problem, in_hw, kernel_hw, cfg.dilation, cfg.stride, cfg.padding_begin, cfg.padding_end);
+
+    const uint32_t dims[3] = {kGroupTensorBatchDim, kGroupTensorGroupDim, kGroupTensorChannelDim};
+    for (uint32_t i = 0; i < 3; i++) {
+        problem.in_shape[dims[i]] = problem.out_shape[dims[i]] = in_shape[dims[i]];
+    }
+    problem.weights_per_channel = weights_shape[kKernelDWHeightDim] * weights_shape[kKernelDWWidthDim];
+    problem.ops_per_out_elem = problem.weights_per_channel;
+    problem.ops_are_macs = true;
+    problem.elem_size[kInput] = in_elem_size;
+    problem.elem_size[kWeights] = weights_elem_size;
+    problem.elem_size[kOutput] = out_elem_size;
+    return problem;
+}
+
+TilerProblem TilerProblem::Pool2D(const uint32_t in_shape[kPoolRank], const PoolOpConfig& cfg,
+                                  uint32_t elem_size) {
+    TilerProblem problem;
+    InitProblem(problem);
+    const uint32_t in_hw[2] = {in_shape[kTensorHeightDim], in_shape[kTensorWidthDim]};
+    const uint32_t dilation[2] = {1, 1};
+    SetSpatialParams(problem, in_hw, cfg.kernel_size, dilation, cfg.stride, cfg.padding_begin, cfg.padding_end);
+
+    problem.in_shape[kGroupTensorBatchDim] = problem.out_shape[kGroupTensorBatchDim] = in_shape[kTensorBatchDim];
+    problem.in_shape[kGroupTensorChannelDim] = problem.out_shape[kGroupTensorChannelDim] = in_shape[kTensorChannelDim];
+    problem.ops_per_out_elem = cfg.kernel_size[0] * cfg.kernel_size[1];
+    problem.elem_size[kInput] = elem_size;
+    problem.elem_size[kOutput] = elem_size;
+    return problem;
+}
+
+TilerProblem TilerProblem::Eltwise(const uint32_t shape[kEltwiseRank], uint32_t in_elem_size,
+                                   uint32_t out_elem_size) {
+    TilerProblem problem;
+    InitProblem(problem);
+    const uint32_t dims[kEltwiseRank] = {kGroupTensorBatchDim, kGroupTensorHeightDim,
+                                         kGroupTensorWidthDim, kGroupTensorChannelDim};
+    for (uint32_t i = 0; i < kEltwiseRank; i++) {
+        problem.in_shape[dims[i]] = problem.out_shape[dims[i]] = shape[i];
+    }
+    problem.num_inputs = 2;
+    problem.elem_size[kInput] = in_elem_size;
+    problem.elem_size[kOutput] = out_elem_size;
+    return problem;
+}
+
+//======================================================
+//
+// Tiler
+//
+//======================================================
+Tiler::Tiler(const PlatformDescription& pd, const TilerProblem& problem)
+    : m_pd(pd), m_problem(problem) {
+    MLI_ASSERT(problem.num_slots == 1 || problem.num_slots == 2);
+    for (uint32_t i = 0; i < TilerProblem::kNumBuffers; i++) {
+        MLI_ASSERT(problem.mem_idx[i] < PlatformDescription::kMaxMemories);
+    }
+}
+
+mli_status Tiler::Evaluate(const uint32_t tile_size[kTilerRank], TilerCandidate& candidate) const {
+    const TilerProblem& p = m_problem;
+    candidate = TilerCandidate();
+    candidate.num_tiles = 1;
+    for (uint32_t dim = 0; dim < kTilerRank; dim++) {
+        candidate.tile_size[dim] = tile_size[dim];
+        // IteratorCfg requires the first tile to cover the pre-padding and to contain input data
+        if (tile_size[dim] == 0 || tile_size[dim] > p.out_shape[dim] ||
+            tile_size[dim] * p.stride[dim] < p.pre_padding[dim] ||
+            (tile_size[dim] - 1) * p.stride[dim] + p.effective_kernel_size[dim] <= p.pre_padding[dim]) {
+            return MLI_STATUS_BAD_FUNC_CFG;
+        }
+    }
+
+    const IteratorCfg<kTilerRank> out_cfg = GetOutputIteratorCfg(candidate);
+    const IteratorCfg<kTilerRank> in_cfg = GetInputIteratorCfg(candidate);
+    DimTiles out_tiles[kTilerRank];
+    DimTiles in_tiles[kTilerRank];
+    uint32_t count[kTilerRank];
+    for (uint32_t dim = 0; dim < kTilerRank; dim++) {
+        out_tiles[dim] = GetDimTiles(out_cfg, dim);
+        in_tiles[dim] = GetDimTiles(in_cfg, dim);
+        count[dim] = (uint32_t)out_cfg.get_count(dim);
+        candidate.num_tiles *= count[dim];
+        // the last tile must not be completely inside the end padding
+        for (uint32_t i = 0; i < kTileClasses; i++) {
+            if (in_tiles[dim].num[i] > 0 &&
+                (in_tiles[dim].size[i] == 0 || in_tiles[dim].size[i] > p.in_shape[dim])) {
+                return MLI_STATUS_BAD_FUNC_CFG;
+            }
+        }
+    }
+
+    // Buffers of a single slot
+    int64_t elems[TilerProblem::kNumBuffers] = {p.num_inputs, p.weights_per_channel, 1};
+    for (uint32_t dim = 0; dim < kTilerRank; dim++) {
+        elems[TilerProblem::kInput] *= GetMaxSize(in_tiles[dim]);
+        elems[TilerProblem::kOutput] *= GetMaxSize(out_tiles[dim]);
+    }
+    elems[TilerProblem::kWeights] *= (int64_t)GetMaxSize(out_tiles[kGroupTensorGroupDim]) *
+                                     GetMaxSize(out_tiles[kGroupTensorChannelDim]);
+    bool fits = true;
+    for (uint32_t i = 0; i < TilerProblem::kNumBuffers; i++) {
+        const int64_t size = CEIL_RND(elems[i] * p.elem_size[i], (int64_t)kMliAlignment);
+        const int64_t usage = candidate.mem_usage[p.mem_idx[i]] + size * p.num_slots;
+        if (usage > (int64_t)m_pd.GetMemorySize(p.mem_idx[i])) {
+            fits = false;
+        }
+        candidate.buffer_size[i] = (uint32_t)MIN(size, (int64_t)UINT32_MAX);
+        candidate.mem_usage[p.mem_idx[i]] = (uint32_t)MIN(usage, (int64_t)UINT32_MAX);
+    }
+
+    // Traffic
+    DimTiles weights_tiles[kTilerRank];
+    bool in_depends[kTilerRank];
+    bool weights_depends[kTilerRank];
+    bool out_depends[kTilerRank];
+    for (uint32_t dim = 0; dim < kTilerRank; dim++) {
+        in_depends[dim] = p.stride[dim] != 0;
+        weights_depends[dim] = dim == kGroupTensorGroupDim || dim == kGroupTensorChannelDim;
+        out_depends[dim] = true;
+        weights_tiles[dim] = out_tiles[dim];
+        if (!weights_depends[dim]) weights_tiles[dim].size[0] = 1;
+    }
+    candidate.read_bytes = GetFetchedElems(in_tiles, count, in_depends) * p.num_inputs *
+                           p.elem_size[TilerProblem::kInput];
+    if (p.weights_per_channel > 0) {
+        candidate.read_bytes += GetFetchedElems(weights_tiles, count, weights_depends) *
+                                p.weights_per_channel * p.elem_size[TilerProblem::kWeights];
+    }
+    candidate.write_bytes = GetFetchedElems(out_tiles, count, out_depends) * p.elem_size[TilerProblem::kOutput];
+
+    // Cycles: compute of each combination of first/middle/last tiles along all dimensions
+    int64_t compute_cycles = 0;
+    uint32_t num_combinations = 1;
+    for (uint32_t dim = 0; dim < kTilerRank; dim++) num_combinations *= kTileClasses;
+    for (uint32_t comb = 0; comb < num_combinations; comb++) {
+        int64_t num = 1;
+        int64_t out_elems = 1;
+        for (uint32_t dim = 0, rest = comb; dim < kTilerRank; dim++, rest /= kTileClasses) {
+            const uint32_t i = rest % kTileClasses;
+            num *= out_tiles[dim].num[i];
+            out_elems *= out_tiles[dim].size[i];
+        }
+        if (num == 0) continue;
+        const int64_t ops = out_elems * p.ops_per_out_elem;
+        const uint32_t elem_size = p.elem_size[TilerProblem::kInput];
+        compute_cycles += num * (p.ops_are_macs ? ref::GetPerfMacCycles(m_pd, ops, elem_size)
+                                                : ref::GetPerfElemCycles(m_pd, ops, elem_size));
+    }
+    const int64_t mem_cycles = ref::GetPerfMemCycles(m_pd, candidate.read_bytes + candidate.write_bytes);
+    candidate.cycles = (p.num_slots > 1 ? MAX(compute_cycles, mem_cycles) : compute_cycles + mem_cycles) +
+                       candidate.num_tiles * ref::GetPerfTileOverheadCycles(m_pd);
+
+    return fits ? MLI_STATUS_OK : MLI_STATUS_NOT_ENGH_MEM;
+}
+
+void Tiler::SearchDim(uint32_t dim, uint32_t tile_size[kTilerRank], TilerCandidate* candidates,
+                      uint32_t max_candidates, uint32_t& num_candidates) const {
+    if (dim == kTilerRank) {
+        TilerCandidate candidate;
+        if (Evaluate(tile_size, candidate) != MLI_STATUS_OK) return;
+        if (num_candidates == max_candidates && !IsBetter(candidate, candidates[num_candidates - 1])) return;
+
+        uint32_t pos = MIN(num_candidates, max_candidates - 1);
+        for (; pos > 0 && IsBetter(candidate, candidates[pos - 1]); pos--) {
+            candidates[pos] = candidates[pos - 1];
+        }
+        candidates[pos] = candidate;
+        num_candidates = MIN(num_candidates + 1, max_candidates);
+        return;
+    }
+
+    // The smallest tile size for each number of tiles, from the whole dimension down
+    const uint32_t size = m_problem.out_shape[dim];
+    uint32_t prev_tile = 0;
+    for (uint32_t num_tiles = 1; num_tiles <= size; num_tiles++) {
+        const uint32_t tile = CEIL_DIV(size, num_tiles);
+        if (tile == prev_tile) continue;
+        prev_tile = tile;
+        // smaller tiles can't cover the pre-padding either
+        if (tile * m_problem.stride[dim] < m_problem.pre_padding[dim]) break;
+        tile_size[dim] = tile;
+        SearchDim(dim + 1, tile_size, candidates, max_candidates, num_candidates);
+    }
+}
+
+uint32_t Tiler::Search(TilerCandidate* candidates, uint32_t max_candidates) const {
+    MLI_ASSERT(candidates != nullptr);
+    uint32_t num_candidates = 0;
+    if (max_candidates == 0) return num_candidates;
+    uint32_t tile_size[kTilerRank];
+    SearchDim(0, tile_size, candidates, max_candidates, num_candidates);
+    return num_candidates;
+}
+
+mli_status Tiler::GetBest(TilerCandidate& candidate) const {
+    return Search(&candidate, 1) > 0 ? MLI_STATUS_OK : MLI_STATUS_NOT_ENGH_MEM;
+}
+
+IteratorCfg<kTilerRank> Tiler::GetOutputIteratorCfg(const TilerCandidate& candidate) const {
+    uint32_t shape[kTilerRank];
+    for (uint32_t dim = 0; dim < kTilerRank; dim++) shape[dim] = m_problem.out_shape[dim];
+    const Tensor<NoBuffer, kTilerRank> out_tensor(shape);
+    return IteratorCfg<kTilerRank>(out_tensor, candidate.tile_size, kTilerIterOrder);
+}
+
+IteratorCfg<kTilerRank> Tiler::GetInputIteratorCfg(const TilerCandidate& candidate) const {
+    uint32_t shape[kTilerRank];
+    for (uint32_t dim = 0; dim < kTilerRank; dim++) shape[dim] = m_problem.in_shape[dim];
+    const Tensor<NoBuffer, kTilerRank> in_tensor(shape);
+    return IteratorCfg<kTilerRank>(GetOutputIteratorCfg(candidate), in_tensor,
+                                   m_problem.effective_kernel_size, m_problem.stride,
+                                   m_problem.pre_padding);
+}
+
+void Tiler::GetTileSize(const TilerCandidate& candidate, uint32_t rank, uint32_t* tile_size) {
+    MLI_ASSERT(rank == kTilerRank || rank == kTilerRank - 1);
+    MLI_ASSERT(rank == kTilerRank || candidate.tile_size[kGroupTensorGroupDim] == 1);
+    for (uint32_t dim = 0, out_dim = 0; dim < kTilerRank; dim++) {
+        if (rank < kTilerRank && dim == kGroupTensorGroupDim) continue;
+        tile_size[out_dim++] = candidate.tile_size[dim];
+    }
+}
+
+bool Tiler::IsBetter(const TilerCandidate& a, const TilerCandidate& b) {
+    if (a.cycles != b.cycles) return a.cycles < b.cycles;
+    const int64_t a_traffic = a.read_bytes + a.write_bytes;
+    const int64_t b_traffic = b.read_bytes + b.write_bytes;
+    if (a_traffic != b_traffic) return a_traffic < b_traffic;
+    return a.num_tiles < b.num_tiles;
+}
+
+} // namespace snps_arc::metaware::mli
@@ -0,0 +1,172 @@
+/*
+* Copyright 2022, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+
+#include <cstring>
+
+#include "mli_debug.h"
+#include "mli_math_macros.h"
+#include "mli_ref_weights_codec.hpp"
+
+namespace snps_arc::metaware::mli::ref {
+
+//======================================================
+// Block-sparse bitmap stream
+//======================================================
+static uint32_t GetSparseBitmapSize(uint32_t num_elems) {
+  const uint32_t num_blocks = CEIL_DIV(num_elems, kWeightsSparseBlockSize);
+  return CEIL_DIV(num_blocks, 8);
+}
+
+static uint32_t EncodeSparseStream(const int8_t* src, uint32_t num_elems, uint8_t* dst) {
+  // src may be located inside dst after the bitmap, so non-zero blocks are moved
+  // down with memmove and each block is read before anything is written over it.
+  const uint32_t bitmap_size = GetSparseBitmapSize(num_elems);
+  uint8_t* bitmap = dst;
+  uint32_t out = bitmap_size;
+  for (uint32_t i = 0; i < bitmap_size; i++) bitmap[i] = 0;
+
+  for (uint32_t blk = 0, start = 0; start < num_elems; blk++, start += kWeightsSparseBlockSize) {
+    const uint32_t len = MIN(kWeightsSparseBlockSize, num_elems - start);
+    bool nonzero = false;
+    for (uint32_t i = 0; i < len && !nonzero; i++) nonzero = src[start + i] != 0;
+    if (!nonzero) continue;
+    bitmap[blk / 8] |= (uint8_t)(1u << (blk % 8));
+    memmove(dst + out, src + start, len);
+    out += len;
+  }
+  return out;
+}
+
+static mli_status DecodeSparseStream(const uint8_t* src, uint32_t src_size, int8_t* dst, uint32_t num_elems) {
+  const uint32_t bitmap_size = GetSparseBitmapSize(num_elems);
+  if (src_size < bitmap_size) return MLI_STATUS_ARGUMENT_ERROR;
+  const uint8_t* bitmap = src;
+  uint32_t in = bitmap_size;
+
+  for (uint32_t blk = 0, start = 0; start < num_elems; blk++, start += kWeightsSparseBlockSize) {
+    const uint32_t len = MIN(kWeightsSparseBlockSize, num_elems - start);
+    if (bitmap[blk / 8] & (1u << (blk % 8))) {
+      if (in + len > src_size) return MLI_STATUS_ARGUMENT_ERROR;
+      memcpy(dst + start, src + in, len);
+      in += len;
+    } else {
+      memset(dst + start, 0, len);
+    }
+  }
+  return MLI_STATUS_OK;
+}
+
+//======================================================
+// Zero run-length stream
+//======================================================
+static uint32_t EncodeRleStream(const int8_t* src, uint32_t num_elems, uint8_t* dst) {
+  // Zero runs are encoded only if they are at least 2 elements long, so each literal token
+  // is paid back by the following zero run and the output never overtakes the input.
+  // This allows src to be located inside dst (see GetWeightsStreamBound()).
+  uint32_t out = 0;
+  uint32_t i = 0;
+  while (i < num_elems) {
+    uint32_t zeros = 0;
+    while (i + zeros < num_elems && zeros < kWeightsRleMaxRun && src[i + zeros] == 0) zeros++;
+    if (zeros >= 2) {
+      dst[out++] = (uint8_t)(kWeightsRleZeroFlag | (zeros - 1));
+      i += zeros;
+      continue;
+    }
+
+    uint32_t len = 0;
+    while (i + len < num_elems && len < kWeightsRleMaxRun) {
+      const uint32_t j = i + len;
+      if (src[j] == 0 && j + 1 < num_elems && src[j + 1] == 0) break;
+      len++;
+    }
+    dst[out++] = (uint8_t)(len - 1);
+    for (uint32_t k = 0; k < len; k++) dst[out++] = (uint8_t)src[i + k];
+    i += len;
+  }
+  return out;
+}
+
+static mli_status DecodeRleStream(const uint8_t* src, uint32_t src_size, int8_t* dst, uint32_t num_elems) {
+  uint32_t in = 0;
+  uint32_t out = 0;
+  while (out < num_elems) {
+    if (in >= src_size) return MLI_STATUS_ARGUMENT_ERROR;
+    const uint8_t token = src[in++];
+    const uint32_t len = (uint32_t)(token & ~kWeightsRleZeroFlag) + 1;
+    if (out + len > num_elems) return MLI_STATUS_ARGUMENT_ERROR;
+    if (token & kWeightsRleZeroFlag) {
+      memset(dst + out, 0, len);
+    } else {
+      if (in + len > src_size) return MLI_STATUS_ARGUMENT_ERROR;
+      memcpy(dst + out, src + in, len);
+      in += len;
+    }
+    out += len;
+  }
+  return MLI_STATUS_OK;
+}
+
+//======================================================
+// Common interface
+//======================================================
+uint32_t GetWeightsStreamBound(compression_mode_t mode, uint32_t num_elems) {
+  switch (mode) {
+    case compression_mode_t::Sparse:
+      return GetSparseBitmapSize(num_elems) + num_elems;
+    case compression_mode_t::Compressed:
+      return num_elems + num_elems / kWeightsRleMaxRun + 1;
+    default:
+      return num_elems;
+  }
+}
+
+uint32_t EncodeWeightsStream(compression_mode_t mode, const int8_t* src, uint32_t num_elems, uint8_t* dst) {
+  switch (mode) {
+    case compression_mode_t::Sparse:
+      return EncodeSparseStream(src, num_elems, dst);
+    case compression_mode_t::Compressed:
+      return EncodeRleStream(src, num_elems, dst);
+    default:
+      memmove(dst, src, num_elems);
+      return num_elems;
+  }
+}
+
+mli_status DecodeWeightsStream(compression_mode_t mode, const uint8_t* src, uint32_t src_size,
+                               int8_t* dst, uint32_t num_elems) {
+  switch (mode) {
+    case compression_mode_t::Sparse:
+      return DecodeSparseStream(src, src_size, dst, num_elems);
+    case compression_mode_t::Compressed:
+      return DecodeRleStream(src, src_size, dst, num_elems);
+    default:
+      if (src_size < num_elems) return MLI_STATUS_ARGUMENT_ERROR;
+      memcpy(dst, src, num_elems);
+      return MLI_STATUS_OK;
+  }
+}
+
+mli_status DecodeWeightsTile(const int8_t* encoded, int32_t origin, int8_t* dst, uint32_t num_elems) {
+  MLI_ASSERT(encoded != nullptr && dst != nullptr);
+  const uint8_t* base = reinterpret_cast<const uint8_t*>(encoded);
+  WeightsCodecHeader header;
+  memcpy(&header, base, sizeof(header));
+
+  // Tiles are few, so a linear lookup is fast enough compared to the expansion itself
+  for (uint32_t i = 0; i < header.num_tiles; i++) {
+    WeightsCodecTile tile;
+    memcpy(&tile, base + sizeof(header) + i * sizeof(tile), sizeof(tile));
+    if (tile.origin != origin) continue;
+    return DecodeWeightsStream((compression_mode_t)header.mode, base + tile.offset, tile.size, dst, num_elems);
+  }
+  return MLI_STATUS_ARGUMENT_ERROR;
+}
+
+} // namespace snps_arc::metaware::mli::ref
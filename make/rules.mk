@@ -15,6 +15,7 @@ DEBUG_BUILD         ?= ON
 OPTMODE             ?= speed
 GEN_EXAMPLES        ?= 1
 MLI_BUILD_REFERENCE ?= OFF
+MLI_BUILD_HOST_SIMD ?= OFF
 BUILD_SUBDIR        ?=
 BUILD_TARGET        ?= install
 EXT_CFLAGS          ?=
@@ -95,6 +96,7 @@ $(CONFIG_TARGET):
 		-DOPTMODE=$(OPTMODE) \
 		-DGEN_EXAMPLES=$(GEN_EXAMPLES) \
 		-DMLI_BUILD_REFERENCE=$(MLI_BUILD_REFERENCE) \
+		-DMLI_BUILD_HOST_SIMD=$(MLI_BUILD_HOST_SIMD) \
 		-DCMAKE_INSTALL_PREFIX=$(abspath $(LIBRARY_DIR)) \
 		$(TOOLCHAIN_OPTIONS) \
 		-B$(abspath $(BUILD_DIR)) \
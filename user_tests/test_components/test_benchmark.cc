@@ -0,0 +1,228 @@
+/*
+* Copyright 2022, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+
+#include "test_benchmark.h"
+
+// Standard asserts should be intentionally turned-on by defenition of TEST_DEBUG.
+#if !defined(TEST_DEBUG)
+#define NDEBUG
+#endif
+
+#include <assert.h>
+
+#include <cstdio>
+#include <ctime>
+
+#if defined(__CCAC__)
+#include <arc/arc_timer.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#elif defined(_M_X64) || defined(_M_IX86)
+#include <intrin.h>
+#endif
+
+namespace mli {
+namespace tst {
+
+// Separator string and it's length. All fields sizes assume it is fixed.
+//==========================================================
+static const int kSeparatorStringLength = 111;
+static const char kSeparatorString[kSeparatorStringLength] =
+    "|============================================================================================================|";
+
+//==========================================================
+//
+// Platform timers
+//
+//==========================================================
+#if defined(__CCAC__)
+// MWDT toolchain: default timer of the target
+static void timer_start() { _timer_default_reset(); }
+static uint64_t timer_elapsed() { return _timer_default_read(); }
+static const char kTimerUnits[] = "cycles";
+
+#elif defined(_ARC)
+// Another ARC toolchain (ARC_GNU): Timer 0 via auxiliary registers
+static void timer_start() {
+    _sr(0, 0x22);
+    _sr(0xffffffff, 0x23);
+    _sr(3, 0x22);
+    _sr(0, 0x21);
+}
+static uint64_t timer_elapsed() { return _lr(0x21); }
+static const char kTimerUnits[] = "cycles";
+
+#elif defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+// x86 host: time stamp counter
+static uint64_t tsc_start_value = 0;
+static void timer_start() { tsc_start_value = __rdtsc(); }
+static uint64_t timer_elapsed() { return __rdtsc() - tsc_start_value; }
+static const char kTimerUnits[] = "tsc";
+
+#elif defined(__linux__)
+#define TIMER_IS_CLOCK_GETTIME
+#else
+// Another platform (host). ctime support is expected
+static clock_t clock_start_value = 0;
+static void timer_start() { clock_start_value = clock(); }
+static uint64_t timer_elapsed() { return static_cast<uint64_t>(clock() - clock_start_value); }
+static const char kTimerUnits[] = "ticks";
+#endif
+
+#if defined(__linux__)
+static struct timespec clock_gettime_start_value;
+
+static void clock_gettime_start() {
+    clock_gettime(CLOCK_MONOTONIC, &clock_gettime_start_value);
+}
+
+static uint64_t clock_gettime_elapsed() {
+    struct timespec cur;
+    clock_gettime(CLOCK_MONOTONIC, &cur);
+    const int64_t sec = static_cast<int64_t>(cur.tv_sec - clock_gettime_start_value.tv_sec);
+    const int64_t nsec = static_cast<int64_t>(cur.tv_nsec - clock_gettime_start_value.tv_nsec);
+    return static_cast<uint64_t>(sec * 1000000000 + nsec);
+}
+
+const bench_timer& bench_clock_gettime_timer() {
+    static const bench_timer timer = {clock_gettime_start, clock_gettime_elapsed, "ns"};
+    return timer;
+}
+#endif
+
+const bench_timer& bench_default_timer() {
+#if defined(TIMER_IS_CLOCK_GETTIME)
+    return bench_clock_gettime_timer();
+#else
+    static const bench_timer timer = {timer_start, timer_elapsed, kTimerUnits};
+    return timer;
+#endif
+}
+
+//==========================================================
+//
+// Workload helpers
+//
+//==========================================================
+uint32_t bench_data_bytes(std::initializer_list<const mli_tensor*> tensors) {
+    uint32_t bytes = 0;
+    for (const mli_tensor* t : tensors) {
+        assert(t != nullptr);
+        bytes += mli_hlp_count_elem_num(t, 0) * mli_hlp_tensor_element_size(t);
+    }
+    return bytes;
+}
+
+uint32_t bench_memory_footprint(std::initializer_list<const mli_tensor*> tensors) {
+    uint32_t bytes = 0;
+    for (const mli_tensor* t : tensors) {
+        assert(t != nullptr);
+        // Capacity is zero for tensors which keep a single value inside the structure
+        bytes += (t->data.capacity > 0) ? t->data.capacity : mli_hlp_tensor_element_size(t);
+    }
+    return bytes;
+}
+
+//==========================================================
+//
+// Benchmark Reporter Methods
+//
+//==========================================================
+benchmark_reporter::benchmark_reporter()
+    : m_timer(bench_default_timer())
+    , m_last_cycles(0)
+    , m_num_cases(0)
+    , m_dropped_cases(0) {}
+
+void benchmark_reporter::set_timer(const bench_timer& timer) {
+    assert(timer.start != nullptr && timer.elapsed != nullptr && timer.units != nullptr);
+    m_timer = timer;
+}
+
+void benchmark_reporter::add_case(const char* case_descr, uint64_t macs, uint32_t bytes, uint32_t footprint) {
+    assert(case_descr != nullptr);
+    if (!kEnabled)
+        return;
+    if (m_num_cases >= kMaxCases) {
+        m_dropped_cases++;
+        return;
+    }
+    m_cases[m_num_cases++] = {case_descr, m_last_cycles, macs, bytes, footprint};
+}
+
+void benchmark_reporter::report(const char* group_name) const {
+    assert(group_name != nullptr);
+    if (!kEnabled)
+        return;
+#if defined(TEST_BENCHMARK_JSON)
+    report_json(group_name);
+#elif defined(TEST_BENCHMARK_CSV)
+    report_csv(group_name);
+#else
+    report_table(group_name);
+#endif
+}
+
+// Ratio of workload to time with protection against zero time (coarse timers)
+static double per_time_unit(uint64_t value, uint64_t cycles) {
+    return static_cast<double>(value) / static_cast<double>((cycles > 0) ? cycles : 1);
+}
+
+void benchmark_reporter::report_table(const char* group_name) const {
+    assert(kSeparatorStringLength == 111);
+    char header[128];
+    snprintf(header, sizeof(header), "Benchmark: %s (%s, best of %d runs)",
+             group_name, m_timer.units, kRepeats);
+    printf("\n%s\n", kSeparatorString);
+    printf("|  %-106s|\n", header);
+    printf("%s\n", kSeparatorString);
+    printf("| %-30s| %12s | %10s | %8s | %8s | %6s | %-14s|\n",
+           "Test Case", m_timer.units, "MACs", "MAC/cyc", "Bytes", "B/cyc", "Footprint[B]");
+    printf("%s\n", kSeparatorString);
+    for (int i = 0; i < m_num_cases; i++) {
+        const bench_case& c = m_cases[i];
+        printf("| %-30s| %12llu | %10llu | %8.3f | %8u | %6.3f | %13u |\n",
+               c.descr, (unsigned long long)c.cycles, (unsigned long long)c.macs,
+               per_time_unit(c.macs, c.cycles), (unsigned)c.bytes,
+               per_time_unit(c.bytes, c.cycles), (unsigned)c.footprint);
+    }
+    if (m_dropped_cases > 0)
+        printf("| %d more cases are not reported (increase benchmark_reporter::kMaxCases)\n", m_dropped_cases);
+    printf("%s\n\n", kSeparatorString);
+}
+
+void benchmark_reporter::report_csv(const char* group_name) const {
+    printf("group,case,%s,macs,macs_per_%s,bytes,bytes_per_%s,footprint\n",
+           m_timer.units, m_timer.units, m_timer.units);
+    for (int i = 0; i < m_num_cases; i++) {
+        const bench_case& c = m_cases[i];
+        printf("%s,%s,%llu,%llu,%.4f,%u,%.4f,%u\n",
+               group_name, c.descr, (unsigned long long)c.cycles, (unsigned long long)c.macs,
+               per_time_unit(c.macs, c.cycles), (unsigned)c.bytes,
+               per_time_unit(c.bytes, c.cycles), (unsigned)c.footprint);
+    }
+}
+
+void benchmark_reporter::report_json(const char* group_name) const {
+    printf("{\"group\": \"%s\", \"units\": \"%s\", \"repeats\": %d, \"cases\": [\n",
+           group_name, m_timer.units, kRepeats);
+    for (int i = 0; i < m_num_cases; i++) {
+        const bench_case& c = m_cases[i];
+        printf("  {\"case\": \"%s\", \"cycles\": %llu, \"macs\": %llu, \"macs_per_cycle\": %.4f, "
+               "\"bytes\": %u, \"bytes_per_cycle\": %.4f, \"footprint\": %u}%s\n",
+               c.descr, (unsigned long long)c.cycles, (unsigned long long)c.macs,
+               per_time_unit(c.macs, c.cycles), (unsigned)c.bytes,
+               per_time_unit(c.bytes, c.cycles), (unsigned)c.footprint,
+               (i + 1 < m_num_cases) ? "," : "");
+    }
+    printf("]}\n");
+}
+
+} // namespace tst
+} // namespace mli
@@ -0,0 +1,170 @@
+/*
+* Copyright 2022, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+
+#ifndef _MLI_USER_TESTS_TEST_BENCHMARK_H_
+#define _MLI_USER_TESTS_TEST_BENCHMARK_H_
+
+#include <stdint.h>
+
+#include <initializer_list>
+
+#include "mli_api.h"
+
+// Benchmark mode is turned-on by definition of TEST_BENCHMARK (see README.md).
+// Output format is a table by default. TEST_BENCHMARK_CSV or TEST_BENCHMARK_JSON can be
+// defined in addition to get machine readable output.
+#if !defined(TEST_BENCHMARK_REPEATS)
+#define TEST_BENCHMARK_REPEATS 10
+#endif
+
+namespace mli {
+namespace tst {
+
+//===============================================================================================
+// Timer used for benchmarking. It can be replaced by user with benchmark_reporter::set_timer()
+//
+// start   - function to (re)start measurement
+// elapsed - function returning time units passed since the last start() call
+// units   - name of time units ("cycles", "ns", ...) for reporting
+//===============================================================================================
+struct bench_timer {
+    void (*start)();
+    uint64_t (*elapsed)();
+    const char* units;
+};
+
+// Default timer for the current platform:
+//  - ARC timer 0 (cycles) on ARC targets
+//  - rdtsc (TSC ticks) on x86 hosts
+//  - clock_gettime(CLOCK_MONOTONIC) (ns) on other Linux hosts
+//  - clock() (ticks) otherwise
+const bench_timer& bench_default_timer();
+
+#if defined(__linux__)
+// clock_gettime(CLOCK_MONOTONIC) based timer which can be used on any Linux host
+const bench_timer& bench_clock_gettime_timer();
+#endif
+
+// Sum of data sizes (in bytes) of all the provided tensors. It's used as a number of bytes
+// which kernel must read and write at least.
+uint32_t bench_data_bytes(std::initializer_list<const mli_tensor*> tensors);
+
+// Sum of memory capacities (in bytes) of all the provided tensors.
+uint32_t bench_memory_footprint(std::initializer_list<const mli_tensor*> tensors);
+
+
+//===============================================================================================
+// Benchmark reporter which measures kernels on the same test vectors as used for validation.
+// Example of table output:
+//
+// |============================================================================================================|
+// |  Benchmark: mli_krn_conv2d (cycles, best of 10 runs)                                                       |
+// |============================================================================================================|
+// | Test Case                     |       cycles |       MACs |  MAC/cyc |    Bytes |  B/cyc | Footprint[B]  |
+// |============================================================================================================|
+// | Test 1 FX16                   |        12345 |       5184 |    0.420 |     1712 |  0.139 |          1728 |
+// | .....................................................................................................      |
+// |============================================================================================================|
+//
+//  where:
+//      'cycles' Field - best result of all runs in units of the used timer
+//      'MACs' Field - number of multiply-accumulate operations (or other basic ops for kernels without MACs)
+//      'MAC/cyc' Field - MACs per time unit
+//      'Bytes' Field - number of bytes kernel must read and write at least (see bench_data_bytes())
+//      'B/cyc' Field - Bytes per time unit
+//      'Footprint' Field - memory used by operands of the kernel (see bench_memory_footprint())
+//
+// CSV output contains the same fields with 'group' field in addition. JSON output is an object
+// with 'group', 'units', 'repeats' fields and array of 'cases' with the same fields as in CSV.
+// Nothing is printed if benchmark mode is turned-off.
+//===============================================================================================
+class benchmark_reporter {
+public:
+#if defined(TEST_BENCHMARK)
+    static constexpr bool kEnabled = true;
+    static constexpr int kRepeats = TEST_BENCHMARK_REPEATS;
+    static constexpr int kMaxCases = 64;
+#else
+    static constexpr bool kEnabled = false;
+    static constexpr int kRepeats = 1;
+    static constexpr int kMaxCases = 1;
+#endif
+
+    benchmark_reporter();
+
+    // Replace the default timer of the platform with the user provided one.
+    void set_timer(const bench_timer& timer);
+
+    // Run the kernel and measure it. In benchmark mode the kernel is run several times and
+    // the best result is kept till the next add_case() call.
+    //
+    // params:
+    // [IN] kernel_call - functor with kernel invocation which returns mli_status
+    // [IN] repeats - number of runs in benchmark mode. Must be 1 for kernels which update
+    //                their inputs (i.e. cell of LSTM)
+    //
+    // return status of the last kernel run
+    template <typename F>
+    mli_status measure(F kernel_call, int repeats = kRepeats) {
+        mli_status status = MLI_STATUS_OK;
+        uint64_t best = UINT64_MAX;
+        repeats = kEnabled ? repeats : 1;
+        for (int i = 0; i < repeats && status == MLI_STATUS_OK; i++) {
+            m_timer.start();
+            status = kernel_call();
+            const uint64_t cur = m_timer.elapsed();
+            best = (cur < best) ? cur : best;
+        }
+        m_last_cycles = best;
+        return status;
+    }
+
+    // Register test case with the result of the last measure() call
+    //
+    // params:
+    // [IN] case_descr - Case description string (<30 characters). Pointer is stored, not a copy of string.
+    // [IN] macs - number of MACs or basic operations of the kernel
+    // [IN] bytes - number of bytes kernel must read and write (see bench_data_bytes())
+    // [IN] footprint - memory used by operands of the kernel (see bench_memory_footprint())
+    //
+    // No return
+    void add_case(const char* case_descr, uint64_t macs, uint32_t bytes, uint32_t footprint);
+
+    // Print all registered cases in the chosen format. Nothing is printed if benchmark mode is turned-off.
+    //
+    // params:
+    // [IN] group_name - name of the test group (kernel) to print in header or in 'group' field
+    //
+    // No return
+    void report(const char* group_name) const;
+
+private:
+    struct bench_case {
+        const char* descr;
+        uint64_t cycles;
+        uint64_t macs;
+        uint32_t bytes;
+        uint32_t footprint;
+    };
+
+    void report_table(const char* group_name) const;
+    void report_csv(const char* group_name) const;
+    void report_json(const char* group_name) const;
+
+    bench_timer m_timer;
+    uint64_t m_last_cycles;
+    int m_num_cases;
+    int m_dropped_cases;
+    bench_case m_cases[kMaxCases];
+};
+
+} // namespace tst
+} // namespace mli
+
+#endif // _MLI_USER_TESTS_TEST_BENCHMARK_H_
@@ -0,0 +1,56 @@
+/*
+* Copyright 2022, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+
+#ifndef _MLI_USER_TESTS_TEST_HOST_SYNC_H_
+#define _MLI_USER_TESTS_TEST_HOST_SYNC_H_
+
+#include <condition_variable>
+#include <mutex>
+
+#include "mli_sync_interface.hpp"
+
+namespace mli {
+namespace tst {
+
+//=======================================================================
+// Events of processors or DMA emulated by host threads
+//
+// Implementation of SynchronizationInterface for tests which emulate
+// concurrent agents with std::thread. Host builds only.
+//=======================================================================
+class HostSynchronization : public ::snps_arc::metaware::mli::SynchronizationInterface {
+  public:
+    mli_status SignalEvent(int32_t mask) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_events |= mask;
+        m_cond.notify_all();
+        return MLI_STATUS_OK;
+    }
+
+    mli_status ClearEvent(int32_t mask) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_events &= ~mask;
+        return MLI_STATUS_OK;
+    }
+
+    mli_status WaitEvent(int32_t mask) override {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cond.wait(lock, [this, mask] { return (m_events & mask) == mask; });
+        return MLI_STATUS_OK;
+    }
+
+  private:
+    std::mutex m_mutex;
+    std::condition_variable m_cond;
+};
+
+} // namespace tst
+} // namespace mli
+
+#endif // _MLI_USER_TESTS_TEST_HOST_SYNC_H_
@@ -10,6 +10,7 @@
 #ifndef _MLI_USER_TESTS_TEST_RESCALE_UTILITY_H_
 #define _MLI_USER_TESTS_TEST_RESCALE_UTILITY_H_
 
+#include <cstddef>
 #include <vector>
 
 #include "mli_api.h"
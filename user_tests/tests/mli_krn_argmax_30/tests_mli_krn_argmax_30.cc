@@ -0,0 +1,280 @@
+/*
+* Copyright 2022, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "mli_api.h"
+#include "mli_config.h"
+#include "mli_types.h"
+#include "mli_types.hpp"
+#include "mli_kernels_factory_ref.hpp"
+#include "mli_ref_private_types.hpp"
+#include "mli_runtime_api.hpp"
+#include "mli_ref_runtime_api.hpp"
+
+#include "test_memory_manager.h"
+#include "test_report.h"
+#include "test_tiling.hpp"
+
+using mli::tst::reporter_basic;
+
+namespace lib_mli = ::snps_arc::metaware::mli;
+namespace lib_ref = ::snps_arc::metaware::mli::ref;
+
+using lib_mli::kArgMaxInRank;
+using lib_mli::kArgMaxInIterRank;
+using lib_mli::kArgMaxOutRank;
+using lib_mli::kArgMaxOutIterRank;
+
+struct argmax_test_operands {
+    const char* descr;
+    uint32_t in_shape[kArgMaxInRank];
+    uint32_t in_tile_shape[kArgMaxInRank];
+    uint32_t in_elem_size;
+    uint32_t out_elem_size;
+    lib_mli::ArgMaxConfig cfg;
+};
+
+// Values are taken from a narrow range to get repeated maximums:
+// the index of the first one is expected.
+static const argmax_test_operands tests_list[] = {
+    {"Test 1 SA8 axis=3, tiled H",   {1, 8, 6, 10}, {1, 3, 6, 10}, sizeof(int8_t),  sizeof(int32_t), lib_mli::ArgMaxConfig(3)},
+    {"Test 2 FX16 axis=1, tiled W",  {1, 7, 9, 5},  {1, 7, 4, 5},  sizeof(int16_t), sizeof(int32_t), lib_mli::ArgMaxConfig(1)},
+    {"Test 3 SA32 axis=0, tiled HC", {3, 5, 4, 6},  {3, 2, 4, 4},  sizeof(int32_t), sizeof(int16_t), lib_mli::ArgMaxConfig(0)},
+    {"Test 4 SA8 axis=2, no tiling", {2, 4, 11, 3}, {2, 4, 11, 3}, sizeof(int8_t),  sizeof(int16_t), lib_mli::ArgMaxConfig(2)},
+    {"Test 5 FX16 whole tensor",     {1, 6, 5, 7},  {1, 6, 5, 7},  sizeof(int16_t), sizeof(int32_t), lib_mli::ArgMaxConfig(-1)},
+};
+
+constexpr int kTestsNum = sizeof(tests_list) / sizeof(tests_list[0]);
+
+constexpr uint32_t kMemSize = 4 * 2048;
+static int32_t g_input[kMemSize / sizeof(int32_t)];
+static int32_t g_output[kMemSize / sizeof(int32_t)];
+static int32_t g_ref_output[kMemSize / sizeof(int32_t)];
+static IO_DATA_ATTR int8_t g_mem_pool[kMemSize] = {0};
+
+static void fill_input(const argmax_test_operands* cur_test, uint32_t num_elems, int8_t* dst) {
+    uint32_t seed = 12345u + (uint32_t)cur_test->in_elem_size;
+    for (uint32_t i = 0; i < num_elems; i++) {
+        seed = seed * 1103515245u + 12345u;
+        const int32_t val = (int32_t)((seed >> 16) % 23) - 11;
+        if (cur_test->in_elem_size == sizeof(int8_t)) {
+            dst[i] = (int8_t)val;
+        } else if (cur_test->in_elem_size == sizeof(int16_t)) {
+            ((int16_t*)dst)[i] = (int16_t)(val * 1000);
+        } else {
+            ((int32_t*)dst)[i] = val * 100000;
+        }
+    }
+}
+
+static int32_t read_elem(const int8_t* src, uint32_t elem_size, uint32_t idx) {
+    if (elem_size == sizeof(int8_t)) return src[idx];
+    if (elem_size == sizeof(int16_t)) return ((const int16_t*)src)[idx];
+    return ((const int32_t*)src)[idx];
+}
+
+static void write_elem(int8_t* dst, uint32_t elem_size, uint32_t idx, int32_t val) {
+    if (elem_size == sizeof(int16_t)) ((int16_t*)dst)[idx] = (int16_t)val;
+    else ((int32_t*)dst)[idx] = val;
+}
+
+static void reference_argmax(const argmax_test_operands* cur_test, const int8_t* in, int8_t* out) {
+    const uint32_t* shape = cur_test->in_shape;
+    const int32_t axis = cur_test->cfg.axis;
+    int32_t stride[kArgMaxInRank];
+    stride[kArgMaxInRank - 1] = 1;
+    for (int i = kArgMaxInRank - 2; i >= 0; i--) stride[i] = stride[i + 1] * shape[i + 1];
+
+    if (axis < 0) {
+        const uint32_t num_elems = stride[0] * shape[0];
+        uint32_t max_idx = 0;
+        for (uint32_t i = 1; i < num_elems; i++) {
+            if (read_elem(in, cur_test->in_elem_size, i) > read_elem(in, cur_test->in_elem_size, max_idx)) max_idx = i;
+        }
+        write_elem(out, cur_test->out_elem_size, 0, (int32_t)max_idx);
+        return;
+    }
+
+    uint32_t out_idx = 0;
+    uint32_t pos[kArgMaxInRank];
+    for (pos[0] = 0; pos[0] < (axis == 0 ? 1 : shape[0]); pos[0]++) {
+        for (pos[1] = 0; pos[1] < (axis == 1 ? 1 : shape[1]); pos[1]++) {
+            for (pos[2] = 0; pos[2] < (axis == 2 ? 1 : shape[2]); pos[2]++) {
+                for (pos[3] = 0; pos[3] < (axis == 3 ? 1 : shape[3]); pos[3]++) {
+                    const uint32_t base = pos[0] * stride[0] + pos[1] * stride[1] + pos[2] * stride[2] + pos[3] * stride[3];
+                    uint32_t max_i = 0;
+                    for (uint32_t i = 1; i < shape[axis]; i++) {
+                        if (read_elem(in, cur_test->in_elem_size, base + i * stride[axis]) >
+                            read_elem(in, cur_test->in_elem_size, base + max_i * stride[axis])) {
+                            max_i = i;
+                        }
+                    }
+                    write_elem(out, cur_test->out_elem_size, out_idx++, (int32_t)max_i);
+                }
+            }
+        }
+    }
+}
+
+static void get_out_shape(const argmax_test_operands* cur_test, const uint32_t in_shape[kArgMaxInRank],
+                          uint32_t out_shape[kArgMaxOutRank]) {
+    for (uint32_t i = 0, o = 0; i < kArgMaxInRank; i++) {
+        if (cur_test->cfg.axis < 0) {
+            if (o < kArgMaxOutRank) out_shape[o++] = 1;
+        } else if ((int32_t)i != cur_test->cfg.axis) {
+            out_shape[o++] = in_shape[i];
+        }
+    }
+}
+
+static void set_mem_strides(const uint32_t* shape, uint32_t rank, int32_t* stride) {
+    stride[rank - 1] = 1;
+    for (int i = (int)rank - 2; i >= 0; i--) stride[i] = stride[i + 1] * shape[i + 1];
+}
+
+bool run_test(const reporter_basic& reporter, const argmax_test_operands* cur_test) {
+    uint32_t out_shape[kArgMaxOutRank];
+    uint32_t out_tile_shape[kArgMaxOutRank];
+    get_out_shape(cur_test, cur_test->in_shape, out_shape);
+    get_out_shape(cur_test, cur_test->in_tile_shape, out_tile_shape);
+    int32_t in_stride[kArgMaxInRank];
+    int32_t out_stride[kArgMaxOutRank];
+    set_mem_strides(cur_test->in_shape, kArgMaxInRank, in_stride);
+    set_mem_strides(out_shape, kArgMaxOutRank, out_stride);
+
+    uint32_t num_in_elems = 1;
+    uint32_t num_out_elems = 1;
+    for (uint32_t i = 0; i < kArgMaxInRank; i++) num_in_elems *= cur_test->in_shape[i];
+    for (uint32_t i = 0; i < kArgMaxOutRank; i++) num_out_elems *= out_shape[i];
+
+    fill_input(cur_test, num_in_elems, (int8_t*)g_input);
+    reference_argmax(cur_test, (int8_t*)g_input, (int8_t*)g_ref_output);
+
+    // STEP 1: Construct ArgMax as a specific ExecutionInterface successor
+    //==================================================================
+    uint32_t in_shape[kArgMaxInRank];
+    uint32_t in_tile_shape[kArgMaxInRank];
+    for (uint32_t i = 0; i < kArgMaxInRank; i++) {
+        in_shape[i] = cur_test->in_shape[i];
+        in_tile_shape[i] = cur_test->in_tile_shape[i];
+    }
+    lib_mli::Tensor<lib_mli::NoBuffer, kArgMaxInRank> in_tensor(in_shape, in_stride);
+    lib_mli::Tensor<lib_mli::NoBuffer, kArgMaxOutRank> out_tensor(out_shape, out_stride);
+    in_tensor.set_elem_size(cur_test->in_elem_size);
+    out_tensor.set_elem_size(cur_test->out_elem_size);
+
+    int32_t in_iteration_order[kArgMaxInIterRank]{ 0, 1, 2, 3 };
+    int32_t out_iteration_order[kArgMaxOutIterRank]{ 0, 1, 2 };
+    lib_mli::IteratorCfg<kArgMaxInIterRank> in_it_config(in_tensor, in_tile_shape, in_iteration_order);
+    lib_mli::IteratorCfg<kArgMaxOutIterRank> out_it_config(out_tensor, out_tile_shape, out_iteration_order);
+    lib_mli::TensorIterator<lib_mli::NoBuffer, kArgMaxInRank, kArgMaxInIterRank> in_tensor_it(in_tensor, in_it_config);
+    lib_mli::TensorIterator<lib_mli::NoBuffer, kArgMaxOutRank, kArgMaxOutIterRank> out_tensor_it(out_tensor, out_it_config);
+    const uint32_t num_tiles = in_tensor_it.GetTotalCount();
+
+    lib_mli::PlatformDescription pd;
+    lib_ref::KernelsFactory kernel_factory(pd);
+    void* argmax_cs_buffer = malloc(kernel_factory.ArgMax_CS_GetSize());
+    auto argmax_op = kernel_factory.ArgMax_CS(argmax_cs_buffer, in_tensor_it, cur_test->cfg, out_tensor_it);
+
+    // STEP 2: Memory management (Up to user on how to deal with it)
+    //==================================================================
+    uint32_t offset = 0;
+    const uint32_t runtime_obj_size = argmax_op->GetRuntimeObjectSize();
+    offset += runtime_obj_size;
+    const uint32_t private_buffer_size = argmax_op->GetKernelPrivateDataSize();
+    const uint32_t private_buffer_offset = offset;
+    offset += private_buffer_size;
+
+    const uint32_t in_size = lib_mli::service::GetBufferSize(kArgMaxInRank, in_tile_shape, in_stride) * cur_test->in_elem_size;
+    lib_mli::OffsetBuffer argmax_in_buf{offset, 0, in_size, cur_test->in_elem_size};
+    offset += in_size;
+
+    const uint32_t out_size = lib_mli::service::GetBufferSize(kArgMaxOutRank, out_tile_shape, out_stride) * cur_test->out_elem_size;
+    lib_mli::OffsetBuffer argmax_out_buf{offset, 0, out_size, cur_test->out_elem_size};
+    offset += out_size;
+
+    const uint32_t ctrl_buffer_size = argmax_op->GetCtrlBufferSize();
+    lib_mli::OffsetBuffer argmax_ctrl_buf{offset, 0, ctrl_buffer_size, sizeof(char)};
+    offset += ctrl_buffer_size;
+    assert(offset <= kMemSize);
+
+    mli_status status = argmax_op->AttachBufferOffsets(argmax_in_buf, argmax_out_buf, argmax_ctrl_buf);
+    assert(status == MLI_STATUS_OK);
+    status = argmax_op->GetKernelPrivateData(g_mem_pool + private_buffer_offset);
+    assert(status == MLI_STATUS_OK);
+
+    // STEP 3: Execution phase
+    //==================================================================
+    uint64_t membasis[] = {reinterpret_cast<uint64_t>(g_mem_pool)};
+    auto argmax_run_op = lib_mli::ExecutionInterface::Create(g_mem_pool, runtime_obj_size,
+                                                             g_mem_pool + private_buffer_offset, private_buffer_size,
+                                                             membasis, sizeof(membasis) / sizeof(membasis[0]));
+    assert(argmax_run_op != nullptr);
+    lib_ref::ArgMax* argmax_pimpl = dynamic_cast<lib_ref::ArgMax*>(argmax_run_op);
+
+    uint32_t input_tile_size[kArgMaxInRank];
+    uint32_t output_tile_size[kArgMaxOutRank];
+    int32_t input_tile_offsets[kArgMaxInRank];
+    int32_t output_tile_offsets[kArgMaxOutRank];
+    const int32_t zero_offsets[kArgMaxInRank]{};
+    for (uint32_t n_tile = 0; n_tile < num_tiles; n_tile++) {
+        status = argmax_run_op->Prefetch();
+        assert(status == MLI_STATUS_OK);
+
+        argmax_pimpl->GetIOSizesAndOffsets(input_tile_size, output_tile_size, input_tile_offsets, output_tile_offsets);
+
+        // copy input from global buffer to local tile buffer
+        strided_copy_with_offsets(kArgMaxInRank, cur_test->in_elem_size, (int8_t*)g_input,
+                                  input_tile_offsets, zero_offsets, in_stride,
+                                  input_tile_size, g_mem_pool + argmax_in_buf.get_offset());
+
+        status = argmax_run_op->Issue();
+        assert(status == MLI_STATUS_OK);
+
+        // copy output from local tile buffer to global buffer
+        strided_copy_with_offsets(kArgMaxOutRank, cur_test->out_elem_size, g_mem_pool + argmax_out_buf.get_offset(),
+                                  zero_offsets, output_tile_offsets, out_stride,
+                                  output_tile_size, (int8_t*)g_output);
+
+        status = argmax_run_op->Update();
+        assert(status == MLI_STATUS_OK);
+    }
+    free(argmax_cs_buffer);
+
+    // STEP 4: Compare with the reference
+    //==================================================================
+    uint32_t num_mismatches = 0;
+    for (uint32_t i = 0; i < num_out_elems; i++) {
+        if (read_elem((int8_t*)g_output, cur_test->out_elem_size, i) !=
+            read_elem((int8_t*)g_ref_output, cur_test->out_elem_size, i)) {
+            num_mismatches++;
+        }
+    }
+    const bool is_test_passed = num_mismatches == 0;
+    char message[64]{};
+    sprintf(message, "Tiles = %u, Mismatches = %u/%u", num_tiles, num_mismatches, num_out_elems);
+    reporter.report_case(cur_test->descr, message, is_test_passed);
+    return is_test_passed;
+}
+
+int main() {
+    const reporter_basic reporter;
+    bool final_status = true;
+
+    reporter.report_header("MLI3.0|Kernels|ArgMax Function Tests");
+    for (int i = 0; i < kTestsNum; ++i) {
+        final_status &= run_test(reporter, &tests_list[i]);
+    }
+    reporter.report_outline("[AUTO] Group: mli_krn_argmax_30", final_status);
+
+    return 0;
+}
@@ -0,0 +1,602 @@
+/*
+* Copyright 2022, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include "mli_kernels_factory_ref.hpp"
+#include "mli_ref_private_types.hpp"
+#include "mli_ref_runtime_api.hpp"
+#include "test_memory_manager.h"
+#include "test_report.h"
+#include "test_tiling.hpp"
+
+namespace lib_mli = ::snps_arc::metaware::mli;
+namespace lib_ref = ::snps_arc::metaware::mli::ref;
+
+using lib_mli::kConvIORank;
+using lib_mli::kConvIOIterRank;
+using lib_mli::kConvWRank;
+using lib_mli::kConvWIterRank;
+using lib_mli::kConvZPRank;
+using lib_mli::kConvZPIterRank;
+using lib_mli::kConvIterRank;
+using lib_mli::kInpZPRank;
+using lib_mli::kDepthwiseIORank;
+using lib_mli::kDepthwiseIterRank;
+using lib_mli::kDepthwiseWRank;
+using lib_mli::kDepthwiseZPRank;
+using lib_mli::kPoolRank;
+using lib_mli::kPoolIterRank;
+using lib_mli::kSkipIterDim;
+using mli::tst::reporter_basic;
+
+// Each kernel runs on the same data twice: with the HWC feature maps and with the CHW
+// (planar) feature maps. The CHW layout is described by the strides of the tensors only,
+// so results of both runs are expected to be bit-exact. Tiled cases split the output by height
+// and channels: each tile is copied from the global memory into the local buffers and back.
+constexpr uint32_t kInHeight = 7;
+constexpr uint32_t kInWidth = 9;
+constexpr uint32_t kInChannels = 5;
+constexpr uint32_t kConvOutChannels = 6;
+constexpr uint32_t kMaxKernelSize = 3;
+constexpr uint32_t kMaxBatch = 2;
+constexpr uint32_t kMaxElems = kMaxBatch * kInHeight * kInWidth * kConvOutChannels;
+
+constexpr uint32_t kMemSize = 64 * 1024;
+constexpr uint32_t kCsBufSize = 4 * 1024;
+constexpr uint32_t kRuntimeBufSize = 4 * 1024;
+constexpr uint32_t kPrivateBufSize = 4 * 1024;
+constexpr uint32_t kGlobalMemSize = 16 * 1024;
+static IO_DATA_ATTR int8_t g_mem_pool[kMemSize] = {0};
+static int8_t g_global_mem[kGlobalMemSize] = {0};
+static uint32_t g_cs_buf[kCsBufSize / sizeof(uint32_t)];
+static uint32_t g_runtime_buf[kRuntimeBufSize / sizeof(uint32_t)];
+static uint32_t g_private_buf[kPrivateBufSize / sizeof(uint32_t)];
+
+// Logical data in BHWC order
+static int32_t g_input[kMaxBatch * kInHeight * kInWidth * kInChannels];
+static int32_t g_weights[kMaxKernelSize * kMaxKernelSize * kInChannels * kConvOutChannels];
+static int32_t g_out_hwc[kMaxElems];
+static int32_t g_out_chw[kMaxElems];
+static int32_t g_out_untiled[kMaxElems];
+
+enum chw_test_kernel {
+  kConv2d = 0,
+  kDepthwiseConv2d,
+  kMaxPool2D,
+  kSumPool2D
+};
+
+struct chw_test_operands {
+  const char* descr;
+  chw_test_kernel kernel;
+  uint32_t elem_size;       // element size of input (and output of MaxPool2D)
+  uint32_t batch;
+  uint32_t kernel_h, kernel_w;
+  uint32_t stride_h, stride_w;
+  uint32_t pad_top, pad_left, pad_bottom, pad_right;
+  uint32_t dilation_h, dilation_w;
+  int8_t in_zp;
+  int8_t w_zp;
+  uint32_t tile_h, tile_c;  // output tile size, 0 for the whole dimension
+};
+
+static const chw_test_operands tests_list[] = {
+  {"Test 1 Conv2d SA8 3x3 pad",       kConv2d, sizeof(int8_t), 1, 3, 3, 1, 1, 1, 1, 1, 1, 1, 1, -3, 2, 0, 0},
+  {"Test 2 Conv2d SA8 stride 2",      kConv2d, sizeof(int8_t), 1, 3, 2, 2, 2, 1, 0, 1, 1, 1, 1, 5, 0, 0, 0},
+  {"Test 3 Conv2d SA8 dilation",      kConv2d, sizeof(int8_t), 1, 3, 3, 1, 1, 2, 2, 2, 2, 2, 2, 0, -1, 0, 0},
+  {"Test 4 DW Conv SA8 3x3 pad",      kDepthwiseConv2d, sizeof(int8_t), 1, 3, 3, 1, 1, 1, 1, 1, 1, 1, 1, 4, -2, 0, 0},
+  {"Test 5 DW Conv SA8 stride 2",     kDepthwiseConv2d, sizeof(int8_t), 1, 3, 3, 2, 2, 0, 1, 1, 0, 1, 1, -7, 0, 0, 0},
+  {"Test 6 DW Conv SA8 dilation",     kDepthwiseConv2d, sizeof(int8_t), 1, 2, 3, 1, 2, 1, 2, 1, 2, 2, 2, 0, 1, 0, 0},
+  {"Test 7 MaxPool SA8 stride 2",     kMaxPool2D, sizeof(int8_t), 2, 3, 3, 2, 2, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0},
+  {"Test 8 MaxPool FX16 2x3",         kMaxPool2D, sizeof(int16_t), 1, 2, 3, 1, 1, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0},
+  {"Test 9 SumPool SA8 3x3 pad",      kSumPool2D, sizeof(int8_t), 2, 3, 3, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0},
+  {"Test 10 Conv2d SA8 tiled",        kConv2d, sizeof(int8_t), 1, 3, 3, 1, 1, 1, 1, 1, 1, 1, 1, -3, 2, 2, 4},
+  {"Test 11 DW Conv SA8 tiled",       kDepthwiseConv2d, sizeof(int8_t), 1, 3, 3, 2, 2, 1, 1, 1, 1, 1, 1, 4, -2, 2, 2},
+  {"Test 12 MaxPool SA8 tiled",       kMaxPool2D, sizeof(int8_t), 2, 3, 3, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 3, 2},
+  {"Test 13 SumPool SA8 tiled",       kSumPool2D, sizeof(int8_t), 2, 3, 3, 2, 2, 1, 1, 1, 1, 1, 1, 0, 0, 1, 3},
+};
+constexpr uint32_t kTestsNum = sizeof(tests_list) / sizeof(tests_list[0]);
+
+// Feature map [B, H, W, C] with strides of HWC or CHW layout
+struct fmap_desc {
+  uint32_t batch, height, width, channels;
+  int32_t b_stride, h_stride, w_stride, c_stride;
+
+  fmap_desc(uint32_t b, uint32_t h, uint32_t w, uint32_t c, bool chw)
+      : batch(b), height(h), width(w), channels(c) {
+    if (chw) {
+      w_stride = 1;
+      h_stride = (int32_t)w;
+      c_stride = (int32_t)(h * w);
+    } else {
+      c_stride = 1;
+      w_stride = (int32_t)c;
+      h_stride = (int32_t)(w * c);
+    }
+    b_stride = (int32_t)(h * w * c);
+  }
+
+  uint32_t size() const { return batch * height * width * channels; }
+
+  int32_t offset(uint32_t b, uint32_t h, uint32_t w, uint32_t c) const {
+    return (int32_t)b * b_stride + (int32_t)h * h_stride + (int32_t)w * w_stride + (int32_t)c * c_stride;
+  }
+};
+
+static uint32_t g_rand_state = 1;
+static int32_t rand_value(int32_t min, int32_t max) {
+  g_rand_state = g_rand_state * 1103515245u + 12345u;
+  return min + (int32_t)((g_rand_state >> 16) % (uint32_t)(max - min + 1));
+}
+
+static void write_value(int8_t* mem, uint32_t offset, uint32_t elem_size, int32_t val) {
+  switch (elem_size) {
+    case sizeof(int8_t):
+      mem[offset] = (int8_t)val;
+      break;
+    case sizeof(int16_t):
+      *reinterpret_cast<int16_t*>(mem + offset) = (int16_t)val;
+      break;
+    default:
+      *reinterpret_cast<int32_t*>(mem + offset) = val;
+      break;
+  }
+}
+
+static int32_t read_value(const int8_t* mem, uint32_t offset, uint32_t elem_size) {
+  switch (elem_size) {
+    case sizeof(int8_t):
+      return mem[offset];
+    case sizeof(int16_t):
+      return *reinterpret_cast<const int16_t*>(mem + offset);
+    default:
+      return *reinterpret_cast<const int32_t*>(mem + offset);
+  }
+}
+
+static void write_fmap(uint32_t offset, uint32_t elem_size, const fmap_desc& fm, const int32_t* data) {
+  for (uint32_t b = 0; b < fm.batch; b++)
+    for (uint32_t h = 0; h < fm.height; h++)
+      for (uint32_t w = 0; w < fm.width; w++)
+        for (uint32_t c = 0; c < fm.channels; c++) {
+          write_value(g_global_mem, offset + fm.offset(b, h, w, c) * elem_size, elem_size, *data++);
+        }
+}
+
+static void read_fmap(uint32_t offset, uint32_t elem_size, const fmap_desc& fm, int32_t* data) {
+  for (uint32_t b = 0; b < fm.batch; b++)
+    for (uint32_t h = 0; h < fm.height; h++)
+      for (uint32_t w = 0; w < fm.width; w++)
+        for (uint32_t c = 0; c < fm.channels; c++) {
+          *data++ = read_value(g_global_mem, offset + fm.offset(b, h, w, c) * elem_size, elem_size);
+        }
+}
+
+// Copies a tile of a tensor from the global memory into its local buffer, which has the strides
+// of the whole tensor, and back.
+static void load_tile(uint32_t rank, const lib_mli::OffsetBuffer& buf, uint32_t global_offset,
+                      const int32_t* tile_offsets, const int32_t* strides, const uint32_t* tile_size) {
+  const int32_t zero_offsets[kConvIORank]{};
+  strided_copy_with_offsets(rank, buf.get_elem_size(), g_global_mem + global_offset, tile_offsets, zero_offsets,
+                            strides, tile_size, g_mem_pool + buf.get_offset());
+}
+
+static void store_tile(uint32_t rank, const lib_mli::OffsetBuffer& buf, uint32_t global_offset,
+                       const int32_t* tile_offsets, const int32_t* strides, const uint32_t* tile_size) {
+  const int32_t zero_offsets[kConvIORank]{};
+  strided_copy_with_offsets(rank, buf.get_elem_size(), g_mem_pool + buf.get_offset(), zero_offsets, tile_offsets,
+                            strides, tile_size, g_global_mem + global_offset);
+}
+
+static uint32_t get_out_size(uint32_t in_size, uint32_t kernel_size, uint32_t stride,
+                             uint32_t pad_beg, uint32_t pad_end, uint32_t dilation) {
+  const uint32_t eff_kernel_size = (kernel_size - 1) * dilation + 1;
+  return (in_size + pad_beg + pad_end - eff_kernel_size) / stride + 1;
+}
+
+static uint32_t get_out_channels(const chw_test_operands& t) {
+  return t.kernel == kConv2d ? kConvOutChannels : kInChannels;
+}
+
+static uint32_t get_tile_size(uint32_t full_size, uint32_t tile_size) {
+  return tile_size == 0 ? full_size : MIN(tile_size, full_size);
+}
+
+static fmap_desc get_out_fmap(const chw_test_operands& t, bool chw) {
+  return fmap_desc(t.batch,
+                   get_out_size(kInHeight, t.kernel_h, t.stride_h, t.pad_top, t.pad_bottom, t.dilation_h),
+                   get_out_size(kInWidth, t.kernel_w, t.stride_w, t.pad_left, t.pad_right, t.dilation_w),
+                   get_out_channels(t), chw);
+}
+
+// Creates the runtime object of the kernel. Buffers were attached by the caller.
+static lib_mli::ExecutionInterface* create_kernel(lib_mli::CompilerGenericInterface* op, bool chw) {
+  const uint32_t runtime_size = op->GetRuntimeObjectSize();
+  const uint32_t private_size = op->GetKernelPrivateDataSize();
+  if (runtime_size > kRuntimeBufSize || private_size > kPrivateBufSize) return nullptr;
+  if (op->GetKernelPrivateData(g_private_buf) != MLI_STATUS_OK) return nullptr;
+
+  // The layout is derived from the input strides by the compiler
+  const auto* private_data = reinterpret_cast<const lib_mli::PrivateData*>(g_private_buf);
+  lib_ref::Layout layout;
+  switch (private_data->kernel_id) {
+    case lib_mli::kConv2dId:
+      layout = reinterpret_cast<const lib_ref::Conv2DPrivateData*>(g_private_buf)->layout;
+      break;
+    case lib_mli::kDWConv2dId:
+      layout = reinterpret_cast<const lib_ref::DepthwiseConv2DPrivateData*>(g_private_buf)->layout;
+      break;
+    default:
+      layout = reinterpret_cast<const lib_ref::Pool2DPrivateData*>(g_private_buf)->layout;
+      break;
+  }
+  if (layout != (chw ? LAYOUT_CHW : LAYOUT_HWC)) return nullptr;
+
+  uint64_t membases[] = { reinterpret_cast<uint64_t>(g_mem_pool) };
+  return lib_mli::ExecutionInterface::Create(g_runtime_buf, runtime_size,
+                                             g_private_buf, private_size,
+                                             membases, sizeof(membases) / sizeof(membases[0]));
+}
+
+static bool run_conv2d(const chw_test_operands& t, bool chw, int32_t* out) {
+  const fmap_desc in_fm(t.batch, kInHeight, kInWidth, kInChannels, chw);
+  const fmap_desc out_fm = get_out_fmap(t, chw);
+
+  uint32_t in_shape[kConvIORank]{ 1, in_fm.height, in_fm.width, 1, in_fm.channels };
+  int32_t in_stride[kConvIORank]{ in_fm.b_stride, in_fm.h_stride, in_fm.w_stride,
+                                  in_fm.c_stride, in_fm.c_stride };
+  uint32_t out_shape[kConvIORank]{ 1, out_fm.height, out_fm.width, 1, out_fm.channels };
+  int32_t out_stride[kConvIORank]{ out_fm.b_stride, out_fm.h_stride, out_fm.w_stride,
+                                   out_fm.c_stride, out_fm.c_stride };
+  uint32_t w_shape[kConvWRank]{ 1, t.kernel_h, t.kernel_w, kInChannels, kConvOutChannels };
+
+  uint32_t out_tile_shape[kConvIORank]{ 1, get_tile_size(out_fm.height, t.tile_h), out_fm.width, 1,
+                                         get_tile_size(out_fm.channels, t.tile_c) };
+
+  const int32_t iteration_order[kConvIOIterRank]{ 0, 1, 2, 3, 4 };
+  const lib_mli::Tensor<lib_mli::NoBuffer, kConvIORank> full_out(out_shape, out_stride);
+  lib_mli::TensorIterator<lib_mli::NoBuffer, kConvIORank, kConvIOIterRank> out_it(full_out, out_tile_shape,
+                                                                                  iteration_order);
+
+  uint32_t effective_kernel_size[kConvIORank]{ 1, (t.kernel_h - 1) * t.dilation_h + 1,
+                                               (t.kernel_w - 1) * t.dilation_w + 1, 1, kInChannels };
+  uint32_t stride[kConvIORank]{ 1, t.stride_h, t.stride_w, 1, 0 };
+  uint32_t pre_padding[kConvIORank]{ 0, t.pad_top, t.pad_left, 0, 0 };
+  const lib_mli::Tensor<lib_mli::NoBuffer, kConvIORank> full_in(in_shape, in_stride);
+  lib_mli::TensorIterator<lib_mli::NoBuffer, kConvIORank, kConvIOIterRank> in_it(full_in, out_it, effective_kernel_size,
+                                                                                 stride, pre_padding);
+
+  const lib_mli::Tensor<lib_mli::NoBuffer, kConvWRank> w_tensor(w_shape);
+  const int32_t zero_inc_mask[kConvWRank]{ 1, 1, 1, 1, 0 };
+  lib_mli::TensorIterator<lib_mli::NoBuffer, kConvWRank, kConvWIterRank> w_it(w_tensor, out_it, nullptr, zero_inc_mask);
+
+  uint32_t wzp_shape[kConvZPRank]{ kConvOutChannels };
+  lib_mli::Tensor<lib_mli::NoBuffer, kConvZPRank> wzp_tensor(wzp_shape);
+  const int32_t wzp_it_order[kConvWRank]{ -1, -1, -1, -1, 0 };
+  lib_mli::TensorIterator<lib_mli::NoBuffer, kConvZPRank, kConvZPIterRank> wzp_it(wzp_tensor, out_it, wzp_it_order, zero_inc_mask);
+
+  uint32_t izp_shape[kInpZPRank]{ 1 };
+  lib_mli::Tensor<lib_mli::NoBuffer, kInpZPRank> izp_tensor(izp_shape);
+  lib_mli::TensorIterator<lib_mli::NoBuffer, kInpZPRank, kConvIterRank> izp_it(izp_tensor);
+
+  lib_mli::Conv2DConfig cfg(t.stride_h, t.stride_w, t.pad_top, t.pad_left, t.pad_bottom, t.pad_right,
+                            t.dilation_h, t.dilation_w, /* groups=1 */ 1);
+
+  lib_mli::PlatformDescription pd;
+  lib_ref::KernelsFactory kernel_factory(pd);
+  if (kernel_factory.Conv2d_CS_GetSize() > kCsBufSize) return false;
+  auto op = kernel_factory.Conv2d_CS(g_cs_buf, in_it, izp_it, w_it, wzp_it, cfg, out_it);
+
+  const uint32_t w_elems = t.kernel_h * t.kernel_w * kInChannels * kConvOutChannels;
+  uint32_t offset = 0;
+  lib_mli::OffsetBuffer in_buf{ offset, 0, in_fm.size(), sizeof(int8_t) };
+  offset += in_fm.size();
+  lib_mli::OffsetBuffer w_buf{ offset, 0, w_elems, sizeof(int8_t) };
+  offset += w_elems;
+  offset = CEIL_RND(offset, sizeof(int32_t));
+  lib_mli::OffsetBuffer out_buf{ offset, 0, out_fm.size() * (uint32_t)sizeof(int32_t), sizeof(int32_t) };
+  offset += out_fm.size() * sizeof(int32_t);
+  const uint32_t inpzp_size = op->GetEncodedInpZeroPtsSize();
+  lib_mli::OffsetBuffer inpzp_buf{ offset, 0, inpzp_size, sizeof(int8_t) };
+  offset += inpzp_size;
+  lib_mli::OffsetBuffer wzp_buf{ offset, 0, kConvOutChannels, sizeof(int8_t) };
+  offset += kConvOutChannels;
+  lib_mli::OffsetBuffer ctrl_buf{ offset, 0, 0, sizeof(char) };
+  if (offset > kMemSize || op->GetCtrlBufferSize() != 0) return false;
+  if (op->AttachBufferOffsets(in_buf, out_buf, w_buf, inpzp_buf, wzp_buf, ctrl_buf) != MLI_STATUS_OK) return false;
+
+  // Whole tensors in the global memory
+  const uint32_t in_global = 0;
+  const uint32_t w_global = in_global + in_fm.size();
+  const uint32_t out_global = CEIL_RND(w_global + w_elems, sizeof(int32_t));
+  if (out_global + out_fm.size() * sizeof(int32_t) > kGlobalMemSize) return false;
+
+  // Uncompressed weights and zero points are kept in memory as is. Zero points are the same
+  // for all channels, so they are written once for all tiles.
+  memset(g_mem_pool, 0, kMemSize);
+  memset(g_global_mem, 0, kGlobalMemSize);
+  write_fmap(in_global, sizeof(int8_t), in_fm, g_input);
+  for (uint32_t i = 0; i < w_elems; i++) write_value(g_global_mem, w_global + i, sizeof(int8_t), g_weights[i]);
+  for (uint32_t i = 0; i < inpzp_size; i++) write_value(g_mem_pool, inpzp_buf.get_offset() + i, sizeof(int8_t), t.in_zp);
+  for (uint32_t i = 0; i < kConvOutChannels; i++) write_value(g_mem_pool, wzp_buf.get_offset() + i, sizeof(int8_t), t.w_zp);
+
+  auto* kernel = dynamic_cast<lib_ref::Conv2d*>(create_kernel(op, chw));
+  if (kernel == nullptr) return false;
+  const auto* private_data = reinterpret_cast<const lib_ref::Conv2DPrivateData*>(g_private_buf);
+  int32_t tile_in_stride[kConvIORank];
+  int32_t tile_out_stride[kConvIORank];
+  int32_t tile_w_stride[kConvWRank];
+  private_data->input.get_mem_strides(tile_in_stride);
+  private_data->output.get_mem_strides(tile_out_stride);
+  private_data->weights.get_mem_strides(tile_w_stride);
+
+  uint32_t in_size[kConvIORank], out_size[kConvIORank], w_size[kConvWRank];
+  int32_t in_offsets[kConvIORank], out_offsets[kConvIORank], w_offsets[kConvWRank];
+  for (uint32_t i = 0; i < out_it.GetTotalCount(); i++) {
+    kernel->GetIOSizesAndOffsets(in_size, out_size, w_size, in_offsets, out_offsets, w_offsets);
+    load_tile(kConvIORank, in_buf, in_global, in_offsets, tile_in_stride, in_size);
+    load_tile(kConvWRank, w_buf, w_global, w_offsets, tile_w_stride, w_size);
+    if (kernel->Prefetch() != MLI_STATUS_OK || kernel->Issue() != MLI_STATUS_OK) return false;
+    store_tile(kConvIORank, out_buf, out_global, out_offsets, tile_out_stride, out_size);
+    if (kernel->Update() != MLI_STATUS_OK) return false;
+  }
+  read_fmap(out_global, sizeof(int32_t), out_fm, out);
+  return true;
+}
+
+static bool run_depthwise_conv2d(const chw_test_operands& t, bool chw, int32_t* out) {
+  const fmap_desc in_fm(t.batch, kInHeight, kInWidth, kInChannels, chw);
+  const fmap_desc out_fm = get_out_fmap(t, chw);
+
+  uint32_t in_shape[kDepthwiseIORank]{ 1, in_fm.height, in_fm.width, 1, in_fm.channels };
+  int32_t in_stride[kDepthwiseIORank]{ in_fm.b_stride, in_fm.h_stride, in_fm.w_stride,
+                                       in_fm.c_stride, in_fm.c_stride };
+  uint32_t out_shape[kDepthwiseIORank]{ 1, out_fm.height, out_fm.width, 1, out_fm.channels };
+  int32_t out_stride[kDepthwiseIORank]{ out_fm.b_stride, out_fm.h_stride, out_fm.w_stride,
+                                        out_fm.c_stride, out_fm.c_stride };
+  uint32_t w_shape[kDepthwiseWRank]{ t.kernel_h, t.kernel_w, kInChannels };
+
+  uint32_t out_tile_shape[kDepthwiseIORank]{ 1, get_tile_size(out_fm.height, t.tile_h), out_fm.width, 1,
+                                              get_tile_size(out_fm.channels, t.tile_c) };
+
+  const int32_t iteration_order[kDepthwiseIterRank]{ 0, 1, 2, 3, 4 };
+  const lib_mli::Tensor<lib_mli::NoBuffer, kDepthwiseIORank> full_out(out_shape, out_stride);
+  lib_mli::TensorIterator<lib_mli::NoBuffer, kDepthwiseIORank, kDepthwiseIterRank> out_it(full_out, out_tile_shape,
+                                                                                          iteration_order);
+
+  uint32_t effective_kernel_size[kDepthwiseIterRank]{ 1, (t.kernel_h - 1) * t.dilation_h + 1,
+                                                      (t.kernel_w - 1) * t.dilation_w + 1, 1, 1 };
+  uint32_t stride[kDepthwiseIORank]{ 1, t.stride_h, t.stride_w, 1, 1 };
+  uint32_t pre_padding[kDepthwiseIORank]{ 0, t.pad_top, t.pad_left, 0, 0 };
+  const lib_mli::Tensor<lib_mli::NoBuffer, kDepthwiseIORank> full_in(in_shape, in_stride);
+  lib_mli::TensorIterator<lib_mli::NoBuffer, kDepthwiseIORank, kDepthwiseIterRank> in_it(full_in, out_it,
+                                                                                         effective_kernel_size,
+                                                                                         stride, pre_padding);
+
+  const lib_mli::Tensor<lib_mli::NoBuffer, kDepthwiseWRank> w_tensor(w_shape);
+  const int32_t zero_inc_mask[kDepthwiseIterRank]{ 1, 1, 1, 1, 0 };
+  const int32_t w_it_order[kDepthwiseIterRank]{ kSkipIterDim, 0, 1, kSkipIterDim, 2 };
+  lib_mli::TensorIterator<lib_mli::NoBuffer, kDepthwiseWRank, kDepthwiseIterRank> w_it(w_tensor, out_it, w_it_order,
+                                                                                       zero_inc_mask);
+
+  uint32_t wzp_shape[kDepthwiseZPRank]{ kInChannels };
+  lib_mli::Tensor<lib_mli::NoBuffer, kDepthwiseZPRank> wzp_tensor(wzp_shape);
+  const int32_t wzp_it_order[kDepthwiseIterRank]{ kSkipIterDim, kSkipIterDim, kSkipIterDim, kSkipIterDim, 0 };
+  lib_mli::TensorIterator<lib_mli::NoBuffer, kDepthwiseZPRank, kDepthwiseIterRank> wzp_it(wzp_tensor, out_it,
+                                                                                         wzp_it_order, zero_inc_mask);
+
+  uint32_t izp_shape[kDepthwiseZPRank]{ 1 };
+  lib_mli::Tensor<lib_mli::NoBuffer, kDepthwiseZPRank> izp_tensor(izp_shape);
+  lib_mli::TensorIterator<lib_mli::NoBuffer, kDepthwiseZPRank, kDepthwiseIterRank> izp_it(izp_tensor);
+
+  lib_mli::DwConv2DConfig cfg(t.stride_h, t.stride_w, t.pad_top, t.pad_left, t.pad_bottom, t.pad_right,
+                              t.dilation_h, t.dilation_w);
+
+  lib_mli::PlatformDescription pd;
+  lib_ref::KernelsFactory kernel_factory(pd);
+  if (kernel_factory.DepthwiseConv2d_CS_GetSize() > kCsBufSize) return false;
+  auto op = kernel_factory.DepthwiseConv2d_CS(g_cs_buf, in_it, izp_it, w_it, wzp_it, cfg, out_it);
+
+  const uint32_t w_elems = t.kernel_h * t.kernel_w * kInChannels;
+  uint32_t offset = 0;
+  lib_mli::OffsetBuffer in_buf{ offset, 0, in_fm.size(), sizeof(int8_t) };
+  offset += in_fm.size();
+  lib_mli::OffsetBuffer w_buf{ offset, 0, w_elems, sizeof(int8_t) };
+  offset += w_elems;
+  offset = CEIL_RND(offset, sizeof(int32_t));
+  lib_mli::OffsetBuffer out_buf{ offset, 0, out_fm.size() * (uint32_t)sizeof(int32_t), sizeof(int32_t) };
+  offset += out_fm.size() * sizeof(int32_t);
+  const uint32_t inpzp_size = op->GetEncodedInpZeroPtsSize();
+  lib_mli::OffsetBuffer inpzp_buf{ offset, 0, inpzp_size, sizeof(int8_t) };
+  offset += inpzp_size;
+  lib_mli::OffsetBuffer wzp_buf{ offset, 0, kInChannels, sizeof(int8_t) };
+  offset += kInChannels;
+  lib_mli::OffsetBuffer ctrl_buf{ offset, 0, 0, sizeof(char) };
+  if (offset > kMemSize || op->GetCtrlBufferSize() != 0) return false;
+  if (op->AttachBufferOffsets(in_buf, out_buf, w_buf, inpzp_buf, wzp_buf, ctrl_buf) != MLI_STATUS_OK) return false;
+
+  const uint32_t in_global = 0;
+  const uint32_t w_global = in_global + in_fm.size();
+  const uint32_t out_global = CEIL_RND(w_global + w_elems, sizeof(int32_t));
+  if (out_global + out_fm.size() * sizeof(int32_t) > kGlobalMemSize) return false;
+
+  memset(g_mem_pool, 0, kMemSize);
+  memset(g_global_mem, 0, kGlobalMemSize);
+  write_fmap(in_global, sizeof(int8_t), in_fm, g_input);
+  for (uint32_t i = 0; i < w_elems; i++) write_value(g_global_mem, w_global + i, sizeof(int8_t), g_weights[i]);
+  for (uint32_t i = 0; i < inpzp_size; i++) write_value(g_mem_pool, inpzp_buf.get_offset() + i, sizeof(int8_t), t.in_zp);
+  for (uint32_t i = 0; i < kInChannels; i++) write_value(g_mem_pool, wzp_buf.get_offset() + i, sizeof(int8_t), t.w_zp);
+
+  auto* kernel = dynamic_cast<lib_ref::DepthwiseConv2d*>(create_kernel(op, chw));
+  if (kernel == nullptr) return false;
+  const auto* private_data = reinterpret_cast<const lib_ref::DepthwiseConv2DPrivateData*>(g_private_buf);
+  int32_t tile_in_stride[kDepthwiseIORank];
+  int32_t tile_out_stride[kDepthwiseIORank];
+  int32_t tile_w_stride[kDepthwiseWRank];
+  private_data->input.get_mem_strides(tile_in_stride);
+  private_data->output.get_mem_strides(tile_out_stride);
+  private_data->weights.get_mem_strides(tile_w_stride);
+
+  uint32_t in_size[kDepthwiseIORank], out_size[kDepthwiseIORank], w_size[kDepthwiseWRank];
+  int32_t in_offsets[kDepthwiseIORank], out_offsets[kDepthwiseIORank], w_offsets[kDepthwiseWRank];
+  for (uint32_t i = 0; i < out_it.GetTotalCount(); i++) {
+    kernel->GetIOSizesAndOffsets(in_size, out_size, w_size, in_offsets, out_offsets, w_offsets);
+    load_tile(kDepthwiseIORank, in_buf, in_global, in_offsets, tile_in_stride, in_size);
+    load_tile(kDepthwiseWRank, w_buf, w_global, w_offsets, tile_w_stride, w_size);
+    if (kernel->Prefetch() != MLI_STATUS_OK || kernel->Issue() != MLI_STATUS_OK) return false;
+    store_tile(kDepthwiseIORank, out_buf, out_global, out_offsets, tile_out_stride, out_size);
+    if (kernel->Update() != MLI_STATUS_OK) return false;
+  }
+  read_fmap(out_global, sizeof(int32_t), out_fm, out);
+  return true;
+}
+
+static bool run_pool2d(const chw_test_operands& t, bool chw, int32_t* out) {
+  const fmap_desc in_fm(t.batch, kInHeight, kInWidth, kInChannels, chw);
+  const fmap_desc out_fm = get_out_fmap(t, chw);
+  const uint32_t out_elem_size = t.kernel == kSumPool2D ? sizeof(int32_t) : t.elem_size;
+
+  uint32_t in_shape[kPoolRank]{ in_fm.batch, in_fm.height, in_fm.width, in_fm.channels };
+  int32_t in_stride[kPoolRank]{ in_fm.b_stride, in_fm.h_stride, in_fm.w_stride, in_fm.c_stride };
+  uint32_t out_shape[kPoolRank]{ out_fm.batch, out_fm.height, out_fm.width, out_fm.channels };
+  int32_t out_stride[kPoolRank]{ out_fm.b_stride, out_fm.h_stride, out_fm.w_stride, out_fm.c_stride };
+
+  uint32_t out_tile_shape[kPoolRank]{ out_fm.batch, get_tile_size(out_fm.height, t.tile_h), out_fm.width,
+                                      get_tile_size(out_fm.channels, t.tile_c) };
+
+  const int32_t iteration_order[kPoolIterRank]{ 0, 1, 2, 3 };
+  const lib_mli::Tensor<lib_mli::NoBuffer, kPoolRank> full_out(out_shape, out_stride);
+  lib_mli::TensorIterator<lib_mli::NoBuffer, kPoolRank, kPoolIterRank> out_it(full_out, out_tile_shape, iteration_order);
+
+  uint32_t effective_kernel_size[kPoolIterRank]{ 1, t.kernel_h, t.kernel_w, 1 };
+  uint32_t stride[kPoolIterRank]{ 1, t.stride_h, t.stride_w, 1 };
+  uint32_t pre_padding[kPoolIterRank]{ 0, t.pad_top, t.pad_left, 0 };
+  const lib_mli::Tensor<lib_mli::NoBuffer, kPoolRank> full_in(in_shape, in_stride);
+  lib_mli::TensorIterator<lib_mli::NoBuffer, kPoolRank, kPoolIterRank> in_it(full_in, out_it, effective_kernel_size,
+                                                                             stride, pre_padding);
+
+  lib_mli::PoolOpConfig cfg(t.kernel_h, t.kernel_w, t.stride_h, t.stride_w,
+                            t.pad_top, t.pad_left, t.pad_bottom, t.pad_right);
+
+  lib_mli::PlatformDescription pd;
+  lib_ref::KernelsFactory kernel_factory(pd);
+  lib_mli::CompilerGenericInterface* op;
+  uint32_t offset = 0;
+  lib_mli::OffsetBuffer in_buf{ offset, 0, in_fm.size() * t.elem_size, t.elem_size };
+  offset += in_fm.size() * t.elem_size;
+  offset = CEIL_RND(offset, out_elem_size);
+  lib_mli::OffsetBuffer out_buf{ offset, 0, out_fm.size() * out_elem_size, out_elem_size };
+  offset += out_fm.size() * out_elem_size;
+  lib_mli::OffsetBuffer ctrl_buf{ offset, 0, 0, sizeof(char) };
+  if (offset > kMemSize) return false;
+
+  if (t.kernel == kMaxPool2D) {
+    if (kernel_factory.MaxPool2D_CS_GetSize() > kCsBufSize) return false;
+    auto maxpool_op = kernel_factory.MaxPool2D_CS(g_cs_buf, in_it, cfg, out_it);
+    if (maxpool_op->AttachBufferOffsets(in_buf, out_buf, ctrl_buf) != MLI_STATUS_OK) return false;
+    op = maxpool_op;
+  } else {
+    if (kernel_factory.SumPool2D_CS_GetSize() > kCsBufSize) return false;
+    auto sumpool_op = kernel_factory.SumPool2D_CS(g_cs_buf, in_it, cfg, out_it);
+    if (sumpool_op->AttachBufferOffsets(in_buf, out_buf, ctrl_buf) != MLI_STATUS_OK) return false;
+    op = sumpool_op;
+  }
+
+  const uint32_t in_global = 0;
+  const uint32_t out_global = CEIL_RND(in_global + in_fm.size() * t.elem_size, out_elem_size);
+  if (out_global + out_fm.size() * out_elem_size > kGlobalMemSize) return false;
+
+  memset(g_mem_pool, 0, kMemSize);
+  memset(g_global_mem, 0, kGlobalMemSize);
+  write_fmap(in_global, t.elem_size, in_fm, g_input);
+
+  lib_mli::ExecutionInterface* kernel = create_kernel(op, chw);
+  auto* maxpool = dynamic_cast<lib_ref::MaxPool2D*>(kernel);
+  auto* sumpool = dynamic_cast<lib_ref::SumPool2D*>(kernel);
+  if (maxpool == nullptr && sumpool == nullptr) return false;
+  const auto* private_data = reinterpret_cast<const lib_ref::Pool2DPrivateData*>(g_private_buf);
+  int32_t tile_in_stride[kPoolRank];
+  int32_t tile_out_stride[kPoolRank];
+  private_data->input.get_mem_strides(tile_in_stride);
+  private_data->output.get_mem_strides(tile_out_stride);
+
+  uint32_t in_size[kPoolRank], out_size[kPoolRank];
+  int32_t in_offsets[kPoolRank], out_offsets[kPoolRank];
+  for (uint32_t i = 0; i < out_it.GetTotalCount(); i++) {
+    if (maxpool != nullptr) {
+      maxpool->GetIOSizesAndOffsets(in_size, out_size, in_offsets, out_offsets);
+    } else {
+      sumpool->GetIOSizesAndOffsets(in_size, out_size, in_offsets, out_offsets);
+    }
+    load_tile(kPoolRank, in_buf, in_global, in_offsets, tile_in_stride, in_size);
+    if (kernel->Prefetch() != MLI_STATUS_OK || kernel->Issue() != MLI_STATUS_OK) return false;
+    store_tile(kPoolRank, out_buf, out_global, out_offsets, tile_out_stride, out_size);
+    if (kernel->Update() != MLI_STATUS_OK) return false;
+  }
+  read_fmap(out_global, out_elem_size, out_fm, out);
+  return true;
+}
+
+static bool run_test(const chw_test_operands& t, bool chw, int32_t* out) {
+  switch (t.kernel) {
+    case kConv2d:
+      return run_conv2d(t, chw, out);
+    case kDepthwiseConv2d:
+      return run_depthwise_conv2d(t, chw, out);
+    default:
+      return run_pool2d(t, chw, out);
+  }
+}
+
+int main() {
+  const reporter_basic reporter;
+  bool final_status = true;
+
+  reporter.report_header("MLI|Kernels|CHW Layout Tests");
+  for (uint32_t test_idx = 0; test_idx < kTestsNum; ++test_idx) {
+    const chw_test_operands& t = tests_list[test_idx];
+    bool is_test_passed = true;
+    const char* msg = "";
+
+    // Weights have some zeros to cover skipping of zero products by CHW convolutions
+    const int32_t in_max = t.elem_size == sizeof(int8_t) ? 127 : 4000;
+    for (auto& val : g_input) val = rand_value(-in_max, in_max);
+    for (auto& val : g_weights) val = rand_value(-4, 4);
+
+    const uint32_t out_elems = get_out_fmap(t, false).size();
+    if (!run_test(t, false, g_out_hwc)) {
+      is_test_passed = false;
+      msg = "FAILED at HWC run";
+    } else if (!run_test(t, true, g_out_chw)) {
+      is_test_passed = false;
+      msg = "FAILED at CHW run";
+    } else if (memcmp(g_out_hwc, g_out_chw, out_elems * sizeof(int32_t)) != 0) {
+      is_test_passed = false;
+      msg = "FAILED as CHW result differs from HWC";
+    } else if (t.tile_h != 0 || t.tile_c != 0) {
+      // Tiled results must also match the whole feature map processed at once
+      chw_test_operands untiled = t;
+      untiled.tile_h = untiled.tile_c = 0;
+      if (!run_test(untiled, false, g_out_untiled)) {
+        is_test_passed = false;
+        msg = "FAILED at untiled HWC run";
+      } else if (memcmp(g_out_hwc, g_out_untiled, out_elems * sizeof(int32_t)) != 0) {
+        is_test_passed = false;
+        msg = "FAILED as tiled result differs from untiled";
+      }
+    }
+
+    reporter.report_case(t.descr, msg, is_test_passed);
+    final_status &= is_test_passed;
+  }
+  reporter.report_outline("[AUTO] Group: mli_krn_chw_layout_30", final_status);
+
+  return (final_status) ? 0 : 1;
+}
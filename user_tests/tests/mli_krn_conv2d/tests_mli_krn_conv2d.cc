@@ -14,6 +14,7 @@
 #include <stdio.h>
 #include <string.h>
 
+#include "test_benchmark.h"
 #include "test_crc32_calc.h"
 #include "test_memory_manager.h"
 #include "test_quality_metrics.h"
@@ -29,6 +30,9 @@ using mli::tst::quality_metrics;
 using mli::tst::crc32_calc;
 using mli::tst::reporter_full;
 using mli::tst::memory_manager;
+using mli::tst::benchmark_reporter;
+using mli::tst::bench_data_bytes;
+using mli::tst::bench_memory_footprint;
 
 typedef mli_status(*conv2d_func_ptr)(
     const mli_tensor* /*input*/,
@@ -37,6 +41,19 @@ typedef mli_status(*conv2d_func_ptr)(
     const mli_conv2d_cfg* /*cfg*/,
     mli_tensor* /*output*/);
 
+// Pre-validated layer: checks and quantization params derivation are done once at prepare step
+static mli_status mli_krn_conv2d_hwcn_sa8_sa8_sa32_prepared(
+        const mli_tensor* in,
+        const mli_tensor* weights,
+        const mli_tensor* bias,
+        const mli_conv2d_cfg* cfg,
+        mli_tensor* out) {
+    mli_conv2d_prepared prepared;
+    mli_status ret = mli_krn_conv2d_hwcn_sa8_sa8_sa32_prepare(in, weights, bias, cfg, out, &prepared);
+    if (ret != MLI_STATUS_OK) return ret;
+    return mli_krn_conv2d_hwcn_sa8_sa8_sa32_run_prepared(&prepared, in, out);
+}
+
 struct conv2d_test_operands {
     const char* descr;
     const conv2d_func_ptr mli_krn_conv2d;
@@ -251,18 +268,132 @@ static const conv2d_test_operands tests_list[] = {
     {"Test 11 SA8_SA8_SA32 Huge Vals", mli_krn_conv2d_hwcn_sa8_sa8_sa32, 
                                        input_2_sa8, weights_6_sa8, bias_2_i2_w6_sa32, test_11_out_sa8, test_11_cfg,
                                        thresholds_sa8_general, test_11_chksum_sa8},
+
+    // Pre-validated layers must give the same results as the kernels chosen by the user
+    {"Test 1 SA8 Prepared",           mli_krn_conv2d_hwcn_sa8_sa8_sa32_prepared,
+                                      input_1_sa8, weights_1_sa8, bias_1_sa32, test_1_out_sa8, test_1_cfg,
+                                      thresholds_sa8_general, test_1_chksum_sa8},
+    {"Test 2 SA8 Prepared ReluGen",   mli_krn_conv2d_hwcn_sa8_sa8_sa32_prepared,
+                                      input_1_sa8, weights_2_sa8, bias_1_w2_per_tensor_sa32, test_2_out_sa8, test_2_cfg,
+                                      thresholds_sa8_general, test_2_chksum_sa8},
+    {"Test 6 SA8 Prepared k1x1",      mli_krn_conv2d_hwcn_sa8_sa8_sa32_prepared,
+                                      input_1_sa8, weights_3_memstr_sa8, bias_1_w3_sa32, test_6_out_sa8,
+                                      test_6_cfg, thresholds_sa8_general, test_6_chksum_sa8},
+    {"Test 7 SA8 Prepared k3x3",      mli_krn_conv2d_hwcn_sa8_sa8_sa32_prepared,
+                                      input_1_sa8, weights_4_memstr_sa8, bias_1_w4_sa32, test_7_out_sa8, test_7_cfg,
+                                      thresholds_sa8_general, test_7_chksum_sa8},
+    {"Test 8 SA8 Prepared k5x5",      mli_krn_conv2d_hwcn_sa8_sa8_sa32_prepared,
+                                      input_1_sa8, weights_5_memstr_sa8, bias_1_w5_sa32, test_8_out_sa8, test_8_cfg,
+                                      thresholds_sa8_general, test_8_chksum_sa8},
+    {"Test 9-1 SA8 Prepared Dil+Pad", mli_krn_conv2d_hwcn_sa8_sa8_sa32_prepared,
+                                      input_1_sa8, weights_4_memstr_sa8, bias_1_w4_sa32, test_9_out_sa8,
+                                      test_9_cfg, thresholds_sa8_general, test_9_chksum_sa8},
+    {"Test 11 SA8 Prepared Huge Vals", mli_krn_conv2d_hwcn_sa8_sa8_sa32_prepared,
+                                      input_2_sa8, weights_6_sa8, bias_2_i2_w6_sa32, test_11_out_sa8, test_11_cfg,
+                                      thresholds_sa8_general, test_11_chksum_sa8},
+};
+
+typedef mli_status(*conv2d_winograd_func_ptr)(
+    const mli_tensor* /*input*/,
+    const mli_tensor* /*weights*/,
+    const mli_tensor* /*wino_weights*/,
+    const mli_tensor* /*bias*/,
+    const mli_conv2d_cfg* /*cfg*/,
+    mli_tensor* /*output*/);
+
+struct conv2d_winograd_test_operands {
+    const char* descr;
+    const conv2d_func_ptr mli_krn_conv2d;
+    const conv2d_winograd_func_ptr mli_krn_conv2d_winograd;
+    const mli_winograd_type type;
+    tensor_quantizer in;
+    tensor_quantizer weights;
+    tensor_quantizer bias;
+    tensor_quantizer out;
 };
 
+// Winograd specialization tests: kernel_size=(3, 3), strides=(1, 1), krn_padding and ReLU_Gen.
+// Output must be bitwise equal to the direct k3x3 specialization. Output size (7x7) isn't
+// a multiple of output tile, so partial tiles are also covered. Memstrides are applied
+// on output and weights tensors
+const mli_conv2d_cfg winograd_test_cfg = {
+    /* .relu.type = */MLI_RELU_GEN,
+    /* .stride_width = */1,
+    /* .stride_height = */1,
+    /* .padding_left = */1,
+    /* .padding_right = */1,
+    /* .padding_top = */1,
+    /* .padding_bottom = */1,
+    /* .dilation_width = */1,
+    /* .dilation_height = */1
+};
+
+static const conv2d_winograd_test_operands winograd_tests_list[] = {
+    {"Test 12-1 FX16 Wino F2",         mli_krn_conv2d_hwcn_fx16_k3x3, mli_krn_conv2d_hwcn_fx16_k3x3_winograd,
+                                         MLI_WINOGRAD_F2X2_3X3,
+                                         input_1_fx16, weights_4_memstr_fx16, bias_1_fx16, test_9_out_fx16},
+    {"Test 12-1 FX16_FX8_FX8 Wino F2", mli_krn_conv2d_hwcn_fx16_fx8_fx8_k3x3, mli_krn_conv2d_hwcn_fx16_fx8_fx8_k3x3_winograd,
+                                         MLI_WINOGRAD_F2X2_3X3,
+                                         input_1_fx16, weights_4_memstr_fx8, bias_1_fx8, test_9_out_fx16},
+    {"Test 12-1 SA8_SA8_SA32 Wino F2", mli_krn_conv2d_hwcn_sa8_sa8_sa32_k3x3, mli_krn_conv2d_hwcn_sa8_sa8_sa32_k3x3_winograd,
+                                         MLI_WINOGRAD_F2X2_3X3,
+                                         input_1_sa8, weights_4_memstr_sa8, bias_1_w4_sa32, test_9_out_sa8},
+    {"Test 12-2 FX16 Wino F4",         mli_krn_conv2d_hwcn_fx16_k3x3, mli_krn_conv2d_hwcn_fx16_k3x3_winograd,
+                                         MLI_WINOGRAD_F4X4_3X3,
+                                         input_1_fx16, weights_4_memstr_fx16, bias_1_fx16, test_9_out_fx16},
+    {"Test 12-2 FX16_FX8_FX8 Wino F4", mli_krn_conv2d_hwcn_fx16_fx8_fx8_k3x3, mli_krn_conv2d_hwcn_fx16_fx8_fx8_k3x3_winograd,
+                                         MLI_WINOGRAD_F4X4_3X3,
+                                         input_1_fx16, weights_4_memstr_fx8, bias_1_fx8, test_9_out_fx16},
+    {"Test 12-2 SA8_SA8_SA32 Wino F4", mli_krn_conv2d_hwcn_sa8_sa8_sa32_k3x3, mli_krn_conv2d_hwcn_sa8_sa8_sa32_k3x3_winograd,
+                                         MLI_WINOGRAD_F4X4_3X3,
+                                         input_1_sa8, weights_4_memstr_sa8, bias_1_w4_sa32, test_9_out_sa8},
+};
+
+// Pre-validated layer with 1x1 kernel and asymmetric padding, which must not be mapped to
+// the k1x1 specialization. The descriptor is prepared once and run for several inputs placed
+// in different memory. Output must be bitwise equal to the generic kernel.
+const mli_conv2d_cfg prepared_pad_test_cfg = {
+    /* .relu.type = */MLI_RELU_GEN,
+    /* .stride_width = */1,
+    /* .stride_height = */1,
+    /* .padding_left = */1,
+    /* .padding_right = */2,
+    /* .padding_top = */2,
+    /* .padding_bottom = */1,
+    /* .dilation_width = */1,
+    /* .dilation_height = */1
+};
+constexpr int kPreparedRunsNum = 2;
+
 constexpr int kMemSize = 2247;
 static IO_DATA_ATTR int8_t scratch_mem_in[kMemSize] = { 0 };
 static IO_DATA_ATTR int8_t scratch_mem_out[kMemSize] = { 0 };
+static IO_DATA_ATTR int8_t scratch_mem_ref_out[kMemSize] = { 0 };
 static W_DATA_ATTR int8_t scratch_mem_w[kMemSize] = { 0 };
 static W_DATA_ATTR int8_t scratch_mem_b[kMemSize] = { 0 };
+// Transformed weights of the largest (6x6) tile for 3 input and 7 output channels
+static W_DATA_ATTR int32_t scratch_mem_wino[6 * 6 * 3 * 7] = { 0 };
 
 constexpr int kTestsNum = sizeof(tests_list) / sizeof(tests_list[0]);
+constexpr int kWinogradTestsNum = sizeof(winograd_tests_list) / sizeof(winograd_tests_list[0]);
+
+static bool is_bitwise_equal_hwc(const mli_tensor& pred, const mli_tensor& ref) {
+    const uint32_t elem_size = mli_hlp_tensor_element_size(&pred);
+    for (uint32_t h = 0; h < pred.shape[0]; ++h) {
+        for (uint32_t w = 0; w < pred.shape[1]; ++w) {
+            for (uint32_t c = 0; c < pred.shape[2]; ++c) {
+                const uint32_t idx = h * pred.mem_stride[0] + w * pred.mem_stride[1] + c * pred.mem_stride[2];
+                if (memcmp(pred.data.mem.pi8 + idx * elem_size, ref.data.mem.pi8 + idx * elem_size, elem_size) != 0)
+                    return false;
+            }
+        }
+    }
+    return true;
+}
 
 int main() {
     const reporter_full reporter;
+    benchmark_reporter bench;
     bool final_status = true;
 
     reporter.report_header("MLI|Kernels|Convolution 2D  Tests");
@@ -290,7 +421,8 @@ int main() {
                 strstr(cur_test->descr, "Test 10 FX16 k5x5 Dil") != nullptr ||
                 strstr(cur_test->descr, "Test 10 SA8_SA8_SA32 k5x5 Dil") != nullptr || 
                 strstr(cur_test->descr, "Test 11 FX16 Huge Vals") != nullptr ||
-                strstr(cur_test->descr, "Test 11 SA8_SA8_SA32 Huge Vals") != nullptr) {
+                strstr(cur_test->descr, "Test 11 SA8_SA8_SA32 Huge Vals") != nullptr ||
+                strstr(cur_test->descr, "SA8 Prepared") != nullptr) {
             // VPX fails bitwise comparison with reference .
             reporter.report_message(cur_test->descr, "SKIPPED due to a known issue");
             continue;
@@ -300,7 +432,9 @@ int main() {
 #if PLATFORM == V2DSP_XY && defined(CRC_RM_CONVERGENT)
         if (strstr(cur_test->descr, "Test 1 SA8_SA8_SA32") != nullptr ||
                 strstr(cur_test->descr, "Test 9-1 SA8_SA8_SA32 Dil+Pad") != nullptr ||
-                strstr(cur_test->descr, "Test 9-2 SA8_SA8_SA32 k3x3 Dil") != nullptr) {
+                strstr(cur_test->descr, "Test 9-2 SA8_SA8_SA32 k3x3 Dil") != nullptr ||
+                strstr(cur_test->descr, "Test 1 SA8 Prepared") != nullptr ||
+                strstr(cur_test->descr, "Test 9-1 SA8 Prepared") != nullptr) {
             // Em9d fails bitwise comparison with reference .
             reporter.report_message(cur_test->descr, "SKIPPED due to a known issue");
             continue;
@@ -336,7 +470,7 @@ int main() {
 
         // Run specific kernel for test
         if (is_test_passed &&
-                cur_test->mli_krn_conv2d(&input, &weights, &bias, &cur_test->cfg, &out) != MLI_STATUS_OK) {
+                bench.measure([&] { return cur_test->mli_krn_conv2d(&input, &weights, &bias, &cur_test->cfg, &out); }) != MLI_STATUS_OK) {
             reporter.report_message(cur_test->descr, "FAILED at kernel run: kernel returned bad status");
             is_test_passed = false;
         }
@@ -364,9 +498,209 @@ int main() {
             is_test_passed &= reporter.evaluate_and_report_case(cur_test->descr, test_metics, cur_test->threshold, 
                                                                 data_crc, cur_test->check_sum);
         }
+        if (is_test_passed) {
+            bench.add_case(cur_test->descr, mli_hlp_count_elem_num(&out, 0) * mli_hlp_count_elem_num(&weights, 0) / weights.shape[3],
+                           bench_data_bytes({&input, &weights, &bias, &out}),
+                           bench_memory_footprint({&input, &weights, &bias, &out}));
+        }
+        final_status &= is_test_passed;
+    }
+
+    for (int i = 0; i < kWinogradTestsNum; ++i) {
+        memory_manager mem_in_keeper((int8_t*)(scratch_mem_in), sizeof(scratch_mem_in));
+        memory_manager mem_out_keeper((int8_t*)(scratch_mem_out), sizeof(scratch_mem_out));
+        memory_manager mem_ref_out_keeper((int8_t*)(scratch_mem_ref_out), sizeof(scratch_mem_ref_out));
+        memory_manager mem_w_keeper((int8_t*)(scratch_mem_w), sizeof(scratch_mem_w));
+        memory_manager mem_b_keeper((int8_t*)(scratch_mem_b), sizeof(scratch_mem_b));
+        bool is_test_passed = true;
+        const conv2d_winograd_test_operands* cur_test = &winograd_tests_list[i];
+
+        if (!(cur_test->in.is_valid() && cur_test->weights.is_valid() &&
+                cur_test->bias.is_valid() && cur_test->out.is_valid())) {
+            reporter.report_message(cur_test->descr, "FAILED at init: Bad source data for one of tensors");
+            is_test_passed = false;
+        }
+
+        mli_tensor input = cur_test->in.get_quantized_tensor(mem_in_keeper.allocate_memory(cur_test->in));
+        mli_tensor weights = cur_test->weights.get_quantized_tensor(mem_w_keeper.allocate_memory(cur_test->weights));
+        mli_tensor bias = cur_test->bias.get_quantized_tensor(mem_b_keeper.allocate_memory(cur_test->bias));
+        mli_tensor out = cur_test->out.get_not_quantized_tensor(mem_out_keeper.allocate_memory(cur_test->out));
+        mli_tensor ref_out = cur_test->out.get_not_quantized_tensor(mem_ref_out_keeper.allocate_memory(cur_test->out));
+        mli_tensor wino_weights = { 0 };
+        wino_weights.data.capacity = sizeof(scratch_mem_wino);
+        wino_weights.data.mem.pi32 = scratch_mem_wino;
+        if (is_test_passed &&
+                (tensor_quantizer::validate_tensor(input) != tensor_quantizer::kOk ||
+                 tensor_quantizer::validate_tensor(weights) != tensor_quantizer::kOk||
+                 tensor_quantizer::validate_tensor(bias) != tensor_quantizer::kOk ||
+                 tensor_quantizer::validate_tensor(out) != tensor_quantizer::kOk ||
+                 tensor_quantizer::validate_tensor(ref_out) != tensor_quantizer::kOk)) {
+            reporter.report_message(cur_test->descr,
+                                    "FAILED at quantization step: more memory for one of tensors might be required");
+            is_test_passed = false;
+        }
+
+        if (is_test_passed &&
+                mli_hlp_conv2d_winograd_weights(&weights, cur_test->type, &wino_weights) != MLI_STATUS_OK) {
+            reporter.report_message(cur_test->descr, "FAILED at weights transform: helper returned bad status");
+            is_test_passed = false;
+        }
+
+        // Run direct and Winograd kernels for test
+        if (is_test_passed &&
+                (cur_test->mli_krn_conv2d(&input, &weights, &bias, &winograd_test_cfg, &ref_out) != MLI_STATUS_OK ||
+                 bench.measure([&] { return cur_test->mli_krn_conv2d_winograd(&input, &weights, &wino_weights, &bias,
+                                                                              &winograd_test_cfg, &out); })
+                     != MLI_STATUS_OK)) {
+            reporter.report_message(cur_test->descr, "FAILED at kernel run: kernel returned bad status");
+            is_test_passed = false;
+        }
+
+        if (is_test_passed &&
+                (mem_in_keeper.is_memory_corrupted() || mem_out_keeper.is_memory_corrupted() ||
+                mem_ref_out_keeper.is_memory_corrupted() || mem_w_keeper.is_memory_corrupted() ||
+                mem_b_keeper.is_memory_corrupted())) {
+            reporter.report_message(cur_test->descr,
+                "FAILED after kernel run: memory beside one of operands is corrupted");
+            is_test_passed = false;
+        }
+
+        if (is_test_passed && !is_bitwise_equal_hwc(out, ref_out)) {
+            reporter.report_message(cur_test->descr, "FAILED at comparison output with direct k3x3 kernel");
+            is_test_passed = false;
+        }
+
+        if (is_test_passed) {
+            reporter.report_message(cur_test->descr, "PASSED: bitwise equal to direct k3x3 kernel");
+            bench.add_case(cur_test->descr, mli_hlp_count_elem_num(&out, 0) * mli_hlp_count_elem_num(&weights, 0) / weights.shape[3],
+                           bench_data_bytes({&input, &wino_weights, &bias, &out}),
+                           bench_memory_footprint({&input, &wino_weights, &bias, &out}));
+        }
+        final_status &= is_test_passed;
+    }
+
+    {
+        const char* descr = "Test 13 SA8 Prepared k1x1 Pad";
+        memory_manager mem_in_keeper((int8_t*)(scratch_mem_in), sizeof(scratch_mem_in));
+        memory_manager mem_out_keeper((int8_t*)(scratch_mem_out), sizeof(scratch_mem_out));
+        memory_manager mem_ref_out_keeper((int8_t*)(scratch_mem_ref_out), sizeof(scratch_mem_ref_out));
+        memory_manager mem_w_keeper((int8_t*)(scratch_mem_w), sizeof(scratch_mem_w));
+        memory_manager mem_b_keeper((int8_t*)(scratch_mem_b), sizeof(scratch_mem_b));
+        bool is_test_passed = true;
+        const tensor_quantizer& in_quant = input_1_sa8;
+        const tensor_quantizer& out_quant = test_6_out_sa8;
+
+        if (!(in_quant.is_valid() && weights_3_memstr_sa8.is_valid() &&
+                bias_1_w3_sa32.is_valid() && out_quant.is_valid())) {
+            reporter.report_message(descr, "FAILED at init: Bad source data for one of tensors");
+            is_test_passed = false;
+        }
+
+        // Quantization params are kept in memory of the quantized tensors. Data of each run
+        // is placed after them, so a single region per keeper is used for all runs.
+        mli_data_container in_req = mem_in_keeper.allocate_memory(in_quant);
+        mli_data_container out_req = mem_out_keeper.allocate_memory(out_quant);
+        mem_in_keeper.return_memory();
+        mem_out_keeper.return_memory();
+
+        const mli_tensor in_templ = in_quant.get_source_float_tensor();
+        const uint32_t in_size = mli_hlp_count_elem_num(&in_templ, 0);
+        const uint32_t out_h = in_templ.shape[0] + prepared_pad_test_cfg.padding_top +
+                               prepared_pad_test_cfg.padding_bottom;
+        const uint32_t out_w = in_templ.shape[1] + prepared_pad_test_cfg.padding_left +
+                               prepared_pad_test_cfg.padding_right;
+        const uint32_t out_c = weights_3_memstr_sa8.get_source_float_tensor().shape[KRNL_C_DIM_HWCN];
+        const uint32_t out_size = out_h * out_w * out_c;
+
+        mli_data_container in_mem = mem_in_keeper.allocate_memory(in_req.capacity + in_size * kPreparedRunsNum);
+        mli_data_container out_mem = mem_out_keeper.allocate_memory(out_req.capacity + out_size * kPreparedRunsNum);
+        mli_data_container ref_out_mem = mem_ref_out_keeper.allocate_memory(out_size * kPreparedRunsNum);
+        mli_tensor weights = weights_3_memstr_sa8.get_quantized_tensor(mem_w_keeper.allocate_memory(weights_3_memstr_sa8));
+        mli_tensor bias = bias_1_w3_sa32.get_quantized_tensor(mem_b_keeper.allocate_memory(bias_1_w3_sa32));
+
+        mli_data_container in_params_mem = in_mem;
+        in_params_mem.capacity = in_req.capacity;
+        mli_data_container out_params_mem = out_mem;
+        out_params_mem.capacity = out_req.capacity;
+        const mli_tensor input = in_quant.get_quantized_tensor(in_params_mem);
+        const mli_tensor out_templ = out_quant.get_not_quantized_tensor(out_params_mem);
+        if (is_test_passed &&
+                (in_mem.mem.pi8 == nullptr || out_mem.mem.pi8 == nullptr || ref_out_mem.mem.pi8 == nullptr ||
+                 tensor_quantizer::validate_tensor(input) != tensor_quantizer::kOk ||
+                 tensor_quantizer::validate_tensor(weights) != tensor_quantizer::kOk ||
+                 tensor_quantizer::validate_tensor(bias) != tensor_quantizer::kOk ||
+                 tensor_quantizer::validate_tensor(out_templ) != tensor_quantizer::kOk)) {
+            reporter.report_message(descr,
+                                    "FAILED at quantization step: more memory for one of tensors might be required");
+            is_test_passed = false;
+        }
+
+        // Each run has its own input and output. Inputs of the next runs have different values.
+        mli_tensor inputs[kPreparedRunsNum];
+        mli_tensor outs[kPreparedRunsNum];
+        mli_tensor ref_outs[kPreparedRunsNum];
+        for (int run = 0; run < kPreparedRunsNum && is_test_passed; ++run) {
+            inputs[run] = input;
+            inputs[run].data.capacity = in_size;
+            inputs[run].data.mem.pi8 = in_mem.mem.pi8 + in_req.capacity + run * in_size;
+            for (uint32_t idx = 0; idx < in_size; ++idx) {
+                const int8_t val = input.data.mem.pi8[idx];
+                inputs[run].data.mem.pi8[idx] = (run == 0) ? val : (int8_t)~val;
+            }
+
+            outs[run] = out_templ;
+            outs[run].shape[0] = out_h;
+            outs[run].shape[1] = out_w;
+            outs[run].mem_stride[0] = out_w * out_c;
+            outs[run].mem_stride[1] = out_c;
+            outs[run].mem_stride[2] = 1;
+            outs[run].data.capacity = out_size;
+            outs[run].data.mem.pi8 = out_mem.mem.pi8 + out_req.capacity + run * out_size;
+            ref_outs[run] = outs[run];
+            ref_outs[run].data.mem.pi8 = ref_out_mem.mem.pi8 + run * out_size;
+        }
+
+        // Prepare once, then run the same descriptor for each input
+        mli_conv2d_prepared prepared;
+        if (is_test_passed &&
+                mli_krn_conv2d_hwcn_sa8_sa8_sa32_prepare(&inputs[0], &weights, &bias, &prepared_pad_test_cfg,
+                                                         &outs[0], &prepared) != MLI_STATUS_OK) {
+            reporter.report_message(descr, "FAILED at prepare: kernel returned bad status");
+            is_test_passed = false;
+        }
+        for (int run = 0; run < kPreparedRunsNum && is_test_passed; ++run) {
+            if (mli_krn_conv2d_hwcn_sa8_sa8_sa32(&inputs[run], &weights, &bias, &prepared_pad_test_cfg,
+                                                 &ref_outs[run]) != MLI_STATUS_OK ||
+                    mli_krn_conv2d_hwcn_sa8_sa8_sa32_run_prepared(&prepared, &inputs[run], &outs[run])
+                        != MLI_STATUS_OK) {
+                reporter.report_message(descr, "FAILED at kernel run: kernel returned bad status");
+                is_test_passed = false;
+            }
+        }
+
+        if (is_test_passed &&
+                (mem_in_keeper.is_memory_corrupted() || mem_out_keeper.is_memory_corrupted() ||
+                mem_ref_out_keeper.is_memory_corrupted() || mem_w_keeper.is_memory_corrupted() ||
+                mem_b_keeper.is_memory_corrupted())) {
+            reporter.report_message(descr,
+                "FAILED after kernel run: memory beside one of operands is corrupted");
+            is_test_passed = false;
+        }
+
+        for (int run = 0; run < kPreparedRunsNum && is_test_passed; ++run) {
+            if (!is_bitwise_equal_hwc(outs[run], ref_outs[run])) {
+                reporter.report_message(descr, "FAILED at comparison output with generic kernel");
+                is_test_passed = false;
+            }
+        }
+
+        if (is_test_passed) {
+            reporter.report_message(descr, "PASSED: bitwise equal to generic kernel for each run");
+        }
         final_status &= is_test_passed;
     }
 
+    bench.report("mli_krn_conv2d");
     reporter.report_outline("[AUTO] Group: mli_krn_conv2d", final_status);
 
     return (final_status) ? 0 : 1;
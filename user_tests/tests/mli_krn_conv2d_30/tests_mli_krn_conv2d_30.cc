@@ -20,6 +20,7 @@
 #include "mli_ref_runtime_api.hpp"
 #include "mli_private_types.h"
 #include "mli_service_functions.hpp"
+#include "mli_tiler.hpp"
 
 #include "test_crc32_calc.h"
 #include "test_memory_manager.h"
@@ -249,6 +250,8 @@ constexpr uint32_t kMemPoolSize = 16384;
 static IO_DATA_ATTR int8_t g_mem_pool[kMemPoolSize] = {0};
 constexpr uint32_t kWeightsAndWeightsZPBufferSize = 1112;
 static int8_t g_weights_buf_mem[kWeightsAndWeightsZPBufferSize] = { 0 };
+// Budget of the Tiler for input, weights and accumulator tile buffers of Conv2d
+constexpr uint32_t kTileBuffersBudget = 448;
 constexpr uint32_t kPreluEncodedParamBufSize = 77;
 static int8_t g_prelu_buf_mem[kPreluEncodedParamBufSize];
 
@@ -420,6 +423,18 @@ mli_minmax_t get_val_limit(mli_tensor *out, const mli_relu_cfg *cfg) {
     return val_limit;
 }
 
+// Read per output channel parameter of Prelu for the fused epilogue. Single element tensors are broadcasted.
+int32_t get_epilogue_param(const mli_tensor& tsr, uint32_t channel) {
+  const uint32_t elem_size = mli_hlp_tensor_element_size(&tsr);
+  if (tsr.rank == 0) {
+    return (elem_size == sizeof(int32_t)) ? tsr.data.mem.i32 :
+           (elem_size == sizeof(int16_t)) ? tsr.data.mem.i16 : tsr.data.mem.i8;
+  }
+  const uint32_t idx = (mli_hlp_count_elem_num(&tsr, 0) == 1) ? 0 : channel;
+  return (elem_size == sizeof(int32_t)) ? tsr.data.mem.pi32[idx] :
+         (elem_size == sizeof(int16_t)) ? tsr.data.mem.pi16[idx] : tsr.data.mem.pi8[idx];
+}
+
 bool preprocess_phase(const reporter_full& reporter,
                       const conv2d_test_operands* cur_test,
                       const Conv2dOp& conv2d_op, const PreluOp& pr_op,
@@ -460,7 +475,8 @@ bool preprocess_phase(const reporter_full& reporter,
 
 
 void prepare_phase(const conv2d_test_operands* cur_test, uint32_t& num_tiles,
-                  Conv2dOp& cnv_op, PreluOp &pr_op, ClipOp &clp_op, lib_mli::Buffer &encoded_params_buffer) {
+                  Conv2dOp& cnv_op, PreluOp &pr_op, ClipOp &clp_op, lib_mli::Buffer &encoded_params_buffer,
+                  bool fuse_epilogue) {
 
   static_assert(BATCH_SIZE == 1 && NUM_GROUPS == 1);
 
@@ -474,10 +490,27 @@ void prepare_phase(const conv2d_test_operands* cur_test, uint32_t& num_tiles,
     lib/src/private\mli_prv_layout.h: Line 70: 
     assert(pad_left >= 0 && pad_top >= 0 && out_h_idx >= 0 && out_w_idx >= 0) failed.
   */
-  uint32_t tile_output_size[kConvIORank]{ BATCH_SIZE, 4, 4, NUM_GROUPS, 2 };
-  tile_output_size[kGroupTensorHeightDim] = MIN(tile_output_size[kGroupTensorHeightDim], total_output_size[kGroupTensorHeightDim]);
-  tile_output_size[kGroupTensorWidthDim] = MIN(tile_output_size[kGroupTensorWidthDim], total_output_size[kGroupTensorWidthDim]);
-  // TODO: smaller H/W tile sizes will fail on 9-2, because of MLI_ASSERT I put inside IteratorCfg ctor - do something with it
+  // Tile size is chosen by the Tiler to fit input, weights and accumulator tile buffers into the budget
+  uint32_t tiler_in_shape[kConvIORank]{ BATCH_SIZE, cnv_op.input.shape[0], cnv_op.input.shape[1], NUM_GROUPS, cnv_op.input.shape[2] };
+  uint32_t tiler_w_shape[kConvWRank]{ NUM_GROUPS, cnv_op.weights.shape[0], cnv_op.weights.shape[1],
+                                      cnv_op.weights.shape[2], cnv_op.weights.shape[3] };
+  lib_mli::Conv2DConfig tiler_cfg(
+    cur_test->cfg.stride_height, cur_test->cfg.stride_width,
+    cur_test->cfg.padding_top, cur_test->cfg.padding_left,
+    cur_test->cfg.padding_bottom, cur_test->cfg.padding_right,
+    cur_test->cfg.dilation_height, cur_test->cfg.dilation_width, NUM_GROUPS);
+  lib_mli::TilerProblem tiler_problem = lib_mli::TilerProblem::Conv2d(
+    tiler_in_shape, tiler_w_shape, tiler_cfg, sizeof(int8_t), sizeof(int8_t), sizeof(int32_t));
+  lib_mli::PlatformDescription tiler_pd;
+  tiler_pd.SetMemorySize(0, kTileBuffersBudget);
+  lib_mli::TilerCandidate tile;
+  const mli_status tiler_status = lib_mli::Tiler(tiler_pd, tiler_problem).GetBest(tile);
+  assert(tiler_status == MLI_STATUS_OK);
+  for (unsigned i = 0; i < kConvIORank; i++) {
+    assert(tiler_problem.out_shape[i] == total_output_size[i]);
+  }
+  uint32_t tile_output_size[kConvIORank];
+  lib_mli::Tiler::GetTileSize(tile, kConvIORank, tile_output_size);
 
 #else
   uint32_t tile_output_size[kConvIORank]{ BATCH_SIZE, total_output_size[1], total_output_size[2], NUM_GROUPS, total_output_size[3] };
@@ -550,6 +583,12 @@ void prepare_phase(const conv2d_test_operands* cur_test, uint32_t& num_tiles,
     /* groups=1 */ total_input_size[0]
   );
 
+  // In fused mode Prelu (as rescale) and Clip are applied by Conv2d epilogue and produce int8 output directly
+  const mli_minmax_t val_limit = get_val_limit(&pr_op.out, &cur_test->cfg.relu);
+  if (fuse_epilogue) {
+    cfg.epilogue = lib_mli::ConvEpilogueConfig((int8_t)val_limit.min, (int8_t)val_limit.max);
+  }
+
   // STEP 1.1: Construct [Conv2d] as a specific ExecutionInterface successor
   //==================================================================
   lib_mli::PlatformDescription pd;
@@ -650,6 +689,7 @@ void prepare_phase(const conv2d_test_operands* cur_test, uint32_t& num_tiles,
   assert(cnv_op.input.el_type == MLI_EL_SA_8);
   assert(cnv_op.weights.el_type == MLI_EL_SA_8);
   assert(cnv_op.out_acc.el_type == MLI_EL_SA_32);
+  assert(pr_op.out.el_type == MLI_EL_SA_8);
 
   // Leave space for runtime object
   uint32_t* cnv_offset = &offsets[0];
@@ -675,7 +715,7 @@ void prepare_phase(const conv2d_test_operands* cur_test, uint32_t& num_tiles,
   // conv2d output
   // NOTE: The output should be aligned, otherwise, it will cause `vvst` crash.
   //       For example, offset is 4 byts aligned if output is int32_t.
-  uint32_t cnv_o_elem_size = mli_hlp_tensor_element_size(&cnv_op.out_acc);
+  uint32_t cnv_o_elem_size = mli_hlp_tensor_element_size(fuse_epilogue ? &pr_op.out : &cnv_op.out_acc);
   *cnv_offset = CEIL_RND(*cnv_offset, cnv_o_elem_size);
   uint32_t conv_out_size_in_elements = GetBufferSize(kConvIORank, tile_output_shape, output_stride);
   uint32_t out_size = conv_out_size_in_elements * cnv_o_elem_size;
@@ -708,6 +748,18 @@ void prepare_phase(const conv2d_test_operands* cur_test, uint32_t& num_tiles,
                                           conv2d_ctrl_buf);
   assert(status == MLI_STATUS_OK);
 
+  // conv2d epilogue params (for all output channels)
+  uint32_t epilogue_params_size = conv2d_op->GetEncodedEpilogueParamsSize();
+  assert(fuse_epilogue == (epilogue_params_size > 0));
+  *cnv_offset = CEIL_RND(*cnv_offset, kMliAlignment);
+  lib_mli::OffsetBuffer epilogue_params_buf{*cnv_offset, 0, epilogue_params_size, sizeof(int8_t)};
+  *cnv_offset += epilogue_params_size;
+  assert(*cnv_offset <= kMemPoolSize);
+  if (fuse_epilogue) {
+    status = conv2d_op->AttachEpilogueBufferOffsets(epilogue_params_buf);
+    assert(status == MLI_STATUS_OK);
+  }
+
   // STEP 1.2.2: [Prelu] Memory management (Up to user on how to deal with it)
   //==================================================================
 
@@ -928,6 +980,35 @@ void prepare_phase(const conv2d_test_operands* cur_test, uint32_t& num_tiles,
     outbias_size, outbias_elem_size);
   assert(encoded_params_size <= kPreluEncodedParamBufSize);
   encoded_params_buffer = lib_mli::Buffer(g_prelu_buf_mem, encoded_params_size, sizeof(int8_t));
+
+  // [Conv2D] encode the same params as fused epilogue directly into the global mem pool
+  //==================================================================
+  if (fuse_epilogue) {
+    const uint32_t num_ch = total_output_size[kGroupTensorChannelDim];
+    int8_t* epi_host_buf = (int8_t*)malloc(num_ch * (sizeof(int32_t) + sizeof(int16_t) + 2 * sizeof(int8_t)));
+    lib_mli::Buffer epi_inbias_buf(epi_host_buf, num_ch * sizeof(int32_t), sizeof(int32_t));
+    lib_mli::Buffer epi_scale_buf(epi_host_buf + num_ch * sizeof(int32_t), num_ch * sizeof(int16_t), sizeof(int16_t));
+    lib_mli::Buffer epi_shift_buf(epi_host_buf + num_ch * (sizeof(int32_t) + sizeof(int16_t)), num_ch, sizeof(int8_t));
+    lib_mli::Buffer epi_outbias_buf(epi_host_buf + num_ch * (sizeof(int32_t) + sizeof(int16_t) + sizeof(int8_t)),
+                                    num_ch, sizeof(int8_t));
+    uint32_t epi_shape[lib_mli::kConvEpilogueParamRank] = { num_ch };
+    lib_mli::Tensor<lib_mli::Buffer, lib_mli::kConvEpilogueParamRank> epi_inbias_tensor(epi_inbias_buf, epi_shape);
+    lib_mli::Tensor<lib_mli::Buffer, lib_mli::kConvEpilogueParamRank> epi_scale_tensor(epi_scale_buf, epi_shape);
+    lib_mli::Tensor<lib_mli::Buffer, lib_mli::kConvEpilogueParamRank> epi_shift_tensor(epi_shift_buf, epi_shape);
+    lib_mli::Tensor<lib_mli::Buffer, lib_mli::kConvEpilogueParamRank> epi_outbias_tensor(epi_outbias_buf, epi_shape);
+    for (uint32_t i = 0; i < num_ch; i++) {
+      epi_inbias_tensor.write<int32_t>(i, get_epilogue_param(pr_inbias_tsr, i));
+      epi_scale_tensor.write<int16_t>(i, (int16_t)get_epilogue_param(pr_posscale_tsr, i));
+      epi_shift_tensor.write<int8_t>(i, (int8_t)get_epilogue_param(pr_posshift_tsr, i));
+      epi_outbias_tensor.write<int8_t>(i, (int8_t)get_epilogue_param(pr_outbias_tsr, i));
+    }
+    lib_mli::Buffer epi_encoded_buf((int8_t*)g_mem_pool + epilogue_params_buf.get_offset(),
+                                    epilogue_params_size, sizeof(int8_t));
+    status = conv2d_op->EncodeEpilogueParams(epi_inbias_tensor, epi_scale_tensor, epi_shift_tensor,
+                                             epi_outbias_tensor, nullptr, epi_encoded_buf);
+    assert(status == MLI_STATUS_OK);
+    free(epi_host_buf);
+  }
   uint32_t params_shape[kPreluParamRank] = { pr_inbias_tsr.shape[0], 0};
   lib_mli::Tensor<lib_mli::Buffer, kPreluParamRank> inbias_tensor(src_inbias_buf, params_shape);
   lib_mli::Tensor<lib_mli::Buffer, kPreluParamRank> posscale_tensor(src_posscale_buf, params_shape);
@@ -981,9 +1062,6 @@ void prepare_phase(const conv2d_test_operands* cur_test, uint32_t& num_tiles,
   // STEP 1.3.3: [clip] encode params to the global shared memory pool
   //==================================================================
   // Copy min data to the shared memory pool
-  mli_minmax_t val_limit;
-  val_limit = get_val_limit(&pr_op.out, &cur_test->cfg.relu);
-
   int8_t * clp_host_src_buf = (int8_t*) malloc(clip_encoded_params_size);
   int8_t * clp_host_dst_buf = (int8_t*) malloc(clip_encoded_params_size);
   uint32_t clp_params_shape[1] = {1};
@@ -1038,7 +1116,8 @@ void prepare_phase(const conv2d_test_operands* cur_test, uint32_t& num_tiles,
 }
 
 
-void execution_phase(Conv2dOp& cnv_op, PreluOp &pr_op, ClipOp &clp_op, uint32_t tiles_num, lib_mli::Buffer &encoded_params_buffer) {
+void execution_phase(Conv2dOp& cnv_op, PreluOp &pr_op, ClipOp &clp_op, uint32_t tiles_num, lib_mli::Buffer &encoded_params_buffer,
+                     bool fuse_epilogue) {
   // STEP 3: Execution phase
   //==================================================================
 
@@ -1133,6 +1212,23 @@ void execution_phase(Conv2dOp& cnv_op, PreluOp &pr_op, ClipOp &clp_op, uint32_t
     }
 
 
+    if (fuse_epilogue) {
+      // Conv2d produces the final output, epilogue params are picked by the kernel itself
+      status = mli_conv->Prefetch();
+      assert(status == MLI_STATUS_OK);
+      status = mli_conv->Issue();
+      assert(status == MLI_STATUS_OK);
+      status = mli_conv->Update();
+      assert(status == MLI_STATUS_OK);
+
+      // copy results from conv2d output tile to the global buffer
+      strided_copy_with_offsets(kConvIORank, conv2d_private->output.get_buf().get_elem_size(),
+                                (int8_t*)g_mem_pool + conv2d_private->output.get_buf().get_offset(),
+                                zero_offsets, output_tile_offsets, tile_output_strides,
+                                output_tile_size, clp_op.original_out.data.mem.pi8);
+      continue;
+    }
+
     prelu_pimpl->GetIOSizesAndOffsets(enc_param_size, inp_bias_offset, posscale_offset, negscale_offset, posshift_offset, negshift_offset, out_bias_offset);
     const uint32_t enc_param_buf_offset = prelu_private->encoded_params_buffer.get_offset();
     const uint32_t num_enc_param = cnv_op.out_acc.shape[2];
@@ -1353,18 +1449,36 @@ int main() {
     //==================================================================
     uint32_t num_tiles = 0; // num_tiles calculated inside prepare_phase
     lib_mli::Buffer encoded_params_buffer; // initialized inside prepare_phase
-    prepare_phase(cur_test, num_tiles, conv2d_op, pr_op, clp_op, encoded_params_buffer);
+    prepare_phase(cur_test, num_tiles, conv2d_op, pr_op, clp_op, encoded_params_buffer, /*fuse_epilogue=*/false);
 
     // STEP 2: Executing phase
     //==================================================================
     // Run conv2d, prelu and clip MLI3.0 kernels
     
-    execution_phase(conv2d_op, pr_op, clp_op, num_tiles, encoded_params_buffer);
+    execution_phase(conv2d_op, pr_op, clp_op, num_tiles, encoded_params_buffer, /*fuse_epilogue=*/false);
 
     // STEP 3: Postprocessing phase
     //==================================================================
     is_test_passed &= postprocess_phase(reporter, cur_test, conv2d_op, pr_op, clp_op);
 
+    // STEP 4: Run conv2d with fused epilogue instead of prelu and clip.
+    //         Result must be bitwise the same.
+    //==================================================================
+    if (is_test_passed) {
+      const mli_tensor& out = clp_op.original_out;
+      int8_t* unfused_out = (int8_t*)malloc(out.data.capacity);
+      memcpy(unfused_out, out.data.mem.pi8, out.data.capacity);
+
+      prepare_phase(cur_test, num_tiles, conv2d_op, pr_op, clp_op, encoded_params_buffer, /*fuse_epilogue=*/true);
+      execution_phase(conv2d_op, pr_op, clp_op, num_tiles, encoded_params_buffer, /*fuse_epilogue=*/true);
+
+      if (memcmp(unfused_out, out.data.mem.pi8, out.data.capacity) != 0) {
+        reporter.report_message(cur_test->descr, "FAILED at comparison of fused epilogue with Prelu and Clip output");
+        is_test_passed = false;
+      }
+      free(unfused_out);
+    }
+
     final_status &= is_test_passed;
 
     // Free buffers for prelu params
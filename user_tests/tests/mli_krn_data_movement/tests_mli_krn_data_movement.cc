@@ -13,9 +13,11 @@
 #include <stdio.h>
 #include <assert.h>
 #include <string.h>
+#include <chrono>
 #include "mli_types.h"
 #include "mli_api.h"
 
+#include "test_benchmark.h"
 #include "test_crc32_calc.h"
 #include "test_memory_manager.h"
 #include "test_quality_metrics.h"
@@ -30,6 +32,9 @@ using mli::tst::quality_metrics;
 using mli::tst::crc32_calc;
 using mli::tst::reporter_full;
 using mli::tst::memory_manager;
+using mli::tst::benchmark_reporter;
+using mli::tst::bench_data_bytes;
+using mli::tst::bench_memory_footprint;
 
 
 typedef mli_status (*mov_tensor_sync_ptr)(const mli_tensor* src,
@@ -176,8 +181,116 @@ static IO_DATA_ATTR int8_t scratch_mem_out_inside[kMemSize] = { 0 };
 
 constexpr int kTestsNum = sizeof(tests_list) / sizeof(tests_list[0]);
 
+#if defined(MLI_HOST_DMA_EMU)
+//===============================================================================
+// Asynchronous transfers through the host DMA emulator
+//===============================================================================
+// Each test case is repeated with asynchronous API on emulated channels, and the result
+// is compared with the synchronous copy. The transfer can't be done earlier than
+// the modeled latency, and the callback must be called before it's reported as done.
+constexpr int kEmuChannels = 2;
+constexpr uint32_t kEmuLatencyUs = 100;
+constexpr uint32_t kEmuBytesPerUs = 16;
+static int8_t scratch_mem_out_async[kMemSize] = { 0 };
+static bool emu_callback_done[kTestsNum] = { false };
+
+static void emu_transfer_done(int32_t cookie) {
+    emu_callback_done[cookie] = true;
+}
+
+static bool check_async_transfers(const reporter_full& reporter) {
+    const char* descr = "Async DMA emulator";
+    const mli_mov_emu_cfg_t emu_cfg = {kEmuChannels, kEmuLatencyUs, kEmuBytesPerUs};
+    bool is_passed = (mli_mov_set_num_dma_ch(0, kEmuChannels) == MLI_STATUS_OK) &&
+                     (mli_mov_emu_enable(&emu_cfg) == MLI_STATUS_OK);
+    if (!is_passed) {
+        reporter.report_message(descr, "FAILED at init: emulator can't be enabled");
+        return false;
+    }
+
+    for (int i = 0; i < kTestsNum && is_passed; ++i) {
+        const data_movement_test_operands* cur_test = &tests_list[i];
+        memory_manager mem_in_keeper((int8_t*)scratch_mem_in_outside, sizeof(scratch_mem_in_outside));
+        memory_manager mem_out_keeper((int8_t*)scratch_mem_out_outside, sizeof(scratch_mem_out_outside));
+        memory_manager mem_async_keeper((int8_t*)scratch_mem_out_async, sizeof(scratch_mem_out_async));
+
+        mli_tensor input = cur_test->in.get_quantized_tensor(mem_in_keeper.allocate_memory(cur_test->in));
+        mli_tensor out_sync, out_async;
+        if (i == 6) {
+            out_sync = cur_test->out.get_quantized_tensor(mem_out_keeper.allocate_memory(cur_test->out));
+            out_async = cur_test->out.get_quantized_tensor(mem_async_keeper.allocate_memory(cur_test->out));
+        } else {
+            out_sync = cur_test->out.get_not_quantized_tensor(mem_out_keeper.allocate_memory(cur_test->out));
+            out_async = cur_test->out.get_not_quantized_tensor(mem_async_keeper.allocate_memory(cur_test->out));
+        }
+
+        mli_mov_cfg_t cfg;
+        mli_mov_cfg_all(&cfg,offsets_cfg[i],sizes_cfg[i],sub_sample[i],out_offsets_cfg[i],out_mem_stride_cfg[i],
+                perm_dim[i],padd_left[i],padd_right[i],padd_top[i],padd_bottom[i]);
+        is_passed &= (mli_mov_tensor_sync(&input, &cfg, &out_sync) == MLI_STATUS_OK);
+
+        // Odd cases keep the first channel busy, so the transfer is done on the second one
+        mli_mov_handle_t h, h_other;
+        if (i % 2) is_passed &= (mli_mov_acquire_handle(1, &h_other) == MLI_STATUS_OK);
+        is_passed &= (mli_mov_acquire_handle(1, &h) == MLI_STATUS_OK);
+        is_passed &= (mli_mov_prepare(&h, &input, &cfg, &out_async) == MLI_STATUS_OK);
+        is_passed &= (mli_mov_registercallback(&h, emu_transfer_done, i) == MLI_STATUS_OK);
+        const auto start = std::chrono::steady_clock::now();
+        is_passed &= (mli_mov_start(&h, &input, &cfg, &out_async) == MLI_STATUS_OK);
+        if (is_passed && mli_mov_isdone(&h)) {
+            reporter.report_message(cur_test->descr, "FAILED: transfer is done before the modeled latency");
+            is_passed = false;
+        }
+        is_passed &= (mli_mov_wait(&h) == MLI_STATUS_OK);
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        is_passed &= (mli_mov_release_handle(&h) == MLI_STATUS_OK);
+        if (i % 2) is_passed &= (mli_mov_release_handle(&h_other) == MLI_STATUS_OK);
+
+        if (is_passed && (!emu_callback_done[i] ||
+                          elapsed < std::chrono::microseconds(kEmuLatencyUs))) {
+            reporter.report_message(cur_test->descr, "FAILED: wrong completion of the emulated transfer");
+            is_passed = false;
+        }
+        if (is_passed &&
+                (mem_async_keeper.is_memory_corrupted() ||
+                 memcmp(out_sync.data.mem.pi8, out_async.data.mem.pi8, out_sync.data.capacity) != 0 ||
+                 memcmp(out_sync.shape, out_async.shape, sizeof(out_sync.shape)) != 0)) {
+            reporter.report_message(cur_test->descr, "FAILED: asynchronous result differs from synchronous one");
+            is_passed = false;
+        }
+    }
+
+    // Check utilization statistics of both channels
+    if (is_passed) {
+        uint32_t transfers = 0;
+        for (int ch = 0; ch < kEmuChannels; ch++) {
+            mli_mov_emu_stats_t stats;
+            is_passed &= (mli_mov_emu_get_stats(ch, &stats) == MLI_STATUS_OK);
+            is_passed &= (stats.busy_us >= (uint64_t)stats.transfers * kEmuLatencyUs);
+            is_passed &= (stats.busy_us <= stats.elapsed_us);
+            is_passed &= (stats.transfers == (uint32_t)(kTestsNum + 1 - ch) / 2) && (stats.bytes > 0);
+            transfers += stats.transfers;
+        }
+        is_passed &= (transfers == kTestsNum);
+        if (!is_passed) {
+            reporter.report_message(descr, "FAILED: wrong utilization statistics");
+        }
+    }
+
+    is_passed &= (mli_mov_emu_disable() == MLI_STATUS_OK);
+
+    // The emulator is left enabled till the exit: channel threads must be stopped by the library
+    is_passed &= (mli_mov_emu_enable(&emu_cfg) == MLI_STATUS_OK);
+    if (is_passed) {
+        reporter.report_message(descr, "PASSED");
+    }
+    return is_passed;
+}
+#endif
+
 int main() {
     const reporter_full reporter;
+    benchmark_reporter bench;
     bool final_status = true;
 
     reporter.report_header("MLI|Kernels|Data Movement Functions Tests");
@@ -228,7 +341,7 @@ int main() {
         mli_mov_cfg_all(&cfg,offsets_cfg[i],sizes_cfg[i],sub_sample[i],out_offsets_cfg[i],out_mem_stride_cfg[i],
                 perm_dim[i],padd_left[i],padd_right[i],padd_top[i],padd_bottom[i]);
         // Run specific kernel for test
-        mli_status stat = cur_test->mli_krn_data_movement(&input,&cfg, &out);
+        mli_status stat = bench.measure([&] { return cur_test->mli_krn_data_movement(&input,&cfg, &out); });
 
         if (is_test_passed &&
                 stat != MLI_STATUS_OK) {
@@ -288,9 +401,19 @@ int main() {
 
         }
 
+        if (is_test_passed) {
+            bench.add_case(cur_test->descr, 0,
+                           bench_data_bytes({&input, &out}),
+                           bench_memory_footprint({&input, &out}));
+        }
         final_status &= (is_test_passed);
     }
 
+#if defined(MLI_HOST_DMA_EMU)
+    final_status &= check_async_transfers(reporter);
+#endif
+
+    bench.report("mli_krn_data_movement");
     reporter.report_outline("[AUTO] Group: Data Movement", final_status);
 
     return (final_status) ? 0 : 1;
@@ -14,6 +14,7 @@
 #include <stdio.h>
 #include <string.h>
 
+#include "test_benchmark.h"
 #include "test_crc32_calc.h"
 #include "test_memory_manager.h"
 #include "test_quality_metrics.h"
@@ -29,6 +30,9 @@ using mli::tst::quality_metrics;
 using mli::tst::crc32_calc;
 using mli::tst::reporter_full;
 using mli::tst::memory_manager;
+using mli::tst::benchmark_reporter;
+using mli::tst::bench_data_bytes;
+using mli::tst::bench_memory_footprint;
 
 typedef mli_status(*depthwise_conv_func_ptr)(
     const mli_tensor* /*input*/,
@@ -37,6 +41,19 @@ typedef mli_status(*depthwise_conv_func_ptr)(
     const mli_conv2d_cfg* /*cfg*/,
     mli_tensor* /*output*/);
 
+// Pre-validated layer: checks and quantization params derivation are done once at prepare step
+static mli_status mli_krn_depthwise_conv2d_hwcn_sa8_sa8_sa32_prepared(
+        const mli_tensor* in,
+        const mli_tensor* weights,
+        const mli_tensor* bias,
+        const mli_conv2d_cfg* cfg,
+        mli_tensor* out) {
+    mli_conv2d_prepared prepared;
+    mli_status ret = mli_krn_depthwise_conv2d_hwcn_sa8_sa8_sa32_prepare(in, weights, bias, cfg, out, &prepared);
+    if (ret != MLI_STATUS_OK) return ret;
+    return mli_krn_depthwise_conv2d_hwcn_sa8_sa8_sa32_run_prepared(&prepared, in, out);
+}
+
 struct depthwise_conv_test_operands {
     const char* descr;
     const depthwise_conv_func_ptr mli_krn_depthwise_conv;
@@ -232,6 +249,26 @@ static const depthwise_conv_test_operands tests_list[] = {
                                        input_2_sa8, weights_5_sa8, bias_3_i2_w5_sa32, test_10_out_sa8, 
                                        test_10_cfg, thresholds_sa8_general, test_10_chksum_sa8},
 
+    // Pre-validated layers must give the same results as the kernels chosen by the user
+    {"Test 1 SA8 Prepared",           mli_krn_depthwise_conv2d_hwcn_sa8_sa8_sa32_prepared,
+                                      input_1_sa8, weights_1_sa8_per_axis, bias_1_sa32_per_axis, test_1_out_sa8, test_1_cfg,
+                                      thresholds_sa8_general, test_1_chksum_sa8},
+    {"Test 2 SA8 Prepared ReluGen",   mli_krn_depthwise_conv2d_hwcn_sa8_sa8_sa32_prepared,
+                                      input_1_sa8, weights_2_sa8, bias_2_i1_w2_sa32, test_2_out_sa8,
+                                      test_2_cfg, thresholds_sa8_general, test_2_chksum_sa8},
+    {"Test 6 SA8 Prepared k3x3",      mli_krn_depthwise_conv2d_hwcn_sa8_sa8_sa32_prepared,
+                                      input_1_memstr_sa8, weights_3_sa8_per_axis, bias_2_i1_w3_sa32_per_axis, test_6_out_sa8,
+                                      test_6_cfg, thresholds_sa8_general, test_6_chksum_sa8},
+    {"Test 7 SA8 Prepared k5x5",      mli_krn_depthwise_conv2d_hwcn_sa8_sa8_sa32_prepared,
+                                      input_1_memstr_sa8, weights_4_sa8_per_axis, bias_2_i1_w4_sa32_per_axis, test_7_out_sa8,
+                                      test_7_cfg, thresholds_sa8_general, test_7_chksum_sa8},
+    {"Test 8-1 SA8 Prepared Dil+Pad", mli_krn_depthwise_conv2d_hwcn_sa8_sa8_sa32_prepared,
+                                      input_1_memstr_sa8, weights_3_sa8_per_axis, bias_2_i1_w3_sa32_per_axis, test_8_out_sa8,
+                                      test_8_cfg, thresholds_sa8_general, test_8_chksum_sa8},
+    {"Test 10 SA8 Prepared Huge Vals", mli_krn_depthwise_conv2d_hwcn_sa8_sa8_sa32_prepared,
+                                      input_2_sa8, weights_5_sa8, bias_3_i2_w5_sa32, test_10_out_sa8,
+                                      test_10_cfg, thresholds_sa8_general, test_10_chksum_sa8},
+
 };
 
 constexpr int kMemSize = 2047;
@@ -244,6 +281,7 @@ constexpr int kTestsNum = sizeof(tests_list) / sizeof(tests_list[0]);
 
 int main() {
     const reporter_full reporter;
+    benchmark_reporter bench;
     bool final_status = true;
 
     reporter.report_header("MLI|Kernels|Depthwise Conv Tests");
@@ -267,14 +305,16 @@ int main() {
                 strstr(cur_test->descr, "Test 8-1 SA8") != nullptr ||
                 strstr(cur_test->descr, "Test 8-2 SA8") != nullptr ||
                 strstr(cur_test->descr, "Test 9 SA8_SA8_SA32 k5x5 Dil") != nullptr ||
-                strstr(cur_test->descr, "Test 10 SA8_SA8_SA32 Huge Vals") != nullptr) {
+                strstr(cur_test->descr, "Test 10 SA8_SA8_SA32 Huge Vals") != nullptr ||
+                strstr(cur_test->descr, "SA8 Prepared") != nullptr) {
             // VPX fails bitwise comparison with reference .
             reporter.report_message(cur_test->descr, "SKIPPED due to a known issue");
             continue;
         }
 #endif
 #if PLATFORM == V2DSP_XY && defined(CRC_RM_UP)
-        if (strstr(cur_test->descr, "Test 1 SA8_SA8_SA32") != nullptr) {
+        if (strstr(cur_test->descr, "Test 1 SA8_SA8_SA32") != nullptr ||
+                strstr(cur_test->descr, "Test 1 SA8 Prepared") != nullptr) {
             // Em9d fails comparison with reference in up rounding mode.
             reporter.report_message(cur_test->descr, "SKIPPED due to a known issue");
             continue;
@@ -320,7 +360,7 @@ int main() {
 
         // Run specific kernel for test
         if (is_test_passed &&
-                cur_test->mli_krn_depthwise_conv(&input, &weights, &bias, &cur_test->cfg, &out) != MLI_STATUS_OK) {
+                bench.measure([&] { return cur_test->mli_krn_depthwise_conv(&input, &weights, &bias, &cur_test->cfg, &out); }) != MLI_STATUS_OK) {
             reporter.report_message(cur_test->descr, "FAILED at kernel run: kernel returned bad status");
             is_test_passed = false;
         }
@@ -366,9 +406,15 @@ int main() {
             is_test_passed &= reporter.evaluate_and_report_case(cur_test->descr, test_metrics, cur_test->threshold, 
                                                                 data_crc, cur_test->check_sum);
         }
+        if (is_test_passed) {
+            bench.add_case(cur_test->descr, mli_hlp_count_elem_num(&out, 0) * mli_hlp_count_elem_num(&weights, 0) / weights.shape[3],
+                           bench_data_bytes({&input, &weights, &bias, &out}),
+                           bench_memory_footprint({&input, &weights, &bias, &out}));
+        }
         final_status &= is_test_passed;
     }
 
+    bench.report("mli_krn_depthwise_conv");
     reporter.report_outline("[AUTO] Group: mli_krn_depthwise_conv", final_status);
 
     return (final_status) ? 0 : 1;
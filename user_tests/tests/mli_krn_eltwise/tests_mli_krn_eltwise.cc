@@ -13,6 +13,7 @@
 #include <stdio.h>
 #include <string.h>
 
+#include "test_benchmark.h"
 #include "test_crc32_calc.h"
 #include "test_memory_manager.h"
 #include "test_quality_metrics.h"
@@ -28,6 +29,9 @@ using mli::tst::quality_metrics;
 using mli::tst::crc32_calc;
 using mli::tst::reporter_full;
 using mli::tst::memory_manager;
+using mli::tst::benchmark_reporter;
+using mli::tst::bench_data_bytes;
+using mli::tst::bench_memory_footprint;
 
 typedef mli_status(*eltwise_func_ptr)(
     const mli_tensor* /*in1*/,
@@ -191,8 +195,159 @@ static IO_DATA_ATTR int8_t scratch_mem_out[kMemSize] = { 0 };
 
 constexpr int kTestsNum = sizeof(tests_list) / sizeof(tests_list[0]);
 
+// Broadcasting tests: result of an operand broadcasted along dimensions of size 1 is compared bit-exactly
+// with the result of the same operation on an operand of the output shape with copied values.
+struct eltwise_broadcast_test_operands {
+    const char* descr;
+    mli_element_type el_type;
+    uint32_t in1_rank;
+    uint32_t in1_shape[MLI_MAX_RANK];
+    uint32_t in2_rank;
+    uint32_t in2_shape[MLI_MAX_RANK];
+    int32_t in2_mem_stride[MLI_MAX_RANK];  // all zeros for default strides
+    uint32_t out_rank;
+    uint32_t out_shape[MLI_MAX_RANK];
+};
+
+static const eltwise_broadcast_test_operands broadcast_tests_list[] = {
+    {"Test B1 FX16 Per-channel", MLI_EL_FX_16, 2, {8, 16}, 2, {1, 16}, {0}, 2, {8, 16}},
+    {"Test B1 SA8 Per-channel", MLI_EL_SA_8, 2, {8, 16}, 2, {1, 16}, {0}, 2, {8, 16}},
+    {"Test B2 FX16 Per-row", MLI_EL_FX_16, 2, {8, 16}, 2, {8, 1}, {3, 1}, 2, {8, 16}},
+    {"Test B2 SA8 Per-row", MLI_EL_SA_8, 2, {8, 16}, 2, {8, 1}, {3, 1}, 2, {8, 16}},
+    {"Test B3 FX16 Lower rank", MLI_EL_FX_16, 3, {2, 8, 16}, 1, {16}, {0}, 3, {2, 8, 16}},
+    {"Test B3 SA8 Lower rank", MLI_EL_SA_8, 3, {2, 8, 16}, 1, {16}, {0}, 3, {2, 8, 16}},
+    {"Test B4 FX16 Middle axis", MLI_EL_FX_16, 4, {2, 3, 4, 5}, 4, {2, 1, 4, 5}, {0}, 4, {2, 3, 4, 5}},
+    {"Test B4 SA8 Middle axis", MLI_EL_SA_8, 4, {2, 3, 4, 5}, 4, {2, 1, 4, 5}, {0}, 4, {2, 3, 4, 5}},
+    {"Test B5 FX16 Both inputs", MLI_EL_FX_16, 2, {8, 1}, 2, {1, 16}, {0}, 2, {8, 16}},
+    {"Test B5 SA8 Both inputs", MLI_EL_SA_8, 2, {8, 1}, 2, {1, 16}, {0}, 2, {8, 16}},
+};
+
+static const eltwise_func_ptr broadcast_funcs_fx16[] = {
+    mli_krn_eltwise_add_fx16, mli_krn_eltwise_sub_fx16, mli_krn_eltwise_mul_fx16,
+    mli_krn_eltwise_max_fx16, mli_krn_eltwise_min_fx16
+};
+static const eltwise_func_ptr broadcast_funcs_sa8[] = {
+    mli_krn_eltwise_add_sa8, mli_krn_eltwise_sub_sa8, mli_krn_eltwise_mul_sa8,
+    mli_krn_eltwise_max_sa8, mli_krn_eltwise_min_sa8
+};
+
+constexpr int kBroadcastTestsNum = sizeof(broadcast_tests_list) / sizeof(broadcast_tests_list[0]);
+constexpr int kBroadcastFuncsNum = sizeof(broadcast_funcs_fx16) / sizeof(broadcast_funcs_fx16[0]);
+constexpr int kBroadcastMemSize = 512;
+static int16_t broadcast_mem_in1[kBroadcastMemSize];
+static int16_t broadcast_mem_in2[kBroadcastMemSize];
+static int16_t broadcast_mem_full1[kBroadcastMemSize];
+static int16_t broadcast_mem_full2[kBroadcastMemSize];
+static int16_t broadcast_mem_out[kBroadcastMemSize];
+static int16_t broadcast_mem_out_ref[kBroadcastMemSize];
+
+static void set_broadcast_tensor(mli_tensor& t, mli_element_type el_type, uint32_t rank, const uint32_t* shape,
+                                 const int32_t* mem_stride, int16_t* mem, bool is_output) {
+    t = mli_tensor{};
+    t.el_type = el_type;
+    t.rank = rank;
+    for (uint32_t i = 0; i < rank; i++) t.shape[i] = shape[i];
+    mli_hlp_set_tensor_mem_strides(&t);
+    if (mem_stride != nullptr && mem_stride[rank - 1] != 0) {
+        for (uint32_t i = 0; i < rank; i++) t.mem_stride[i] = mem_stride[i];
+    }
+    t.data.mem.pi16 = mem;
+    t.data.capacity = kBroadcastMemSize * sizeof(int16_t);
+    if (el_type == MLI_EL_FX_16) {
+        t.el_params.fx.frac_bits = is_output ? 9 : 10;
+    } else {
+        t.el_params.sa.dim = -1;
+        t.el_params.sa.type = MLI_EL_PARAM_SC16_ZP16;
+        t.el_params.sa.scale.mem.i16 = is_output ? 17000 : 22000;
+        t.el_params.sa.scale_frac_bits.mem.i8 = is_output ? 14 : 15;
+        t.el_params.sa.zero_point.mem.i16 = is_output ? -3 : 5;
+    }
+}
+
+// Copy values of a broadcasted tensor into a tensor of the output shape with default strides
+static void materialize_broadcast(const mli_tensor& in, mli_tensor& full) {
+    const uint32_t elem_size = mli_hlp_tensor_element_size(&in);
+    const uint32_t num_elems = mli_hlp_count_elem_num(&full, 0);
+    const uint32_t lead_dims = full.rank - in.rank;
+    for (uint32_t n = 0; n < num_elems; n++) {
+        uint32_t rest = n;
+        int32_t in_offset = 0;
+        int32_t full_offset = 0;
+        for (int d = (int)full.rank - 1; d >= 0; d--) {
+            const uint32_t pos = rest % full.shape[d];
+            rest /= full.shape[d];
+            full_offset += pos * full.mem_stride[d];
+            if (d >= (int)lead_dims && in.shape[d - lead_dims] != 1) {
+                in_offset += pos * in.mem_stride[d - lead_dims];
+            }
+        }
+        memcpy(full.data.mem.pi8 + full_offset * elem_size, in.data.mem.pi8 + in_offset * elem_size, elem_size);
+    }
+}
+
+static bool run_broadcast_tests(const reporter_full& reporter) {
+    bool final_status = true;
+    for (int i = 0; i < kBroadcastTestsNum; ++i) {
+        const eltwise_broadcast_test_operands* cur_test = &broadcast_tests_list[i];
+        const bool is_fx16 = cur_test->el_type == MLI_EL_FX_16;
+        const eltwise_func_ptr* funcs = is_fx16 ? broadcast_funcs_fx16 : broadcast_funcs_sa8;
+        mli_tensor in1, in2, full1, full2, out, out_ref;
+        set_broadcast_tensor(in1, cur_test->el_type, cur_test->in1_rank, cur_test->in1_shape, nullptr,
+                             broadcast_mem_in1, false);
+        set_broadcast_tensor(in2, cur_test->el_type, cur_test->in2_rank, cur_test->in2_shape,
+                             cur_test->in2_mem_stride, broadcast_mem_in2, false);
+        set_broadcast_tensor(full1, cur_test->el_type, cur_test->out_rank, cur_test->out_shape, nullptr,
+                             broadcast_mem_full1, false);
+        set_broadcast_tensor(full2, cur_test->el_type, cur_test->out_rank, cur_test->out_shape, nullptr,
+                             broadcast_mem_full2, false);
+        set_broadcast_tensor(out, cur_test->el_type, cur_test->out_rank, cur_test->out_shape, nullptr,
+                             broadcast_mem_out, true);
+        set_broadcast_tensor(out_ref, cur_test->el_type, cur_test->out_rank, cur_test->out_shape, nullptr,
+                             broadcast_mem_out_ref, true);
+
+        // Pseudo-random values in the range of the type
+        for (int k = 0; k < kBroadcastMemSize; k++) {
+            const int32_t val1 = (k * 37 + 11) % 251 - 125;
+            const int32_t val2 = (k * 53 + 7) % 241 - 120;
+            if (is_fx16) {
+                broadcast_mem_in1[k] = (int16_t)(val1 * 97);
+                broadcast_mem_in2[k] = (int16_t)(val2 * 89);
+            } else {
+                broadcast_mem_in1[k] = 0;
+                broadcast_mem_in2[k] = 0;
+                in1.data.mem.pi8[k] = (int8_t)val1;
+                in2.data.mem.pi8[k] = (int8_t)val2;
+            }
+        }
+        materialize_broadcast(in1, full1);
+        materialize_broadcast(in2, full2);
+
+        const uint32_t out_bytes = mli_hlp_count_elem_num(&out, 0) * mli_hlp_tensor_element_size(&out);
+        bool is_test_passed = true;
+        for (int f = 0; f < kBroadcastFuncsNum && is_test_passed; f++) {
+            memset(broadcast_mem_out, 0, sizeof(broadcast_mem_out));
+            memset(broadcast_mem_out_ref, 0x55, sizeof(broadcast_mem_out_ref));
+            if (funcs[f](&in1, &in2, &out) != MLI_STATUS_OK ||
+                    funcs[f](&full1, &full2, &out_ref) != MLI_STATUS_OK) {
+                reporter.report_message(cur_test->descr, "FAILED at kernel run: kernel returned bad status");
+                is_test_passed = false;
+            } else if (memcmp(out.data.mem.pi8, out_ref.data.mem.pi8, out_bytes) != 0) {
+                reporter.report_message(cur_test->descr, "FAILED at comparison output with materialized operands");
+                is_test_passed = false;
+            }
+        }
+
+        if (is_test_passed) {
+            reporter.report_message(cur_test->descr, "PASSED");
+        }
+        final_status &= is_test_passed;
+    }
+    return final_status;
+}
+
 int main() {
     const reporter_full reporter;
+    benchmark_reporter bench;
     bool final_status = true;
 
     reporter.report_header("MLI|Kernels|Basic Eltwise Functions Tests");
@@ -231,7 +386,7 @@ int main() {
 
         // Run specific kernel for test 
         if (is_test_passed &&
-                cur_test->mli_krn_eltwise(&input1, &input2, &out) != MLI_STATUS_OK) {
+                bench.measure([&] { return cur_test->mli_krn_eltwise(&input1, &input2, &out); }) != MLI_STATUS_OK) {
             reporter.report_message(cur_test->descr, "FAILED at kernel run: kernel returned bad status");
             is_test_passed = false;
         }
@@ -284,9 +439,17 @@ int main() {
                                                                 data_crc, cur_test->check_sum);
         }
 
+        if (is_test_passed) {
+            bench.add_case(cur_test->descr, mli_hlp_count_elem_num(&out, 0),
+                           bench_data_bytes({&input1, &input2, &out}),
+                           bench_memory_footprint({&input1, &input2, &out}));
+        }
         final_status &= is_test_passed;
     }
 
+    final_status &= run_broadcast_tests(reporter);
+
+    bench.report("mli_krn_eltwise");
     reporter.report_outline("[AUTO] Group: mli_krn_eltwise", final_status);
 
     return (final_status) ? 0 : 1;
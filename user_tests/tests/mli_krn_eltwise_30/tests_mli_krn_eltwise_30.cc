@@ -1175,6 +1175,236 @@ bool postprocess_phase(const reporter_full& reporter,
   return is_test_passed;
 }
 
+// Broadcasting tests: the right operand is broadcasted either along dimensions of size 1 or with zero
+// memory strides in the output shape. Output of the tiled MLI3.0 kernel is compared bit-exactly
+// with the output of MLI2.0 kernel on the same data (size 1 dimensions only).
+struct eltwise_broadcast_test_operands {
+  const char* descr;
+  const eltwise_func_ptr mli_krn_eltwise;
+  EltwiseTy ty;
+  uint32_t in2_shape[lib_mli::kEltwiseRank];
+  bool is_zero_stride;  // MLI3.0 right operand has output shape and zero strides instead of size 1 dims
+  uint32_t tile_shape[lib_mli::kEltwiseRank];
+};
+
+static const eltwise_broadcast_test_operands broadcast_tests_list[] = {
+  {"Test B1 FX16 Add per-ch", mli_krn_eltwise_add_fx16, EltwiseTy::ADD,
+                                   {1, 1, 1, 8}, false, {1, 4, 6, 8}},
+  {"Test B2 FX16 Add per-ch tiled", mli_krn_eltwise_add_fx16, EltwiseTy::ADD,
+                                   {1, 1, 1, 8}, false, {1, 2, 3, 8}},
+  {"Test B3 FX16 Add per-row tiled", mli_krn_eltwise_add_fx16, EltwiseTy::ADD,
+                                   {1, 4, 6, 1}, false, {1, 2, 3, 8}},
+  {"Test B4 FX16 Sub ch stride 0", mli_krn_eltwise_sub_fx16, EltwiseTy::SUB,
+                                   {1, 1, 1, 8}, true, {1, 1, 4, 8}},
+  {"Test B5 FX16 Sub row stride 0", mli_krn_eltwise_sub_fx16, EltwiseTy::SUB,
+                                   {1, 4, 6, 1}, true, {1, 2, 3, 4}},
+  {"Test B6 FX16 Max per-row tiled", mli_krn_eltwise_max_fx16, EltwiseTy::MAX,
+                                   {1, 4, 6, 1}, false, {1, 1, 3, 8}},
+};
+
+constexpr int kBroadcastTestsNum = sizeof(broadcast_tests_list) / sizeof(broadcast_tests_list[0]);
+constexpr uint32_t kBroadcastOutShape[lib_mli::kEltwiseRank] = {1, 4, 6, 8};
+constexpr int kBroadcastElemNum = 1 * 4 * 6 * 8;
+static int16_t broadcast_mem_in1[kBroadcastElemNum];
+static int16_t broadcast_mem_in2[kBroadcastElemNum];
+static int16_t broadcast_mem_out[kBroadcastElemNum];
+static int16_t broadcast_mem_out_ref[kBroadcastElemNum];
+
+static void set_broadcast_tensor(mli_tensor& t, const uint32_t* shape, int16_t* mem) {
+  t = mli_tensor{};
+  t.el_type = MLI_EL_FX_16;
+  t.rank = lib_mli::kEltwiseRank;
+  for (uint32_t i = 0; i < lib_mli::kEltwiseRank; i++) t.shape[i] = shape[i];
+  mli_hlp_set_tensor_mem_strides(&t);
+  t.data.mem.pi16 = mem;
+  t.data.capacity = kBroadcastElemNum * sizeof(int16_t);
+  t.el_params.fx.frac_bits = 0;
+}
+
+template <typename EltwiseRtTy>
+static void get_broadcast_tile(lib_mli::ExecutionInterface* eltwise,
+                               uint32_t in1_size[lib_mli::kEltwiseRank], uint32_t in2_size[lib_mli::kEltwiseRank],
+                               uint32_t out_size[lib_mli::kEltwiseRank], int32_t in1_offsets[lib_mli::kEltwiseRank],
+                               int32_t in2_offsets[lib_mli::kEltwiseRank], int32_t out_offsets[lib_mli::kEltwiseRank]) {
+  EltwiseRtTy* eltwise_pimpl = dynamic_cast<EltwiseRtTy*>(eltwise);
+  assert(eltwise_pimpl != nullptr);
+  eltwise_pimpl->GetIOSizesAndOffsets(in1_size, in2_size, out_size, in1_offsets, in2_offsets, out_offsets);
+}
+
+// Compile the kernel for the test, run it tile by tile and write the result to broadcast_mem_out
+static void run_broadcast_kernel(const eltwise_broadcast_test_operands* cur_test, const mli_tensor& in2) {
+  int32_t iteration_order[lib_mli::kEltwiseIterRank] = {0, 1, 2, 3};
+  uint32_t in1_tile_shape[lib_mli::kEltwiseIterRank];
+  uint32_t in2_tile_shape[lib_mli::kEltwiseIterRank];
+  uint32_t out_tile_shape[lib_mli::kEltwiseIterRank];
+  uint32_t io_shape[lib_mli::kEltwiseRank];
+  uint32_t in2_shape[lib_mli::kEltwiseRank];
+  int32_t io_stride[lib_mli::kEltwiseRank];
+  int32_t in2_stride[lib_mli::kEltwiseRank];
+
+  io_stride[lib_mli::kEltwiseRank - 1] = 1;
+  for (int i = lib_mli::kEltwiseRank - 1; i >= 0; i--) {
+    io_shape[i] = kBroadcastOutShape[i];
+    if (i < (int)lib_mli::kEltwiseRank - 1) io_stride[i] = io_stride[i + 1] * (int32_t)io_shape[i + 1];
+    const bool is_bcast_dim = in2.shape[i] == 1 && kBroadcastOutShape[i] > 1;
+    in2_shape[i] = (is_bcast_dim && cur_test->is_zero_stride) ? kBroadcastOutShape[i] : in2.shape[i];
+    in2_stride[i] = (is_bcast_dim && cur_test->is_zero_stride) ? 0 : in2.mem_stride[i];
+    in1_tile_shape[i] = cur_test->tile_shape[i];
+    out_tile_shape[i] = cur_test->tile_shape[i];
+    // broadcasted dimension of size 1 isn't tiled, the same values are reused by all tiles
+    in2_tile_shape[i] = std::min(cur_test->tile_shape[i], in2_shape[i]);
+  }
+
+  lib_mli::Tensor<lib_mli::NoBuffer, lib_mli::kEltwiseRank> io_tensor(io_shape, io_stride);
+  lib_mli::Tensor<lib_mli::NoBuffer, lib_mli::kEltwiseRank> in2_tensor(in2_shape, in2_stride);
+  io_tensor.set_elem_size(sizeof(int16_t));
+  in2_tensor.set_elem_size(sizeof(int16_t));
+  lib_mli::TensorIterator<lib_mli::NoBuffer, lib_mli::kEltwiseRank, lib_mli::kEltwiseIterRank>
+      in1_tensor_it(io_tensor, in1_tile_shape, iteration_order);
+  lib_mli::TensorIterator<lib_mli::NoBuffer, lib_mli::kEltwiseRank, lib_mli::kEltwiseIterRank>
+      in2_tensor_it(in2_tensor, in2_tile_shape, iteration_order);
+  lib_mli::TensorIterator<lib_mli::NoBuffer, lib_mli::kEltwiseRank, lib_mli::kEltwiseIterRank>
+      out_tensor_it(io_tensor, out_tile_shape, iteration_order);
+
+  lib_mli::PlatformDescription pd;
+  lib_ref::KernelsFactory kernel_factory(pd);
+  EltwiseOp::KernelTy kernel;
+  void* eltwise_buffer = nullptr;
+  switch (cur_test->ty) {
+    case EltwiseTy::ADD:
+      eltwise_buffer = malloc(kernel_factory.Add_CS_GetSize());
+      kernel = kernel_factory.Add_CS(eltwise_buffer, in1_tensor_it, in2_tensor_it, out_tensor_it);
+      break;
+    case EltwiseTy::SUB:
+      eltwise_buffer = malloc(kernel_factory.Sub_CS_GetSize());
+      kernel = kernel_factory.Sub_CS(eltwise_buffer, in1_tensor_it, in2_tensor_it, out_tensor_it);
+      break;
+    case EltwiseTy::MAX:
+      eltwise_buffer = malloc(kernel_factory.Max_CS_GetSize());
+      kernel = kernel_factory.Max_CS(eltwise_buffer, in1_tensor_it, in2_tensor_it, out_tensor_it);
+      break;
+    default:
+      assert(false);
+  }
+
+  // Runtime object, private data and buffers of a single tile are placed one after another in the memory pool
+  uint32_t instance_size = 0;
+  uint32_t private_size = 0;
+  std::visit([&](auto eltwise_op) {
+    instance_size = eltwise_op->GetRuntimeObjectSize();
+    private_size = eltwise_op->GetKernelPrivateDataSize();
+    uint32_t offset = CEIL_RND(instance_size + private_size, sizeof(int16_t));
+    const uint32_t in1_size = eltwise_op->GetInputLeftBufferSize() * sizeof(int16_t);
+    lib_mli::OffsetBuffer in1_buf{offset, 0, in1_size, sizeof(int16_t)};
+    offset += in1_size;
+    const uint32_t in2_size = eltwise_op->GetInputRightBufferSize() * sizeof(int16_t);
+    lib_mli::OffsetBuffer in2_buf{offset, 0, in2_size, sizeof(int16_t)};
+    offset += in2_size;
+    const uint32_t out_size = eltwise_op->GetOutputBufferSize() * sizeof(int16_t);
+    lib_mli::OffsetBuffer out_buf{offset, 0, out_size, sizeof(int16_t)};
+    offset += out_size;
+    assert(offset <= kMemSize);
+    const lib_mli::OffsetBuffer ctrl_buf{0, 0, 0, sizeof(char)};
+
+    mli_status status = eltwise_op->AttachBufferOffsets(in1_buf, in2_buf, out_buf, ctrl_buf);
+    assert(status == MLI_STATUS_OK);
+    status = eltwise_op->GetKernelPrivateData((int8_t*)g_mem_pool + instance_size);
+    assert(status == MLI_STATUS_OK);
+  }, kernel);
+
+  uint64_t membasis[] = { reinterpret_cast<uint64_t>(g_mem_pool) };
+  auto eltwise = lib_mli::ExecutionInterface::Create(
+    static_cast<void*>(g_mem_pool), instance_size,
+    (int8_t*)g_mem_pool + instance_size, private_size,
+    membasis, sizeof(membasis) / sizeof(membasis[0]));
+  assert(eltwise != nullptr);
+  lib_ref::EltwisePrivateData* eltwise_private = (lib_ref::EltwisePrivateData*)((int8_t*)g_mem_pool + instance_size);
+
+  uint32_t input1_tile_size[lib_mli::kEltwiseRank];
+  uint32_t input2_tile_size[lib_mli::kEltwiseRank];
+  uint32_t output_tile_size[lib_mli::kEltwiseRank];
+  int32_t input1_tile_offsets[lib_mli::kEltwiseRank];
+  int32_t input2_tile_offsets[lib_mli::kEltwiseRank];
+  int32_t output_tile_offsets[lib_mli::kEltwiseRank];
+  const int32_t zero_offsets[lib_mli::kEltwiseRank]{};
+
+  const uint32_t num_tiles = out_tensor_it.GetTotalCount();
+  for (uint32_t i = 0; i < num_tiles; ++i) {
+    mli_status status = eltwise->Prefetch();
+    assert(status == MLI_STATUS_OK);
+    if (cur_test->ty == EltwiseTy::ADD) {
+      get_broadcast_tile<lib_ref::Add>(eltwise, input1_tile_size, input2_tile_size, output_tile_size,
+                                       input1_tile_offsets, input2_tile_offsets, output_tile_offsets);
+    } else if (cur_test->ty == EltwiseTy::SUB) {
+      get_broadcast_tile<lib_ref::Sub>(eltwise, input1_tile_size, input2_tile_size, output_tile_size,
+                                       input1_tile_offsets, input2_tile_offsets, output_tile_offsets);
+    } else {
+      get_broadcast_tile<lib_ref::Max>(eltwise, input1_tile_size, input2_tile_size, output_tile_size,
+                                       input1_tile_offsets, input2_tile_offsets, output_tile_offsets);
+    }
+
+    // copy inputs from global buffer to local tile buffer
+    strided_copy_with_offsets(lib_mli::kEltwiseRank, sizeof(int16_t), (const int8_t*)broadcast_mem_in1,
+                              input1_tile_offsets, zero_offsets, io_stride, input1_tile_size,
+                              (int8_t*)(g_mem_pool + eltwise_private->m_in_left_buffer.get_buf().get_offset()));
+    strided_copy_with_offsets(lib_mli::kEltwiseRank, sizeof(int16_t), (const int8_t*)broadcast_mem_in2,
+                              input2_tile_offsets, zero_offsets, in2_stride, input2_tile_size,
+                              (int8_t*)(g_mem_pool + eltwise_private->m_in_right_buffer.get_buf().get_offset()));
+
+    status = eltwise->Issue();
+    assert(status == MLI_STATUS_OK);
+
+    // copy output from local tile buffer to global buffer
+    strided_copy_with_offsets(lib_mli::kEltwiseRank, sizeof(int16_t),
+                              (int8_t*)(g_mem_pool + eltwise_private->m_output_buffer.get_buf().get_offset()),
+                              zero_offsets, output_tile_offsets, io_stride, output_tile_size,
+                              (int8_t*)broadcast_mem_out);
+
+    status = eltwise->Update();
+    assert(status == MLI_STATUS_OK);
+  }
+  free(eltwise_buffer);
+}
+
+static bool run_broadcast_tests(const reporter_full& reporter) {
+  bool final_status = true;
+  for (int i = 0; i < kBroadcastTestsNum; ++i) {
+    const eltwise_broadcast_test_operands* cur_test = &broadcast_tests_list[i];
+    mli_tensor in1, in2, out_ref;
+    set_broadcast_tensor(in1, kBroadcastOutShape, broadcast_mem_in1);
+    set_broadcast_tensor(in2, cur_test->in2_shape, broadcast_mem_in2);
+    set_broadcast_tensor(out_ref, kBroadcastOutShape, broadcast_mem_out_ref);
+
+    // Pseudo-random values in the whole range of the type to check saturation as well
+    for (int k = 0; k < kBroadcastElemNum; k++) {
+      broadcast_mem_in1[k] = (int16_t)(((k * 37 + 11) % 251 - 125) * 261);
+      broadcast_mem_in2[k] = (int16_t)(((k * 53 + 7) % 241 - 120) * 271);
+    }
+    memset(broadcast_mem_out, 0x55, sizeof(broadcast_mem_out));
+    memset(broadcast_mem_out_ref, 0, sizeof(broadcast_mem_out_ref));
+
+    bool is_test_passed = true;
+    if (cur_test->mli_krn_eltwise(&in1, &in2, &out_ref) != MLI_STATUS_OK) {
+      reporter.report_message(cur_test->descr, "FAILED at kernel run: MLI2.0 kernel returned bad status");
+      is_test_passed = false;
+    }
+
+    if (is_test_passed) {
+      run_broadcast_kernel(cur_test, in2);
+      if (memcmp(broadcast_mem_out, broadcast_mem_out_ref, sizeof(broadcast_mem_out)) != 0) {
+        reporter.report_message(cur_test->descr, "FAILED at comparison output with MLI2.0 kernel");
+        is_test_passed = false;
+      }
+    }
+
+    if (is_test_passed) {
+      reporter.report_message(cur_test->descr, "PASSED");
+    }
+    final_status &= is_test_passed;
+  }
+  return final_status;
+}
+
 int main() {
   const reporter_full reporter;
   bool final_status = true;
@@ -1252,6 +1482,8 @@ int main() {
     final_status &= is_test_passed;
   }
 
+  final_status &= run_broadcast_tests(reporter);
+
   reporter.report_outline("[AUTO] Group: mli_krn_eltwise_30", final_status);
 
   return (final_status) ? 0 : 1;
@@ -0,0 +1,422 @@
+/*
+* Copyright 2022, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include "mli_kernels_factory_ref.hpp"
+#include "mli_ref_runtime_api.hpp"
+#include "test_memory_manager.h"
+#include "test_report.h"
+#include "test_tiling.hpp"
+#include "tests_aux.h"
+
+namespace lib_ref = ::snps_arc::metaware::mli::ref;
+
+using lib_mli::kEltwiseRank;
+using lib_mli::kEltwiseIterRank;
+using lib_mli::kEltwiseChainParamRank;
+using lib_mli::kEltwiseChainLutSize;
+using lib_mli::EltwiseChainOp;
+using lib_mli::EltwiseChainConfig;
+using mli::tst::reporter_basic;
+
+// Output has more channels than the chunk of the kernel, tiles split both height and channels
+constexpr uint32_t kChannels = 80;
+static uint32_t kOutShape[kEltwiseRank]{ 1, 6, 5, kChannels };
+static const uint32_t kTileSize[kEltwiseRank]{ 1, 2, 5, 48 };
+constexpr uint32_t kNumElems = 1 * 6 * 5 * kChannels;
+constexpr uint32_t kMaxSteps = 4;
+
+constexpr uint32_t kMemSize = 64 * 1024;
+static IO_DATA_ATTR int8_t g_mem_pool[kMemSize] = {0};
+
+static int32_t g_in_left[kNumElems];
+static int32_t g_in_right[kNumElems];
+static int32_t g_out[kNumElems];
+static int32_t g_ref_out[kNumElems];
+
+// Parameters of each step as given to the encoder
+struct chain_step_params {
+  int32_t in_bias[kChannels];
+  int32_t out_bias[kChannels];
+  int16_t scale[2][kChannels];   // [positive, negative]
+  int8_t shift[2][kChannels];
+  int32_t clip[2];               // [min, max]
+  int8_t lut[kEltwiseChainLutSize];
+};
+static chain_step_params g_step_params[kMaxSteps];
+
+struct eltwise_chain_test_operands {
+  const char* descr;
+  uint32_t in_elem_size;
+  uint32_t out_elem_size;
+  bool broadcast_right;          // right input has shape [1, 1, 1, C]
+  uint32_t num_steps;
+  EltwiseChainOp ops[kMaxSteps];
+  bool per_channel[kMaxSteps];
+  int8_t shift;                  // minimal shift of rescale and prelu steps
+  int32_t clip_min;
+  int32_t clip_max;
+};
+
+static const eltwise_chain_test_operands tests_list[] = {
+  {"Test 1 SA8 Add->Rescale->Clip", 1, 1, false, 3,
+   {EltwiseChainOp::kAdd, EltwiseChainOp::kRescale, EltwiseChainOp::kClip}, {false, false, false}, 14, -100, 90},
+  {"Test 2 SA8 Add->Rsc(ch)->Clip", 1, 1, false, 3,
+   {EltwiseChainOp::kAdd, EltwiseChainOp::kRescale, EltwiseChainOp::kClip}, {false, true, false}, 14, -128, 0},
+  {"Test 3 SA8 Mul->Rescale", 1, 1, false, 2,
+   {EltwiseChainOp::kMul, EltwiseChainOp::kRescale}, {false, false}, 22, 0, 0},
+  {"Test 4 SA16 Mul->Rescale(ch)", 2, 2, false, 2,
+   {EltwiseChainOp::kMul, EltwiseChainOp::kRescale}, {false, true}, 30, 0, 0},
+  {"Test 5 SA8 Add(bc)->Prelu->Lut", 1, 1, true, 3,
+   {EltwiseChainOp::kAdd, EltwiseChainOp::kPrelu, EltwiseChainOp::kLut}, {false, true, false}, 14, 0, 0},
+  {"Test 6 SA32 Sub->Max->Rsc->Clip", 4, 1, false, 4,
+   {EltwiseChainOp::kSub, EltwiseChainOp::kMax, EltwiseChainOp::kRescale, EltwiseChainOp::kClip},
+   {false, false, false, false}, 33, -120, 120},
+};
+constexpr int kTestsNum = sizeof(tests_list) / sizeof(tests_list[0]);
+
+static int32_t rand_range(int32_t min_val, int32_t max_val) {
+  return min_val + (int32_t)(rand() % (uint32_t)(max_val - min_val + 1));
+}
+
+static int32_t sat32(int64_t val) {
+  return (int32_t)MIN(MAX(val, (int64_t)INT32_MIN), (int64_t)INT32_MAX);
+}
+
+static int32_t sat_to_elem_size(int32_t val, uint32_t elem_size) {
+  const int32_t max_val = elem_size == 1 ? INT8_MAX : (elem_size == 2 ? INT16_MAX : INT32_MAX);
+  const int32_t min_val = elem_size == 1 ? INT8_MIN : (elem_size == 2 ? INT16_MIN : INT32_MIN);
+  return MIN(MAX(val, min_val), max_val);
+}
+
+// Right shift with the rounding of the library (shift > 0)
+static int64_t shift_rnd(int64_t val, int shift) {
+#if defined(CRC_RM_CONVERGENT)
+  const int64_t half = (int64_t)1 << (shift - 1);
+  const int64_t rem = val & (((int64_t)1 << shift) - 1);
+  int64_t res = val >> shift;
+  if (rem > half || (rem == half && (res & 1))) res++;
+  return res;
+#else
+  return (val + ((int64_t)1 << (shift - 1))) >> shift;
+#endif
+}
+
+static int32_t reference_rescale(int32_t val, int32_t in_bias, int32_t out_bias, int16_t scale, int8_t shift) {
+  const int64_t scaled = (int64_t)sat32((int64_t)val - in_bias) * scale;
+  return sat32(shift_rnd(scaled, shift) + out_bias);
+}
+
+// Straightforward unfused processing: each step is a separate pass over the whole int32 tensor
+static void reference_eltwise_chain(const eltwise_chain_test_operands& cur_test, int32_t* out) {
+  for (uint32_t i = 0; i < kNumElems; i++) {
+    out[i] = g_in_left[i];
+  }
+  for (uint32_t s = 0; s < cur_test.num_steps; s++) {
+    const chain_step_params& p = g_step_params[s];
+    for (uint32_t i = 0; i < kNumElems; i++) {
+      const uint32_t ch = i % kChannels;
+      const int32_t rhs = g_in_right[cur_test.broadcast_right ? ch : i];
+      const uint32_t idx = cur_test.per_channel[s] ? ch : 0;
+      switch (cur_test.ops[s]) {
+        case EltwiseChainOp::kAdd: out[i] = sat32((int64_t)out[i] + rhs); break;
+        case EltwiseChainOp::kSub: out[i] = sat32((int64_t)out[i] - rhs); break;
+        case EltwiseChainOp::kMul: out[i] = sat32((int64_t)out[i] * rhs); break;
+        case EltwiseChainOp::kMax: out[i] = MAX(out[i], rhs); break;
+        case EltwiseChainOp::kMin: out[i] = MIN(out[i], rhs); break;
+        case EltwiseChainOp::kRescale:
+          out[i] = reference_rescale(out[i], p.in_bias[idx], p.out_bias[idx], p.scale[0][idx], p.shift[0][idx]);
+          break;
+        case EltwiseChainOp::kPrelu: {
+          const int sign = out[i] < p.in_bias[idx] ? 1 : 0;
+          out[i] = reference_rescale(out[i], p.in_bias[idx], p.out_bias[idx], p.scale[sign][idx], p.shift[sign][idx]);
+          break;
+        }
+        case EltwiseChainOp::kClip: out[i] = MIN(MAX(out[i], p.clip[0]), p.clip[1]); break;
+        case EltwiseChainOp::kLut: out[i] = p.lut[MIN(MAX(out[i], INT8_MIN), INT8_MAX) - INT8_MIN]; break;
+        default: assert(0); break;
+      }
+    }
+  }
+  for (uint32_t i = 0; i < kNumElems; i++) {
+    out[i] = sat_to_elem_size(out[i], cur_test.out_elem_size);
+  }
+}
+
+static void prepare_phase(const eltwise_chain_test_operands& cur_test) {
+  // int32 inputs are kept small enough for the rescale to int8
+  const int32_t in_max = cur_test.in_elem_size == 4 ? (1 << 24) : sat_to_elem_size(INT32_MAX, cur_test.in_elem_size);
+  for (uint32_t i = 0; i < kNumElems; i++) {
+    g_in_left[i] = rand_range(-in_max - 1, in_max);
+    g_in_right[i] = rand_range(-in_max - 1, in_max);
+  }
+  for (uint32_t s = 0; s < cur_test.num_steps; s++) {
+    chain_step_params& p = g_step_params[s];
+    for (uint32_t c = 0; c < kChannels; c++) {
+      p.in_bias[c] = rand_range(-16, 16);
+      p.out_bias[c] = rand_range(-8, 8);
+      p.scale[0][c] = (int16_t)rand_range(8192, INT16_MAX);
+      p.scale[1][c] = (int16_t)rand_range(1024, 8192);
+      p.shift[0][c] = (int8_t)(cur_test.shift + rand_range(0, 2));
+      p.shift[1][c] = (int8_t)(cur_test.shift + rand_range(0, 2));
+    }
+    p.clip[0] = cur_test.clip_min;
+    p.clip[1] = cur_test.clip_max;
+    for (uint32_t i = 0; i < kEltwiseChainLutSize; i++) {
+      p.lut[i] = (int8_t)rand_range(INT8_MIN, INT8_MAX);
+    }
+  }
+}
+
+static void copy_to_elem_size(const int32_t* src, uint32_t n, uint32_t elem_size, int8_t* dst) {
+  for (uint32_t i = 0; i < n; i++) {
+    if (elem_size == 1) dst[i] = (int8_t)src[i];
+    else if (elem_size == 2) ((int16_t*)dst)[i] = (int16_t)src[i];
+    else ((int32_t*)dst)[i] = src[i];
+  }
+}
+
+static void copy_from_elem_size(const int8_t* src, uint32_t n, uint32_t elem_size, int32_t* dst) {
+  for (uint32_t i = 0; i < n; i++) {
+    if (elem_size == 1) dst[i] = src[i];
+    else if (elem_size == 2) dst[i] = ((const int16_t*)src)[i];
+    else dst[i] = ((const int32_t*)src)[i];
+  }
+}
+
+// Iterator config of an input follows the output one, broadcasted dimensions stay at the single position
+static lib_mli::IteratorCfg<kEltwiseIterRank> get_input_it_cfg(
+    const lib_mli::IteratorCfg<kEltwiseIterRank>& out_cfg,
+    const lib_mli::Tensor<lib_mli::NoBuffer, kEltwiseRank>& in_tensor) {
+  uint32_t kernel_size[kEltwiseRank];
+  uint32_t stride[kEltwiseRank];
+  uint32_t padding[kEltwiseRank];
+  for (uint32_t i = 0; i < kEltwiseRank; i++) {
+    kernel_size[i] = 1;
+    stride[i] = in_tensor.get_dim(i) == kOutShape[i] ? 1 : 0;
+    padding[i] = 0;
+  }
+  return lib_mli::IteratorCfg<kEltwiseIterRank>(out_cfg, in_tensor, kernel_size, stride, padding);
+}
+
+static bool execution_phase(const eltwise_chain_test_operands& cur_test, int8_t* in_left, int8_t* in_right,
+                            int8_t* output) {
+  // STEP 1: Construct EltwiseChain as a specific ExecutionInterface successor
+  //==================================================================
+  uint32_t right_shape[kEltwiseRank]{ 1, 1, 1, kChannels };
+  if (!cur_test.broadcast_right) memcpy(right_shape, kOutShape, sizeof(right_shape));
+  int32_t out_stride[kEltwiseRank];
+  int32_t right_stride[kEltwiseRank];
+  out_stride[kEltwiseRank - 1] = right_stride[kEltwiseRank - 1] = 1;
+  for (int i = kEltwiseRank - 2; i >= 0; i--) {
+    out_stride[i] = out_stride[i + 1] * kOutShape[i + 1];
+    right_stride[i] = right_stride[i + 1] * right_shape[i + 1];
+  }
+
+  const lib_mli::Tensor<lib_mli::NoBuffer, kEltwiseRank> out_tensor(kOutShape, out_stride);
+  const lib_mli::Tensor<lib_mli::NoBuffer, kEltwiseRank> right_tensor(right_shape, right_stride);
+  int32_t iteration_order[kEltwiseIterRank]{ 0, 1, 2, 3 };
+  lib_mli::IteratorCfg<kEltwiseIterRank> out_it_config(out_tensor, kTileSize, iteration_order);
+  lib_mli::TensorIterator<lib_mli::NoBuffer, kEltwiseRank, kEltwiseIterRank> left_tensor_it(
+      out_tensor, get_input_it_cfg(out_it_config, out_tensor));
+  lib_mli::TensorIterator<lib_mli::NoBuffer, kEltwiseRank, kEltwiseIterRank> right_tensor_it(
+      right_tensor, get_input_it_cfg(out_it_config, right_tensor));
+  lib_mli::TensorIterator<lib_mli::NoBuffer, kEltwiseRank, kEltwiseIterRank> out_tensor_it(out_tensor, out_it_config);
+  const uint32_t num_tiles = out_tensor_it.GetTotalCount();
+
+  EltwiseChainConfig cfg;
+  for (uint32_t s = 0; s < cur_test.num_steps; s++) {
+    if (!cfg.AddStep(cur_test.ops[s], cur_test.per_channel[s])) return false;
+  }
+
+  lib_mli::PlatformDescription pd;
+  lib_ref::KernelsFactory kernel_factory(pd);
+  void* chain_cs_buffer = malloc(kernel_factory.EltwiseChain_CS_GetSize());
+  auto chain_op = kernel_factory.EltwiseChain_CS(chain_cs_buffer, left_tensor_it, right_tensor_it, cfg, out_tensor_it);
+
+  // STEP 2: Memory management (Up to user on how to deal with it)
+  //==================================================================
+  uint32_t offset = 0;
+  const uint32_t runtime_obj_size = chain_op->GetRuntimeObjectSize();
+  offset += runtime_obj_size;
+  const uint32_t private_buffer_size = chain_op->GetKernelPrivateDataSize();
+  const uint32_t private_buffer_offset = offset;
+  offset += private_buffer_size;
+
+  // tile buffers keep the strides of the full tensors
+  uint32_t right_tile_size[kEltwiseRank];
+  for (uint32_t i = 0; i < kEltwiseRank; i++) {
+    right_tile_size[i] = MIN(kTileSize[i], right_shape[i]);
+  }
+  const uint32_t i_elem_size = cur_test.in_elem_size;
+  const uint32_t o_elem_size = cur_test.out_elem_size;
+  const uint32_t left_size = lib_mli::service::GetBufferSize(kEltwiseRank, kTileSize, out_stride) * i_elem_size;
+  lib_mli::OffsetBuffer left_buf{offset, 0, left_size, i_elem_size};
+  offset += left_size;
+  const uint32_t right_size = lib_mli::service::GetBufferSize(kEltwiseRank, right_tile_size, right_stride) * i_elem_size;
+  lib_mli::OffsetBuffer right_buf{offset, 0, right_size, i_elem_size};
+  offset += right_size;
+  const uint32_t out_size = lib_mli::service::GetBufferSize(kEltwiseRank, kTileSize, out_stride) * o_elem_size;
+  lib_mli::OffsetBuffer out_buf{offset, 0, out_size, o_elem_size};
+  offset += out_size;
+
+  offset = CEIL_RND(offset, lib_mli::kMliAlignment);
+  const uint32_t params_size = chain_op->GetEncodedParamsSize();
+  lib_mli::OffsetBuffer params_buf{offset, 0, params_size, sizeof(int8_t)};
+  offset += params_size;
+
+  const uint32_t ctrl_buffer_size = chain_op->GetCtrlBufferSize();
+  lib_mli::OffsetBuffer ctrl_buf{offset, 0, ctrl_buffer_size, sizeof(char)};
+  offset += ctrl_buffer_size;
+  assert(offset <= kMemSize);
+
+  // encode parameters of each step directly into the parameters buffer
+  lib_mli::Buffer encoded_params(g_mem_pool + params_buf.get_offset(), params_size);
+  bool is_encoded = true;
+  for (uint32_t s = 0; s < cur_test.num_steps; s++) {
+    chain_step_params& p = g_step_params[s];
+    uint32_t num[kEltwiseChainParamRank]{ cur_test.per_channel[s] ? kChannels : 1 };
+    uint32_t clip_num[kEltwiseChainParamRank]{ 1 };
+    uint32_t lut_num[kEltwiseChainParamRank]{ kEltwiseChainLutSize };
+    lib_mli::Tensor<lib_mli::Buffer, kEltwiseChainParamRank> in_bias(
+        lib_mli::Buffer(p.in_bias, sizeof(p.in_bias), sizeof(int32_t)), num);
+    lib_mli::Tensor<lib_mli::Buffer, kEltwiseChainParamRank> out_bias(
+        lib_mli::Buffer(p.out_bias, sizeof(p.out_bias), sizeof(int32_t)), num);
+    lib_mli::Tensor<lib_mli::Buffer, kEltwiseChainParamRank> posscale(
+        lib_mli::Buffer(p.scale[0], sizeof(p.scale[0]), sizeof(int16_t)), num);
+    lib_mli::Tensor<lib_mli::Buffer, kEltwiseChainParamRank> negscale(
+        lib_mli::Buffer(p.scale[1], sizeof(p.scale[1]), sizeof(int16_t)), num);
+    lib_mli::Tensor<lib_mli::Buffer, kEltwiseChainParamRank> posshift(
+        lib_mli::Buffer(p.shift[0], sizeof(p.shift[0]), sizeof(int8_t)), num);
+    lib_mli::Tensor<lib_mli::Buffer, kEltwiseChainParamRank> negshift(
+        lib_mli::Buffer(p.shift[1], sizeof(p.shift[1]), sizeof(int8_t)), num);
+    lib_mli::Tensor<lib_mli::Buffer, kEltwiseChainParamRank> clip_min(
+        lib_mli::Buffer(&p.clip[0], sizeof(int32_t), sizeof(int32_t)), clip_num);
+    lib_mli::Tensor<lib_mli::Buffer, kEltwiseChainParamRank> clip_max(
+        lib_mli::Buffer(&p.clip[1], sizeof(int32_t), sizeof(int32_t)), clip_num);
+    lib_mli::Tensor<lib_mli::Buffer, kEltwiseChainParamRank> lut(
+        lib_mli::Buffer(p.lut, sizeof(p.lut), sizeof(int8_t)), lut_num);
+
+    mli_status status = MLI_STATUS_OK;
+    switch (cur_test.ops[s]) {
+      case EltwiseChainOp::kRescale:
+        status = chain_op->EncodeRescaleParams(s, in_bias, out_bias, posscale, posshift, encoded_params);
+        break;
+      case EltwiseChainOp::kPrelu:
+        status = chain_op->EncodePreluParams(s, in_bias, out_bias, posscale, negscale, posshift, negshift,
+                                             encoded_params);
+        break;
+      case EltwiseChainOp::kClip:
+        status = chain_op->EncodeClipParams(s, clip_min, clip_max, encoded_params);
+        break;
+      case EltwiseChainOp::kLut:
+        status = chain_op->EncodeLutParams(s, lut, encoded_params);
+        break;
+      default:
+        // binary steps have no parameters
+        status = chain_op->EncodeClipParams(s, clip_min, clip_max, encoded_params) == MLI_STATUS_BAD_FUNC_CFG
+                 ? MLI_STATUS_OK : MLI_STATUS_BAD_FUNC_CFG;
+        break;
+    }
+    is_encoded &= status == MLI_STATUS_OK;
+  }
+
+  mli_status status = chain_op->AttachBufferOffsets(left_buf, right_buf, out_buf, params_buf, ctrl_buf);
+  assert(status == MLI_STATUS_OK);
+  status = chain_op->GetKernelPrivateData(g_mem_pool + private_buffer_offset);
+  assert(status == MLI_STATUS_OK);
+
+  // STEP 3: Execution phase
+  //==================================================================
+  uint64_t membasis[] = {reinterpret_cast<uint64_t>(g_mem_pool)};
+  auto chain_run_op = lib_mli::ExecutionInterface::Create(g_mem_pool, runtime_obj_size,
+                                                          g_mem_pool + private_buffer_offset, private_buffer_size,
+                                                          membasis, sizeof(membasis) / sizeof(membasis[0]));
+  assert(chain_run_op != nullptr);
+  lib_ref::EltwiseChain* chain_pimpl = dynamic_cast<lib_ref::EltwiseChain*>(chain_run_op);
+
+  uint32_t left_tile_size[kEltwiseRank];
+  uint32_t cur_right_tile_size[kEltwiseRank];
+  uint32_t out_tile_size[kEltwiseRank];
+  int32_t left_tile_offsets[kEltwiseRank];
+  int32_t right_tile_offsets[kEltwiseRank];
+  int32_t out_tile_offsets[kEltwiseRank];
+  const int32_t zero_offsets[kEltwiseRank]{};
+  for (uint32_t n_tile = 0; n_tile < num_tiles; n_tile++) {
+    status = chain_run_op->Prefetch();
+    assert(status == MLI_STATUS_OK);
+
+    chain_pimpl->GetIOSizesAndOffsets(left_tile_size, cur_right_tile_size, out_tile_size,
+                                      left_tile_offsets, right_tile_offsets, out_tile_offsets);
+
+    // copy inputs from global buffers to local tile buffers
+    strided_copy_with_offsets(kEltwiseRank, i_elem_size, in_left, left_tile_offsets, zero_offsets, out_stride,
+                              left_tile_size, g_mem_pool + left_buf.get_offset());
+    strided_copy_with_offsets(kEltwiseRank, i_elem_size, in_right, right_tile_offsets, zero_offsets, right_stride,
+                              cur_right_tile_size, g_mem_pool + right_buf.get_offset());
+
+    status = chain_run_op->Issue();
+    assert(status == MLI_STATUS_OK);
+
+    // copy output from local tile buffer to global buffer
+    strided_copy_with_offsets(kEltwiseRank, o_elem_size, g_mem_pool + out_buf.get_offset(), zero_offsets,
+                              out_tile_offsets, out_stride, out_tile_size, output);
+
+    status = chain_run_op->Update();
+    assert(status == MLI_STATUS_OK);
+  }
+  free(chain_cs_buffer);
+  return is_encoded;
+}
+
+static bool run_case(const reporter_basic& reporter, const eltwise_chain_test_operands& cur_test) {
+  static int8_t in_left[kNumElems * sizeof(int32_t)];
+  static int8_t in_right[kNumElems * sizeof(int32_t)];
+  static int8_t output[kNumElems * sizeof(int32_t)];
+
+  prepare_phase(cur_test);
+  const uint32_t right_num = cur_test.broadcast_right ? kChannels : kNumElems;
+  copy_to_elem_size(g_in_left, kNumElems, cur_test.in_elem_size, in_left);
+  copy_to_elem_size(g_in_right, right_num, cur_test.in_elem_size, in_right);
+  memset(output, 0, sizeof(output));
+
+  const bool is_encoded = execution_phase(cur_test, in_left, in_right, output);
+
+  copy_from_elem_size(output, kNumElems, cur_test.out_elem_size, g_out);
+  reference_eltwise_chain(cur_test, g_ref_out);
+  uint32_t mismatches = 0;
+  for (uint32_t i = 0; i < kNumElems; i++) {
+    if (g_out[i] != g_ref_out[i]) mismatches++;
+  }
+
+  const bool passed = is_encoded && mismatches == 0;
+  char message[256]{};
+  if (!is_encoded) {
+    sprintf(message, "FAILED at encoding of parameters");
+  } else {
+    sprintf(message, "Mismatches with unfused reference = %u", mismatches);
+  }
+  reporter.report_case(cur_test.descr, message, passed);
+  return passed;
+}
+
+int main() {
+  const reporter_basic reporter;
+  reporter.report_header("MLI3.0|Kernels|Eltwise Chain Function Tests");
+
+  srand(0x5EED);
+  bool final_status = true;
+  for (int i = 0; i < kTestsNum; i++) {
+    final_status &= run_case(reporter, tests_list[i]);
+  }
+
+  reporter.report_outline("[AUTO] Group: mli_krn_eltwise_chain_30", final_status);
+  return final_status ? 0 : 1;
+}
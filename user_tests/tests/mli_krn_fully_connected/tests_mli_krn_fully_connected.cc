@@ -13,6 +13,7 @@
 #include <stdio.h>
 #include <string.h>
 
+#include "test_benchmark.h"
 #include "test_crc32_calc.h"
 #include "test_memory_manager.h"
 #include "test_quality_metrics.h"
@@ -28,6 +29,9 @@ using mli::tst::quality_metrics;
 using mli::tst::crc32_calc;
 using mli::tst::reporter_full;
 using mli::tst::memory_manager;
+using mli::tst::benchmark_reporter;
+using mli::tst::bench_data_bytes;
+using mli::tst::bench_memory_footprint;
 
 typedef mli_status(*fully_connected_func_ptr)(
     const mli_tensor* /*input*/,
@@ -36,6 +40,26 @@ typedef mli_status(*fully_connected_func_ptr)(
     const mli_fully_connected_cfg* /*cfg*/,
     mli_tensor* /*output*/);
 
+// Quantization params of the layer are cached before each run to check that the kernel which
+// consumes the cache gives the same result as the regular one
+constexpr int kCacheMaxChannels = 512;
+static int32_t cache_bias[kCacheMaxChannels];
+static int32_t cache_out_mul[kCacheMaxChannels];
+static int8_t cache_out_shift[kCacheMaxChannels];
+
+static mli_status mli_krn_fully_connected_sa8_sa8_sa32_cache_and_run(
+        const mli_tensor* in,
+        const mli_tensor* weights,
+        const mli_tensor* bias,
+        const mli_fully_connected_cfg* cfg,
+        mli_tensor* out) {
+    if (weights->shape[1] > kCacheMaxChannels) return MLI_STATUS_NOT_ENGH_MEM;
+    mli_sa8_quant_cache cache = { cache_bias, cache_out_mul, cache_out_shift, 0, 0 };
+    mli_status ret = mli_krn_fully_connected_sa8_sa8_sa32_cache_quant(in, weights, bias, cfg, out, &cache);
+    if (ret != MLI_STATUS_OK) return ret;
+    return mli_krn_fully_connected_sa8_sa8_sa32_cached(in, weights, &cache, cfg, out);
+}
+
 struct fully_connected_test_operands {
     const char* descr;
     const fully_connected_func_ptr mli_krn_fully_connected;
@@ -158,6 +182,23 @@ static const fully_connected_test_operands tests_list[] = {
     {"Test 5 SA8_SA8_SA32 Spec", mli_krn_fully_connected_sa8_sa8_sa32_ext_bias,
                                       input_3_sa8, weights_4_sa8, bias_4_i3_w4_sa32_spec, test_5_out_sa8, test_5_cfg,
                                       thresholds_sa8_general, test_5_chksum_sa8_spec},
+
+    // Cached quantization params: the same results as the regular kernel are expected
+    {"Test 1 SA8 Cached",         mli_krn_fully_connected_sa8_sa8_sa32_cache_and_run,
+                                  input_1_sa8, weights_1_sa8_per_axis, bias_1_sa32_per_axis, test_1_out_sa8, test_1_cfg,
+                                  thresholds_sa8_general, test_1_chksum_sa8},
+    {"Test 2 SA8 Cached ReluGen", mli_krn_fully_connected_sa8_sa8_sa32_cache_and_run,
+                                  input_1_sa8, weights_1_sa8, bias_1_sa32, test_2_out_sa8, test_2_cfg,
+                                  thresholds_sa8_general, test_2_chksum_sa8},
+    {"Test 3 SA8 Cached Mstr",    mli_krn_fully_connected_sa8_sa8_sa32_cache_and_run,
+                                  input_1_sa8, weights_2_memstr_sa8_per_axis, bias_2_i1_w2_sa32_per_axis, test_3_out_sa8, test_3_cfg,
+                                  thresholds_sa8_general, test_3_chksum_sa8},
+    {"Test 4 SA8 Cached Relu6",   mli_krn_fully_connected_sa8_sa8_sa32_cache_and_run,
+                                  input_2_sa8, weights_3_sa8_per_axis, bias_3_i2_w3_sa32_per_axis, test_4_out_sa8, test_4_cfg,
+                                  thresholds_sa8_general, test_4_chksum_sa8},
+    {"Test 5 SA8 Cached Huge Vals", mli_krn_fully_connected_sa8_sa8_sa32_cache_and_run,
+                                  input_3_sa8, weights_4_sa8, bias_4_i3_w4_sa32, test_5_out_sa8, test_5_cfg,
+                                  thresholds_sa8_general, test_5_chksum_sa8},
 };
 
 constexpr int kMemSize = 2047;
@@ -168,8 +209,77 @@ static W_DATA_ATTR int8_t scratch_mem_b[kMemSize] = { 0 };
 
 constexpr int kTestsNum = sizeof(tests_list) / sizeof(tests_list[0]);
 
+// Batched mode check: each sample of a batch must be processed exactly as a single input vector.
+// Samples are circular shifts of the test input placed with a padded row stride.
+constexpr int kBatchSize = 4;
+constexpr int kBatchRowPad = 3;
+static IO_DATA_ATTR int8_t batch_mem_in[kMemSize * kBatchSize] = { 0 };
+static IO_DATA_ATTR int8_t batch_mem_out[kMemSize * kBatchSize] = { 0 };
+static IO_DATA_ATTR int8_t single_mem_out[kMemSize] = { 0 };
+
+static bool check_batched_mode(const fully_connected_test_operands* cur_test, const mli_tensor& input,
+                               const mli_tensor& weights, const mli_tensor& bias, const mli_tensor& out) {
+    const int in_sz = mli_hlp_count_elem_num(&input, 0);
+    const int out_sz = mli_hlp_count_elem_num(&out, 0);
+    const int in_elem_size = mli_hlp_tensor_element_size(&input);
+    const int out_elem_size = mli_hlp_tensor_element_size(&out);
+    const int in_row_stride = in_sz + kBatchRowPad;
+    const int out_row_stride = out_sz + kBatchRowPad;
+    if (kBatchSize * in_row_stride * in_elem_size > (int)sizeof(batch_mem_in) ||
+            kBatchSize * out_row_stride * out_elem_size > (int)sizeof(batch_mem_out))
+        return false;
+
+    const int8_t* src = input.data.mem.pi8;
+    for (int b = 0; b < kBatchSize; b++) {
+        const int shift = (b * 7) % in_sz;
+        int8_t* dst = batch_mem_in + b * in_row_stride * in_elem_size;
+        memcpy(dst, src + shift * in_elem_size, (in_sz - shift) * in_elem_size);
+        memcpy(dst + (in_sz - shift) * in_elem_size, src, shift * in_elem_size);
+    }
+
+    mli_tensor batch_in = input;
+    batch_in.data.mem.pi8 = batch_mem_in;
+    batch_in.data.capacity = sizeof(batch_mem_in);
+    batch_in.rank = 2;
+    batch_in.shape[0] = kBatchSize;
+    batch_in.shape[1] = in_sz;
+    batch_in.mem_stride[0] = in_row_stride;
+    batch_in.mem_stride[1] = 1;
+
+    mli_tensor batch_out = out;
+    batch_out.data.mem.pi8 = batch_mem_out;
+    batch_out.data.capacity = sizeof(batch_mem_out);
+    batch_out.rank = 2;
+    batch_out.shape[0] = kBatchSize;
+    batch_out.shape[1] = out_sz;
+    batch_out.mem_stride[0] = out_row_stride;
+    batch_out.mem_stride[1] = 1;
+
+    if (cur_test->mli_krn_fully_connected(&batch_in, &weights, &bias, &cur_test->cfg, &batch_out) != MLI_STATUS_OK)
+        return false;
+
+    for (int b = 0; b < kBatchSize; b++) {
+        mli_tensor single_in = batch_in;
+        single_in.data.mem.pi8 = batch_mem_in + b * in_row_stride * in_elem_size;
+        single_in.data.capacity = in_sz * in_elem_size;
+        single_in.rank = 1;
+        single_in.shape[0] = in_sz;
+        single_in.mem_stride[0] = 1;
+
+        mli_tensor single_out = out;
+        single_out.data.mem.pi8 = single_mem_out;
+        single_out.data.capacity = sizeof(single_mem_out);
+
+        if (cur_test->mli_krn_fully_connected(&single_in, &weights, &bias, &cur_test->cfg, &single_out) != MLI_STATUS_OK ||
+                memcmp(single_mem_out, batch_mem_out + b * out_row_stride * out_elem_size, out_sz * out_elem_size) != 0)
+            return false;
+    }
+    return true;
+}
+
 int main() {
     const reporter_full reporter;
+    benchmark_reporter bench;
     bool final_status = true;
 
     reporter.report_header("MLI|Kernels|Fully Connected Tests");
@@ -189,7 +299,10 @@ int main() {
                 strstr(cur_test->descr, "Test 3 SA8_SA8_SA32 Relu1 Mstr") != nullptr ||
                 strstr(cur_test->descr, "Test 5 FX16 Huge Vals") != nullptr ||
                 strstr(cur_test->descr, "Test 5 SA8_SA8_SA32 Huge Vals") != nullptr ||
-                strstr(cur_test->descr, "Test 5 SA8_SA8_SA32 Spec") != nullptr) {
+                strstr(cur_test->descr, "Test 5 SA8_SA8_SA32 Spec") != nullptr ||
+                strstr(cur_test->descr, "Test 1 SA8 Cached") != nullptr ||
+                strstr(cur_test->descr, "Test 3 SA8 Cached") != nullptr ||
+                strstr(cur_test->descr, "Test 5 SA8 Cached") != nullptr) {
             // VPX fails bitwise comparison with reference .
             reporter.report_message(cur_test->descr, "SKIPPED due to a known issue");
             continue;
@@ -226,7 +339,7 @@ int main() {
 
         // Run specific kernel for test
         if (is_test_passed &&
-                cur_test->mli_krn_fully_connected(&input, &weights, &bias, &cur_test->cfg, &out) != MLI_STATUS_OK) {
+                bench.measure([&] { return cur_test->mli_krn_fully_connected(&input, &weights, &bias, &cur_test->cfg, &out); }) != MLI_STATUS_OK) {
             reporter.report_message(cur_test->descr, "FAILED at kernel run: kernel returned bad status");
             is_test_passed = false;
         }
@@ -262,6 +375,11 @@ int main() {
             }
         }
 
+        if (is_test_passed && !check_batched_mode(cur_test, input, weights, bias, out)) {
+            reporter.report_message(cur_test->descr, "FAILED at batched mode: results differ from single runs");
+            is_test_passed = false;
+        }
+
         if (is_test_passed) {
             crc32_calc data_crc;
             data_crc(input);
@@ -272,9 +390,15 @@ int main() {
             is_test_passed &= reporter.evaluate_and_report_case(cur_test->descr, test_metrics, cur_test->threshold,
                                                                 data_crc, cur_test->check_sum);
         }
+        if (is_test_passed) {
+            bench.add_case(cur_test->descr, mli_hlp_count_elem_num(&weights, 0),
+                           bench_data_bytes({&input, &weights, &bias, &out}),
+                           bench_memory_footprint({&input, &weights, &bias, &out}));
+        }
         final_status &= is_test_passed;
     }
 
+    bench.report("mli_krn_fully_connected");
     reporter.report_outline("[AUTO] Group: mli_krn_fully_connected", final_status);
 
     return (final_status) ? 0 : 1;
@@ -1043,6 +1043,145 @@ bool postprocess_phase(const reporter_full& reporter,
   return is_test_passed;
 }
 
+// Batched mode check: FullyConnected_CS with several input vectors (N > 1) must give
+// the same accumulators as a direct calculation for each sample.
+// Samples are circular shifts of the test input placed with a padded row stride.
+constexpr uint32_t kBatchSize = 4;
+constexpr uint32_t kBatchRowPad = 3;
+static IO_DATA_ATTR int8_t g_batch_mem_pool[kMemPoolSize] = {0};
+
+bool batched_phase(const FullyConnectedOp& fc_op) {
+  const uint32_t in_sz = mli_hlp_count_elem_num(&fc_op.input, 0);
+  const uint32_t out_sz = fc_op.weights.shape[1];
+  uint32_t input_shape[2] = {kBatchSize, in_sz};
+  int32_t input_stride[2] = {int32_t(in_sz + kBatchRowPad), 1};
+  uint32_t weight_shape[2] = {fc_op.weights.shape[0], fc_op.weights.shape[1]};
+  int32_t weight_stride[2] = {fc_op.weights.mem_stride[0], fc_op.weights.mem_stride[1]};
+  uint32_t output_shape[2] = {kBatchSize, out_sz};
+  int32_t output_stride[2] = {int32_t(out_sz + kBatchRowPad), 1};
+  const bool per_tensor_wzp = fc_op.weights.el_params.sa.dim == kPerTensorQuantDim;
+  uint32_t wtszp_shape[1] = {per_tensor_wzp ? 1 : out_sz};
+  int32_t wtszp_stride[1] = {1};
+
+  const lib_mli::Tensor<lib_mli::NoBuffer, 2> in_tensor(input_shape, input_stride);
+  const lib_mli::Tensor<lib_mli::NoBuffer, 2> out_tensor(output_shape, output_stride);
+  const lib_mli::Tensor<lib_mli::NoBuffer, 2> wt_tensor(weight_shape, weight_stride);
+  const lib_mli::Tensor<lib_mli::NoBuffer, 1> wtzp_tensor(wtszp_shape, wtszp_stride);
+
+  lib_mli::PlatformDescription pd;
+  lib_ref::KernelsFactory kernel_factory(pd);
+  void* fully_connected_cs_buffer = malloc(kernel_factory.FullyConnected_CS_GetSize());
+  assert(fully_connected_cs_buffer);
+  auto in_tensor_it = lib_mli::TensorIterator<lib_mli::NoBuffer, kFullyConnectedIORank, kFullyConnectedIterRank>(in_tensor);
+  auto wt_tensor_it = lib_mli::TensorIterator<lib_mli::NoBuffer, kFullyConnectedWRank, kFullyConnectedIterRank>(wt_tensor);
+  auto wtzp_tensor_it = lib_mli::TensorIterator<lib_mli::NoBuffer, kFullyConnectedZPRank, kFullyConnectedIterRank>(wtzp_tensor);
+  auto out_tensor_it = lib_mli::TensorIterator<lib_mli::NoBuffer, kFullyConnectedIORank, kFullyConnectedIterRank>(out_tensor);
+  lib_mli::FullyConnectedConfig fc_cfg;
+  auto FullyConn = kernel_factory.FullyConnected_CS(fully_connected_cs_buffer, in_tensor_it, wt_tensor_it,
+                                                    wtzp_tensor_it, fc_cfg, out_tensor_it);
+
+  // Memory management: runtime object, private data, input, weights, output, control data
+  uint32_t offset = FullyConn->GetRuntimeObjectSize() + FullyConn->GetKernelPrivateDataSize();
+  const uint32_t in_size = FullyConn->GetInputBufferSize() * sizeof(int8_t);
+  lib_mli::OffsetBuffer in_buf{offset, 0, in_size, sizeof(int8_t)};
+  const uint32_t in_mem_offset = offset;
+  offset += in_size;
+
+  const uint32_t full_weights_size = FullyConn->GetEncodedWeightsSize();
+  const uint32_t full_wtszp_size = FullyConn->GetEncodedWtsZeroPtsSize();
+  const uint32_t w_and_wzp_size = FullyConn->GetWeightsBufferSize() * sizeof(int8_t) + full_wtszp_size * sizeof(int16_t);
+  lib_mli::OffsetBuffer w_buf{offset, 0, w_and_wzp_size, sizeof(int8_t)};
+  const uint32_t w_mem_offset = offset;
+  offset += w_and_wzp_size;
+
+  offset = CEIL_RND(offset, sizeof(int32_t));
+  const uint32_t out_size = FullyConn->GetOutputBufferSize() * sizeof(int32_t);
+  lib_mli::OffsetBuffer out_buf{offset, 0, out_size, sizeof(int32_t)};
+  const uint32_t out_mem_offset = offset;
+  offset += out_size;
+
+  const uint32_t ctrl_buffer_size = FullyConn->GetCtrlBufferSize();
+  lib_mli::OffsetBuffer descr_buf{offset, 0, ctrl_buffer_size, sizeof(char)};
+  offset += ctrl_buffer_size;
+  if (offset > kMemPoolSize || full_weights_size + full_wtszp_size > kWeightsAndWeightsZPBufferSize) {
+    free(fully_connected_cs_buffer);
+    return false;
+  }
+
+  mli_status status = FullyConn->AttachBufferOffsets(in_buf, out_buf, w_buf, descr_buf);
+  assert(status == MLI_STATUS_OK);
+
+  // Input samples
+  for (uint32_t b = 0; b < kBatchSize; ++b) {
+    const uint32_t shift = (b * 7) % in_sz;
+    for (uint32_t i = 0; i < in_sz; ++i) {
+      g_batch_mem_pool[in_mem_offset + b * input_stride[0] + i] = fc_op.input.data.mem.pi8[(i + shift) % in_sz];
+    }
+  }
+
+  // Weights and weights zero points
+  int8_t* src_wzp_mem = (int8_t*)malloc(full_wtszp_size);
+  int8_t* src_w_mem = (int8_t*)malloc(full_weights_size);
+  assert(src_wzp_mem && src_w_mem);
+  lib_mli::Buffer src_wtszp_buf(src_wzp_mem, full_wtszp_size, sizeof(int8_t));
+  uint32_t fc_wtszp_shape[kFullyConnectedZPRank] = { full_wtszp_size };
+  lib_mli::Tensor<lib_mli::Buffer, kFullyConnectedZPRank> wtszp_tensor(src_wtszp_buf, fc_wtszp_shape);
+  for (uint32_t i = 0; i < full_wtszp_size; ++i) {
+    wtszp_tensor.write(int(i), static_cast<int8_t>(per_tensor_wzp ? fc_op.weights.el_params.sa.zero_point.mem.i16
+                                                                   : fc_op.weights.el_params.sa.zero_point.mem.pi16[i]));
+  }
+  lib_mli::Buffer src_weights_buf(src_w_mem, full_weights_size, sizeof(int8_t));
+  lib_mli::Tensor<lib_mli::Buffer, kFullyConnectedWRank> weights_tensor(src_weights_buf, weight_shape);
+  int32_t zero_offsets[kFullyConnectedWRank]{};
+  strided_copy_with_offsets(kFullyConnectedWRank, sizeof(int8_t), fc_op.weights.data.mem.pi8,
+                            zero_offsets, zero_offsets, weight_stride, weight_shape,
+                            weights_tensor.get_buf().get_ptr<int8_t>());
+  lib_mli::Buffer dst_w_wzp_encoded_buffer((void*)g_weights_buf_mem, full_weights_size + full_wtszp_size, sizeof(int8_t));
+  auto w_tensor_it_with_buf = lib_mli::TensorIterator<lib_mli::Buffer, kFullyConnectedWRank, kFullyConnectedIterRank>(weights_tensor);
+  auto wzp_tensor_it_with_buf = lib_mli::TensorIterator<lib_mli::Buffer, kFullyConnectedZPRank, kFullyConnectedIterRank>(wtszp_tensor);
+  status = FullyConn->EncodeWeightsAndZeroPts(w_tensor_it_with_buf, wzp_tensor_it_with_buf, dst_w_wzp_encoded_buffer);
+  assert(status == MLI_STATUS_OK);
+  for (uint32_t i = 0; i < full_weights_size + full_wtszp_size; ++i) {
+    g_batch_mem_pool[w_mem_offset + i] = dst_w_wzp_encoded_buffer.read<int8_t>(i);
+  }
+  free(src_wzp_mem);
+  free(src_w_mem);
+
+  // Compile and run
+  void* instance = g_batch_mem_pool;
+  const uint32_t instance_size = FullyConn->GetRuntimeObjectSize();
+  void* conf_private = g_batch_mem_pool + instance_size;
+  status = FullyConn->GetKernelPrivateData(conf_private);
+  assert(status == MLI_STATUS_OK);
+  uint64_t membasis[] = {reinterpret_cast<uint64_t>(g_batch_mem_pool)};
+  auto mli_fully_connected = lib_mli::ExecutionInterface::Create(instance, instance_size, conf_private,
+                                                                 FullyConn->GetKernelPrivateDataSize(),
+                                                                 membasis, sizeof(membasis) / sizeof(membasis[0]));
+  free(fully_connected_cs_buffer);
+  if (mli_fully_connected == nullptr ||
+      mli_fully_connected->Prefetch() != MLI_STATUS_OK ||
+      mli_fully_connected->Issue() != MLI_STATUS_OK ||
+      mli_fully_connected->Update() != MLI_STATUS_OK)
+    return false;
+
+  // Compare with direct calculation
+  const int8_t* in_data = g_batch_mem_pool + in_mem_offset;
+  const int32_t* out_data = reinterpret_cast<const int32_t*>(g_batch_mem_pool + out_mem_offset);
+  for (uint32_t b = 0; b < kBatchSize; ++b) {
+    for (uint32_t o = 0; o < out_sz; ++o) {
+      const int32_t wzp = per_tensor_wzp ? fc_op.weights.el_params.sa.zero_point.mem.i16
+                                         : fc_op.weights.el_params.sa.zero_point.mem.pi16[o];
+      int32_t acc = 0;
+      for (uint32_t i = 0; i < in_sz; ++i) {
+        const int32_t w = fc_op.weights.data.mem.pi8[i * weight_stride[0] + o * weight_stride[1]];
+        acc += in_data[b * input_stride[0] + i] * (w - wzp);
+      }
+      if (out_data[b * output_stride[0] + o] != acc) return false;
+    }
+  }
+  return true;
+}
+
 int main() {
   const reporter_full reporter;
   reporter.report_header("MLI3.0|Kernels|Fully Connected Tests");
@@ -1131,6 +1270,11 @@ int main() {
     //==================================================================
     is_test_passed &= postprocess_phase(reporter, cur_test, fc_op, rs_op, clp_op);
 
+    if (is_test_passed && !batched_phase(fc_op)) {
+      reporter.report_message(cur_test->descr, "FAILED at batched mode: wrong accumulators");
+      is_test_passed = false;
+    }
+
     final_status &= is_test_passed;
 
     // Free buffers for Rescale params
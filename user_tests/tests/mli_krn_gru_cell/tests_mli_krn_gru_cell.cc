@@ -13,6 +13,7 @@
 #include <stdio.h>
 #include <string.h>
 
+#include "test_benchmark.h"
 #include "test_crc32_calc.h"
 #include "test_memory_manager.h"
 #include "test_quality_metrics.h"
@@ -28,6 +29,9 @@ using mli::tst::quality_metrics;
 using mli::tst::crc32_calc;
 using mli::tst::reporter_full;
 using mli::tst::memory_manager;
+using mli::tst::benchmark_reporter;
+using mli::tst::bench_data_bytes;
+using mli::tst::bench_memory_footprint;
 
 typedef mli_status(*gru_cell_func_ptr)(
     const mli_tensor* /*input*/,
@@ -220,6 +224,7 @@ constexpr int kTestsNum = sizeof(tests_list) / sizeof(tests_list[0]);
 
 int main() {
     const reporter_full reporter;
+    benchmark_reporter bench;
     bool final_status = true;
 
     reporter.report_header("MLI|Kernels|GRU Cell Tests");
@@ -323,8 +328,8 @@ int main() {
 
         // Run specific kernel for test
         if (is_test_passed &&
-                cur_test->mli_krn_gru_cell
-                (&input, &prev_out, &weights_in, &weights_out, &bias, &tanh_lut, &sigm_lut, &cur_test_cfg, &out)
+                bench.measure([&] { return cur_test->mli_krn_gru_cell
+                    (&input, &prev_out, &weights_in, &weights_out, &bias, &tanh_lut, &sigm_lut, &cur_test_cfg, &out); })
                 != MLI_STATUS_OK) {
             reporter.report_message(cur_test->descr, "FAILED at kernel run: kernel returned bad status");
             is_test_passed = false;
@@ -373,9 +378,15 @@ int main() {
             is_test_passed &= reporter.evaluate_and_report_case(cur_test->descr, test_metrics, cur_test->threshold,
                                                                 data_crc, cur_test->check_sum);
         }
+        if (is_test_passed) {
+            bench.add_case(cur_test->descr, input.shape[0] * (mli_hlp_count_elem_num(&weights_in, 0) + mli_hlp_count_elem_num(&weights_out, 0)),
+                           bench_data_bytes({&input, &prev_out, &weights_in, &weights_out, &bias, &out}),
+                           bench_memory_footprint({&input, &prev_out, &weights_in, &weights_out, &bias, &out}));
+        }
         final_status &= is_test_passed;
     }
 
+    bench.report("mli_krn_gru_cell");
     reporter.report_outline("[AUTO] Group: mli_krn_gru_cell", final_status);
 
     return (final_status) ? 0 : 1;
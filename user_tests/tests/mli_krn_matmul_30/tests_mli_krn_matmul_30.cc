@@ -7,6 +7,7 @@
  *
  */
 #include <cstdlib>
+#include <cstring>
 
 #include "mli_kernels_factory_ref.hpp"
 #include "mli_ref_private_types.hpp"
@@ -16,6 +17,7 @@
 #include "mli_types.hpp"
 #include "mli_ref_runtime_api.hpp"
 #include "mli_iterator.hpp"
+#include "mli_perf_estim.hpp"
 
 #include "test_crc32_calc.h"
 #include "test_memory_manager.h"
@@ -38,11 +40,18 @@ using snps_arc::metaware::mli::Tensor;
 using snps_arc::metaware::mli::OffsetBuffer;
 using snps_arc::metaware::mli::kMatMulRank;
 using snps_arc::metaware::mli::kMatMulIterRank;
+using snps_arc::metaware::mli::kMatMulBatchDim;
+using snps_arc::metaware::mli::kMatMulHeightDim;
+using snps_arc::metaware::mli::kMatMulWidthDim;
 
 
 namespace lib_mli = ::snps_arc::metaware::mli;
 namespace lib_ref = ::snps_arc::metaware::mli::ref;
 
+// 16-bit inputs are the 8-bit ones shifted by the zero points below (by default).
+constexpr int16_t kInt16LeftZp = 1000;
+constexpr int16_t kInt16RightZp = -700;
+
 struct MatMul_test_operands {
   const char* descr;
   tensor_quantizer in1;
@@ -53,8 +62,17 @@ struct MatMul_test_operands {
   uint32_t data_size;
   const quality_metrics threshold;
   const crc32_calc check_sum;
+  uint32_t batch = 1;              // batches of the left input and the output
+  bool right_batched = false;      // right input has all batches (otherwise a single one)
+  bool transpose_in2 = false;      // right input is a view of the transposed data
+  int16_t in1_shift = kInt16LeftZp;   // shift of 16-bit left input and its zero point
+  int16_t in2_shift = kInt16RightZp;  // shift of 16-bit right input and its zero point
 };
 
+// Batches are built from the test vectors: odd batches use reversed rows of the left input
+// (and reversed columns of the right one if it is batched), so the output of each batch is
+// the reference output with the same rows (and columns) reversed.
+
 const crc32_calc test_1_chksum_sa8{ 0x9AAA87CA }, test_2_chksum_sa8{ 0x387DBA3E }, test_3_chksum_sa8{ 0x80E93591 },
                  test_4_chksum_sa8{ 0xFE711D0A }, test_5_chksum_sa8{ 0x387DBA3E }, test_6_chksum_sa8{ 0xD6CED655 }; 
 
@@ -77,7 +95,25 @@ static MatMul_test_operands tests_list[] = {
     // (2, 9) * (9, 5) = (2, 5)
     {"Test 5 SA8 (2, 9) * (9, 5)", input_3_sa8, input_8_sa8, (int8_t)input_3_zero_point, (int8_t)input_8_zero_point, test_5_out_sa32, sizeof(int8_t), thresholds_sa8_general, test_5_chksum_sa8},  
     // (3, 4) * (4, 9) = (3, 9) 
-    {"Test 6 SA8 (3, 4) * (4, 9)", input_5_sa8, input_7_sa8, (int8_t)input_5_zero_point, (int8_t)input_7_zero_point, test_6_out_sa32, sizeof(int8_t), thresholds_sa8_general, test_6_chksum_sa8}
+    {"Test 6 SA8 (3, 4) * (4, 9)", input_5_sa8, input_7_sa8, (int8_t)input_5_zero_point, (int8_t)input_7_zero_point, test_6_out_sa32, sizeof(int8_t), thresholds_sa8_general, test_6_chksum_sa8},
+    // (2, 9) * (9, 5) = (2, 5) with 16 bit inputs and zero points
+    {"Test 7 I16 ZP (2,9)*(9,5)", input_3_sa8, input_4_sa8, (int8_t)input_3_zero_point, (int8_t)input_4_zero_point, test_2_out_sa32, sizeof(int16_t), thresholds_sa8_general, test_2_chksum_sa8},
+    // (3, 4) * (9, 4)^T = (3, 9)
+    {"Test 8 SA8 (3,4)*(9,4)^T", input_5_sa8, input_7_sa8, (int8_t)input_5_zero_point, (int8_t)input_7_zero_point, test_6_out_sa32, sizeof(int8_t), thresholds_sa8_general, test_6_chksum_sa8,
+     /* batch = */ 1, /* right_batched = */ false, /* transpose_in2 = */ true},
+    // (2, 4, 9) * (1, 9, 5) = (2, 4, 5)
+    {"Test 9 SA8 B2 (4,9)*(9,5)", input_7_sa8, input_8_sa8, (int8_t)input_7_zero_point, (int8_t)input_8_zero_point, test_4_out_sa32, sizeof(int8_t), thresholds_sa8_general, test_4_chksum_sa8,
+     /* batch = */ 2},
+    // (3, 3, 4) * (3, 4, 5) = (3, 3, 5)
+    {"Test 10 SA8 B3 (3,4)*(4,5)", input_5_sa8, input_6_sa8, (int8_t)input_5_zero_point, (int8_t)input_6_zero_point, test_3_out_sa32, sizeof(int8_t), thresholds_sa8_general, test_3_chksum_sa8,
+     /* batch = */ 3, /* right_batched = */ true},
+    // (2, 2, 9) * (2, 5, 9)^T = (2, 2, 5) with 16 bit inputs and zero points
+    {"Test 11 I16 B2 (2,9)*(5,9)^T", input_3_sa8, input_8_sa8, (int8_t)input_3_zero_point, (int8_t)input_8_zero_point, test_5_out_sa32, sizeof(int16_t), thresholds_sa8_general, test_5_chksum_sa8,
+     /* batch = */ 2, /* right_batched = */ true, /* transpose_in2 = */ true},
+    // (2, 9) * (9, 5) = (2, 5) with 16 bit inputs and zero points close to the int16 limits:
+    // sum(a * b) and the zero point corrections exceed int32 while the result doesn't
+    {"Test 12 I16 ZP near limits", input_3_sa8, input_4_sa8, (int8_t)input_3_zero_point, (int8_t)input_4_zero_point, test_2_out_sa32, sizeof(int16_t), thresholds_sa8_general, test_2_chksum_sa8,
+     /* batch = */ 1, /* right_batched = */ false, /* transpose_in2 = */ false, /* in1_shift = */ 32600, /* in2_shift = */ -32600}
   };
 
 constexpr uint32_t kMemSize = 8192;
@@ -85,11 +121,70 @@ static int8_t g_scratch_mem_in1[kMemSize] = {0};
 static int8_t g_scratch_mem_in2[kMemSize] = {0};
 static int8_t g_scratch_mem_ref[kMemSize] = {0};
 static int8_t g_scratch_mem_out[kMemSize] = {0};
+static int8_t g_src_mem_in1[kMemSize] = {0};
+static int8_t g_src_mem_in2[kMemSize] = {0};
 static IO_DATA_ATTR int8_t g_mem_pool[kMemSize] = {0};
 
 constexpr int kTestsNum = sizeof(tests_list) / sizeof(tests_list[0]);
 
 
+struct MatMul_test_shapes {
+  uint32_t in1[kMatMulRank];
+  uint32_t in2[kMatMulRank];
+  uint32_t out[kMatMulRank];
+  int32_t in1_strides[kMatMulRank];
+  int32_t in2_strides[kMatMulRank];
+  int32_t out_strides[kMatMulRank];
+};
+
+MatMul_test_shapes get_test_shapes(const MatMul_test_operands* cur_test,
+                                   const mli_tensor& in1, const mli_tensor& in2) {
+  const uint32_t m = in1.shape[0];
+  const uint32_t k = in1.shape[1];
+  const uint32_t n = in2.shape[1];
+  const uint32_t right_batch = cur_test->right_batched ? cur_test->batch : 1;
+  MatMul_test_shapes shapes = {
+    {cur_test->batch, m, k}, {right_batch, k, n}, {cur_test->batch, m, n},
+    {(int32_t)(m * k), (int32_t)k, 1}, {(int32_t)(k * n), (int32_t)n, 1}, {(int32_t)(m * n), (int32_t)n, 1}};
+  if (cur_test->transpose_in2) {
+    // data is [B, N, K], so the [B, K, N] view has swapped strides
+    shapes.in2_strides[kMatMulHeightDim] = 1;
+    shapes.in2_strides[kMatMulWidthDim] = (int32_t)k;
+  }
+  return shapes;
+}
+
+template <typename T>
+void fill_batched_inputs(const MatMul_test_operands* cur_test, const MatMul_test_shapes& shapes,
+                         const mli_tensor& in1, const mli_tensor& in2) {
+  const int16_t in1_shift = cur_test->data_size == sizeof(int16_t) ? cur_test->in1_shift : 0;
+  const int16_t in2_shift = cur_test->data_size == sizeof(int16_t) ? cur_test->in2_shift : 0;
+  T* in1_dst = reinterpret_cast<T*>(g_src_mem_in1);
+  T* in2_dst = reinterpret_cast<T*>(g_src_mem_in2);
+  const uint32_t m = shapes.in1[kMatMulHeightDim];
+  const uint32_t k = shapes.in1[kMatMulWidthDim];
+  const uint32_t n = shapes.in2[kMatMulWidthDim];
+
+  for (uint32_t b = 0; b < shapes.in1[kMatMulBatchDim]; b++) {
+    for (uint32_t row = 0; row < m; row++) {
+      const uint32_t src_row = (b % 2) ? m - 1 - row : row;
+      for (uint32_t col = 0; col < k; col++) {
+        in1_dst[b * shapes.in1_strides[0] + row * shapes.in1_strides[1] + col * shapes.in1_strides[2]] =
+            (T)(in1.data.mem.pi8[src_row * k + col] + in1_shift);
+      }
+    }
+  }
+  for (uint32_t b = 0; b < shapes.in2[kMatMulBatchDim]; b++) {
+    for (uint32_t row = 0; row < k; row++) {
+      for (uint32_t col = 0; col < n; col++) {
+        const uint32_t src_col = (b % 2) ? n - 1 - col : col;
+        in2_dst[b * shapes.in2_strides[0] + row * shapes.in2_strides[1] + col * shapes.in2_strides[2]] =
+            (T)(in2.data.mem.pi8[row * n + src_col] + in2_shift);
+      }
+    }
+  }
+}
+
 void prepare_phase(MatMul_test_operands* cur_test,
                    void*& MatMul_instance,
                    uint32_t& MatMul_instance_size,
@@ -120,12 +215,19 @@ void prepare_phase(MatMul_test_operands* cur_test,
     mli_tensor temp_input2_tensor = cur_test->in2.get_quantized_tensor(temp_in2_container);
     mli_tensor temp_output_tensor = cur_test->out.get_quantized_tensor(temp_out_container);
 
-    const lib_mli::Tensor<lib_mli::NoBuffer, kMatMulRank> in1_tensor(temp_input1_tensor.shape, temp_input1_tensor.mem_stride);
-    const lib_mli::Tensor<lib_mli::NoBuffer, kMatMulRank> in2_tensor(temp_input2_tensor.shape, temp_input2_tensor.mem_stride);
-    const lib_mli::Tensor<lib_mli::NoBuffer, kMatMulRank> out_tensor(temp_output_tensor.shape, temp_output_tensor.mem_stride);
+    MatMul_test_shapes shapes = get_test_shapes(cur_test, temp_input1_tensor, temp_input2_tensor);
+    if (cur_test->data_size == sizeof(int16_t)) {
+      fill_batched_inputs<int16_t>(cur_test, shapes, temp_input1_tensor, temp_input2_tensor);
+    } else {
+      fill_batched_inputs<int8_t>(cur_test, shapes, temp_input1_tensor, temp_input2_tensor);
+    }
+
+    const lib_mli::Tensor<lib_mli::NoBuffer, kMatMulRank> in1_tensor(shapes.in1, shapes.in1_strides);
+    const lib_mli::Tensor<lib_mli::NoBuffer, kMatMulRank> in2_tensor(shapes.in2, shapes.in2_strides);
+    const lib_mli::Tensor<lib_mli::NoBuffer, kMatMulRank> out_tensor(shapes.out, shapes.out_strides);
 
     lib_mli::TensorIterator<lib_mli::NoBuffer, kMatMulRank, kMatMulIterRank> in1_tensor_it(in1_tensor, input_tile_shape, iteration_order);
-    lib_mli::TensorIterator<lib_mli::NoBuffer, kMatMulRank, kMatMulIterRank> in2_tensor_it(in2_tensor, temp_input2_tensor.shape, iteration_order);
+    lib_mli::TensorIterator<lib_mli::NoBuffer, kMatMulRank, kMatMulIterRank> in2_tensor_it(in2_tensor, shapes.in2, iteration_order);
     lib_mli::TensorIterator<lib_mli::NoBuffer, kMatMulRank, kMatMulIterRank> out_tensor_it(out_tensor, output_tile_shape, iteration_order);
 
     input1_tensor = in1_tensor_it;
@@ -136,7 +238,8 @@ void prepare_phase(MatMul_test_operands* cur_test,
     lib_ref::KernelsFactory kernel_factory(pd);
     uint32_t MatMul_cs_size = kernel_factory.MatMul_CS_GetSize();
     void* MatMul_cs_buffer = malloc(MatMul_cs_size);
-    auto MatMul_op = kernel_factory.MatMul_CS(MatMul_cs_buffer, in1_tensor_it, in2_tensor_it, out_tensor_it);
+    auto MatMul_op = kernel_factory.MatMul_CS(MatMul_cs_buffer, in1_tensor_it, in2_tensor_it, out_tensor_it,
+                                              cur_test->data_size);
 
     // STEP 2: Memory management (Up to user on how to deal with it)
     //==================================================================
@@ -160,7 +263,7 @@ void prepare_phase(MatMul_test_operands* cur_test,
     // MatMul Input1
     offset = &offsets[0];
 
-    uint32_t in1_size = lib_mli::service::GetBufferSize(lib_mli::kMatMulRank, input_tile_shape, temp_input1_tensor.mem_stride) * elem_size;
+    uint32_t in1_size = lib_mli::service::GetBufferSize(lib_mli::kMatMulRank, input_tile_shape, shapes.in1_strides) * elem_size;
     lib_mli::OffsetBuffer MatMul_in1_buf{*offset, 0, in1_size, elem_size};
     input1_tensor.set_buf(MatMul_in1_buf);
     uint32_t in1_mem_offset = *offset;
@@ -168,7 +271,7 @@ void prepare_phase(MatMul_test_operands* cur_test,
 
     // MatMul Input2
     offset = &offsets[0];
-    uint32_t in2_size = lib_mli::service::GetBufferSize(lib_mli::kMatMulRank, temp_input2_tensor.shape, temp_input2_tensor.mem_stride) * elem_size;
+    uint32_t in2_size = lib_mli::service::GetBufferSize(lib_mli::kMatMulRank, shapes.in2, shapes.in2_strides) * elem_size;
     lib_mli::OffsetBuffer MatMul_in2_buf{*offset, 0, in2_size, elem_size};
     input2_tensor.set_buf(MatMul_in2_buf);
     uint32_t in2_mem_offset = *offset;
@@ -177,14 +280,14 @@ void prepare_phase(MatMul_test_operands* cur_test,
     // MatMul Output
     offset = &offsets[0];
 
-    uint32_t out_size = lib_mli::service::GetBufferSize(lib_mli::kMatMulRank, output_tile_shape, temp_output_tensor.mem_stride) * sizeof(int32_t);
+    uint32_t out_size = lib_mli::service::GetBufferSize(lib_mli::kMatMulRank, output_tile_shape, shapes.out_strides) * sizeof(int32_t);
     lib_mli::OffsetBuffer MatMul_out_buf{*offset, 0, out_size, sizeof(int32_t)};
     output_tensor.set_buf(MatMul_out_buf);
     uint32_t out_mem_offset = *offset;
     *offset += out_size;
 
     // MatMul input zero point
-    uint32_t inpzp_size = MatMul_op->GetEncodedParamsSize() * elem_size;
+    uint32_t inpzp_size = MatMul_op->GetEncodedParamsSize();
     lib_mli::OffsetBuffer MatMul_encoded_params_buf{*offset, 0, inpzp_size, elem_size};
     uint32_t inpzp_mem_offset = *offset;
     *offset += inpzp_size;
@@ -206,21 +309,30 @@ void prepare_phase(MatMul_test_operands* cur_test,
     assert(status == MLI_STATUS_OK);
 
    /*Encode inputs zp*/
-    uint8_t dst[2]{0};
-    uint8_t dst_size = 2;
-    const lib_mli::Buffer in1_zp_buf(&cur_test->in1_zp, sizeof(cur_test->in1_zp), sizeof(int8_t));
-    const lib_mli::Buffer in2_zp_buf(&cur_test->in1_zp, sizeof(cur_test->in2_zp), sizeof(int8_t));
-    lib_mli::Buffer encoded_zp_buf(&dst, dst_size, sizeof(int8_t));
+    int16_t dst[lib_mli::kMatMulZPSize]{0};
+    uint8_t dst_size = MatMul_op->GetEncodedParamsSize();
+    int16_t in1_zp = cur_test->in1_zp;
+    int16_t in2_zp = cur_test->in2_zp;
+    int8_t in1_zp8 = cur_test->in1_zp;
+    int8_t in2_zp8 = cur_test->in2_zp;
+    void* in1_zp_ptr = &in1_zp8;
+    void* in2_zp_ptr = &in2_zp8;
+    if (elem_size == sizeof(int16_t)) {
+      in1_zp += cur_test->in1_shift;
+      in2_zp += cur_test->in2_shift;
+      in1_zp_ptr = &in1_zp;
+      in2_zp_ptr = &in2_zp;
+    }
+    const lib_mli::Buffer in1_zp_buf(in1_zp_ptr, elem_size, elem_size);
+    const lib_mli::Buffer in2_zp_buf(in2_zp_ptr, elem_size, elem_size);
+    lib_mli::Buffer encoded_zp_buf(&dst, dst_size, elem_size);
 
     MatMul_op->EncodeParams(in1_zp_buf, 
                             in2_zp_buf,
                             encoded_zp_buf);
 
    /*copy zp from scratch memory to g_mem_pool*/
-    for (uint32_t i = 0; i < inpzp_size; ++i) {
-      const uint32_t idx = inpzp_mem_offset + i;
-      g_mem_pool[idx] = encoded_zp_buf.read<int8_t>(i);
-    }
+    memcpy(g_mem_pool + inpzp_mem_offset, dst, inpzp_size);
 
     MatMul_instance = (int8_t*)g_mem_pool;
     MatMul_instance_size = MatMul_op->GetRuntimeObjectSize();
@@ -257,6 +369,26 @@ void execution_phase(const MatMul_test_operands* cur_test,
     assert(MatMul_run_op != nullptr);
     mli_status status = MLI_STATUS_OK;
 
+    // Estimated cost over all tiles must cover the whole (M, K) * (K, N) product
+    lib_mli::PlatformDescription pd;
+    uint32_t perf_estim_size = lib_mli::PerfEstimator::KernelPerf_GetSize(*MatMul_run_op);
+    assert(perf_estim_size > 0);
+    void* perf_estim_buffer = malloc(perf_estim_size);
+    auto perf_estim = lib_mli::PerfEstimator::Create(perf_estim_buffer, perf_estim_size, pd,
+                                                     *MatMul_run_op, num_tiles);
+    assert(perf_estim != nullptr);
+    const int total_macs = input1_tensor.get_dim(kMatMulBatchDim) * input1_tensor.get_dim(kMatMulHeightDim) *
+                           input1_tensor.get_dim(kMatMulWidthDim) * input2_tensor.get_dim(kMatMulWidthDim);
+    const int total_out_bytes = output_tensor.get_dim(kMatMulBatchDim) * output_tensor.get_dim(kMatMulHeightDim) *
+                                output_tensor.get_dim(kMatMulWidthDim) * sizeof(int32_t);
+    assert(perf_estim->GetTotalMacs() == total_macs);
+    assert(perf_estim->GetTotalWriteBytes() == total_out_bytes);
+    assert(perf_estim->GetTotalCycles() > 0);
+    assert(perf_estim->GetTileMacs(0) * (int)num_tiles == total_macs);
+    (void)total_macs;
+    (void)total_out_bytes;
+    free(perf_estim_buffer);
+
     uint32_t input1_tile_size[kMatMulRank]{};
     uint32_t input2_tile_size[kMatMulRank]{};
     uint32_t output_tile_size[kMatMulRank]{};
@@ -277,18 +409,17 @@ void execution_phase(const MatMul_test_operands* cur_test,
     lib_ref::MatMul* pimpl = dynamic_cast<lib_ref::MatMul*>(MatMul_run_op);
     pimpl->GetIOSizesAndOffsets(input1_tile_size, input2_tile_size, output_tile_size,
                                 input1_tile_offsets, input2_tile_offsets, output_tile_offsets);
-    input2_tile_offsets[0] = input2_tile_offsets[1] = 0;
 
     status = MatMul_run_op->Prefetch();
     assert(status == MLI_STATUS_OK);
     
      // copy inputs from global buffer to local tile buffer 
     strided_copy_with_offsets(kMatMulRank, input1_tensor.get_buf().get_elem_size(),
-                            g_scratch_mem_in1, input1_tile_offsets, zero_offsets, tile_input1_strides,
+                            g_src_mem_in1, input1_tile_offsets, zero_offsets, tile_input1_strides,
                             input1_tile_size, (int8_t*)(g_mem_pool + input1_tensor.get_buf().get_offset()));
 
     strided_copy_with_offsets(kMatMulRank, input2_tensor.get_buf().get_elem_size(),
-                            g_scratch_mem_in2, input2_tile_offsets, zero_offsets, tile_input2_strides,
+                            g_src_mem_in2, input2_tile_offsets, zero_offsets, tile_input2_strides,
                             input2_tile_size, (int8_t*)(g_mem_pool + input2_tensor.get_buf().get_offset()));
     
     
@@ -339,6 +470,25 @@ bool postprocess_phase(const reporter_full* reporter,
     data_crc(temp_input1_tensor);
     data_crc(temp_input2_tensor);
     data_crc(temp_output_tensor);
+    // other batches must be the reference output with reversed rows (and columns)
+    const uint32_t m = temp_output_tensor.shape[0];
+    const uint32_t n = temp_output_tensor.shape[1];
+    const int32_t* out = temp_output_tensor.data.mem.pi32;
+    bool batches_match = true;
+    for (uint32_t b = 1; b < cur_test->batch; b++) {
+      for (uint32_t row = 0; row < m; row++) {
+        for (uint32_t col = 0; col < n; col++) {
+          const uint32_t ref_row = (b % 2) ? m - 1 - row : row;
+          const uint32_t ref_col = (b % 2 && cur_test->right_batched) ? n - 1 - col : col;
+          batches_match &= out[(b * m + row) * n + col] == out[ref_row * n + ref_col];
+        }
+      }
+    }
+    if (!batches_match) {
+      reporter->report_message(cur_test->descr, "FAILED as a result of batches mismatch");
+      return false;
+    }
+
     is_test_passed = reporter->evaluate_and_report_case(cur_test->descr, test_metics,
                                                         cur_test->threshold, data_crc,
                                                         cur_test->check_sum);
@@ -385,14 +535,22 @@ int main() {
         mli_tensor temp_input1_tensor = cur_test->in1.get_quantized_tensor(temp_in1_container);
         mli_tensor temp_input2_tensor = cur_test->in2.get_quantized_tensor(temp_in2_container);
 
-        uint32_t input_tile_size[kMatMulRank] =  {1, temp_input1_tensor.shape[1]};
-        uint32_t output_tile_size[kMatMulRank] =  {1, temp_input2_tensor.shape[1]};
-        int32_t iteration_order[kMatMulRank] = {0, 1};
-        uint32_t shape[kMatMulRank] = {temp_input1_tensor.shape[0], temp_input1_tensor.shape[1]};
-        
-        //tiling the Height
-        assert(input_tile_size[1] == temp_input1_tensor.shape[1]);
-        assert(output_tile_size[1] == temp_input2_tensor.shape[1]);
+        const MatMul_test_shapes shapes = get_test_shapes(cur_test, temp_input1_tensor, temp_input2_tensor);
+        uint32_t input_tile_size[kMatMulRank] =  {1, 1, shapes.in1[kMatMulWidthDim]};
+        uint32_t output_tile_size[kMatMulRank] =  {1, 1, shapes.out[kMatMulWidthDim]};
+        int32_t iteration_order[kMatMulRank] = {0, 1, 2};
+        uint32_t shape[kMatMulRank] = {shapes.in1[0], shapes.in1[1], shapes.in1[2]};
+
+        // tiling the Batch and the Height, while the right input is used as a whole.
+        // Batched right input can't follow batches of the left tiles, so it is a single tile.
+        if (cur_test->right_batched) {
+          for (int i = 0; i < kMatMulRank; i++) {
+            input_tile_size[i] = shapes.in1[i];
+            output_tile_size[i] = shapes.out[i];
+          }
+        }
+        assert(input_tile_size[kMatMulWidthDim] == shapes.in1[kMatMulWidthDim]);
+        assert(output_tile_size[kMatMulWidthDim] == shapes.out[kMatMulWidthDim]);
 
         // calculate number of tiles needed
         uint32_t num_tiles = 1;
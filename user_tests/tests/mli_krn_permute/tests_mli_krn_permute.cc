@@ -12,6 +12,7 @@
 #include <stdint.h>
 #include <stdio.h>
 
+#include "test_benchmark.h"
 #include "test_crc32_calc.h"
 #include "test_memory_manager.h"
 #include "test_quality_metrics.h"
@@ -27,6 +28,9 @@ using mli::tst::quality_metrics;
 using mli::tst::crc32_calc;
 using mli::tst::reporter_full;
 using mli::tst::memory_manager;
+using mli::tst::benchmark_reporter;
+using mli::tst::bench_data_bytes;
+using mli::tst::bench_memory_footprint;
 
 typedef mli_status(*permute_func_ptr)(
     const mli_tensor* /*in*/,
@@ -187,8 +191,110 @@ static IO_DATA_ATTR int8_t scratch_mem_out[kMemSize] = { 0 };
 
 constexpr int kTestsNum = sizeof(tests_list) / sizeof(tests_list[0]);
 
+// Shapes and permutations which exercise the row copy, blocked transpose and generic paths
+// of the kernel on tensors bigger than transpose tile (and not multiple of it).
+struct permute_large_test_operands {
+    const char* descr;
+    uint32_t in_shape[MLI_MAX_RANK];
+    uint32_t rank;
+    mli_permute_cfg cfg;
+};
+
+static const permute_large_test_operands large_tests_list[] = {
+    {"Test L1 FX16 HWC->CHW",     {19, 21, 13, 1}, 3, {{2, 0, 1, 3}}},
+    {"Test L2 FX16 CHW->HWC",     {13, 19, 21, 1}, 3, {{1, 2, 0, 3}}},
+    {"Test L3 FX16 2D transpose", {37, 45, 1, 1},  2, {{1, 0, 2, 3}}},
+    {"Test L4 FX16 NHWC->NCHW",   {3, 11, 9, 17},  4, {{0, 3, 1, 2}}},
+    {"Test L5 FX16 rows reorder", {3, 11, 9, 17},  4, {{2, 0, 1, 3}}},
+    {"Test L6 FX16 reverse dims", {3, 11, 9, 17},  4, {{3, 2, 1, 0}}},
+    {"Test L7 FX16 swap H, C",    {3, 11, 9, 17},  4, {{0, 3, 2, 1}}},
+};
+
+constexpr int kLargeTestsNum = sizeof(large_tests_list) / sizeof(large_tests_list[0]);
+constexpr int kLargeMemSize = 3 * 11 * 9 * 17;
+static IO_DATA_ATTR int16_t large_mem_in[kLargeMemSize] = { 0 };
+static IO_DATA_ATTR int16_t large_mem_out[kLargeMemSize] = { 0 };
+
+// Element of a tensor (of any element type) as int32 by coordinates in the tensor
+static int32_t get_element(const mli_tensor& t, const int pos[MLI_MAX_RANK]) {
+    int offset = 0;
+    for (int k = 0; k < (int)t.rank; k++) offset += pos[k] * t.mem_stride[k];
+    switch (mli_hlp_tensor_element_size(&t)) {
+    case sizeof(int8_t): return t.data.mem.pi8[offset];
+    case sizeof(int16_t): return t.data.mem.pi16[offset];
+    default: return t.data.mem.pi32[offset];
+    }
+}
+
+// Check that data of out matches data of the input, permuted by cfg.
+static bool is_permuted_copy(const mli_tensor& in, const mli_permute_cfg& cfg, const mli_tensor& out) {
+    uint32_t shape[MLI_MAX_RANK] = {1, 1, 1, 1};
+    for (int k = 0; k < (int)out.rank; k++) shape[k] = out.shape[k];
+    int out_pos[MLI_MAX_RANK] = {0};
+    int in_pos[MLI_MAX_RANK] = {0};
+    for (out_pos[0] = 0; out_pos[0] < (int)shape[0]; out_pos[0]++)
+    for (out_pos[1] = 0; out_pos[1] < (int)shape[1]; out_pos[1]++)
+    for (out_pos[2] = 0; out_pos[2] < (int)shape[2]; out_pos[2]++)
+    for (out_pos[3] = 0; out_pos[3] < (int)shape[3]; out_pos[3]++) {
+        for (int k = 0; k < (int)out.rank; k++) in_pos[cfg.perm_dim[k]] = out_pos[k];
+        if (get_element(in, in_pos) != get_element(out, out_pos)) return false;
+    }
+    return true;
+}
+
+static bool run_large_tests(const reporter_full& reporter) {
+    bool final_status = true;
+    for (int i = 0; i < kLargeTestsNum; ++i) {
+        const permute_large_test_operands* cur_test = &large_tests_list[i];
+        mli_tensor in{};
+        mli_tensor out{};
+        in.el_type = out.el_type = MLI_EL_FX_16;
+        in.rank = out.rank = cur_test->rank;
+        for (int k = 0; k < (int)cur_test->rank; k++) {
+            in.shape[k] = cur_test->in_shape[k];
+        }
+        for (int k = 0; k < (int)cur_test->rank; k++) {
+            out.shape[k] = in.shape[cur_test->cfg.perm_dim[k]];
+        }
+        in.data.mem.pi16 = large_mem_in;
+        in.data.capacity = sizeof(large_mem_in);
+        out.data.mem.pi16 = large_mem_out;
+        out.data.capacity = sizeof(large_mem_out);
+        mli_hlp_set_tensor_mem_strides(&in);
+        mli_hlp_set_tensor_mem_strides(&out);
+        const int num_elems = (int)mli_hlp_count_elem_num(&in, 0);
+        for (int idx = 0; idx < num_elems; idx++) {
+            large_mem_in[idx] = (int16_t)(idx * 7 - 16000);
+        }
+
+        bool is_test_passed = mli_krn_permute_fx16(&in, &cur_test->cfg, &out) == MLI_STATUS_OK;
+        if (!is_test_passed) {
+            reporter.report_message(cur_test->descr, "FAILED at kernel run: kernel returned bad status");
+        } else if (!is_permuted_copy(in, cur_test->cfg, out)) {
+            reporter.report_message(cur_test->descr, "FAILED at comparison output with reference");
+            is_test_passed = false;
+        }
+
+        // view of the input must address the same data as the permuted copy
+        mli_tensor view{};
+        if (is_test_passed && (mli_hlp_permute_view(&in, &cur_test->cfg, &view) != MLI_STATUS_OK ||
+                               view.data.mem.pi16 != in.data.mem.pi16 ||
+                               !is_permuted_copy(in, cur_test->cfg, view))) {
+            reporter.report_message(cur_test->descr, "FAILED at permute view check");
+            is_test_passed = false;
+        }
+
+        if (is_test_passed) {
+            reporter.report_message(cur_test->descr, "PASSED");
+        }
+        final_status &= is_test_passed;
+    }
+    return final_status;
+}
+
 int main() {
     const reporter_full reporter;
+    benchmark_reporter bench;
     bool final_status = true;
 
     reporter.report_header("MLI|Kernels|Permute Tests");
@@ -235,7 +341,7 @@ int main() {
 
         // Run specific kernel for test 
         if (is_test_passed &&
-                cur_test->mli_krn_permute(&in, &cur_test->cfg, &out) != MLI_STATUS_OK) {
+                bench.measure([&] { return cur_test->mli_krn_permute(&in, &cur_test->cfg, &out); }) != MLI_STATUS_OK) {
             reporter.report_message(cur_test->descr, "FAILED at kernel run: kernel returned bad status");
             is_test_passed = false;
         }
@@ -253,6 +359,19 @@ int main() {
             is_test_passed = false;
         }
 
+        if (is_test_passed && !is_permuted_copy(in, cur_test->cfg, out)) {
+            reporter.report_message(cur_test->descr, "FAILED after kernel run: output isn't a permuted input");
+            is_test_passed = false;
+        }
+
+        mli_tensor view{};
+        if (is_test_passed && (mli_hlp_permute_view(&in, &cur_test->cfg, &view) != MLI_STATUS_OK ||
+                               view.shape[0] != out.shape[0] || view.el_params.sa.dim != out.el_params.sa.dim ||
+                               !is_permuted_copy(in, cur_test->cfg, view))) {
+            reporter.report_message(cur_test->descr, "FAILED at permute view check");
+            is_test_passed = false;
+        }
+
         if (is_test_passed &&
                 test_metics.calculate_metrics(out, cur_test->out) == false) {
             reporter.report_message(cur_test->descr, "FAILED at comparison output with reference");
@@ -266,9 +385,17 @@ int main() {
             is_test_passed &= reporter.evaluate_and_report_case(cur_test->descr, test_metics, cur_test->threshold, 
                                                                 data_crc, cur_test->check_sum);
         }
+        if (is_test_passed) {
+            bench.add_case(cur_test->descr, 0,
+                           bench_data_bytes({&in, &out}),
+                           bench_memory_footprint({&in, &out}));
+        }
         final_status &= is_test_passed;
     }
 
+    final_status &= run_large_tests(reporter);
+
+    bench.report("mli_krn_permute");
     reporter.report_outline("[AUTO] Group: mli_krn_permute", final_status);
 
     return (final_status) ? 0 : 1;
@@ -7,12 +7,18 @@
 *
 */
 #include <cmath>
+#include "mli_kernels_factory_ref.hpp"
 #include "mli_ref_runtime_api.hpp"
+#include "test_memory_manager.h"
 #include "test_report.h"
+#include "test_tiling.hpp"
 #include "tests_aux.h"
 #include "vectors_mli_krn_resize_bilinear_30.inc"
 
+namespace lib_ref = ::snps_arc::metaware::mli::ref;
+
 using lib_mli::kResizeBilinearRank;
+using lib_mli::kResizeBilinearIterRank;
 using lib_mli::kTensorBatchDim;
 using lib_mli::kTensorHeightDim;
 using lib_mli::kTensorWidthDim;
@@ -26,6 +32,10 @@ static const uint32_t output_h_array[num_h_strides_cases]{ k_input_h / 2, k_inpu
 constexpr uint32_t num_w_strides_cases = 4;
 static const uint32_t output_w_array[num_w_strides_cases]{ k_input_w * 2, k_input_w / 2, k_input_w / 4, k_input_w / 8 };
 
+// Integer upscales with exact 1/factor strides: {factor_h, factor_w}
+constexpr uint32_t num_int_factor_cases = 3;
+static const uint32_t int_factor_array[num_int_factor_cases][2]{ {2, 2}, {4, 4}, {2, 4} };
+
 constexpr int16_t k_sa_io_scale = 32767;
 constexpr int16_t k_sa_io_zp = -128;
 constexpr int8_t k_sa_io_frac_bits = 15;
@@ -35,8 +45,14 @@ static int8_t g_mem_input_values_quantized[k_max_num_input_image_elements];
 constexpr uint32_t k_max_num_output_image_elements = k_input_h * 8 * k_input_w * 2;
 static int8_t g_mem_output[k_max_num_output_image_elements * sizeof(int32_t)];
 static int8_t g_mem_output_quantized_rescaled[k_max_num_output_image_elements];
+static int32_t g_mem_reference_output_fx[k_max_num_output_image_elements];
 static float g_mem_reference_output[k_max_num_output_image_elements];
 
+// output is processed in tiles along the height, the whole input is available for each tile
+constexpr uint32_t k_output_tile_h = 16;
+constexpr uint32_t kMemSize = 128 * 1024;
+static IO_DATA_ATTR int8_t g_mem_pool[kMemSize] = {0};
+
 void apply_tensor_rshift(int32_t* src, uint32_t n, int8_t shift, int8_t* dst) {
   for (unsigned i = 0; i < n; i++) {
     dst[i] = src[i] / (1 << shift);
@@ -58,6 +74,30 @@ void float_to_sa8(const float* src, uint32_t n, int16_t k_sa_io_scale, int16_t k
   }
 }
 
+// Straightforward fixed point algorithm, the kernel must be bit exact with it
+void reference_resize_bilinear_fx(const int8_t* input, int32_t* output, const lib_mli::ResizeOpConfig& cfg,
+                                  int Hi, int Wi, int Ho, int Wo) {
+  const int one_fx = 1 << cfg.shift;
+  for (int h = 0; h < Ho; h++) {
+    const int row_fx = h * cfg.stride[0] + cfg.offset[0];
+    const int row_int = row_fx >> cfg.shift;
+    const int dy = row_fx - (row_int << cfg.shift);
+    const int row0 = MIN(MAX(row_int, 0), Hi - 1);
+    const int row1 = MIN(MAX(row_int + 1, 0), Hi - 1);
+    for (int w = 0; w < Wo; w++) {
+      const int col_fx = w * cfg.stride[1] + cfg.offset[1];
+      const int col_int = col_fx >> cfg.shift;
+      const int dx = col_fx - (col_int << cfg.shift);
+      const int col0 = MIN(MAX(col_int, 0), Wi - 1);
+      const int col1 = MIN(MAX(col_int + 1, 0), Wi - 1);
+      output[h * Wo + w] = input[row0 * Wi + col0] * (one_fx - dy) * (one_fx - dx) +
+                           input[row0 * Wi + col1] * (one_fx - dy) * dx +
+                           input[row1 * Wi + col0] * dy * (one_fx - dx) +
+                           input[row1 * Wi + col1] * dy * dx;
+    }
+  }
+}
+
 mli_status reference_resize_bilinear_float(const float* input, float* output, const float strides[2], int Hi, int Wi, int Ho, int Wo) {
 
   int input_row0, input_row1, input_col0, input_col1;
@@ -91,8 +131,11 @@ mli_status reference_resize_bilinear_float(const float* input, float* output, co
   return MLI_STATUS_OK;
 }
 
-void prepare_phase(uint32_t output_h, uint32_t output_w, mli_tensor& input_tensor,
-                   lib_mli::ResizeOpConfig& cfg, mli_tensor& output_tensor) {
+// factor is {0, 0} for align corners strides, otherwise strides are exactly 1/factor.
+// If requant is true, output is requantized to int8 by the kernel with the same scale as int32 output
+// (right shift by 2 * k_shift).
+void prepare_phase(uint32_t output_h, uint32_t output_w, const uint32_t factor[2], bool requant,
+                   mli_tensor& input_tensor, lib_mli::ResizeOpConfig& cfg, mli_tensor& output_tensor) {
   input_tensor.rank = kResizeBilinearRank;
   input_tensor.shape[kTensorBatchDim] = 1;
   input_tensor.shape[kTensorHeightDim] = k_input_h;
@@ -114,9 +157,9 @@ void prepare_phase(uint32_t output_h, uint32_t output_w, mli_tensor& input_tenso
   output_tensor.shape[kTensorWidthDim] = output_w;
   output_tensor.shape[kTensorChannelDim] = 1;
   mli_hlp_set_tensor_mem_strides(&output_tensor);
-  output_tensor.el_type = MLI_EL_SA_32;
+  output_tensor.el_type = requant ? MLI_EL_SA_8 : MLI_EL_SA_32;
   output_tensor.data.mem.pi8 = g_mem_output;
-  output_tensor.data.capacity = mli_hlp_count_elem_num(&output_tensor, 0) * sizeof(int32_t);
+  output_tensor.data.capacity = mli_hlp_count_elem_num(&output_tensor, 0) * mli_hlp_tensor_element_size(&output_tensor);
   output_tensor.el_params.sa.dim = -1;
   output_tensor.el_params.sa.type = MLI_EL_PARAM_SC16_ZP16;
   output_tensor.el_params.sa.scale.mem.i16 = k_sa_io_scale;
@@ -125,27 +168,133 @@ void prepare_phase(uint32_t output_h, uint32_t output_w, mli_tensor& input_tenso
 
   int16_t strides[2]{(int16_t)roundf((float)((input_tensor.shape[kTensorHeightDim] - 1) << k_shift) / (float)(output_tensor.shape[kTensorHeightDim] - 1)),
                      (int16_t)roundf((float)((input_tensor.shape[kTensorWidthDim] - 1) << k_shift) / (float)(output_tensor.shape[kTensorWidthDim] - 1))};
+  for (int i = 0; i < 2; i++) {
+    if (factor[i] != 0) strides[i] = (1 << k_shift) / factor[i];
+  }
   int16_t offsets[2] = { 0, 0 };
-  cfg = lib_mli::ResizeOpConfig(strides, offsets, k_shift);
+  const lib_mli::ResizeRequantConfig requant_cfg = requant ? lib_mli::ResizeRequantConfig(1, 2 * k_shift, 0)
+                                                           : lib_mli::ResizeRequantConfig();
+  cfg = lib_mli::ResizeOpConfig(strides, offsets, k_shift, requant_cfg);
 }
 
 
 void execution_phase(mli_tensor& input_tensor, lib_mli::ResizeOpConfig& cfg, mli_tensor& output_tensor) {
-  snps_arc::metaware::mli::ref::run_mli_resize_bilinear_standalone(&input_tensor, cfg, &output_tensor);
+  // STEP 1: Construct ResizeBilinear as a specific ExecutionInterface successor
+  //==================================================================
+  const lib_mli::Tensor<lib_mli::NoBuffer, kResizeBilinearRank> in_tensor(input_tensor.shape, input_tensor.mem_stride);
+  const lib_mli::Tensor<lib_mli::NoBuffer, kResizeBilinearRank> out_tensor(output_tensor.shape, output_tensor.mem_stride);
+
+  int32_t iteration_order[kResizeBilinearIterRank]{ 0, 1, 2, 3 };
+  uint32_t output_tile_size[kResizeBilinearRank]{ 1, MIN(k_output_tile_h, output_tensor.shape[kTensorHeightDim]),
+                                                  output_tensor.shape[kTensorWidthDim], 1 };
+  lib_mli::IteratorCfg<kResizeBilinearIterRank> in_it_config(in_tensor);
+  lib_mli::IteratorCfg<kResizeBilinearIterRank> out_it_config(out_tensor, output_tile_size, iteration_order);
+  lib_mli::TensorIterator<lib_mli::NoBuffer, kResizeBilinearRank, kResizeBilinearIterRank> in_tensor_it(in_tensor, in_it_config);
+  lib_mli::TensorIterator<lib_mli::NoBuffer, kResizeBilinearRank, kResizeBilinearIterRank> out_tensor_it(out_tensor, out_it_config);
+  const uint32_t num_tiles = out_tensor_it.GetTotalCount();
+
+  lib_mli::PlatformDescription pd;
+  lib_ref::KernelsFactory kernel_factory(pd);
+  void* resize_cs_buffer = malloc(kernel_factory.ResizeBilinear_CS_GetSize());
+  auto resize_op = kernel_factory.ResizeBilinear_CS(resize_cs_buffer, in_tensor_it, cfg, out_tensor_it);
+
+  // STEP 2: Memory management (Up to user on how to deal with it)
+  //==================================================================
+  uint32_t offset = 0;
+  const uint32_t runtime_obj_size = resize_op->GetRuntimeObjectSize();
+  offset += runtime_obj_size;
+  const uint32_t private_buffer_size = resize_op->GetKernelPrivateDataSize();
+  const uint32_t private_buffer_offset = offset;
+  offset += private_buffer_size;
+
+  const uint32_t in_size = lib_mli::service::GetBufferSize(kResizeBilinearRank, input_tensor.shape, input_tensor.mem_stride);
+  lib_mli::OffsetBuffer resize_in_buf{offset, 0, in_size, sizeof(int8_t)};
+  offset += in_size;
+
+  const uint32_t out_elem_size = mli_hlp_tensor_element_size(&output_tensor);
+  const uint32_t out_size = lib_mli::service::GetBufferSize(kResizeBilinearRank, output_tile_size, output_tensor.mem_stride) * out_elem_size;
+  lib_mli::OffsetBuffer resize_out_buf{offset, 0, out_size, out_elem_size};
+  offset += out_size;
+
+  const uint32_t ctrl_buffer_size = resize_op->GetCtrlBufferSize();
+  lib_mli::OffsetBuffer resize_ctrl_buf{offset, 0, ctrl_buffer_size, sizeof(char)};
+  offset += ctrl_buffer_size;
+  assert(offset <= kMemSize);
+
+  mli_status status = resize_op->AttachBufferOffsets(resize_in_buf, resize_out_buf, resize_ctrl_buf);
+  assert(status == MLI_STATUS_OK);
+  status = resize_op->GetKernelPrivateData(g_mem_pool + private_buffer_offset);
+  assert(status == MLI_STATUS_OK);
+
+  // STEP 3: Execution phase
+  //==================================================================
+  uint64_t membasis[] = {reinterpret_cast<uint64_t>(g_mem_pool)};
+  auto resize_run_op = lib_mli::ExecutionInterface::Create(g_mem_pool, runtime_obj_size,
+                                                           g_mem_pool + private_buffer_offset, private_buffer_size,
+                                                           membasis, sizeof(membasis) / sizeof(membasis[0]));
+  assert(resize_run_op != nullptr);
+  lib_ref::ResizeBilinear* resize_pimpl = dynamic_cast<lib_ref::ResizeBilinear*>(resize_run_op);
+
+  uint32_t input_tile_size[kResizeBilinearRank];
+  uint32_t out_tile_size[kResizeBilinearRank];
+  int32_t input_tile_offsets[kResizeBilinearRank];
+  int32_t output_tile_offsets[kResizeBilinearRank];
+  const int32_t zero_offsets[kResizeBilinearRank]{};
+  for (uint32_t n_tile = 0; n_tile < num_tiles; n_tile++) {
+    status = resize_run_op->Prefetch();
+    assert(status == MLI_STATUS_OK);
+
+    resize_pimpl->GetIOSizesAndOffsets(input_tile_size, out_tile_size, input_tile_offsets, output_tile_offsets);
+
+    // copy input from global buffer to local tile buffer
+    strided_copy_with_offsets(kResizeBilinearRank, sizeof(int8_t), input_tensor.data.mem.pi8,
+                              input_tile_offsets, zero_offsets, input_tensor.mem_stride,
+                              input_tile_size, g_mem_pool + resize_in_buf.get_offset());
+
+    status = resize_run_op->Issue();
+    assert(status == MLI_STATUS_OK);
+
+    // copy output from local tile buffer to global buffer
+    strided_copy_with_offsets(kResizeBilinearRank, out_elem_size, g_mem_pool + resize_out_buf.get_offset(),
+                              zero_offsets, output_tile_offsets, output_tensor.mem_stride,
+                              out_tile_size, output_tensor.data.mem.pi8);
+
+    status = resize_run_op->Update();
+    assert(status == MLI_STATUS_OK);
+  }
+  free(resize_cs_buffer);
 }
 
 bool postprocess_phase(const reporter_basic& reporter, uint32_t output_h, uint32_t output_w, uint32_t n_test_case,
-                       mli_tensor& input_tensor, lib_mli::ResizeOpConfig& cfg, mli_tensor& output_tensor) {
+                       const uint32_t factor[2], mli_tensor& input_tensor, lib_mli::ResizeOpConfig& cfg,
+                       mli_tensor& output_tensor) {
 
-  // dequantize output of fx-algorithm
+  // compare output of fx-algorithm with the straightforward fixed point algorithm
   uint32_t num_o_elem = mli_hlp_count_elem_num(&output_tensor, 0);
-  apply_tensor_rshift(output_tensor.data.mem.pi32, num_o_elem, cfg.shift * 2, g_mem_output_quantized_rescaled);
+  reference_resize_bilinear_fx(input_tensor.data.mem.pi8, g_mem_reference_output_fx, cfg,
+                               k_input_h, k_input_w, output_h, output_w);
+  uint32_t mismatches = 0;
+  if (cfg.requant.enabled) {
+    // rounding of the requantization depends on the rounding mode, truncation is used for int32 output
+    for (uint32_t i = 0; i < num_o_elem; i++) {
+      const int32_t expected = g_mem_reference_output_fx[i] / (1 << (cfg.shift * 2));
+      if (abs(output_tensor.data.mem.pi8[i] - expected) > 1) mismatches++;
+      g_mem_output_quantized_rescaled[i] = output_tensor.data.mem.pi8[i];
+    }
+  } else {
+    for (uint32_t i = 0; i < num_o_elem; i++) {
+      if (output_tensor.data.mem.pi32[i] != g_mem_reference_output_fx[i]) mismatches++;
+    }
+    apply_tensor_rshift(output_tensor.data.mem.pi32, num_o_elem, cfg.shift * 2, g_mem_output_quantized_rescaled);
+  }
+
+  // dequantize output of fx-algorithm
   sa8_to_float(g_mem_output_quantized_rescaled, num_o_elem, k_sa_io_scale, k_sa_io_zp, k_sa_io_frac_bits, (float*) g_mem_output);
 
   // get float output of reference float algorithm
   const float strides_float[2]{
-    (float)(k_input_h - 1) / (float)(output_h - 1),
-    (float)(k_input_w - 1) / (float)(output_w - 1)
+    factor[0] != 0 ? 1.f / (float)factor[0] : (float)(k_input_h - 1) / (float)(output_h - 1),
+    factor[1] != 0 ? 1.f / (float)factor[1] : (float)(k_input_w - 1) / (float)(output_w - 1)
   };
   reference_resize_bilinear_float(g_mem_input_float, g_mem_reference_output, strides_float, 
                                    k_input_h, k_input_w, output_h, output_w);
@@ -154,15 +303,31 @@ bool postprocess_phase(const reporter_basic& reporter, uint32_t output_h, uint32
   // compare dequantized output of fx-algorithm with float output of reference float algorithm
   ref_to_pred_output metrics;
   test_status status = measure_err_vfloat(g_mem_reference_output, (float*)g_mem_output, num_o_elem, &metrics);
-  bool passed = status == TEST_PASSED && metrics.ref_to_noise_snr > 44.f;
+  bool passed = status == TEST_PASSED && metrics.ref_to_noise_snr > 44.f && mismatches == 0;
   char descr[256]{};
-  sprintf(descr, "Test %d %dx%d -> %dx%d", n_test_case, k_input_h, k_input_w, output_h, output_w);
+  if (cfg.requant.enabled) {
+    sprintf(descr, "Test %d -> %dx%d int8", n_test_case, output_h, output_w);
+  } else {
+    sprintf(descr, "Test %d %dx%d -> %dx%d", n_test_case, k_input_h, k_input_w, output_h, output_w);
+  }
   char message[256]{};
-  sprintf(message, "MaxErr = %.3f, SNR = %f", metrics.max_abs_err, metrics.ref_to_noise_snr);
+  sprintf(message, "MaxErr = %.3f, SNR = %f, Mismatches = %u", metrics.max_abs_err, metrics.ref_to_noise_snr, mismatches);
   reporter.report_case(descr, message, passed);
   return passed;
 }
 
+static bool run_case(const reporter_basic& reporter, uint32_t output_h, uint32_t output_w, uint32_t n_test_case,
+                     const uint32_t factor[2], bool requant) {
+  mli_tensor input_tensor;
+  lib_mli::ResizeOpConfig cfg;
+  mli_tensor output_tensor;
+  prepare_phase(output_h, output_w, factor, requant, input_tensor, cfg, output_tensor);
+
+  execution_phase(input_tensor, cfg, output_tensor);
+
+  return postprocess_phase(reporter, output_h, output_w, n_test_case, factor, input_tensor, cfg, output_tensor);
+}
+
 int main(){
   const reporter_basic reporter;
   reporter.report_header("MLI3.0|Kernels|Resize Bilinear Function Tests");
@@ -170,20 +335,27 @@ int main(){
   float_to_sa8(g_mem_input_float, k_max_num_input_image_elements, k_sa_io_scale, k_sa_io_zp, k_sa_io_frac_bits, g_mem_input_values_quantized);
 
   bool final_status = true;
+  const uint32_t no_factor[2]{0, 0};
   for (unsigned i = 0; i < num_h_strides_cases; i++) {
     for (unsigned j = 0; j < num_w_strides_cases; j++) {
       unsigned n_test_case = 1 + i * num_w_strides_cases + j;
+      final_status &= run_case(reporter, output_h_array[i], output_w_array[j], n_test_case, no_factor, false);
+    }
+  }
 
-      mli_tensor input_tensor;
-      lib_mli::ResizeOpConfig cfg;
-      mli_tensor output_tensor;
-      prepare_phase(output_h_array[i], output_w_array[j], input_tensor, cfg, output_tensor);
-
-      execution_phase(input_tensor, cfg, output_tensor);
-
-      final_status &= postprocess_phase(reporter, output_h_array[i], output_w_array[j], n_test_case, input_tensor, cfg, output_tensor);
+  unsigned n_test_case = num_h_strides_cases * num_w_strides_cases + 1;
+  for (unsigned i = 0; i < num_int_factor_cases; i++, n_test_case++) {
+    const uint32_t* factor = int_factor_array[i];
+    final_status &= run_case(reporter, k_input_h * factor[0], k_input_w * factor[1], n_test_case, factor, false);
+  }
 
-    }
+  // fused requantization to int8
+  for (unsigned i = 0; i < num_h_strides_cases; i++, n_test_case++) {
+    final_status &= run_case(reporter, output_h_array[i], output_w_array[i], n_test_case, no_factor, true);
+  }
+  for (unsigned i = 0; i < num_int_factor_cases; i++, n_test_case++) {
+    const uint32_t* factor = int_factor_array[i];
+    final_status &= run_case(reporter, k_input_h * factor[0], k_input_w * factor[1], n_test_case, factor, true);
   }
 
   reporter.report_outline("[AUTO] Group: mli_krn_resize_bilinear_30", final_status);
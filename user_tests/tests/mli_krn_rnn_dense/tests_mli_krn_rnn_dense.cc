@@ -13,6 +13,7 @@
 #include <stdio.h>
 #include <string.h>
 
+#include "test_benchmark.h"
 #include "test_crc32_calc.h"
 #include "test_memory_manager.h"
 #include "test_quality_metrics.h"
@@ -28,6 +29,9 @@ using mli::tst::quality_metrics;
 using mli::tst::crc32_calc;
 using mli::tst::reporter_full;
 using mli::tst::memory_manager;
+using mli::tst::benchmark_reporter;
+using mli::tst::bench_data_bytes;
+using mli::tst::bench_memory_footprint;
 
 typedef mli_status(*rnn_dense_func_ptr)(
     const mli_tensor** /*inputs*/,
@@ -174,6 +178,7 @@ constexpr int kTestsNum = sizeof(tests_list) / sizeof(tests_list[0]);
 
 int main() {
     const reporter_full reporter;
+    benchmark_reporter bench;
     bool final_status = true;
 
     reporter.report_header("MLI|Kernels|RNN Dense Tests");
@@ -268,7 +273,7 @@ int main() {
 
         // Run specific kernel for test
         if (is_test_passed &&
-                cur_test->mli_krn_rnn_dense(inputs, weights, &bias, &cur_test->cfg, &out) != MLI_STATUS_OK) {
+                bench.measure([&] { return cur_test->mli_krn_rnn_dense(inputs, weights, &bias, &cur_test->cfg, &out); }) != MLI_STATUS_OK) {
             reporter.report_message(cur_test->descr, "FAILED at kernel run: kernel returned bad status");
             is_test_passed = false;
         }
@@ -316,9 +321,21 @@ int main() {
             is_test_passed &= reporter.evaluate_and_report_case(cur_test->descr, test_metrics, cur_test->threshold,
                                                                 data_crc, cur_test->check_sum);
         }
+        if (is_test_passed) {
+            uint64_t macs = 0;
+            uint32_t bytes = bench_data_bytes({&bias, &out});
+            uint32_t footprint = bench_memory_footprint({&bias, &out});
+            for (int input_idx = 0; input_idx < inputs_num; ++input_idx) {
+                macs += mli_hlp_count_elem_num(weights[input_idx], 0);
+                bytes += bench_data_bytes({inputs[input_idx], weights[input_idx]});
+                footprint += bench_memory_footprint({inputs[input_idx], weights[input_idx]});
+            }
+            bench.add_case(cur_test->descr, macs, bytes, footprint);
+        }
         final_status &= is_test_passed;
     }
 
+    bench.report("mli_krn_rnn_dense");
     reporter.report_outline("[AUTO] Group: mli_krn_rnn_dense", final_status);
 
     return (final_status) ? 0 : 1;
@@ -0,0 +1,259 @@
+/*
+* Copyright 2022, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "mli_api.h"
+#include "mli_config.h"
+#include "mli_types.h"
+
+#include "test_memory_manager.h"
+#include "test_report.h"
+
+using mli::tst::reporter_basic;
+
+constexpr int kSliceLen = 3000;
+constexpr int kChunkLen = 256;
+constexpr int kLongSliceLen = 100000;
+constexpr int kNumRows = 4;
+constexpr int kRowLen = 300;
+constexpr int kTopK = 5;
+// 1 / (1 << kInShift) is a scale of input values
+constexpr int kInShift = 4;
+
+static IO_DATA_ATTR int8_t g_input[kSliceLen];
+static IO_DATA_ATTR int8_t g_output[kSliceLen];
+static IO_DATA_ATTR int8_t g_output_ref[kSliceLen];
+static IO_DATA_ATTR int8_t g_chunk[kChunkLen];
+static int16_t g_lut_data[1024];
+
+static mli_tensor make_sa8_tensor(int8_t* data, uint32_t len) {
+    mli_tensor t{};
+    t.data.mem.pi8 = data;
+    t.data.capacity = len;
+    t.el_type = MLI_EL_SA_8;
+    t.rank = 1;
+    t.shape[0] = len;
+    t.mem_stride[0] = 1;
+    t.el_params.sa.dim = -1;
+    t.el_params.sa.zero_point.mem.i16 = 0;
+    t.el_params.sa.scale.mem.i16 = 1;
+    t.el_params.sa.scale_frac_bits.mem.i8 = kInShift;
+    return t;
+}
+
+static float dequantize(const mli_tensor& t, int8_t val) {
+    return (val - t.el_params.sa.zero_point.mem.i16) * t.el_params.sa.scale.mem.i16 /
+           (float)(1 << t.el_params.sa.scale_frac_bits.mem.i8);
+}
+
+// Pass the input in chunks of kChunkLen (the last one is shorter) through update and then
+// through normalize (softmax or log softmax).
+static bool run_stream(const int8_t* input, int len, const mli_lut& lut, bool is_log, int topk,
+                       mli_softmax_stream_state& state, int8_t* output, mli_tensor& out_chunk) {
+    bool ok = mli_krn_softmax_stream_init(topk, &state) == MLI_STATUS_OK;
+    for (int pos = 0; pos < len && ok; pos += kChunkLen) {
+        const int num = (len - pos < kChunkLen) ? len - pos : kChunkLen;
+        // chunk is copied as it would be moved into a fast memory
+        for (int i = 0; i < num; i++) g_chunk[i] = input[pos + i];
+        mli_tensor in_chunk = make_sa8_tensor(g_chunk, num);
+        ok = mli_krn_softmax_stream_update_sa8(&in_chunk, &lut, &state) == MLI_STATUS_OK;
+    }
+    for (int pos = 0; pos < len && ok; pos += kChunkLen) {
+        const int num = (len - pos < kChunkLen) ? len - pos : kChunkLen;
+        for (int i = 0; i < num; i++) g_chunk[i] = input[pos + i];
+        mli_tensor in_chunk = make_sa8_tensor(g_chunk, num);
+        out_chunk = make_sa8_tensor(output + pos, num);
+        ok = (is_log ? mli_krn_log_softmax_stream_normalize_sa8(&in_chunk, &lut, &state, &out_chunk)
+                     : mli_krn_softmax_stream_normalize_sa8(&in_chunk, &lut, &state, &out_chunk)) == MLI_STATUS_OK;
+    }
+    return ok;
+}
+
+static int max_abs_diff(const int8_t* a, const int8_t* b, int len) {
+    int res = 0;
+    for (int i = 0; i < len; i++) {
+        const int diff = abs(a[i] - b[i]);
+        res = diff > res ? diff : res;
+    }
+    return res;
+}
+
+int main() {
+    const reporter_basic reporter;
+    bool final_status = true;
+    char message[128];
+    reporter.report_header("MLI|Kernels|Streaming Softmax Tests");
+
+    mli_lut lut{};
+    lut.data.mem.pi16 = g_lut_data;
+    lut.data.capacity = sizeof(g_lut_data);
+    bool is_test_passed = (int)sizeof(g_lut_data) >= mli_krn_softmax_get_lut_size() &&
+                          mli_krn_softmax_create_lut(&lut) == MLI_STATUS_OK;
+    reporter.report_case("Test 0 LUT", "", is_test_passed);
+    final_status &= is_test_passed;
+
+    // Pseudo random input with the maximum in the middle of the slice, so the running sum is rescaled
+    for (int i = 0; i < kSliceLen; i++) {
+        g_input[i] = (int8_t)(((i * 7919) % 97) - 100);
+    }
+    g_input[1500] = 40;
+    g_input[2999] = 35;
+    g_input[17] = 30;
+
+    // 1: online streaming softmax vs two pass softmax kernel over the whole slice
+    {
+        mli_softmax_stream_state state;
+        mli_tensor out_chunk;
+        mli_tensor in = make_sa8_tensor(g_input, kSliceLen);
+        mli_tensor out_ref = make_sa8_tensor(g_output_ref, kSliceLen);
+        mli_softmax_cfg cfg = {-1};
+        is_test_passed = mli_krn_softmax_sa8(&in, &lut, &cfg, &out_ref) == MLI_STATUS_OK &&
+                         run_stream(g_input, kSliceLen, lut, false, 0, state, g_output, out_chunk);
+        const int diff = is_test_passed ? max_abs_diff(g_output, g_output_ref, kSliceLen) : -1;
+        is_test_passed &= diff <= 1 &&
+                          out_chunk.el_params.sa.zero_point.mem.i16 == out_ref.el_params.sa.zero_point.mem.i16 &&
+                          out_chunk.el_params.sa.scale_frac_bits.mem.i8 == out_ref.el_params.sa.scale_frac_bits.mem.i8;
+        sprintf(message, "Max diff with softmax kernel = %d", diff);
+        reporter.report_case("Test 1 Softmax in chunks", message, is_test_passed);
+        final_status &= is_test_passed;
+    }
+
+    // 2: maximum is the first value, so no rescaling is done and result is bit exact
+    {
+        mli_softmax_stream_state state;
+        mli_tensor out_chunk;
+        int8_t first = g_input[0];
+        g_input[0] = 127;
+        mli_tensor in = make_sa8_tensor(g_input, kSliceLen);
+        mli_tensor out_ref = make_sa8_tensor(g_output_ref, kSliceLen);
+        mli_softmax_cfg cfg = {-1};
+        is_test_passed = mli_krn_softmax_sa8(&in, &lut, &cfg, &out_ref) == MLI_STATUS_OK &&
+                         run_stream(g_input, kSliceLen, lut, false, 0, state, g_output, out_chunk);
+        const int diff = is_test_passed ? max_abs_diff(g_output, g_output_ref, kSliceLen) : -1;
+        is_test_passed &= diff == 0;
+        sprintf(message, "Max diff with softmax kernel = %d", diff);
+        reporter.report_case("Test 2 Softmax bit exact", message, is_test_passed);
+        final_status &= is_test_passed;
+        g_input[0] = first;
+    }
+
+    // 3: log softmax in chunks vs float reference
+    {
+        mli_softmax_stream_state state;
+        mli_tensor out_chunk;
+        mli_tensor in = make_sa8_tensor(g_input, kSliceLen);
+        is_test_passed = run_stream(g_input, kSliceLen, lut, true, 0, state, g_output, out_chunk);
+        float max_val = -1000.f;
+        for (int i = 0; i < kSliceLen; i++) max_val = fmaxf(max_val, dequantize(in, g_input[i]));
+        double sum = 0.;
+        for (int i = 0; i < kSliceLen; i++) sum += exp(dequantize(in, g_input[i]) - max_val);
+        const float log_sum = (float)log(sum);
+        float max_err = 0.f;
+        for (int i = 0; i < kSliceLen && is_test_passed; i++) {
+            const float ref = dequantize(in, g_input[i]) - max_val - log_sum;
+            // skip values below the output range
+            if (ref < -15.f) continue;
+            max_err = fmaxf(max_err, fabsf(dequantize(out_chunk, g_output[i]) - ref));
+        }
+        is_test_passed &= max_err <= 2.f / 16;
+        sprintf(message, "Max abs err = %.4f", max_err);
+        reporter.report_case("Test 3 Log softmax in chunks", message, is_test_passed);
+        final_status &= is_test_passed;
+    }
+
+    // 4: log softmax kernel along an axis is the same as streaming log softmax of each row
+    {
+        mli_tensor in = make_sa8_tensor(g_input, kNumRows * kRowLen);
+        in.rank = 2;
+        in.shape[0] = kNumRows;
+        in.shape[1] = kRowLen;
+        in.mem_stride[0] = kRowLen;
+        in.mem_stride[1] = 1;
+        mli_tensor out = in;
+        out.data.mem.pi8 = g_output_ref;
+        mli_softmax_cfg cfg = {1};
+        is_test_passed = mli_krn_log_softmax_sa8(&in, &lut, &cfg, &out) == MLI_STATUS_OK;
+        int diff = -1;
+        for (int row = 0; row < kNumRows && is_test_passed; row++) {
+            mli_softmax_stream_state state;
+            mli_tensor out_chunk;
+            is_test_passed = run_stream(g_input + row * kRowLen, kRowLen, lut, true, 0, state,
+                                        g_output + row * kRowLen, out_chunk);
+        }
+        if (is_test_passed) {
+            diff = max_abs_diff(g_output, g_output_ref, kNumRows * kRowLen);
+            is_test_passed = diff == 0;
+        }
+        sprintf(message, "Max diff with streaming = %d", diff);
+        reporter.report_case("Test 4 Log softmax axis=1", message, is_test_passed);
+        final_status &= is_test_passed;
+    }
+
+    // 5: top-k values are tracked while updating the state
+    {
+        mli_softmax_stream_state state;
+        mli_tensor out_chunk;
+        int8_t topk_prob[kTopK];
+        int32_t topk_idx[kTopK];
+        mli_tensor out = make_sa8_tensor(topk_prob, kTopK);
+        mli_tensor out_idx{};
+        out_idx.data.mem.pi32 = topk_idx;
+        out_idx.data.capacity = sizeof(topk_idx);
+        out_idx.el_type = MLI_EL_SA_32;
+        is_test_passed = run_stream(g_input, kSliceLen, lut, false, kTopK, state, g_output, out_chunk) &&
+                         mli_krn_softmax_stream_topk_sa8(&lut, &state, &out, &out_idx) == MLI_STATUS_OK &&
+                         out.shape[0] == kTopK && out_idx.shape[0] == kTopK;
+
+        // reference: selection of the largest values, equal values are ordered by index
+        bool used[kSliceLen] = {false};
+        for (int k = 0; k < kTopK && is_test_passed; k++) {
+            int best = -1;
+            for (int i = 0; i < kSliceLen; i++) {
+                if (!used[i] && (best < 0 || g_input[i] > g_input[best])) best = i;
+            }
+            used[best] = true;
+            is_test_passed = topk_idx[k] == best && topk_prob[k] == g_output[best];
+        }
+        sprintf(message, "Top-1 index = %d", (int)topk_idx[0]);
+        reporter.report_case("Test 5 Top-k", message, is_test_passed);
+        final_status &= is_test_passed;
+    }
+
+    // 6: long slice, the running sum of exponents is scaled down to prevent overflow
+    {
+        mli_softmax_stream_state state;
+        is_test_passed = mli_krn_softmax_stream_init(0, &state) == MLI_STATUS_OK;
+        for (int i = 0; i < kChunkLen; i++) g_chunk[i] = 5;
+        mli_tensor in_chunk = make_sa8_tensor(g_chunk, kChunkLen);
+        int processed = 0;
+        while (processed < kLongSliceLen && is_test_passed) {
+            const int num = (kLongSliceLen - processed < kChunkLen) ? kLongSliceLen - processed : kChunkLen;
+            in_chunk.shape[0] = num;
+            is_test_passed = mli_krn_softmax_stream_update_sa8(&in_chunk, &lut, &state) == MLI_STATUS_OK;
+            processed += num;
+        }
+        in_chunk.shape[0] = 1;
+        mli_tensor out_chunk = make_sa8_tensor(g_output, 1);
+        is_test_passed = is_test_passed && state.sum_shift > 0 &&
+                         mli_krn_log_softmax_stream_normalize_sa8(&in_chunk, &lut, &state, &out_chunk) == MLI_STATUS_OK;
+        const float ref = -logf((float)kLongSliceLen);
+        const float err = fabsf(dequantize(out_chunk, g_output[0]) - ref);
+        is_test_passed &= err <= 2.f / 16;
+        sprintf(message, "log(1/%d) abs err = %.4f", kLongSliceLen, err);
+        reporter.report_case("Test 6 Long slice", message, is_test_passed);
+        final_status &= is_test_passed;
+    }
+
+    reporter.report_outline("[AUTO] Group: mli_krn_softmax_stream", final_status);
+    return (final_status) ? 0 : 1;
+}
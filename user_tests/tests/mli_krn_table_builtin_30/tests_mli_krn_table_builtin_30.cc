@@ -0,0 +1,224 @@
+/*
+* Copyright 2022, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "mli_api.h"
+#include "mli_config.h"
+#include "mli_types.h"
+#include "mli_types.hpp"
+#include "mli_kernels_factory_ref.hpp"
+#include "mli_ref_private_types.hpp"
+#include "mli_runtime_api.hpp"
+#include "mli_ref_runtime_api.hpp"
+
+#include "test_memory_manager.h"
+#include "test_report.h"
+#include "test_tiling.hpp"
+
+using mli::tst::reporter_basic;
+
+namespace lib_mli = ::snps_arc::metaware::mli;
+namespace lib_ref = ::snps_arc::metaware::mli::ref;
+
+using lib_mli::kTableBuiltinIORank;
+using lib_mli::kTableBuiltinIOIterRank;
+using lib_mli::kTableBuiltinInFracBits;
+using lib_mli::kTableBuiltinOutFracBits;
+using lib_mli::kBiasRank;
+using lib_mli::kBiasIterRank;
+using lib_mli::LutType;
+
+struct table_builtin_test_operands {
+    const char* descr;
+    uint32_t shape[kTableBuiltinIORank];
+    uint32_t tile_shape[kTableBuiltinIORank];
+    lib_mli::TableBuiltinConfig cfg;
+    float in_min;
+    float in_max;
+    float max_abs_err;
+};
+
+static const table_builtin_test_operands tests_list[] = {
+    {"Test 1 Sigmoid per-tensor bias", {1, 6, 5, 8}, {1, 2, 5, 8}, lib_mli::TableBuiltinConfig(LutType::kSigmoid, false), -8.f, 8.f, 1e-3f},
+    {"Test 2 TanH per-channel bias",   {1, 3, 4, 16}, {1, 3, 3, 8}, lib_mli::TableBuiltinConfig(LutType::kTanH, true), -4.f, 4.f, 1e-3f},
+    {"Test 3 NegExp per-tensor bias",  {2, 4, 4, 5}, {1, 4, 4, 5}, lib_mli::TableBuiltinConfig(LutType::kNegExp, false), -7.f, 0.f, 1e-3f},
+};
+
+constexpr int kTestsNum = sizeof(tests_list) / sizeof(tests_list[0]);
+
+constexpr uint32_t kMemSize = 4 * 2048;
+constexpr uint32_t kMaxBiasLen = 64;
+static int16_t g_input[kMemSize / sizeof(int16_t)];
+static int16_t g_output[kMemSize / sizeof(int16_t)];
+static int16_t g_bias[kMaxBiasLen];
+static IO_DATA_ATTR int8_t g_mem_pool[kMemSize] = {0};
+
+static float reference_table(LutType type, float x) {
+    switch (type) {
+        case LutType::kSigmoid: return 1.f / (1.f + expf(-x));
+        case LutType::kTanH: return tanhf(x);
+        case LutType::kNegExp: return expf(x);
+        default: return 0.f;
+    }
+}
+
+static void set_mem_strides(const uint32_t* shape, int32_t* stride) {
+    stride[kTableBuiltinIORank - 1] = 1;
+    for (int i = kTableBuiltinIORank - 2; i >= 0; i--) stride[i] = stride[i + 1] * shape[i + 1];
+}
+
+bool run_test(const reporter_basic& reporter, const table_builtin_test_operands* cur_test) {
+    uint32_t shape[kTableBuiltinIORank];
+    uint32_t tile_shape[kTableBuiltinIORank];
+    int32_t stride[kTableBuiltinIORank];
+    uint32_t num_elems = 1;
+    for (uint32_t i = 0; i < kTableBuiltinIORank; i++) {
+        shape[i] = cur_test->shape[i];
+        tile_shape[i] = cur_test->tile_shape[i];
+        num_elems *= shape[i];
+    }
+    set_mem_strides(shape, stride);
+
+    // Biased input covers [in_min, in_max]: half of the range comes from the bias
+    const uint32_t bias_len = cur_test->cfg.innermost_dim_bias ? shape[kTableBuiltinIORank - 1] : 1;
+    const float one_in = (float)(1 << kTableBuiltinInFracBits);
+    const float half_range = (cur_test->in_max - cur_test->in_min) / 2.f;
+    for (uint32_t i = 0; i < bias_len; i++) {
+        const float bias_fl = cur_test->in_min + half_range * (float)i / (float)bias_len;
+        g_bias[i] = (int16_t)lroundf(bias_fl * one_in);
+    }
+    for (uint32_t i = 0; i < num_elems; i++) {
+        const float in_fl = half_range * (float)((i * 37) % 101) / 100.f;
+        g_input[i] = (int16_t)lroundf(in_fl * one_in);
+    }
+
+    // STEP 1: Construct TableBuiltin as a specific ExecutionInterface successor
+    //==================================================================
+    lib_mli::Tensor<lib_mli::NoBuffer, kTableBuiltinIORank> io_tensor(shape, stride);
+    io_tensor.set_elem_size(sizeof(int16_t));
+    int32_t iteration_order[kTableBuiltinIOIterRank]{ 0, 1, 2, 3 };
+    lib_mli::IteratorCfg<kTableBuiltinIOIterRank> it_config(io_tensor, tile_shape, iteration_order);
+    lib_mli::TensorIterator<lib_mli::NoBuffer, kTableBuiltinIORank, kTableBuiltinIOIterRank> in_tensor_it(io_tensor, it_config);
+    lib_mli::TensorIterator<lib_mli::NoBuffer, kTableBuiltinIORank, kTableBuiltinIOIterRank> out_tensor_it(io_tensor, it_config);
+    const uint32_t num_tiles = in_tensor_it.GetTotalCount();
+
+    lib_mli::PlatformDescription pd;
+    lib_ref::KernelsFactory kernel_factory(pd);
+    void* table_cs_buffer = malloc(kernel_factory.TableBuiltin_CS_GetSize());
+    auto table_op = kernel_factory.TableBuiltin_CS(table_cs_buffer, in_tensor_it, cur_test->cfg, out_tensor_it);
+
+    // STEP 2: Memory management (Up to user on how to deal with it)
+    //==================================================================
+    uint32_t offset = 0;
+    const uint32_t runtime_obj_size = table_op->GetRuntimeObjectSize();
+    offset += runtime_obj_size;
+    const uint32_t private_buffer_size = table_op->GetKernelPrivateDataSize();
+    const uint32_t private_buffer_offset = offset;
+    offset += private_buffer_size;
+
+    const uint32_t io_size = lib_mli::service::GetBufferSize(kTableBuiltinIORank, tile_shape, stride) * sizeof(int16_t);
+    lib_mli::OffsetBuffer table_in_buf{offset, 0, io_size, sizeof(int16_t)};
+    offset += io_size;
+    lib_mli::OffsetBuffer table_out_buf{offset, 0, io_size, sizeof(int16_t)};
+    offset += io_size;
+
+    const uint32_t params_size = table_op->GetParamsBufferSize();
+    lib_mli::OffsetBuffer table_params_buf{offset, 0, params_size, sizeof(int16_t)};
+    offset += params_size;
+
+    const uint32_t ctrl_buffer_size = table_op->GetCtrlBufferSize();
+    lib_mli::OffsetBuffer table_ctrl_buf{offset, 0, ctrl_buffer_size, sizeof(char)};
+    offset += ctrl_buffer_size;
+    assert(offset <= kMemSize);
+
+    // encode the input bias directly into its place in the memory pool
+    uint32_t bias_shape[kBiasRank] = {bias_len};
+    lib_mli::Buffer bias_buf(g_bias, bias_len * sizeof(int16_t), sizeof(int16_t));
+    lib_mli::Tensor<lib_mli::Buffer, kBiasRank> bias_tensor(bias_buf, bias_shape);
+    lib_mli::TensorIterator<lib_mli::Buffer, kBiasRank, kBiasIterRank> bias_tensor_it(bias_tensor);
+    lib_mli::Buffer encoded_params_buf(g_mem_pool + table_params_buf.get_offset(), params_size, sizeof(int16_t));
+    mli_status status = table_op->EncodeParams(bias_tensor_it, encoded_params_buf);
+    assert(status == MLI_STATUS_OK);
+
+    status = table_op->AttachBufferOffsets(table_in_buf, table_out_buf, table_params_buf, table_ctrl_buf);
+    assert(status == MLI_STATUS_OK);
+    status = table_op->GetKernelPrivateData(g_mem_pool + private_buffer_offset);
+    assert(status == MLI_STATUS_OK);
+
+    // STEP 3: Execution phase
+    //==================================================================
+    uint64_t membasis[] = {reinterpret_cast<uint64_t>(g_mem_pool)};
+    auto table_run_op = lib_mli::ExecutionInterface::Create(g_mem_pool, runtime_obj_size,
+                                                            g_mem_pool + private_buffer_offset, private_buffer_size,
+                                                            membasis, sizeof(membasis) / sizeof(membasis[0]));
+    assert(table_run_op != nullptr);
+    lib_ref::TableBuiltin* table_pimpl = dynamic_cast<lib_ref::TableBuiltin*>(table_run_op);
+
+    uint32_t input_tile_size[kTableBuiltinIORank];
+    uint32_t output_tile_size[kTableBuiltinIORank];
+    int32_t input_tile_offsets[kTableBuiltinIORank];
+    int32_t output_tile_offsets[kTableBuiltinIORank];
+    const int32_t zero_offsets[kTableBuiltinIORank]{};
+    for (uint32_t n_tile = 0; n_tile < num_tiles; n_tile++) {
+        status = table_run_op->Prefetch();
+        assert(status == MLI_STATUS_OK);
+
+        table_pimpl->GetIOSizesAndOffsets(input_tile_size, output_tile_size, input_tile_offsets, output_tile_offsets);
+
+        // copy input from global buffer to local tile buffer
+        strided_copy_with_offsets(kTableBuiltinIORank, sizeof(int16_t), (int8_t*)g_input,
+                                  input_tile_offsets, zero_offsets, stride,
+                                  input_tile_size, g_mem_pool + table_in_buf.get_offset());
+
+        status = table_run_op->Issue();
+        assert(status == MLI_STATUS_OK);
+
+        // copy output from local tile buffer to global buffer
+        strided_copy_with_offsets(kTableBuiltinIORank, sizeof(int16_t), g_mem_pool + table_out_buf.get_offset(),
+                                  zero_offsets, output_tile_offsets, stride,
+                                  output_tile_size, (int8_t*)g_output);
+
+        status = table_run_op->Update();
+        assert(status == MLI_STATUS_OK);
+    }
+    free(table_cs_buffer);
+
+    // STEP 4: Compare with the float reference
+    //==================================================================
+    const float one_out = (float)(1 << kTableBuiltinOutFracBits);
+    float max_abs_err = 0.f;
+    for (uint32_t i = 0; i < num_elems; i++) {
+        const int16_t bias = g_bias[bias_len > 1 ? i % bias_len : 0];
+        const float x = (float)(g_input[i] + bias) / one_in;
+        const float err = fabsf(reference_table(cur_test->cfg.type, x) - (float)g_output[i] / one_out);
+        max_abs_err = err > max_abs_err ? err : max_abs_err;
+    }
+    const bool is_test_passed = max_abs_err < cur_test->max_abs_err;
+    char message[64]{};
+    sprintf(message, "Tiles = %u, MaxErr = %f", num_tiles, max_abs_err);
+    reporter.report_case(cur_test->descr, message, is_test_passed);
+    return is_test_passed;
+}
+
+int main() {
+    const reporter_basic reporter;
+    bool final_status = true;
+
+    reporter.report_header("MLI3.0|Kernels|Table Builtin Function Tests");
+    for (int i = 0; i < kTestsNum; ++i) {
+        final_status &= run_test(reporter, &tests_list[i]);
+    }
+    reporter.report_outline("[AUTO] Group: mli_krn_table_builtin_30", final_status);
+
+    return 0;
+}
@@ -14,6 +14,7 @@
 #include <stdio.h>
 #include <string.h>
 
+#include "test_benchmark.h"
 #include "test_crc32_calc.h"
 #include "test_memory_manager.h"
 #include "test_quality_metrics.h"
@@ -29,6 +30,9 @@ using mli::tst::quality_metrics;
 using mli::tst::crc32_calc;
 using mli::tst::reporter_full;
 using mli::tst::memory_manager;
+using mli::tst::benchmark_reporter;
+using mli::tst::bench_data_bytes;
+using mli::tst::bench_memory_footprint;
 
 typedef mli_status(*transpose_conv2d_func_ptr)(
     const mli_tensor* /*input*/,
@@ -243,6 +247,7 @@ constexpr int kTestsNum = sizeof(tests_list) / sizeof(tests_list[0]);
 
 int main() {
     const reporter_full reporter;
+    benchmark_reporter bench;
     bool final_status = true;
 
     reporter.report_header("MLI|Kernels|Transpose Convolution 2D  Tests");
@@ -318,7 +323,7 @@ int main() {
 
         // Run specific kernel for test
         if (is_test_passed &&
-                cur_test->mli_krn_transpose_conv2d(&input, &weights, &bias, &cur_test->cfg, &out) != MLI_STATUS_OK) {
+                bench.measure([&] { return cur_test->mli_krn_transpose_conv2d(&input, &weights, &bias, &cur_test->cfg, &out); }) != MLI_STATUS_OK) {
             reporter.report_message(cur_test->descr, "FAILED at kernel run: kernel returned bad status");
             is_test_passed = false;
         }
@@ -371,9 +376,15 @@ int main() {
             is_test_passed &= reporter.evaluate_and_report_case(cur_test->descr, test_metrics, cur_test->threshold, 
                                                                 data_crc, cur_test->check_sum);
         }
+        if (is_test_passed) {
+            bench.add_case(cur_test->descr, mli_hlp_count_elem_num(&input, 0) * mli_hlp_count_elem_num(&weights, 0) / weights.shape[2],
+                           bench_data_bytes({&input, &weights, &bias, &out}),
+                           bench_memory_footprint({&input, &weights, &bias, &out}));
+        }
         final_status &= is_test_passed;
     }
 
+    bench.report("mli_krn_transpose_conv2d");
     reporter.report_outline("[AUTO] Group: mli_krn_transpose_conv2d", final_status);
 
     return (final_status) ? 0 : 1;
@@ -0,0 +1,254 @@
+/*
+* Copyright 2022, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "mli_api.h"
+#include "mli_config.h"
+#include "mli_types.h"
+#include "mli_types.hpp"
+#include "mli_kernels_factory_ref.hpp"
+#include "mli_runtime_api.hpp"
+#include "mli_ref_weights_codec.hpp"
+
+#include "test_memory_manager.h"
+#include "test_report.h"
+
+using mli::tst::reporter_basic;
+
+namespace lib_mli = ::snps_arc::metaware::mli;
+namespace lib_ref = ::snps_arc::metaware::mli::ref;
+
+using lib_mli::kFullyConnectedIORank;
+using lib_mli::kFullyConnectedWRank;
+using lib_mli::kFullyConnectedZPRank;
+using lib_mli::kFullyConnectedIterRank;
+using lib_mli::kConvWRank;
+using lib_mli::kConvWIterRank;
+
+constexpr uint32_t kFcIn = 64;
+constexpr uint32_t kFcOut = 24;
+constexpr uint32_t kMemPoolSize = 8 * 1024;
+constexpr uint32_t kCsBufSize = 2 * 1024;
+constexpr uint32_t kPrivateBufSize = 1024;
+constexpr uint32_t kRuntimeBufSize = 2 * 1024;
+
+// Convolution weights (GHWCinCo) tiled along output channels
+constexpr uint32_t kConvWShape[kConvWRank] = {1, 3, 3, 8, 32};
+constexpr uint32_t kConvWTileCo = 8;
+constexpr uint32_t kConvWNumElems = 3 * 3 * 8 * 32;
+
+static IO_DATA_ATTR int8_t g_mem_pool[kMemPoolSize] = {0};
+static int8_t g_fc_weights[kFcIn * kFcOut];
+static int8_t g_fc_input[kFcIn];
+static int32_t g_fc_ref[kFcOut];
+static int8_t g_conv_weights[kConvWNumElems];
+static int8_t g_encoded[2 * kConvWNumElems];
+static int8_t g_decoded[kConvWNumElems];
+static uint32_t g_cs_buf[kCsBufSize / sizeof(uint32_t)];
+static uint32_t g_private_buf[kPrivateBufSize / sizeof(uint32_t)];
+static uint32_t g_runtime_buf[kRuntimeBufSize / sizeof(uint32_t)];
+
+struct compression_test {
+    const char* name;
+    lib_mli::compression_mode_t mode;
+};
+
+static const compression_test kFcTests[] = {
+    {"Test 1 FC Uncompressed", lib_mli::compression_mode_t::Uncompressed},
+    {"Test 2 FC Compressed", lib_mli::compression_mode_t::Compressed},
+    {"Test 3 FC Sparse", lib_mli::compression_mode_t::Sparse},
+};
+
+static const compression_test kTileTests[] = {
+    {"Test 4 Tiled Conv weights Compressed", lib_mli::compression_mode_t::Compressed},
+    {"Test 5 Tiled Conv weights Sparse", lib_mli::compression_mode_t::Sparse},
+};
+
+// Pruned weights: most of the values (and whole 4-element blocks) are zeros
+static int8_t pruned_value(uint32_t i) {
+    if ((i / 4) % 3 != 0) return 0;
+    return (int8_t)((i * 37) % 255 - 127);
+}
+
+static bool run_fc(lib_mli::compression_mode_t mode, float& ratio) {
+    uint32_t in_shape[kFullyConnectedIORank] = {1, kFcIn};
+    uint32_t out_shape[kFullyConnectedIORank] = {1, kFcOut};
+    uint32_t w_shape[kFullyConnectedWRank] = {kFcIn, kFcOut};
+    uint32_t wzp_shape[kFullyConnectedZPRank] = {1};
+    const lib_mli::Tensor<lib_mli::NoBuffer, kFullyConnectedIORank> in_tensor(in_shape);
+    const lib_mli::Tensor<lib_mli::NoBuffer, kFullyConnectedIORank> out_tensor(out_shape);
+    const lib_mli::Tensor<lib_mli::NoBuffer, kFullyConnectedWRank> w_tensor(w_shape);
+    const lib_mli::Tensor<lib_mli::NoBuffer, kFullyConnectedZPRank> wzp_tensor(wzp_shape);
+    lib_mli::TensorIterator<lib_mli::NoBuffer, kFullyConnectedIORank, kFullyConnectedIterRank> in_it(in_tensor);
+    lib_mli::TensorIterator<lib_mli::NoBuffer, kFullyConnectedIORank, kFullyConnectedIterRank> out_it(out_tensor);
+    lib_mli::TensorIterator<lib_mli::NoBuffer, kFullyConnectedWRank, kFullyConnectedIterRank> w_it(w_tensor);
+    lib_mli::TensorIterator<lib_mli::NoBuffer, kFullyConnectedZPRank, kFullyConnectedIterRank> wzp_it(wzp_tensor);
+
+    lib_mli::PlatformDescription pd;
+    lib_ref::KernelsFactory kernel_factory(pd);
+    assert(kernel_factory.FullyConnected_CS_GetSize() <= kCsBufSize);
+    lib_mli::FullyConnectedConfig cfg(mode);
+    lib_mli::FullyConnected_CS* fc_op = kernel_factory.FullyConnected_CS(g_cs_buf, in_it, w_it, wzp_it, cfg, out_it);
+
+    // Weights buffer has to hold the whole encoded blob, so its worst case size is reserved
+    memset(g_mem_pool, 0, sizeof(g_mem_pool));
+    uint32_t offset = 0;
+    const uint32_t in_size = fc_op->GetInputBufferSize() * sizeof(int8_t);
+    lib_mli::OffsetBuffer in_buf{offset, 0, in_size, sizeof(int8_t)};
+    offset = CEIL_RND(offset + in_size, sizeof(int32_t));
+    const uint32_t out_size = fc_op->GetOutputBufferSize() * sizeof(int32_t);
+    lib_mli::OffsetBuffer out_buf{offset, 0, out_size, sizeof(int32_t)};
+    offset += out_size;
+    const uint32_t wzp_size = fc_op->GetEncodedWtsZeroPtsSize() * sizeof(int8_t);
+    const uint32_t w_size = fc_op->GetEncodedWeightsSize() * sizeof(int8_t) + fc_op->GetEncodedWtsZeroPtsSize() * sizeof(int16_t);
+    lib_mli::OffsetBuffer w_buf{offset, 0, w_size, sizeof(int8_t)};
+    const uint32_t w_offset = offset;
+    offset += w_size;
+    const uint32_t ctrl_size = fc_op->GetCtrlBufferSize();
+    lib_mli::OffsetBuffer ctrl_buf{offset, 0, ctrl_size, sizeof(char)};
+    offset += ctrl_size;
+    assert(offset <= kMemPoolSize);
+    assert((mode == lib_mli::compression_mode_t::Uncompressed) == (ctrl_size == 0));
+
+    mli_status status = fc_op->AttachBufferOffsets(in_buf, out_buf, w_buf, ctrl_buf);
+    assert(status == MLI_STATUS_OK);
+
+    // Encode weights and zero point straight into the memory pool
+    int8_t wzp = 0;
+    lib_mli::Buffer src_w_buf(g_fc_weights, sizeof(g_fc_weights), sizeof(int8_t));
+    lib_mli::Buffer src_wzp_buf(&wzp, sizeof(wzp), sizeof(int8_t));
+    lib_mli::Tensor<lib_mli::Buffer, kFullyConnectedWRank> src_w_tensor(src_w_buf, w_shape);
+    lib_mli::Tensor<lib_mli::Buffer, kFullyConnectedZPRank> src_wzp_tensor(src_wzp_buf, wzp_shape);
+    lib_mli::TensorIterator<lib_mli::Buffer, kFullyConnectedWRank, kFullyConnectedIterRank> src_w_it(src_w_tensor);
+    lib_mli::TensorIterator<lib_mli::Buffer, kFullyConnectedZPRank, kFullyConnectedIterRank> src_wzp_it(src_wzp_tensor);
+    const uint32_t encoded_size = fc_op->GetEncodedWeightsSize() * sizeof(int8_t) + wzp_size;
+    lib_mli::Buffer encoded_buf(g_mem_pool + w_offset, encoded_size, sizeof(int8_t));
+    status = fc_op->EncodeWeightsAndZeroPts(src_w_it, src_wzp_it, encoded_buf);
+    if (status != MLI_STATUS_OK) return false;
+    ratio = fc_op->GetWeightsCompressionRatio();
+
+    assert(fc_op->GetKernelPrivateDataSize() <= kPrivateBufSize);
+    status = fc_op->GetKernelPrivateData(g_private_buf);
+    assert(status == MLI_STATUS_OK);
+
+    memcpy(g_mem_pool + in_buf.get_offset(), g_fc_input, sizeof(g_fc_input));
+    uint64_t membasis[] = {reinterpret_cast<uint64_t>(g_mem_pool)};
+    lib_mli::ExecutionInterface* fc_rt = lib_mli::ExecutionInterface::Create(
+        g_runtime_buf, kRuntimeBufSize, g_private_buf, fc_op->GetKernelPrivateDataSize(),
+        membasis, sizeof(membasis) / sizeof(membasis[0]));
+    if (fc_rt == nullptr) return false;
+    status = fc_rt->Prefetch();
+    if (status == MLI_STATUS_OK) status = fc_rt->Issue();
+    if (status == MLI_STATUS_OK) status = fc_rt->Update();
+    if (status != MLI_STATUS_OK) return false;
+
+    const int32_t* out = reinterpret_cast<const int32_t*>(g_mem_pool + out_buf.get_offset());
+    for (uint32_t o = 0; o < kFcOut; o++) {
+        if (out[o] != g_fc_ref[o]) return false;
+    }
+    return true;
+}
+
+static bool run_tiled_codec(lib_mli::compression_mode_t mode, float& ratio) {
+    uint32_t shape[kConvWRank];
+    uint32_t tile_shape[kConvWRank];
+    for (uint32_t d = 0; d < kConvWRank; d++) shape[d] = tile_shape[d] = kConvWShape[d];
+    tile_shape[kConvWRank - 1] = kConvWTileCo;
+    const int32_t order[kConvWIterRank] = {0, 1, 2, 3, 4};
+
+    lib_mli::Tensor<lib_mli::OffsetBuffer, kConvWRank> w_tensor(lib_mli::OffsetBuffer(), shape);
+    lib_mli::TensorIterator<lib_mli::OffsetBuffer, kConvWRank, kConvWIterRank> w_it(w_tensor, tile_shape, order);
+
+    lib_mli::Buffer src_w_buf(g_conv_weights, sizeof(g_conv_weights), sizeof(int8_t));
+    lib_mli::Tensor<lib_mli::Buffer, kConvWRank> src_w_tensor(src_w_buf, shape);
+    int8_t wzp[kConvWShape[kConvWRank - 1]] = {0};
+    uint32_t wzp_shape[lib_mli::kWZPRank] = {kConvWShape[kConvWRank - 1]};
+    lib_mli::Buffer src_wzp_buf(wzp, sizeof(wzp), sizeof(int8_t));
+    lib_mli::Tensor<lib_mli::Buffer, lib_mli::kWZPRank> src_wzp_tensor(src_wzp_buf, wzp_shape);
+
+    memset(g_encoded, 0x55, sizeof(g_encoded));
+    lib_mli::Buffer encoded_buf(g_encoded, sizeof(g_encoded), sizeof(int8_t));
+    uint32_t encoded_size = 0;
+    mli_status status = lib_ref::EncodeCompressedWeightsAndZeroPts(mode, w_it, src_w_tensor, src_wzp_tensor,
+                                                                   encoded_buf, encoded_size);
+    if (status != MLI_STATUS_OK || encoded_size > lib_ref::GetEncodedWeightsBound(mode, w_it)) return false;
+    ratio = lib_ref::GetWeightsCompressionRatio(kConvWNumElems, encoded_size);
+
+    // Expand each tile the way the run-time objects do and compare it with the source
+    const lib_mli::InternalBuffer encoded(g_encoded, encoded_size);
+    const lib_mli::InternalBuffer decoded(g_decoded, lib_ref::GetMaxDecodedWeightsTileSize(w_it));
+    const uint32_t num_tiles = w_it.GetTotalCount();
+    for (uint32_t t = 0; t < num_tiles; t++) {
+        lib_mli::Tensor<lib_mli::InternalBuffer, kConvWRank> tile;
+        status = lib_ref::DecodeWeightsTile(w_it, encoded, decoded, tile);
+        if (status != MLI_STATUS_OK) return false;
+
+        uint32_t pos[kConvWRank];
+        lib_ref::GetWeightsTilePos(w_it, pos);
+        uint32_t idx = 0;
+        for (uint32_t h = 0; h < tile.get_dim(1); h++) {
+            for (uint32_t w = 0; w < tile.get_dim(2); w++) {
+                for (uint32_t ci = 0; ci < tile.get_dim(3); ci++) {
+                    for (uint32_t co = 0; co < tile.get_dim(4); co++) {
+                        const uint32_t src_idx = (((pos[1] + h) * shape[2] + pos[2] + w) * shape[3] + pos[3] + ci) * shape[4]
+                                                 + pos[4] + co;
+                        if (g_decoded[idx++] != g_conv_weights[src_idx]) return false;
+                    }
+                }
+            }
+        }
+        w_it.Next();
+    }
+
+    // Weights zero points follow the tile streams
+    for (uint32_t i = 0; i < wzp_shape[0]; i++) {
+        if (g_encoded[encoded_size + i] != wzp[i]) return false;
+    }
+    return true;
+}
+
+int main() {
+    const reporter_basic reporter;
+    bool final_status = true;
+    reporter.report_header("MLI3.0|Kernels|Weights Compression Tests");
+
+    for (uint32_t i = 0; i < kFcIn * kFcOut; i++) g_fc_weights[i] = pruned_value(i);
+    for (uint32_t i = 0; i < kFcIn; i++) g_fc_input[i] = (int8_t)((i * 53) % 255 - 127);
+    for (uint32_t o = 0; o < kFcOut; o++) {
+        g_fc_ref[o] = 0;
+        for (uint32_t i = 0; i < kFcIn; i++) g_fc_ref[o] += (int32_t)g_fc_input[i] * g_fc_weights[i * kFcOut + o];
+    }
+    for (uint32_t i = 0; i < kConvWNumElems; i++) g_conv_weights[i] = pruned_value(i);
+
+    char message[64]{};
+    for (const compression_test& test : kFcTests) {
+        float ratio = 0.f;
+        bool is_passed = run_fc(test.mode, ratio);
+        // Pruned weights have to take less memory in both compressed modes
+        if (test.mode != lib_mli::compression_mode_t::Uncompressed) is_passed &= ratio > 1.f;
+        sprintf(message, "Compression ratio = %.2f", ratio);
+        reporter.report_case(test.name, message, is_passed);
+        final_status &= is_passed;
+    }
+
+    for (const compression_test& test : kTileTests) {
+        float ratio = 0.f;
+        const bool is_passed = run_tiled_codec(test.mode, ratio) && ratio > 1.f;
+        sprintf(message, "Compression ratio = %.2f", ratio);
+        reporter.report_case(test.name, message, is_passed);
+        final_status &= is_passed;
+    }
+
+    reporter.report_outline("[AUTO] Group: mli_krn_weights_compression_30", final_status);
+    return 0;
+}
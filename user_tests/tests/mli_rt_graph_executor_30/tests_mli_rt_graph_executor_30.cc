@@ -0,0 +1,232 @@
+/*
+* Copyright 2022, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "mli_api.h"
+#include "mli_config.h"
+#include "mli_types.h"
+#include "mli_types.hpp"
+#include "mli_graph_executor.hpp"
+#include "mli_kernels_factory_ref.hpp"
+#include "mli_runtime_api.hpp"
+
+#include "test_memory_manager.h"
+#include "test_report.h"
+
+using mli::tst::reporter_basic;
+
+namespace lib_mli = ::snps_arc::metaware::mli;
+namespace lib_ref = ::snps_arc::metaware::mli::ref;
+
+using lib_mli::kEltwiseRank;
+using lib_mli::kEltwiseIterRank;
+using lib_mli::kMoveRank;
+using lib_mli::kMoveIterRank;
+
+// Graph under test (all tensors are int16 of the same shape):
+//   L0: t0  = max(a, b)
+//   L1: t1  = move(t0)
+//   L2: t2  = min(t1, c)
+//   L3: out = max(t2, a)
+enum { kBufA = 0, kBufB, kBufC, kBufT0, kBufT1, kBufT2, kBufOut, kBufNum };
+enum { kLayerMax0 = 0, kLayerMove, kLayerMin, kLayerMax1, kLayerNum };
+
+constexpr uint32_t kShape[kEltwiseRank] = {1, 4, 6, 8};
+constexpr uint32_t kNumElems = kShape[0] * kShape[1] * kShape[2] * kShape[3];
+constexpr uint32_t kArenaSize = 8 * 1024;
+constexpr uint32_t kCsBufSize = 4 * 1024;
+constexpr uint32_t kPrivateBufSize = 4 * 1024;
+constexpr uint32_t kRuntimeBufSize = 4 * 1024;
+constexpr int kRuns = 2;
+
+static IO_DATA_ATTR int8_t g_arena[kArenaSize] = {0};
+static uint32_t g_private_data[kLayerNum][kPrivateBufSize / sizeof(uint32_t)];
+static uint32_t g_runtime_buf[kRuntimeBufSize / sizeof(uint32_t)];
+static uint32_t g_cs_buf[kLayerNum][kCsBufSize / sizeof(uint32_t)];
+static int16_t g_ref[kNumElems];
+
+struct layer_buffers {
+    int32_t in_left;
+    int32_t in_right;
+    int32_t out;
+};
+
+static const layer_buffers kLayerBuffers[kLayerNum] = {
+    {kBufA, kBufB, kBufT0},
+    {kBufT0, -1, kBufT1},
+    {kBufT1, kBufC, kBufT2},
+    {kBufT2, kBufA, kBufOut},
+};
+
+static int16_t* arena_tensor(const lib_mli::GraphMemoryPlanner& planner, int32_t buf_id) {
+    return reinterpret_cast<int16_t*>(g_arena + planner.GetOffset(buf_id));
+}
+
+static lib_mli::OffsetBuffer arena_buffer(const lib_mli::GraphMemoryPlanner& planner,
+                                          const lib_mli::GraphBuffer* buffers, int32_t buf_id) {
+    return lib_mli::OffsetBuffer(planner.GetOffset(buf_id), 0, buffers[buf_id].size, sizeof(int16_t));
+}
+
+int main() {
+    const reporter_basic reporter;
+    bool final_status = true;
+    reporter.report_header("MLI3.0|Runtime|Graph Executor Tests");
+
+    // STEP 1: Compile all layers of the graph
+    //==================================================================
+    uint32_t shape[kEltwiseRank];
+    int32_t stride[kEltwiseRank];
+    stride[kEltwiseRank - 1] = 1;
+    for (int i = kEltwiseRank - 1; i >= 0; i--) {
+        shape[i] = kShape[i];
+        if (i < (int)kEltwiseRank - 1) stride[i] = stride[i + 1] * (int32_t)shape[i + 1];
+    }
+    lib_mli::Tensor<lib_mli::NoBuffer, kEltwiseRank> io_tensor(shape, stride);
+    io_tensor.set_elem_size(sizeof(int16_t));
+    lib_mli::IteratorCfg<kEltwiseIterRank> single_tile_cfg(io_tensor);
+    lib_mli::TensorIterator<lib_mli::NoBuffer, kEltwiseRank, kEltwiseIterRank> io_it(io_tensor, single_tile_cfg);
+
+    uint32_t move_shape[kMoveRank] = {1, shape[0], shape[1], shape[2], shape[3]};
+    int32_t move_stride[kMoveRank] = {stride[0] * (int32_t)shape[0], stride[0], stride[1], stride[2], stride[3]};
+    lib_mli::Tensor<lib_mli::NoBuffer, kMoveRank> move_tensor(move_shape, move_stride);
+    move_tensor.set_elem_size(sizeof(int16_t));
+    lib_mli::IteratorCfg<kMoveIterRank> move_cfg(move_tensor);
+    lib_mli::TensorIterator<lib_mli::NoBuffer, kMoveRank, kMoveIterRank> move_it(move_tensor, move_cfg);
+
+    lib_mli::PlatformDescription pd;
+    lib_ref::KernelsFactory kernel_factory(pd);
+    assert(kernel_factory.Max_CS_GetSize() <= kCsBufSize);
+    assert(kernel_factory.Min_CS_GetSize() <= kCsBufSize);
+    assert(kernel_factory.Move_CS_GetSize() <= kCsBufSize);
+    lib_mli::Max_CS* max0_op = kernel_factory.Max_CS(g_cs_buf[kLayerMax0], io_it, io_it, io_it);
+    lib_mli::Move_CS* move_op = kernel_factory.Move_CS(g_cs_buf[kLayerMove], move_it, move_it,
+                                                       lib_mli::MoveDataDirection::kMoveDataDirectionInput);
+    lib_mli::Min_CS* min_op = kernel_factory.Min_CS(g_cs_buf[kLayerMin], io_it, io_it, io_it);
+    lib_mli::Max_CS* max1_op = kernel_factory.Max_CS(g_cs_buf[kLayerMax1], io_it, io_it, io_it);
+    lib_mli::CompilerGenericInterface* ops[kLayerNum] = {max0_op, move_op, min_op, max1_op};
+
+    // STEP 2: Plan the arena with buffer sizes reported by the kernels
+    //==================================================================
+    uint32_t sizes[kBufNum];
+    sizes[kBufA] = max0_op->GetInputLeftBufferSize() * sizeof(int16_t);
+    sizes[kBufB] = max0_op->GetInputRightBufferSize() * sizeof(int16_t);
+    sizes[kBufT0] = max0_op->GetOutputBufferSize() * sizeof(int16_t);
+    sizes[kBufT1] = min_op->GetInputLeftBufferSize() * sizeof(int16_t);
+    sizes[kBufC] = min_op->GetInputRightBufferSize() * sizeof(int16_t);
+    sizes[kBufT2] = min_op->GetOutputBufferSize() * sizeof(int16_t);
+    sizes[kBufOut] = max1_op->GetOutputBufferSize() * sizeof(int16_t);
+
+    lib_mli::GraphBuffer buffers[kBufNum];
+    lib_mli::GraphMemoryPlanner planner(buffers, kBufNum);
+    for (int i = 0; i < kBufNum; i++) {
+        const int32_t id = planner.AddBuffer(sizes[i]);
+        assert(id == i);
+    }
+    for (int l = 0; l < kLayerNum; l++) {
+        if (kLayerBuffers[l].in_left >= 0) planner.MarkUse(kLayerBuffers[l].in_left, l);
+        if (kLayerBuffers[l].in_right >= 0) planner.MarkUse(kLayerBuffers[l].in_right, l);
+        planner.MarkUse(kLayerBuffers[l].out, l);
+    }
+    planner.MarkGraphInput(kBufA);
+    planner.MarkGraphInput(kBufB);
+    planner.MarkGraphInput(kBufC);
+    planner.MarkGraphOutput(kBufOut);
+    mli_status status = planner.Plan();
+    assert(status == MLI_STATUS_OK);
+    assert(planner.GetArenaSize() <= kArenaSize);
+
+    // buffers alive at the same layer must not overlap
+    bool is_plan_valid = true;
+    for (int i = 0; i < kBufNum; i++) {
+        for (int j = i + 1; j < kBufNum; j++) {
+            const bool live_together = buffers[i].first_layer <= buffers[j].last_layer &&
+                                       buffers[j].first_layer <= buffers[i].last_layer;
+            const bool overlap = buffers[i].offset < buffers[j].offset + buffers[j].size &&
+                                 buffers[j].offset < buffers[i].offset + buffers[i].size;
+            if (live_together && overlap) is_plan_valid = false;
+        }
+    }
+    // At most 5 buffers are alive at the same time (at L1), so some memory must be shared
+    is_plan_valid &= planner.GetArenaSize() < planner.GetNonOverlappedSize();
+    char message[64]{};
+    sprintf(message, "Arena = %u of %u bytes", planner.GetArenaSize(), planner.GetNonOverlappedSize());
+    reporter.report_case("Test 1 Liveness memory plan", message, is_plan_valid);
+    final_status &= is_plan_valid;
+
+    // STEP 3: Attach planned offsets and serialize private data of each layer
+    //==================================================================
+    const lib_mli::OffsetBuffer no_ctrl_buf{0, 0, 0, sizeof(char)};
+    status = max0_op->AttachBufferOffsets(arena_buffer(planner, buffers, kBufA), arena_buffer(planner, buffers, kBufB),
+                                          arena_buffer(planner, buffers, kBufT0), no_ctrl_buf);
+    assert(status == MLI_STATUS_OK);
+    status = move_op->AttachBufferOffsets(arena_buffer(planner, buffers, kBufT0), arena_buffer(planner, buffers, kBufT1),
+                                          no_ctrl_buf);
+    assert(status == MLI_STATUS_OK);
+    status = min_op->AttachBufferOffsets(arena_buffer(planner, buffers, kBufT1), arena_buffer(planner, buffers, kBufC),
+                                         arena_buffer(planner, buffers, kBufT2), no_ctrl_buf);
+    assert(status == MLI_STATUS_OK);
+    status = max1_op->AttachBufferOffsets(arena_buffer(planner, buffers, kBufT2), arena_buffer(planner, buffers, kBufA),
+                                          arena_buffer(planner, buffers, kBufOut), no_ctrl_buf);
+    assert(status == MLI_STATUS_OK);
+
+    const uint32_t num_tiles[kLayerNum] = {io_it.GetTotalCount(), move_it.GetTotalCount(),
+                                           io_it.GetTotalCount(), io_it.GetTotalCount()};
+    lib_mli::GraphLayer layers[kLayerNum];
+    for (int l = 0; l < kLayerNum; l++) {
+        assert(ops[l]->GetKernelPrivateDataSize() <= kPrivateBufSize);
+        status = ops[l]->GetKernelPrivateData(g_private_data[l]);
+        assert(status == MLI_STATUS_OK);
+        layers[l].private_data = g_private_data[l];
+        layers[l].private_data_size = ops[l]->GetKernelPrivateDataSize();
+        layers[l].runtime_obj_size = ops[l]->GetRuntimeObjectSize();
+        layers[l].num_tiles = num_tiles[l];
+    }
+    assert(lib_mli::GraphExecutor::GetRuntimeBufferSize(layers, kLayerNum) <= kRuntimeBufSize);
+
+    // STEP 4: Execute the whole graph
+    //==================================================================
+    uint64_t membasis[] = {reinterpret_cast<uint64_t>(g_arena)};
+    lib_mli::GraphExecutor executor(layers, kLayerNum, g_runtime_buf, kRuntimeBufSize,
+                                    membasis, sizeof(membasis) / sizeof(membasis[0]));
+
+    for (int run = 0; run < kRuns; run++) {
+        int16_t* a = arena_tensor(planner, kBufA);
+        int16_t* b = arena_tensor(planner, kBufB);
+        int16_t* c = arena_tensor(planner, kBufC);
+        for (uint32_t i = 0; i < kNumElems; i++) {
+            a[i] = (int16_t)(((i + run) * 7919) % 2001 - 1000);
+            b[i] = (int16_t)(((i + run) * 104729) % 2001 - 1000);
+            c[i] = (int16_t)(((i + run) * 31) % 1001 - 500);
+            const int16_t t0 = a[i] > b[i] ? a[i] : b[i];
+            const int16_t t2 = t0 < c[i] ? t0 : c[i];
+            g_ref[i] = t2 > a[i] ? t2 : a[i];
+        }
+
+        status = executor.Run();
+
+        // inputs are alive until their last consumer, so only the output is checked
+        const int16_t* out = arena_tensor(planner, kBufOut);
+        uint32_t mismatches = 0;
+        for (uint32_t i = 0; i < kNumElems; i++) {
+            if (out[i] != g_ref[i]) mismatches++;
+        }
+        const bool is_run_passed = status == MLI_STATUS_OK && mismatches == 0;
+        sprintf(message, "Status = %d, Mismatches = %u", (int)status, mismatches);
+        reporter.report_case(run == 0 ? "Test 2 Graph execution" : "Test 3 Graph re-execution",
+                             message, is_run_passed);
+        final_status &= is_run_passed;
+    }
+
+    reporter.report_outline("[AUTO] Group: mli_rt_graph_executor_30", final_status);
+    return 0;
+}
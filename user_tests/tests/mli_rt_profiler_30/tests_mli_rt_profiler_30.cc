@@ -0,0 +1,280 @@
+/*
+* Copyright 2022, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "mli_api.h"
+#include "mli_config.h"
+#include "mli_types.h"
+#include "mli_types.hpp"
+#include "mli_graph_executor.hpp"
+#include "mli_kernels_factory_ref.hpp"
+#include "mli_profiler.hpp"
+#include "mli_runtime_api.hpp"
+
+#include "test_memory_manager.h"
+#include "test_report.h"
+
+using mli::tst::reporter_basic;
+
+namespace lib_mli = ::snps_arc::metaware::mli;
+namespace lib_ref = ::snps_arc::metaware::mli::ref;
+
+using lib_mli::kEltwiseRank;
+using lib_mli::kEltwiseIterRank;
+using lib_mli::ProfileCall;
+using lib_mli::ProfileRecord;
+
+// Graph under test (all tensors are int16 of the same shape, processed in tiles along height):
+//   L0: t0  = max(a, b)
+//   L1: out = min(t0, c)
+enum { kBufA = 0, kBufB, kBufC, kBufT0, kBufOut, kBufNum };
+enum { kLayerMax = 0, kLayerMin, kLayerNum };
+
+constexpr uint32_t kShape[kEltwiseRank] = {1, 4, 6, 8};
+constexpr uint32_t kTileSize[kEltwiseRank] = {1, 1, 6, 8};
+constexpr uint32_t kNumTiles = 4;
+constexpr uint32_t kNumElems = kShape[0] * kShape[1] * kShape[2] * kShape[3];
+constexpr uint32_t kTileElems = kTileSize[0] * kTileSize[1] * kTileSize[2] * kTileSize[3];
+// Prefetch, Issue and Update of each tile and a layer record
+constexpr uint32_t kRecordsPerLayer = 3 * kNumTiles + 1;
+constexpr uint32_t kMaxRecords = kLayerNum * kRecordsPerLayer;
+constexpr uint32_t kSmallRecords = 5;
+constexpr uint32_t kArenaSize = 4 * 1024;
+constexpr uint32_t kCsBufSize = 4 * 1024;
+constexpr uint32_t kPrivateBufSize = 4 * 1024;
+constexpr uint32_t kRuntimeBufSize = 4 * 1024;
+constexpr uint32_t kEstimatorBufSize = 4 * 1024;
+constexpr uint32_t kTraceSize = 16 * 1024;
+
+static IO_DATA_ATTR int8_t g_arena[kArenaSize] = {0};
+static uint32_t g_private_data[kLayerNum][kPrivateBufSize / sizeof(uint32_t)];
+static uint32_t g_runtime_buf[kRuntimeBufSize / sizeof(uint32_t)];
+static uint32_t g_estimator_buf[kEstimatorBufSize / sizeof(uint32_t)];
+static uint32_t g_cs_buf[kLayerNum][kCsBufSize / sizeof(uint32_t)];
+static ProfileRecord g_records[kMaxRecords];
+static ProfileRecord g_small_records[kSmallRecords];
+static int16_t g_ref_out[kNumElems];
+static char g_trace[kTraceSize];
+
+static int16_t* arena_tensor(const lib_mli::GraphMemoryPlanner& planner, int32_t buf_id) {
+    return reinterpret_cast<int16_t*>(g_arena + planner.GetOffset(buf_id));
+}
+
+static lib_mli::OffsetBuffer arena_buffer(const lib_mli::GraphMemoryPlanner& planner,
+                                          const lib_mli::GraphBuffer* buffers, int32_t buf_id) {
+    return lib_mli::OffsetBuffer(planner.GetOffset(buf_id), 0, buffers[buf_id].size, sizeof(int16_t));
+}
+
+// Records of a layer: calls of each tile in order, then the layer record which covers them
+static bool check_layer_records(const lib_mli::Profiler& profiler, uint32_t first, uint32_t layer,
+                                lib_mli::kernel_id_t kernel_id, bool with_estimator) {
+    static const ProfileCall kCalls[] = {ProfileCall::kPrefetch, ProfileCall::kIssue, ProfileCall::kUpdate};
+    const uint32_t tile_read_bytes = with_estimator ? 2 * kTileElems * sizeof(int16_t) : 0;
+    const uint32_t tile_write_bytes = with_estimator ? kTileElems * sizeof(int16_t) : 0;
+    bool is_valid = true;
+    uint64_t prev_end = 0;
+    uint32_t read_bytes = 0;
+    uint32_t write_bytes = 0;
+    for (uint32_t i = 0; i < kRecordsPerLayer - 1; i++) {
+        const ProfileRecord& rec = profiler.GetRecord(first + i);
+        const ProfileCall call = kCalls[i % 3];
+        is_valid &= rec.kernel_id == kernel_id && rec.layer == layer && rec.tile == i / 3;
+        is_valid &= rec.call == call && rec.status == MLI_STATUS_OK;
+        is_valid &= rec.start < rec.end && (i == 0 || rec.start >= prev_end);
+        if (call == ProfileCall::kIssue) {
+            is_valid &= rec.read_bytes == tile_read_bytes && rec.write_bytes == tile_write_bytes;
+        } else {
+            is_valid &= rec.read_bytes == 0 && rec.write_bytes == 0;
+        }
+        is_valid &= rec.macs == 0;
+        prev_end = rec.end;
+        read_bytes += rec.read_bytes;
+        write_bytes += rec.write_bytes;
+    }
+    const ProfileRecord& layer_rec = profiler.GetRecord(first + kRecordsPerLayer - 1);
+    const ProfileRecord& first_rec = profiler.GetRecord(first);
+    is_valid &= layer_rec.call == ProfileCall::kLayer && layer_rec.kernel_id == kernel_id;
+    is_valid &= layer_rec.layer == layer && layer_rec.tile == kNumTiles && layer_rec.status == MLI_STATUS_OK;
+    is_valid &= layer_rec.start < first_rec.start && layer_rec.end > prev_end;
+    is_valid &= layer_rec.read_bytes == read_bytes && layer_rec.write_bytes == write_bytes;
+    return is_valid;
+}
+
+static uint32_t count_substr(const char* str, const char* substr) {
+    uint32_t count = 0;
+    for (const char* pos = strstr(str, substr); pos != nullptr; pos = strstr(pos + 1, substr)) {
+        count++;
+    }
+    return count;
+}
+
+int main() {
+    const reporter_basic reporter;
+    bool final_status = true;
+    reporter.report_header("MLI3.0|Runtime|Profiler Tests");
+
+    // STEP 1: Compile all layers of the graph
+    //==================================================================
+    uint32_t shape[kEltwiseRank];
+    int32_t stride[kEltwiseRank];
+    stride[kEltwiseRank - 1] = 1;
+    for (int i = kEltwiseRank - 1; i >= 0; i--) {
+        shape[i] = kShape[i];
+        if (i < (int)kEltwiseRank - 1) stride[i] = stride[i + 1] * (int32_t)shape[i + 1];
+    }
+    lib_mli::Tensor<lib_mli::NoBuffer, kEltwiseRank> io_tensor(shape, stride);
+    io_tensor.set_elem_size(sizeof(int16_t));
+    const int32_t iteration_order[kEltwiseIterRank]{0, 1, 2, 3};
+    lib_mli::IteratorCfg<kEltwiseIterRank> tile_cfg(io_tensor, kTileSize, iteration_order);
+    lib_mli::TensorIterator<lib_mli::NoBuffer, kEltwiseRank, kEltwiseIterRank> io_it(io_tensor, tile_cfg);
+    assert(io_it.GetTotalCount() == kNumTiles);
+
+    lib_mli::PlatformDescription pd;
+    lib_ref::KernelsFactory kernel_factory(pd);
+    assert(kernel_factory.Max_CS_GetSize() <= kCsBufSize);
+    assert(kernel_factory.Min_CS_GetSize() <= kCsBufSize);
+    lib_mli::Max_CS* max_op = kernel_factory.Max_CS(g_cs_buf[kLayerMax], io_it, io_it, io_it);
+    lib_mli::Min_CS* min_op = kernel_factory.Min_CS(g_cs_buf[kLayerMin], io_it, io_it, io_it);
+    lib_mli::CompilerGenericInterface* ops[kLayerNum] = {max_op, min_op};
+
+    // STEP 2: Plan the arena and attach buffers
+    //==================================================================
+    lib_mli::GraphBuffer buffers[kBufNum];
+    lib_mli::GraphMemoryPlanner planner(buffers, kBufNum);
+    for (int i = 0; i < kBufNum; i++) {
+        const int32_t id = planner.AddBuffer(max_op->GetOutputBufferSize() * sizeof(int16_t));
+        assert(id == i);
+    }
+    planner.MarkGraphInput(kBufA);
+    planner.MarkGraphInput(kBufB);
+    planner.MarkGraphInput(kBufC);
+    planner.MarkUse(kBufT0, kLayerMax);
+    planner.MarkUse(kBufT0, kLayerMin);
+    planner.MarkUse(kBufC, kLayerMin);
+    planner.MarkUse(kBufOut, kLayerMin);
+    planner.MarkGraphOutput(kBufOut);
+    // inputs are kept for the next runs of the graph
+    planner.MarkGraphOutput(kBufA);
+    planner.MarkGraphOutput(kBufB);
+    planner.MarkGraphOutput(kBufC);
+    mli_status status = planner.Plan();
+    assert(status == MLI_STATUS_OK);
+    assert(planner.GetArenaSize() <= kArenaSize);
+
+    const lib_mli::OffsetBuffer no_ctrl_buf{0, 0, 0, sizeof(char)};
+    status = max_op->AttachBufferOffsets(arena_buffer(planner, buffers, kBufA), arena_buffer(planner, buffers, kBufB),
+                                         arena_buffer(planner, buffers, kBufT0), no_ctrl_buf);
+    assert(status == MLI_STATUS_OK);
+    status = min_op->AttachBufferOffsets(arena_buffer(planner, buffers, kBufT0), arena_buffer(planner, buffers, kBufC),
+                                         arena_buffer(planner, buffers, kBufOut), no_ctrl_buf);
+    assert(status == MLI_STATUS_OK);
+
+    lib_mli::GraphLayer layers[kLayerNum];
+    for (int l = 0; l < kLayerNum; l++) {
+        assert(ops[l]->GetKernelPrivateDataSize() <= kPrivateBufSize);
+        status = ops[l]->GetKernelPrivateData(g_private_data[l]);
+        assert(status == MLI_STATUS_OK);
+        layers[l].private_data = g_private_data[l];
+        layers[l].private_data_size = ops[l]->GetKernelPrivateDataSize();
+        layers[l].runtime_obj_size = ops[l]->GetRuntimeObjectSize();
+        layers[l].num_tiles = kNumTiles;
+    }
+
+    uint64_t membasis[] = {reinterpret_cast<uint64_t>(g_arena)};
+    lib_mli::GraphExecutor executor(layers, kLayerNum, g_runtime_buf, kRuntimeBufSize,
+                                    membasis, sizeof(membasis) / sizeof(membasis[0]));
+
+    int16_t* a = arena_tensor(planner, kBufA);
+    int16_t* b = arena_tensor(planner, kBufB);
+    int16_t* c = arena_tensor(planner, kBufC);
+    for (uint32_t i = 0; i < kNumElems; i++) {
+        a[i] = (int16_t)((i * 7919) % 2001 - 1000);
+        b[i] = (int16_t)((i * 104729) % 2001 - 1000);
+        c[i] = (int16_t)((i * 31) % 1001 - 500);
+    }
+
+    // STEP 3: Run without profiling to get the reference output
+    //==================================================================
+    status = executor.Run();
+    assert(status == MLI_STATUS_OK);
+    memcpy(g_ref_out, arena_tensor(planner, kBufOut), sizeof(g_ref_out));
+    memset(arena_tensor(planner, kBufOut), 0, sizeof(g_ref_out));
+
+    // STEP 4: Profiled run with bytes from the perf estimators
+    //==================================================================
+    lib_mli::Profiler profiler(g_records, kMaxRecords);
+    executor.SetProfiler(&profiler, &pd, g_estimator_buf, kEstimatorBufSize);
+    status = executor.Run();
+    const bool is_output_valid = memcmp(g_ref_out, arena_tensor(planner, kBufOut), sizeof(g_ref_out)) == 0;
+    bool is_passed = status == MLI_STATUS_OK && is_output_valid && profiler.GetNumRecords() == kMaxRecords &&
+                     profiler.GetNumDropped() == 0 &&
+                     check_layer_records(profiler, 0, kLayerMax, lib_mli::kMaxId, true) &&
+                     check_layer_records(profiler, kRecordsPerLayer, kLayerMin, lib_mli::kMinId, true);
+    char message[128]{};
+    sprintf(message, "Records = %u, Output is %s", profiler.GetNumRecords(), is_output_valid ? "valid" : "corrupted");
+    reporter.report_case("Test 1 Graph records", message, is_passed);
+    final_status &= is_passed;
+
+    // STEP 5: Chrome trace export of the records
+    //==================================================================
+    const uint32_t trace_len = profiler.ExportChromeTrace(g_trace, kTraceSize);
+    is_passed = trace_len == strlen(g_trace) && trace_len < kTraceSize;
+    is_passed &= strncmp(g_trace, "{\"traceEvents\":[", 16) == 0 && strcmp(g_trace + trace_len - 3, "}}\n") == 0;
+    is_passed &= count_substr(g_trace, "\"ph\":\"X\"") == kMaxRecords;
+    is_passed &= count_substr(g_trace, "\"name\":\"Max.Issue\"") == kNumTiles;
+    is_passed &= count_substr(g_trace, "\"name\":\"Min.Layer\"") == 1;
+    is_passed &= strstr(g_trace, "\"read_bytes\":192,\"write_bytes\":96") != nullptr;
+    // truncated export keeps the length of the whole trace and terminates the text
+    char short_trace[64];
+    memset(short_trace, 'x', sizeof(short_trace));
+    is_passed &= profiler.ExportChromeTrace(short_trace, sizeof(short_trace)) == trace_len;
+    is_passed &= strlen(short_trace) == sizeof(short_trace) - 1;
+    is_passed &= profiler.ExportChromeTrace(nullptr, 0) == trace_len;
+    sprintf(message, "Trace length = %u", trace_len);
+    reporter.report_case("Test 2 Chrome trace export", message, is_passed);
+    final_status &= is_passed;
+
+    // STEP 6: Ring buffer keeps the latest records
+    //==================================================================
+    lib_mli::Profiler small_profiler(g_small_records, kSmallRecords);
+    executor.SetProfiler(&small_profiler);
+    status = executor.Run();
+    is_passed = status == MLI_STATUS_OK && small_profiler.GetNumRecords() == kSmallRecords &&
+                small_profiler.GetNumDropped() == kMaxRecords - kSmallRecords;
+    for (uint32_t i = 0; i < kSmallRecords; i++) {
+        // records of the last layer are in the same order as in the full buffer, without bytes
+        const ProfileRecord& rec = small_profiler.GetRecord(i);
+        const ProfileRecord& full_rec = profiler.GetRecord(kMaxRecords - kSmallRecords + i);
+        is_passed &= rec.call == full_rec.call && rec.tile == full_rec.tile && rec.layer == full_rec.layer;
+        is_passed &= rec.read_bytes == 0 && rec.write_bytes == 0;
+    }
+    is_passed &= small_profiler.GetRecord(kSmallRecords - 1).call == ProfileCall::kLayer;
+    small_profiler.Reset();
+    is_passed &= small_profiler.GetNumRecords() == 0 && small_profiler.GetNumDropped() == 0;
+    sprintf(message, "Dropped = %u", kMaxRecords - kSmallRecords);
+    reporter.report_case("Test 3 Ring buffer overwrite", message, is_passed);
+    final_status &= is_passed;
+
+    // STEP 7: Profiling is turned off again
+    //==================================================================
+    executor.SetProfiler(nullptr);
+    status = executor.Run();
+    is_passed = status == MLI_STATUS_OK && small_profiler.GetNumRecords() == 0 &&
+                memcmp(g_ref_out, arena_tensor(planner, kBufOut), sizeof(g_ref_out)) == 0;
+    reporter.report_case("Test 4 Profiling off", "", is_passed);
+    final_status &= is_passed;
+
+    reporter.report_outline("[AUTO] Group: mli_rt_profiler_30", final_status);
+    return final_status ? 0 : 1;
+}
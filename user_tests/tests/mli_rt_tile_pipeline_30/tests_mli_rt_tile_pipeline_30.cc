@@ -0,0 +1,367 @@
+/*
+* Copyright 2022, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <chrono>
+#include <thread>
+
+#include "mli_api.h"
+#include "mli_config.h"
+#include "mli_types.h"
+#include "mli_types.hpp"
+#include "mli_kernels_factory_ref.hpp"
+#include "mli_ref_runtime_api.hpp"
+#include "mli_runtime_api.hpp"
+#include "mli_tile_pipeline.hpp"
+
+#include "test_benchmark.h"
+#include "test_host_sync.h"
+#include "test_memory_manager.h"
+#include "test_report.h"
+
+using mli::tst::benchmark_reporter;
+using mli::tst::HostSynchronization;
+using mli::tst::reporter_basic;
+
+namespace lib_mli = ::snps_arc::metaware::mli;
+namespace lib_ref = ::snps_arc::metaware::mli::ref;
+
+using lib_mli::kEltwiseRank;
+using lib_mli::kEltwiseIterRank;
+using lib_mli::kMoveRank;
+using lib_mli::kMoveIterRank;
+using lib_mli::TilePipeline;
+
+// Kernel under test: out = max(a, b) on int16 tensors in the main memory.
+// Tiles are moved to the fast memory and back by Move kernels of the pipeline.
+// Number of tiles is odd, so both slots end the run in different states.
+enum { kInA = 0, kInB, kOut, kNumIO };
+enum { kMemFast = 0, kMemMain, kNumMems };
+
+constexpr uint32_t kShape[kEltwiseRank] = {1, 3, 6, 8};
+constexpr uint32_t kTileShape[kEltwiseRank] = {1, 1, 2, 8};
+constexpr uint32_t kNumElems = kShape[0] * kShape[1] * kShape[2] * kShape[3];
+constexpr uint32_t kNumTiles = (kShape[1] / kTileShape[1]) * (kShape[2] / kTileShape[2]);
+constexpr uint32_t kNumSlots = TilePipeline::kNumSlots;
+constexpr uint32_t kFastMemSize = 2 * 1024;
+constexpr uint32_t kCsBufSize = 4 * 1024;
+constexpr uint32_t kPrivateBufSize = 4 * 1024;
+constexpr uint32_t kRuntimeBufSize = 2 * 1024;
+constexpr uint32_t kTransferDelayUs = 300;
+
+// Run-time objects: compute and a Move kernel for each input and output, per slot
+enum { kObjCompute = kNumIO, kNumObjs };
+
+static IO_DATA_ATTR int8_t g_fast_mem[kFastMemSize] __attribute__((aligned(lib_mli::kMliAlignment)));
+static int16_t g_main_mem[kNumIO][kNumElems];
+static int16_t g_ref[kNumElems];
+
+static uint32_t g_private_data[kNumObjs][kNumSlots][kPrivateBufSize / sizeof(uint32_t)];
+static uint32_t g_private_data_size[kNumObjs][kNumSlots];
+static uint32_t g_runtime_buf[kNumObjs][kNumSlots][kRuntimeBufSize / sizeof(uint32_t)];
+static uint32_t g_cs_buf[kCsBufSize / sizeof(uint32_t)];
+
+// Asynchronous wrapper of a Move run-time object: Issue() returns immediately and the
+// transfer is done by a thread after a delay, then the event is signaled as by a DMA.
+class AsyncMove : public lib_mli::ExecutionInterface {
+  public:
+    AsyncMove() : m_op(nullptr), m_sync(nullptr), m_event(0) {}
+
+    ~AsyncMove() { Join(); }
+
+    void Init(lib_mli::ExecutionInterface* op, lib_mli::SynchronizationInterface* sync, int32_t event) {
+        Join();
+        m_op = op;
+        m_sync = sync;
+        m_event = event;
+    }
+
+    mli_status Issue() override {
+        Join();
+        m_thread = std::thread([this] {
+            std::this_thread::sleep_for(std::chrono::microseconds(kTransferDelayUs));
+            const mli_status status = m_op->Issue();
+            assert(status == MLI_STATUS_OK);
+            m_sync->SignalEvent(m_event);
+        });
+        return MLI_STATUS_OK;
+    }
+
+    mli_status Prefetch() override { return m_op->Prefetch(); }
+
+    mli_status Update() override {
+        Join();
+        return m_op->Update();
+    }
+
+  private:
+    void Join() {
+        if (m_thread.joinable()) m_thread.join();
+    }
+
+    lib_mli::ExecutionInterface* m_op;
+    lib_mli::SynchronizationInterface* m_sync;
+    int32_t m_event;
+    std::thread m_thread;
+};
+
+static lib_mli::Tensor<lib_mli::NoBuffer, kMoveRank> move_tensor() {
+    uint32_t shape[kMoveRank];
+    int32_t stride[kMoveRank];
+    shape[0] = 1;
+    for (uint32_t i = 0; i < kEltwiseRank; i++) shape[i + 1] = kShape[i];
+    stride[kMoveRank - 1] = 1;
+    for (int i = kMoveRank - 2; i >= 0; i--) stride[i] = stride[i + 1] * (int32_t)kShape[i];
+    lib_mli::Tensor<lib_mli::NoBuffer, kMoveRank> tensor(shape, stride);
+    tensor.set_elem_size(sizeof(int16_t));
+    return tensor;
+}
+
+static void store_private_data(lib_mli::CompilerGenericInterface* op, int obj, uint32_t slot) {
+    assert(op->GetKernelPrivateDataSize() <= kPrivateBufSize);
+    assert(op->GetRuntimeObjectSize() <= kRuntimeBufSize);
+    const mli_status status = op->GetKernelPrivateData(g_private_data[obj][slot]);
+    assert(status == MLI_STATUS_OK);
+    g_private_data_size[obj][slot] = op->GetKernelPrivateDataSize();
+}
+
+// Compile the Move kernel between the whole tensor in the main memory and a tile buffer
+static void compile_move(lib_ref::KernelsFactory& kernel_factory, int io, uint32_t slot,
+                         uint32_t tile_offset, uint32_t tile_size) {
+    const int32_t iteration_order[kMoveIterRank] = {0, 1, 2, 3, 4};
+    uint32_t tile_shape[kMoveIterRank];
+    tile_shape[0] = 1;
+    for (uint32_t i = 0; i < kEltwiseRank; i++) tile_shape[i + 1] = kTileShape[i];
+
+    lib_mli::TensorIterator<lib_mli::NoBuffer, kMoveRank, kMoveIterRank> main_it(move_tensor(), tile_shape,
+                                                                                 iteration_order);
+    // the tile buffer iterates the same tiles, but holds only one of them
+    // with memory strides of the whole tensor, as tile buffers of the eltwise kernel
+    const lib_mli::IteratorCfg<kMoveIterRank>& main_cfg = main_it.get_config();
+    int32_t order[kMoveIterRank], count[kMoveIterRank], first_inc[kMoveIterRank], inc[kMoveIterRank];
+    int32_t last_inc[kMoveIterRank], first_size[kMoveIterRank], size[kMoveIterRank], last_size[kMoveIterRank];
+    for (uint32_t i = 0; i < kMoveIterRank; i++) {
+        order[i] = main_cfg.get_order(i);
+        count[i] = main_cfg.get_count(i);
+        first_inc[i] = main_cfg.get_first_inc(i);
+        inc[i] = main_cfg.get_inc(i);
+        last_inc[i] = main_cfg.get_last_inc(i);
+        first_size[i] = (int32_t)main_cfg.get_first_size(i);
+        size[i] = (int32_t)main_cfg.get_size(i);
+        last_size[i] = (int32_t)main_cfg.get_last_size(i);
+    }
+    const lib_mli::IteratorCfg<kMoveIterRank> tile_cfg(order, count, first_inc, inc, last_inc,
+                                                       first_size, size, last_size, 1);
+    lib_mli::TensorIterator<lib_mli::NoBuffer, kMoveRank, kMoveIterRank> tile_it(move_tensor(), tile_cfg);
+    const lib_mli::OffsetBuffer main_buf{(uint32_t)(io * sizeof(g_main_mem[0])), kMemMain,
+                                         (uint32_t)sizeof(g_main_mem[0]), sizeof(int16_t)};
+    const lib_mli::OffsetBuffer tile_buf{tile_offset, kMemFast, tile_size, sizeof(int16_t)};
+    const lib_mli::OffsetBuffer no_ctrl_buf{0, 0, 0, sizeof(char)};
+
+    assert(kernel_factory.Move_CS_GetSize() <= kCsBufSize);
+    const bool is_input = io != kOut;
+    lib_mli::Move_CS* move_op = is_input
+        ? kernel_factory.Move_CS(g_cs_buf, main_it, tile_it, lib_mli::MoveDataDirection::kMoveDataDirectionInput)
+        : kernel_factory.Move_CS(g_cs_buf, tile_it, main_it, lib_mli::MoveDataDirection::kMoveDataDirectionOutput);
+    const mli_status status = is_input ? move_op->AttachBufferOffsets(main_buf, tile_buf, no_ctrl_buf)
+                                       : move_op->AttachBufferOffsets(tile_buf, main_buf, no_ctrl_buf);
+    assert(status == MLI_STATUS_OK);
+    store_private_data(move_op, io, slot);
+}
+
+// Compile objects of both slots with tile buffers planned by the pipeline
+static void compile_pipeline(lib_ref::KernelsFactory& kernel_factory) {
+    uint32_t shape[kEltwiseRank];
+    int32_t stride[kEltwiseRank];
+    uint32_t tile_shape[kEltwiseIterRank];
+    const int32_t iteration_order[kEltwiseIterRank] = {0, 1, 2, 3};
+    stride[kEltwiseRank - 1] = 1;
+    for (int i = kEltwiseRank - 1; i >= 0; i--) {
+        shape[i] = kShape[i];
+        tile_shape[i] = kTileShape[i];
+        if (i < (int)kEltwiseRank - 1) stride[i] = stride[i + 1] * (int32_t)shape[i + 1];
+    }
+    lib_mli::Tensor<lib_mli::NoBuffer, kEltwiseRank> io_tensor(shape, stride);
+    io_tensor.set_elem_size(sizeof(int16_t));
+    lib_mli::TensorIterator<lib_mli::NoBuffer, kEltwiseRank, kEltwiseIterRank> io_it(io_tensor, tile_shape,
+                                                                                     iteration_order);
+    assert(io_it.GetTotalCount() == kNumTiles);
+
+    uint32_t sizes[kNumIO];
+    uint32_t offsets[kNumSlots * kNumIO];
+    for (uint32_t slot = 0; slot < kNumSlots; slot++) {
+        assert(kernel_factory.Max_CS_GetSize() <= kCsBufSize);
+        lib_mli::Max_CS* max_op = kernel_factory.Max_CS(g_cs_buf, io_it, io_it, io_it);
+        if (slot == 0) {
+            sizes[kInA] = max_op->GetInputLeftBufferSize() * sizeof(int16_t);
+            sizes[kInB] = max_op->GetInputRightBufferSize() * sizeof(int16_t);
+            sizes[kOut] = max_op->GetOutputBufferSize() * sizeof(int16_t);
+            const uint32_t used_size = TilePipeline::PlanBuffers(sizes, kNumIO, 0, offsets);
+            assert(used_size <= kFastMemSize);
+            (void)used_size;
+        }
+        const uint32_t* slot_offsets = &offsets[slot * kNumIO];
+        const lib_mli::OffsetBuffer in_left_buf{slot_offsets[kInA], kMemFast, sizes[kInA], sizeof(int16_t)};
+        const lib_mli::OffsetBuffer in_right_buf{slot_offsets[kInB], kMemFast, sizes[kInB], sizeof(int16_t)};
+        const lib_mli::OffsetBuffer out_buf{slot_offsets[kOut], kMemFast, sizes[kOut], sizeof(int16_t)};
+        const lib_mli::OffsetBuffer no_ctrl_buf{0, 0, 0, sizeof(char)};
+        const mli_status status = max_op->AttachBufferOffsets(in_left_buf, in_right_buf, out_buf, no_ctrl_buf);
+        assert(status == MLI_STATUS_OK);
+        store_private_data(max_op, kObjCompute, slot);
+
+        for (int io = 0; io < kNumIO; io++) {
+            compile_move(kernel_factory, io, slot, slot_offsets[io], sizes[io]);
+        }
+    }
+}
+
+struct pipeline_objs {
+    lib_mli::ExecutionInterface* op[kNumObjs][kNumSlots];
+    AsyncMove async_move[kNumIO][kNumSlots];
+};
+
+static void create_objects(pipeline_objs& objs) {
+    uint64_t membasis[kNumMems];
+    membasis[kMemFast] = reinterpret_cast<uint64_t>(g_fast_mem);
+    membasis[kMemMain] = reinterpret_cast<uint64_t>(g_main_mem);
+    for (int obj = 0; obj < kNumObjs; obj++) {
+        for (uint32_t slot = 0; slot < kNumSlots; slot++) {
+            objs.op[obj][slot] = lib_mli::ExecutionInterface::Create(
+                g_runtime_buf[obj][slot], kRuntimeBufSize, g_private_data[obj][slot],
+                g_private_data_size[obj][slot], membasis, kNumMems);
+            assert(objs.op[obj][slot] != nullptr);
+        }
+    }
+}
+
+static mli_status run_pipeline(TilePipeline& pipeline, pipeline_objs& objs,
+                               lib_mli::SynchronizationInterface* sync) {
+    const lib_mli::TilePipelineOp compute{{objs.op[kObjCompute][0], objs.op[kObjCompute][1]}, {0, 0}, {0, 0}};
+    mli_status status = pipeline.SetCompute(compute);
+    for (int io = 0; io < kNumIO && status == MLI_STATUS_OK; io++) {
+        lib_mli::TilePipelineOp move{{objs.op[io][0], objs.op[io][1]}, {0, 0}, {0, 0}};
+        if (sync != nullptr) {
+            // each transfer of each slot has its own event, as it can be in flight with others
+            for (uint32_t slot = 0; slot < kNumSlots; slot++) {
+                move.issue_event[slot] = (int32_t)(1u << (io * kNumSlots + slot));
+                objs.async_move[io][slot].Init(objs.op[io][slot], sync, move.issue_event[slot]);
+                move.op[slot] = &objs.async_move[io][slot];
+            }
+        }
+        status = (io == kOut) ? pipeline.AddOutput(move) : pipeline.AddInput(move);
+    }
+    if (status == MLI_STATUS_OK) status = pipeline.Run(kNumTiles);
+    return status;
+}
+
+static bool check_run(const reporter_basic& reporter, const char* descr, mli_status status,
+                      const TilePipeline& pipeline, uint32_t expected_overlapped) {
+    char message[96]{};
+    uint32_t mismatches = 0;
+    for (uint32_t i = 0; i < kNumElems; i++) {
+        if (g_main_mem[kOut][i] != g_ref[i]) mismatches++;
+    }
+    const lib_mli::TilePipelineStats& stats = pipeline.GetStats();
+    const bool is_passed = status == MLI_STATUS_OK && mismatches == 0 && stats.tiles == kNumTiles &&
+                           stats.transfers == kNumTiles * kNumIO &&
+                           stats.overlapped_transfers == expected_overlapped;
+    sprintf(message, "Status = %d, Mismatches = %u, Overlap = %u%% (%u of %u)", (int)status, mismatches,
+            pipeline.GetOverlapPercent(), stats.overlapped_transfers, stats.transfers);
+    reporter.report_case(descr, message, is_passed);
+    return is_passed;
+}
+
+int main() {
+    const reporter_basic reporter;
+    benchmark_reporter bench;
+    bool final_status = true;
+    reporter.report_header("MLI3.0|Runtime|Tile Pipeline Tests");
+
+    // STEP 1: Buffers of both slots are aligned and disjoint, invalid configurations are rejected
+    //==================================================================
+    {
+        const uint32_t sizes[] = {10, 64, 3};
+        const uint32_t num = sizeof(sizes) / sizeof(sizes[0]);
+        const uint32_t base = 4;
+        const uint32_t alignment = 8;
+        uint32_t offsets[kNumSlots * num];
+        const uint32_t used = TilePipeline::PlanBuffers(sizes, num, base, offsets, alignment);
+        bool is_valid = true;
+        for (uint32_t i = 0; i < kNumSlots * num; i++) {
+            is_valid &= offsets[i] % alignment == 0 && offsets[i] >= base;
+            is_valid &= offsets[i] + sizes[i % num] <= base + used;
+            for (uint32_t j = 0; j < i; j++) {
+                is_valid &= offsets[j] + sizes[j % num] <= offsets[i];
+            }
+        }
+
+        // objects are never called, so any distinct addresses are fine
+        lib_mli::ExecutionInterface* const obj0 = reinterpret_cast<lib_mli::ExecutionInterface*>(g_runtime_buf[0][0]);
+        lib_mli::ExecutionInterface* const obj1 = reinterpret_cast<lib_mli::ExecutionInterface*>(g_runtime_buf[0][1]);
+        TilePipeline pipeline(nullptr);
+        const lib_mli::TilePipelineOp same_obj{{obj0, obj0}, {0, 0}, {0, 0}};
+        const lib_mli::TilePipelineOp no_sync{{obj0, obj1}, {0, 0}, {1, 2}};
+        is_valid &= pipeline.Run(kNumTiles) == MLI_STATUS_BAD_FUNC_CFG;
+        is_valid &= pipeline.AddInput(same_obj) == MLI_STATUS_BAD_FUNC_CFG;
+        is_valid &= pipeline.AddInput(no_sync) == MLI_STATUS_BAD_FUNC_CFG;
+        reporter.report_case("Test 1 Buffers and config", "", is_valid);
+        final_status &= is_valid;
+    }
+
+    // STEP 2: Compile kernels and prepare the reference
+    //==================================================================
+    lib_mli::PlatformDescription pd;
+    lib_ref::KernelsFactory kernel_factory(pd);
+    compile_pipeline(kernel_factory);
+    for (uint32_t i = 0; i < kNumElems; i++) {
+        g_main_mem[kInA][i] = (int16_t)((i * 7919) % 2001 - 1000);
+        g_main_mem[kInB][i] = (int16_t)((i * 104729) % 2001 - 1000);
+        g_ref[i] = g_main_mem[kInA][i] > g_main_mem[kInB][i] ? g_main_mem[kInA][i] : g_main_mem[kInB][i];
+    }
+
+    // STEP 3: Synchronous Move kernels can't be overlapped with compute
+    //==================================================================
+    {
+        pipeline_objs objs;
+        for (uint32_t i = 0; i < kNumElems; i++) g_main_mem[kOut][i] = 0;
+        create_objects(objs);
+        TilePipeline pipeline(nullptr);
+        const mli_status status = bench.measure([&] { return run_pipeline(pipeline, objs, nullptr); });
+        final_status &= check_run(reporter, "Test 2 Synchronous moves", status, pipeline, 0);
+        bench.add_case("Test 2 Synchronous moves", kNumElems, kNumIO * kNumElems * sizeof(int16_t), kFastMemSize);
+    }
+
+    // STEP 4: Asynchronous Move kernels are overlapped with compute of the neighbor tile.
+    //         Only the first Move-in and the last Move-out of each tensor are exposed.
+    //         Objects are recreated for the second run, the pipeline is reused as is.
+    //==================================================================
+    {
+        static const char* const kAsyncDescr[] = {"Test 3 Asynchronous moves", "Test 4 Async moves rerun"};
+        HostSynchronization sync;
+        pipeline_objs objs;
+        TilePipeline pipeline(&sync);
+        for (uint32_t run = 0; run < 2; run++) {
+            for (uint32_t i = 0; i < kNumElems; i++) g_main_mem[kOut][i] = 0;
+            create_objects(objs);
+            const mli_status status = bench.measure([&] {
+                return (run == 0) ? run_pipeline(pipeline, objs, &sync) : pipeline.Run(kNumTiles);
+            });
+            final_status &= check_run(reporter, kAsyncDescr[run], status, pipeline, (kNumTiles - 1) * kNumIO);
+            bench.add_case(kAsyncDescr[run], kNumElems, kNumIO * kNumElems * sizeof(int16_t), kFastMemSize);
+        }
+    }
+
+    reporter.report_outline("[AUTO] Group: mli_rt_tile_pipeline_30", final_status);
+    bench.report("mli_rt_tile_pipeline_30");
+    return 0;
+}
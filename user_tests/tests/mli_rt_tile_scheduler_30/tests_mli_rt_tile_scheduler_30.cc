@@ -0,0 +1,381 @@
+/*
+* Copyright 2022, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <chrono>
+#include <thread>
+
+#include "mli_api.h"
+#include "mli_config.h"
+#include "mli_types.h"
+#include "mli_types.hpp"
+#include "mli_kernels_factory_ref.hpp"
+#include "mli_ref_runtime_api.hpp"
+#include "mli_runtime_api.hpp"
+#include "mli_tile_scheduler.hpp"
+
+#include "test_benchmark.h"
+#include "test_host_sync.h"
+#include "test_memory_manager.h"
+#include "test_report.h"
+#include "test_tiling.hpp"
+
+using mli::tst::benchmark_reporter;
+using mli::tst::HostSynchronization;
+using mli::tst::reporter_basic;
+
+namespace lib_mli = ::snps_arc::metaware::mli;
+namespace lib_ref = ::snps_arc::metaware::mli::ref;
+
+using lib_mli::kEltwiseRank;
+using lib_mli::kEltwiseIterRank;
+using lib_mli::TileScheduler;
+
+// Graph under test (all tensors are int16 of the same shape in the shared memory):
+//   L0: t   = max(a, b)  tiled by rows
+//   L1: out = max(t, c)  tiled by columns
+// Tiles of L1 read the results of tiles of L0 computed by other workers,
+// so the output is correct only if the barrier between layers works.
+enum { kLayerRows = 0, kLayerCols, kLayerNum };
+
+constexpr uint32_t kShape[kEltwiseRank] = {1, 4, 6, 8};
+constexpr uint32_t kTileShape[kLayerNum][kEltwiseRank] = {{1, 1, 2, 8}, {1, 4, 6, 2}};
+constexpr uint32_t kNumElems = kShape[0] * kShape[1] * kShape[2] * kShape[3];
+constexpr uint32_t kLocalMemSize = 2 * 1024;
+constexpr uint32_t kCsBufSize = 4 * 1024;
+constexpr uint32_t kPrivateBufSize = 4 * 1024;
+constexpr uint32_t kRuntimeBufSize = 4 * 1024;
+constexpr uint32_t kMaxWorkers = TileScheduler::kMaxWorkers;
+constexpr int kRuns = 2;
+constexpr int kBarrierIterations = 100;
+constexpr uint32_t kConsecutiveSchedulers = 6;
+
+// Shared memory
+static int16_t g_a[kNumElems];
+static int16_t g_b[kNumElems];
+static int16_t g_c[kNumElems];
+static int16_t g_t[kNumElems];
+static int16_t g_out[kNumElems];
+static int16_t g_ref[kNumElems];
+
+// Memory of each processor
+static IO_DATA_ATTR int8_t g_local_mem[kMaxWorkers][kLocalMemSize] __attribute__((aligned(lib_mli::kMliAlignment)));
+static uint32_t g_runtime_buf[kMaxWorkers][kRuntimeBufSize / sizeof(uint32_t)];
+
+static uint32_t g_private_data[kLayerNum][kPrivateBufSize / sizeof(uint32_t)];
+static uint32_t g_private_data_size[kLayerNum];
+static uint32_t g_num_tiles[kLayerNum];
+static uint32_t g_cs_buf[kLayerNum][kCsBufSize / sizeof(uint32_t)];
+
+struct layer_ctx {
+    const int16_t* in_left;
+    const int16_t* in_right;
+    int16_t* out;
+    lib_ref::EltwisePrivateData* priv;
+    int8_t* local_mem;
+};
+
+struct tile_info {
+    uint32_t in_left_size[kEltwiseRank];
+    uint32_t in_right_size[kEltwiseRank];
+    uint32_t out_size[kEltwiseRank];
+    int32_t in_left_offsets[kEltwiseRank];
+    int32_t in_right_offsets[kEltwiseRank];
+    int32_t out_offsets[kEltwiseRank];
+};
+
+static void get_tile_info(lib_mli::ExecutionInterface& op, tile_info& info) {
+    lib_ref::Max* max_op = dynamic_cast<lib_ref::Max*>(&op);
+    assert(max_op != nullptr);
+    max_op->GetIOSizesAndOffsets(info.in_left_size, info.in_right_size, info.out_size,
+                                 info.in_left_offsets, info.in_right_offsets, info.out_offsets);
+}
+
+// copy inputs of the tile from the shared memory to the local memory of the processor
+static mli_status load_tile(lib_mli::ExecutionInterface& op, uint32_t tile_idx, void* ctx) {
+    const layer_ctx& layer = *static_cast<layer_ctx*>(ctx);
+    const int32_t zero_offsets[kEltwiseRank]{};
+    int32_t strides[kEltwiseRank];
+    tile_info info;
+    get_tile_info(op, info);
+
+    layer.priv->m_in_left_buffer.get_mem_strides(strides);
+    strided_copy_with_offsets(kEltwiseRank, sizeof(int16_t), (const int8_t*)layer.in_left,
+                              info.in_left_offsets, zero_offsets, strides, info.in_left_size,
+                              layer.local_mem + layer.priv->m_in_left_buffer.get_buf().get_offset());
+    layer.priv->m_in_right_buffer.get_mem_strides(strides);
+    strided_copy_with_offsets(kEltwiseRank, sizeof(int16_t), (const int8_t*)layer.in_right,
+                              info.in_right_offsets, zero_offsets, strides, info.in_right_size,
+                              layer.local_mem + layer.priv->m_in_right_buffer.get_buf().get_offset());
+    return MLI_STATUS_OK;
+}
+
+// copy output of the tile from the local memory of the processor to the shared memory
+static mli_status store_tile(lib_mli::ExecutionInterface& op, uint32_t tile_idx, void* ctx) {
+    const layer_ctx& layer = *static_cast<layer_ctx*>(ctx);
+    const int32_t zero_offsets[kEltwiseRank]{};
+    int32_t strides[kEltwiseRank];
+    tile_info info;
+    get_tile_info(op, info);
+
+    layer.priv->m_output_buffer.get_mem_strides(strides);
+    strided_copy_with_offsets(kEltwiseRank, sizeof(int16_t),
+                              layer.local_mem + layer.priv->m_output_buffer.get_buf().get_offset(),
+                              zero_offsets, info.out_offsets, strides, info.out_size, (int8_t*)layer.out);
+    return MLI_STATUS_OK;
+}
+
+static void graph_worker(uint32_t worker_id, uint32_t num_workers,
+                         lib_mli::SynchronizationInterface* sync, mli_status* result) {
+    lib_mli::PlatformDescription pd;
+    pd.SetProcessorId(worker_id);
+    pd.SetNumProcessors(num_workers);
+    TileScheduler scheduler(pd, sync);
+
+    uint64_t membasis[] = {reinterpret_cast<uint64_t>(g_local_mem[worker_id])};
+    layer_ctx layers[kLayerNum] = {
+        {g_a, g_b, g_t, nullptr, g_local_mem[worker_id]},
+        {g_t, g_c, g_out, nullptr, g_local_mem[worker_id]},
+    };
+
+    mli_status status = MLI_STATUS_OK;
+    for (int run = 0; run < kRuns; run++) {
+        for (int l = 0; l < kLayerNum; l++) {
+            lib_mli::ExecutionInterface* op = lib_mli::ExecutionInterface::Create(
+                g_runtime_buf[worker_id], kRuntimeBufSize, g_private_data[l], g_private_data_size[l],
+                membasis, sizeof(membasis) / sizeof(membasis[0]));
+            assert(op != nullptr);
+            layers[l].priv = reinterpret_cast<lib_ref::EltwisePrivateData*>(g_private_data[l]);
+            const mli_status layer_status = scheduler.Run(*op, g_num_tiles[l], load_tile, store_tile, &layers[l]);
+            if (status == MLI_STATUS_OK) status = layer_status;
+        }
+    }
+    const mli_status finish_status = scheduler.Finish();
+    *result = (status != MLI_STATUS_OK) ? status : finish_status;
+}
+
+static mli_status run_graph(uint32_t num_workers) {
+    HostSynchronization sync;
+    mli_status results[kMaxWorkers];
+    std::thread workers[kMaxWorkers];
+    for (uint32_t w = 0; w < num_workers; w++) {
+        workers[w] = std::thread(graph_worker, w, num_workers, &sync, &results[w]);
+    }
+    mli_status status = MLI_STATUS_OK;
+    for (uint32_t w = 0; w < num_workers; w++) {
+        workers[w].join();
+        if (status == MLI_STATUS_OK) status = results[w];
+    }
+    return status;
+}
+
+// Each worker publishes the iteration number and checks values of all others after the barrier.
+// Slots are double buffered, so a slot is rewritten only after the next barrier.
+static uint32_t g_slots[2][kMaxWorkers];
+
+static void barrier_worker(uint32_t worker_id, uint32_t num_workers,
+                           lib_mli::SynchronizationInterface* sync, uint32_t* errors) {
+    lib_mli::PlatformDescription pd;
+    pd.SetProcessorId(worker_id);
+    pd.SetNumProcessors(num_workers);
+    TileScheduler scheduler(pd, sync);
+
+    *errors = 0;
+    for (uint32_t it = 0; it < kBarrierIterations; it++) {
+        g_slots[it % 2][worker_id] = it;
+        if (scheduler.Barrier() != MLI_STATUS_OK) (*errors)++;
+        for (uint32_t w = 0; w < num_workers; w++) {
+            if (g_slots[it % 2][w] != it) (*errors)++;
+        }
+    }
+}
+
+// Same check with a new scheduler on the same events after every few barriers, as with
+// one scheduler per layer. Late workers make a barrier which passes at once visible.
+static void consecutive_worker(uint32_t worker_id, uint32_t num_workers,
+                               lib_mli::SynchronizationInterface* sync, uint32_t* errors) {
+    lib_mli::PlatformDescription pd;
+    pd.SetProcessorId(worker_id);
+    pd.SetNumProcessors(num_workers);
+
+    *errors = 0;
+    uint32_t it = 0;
+    for (uint32_t s = 0; s < kConsecutiveSchedulers; s++) {
+        TileScheduler scheduler(pd, sync);
+        const uint32_t num_barriers = s % 3 + 1;
+        for (uint32_t b = 0; b < num_barriers; b++, it++) {
+            if (b == 0 && worker_id != 0) std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            g_slots[it % 2][worker_id] = it;
+            if (scheduler.Barrier() != MLI_STATUS_OK) (*errors)++;
+            for (uint32_t w = 0; w < num_workers; w++) {
+                if (g_slots[it % 2][w] != it) (*errors)++;
+            }
+        }
+        if (scheduler.Finish() != MLI_STATUS_OK) (*errors)++;
+    }
+}
+
+static void compile_layer(lib_ref::KernelsFactory& kernel_factory, int layer_idx) {
+    uint32_t shape[kEltwiseRank];
+    int32_t stride[kEltwiseRank];
+    uint32_t tile_shape[kEltwiseIterRank];
+    int32_t iteration_order[kEltwiseIterRank] = {0, 1, 2, 3};
+    stride[kEltwiseRank - 1] = 1;
+    for (int i = kEltwiseRank - 1; i >= 0; i--) {
+        shape[i] = kShape[i];
+        tile_shape[i] = kTileShape[layer_idx][i];
+        if (i < (int)kEltwiseRank - 1) stride[i] = stride[i + 1] * (int32_t)shape[i + 1];
+    }
+    lib_mli::Tensor<lib_mli::NoBuffer, kEltwiseRank> io_tensor(shape, stride);
+    io_tensor.set_elem_size(sizeof(int16_t));
+    lib_mli::TensorIterator<lib_mli::NoBuffer, kEltwiseRank, kEltwiseIterRank> io_it(io_tensor, tile_shape,
+                                                                                     iteration_order);
+
+    assert(kernel_factory.Max_CS_GetSize() <= kCsBufSize);
+    lib_mli::Max_CS* max_op = kernel_factory.Max_CS(g_cs_buf[layer_idx], io_it, io_it, io_it);
+
+    // tile buffers are placed one after another in the local memory of each processor
+    uint32_t offset = 0;
+    const uint32_t in_left_size = max_op->GetInputLeftBufferSize() * sizeof(int16_t);
+    lib_mli::OffsetBuffer in_left_buf{offset, 0, in_left_size, sizeof(int16_t)};
+    offset += in_left_size;
+    const uint32_t in_right_size = max_op->GetInputRightBufferSize() * sizeof(int16_t);
+    lib_mli::OffsetBuffer in_right_buf{offset, 0, in_right_size, sizeof(int16_t)};
+    offset += in_right_size;
+    const uint32_t out_size = max_op->GetOutputBufferSize() * sizeof(int16_t);
+    lib_mli::OffsetBuffer out_buf{offset, 0, out_size, sizeof(int16_t)};
+    offset += out_size;
+    assert(offset <= kLocalMemSize);
+    const lib_mli::OffsetBuffer no_ctrl_buf{0, 0, 0, sizeof(char)};
+
+    mli_status status = max_op->AttachBufferOffsets(in_left_buf, in_right_buf, out_buf, no_ctrl_buf);
+    assert(status == MLI_STATUS_OK);
+    assert(max_op->GetKernelPrivateDataSize() <= kPrivateBufSize);
+    assert(max_op->GetRuntimeObjectSize() <= kRuntimeBufSize);
+    status = max_op->GetKernelPrivateData(g_private_data[layer_idx]);
+    assert(status == MLI_STATUS_OK);
+    g_private_data_size[layer_idx] = max_op->GetKernelPrivateDataSize();
+    g_num_tiles[layer_idx] = io_it.GetTotalCount();
+}
+
+int main() {
+    const reporter_basic reporter;
+    benchmark_reporter bench;
+    bool final_status = true;
+    char message[64]{};
+    reporter.report_header("MLI3.0|Runtime|Tile Scheduler Tests");
+
+    // STEP 1: Tile ranges of all workers are contiguous, balanced and cover all tiles
+    //==================================================================
+    bool is_ranges_valid = true;
+    for (uint32_t total = 0; total < 3 * kMaxWorkers; total++) {
+        for (uint32_t num_workers = 1; num_workers <= kMaxWorkers; num_workers++) {
+            uint32_t next = 0;
+            for (uint32_t w = 0; w < num_workers; w++) {
+                const lib_mli::TileRange range = TileScheduler::GetTileRange(total, num_workers, w);
+                is_ranges_valid &= range.first == next;
+                is_ranges_valid &= range.count == total / num_workers ||
+                                   range.count == total / num_workers + 1;
+                next += range.count;
+            }
+            is_ranges_valid &= next == total;
+        }
+    }
+    reporter.report_case("Test 1 Tile ranges", "", is_ranges_valid);
+    final_status &= is_ranges_valid;
+
+    // STEP 2: Barrier is reusable many times in a row
+    //==================================================================
+    {
+        const uint32_t num_workers = 4;
+        HostSynchronization sync;
+        uint32_t errors[kMaxWorkers];
+        std::thread workers[kMaxWorkers];
+        for (uint32_t w = 0; w < num_workers; w++) {
+            workers[w] = std::thread(barrier_worker, w, num_workers, &sync, &errors[w]);
+        }
+        uint32_t total_errors = 0;
+        for (uint32_t w = 0; w < num_workers; w++) {
+            workers[w].join();
+            total_errors += errors[w];
+        }
+        sprintf(message, "Errors = %u", total_errors);
+        reporter.report_case("Test 2 Barrier", message, total_errors == 0);
+        final_status &= total_errors == 0;
+    }
+
+    // STEP 3: Consecutive schedulers share the events
+    //==================================================================
+    {
+        const uint32_t num_workers = 3;
+        HostSynchronization sync;
+        uint32_t errors[kMaxWorkers];
+        std::thread workers[kMaxWorkers];
+        for (uint32_t w = 0; w < num_workers; w++) {
+            workers[w] = std::thread(consecutive_worker, w, num_workers, &sync, &errors[w]);
+        }
+        uint32_t total_errors = 0;
+        for (uint32_t w = 0; w < num_workers; w++) {
+            workers[w].join();
+            total_errors += errors[w];
+        }
+        sprintf(message, "Errors = %u", total_errors);
+        reporter.report_case("Test 3 Consecutive schedulers", message, total_errors == 0);
+        final_status &= total_errors == 0;
+    }
+
+    // STEP 4: Compile layers and prepare the reference
+    //==================================================================
+    lib_mli::PlatformDescription pd;
+    lib_ref::KernelsFactory kernel_factory(pd);
+    for (int l = 0; l < kLayerNum; l++) {
+        compile_layer(kernel_factory, l);
+    }
+    for (uint32_t i = 0; i < kNumElems; i++) {
+        g_a[i] = (int16_t)((i * 7919) % 2001 - 1000);
+        g_b[i] = (int16_t)((i * 104729) % 2001 - 1000);
+        g_c[i] = (int16_t)((i * 31) % 1001 - 500);
+        const int16_t t = g_a[i] > g_b[i] ? g_a[i] : g_b[i];
+        g_ref[i] = t > g_c[i] ? t : g_c[i];
+    }
+
+    // STEP 5: Execute the graph on different number of workers
+    //==================================================================
+    static const char* const kDescr[] = {"Test 4 1 worker", "Test 5 2 workers", "Test 6 3 workers",
+                                         "Test 7 4 workers", "Test 8 7 workers"};
+    static const uint32_t kNumWorkers[] = {1, 2, 3, 4, 7};
+    for (uint32_t i = 0; i < sizeof(kNumWorkers) / sizeof(kNumWorkers[0]); i++) {
+        for (uint32_t j = 0; j < kNumElems; j++) {
+            g_t[j] = 0;
+            g_out[j] = 0;
+        }
+        const mli_status status = bench.measure([&] { return run_graph(kNumWorkers[i]); });
+
+        uint32_t mismatches = 0;
+        for (uint32_t j = 0; j < kNumElems; j++) {
+            if (g_out[j] != g_ref[j]) mismatches++;
+        }
+        const bool is_run_passed = status == MLI_STATUS_OK && mismatches == 0;
+        sprintf(message, "Status = %d, Mismatches = %u", (int)status, mismatches);
+        reporter.report_case(kDescr[i], message, is_run_passed);
+        final_status &= is_run_passed;
+
+        bench.add_case(kDescr[i], (uint64_t)kNumElems * kLayerNum * kRuns,
+                       5 * kNumElems * sizeof(int16_t) * kRuns,
+                       kNumWorkers[i] * kLocalMemSize + 5 * kNumElems * sizeof(int16_t));
+    }
+
+    reporter.report_outline("[AUTO] Group: mli_rt_tile_scheduler_30", final_status);
+    bench.report("mli_rt_tile_scheduler_30");
+    return 0;
+}
@@ -0,0 +1,311 @@
+/*
+* Copyright 2022, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "mli_api.h"
+#include "mli_config.h"
+#include "mli_math_macros.h"
+#include "mli_types.h"
+#include "mli_types.hpp"
+#include "mli_tiler.hpp"
+
+#include "test_report.h"
+
+using mli::tst::reporter_basic;
+
+namespace lib_mli = ::snps_arc::metaware::mli;
+
+using lib_mli::kTilerRank;
+using lib_mli::Tiler;
+using lib_mli::TilerCandidate;
+using lib_mli::TilerProblem;
+
+constexpr uint32_t kMaxCandidates = 16;
+
+// Conv2d 3x3 with "same" padding: [1, 12, 10, 1, 8] -> [1, 12, 10, 1, 16]
+static TilerProblem get_conv_problem() {
+    const uint32_t in_shape[lib_mli::kConvIORank] = {1, 12, 10, 1, 8};
+    const uint32_t w_shape[lib_mli::kConvWRank] = {1, 3, 3, 8, 16};
+    const lib_mli::Conv2DConfig cfg(1, 1, 1, 1, 1, 1, 1, 1, 1);
+    return TilerProblem::Conv2d(in_shape, w_shape, cfg, sizeof(int8_t), sizeof(int8_t), sizeof(int32_t));
+}
+
+static lib_mli::PlatformDescription get_pd(uint32_t budget) {
+    lib_mli::PlatformDescription pd;
+    pd.SetVectorLength8bit(16);
+    pd.SetVectorLength16bit(8);
+    pd.SetMemorySize(0, budget);
+    return pd;
+}
+
+// Candidate covers the whole output and its buffers fit the budget
+static bool is_candidate_valid(const TilerProblem& problem, const TilerCandidate& c, uint32_t budget) {
+    uint32_t num_tiles = 1;
+    for (uint32_t dim = 0; dim < kTilerRank; dim++) {
+        num_tiles *= CEIL_DIV(problem.out_shape[dim], c.tile_size[dim]);
+    }
+    uint32_t used = 0;
+    for (uint32_t i = 0; i < TilerProblem::kNumBuffers; i++) {
+        used += c.buffer_size[i] * problem.num_slots;
+    }
+    return num_tiles == c.num_tiles && used == c.mem_usage[0] && used <= budget &&
+           c.read_bytes > 0 && c.write_bytes > 0 && c.cycles > 0;
+}
+
+// Best of all possible tile sizes evaluated one by one
+static bool get_exhaustive_best(const Tiler& tiler, const TilerProblem& problem, TilerCandidate& best) {
+    bool found = false;
+    uint32_t tile[kTilerRank];
+    uint32_t total = 1;
+    for (uint32_t dim = 0; dim < kTilerRank; dim++) total *= problem.out_shape[dim];
+    for (uint32_t idx = 0; idx < total; idx++) {
+        for (uint32_t dim = 0, rest = idx; dim < kTilerRank; dim++) {
+            tile[dim] = rest % problem.out_shape[dim] + 1;
+            rest /= problem.out_shape[dim];
+        }
+        TilerCandidate c;
+        if (tiler.Evaluate(tile, c) != MLI_STATUS_OK) continue;
+        if (!found || Tiler::IsBetter(c, best)) best = c;
+        found = true;
+    }
+    return found;
+}
+
+int main() {
+    const reporter_basic reporter;
+    bool final_status = true;
+    char message[96]{};
+    reporter.report_header("MLI3.0|Runtime|Tiler Tests");
+
+    const TilerProblem conv = get_conv_problem();
+
+    // STEP 1: Best candidates fit the budget and are sorted
+    //==================================================================
+    {
+        bool is_passed = true;
+        uint32_t prev_cycles = 0;
+        const uint32_t budgets[] = {8192, 2048, 1024, 512, 256};
+        for (uint32_t budget : budgets) {
+            const Tiler tiler(get_pd(budget), conv);
+            TilerCandidate candidates[kMaxCandidates];
+            const uint32_t num = tiler.Search(candidates, kMaxCandidates);
+            is_passed &= num > 0;
+            for (uint32_t i = 0; i < num; i++) {
+                is_passed &= is_candidate_valid(conv, candidates[i], budget);
+                if (i > 0) is_passed &= !Tiler::IsBetter(candidates[i], candidates[i - 1]);
+            }
+            // smaller budget can't give a better tiling
+            if (num > 0 && budget != budgets[0]) is_passed &= candidates[0].cycles >= prev_cycles;
+            if (num > 0) prev_cycles = (uint32_t)candidates[0].cycles;
+        }
+        reporter.report_case("Test 1 Budget and ranking", "", is_passed);
+        final_status &= is_passed;
+    }
+
+    // STEP 2: Search gives the same best candidate as evaluation of all tile sizes
+    //==================================================================
+    {
+        bool is_passed = true;
+        const uint32_t budgets[] = {4096, 1024, 400};
+        for (uint32_t budget : budgets) {
+            const Tiler tiler(get_pd(budget), conv);
+            TilerCandidate best;
+            TilerCandidate exhaustive;
+            is_passed &= tiler.GetBest(best) == MLI_STATUS_OK;
+            is_passed &= get_exhaustive_best(tiler, conv, exhaustive);
+            is_passed &= best.cycles == exhaustive.cycles &&
+                         best.read_bytes + best.write_bytes == exhaustive.read_bytes + exhaustive.write_bytes;
+        }
+        reporter.report_case("Test 2 Exhaustive search", "", is_passed);
+        final_status &= is_passed;
+    }
+
+    // STEP 3: Traffic includes halo of input tiles and re-fetch of input per channel tile
+    //==================================================================
+    {
+        const Tiler tiler(get_pd(UINT32_MAX), conv);
+        const uint32_t in_bytes = 12 * 10 * 8;
+        const uint32_t w_bytes = 3 * 3 * 8 * 16;
+        const uint32_t out_bytes = 12 * 10 * 16 * sizeof(int32_t);
+        TilerCandidate c;
+        bool is_passed = true;
+
+        // single tile
+        const uint32_t whole[kTilerRank] = {1, 12, 10, 1, 16};
+        is_passed &= tiler.Evaluate(whole, c) == MLI_STATUS_OK;
+        is_passed &= c.num_tiles == 1 && c.read_bytes == in_bytes + w_bytes && c.write_bytes == out_bytes;
+
+        // 3 tiles of 4 rows: input rows 0..4, 3..8, 7..11 -> 2 * 2 rows of halo
+        const uint32_t rows[kTilerRank] = {1, 4, 10, 1, 16};
+        is_passed &= tiler.Evaluate(rows, c) == MLI_STATUS_OK;
+        is_passed &= c.num_tiles == 3 && c.read_bytes == in_bytes + 4 * 10 * 8 + w_bytes &&
+                     c.write_bytes == out_bytes;
+
+        // 4 channel tiles: input tile is the same for all tiles, weights are split
+        const uint32_t channels[kTilerRank] = {1, 12, 10, 1, 4};
+        is_passed &= tiler.Evaluate(channels, c) == MLI_STATUS_OK;
+        is_passed &= c.num_tiles == 4 && c.read_bytes == in_bytes + w_bytes &&
+                     c.buffer_size[TilerProblem::kWeights] == w_bytes / 4;
+
+        // rows and channels: input is fetched for each channel tile, but weights are not
+        // re-fetched as channels are the outermost
+        const uint32_t both[kTilerRank] = {1, 4, 10, 1, 4};
+        is_passed &= tiler.Evaluate(both, c) == MLI_STATUS_OK;
+        is_passed &= c.num_tiles == 12 && c.read_bytes == 4 * (in_bytes + 4 * 10 * 8) + w_bytes;
+
+        sprintf(message, "Read = %lld, Write = %lld", (long long)c.read_bytes, (long long)c.write_bytes);
+        reporter.report_case("Test 3 Traffic", message, is_passed);
+        final_status &= is_passed;
+    }
+
+    // STEP 4: Not enough memory and invalid tile sizes
+    //==================================================================
+    {
+        bool is_passed = true;
+        const Tiler tiler(get_pd(64), conv);
+        TilerCandidate c;
+        is_passed &= tiler.GetBest(c) == MLI_STATUS_NOT_ENGH_MEM;
+        is_passed &= tiler.Search(&c, 1) == 0;
+        const uint32_t small[kTilerRank] = {1, 1, 1, 1, 1};
+        is_passed &= tiler.Evaluate(small, c) == MLI_STATUS_NOT_ENGH_MEM;
+
+        // first tile must cover the pre-padding
+        const uint32_t in_shape[lib_mli::kConvIORank] = {1, 12, 10, 1, 8};
+        const uint32_t w_shape[lib_mli::kConvWRank] = {1, 5, 5, 8, 16};
+        const lib_mli::Conv2DConfig cfg(1, 1, 2, 2, 2, 2, 1, 1, 1);
+        const TilerProblem padded = TilerProblem::Conv2d(in_shape, w_shape, cfg, 1, 1, 4);
+        const Tiler padded_tiler(get_pd(UINT32_MAX), padded);
+        is_passed &= padded_tiler.Evaluate(small, c) == MLI_STATUS_BAD_FUNC_CFG;
+        const uint32_t two_rows[kTilerRank] = {1, 2, 2, 1, 1};
+        is_passed &= padded_tiler.Evaluate(two_rows, c) == MLI_STATUS_OK;
+        const uint32_t too_big[kTilerRank] = {1, 13, 10, 1, 16};
+        is_passed &= padded_tiler.Evaluate(too_big, c) == MLI_STATUS_BAD_FUNC_CFG;
+
+        TilerCandidate candidates[kMaxCandidates];
+        const Tiler padded_small(get_pd(600), padded);
+        const uint32_t num = padded_small.Search(candidates, kMaxCandidates);
+        is_passed &= num > 0;
+        for (uint32_t i = 0; i < num; i++) {
+            is_passed &= candidates[i].tile_size[1] >= 2 && candidates[i].tile_size[2] >= 2;
+        }
+        reporter.report_case("Test 4 Constraints", "", is_passed);
+        final_status &= is_passed;
+    }
+
+    // STEP 5: Iterator configs match the candidate
+    //==================================================================
+    {
+        bool is_passed = true;
+        const Tiler tiler(get_pd(700), conv);
+        TilerCandidate c;
+        is_passed &= tiler.GetBest(c) == MLI_STATUS_OK;
+        const lib_mli::IteratorCfg<kTilerRank> out_cfg = tiler.GetOutputIteratorCfg(c);
+        const lib_mli::IteratorCfg<kTilerRank> in_cfg = tiler.GetInputIteratorCfg(c);
+        uint32_t num_tiles = 1;
+        uint32_t in_elems = 1;
+        uint32_t out_elems = 1;
+        for (uint32_t dim = 0; dim < kTilerRank; dim++) {
+            num_tiles *= out_cfg.get_count(dim);
+            is_passed &= in_cfg.get_count(dim) == out_cfg.get_count(dim);
+            is_passed &= out_cfg.get_first_size(dim) == c.tile_size[dim];
+            if (out_cfg.get_count(dim) > 1) {
+                in_elems *= MAX(in_cfg.get_first_size(dim), in_cfg.get_size(dim));
+                out_elems *= MAX(out_cfg.get_first_size(dim), out_cfg.get_size(dim));
+            } else {
+                in_elems *= in_cfg.get_first_size(dim);
+                out_elems *= out_cfg.get_first_size(dim);
+            }
+        }
+        is_passed &= num_tiles == c.num_tiles;
+        is_passed &= CEIL_RND(in_elems, lib_mli::kMliAlignment) == c.buffer_size[TilerProblem::kInput];
+        is_passed &= out_elems * sizeof(int32_t) == c.buffer_size[TilerProblem::kOutput];
+        sprintf(message, "Tile = [%u, %u, %u, %u, %u], Tiles = %u", c.tile_size[0], c.tile_size[1],
+                c.tile_size[2], c.tile_size[3], c.tile_size[4], c.num_tiles);
+        reporter.report_case("Test 5 Iterator configs", message, is_passed);
+        final_status &= is_passed;
+    }
+
+    // STEP 6: Double buffering takes twice the memory and hides transfers
+    //==================================================================
+    {
+        bool is_passed = true;
+        TilerProblem pipelined = conv;
+        pipelined.num_slots = 2;
+        const uint32_t tile[kTilerRank] = {1, 6, 10, 1, 8};
+        TilerCandidate single;
+        TilerCandidate twice;
+        is_passed &= Tiler(get_pd(UINT32_MAX), conv).Evaluate(tile, single) == MLI_STATUS_OK;
+        is_passed &= Tiler(get_pd(UINT32_MAX), pipelined).Evaluate(tile, twice) == MLI_STATUS_OK;
+        is_passed &= twice.mem_usage[0] == 2 * single.mem_usage[0];
+        is_passed &= twice.cycles < single.cycles && twice.read_bytes == single.read_bytes;
+
+        TilerCandidate best;
+        is_passed &= Tiler(get_pd(1024), pipelined).GetBest(best) == MLI_STATUS_OK;
+        is_passed &= is_candidate_valid(pipelined, best, 1024);
+        reporter.report_case("Test 6 Double buffering", "", is_passed);
+        final_status &= is_passed;
+    }
+
+    // STEP 7: Buffers in different memories
+    //==================================================================
+    {
+        bool is_passed = true;
+        TilerProblem split = conv;
+        split.mem_idx[TilerProblem::kWeights] = 1;
+        lib_mli::PlatformDescription pd = get_pd(600);
+        pd.SetMemorySize(1, 1152);
+        TilerCandidate c;
+        is_passed &= Tiler(pd, split).GetBest(c) == MLI_STATUS_OK;
+        is_passed &= c.mem_usage[0] <= 600 && c.mem_usage[1] <= 1152;
+        is_passed &= c.mem_usage[1] == c.buffer_size[TilerProblem::kWeights];
+        is_passed &= c.mem_usage[0] == c.buffer_size[TilerProblem::kInput] + c.buffer_size[TilerProblem::kOutput];
+        reporter.report_case("Test 7 Several memories", "", is_passed);
+        final_status &= is_passed;
+    }
+
+    // STEP 8: Depthwise, pooling and eltwise kernels
+    //==================================================================
+    {
+        bool is_passed = true;
+        TilerCandidate c;
+        uint32_t tile4d[lib_mli::kPoolRank];
+
+        const uint32_t dw_in[lib_mli::kDepthwiseIORank] = {1, 16, 16, 1, 32};
+        const uint32_t dw_w[lib_mli::kDepthwiseWRank] = {3, 3, 32};
+        const lib_mli::DwConv2DConfig dw_cfg(2, 2, 1, 1, 0, 0, 1, 1);
+        const TilerProblem dw = TilerProblem::DepthwiseConv2d(dw_in, dw_w, dw_cfg, 1, 1, 4);
+        is_passed &= dw.out_shape[1] == 8 && dw.out_shape[2] == 8 && dw.out_shape[4] == 32;
+        is_passed &= Tiler(get_pd(1024), dw).GetBest(c) == MLI_STATUS_OK;
+        is_passed &= is_candidate_valid(dw, c, 1024);
+
+        const uint32_t pool_in[lib_mli::kPoolRank] = {1, 15, 15, 16};
+        const lib_mli::PoolOpConfig pool_cfg(3, 3, 2, 2, 0, 0, 0, 0);
+        const TilerProblem pool = TilerProblem::Pool2D(pool_in, pool_cfg, sizeof(int8_t));
+        is_passed &= pool.out_shape[1] == 7 && pool.out_shape[2] == 7 && pool.out_shape[3] == 1;
+        is_passed &= Tiler(get_pd(512), pool).GetBest(c) == MLI_STATUS_OK;
+        is_passed &= is_candidate_valid(pool, c, 512);
+        Tiler::GetTileSize(c, lib_mli::kPoolRank, tile4d);
+        is_passed &= tile4d[3] == c.tile_size[4] && tile4d[1] == c.tile_size[1];
+
+        const uint32_t shape[lib_mli::kEltwiseRank] = {1, 8, 8, 16};
+        const TilerProblem add = TilerProblem::Eltwise(shape, sizeof(int16_t), sizeof(int16_t));
+        is_passed &= Tiler(get_pd(1024), add).GetBest(c) == MLI_STATUS_OK;
+        is_passed &= is_candidate_valid(add, c, 1024);
+        // no halo: both inputs and the output are moved exactly once
+        is_passed &= c.read_bytes == 2 * 8 * 8 * 16 * sizeof(int16_t) && c.write_bytes == 8 * 8 * 16 * sizeof(int16_t);
+        reporter.report_case("Test 8 Other kernels", "", is_passed);
+        final_status &= is_passed;
+    }
+
+    reporter.report_outline("[AUTO] Group: mli_rt_tiler_30", final_status);
+    return 0;
+}